@@ -37,6 +37,11 @@
 #ifndef __COMMON_H__
 #define __COMMON_H__
 
+#if defined(XA_NNLIB_TRACE) && !defined(XA_NNLIB_TRACE_WRAPPERS) && !defined(XA_NNLIB_TRACE_CALLER) && !defined(ENABLE_SCRATCH_SIZE_API_ONLY)
+/* Kernel implementations are built as <name>_untraced, see xa_nnlib_trace_wrappers.c */
+#include "xa_nnlib_trace_rename.h"
+#endif
+
 #include <assert.h>
 
 #include "NatureDSP_types.h"
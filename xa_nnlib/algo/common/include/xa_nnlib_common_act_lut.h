@@ -0,0 +1,112 @@
+/*******************************************************************************
+* Copyright (c) 2018-2025 Cadence Design Systems, Inc.
+*
+* Permission is hereby granted, free of charge, to any person obtaining
+* a copy of this software and associated documentation files (the
+* "Software"), to use this Software with Cadence processor cores only and
+* not with any other processors and platforms, subject to
+* the following conditions:
+*
+* The above copyright notice and this permission notice shall be included
+* in all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+******************************************************************************/
+#ifndef __XA_NNLIB_COMMON_ACT_LUT_H__
+#define __XA_NNLIB_COMMON_ACT_LUT_H__
+
+#include "xa_nnlib_common.h"
+
+/* Looks up the 4 lanes of d_x, lane k in the table at p_l + k * lut_stride */
+#define ACT_LUT_X4(d_y, d_x, p_l, lut_stride) \
+{ \
+  d_y = AE_MOVDA16((p_l)[AE_MOVAD16_3(d_x)]); \
+  d_y = AE_SEL16_6543(d_y, AE_MOVDA16((p_l)[(lut_stride) + AE_MOVAD16_2(d_x)])); \
+  d_y = AE_SEL16_6543(d_y, AE_MOVDA16((p_l)[2 * (lut_stride) + AE_MOVAD16_1(d_x)])); \
+  d_y = AE_SEL16_6543(d_y, AE_MOVDA16((p_l)[3 * (lut_stride) + AE_MOVAD16_0(d_x)])); \
+}
+
+/* In place p_data[i] = p_lut[i * lut_stride + p_data[i]], p_lut points to the
+ * entry for 0 of the first table. There is no byte gather, so the inputs are
+ * loaded and the outputs stored 8 at a time around scalar table reads. */
+static inline void xa_nn_act_lut_asym8s(WORD8 *p_data,
+                                        const WORD8 * __restrict__ p_lut,
+                                        WORD32 lut_stride,
+                                        WORD32 num_elm)
+{
+  const WORD8 *p_i = p_data;
+  ae_int8x8 *p_o = (ae_int8x8 *)p_data;
+  const WORD8 *p_l = p_lut;
+  ae_valign a_i = AE_LA64_PP((ae_int8x8 *)p_i);
+  ae_valign a_o = AE_ZALIGN64();
+  WORD32 itr;
+
+  for(itr = 0; itr < (num_elm >> 3); itr++)
+  {
+    ae_int16x4 d_x0, d_x1, d_y0, d_y1;
+
+    AE_LA8X4S_IP(d_x0, a_i, p_i);
+    AE_LA8X4S_IP(d_x1, a_i, p_i);
+    ACT_LUT_X4(d_y0, d_x0, p_l, lut_stride);
+    ACT_LUT_X4(d_y1, d_x1, p_l + 4 * lut_stride, lut_stride);
+    AE_SA8X8_IP(AE_SAT8X8X16(d_y0, d_y1), a_o, p_o);
+    p_l += 8 * lut_stride;
+  }
+  AE_SA64POS_FP(a_o, p_o);
+
+  for(itr = itr << 3; itr < num_elm; itr++)
+  {
+    p_data[itr] = p_lut[itr * lut_stride + p_data[itr]];
+  }
+}
+
+/* Applies the activation LUT in place to output rows
+ * [row_start, row_start + num_rows) while they are still in cache */
+static inline void xa_nn_act_lut_rows_asym8s(WORD8 *p_out,
+                                             const xa_nn_act_cfg_t *p_act_cfg,
+                                             WORD32 row_start,
+                                             WORD32 num_rows,
+                                             WORD32 out_height,
+                                             WORD32 out_width,
+                                             WORD32 out_channels,
+                                             WORD32 out_data_format)
+{
+  /* Entry 0 of each table is for -128 */
+  const WORD8 *p_lut = p_act_cfg->p_lut + 128;
+  WORD32 lut_stride = p_act_cfg->lut_channels == 1 ? 0 : 256;
+  WORD32 itr, itr_oc;
+
+  if(out_data_format == 0)
+  {
+    WORD8 *p_o = &p_out[row_start * out_width * out_channels];
+    if(lut_stride == 0)
+    {
+      xa_nn_act_lut_asym8s(p_o, p_lut, 0, num_rows * out_width * out_channels);
+    }
+    else
+    {
+      for(itr = 0; itr < num_rows * out_width; itr++)
+      {
+        xa_nn_act_lut_asym8s(p_o, p_lut, lut_stride, out_channels);
+        p_o += out_channels;
+      }
+    }
+  }
+  else
+  {
+    for(itr_oc = 0; itr_oc < out_channels; itr_oc++)
+    {
+      xa_nn_act_lut_asym8s(&p_out[itr_oc * out_height * out_width + row_start * out_width],
+          &p_lut[itr_oc * lut_stride], 0, num_rows * out_width);
+    }
+  }
+}
+
+#endif /* __XA_NNLIB_COMMON_ACT_LUT_H__ */
@@ -0,0 +1,74 @@
+/*******************************************************************************
+* Copyright (c) 2018-2025 Cadence Design Systems, Inc.
+*
+* Permission is hereby granted, free of charge, to any person obtaining
+* a copy of this software and associated documentation files (the
+* "Software"), to use this Software with Cadence processor cores only and
+* not with any other processors and platforms, subject to
+* the following conditions:
+*
+* The above copyright notice and this permission notice shall be included
+* in all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+******************************************************************************/
+#ifndef __XA_NNLIB_COMMON_DMA_H__
+#define __XA_NNLIB_COMMON_DMA_H__
+
+#include "xa_type_def.h"
+#include "xa_nnlib_kernels_api.h"
+
+/* DMA is used only when both callbacks and both ping-pong buffers are set */
+#define XA_NN_DMA_CFG_VALID(p_dma_cfg) \
+  ((p_dma_cfg) != NULL && \
+   (p_dma_cfg)->transfer != NULL && \
+   (p_dma_cfg)->wait != NULL && \
+   (p_dma_cfg)->p_local_buf[0] != NULL && \
+   (p_dma_cfg)->p_local_buf[1] != NULL && \
+   (p_dma_cfg)->local_buf_size > 0)
+
+/* Start a transfer of n_bytes into local buffer buf_idx, returns transfer id.
+ * A negative id means the transfer was not started and the caller must read
+ * the data in place. */
+static inline WORD32 xa_nn_dma_fetch(xa_dma_cfg_t *p_dma_cfg,
+                                     WORD32 buf_idx,
+                                     const VOID *p_src,
+                                     WORD32 n_bytes)
+{
+  return p_dma_cfg->transfer(p_dma_cfg->p_local_buf[buf_idx & 1], p_src, n_bytes, p_dma_cfg->p_ctx);
+}
+
+/* Wait for a transfer started by xa_nn_dma_fetch, negative ids are ignored */
+static inline WORD32 xa_nn_dma_wait(xa_dma_cfg_t *p_dma_cfg,
+                                    WORD32 transfer_id)
+{
+  if(transfer_id < 0)
+    return 0;
+  return p_dma_cfg->wait(transfer_id, p_dma_cfg->p_ctx);
+}
+
+/* Number of matrix rows of row_bytes each that fit in one local buffer,
+ * rounded down to a multiple of row_align. Returns 0 if not even row_align
+ * rows fit or the local buffers are not aligned to align_bytes. */
+static inline WORD32 xa_nn_dma_block_rows(xa_dma_cfg_t *p_dma_cfg,
+                                          WORD32 row_bytes,
+                                          WORD32 row_align,
+                                          WORD32 align_bytes)
+{
+  WORD32 block_rows;
+  if((((unsigned int)p_dma_cfg->p_local_buf[0]) & (align_bytes - 1)) ||
+     (((unsigned int)p_dma_cfg->p_local_buf[1]) & (align_bytes - 1)) ||
+     row_bytes <= 0)
+    return 0;
+  block_rows = p_dma_cfg->local_buf_size / row_bytes;
+  return block_rows - (block_rows % row_align);
+}
+
+#endif /* __XA_NNLIB_COMMON_DMA_H__ */
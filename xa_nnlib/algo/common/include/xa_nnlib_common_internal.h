@@ -42,4 +42,23 @@ void *xa_nn_memcpy(void * dest,const void *src, size_t n);
 #endif
 #endif
 
+/* Kernels called across translation units that are not part of the API */
+WORD32 xa_nn_matmul_sym16sxsym16s_sym16s(
+  WORD16 * __restrict__ p_out,
+  const WORD16 * __restrict__ p_mat1,
+  const WORD16 * __restrict__ p_vec1,
+  const WORD64 * __restrict__ p_bias,
+  WORD32 rows,
+  WORD32 cols1,
+  WORD32 row_stride1,
+  WORD32 vec_count,
+  WORD32 vec_offset,
+  WORD32 out_offset,
+  WORD32 out_stride,
+  WORD32 mat1_zero_bias,
+  WORD32 vec1_zero_bias,
+  WORD32 out_multiplier,
+  WORD32 out_shift,
+  WORD32 out_zero_bias);
+
 #endif /* XA_NNLIB_COMMON_INTERNAL_H */
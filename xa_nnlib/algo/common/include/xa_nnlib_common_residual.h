@@ -0,0 +1,109 @@
+/*******************************************************************************
+* Copyright (c) 2018-2025 Cadence Design Systems, Inc.
+*
+* Permission is hereby granted, free of charge, to any person obtaining
+* a copy of this software and associated documentation files (the
+* "Software"), to use this Software with Cadence processor cores only and
+* not with any other processors and platforms, subject to
+* the following conditions:
+*
+* The above copyright notice and this permission notice shall be included
+* in all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+******************************************************************************/
+#ifndef __XA_NNLIB_COMMON_RESIDUAL_H__
+#define __XA_NNLIB_COMMON_RESIDUAL_H__
+
+#include "xa_nnlib_common.h"
+#include "xa_nnlib_common_macros_hifi5.h"
+
+/* p_out = clamp(p_out + requant(p_res + res_zero_bias), act_min, act_max),
+ * applied in place on a tile of the output that is still in cache */
+static inline void xa_nn_residual_add_asym8s(
+    WORD8 *p_out,
+    const WORD8 *__restrict__ p_res,
+    WORD32 num_elm,
+    WORD32 res_zero_bias,
+    WORD32 res_multiplier,
+    WORD32 res_shift,
+    WORD32 out_activation_min,
+    WORD32 out_activation_max)
+{
+  WORD32 i;
+  WORD32 left_shift, right_shift;
+#if TFLITE_SINGLE_ROUNDING
+  left_shift = res_shift;
+  /* Single rounding macro doesn't need two shifts so this is not used */
+  (void)right_shift;
+#else /* #if TFLITE_SINGLE_ROUNDING */
+  left_shift  = res_shift < 0 ? 0 : res_shift;
+  right_shift = res_shift > 0 ? 0 : -res_shift;
+#endif /* #if TFLITE_SINGLE_ROUNDING */
+
+  ae_int16x4 d_res_zb = AE_MOVDA16(res_zero_bias);
+  ae_int32x2 max_int8 = SW_MOVDA32(out_activation_max);
+  ae_int32x2 min_int8 = SW_MOVDA32(out_activation_min);
+
+  const WORD8 *p_r = p_res;
+  const WORD8 *p_o_ld = p_out;
+  ae_int8x8 *p_o_st = (ae_int8x8 *)p_out;
+  ae_valign a_r = AE_LA64_PP((ae_int8x8 *)p_r);
+  ae_valign a_o_ld = AE_LA64_PP((ae_int8x8 *)p_o_ld);
+  ae_valign a_o_st = AE_ZALIGN64();
+
+  for(i = 0; i < (num_elm >> 3); i++)
+  {
+    ae_int16x4 d_r0, d_r1, d_o0, d_o1;
+    ae_int32x2 d_r32_0, d_r32_1, d_r32_2, d_r32_3;
+    ae_int32x2 d_o32_0, d_o32_1, d_o32_2, d_o32_3;
+    ae_int8x8 d_out8_0, d_out8_1;
+
+    AE_LA8X4S_IP(d_r0, a_r, p_r);
+    AE_LA8X4S_IP(d_r1, a_r, p_r);
+    AE_LA8X4S_IP(d_o0, a_o_ld, p_o_ld);
+    AE_LA8X4S_IP(d_o1, a_o_ld, p_o_ld);
+
+    d_r0 = AE_ADD16(d_r0, d_res_zb);
+    d_r1 = AE_ADD16(d_r1, d_res_zb);
+    d_r32_0 = AE_SEXT32X2D16_32(d_r0);
+    d_r32_1 = AE_SEXT32X2D16_10(d_r0);
+    d_r32_2 = AE_SEXT32X2D16_32(d_r1);
+    d_r32_3 = AE_SEXT32X2D16_10(d_r1);
+    MPY_BY_QUANT_MULT_X2X2_OUT32(d_r32_0, d_r32_1, d_r32_0, d_r32_1, res_multiplier, left_shift, right_shift);
+    MPY_BY_QUANT_MULT_X2X2_OUT32(d_r32_2, d_r32_3, d_r32_2, d_r32_3, res_multiplier, left_shift, right_shift);
+
+    d_o32_0 = SW_ADD32S_INT32X2_INT32X2(AE_SEXT32X2D16_32(d_o0), d_r32_0);
+    d_o32_1 = SW_ADD32S_INT32X2_INT32X2(AE_SEXT32X2D16_10(d_o0), d_r32_1);
+    d_o32_2 = SW_ADD32S_INT32X2_INT32X2(AE_SEXT32X2D16_32(d_o1), d_r32_2);
+    d_o32_3 = SW_ADD32S_INT32X2_INT32X2(AE_SEXT32X2D16_10(d_o1), d_r32_3);
+    AE_MINMAX32(d_o32_0, min_int8, max_int8);
+    AE_MINMAX32(d_o32_1, min_int8, max_int8);
+    AE_MINMAX32(d_o32_2, min_int8, max_int8);
+    AE_MINMAX32(d_o32_3, min_int8, max_int8);
+
+    d_out8_0 = AE_SAT8X4X32_L(d_o32_0, d_o32_1);
+    d_out8_1 = AE_SAT8X4X32_L(d_o32_2, d_o32_3);
+    d_out8_0 = AE_SEL8X8I(d_out8_0, d_out8_1, 3);
+    AE_SA8X8_IP(d_out8_0, a_o_st, p_o_st);
+  }
+  AE_SA64POS_FP(a_o_st, p_o_st);
+
+  for(i = i << 3; i < num_elm; i++)
+  {
+    ae_int32x2 acc = SW_MOVDA32((WORD32)p_res[i] + res_zero_bias);
+    MPY_BY_QUANT_MULT_X2_OUT32(acc, acc, res_multiplier, left_shift, right_shift);
+    acc = SW_ADD32S_INT32X2_INT32X2(acc, SW_MOVDA32((WORD32)p_out[i]));
+    AE_MINMAX32(acc, min_int8, max_int8);
+    p_out[i] = (WORD8)AE_MOVAD32_L(acc);
+  }
+}
+
+#endif /* __XA_NNLIB_COMMON_RESIDUAL_H__ */
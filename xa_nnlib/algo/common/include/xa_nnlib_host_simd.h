@@ -0,0 +1,123 @@
+/*******************************************************************************
+* Copyright (c) 2018-2025 Cadence Design Systems, Inc.
+*
+* Permission is hereby granted, free of charge, to any person obtaining
+* a copy of this software and associated documentation files (the
+* "Software"), to use this Software with Cadence processor cores only and
+* not with any other processors and platforms, subject to
+* the following conditions:
+*
+* The above copyright notice and this permission notice shall be included
+* in all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+******************************************************************************/
+#ifndef __XA_NNLIB_HOST_SIMD_H__
+#define __XA_NNLIB_HOST_SIMD_H__
+
+/* Host (x86) primitives used by kernels built with XA_NNLIB_HOST_SIMD in
+ * place of the emulated HiFi5 intrinsics. Accumulation is exact and the
+ * requantization follows the HiFi5 instruction sequence of the
+ * MPY_BY_QUANT_MULT_PER_CHAN_*_OUT16_ZB macros, so the results match the
+ * target. AVX2 and SSE4.1 are used when the compiler enables them. */
+
+#if defined(__AVX2__) || defined(__SSE4_1__)
+#include <immintrin.h>
+#endif
+
+static inline WORD32 xa_nn_host_sat32(WORD64 x)
+{
+  return (WORD32)(x > 0x7fffffffLL ? 0x7fffffffLL : (x < -0x80000000LL ? -0x80000000LL : x));
+}
+
+static inline WORD32 xa_nn_host_sat16(WORD32 x)
+{
+  return x > 32767 ? 32767 : (x < -32768 ? -32768 : x);
+}
+
+/* sum(p_mat[i] * (p_vec[i] + vec_zero_bias)), i < n */
+static inline WORD32 xa_nn_host_dot_8x8_zb(const WORD8 *p_mat, const WORD8 *p_vec, WORD32 vec_zero_bias, WORD32 n)
+{
+  WORD32 acc = 0, i = 0;
+#if defined(__AVX2__)
+  __m256i zb = _mm256_set1_epi16((short)vec_zero_bias);
+  __m256i acc8 = _mm256_setzero_si256();
+  for(; i < (n & ~15); i += 16)
+  {
+    __m256i m = _mm256_cvtepi8_epi16(_mm_loadu_si128((const __m128i *)&p_mat[i]));
+    __m256i v = _mm256_add_epi16(_mm256_cvtepi8_epi16(_mm_loadu_si128((const __m128i *)&p_vec[i])), zb);
+    acc8 = _mm256_add_epi32(acc8, _mm256_madd_epi16(m, v));
+  }
+  {
+    __m128i acc4 = _mm_add_epi32(_mm256_castsi256_si128(acc8), _mm256_extracti128_si256(acc8, 1));
+    acc4 = _mm_add_epi32(acc4, _mm_shuffle_epi32(acc4, 0x4e));
+    acc4 = _mm_add_epi32(acc4, _mm_shuffle_epi32(acc4, 0xb1));
+    acc = _mm_cvtsi128_si32(acc4);
+  }
+#elif defined(__SSE4_1__)
+  __m128i zb = _mm_set1_epi16((short)vec_zero_bias);
+  __m128i acc4 = _mm_setzero_si128();
+  for(; i < (n & ~7); i += 8)
+  {
+    __m128i m = _mm_cvtepi8_epi16(_mm_loadl_epi64((const __m128i *)&p_mat[i]));
+    __m128i v = _mm_add_epi16(_mm_cvtepi8_epi16(_mm_loadl_epi64((const __m128i *)&p_vec[i])), zb);
+    acc4 = _mm_add_epi32(acc4, _mm_madd_epi16(m, v));
+  }
+  acc4 = _mm_add_epi32(acc4, _mm_shuffle_epi32(acc4, 0x4e));
+  acc4 = _mm_add_epi32(acc4, _mm_shuffle_epi32(acc4, 0xb1));
+  acc = _mm_cvtsi128_si32(acc4);
+#endif
+  for(; i < n; i++)
+  {
+    acc += p_mat[i] * (p_vec[i] + vec_zero_bias);
+  }
+  return acc;
+}
+
+/* Per channel requantization to 16 bits with the output zero point added */
+static inline WORD32 xa_nn_host_requant_out16_zb(WORD32 acc, WORD32 out_multiplier, WORD32 out_shift, WORD32 out_zero_bias)
+{
+#if TFLITE_SINGLE_ROUNDING
+  /* AE_MUL32X2S, AE_TRUNCA32F64S(.., shift + 17), AE_ROUND16X4F32SASYM, AE_ADD16S */
+  WORD64 prod = (WORD64)acc * out_multiplier;
+  WORD32 shift = out_shift + 17;
+  WORD32 t;
+  if(shift >= 0)
+  {
+    if(prod > (0x7fffffffffffffffLL >> shift))
+      t = 0x7fffffff;
+    else if(prod < (-0x7fffffffffffffffLL - 1) >> shift)
+      t = -0x7fffffff - 1;
+    else
+      t = xa_nn_host_sat32((prod * ((WORD64)1 << shift)) >> 32);
+  }
+  else
+  {
+    t = (WORD32)((prod >> -shift) >> 32);
+  }
+  t = xa_nn_host_sat16((WORD32)(((WORD64)t + 0x8000) >> 16));
+  return xa_nn_host_sat16(t + out_zero_bias);
+#else
+  /* AE_MUL2P32X4S by 2^left_shift, AE_MULF2P32X4RAS by the multiplier,
+   * AE_MULF2P32X4RS by -2^-right_shift, AE_SAT16X4, AE_SUB16S from the zero point */
+  WORD32 left_shift = out_shift < 0 ? 0 : out_shift;
+  WORD32 right_shift = out_shift > 0 ? 0 : -out_shift;
+  WORD32 x = xa_nn_host_sat32((WORD64)acc * ((WORD64)1 << left_shift));
+  WORD64 mag;
+  x = xa_nn_host_sat32(((WORD64)x * out_multiplier + ((WORD64)1 << 30)) >> 31);
+  mag = x < 0 ? -(WORD64)x : (WORD64)x;
+  if(right_shift > 0)
+    mag = (mag + ((WORD64)1 << (right_shift - 1))) >> right_shift;
+  x = xa_nn_host_sat32(x < 0 ? mag : -mag);
+  return xa_nn_host_sat16(out_zero_bias - xa_nn_host_sat16(x));
+#endif
+}
+
+#endif /* __XA_NNLIB_HOST_SIMD_H__ */
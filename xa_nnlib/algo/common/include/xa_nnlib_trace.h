@@ -0,0 +1,55 @@
+/*******************************************************************************
+* Copyright (c) 2018-2025 Cadence Design Systems, Inc.
+*
+* Permission is hereby granted, free of charge, to any person obtaining
+* a copy of this software and associated documentation files (the
+* "Software"), to use this Software with Cadence processor cores only and
+* not with any other processors and platforms, subject to
+* the following conditions:
+*
+* The above copyright notice and this permission notice shall be included
+* in all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+******************************************************************************/
+#ifndef __XA_NNLIB_TRACE_H__
+#define __XA_NNLIB_TRACE_H__
+
+#include "xa_nnlib_trace_api.h"
+
+extern xa_nnlib_trace_callback_t xa_nnlib_trace_callback;
+
+VOID xa_nnlib_trace_emit(WORD32 kernel_id, const char *p_kernel_name, WORD32 phase,
+                         WORD32 ret, const WORD32 *p_dims, WORD32 n_dims);
+
+#define XA_NNLIB_TRACE_EXPAND(...) __VA_ARGS__
+
+/* Wrapper of one kernel, the implementation is renamed to <name>_untraced by
+ * xa_nnlib_trace_rename.h. Weak so that kernels discarded or not built on a
+ * configuration leave the wrapper returning -1. */
+#define XA_NNLIB_TRACE_WRAP(id, name, params, args, n_dims, dims)                 \
+  WORD32 name##_untraced params __attribute__((weak));                            \
+  WORD32 name params                                                              \
+  {                                                                               \
+    WORD32 ret;                                                                   \
+    if(name##_untraced == NULL)                                                   \
+      return -1;                                                                  \
+    if(xa_nnlib_trace_callback == NULL)                                           \
+      return name##_untraced args;                                                \
+    {                                                                             \
+      const WORD32 trace_dims[] = { XA_NNLIB_TRACE_EXPAND dims };                 \
+      xa_nnlib_trace_emit(id, #name, XA_NNLIB_TRACE_ENTER, 0, trace_dims, n_dims); \
+      ret = name##_untraced args;                                                 \
+      xa_nnlib_trace_emit(id, #name, XA_NNLIB_TRACE_EXIT, ret, trace_dims, n_dims); \
+    }                                                                             \
+    return ret;                                                                   \
+  }
+
+#endif /* __XA_NNLIB_TRACE_H__ */
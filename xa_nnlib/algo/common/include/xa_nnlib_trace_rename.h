@@ -0,0 +1,382 @@
+/*******************************************************************************
+* Copyright (c) 2018-2025 Cadence Design Systems, Inc.
+*
+* Permission is hereby granted, free of charge, to any person obtaining
+* a copy of this software and associated documentation files (the
+* "Software"), to use this Software with Cadence processor cores only and
+* not with any other processors and platforms, subject to
+* the following conditions:
+*
+* The above copyright notice and this permission notice shall be included
+* in all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+******************************************************************************/
+/* Generated by build/gen_trace_wrappers.py, do not edit */
+#ifndef __XA_NNLIB_TRACE_RENAME_H__
+#define __XA_NNLIB_TRACE_RENAME_H__
+
+#define xa_nn_matXvec_16x16_16                                       xa_nn_matXvec_16x16_16_untraced
+#define xa_nn_matXvec_16x16_32                                       xa_nn_matXvec_16x16_32_untraced
+#define xa_nn_matXvec_16x16_64                                       xa_nn_matXvec_16x16_64_untraced
+#define xa_nn_matXvec_16x16_16_tanh                                  xa_nn_matXvec_16x16_16_tanh_untraced
+#define xa_nn_matXvec_16x16_16_sigmoid                               xa_nn_matXvec_16x16_16_sigmoid_untraced
+#define xa_nn_matXvec_batch_16x16_64                                 xa_nn_matXvec_batch_16x16_64_untraced
+#define xa_nn_matmul_16x16_16                                        xa_nn_matmul_16x16_16_untraced
+#define xa_nn_matXvec_8x16_16                                        xa_nn_matXvec_8x16_16_untraced
+#define xa_nn_matXvec_8x16_32                                        xa_nn_matXvec_8x16_32_untraced
+#define xa_nn_matXvec_8x16_64                                        xa_nn_matXvec_8x16_64_untraced
+#define xa_nn_matXvec_8x16_16_tanh                                   xa_nn_matXvec_8x16_16_tanh_untraced
+#define xa_nn_matXvec_8x16_16_sigmoid                                xa_nn_matXvec_8x16_16_sigmoid_untraced
+#define xa_nn_matXvec_batch_8x16_64                                  xa_nn_matXvec_batch_8x16_64_untraced
+#define xa_nn_matmul_8x16_16                                         xa_nn_matmul_8x16_16_untraced
+#define xa_nn_matXvec_8x8_8                                          xa_nn_matXvec_8x8_8_untraced
+#define xa_nn_matXvec_8x8_16                                         xa_nn_matXvec_8x8_16_untraced
+#define xa_nn_matXvec_8x8_32                                         xa_nn_matXvec_8x8_32_untraced
+#define xa_nn_matXvec_8x8_8_tanh                                     xa_nn_matXvec_8x8_8_tanh_untraced
+#define xa_nn_matXvec_8x8_8_sigmoid                                  xa_nn_matXvec_8x8_8_sigmoid_untraced
+#define xa_nn_matXvec_batch_8x8_32                                   xa_nn_matXvec_batch_8x8_32_untraced
+#define xa_nn_matmul_8x8_8                                           xa_nn_matmul_8x8_8_untraced
+#define xa_nn_matXvec_f32xf32_f32_sigmoid                            xa_nn_matXvec_f32xf32_f32_sigmoid_untraced
+#define xa_nn_matXvec_f32xf32_f32_tanh                               xa_nn_matXvec_f32xf32_f32_tanh_untraced
+#define xa_nn_matXvec_f32xf32_f32                                    xa_nn_matXvec_f32xf32_f32_untraced
+#define xa_nn_matXvec_f16xf16_f16                                    xa_nn_matXvec_f16xf16_f16_untraced
+#define xa_nn_matmul_f16xf16_f16                                     xa_nn_matmul_f16xf16_f16_untraced
+#define xa_nn_matXvec_batch_f32xf32_f32                              xa_nn_matXvec_batch_f32xf32_f32_untraced
+#define xa_nn_matmul_f32xf32_f32                                     xa_nn_matmul_f32xf32_f32_untraced
+#define xa_nn_matXvec_asym8uxasym8u_asym8u                           xa_nn_matXvec_asym8uxasym8u_asym8u_untraced
+#define xa_nn_matXvec_sym8sxasym8s_asym8s                            xa_nn_matXvec_sym8sxasym8s_asym8s_untraced
+#define xa_nn_matXvec_sym8sxsym16s_sym16s                            xa_nn_matXvec_sym8sxsym16s_sym16s_untraced
+#define xa_nn_matXvec_v2_sym8sxsym16s_sym16s                         xa_nn_matXvec_v2_sym8sxsym16s_sym16s_untraced
+#define xa_nn_matXvec_out_stride_sym8sxasym8s_16                     xa_nn_matXvec_out_stride_sym8sxasym8s_16_untraced
+#define xa_nn_matXvec_asym8sxasym8s_asym8s                           xa_nn_matXvec_asym8sxasym8s_asym8s_untraced
+#define xa_nn_matXvec_v2_asym8sxasym8s_asym8s                        xa_nn_matXvec_v2_asym8sxasym8s_asym8s_untraced
+#define xa_nn_matXvec_asym4sxasym8s_asym8s                           xa_nn_matXvec_asym4sxasym8s_asym8s_untraced
+#define xa_nn_vec_sigmoid_16_16                                      xa_nn_vec_sigmoid_16_16_untraced
+#define xa_nn_vec_tanh_16_16                                         xa_nn_vec_tanh_16_16_untraced
+#define xa_nn_vec_sigmoid_f32_f32                                    xa_nn_vec_sigmoid_f32_f32_untraced
+#define xa_nn_vec_sigmoid_f16_f16                                    xa_nn_vec_sigmoid_f16_f16_untraced
+#define xa_nn_vec_tanh_f32_f32                                       xa_nn_vec_tanh_f32_f32_untraced
+#define xa_nn_vec_tanh_f16_f16                                       xa_nn_vec_tanh_f16_f16_untraced
+#define xa_nn_vec_gelu_f32_f32                                       xa_nn_vec_gelu_f32_f32_untraced
+#define xa_nn_vec_silu_f32_f32                                       xa_nn_vec_silu_f32_f32_untraced
+#define xa_nn_vec_relu_f32_f32                                       xa_nn_vec_relu_f32_f32_untraced
+#define xa_nn_vec_relu_std_f32_f32                                   xa_nn_vec_relu_std_f32_f32_untraced
+#define xa_nn_vec_relu1_f32_f32                                      xa_nn_vec_relu1_f32_f32_untraced
+#define xa_nn_vec_relu6_f32_f32                                      xa_nn_vec_relu6_f32_f32_untraced
+#define xa_nn_vec_softmax_f32_f32                                    xa_nn_vec_softmax_f32_f32_untraced
+#define xa_nn_vec_sigmoid_32_16                                      xa_nn_vec_sigmoid_32_16_untraced
+#define xa_nn_vec_tanh_32_16                                         xa_nn_vec_tanh_32_16_untraced
+#define xa_nn_vec_sigmoid_32_8                                       xa_nn_vec_sigmoid_32_8_untraced
+#define xa_nn_vec_tanh_32_8                                          xa_nn_vec_tanh_32_8_untraced
+#define xa_nn_vec_relu_16_16                                         xa_nn_vec_relu_16_16_untraced
+#define xa_nn_vec_relu_std_16_16                                     xa_nn_vec_relu_std_16_16_untraced
+#define xa_nn_vec_relu_8_8                                           xa_nn_vec_relu_8_8_untraced
+#define xa_nn_vec_relu_std_8_8                                       xa_nn_vec_relu_std_8_8_untraced
+#define xa_nn_vec_interpolation_q15                                  xa_nn_vec_interpolation_q15_untraced
+#define xa_nn_transpose_conv_getsize                                 xa_nn_transpose_conv_getsize_untraced
+#define xa_nn_transpose_conv_sym8sxasym8s                            xa_nn_transpose_conv_sym8sxasym8s_untraced
+#define xa_nn_transpose_conv_v2_sym8sxasym8s                         xa_nn_transpose_conv_v2_sym8sxasym8s_untraced
+#define xa_nn_transpose_conv_sym8sxsym16s                            xa_nn_transpose_conv_sym8sxsym16s_untraced
+#define xa_nn_transpose_conv_v2_sym8sxsym16s                         xa_nn_transpose_conv_v2_sym8sxsym16s_untraced
+#define xa_nn_transpose_conv_f32                                     xa_nn_transpose_conv_f32_untraced
+#define xa_nn_conv1d_std_getsize                                     xa_nn_conv1d_std_getsize_untraced
+#define xa_nn_conv1d_std_8x16                                        xa_nn_conv1d_std_8x16_untraced
+#define xa_nn_conv1d_std_8x8                                         xa_nn_conv1d_std_8x8_untraced
+#define xa_nn_conv1d_std_16x16                                       xa_nn_conv1d_std_16x16_untraced
+#define xa_nn_conv1d_std_f32                                         xa_nn_conv1d_std_f32_untraced
+#define xa_nn_conv2d_std_getsize                                     xa_nn_conv2d_std_getsize_untraced
+#define xa_nn_conv2d_std_v2_get_tile_plan                            xa_nn_conv2d_std_v2_get_tile_plan_untraced
+#define xa_nn_conv2d_std_v2_pool_getsize                             xa_nn_conv2d_std_v2_pool_getsize_untraced
+#define xa_nn_conv2d_pointwise_v2_pool_getsize                       xa_nn_conv2d_pointwise_v2_pool_getsize_untraced
+#define xa_nn_conv2d_std_v2_f32io_getsize                            xa_nn_conv2d_std_v2_f32io_getsize_untraced
+#define xa_nn_conv2d_getsize                                         xa_nn_conv2d_getsize_untraced
+#define xa_nn_conv2d_std_getsize_sym4s                               xa_nn_conv2d_std_getsize_sym4s_untraced
+#define xa_nn_conv2d_std_prepack_getsize_sym4s                       xa_nn_conv2d_std_prepack_getsize_sym4s_untraced
+#define xa_nn_conv2d_std_prepack_getsize_sym8sxsym16s                xa_nn_conv2d_std_prepack_getsize_sym8sxsym16s_untraced
+#define xa_nn_conv2d_std_v2_prepacked_getsize_sym8sxsym16s           xa_nn_conv2d_std_v2_prepacked_getsize_sym8sxsym16s_untraced
+#define xa_nn_dilated_conv2d_std_getsize                             xa_nn_dilated_conv2d_std_getsize_untraced
+#define xa_nn_conv2d_std_8x16                                        xa_nn_conv2d_std_8x16_untraced
+#define xa_nn_conv2d_std_8x8                                         xa_nn_conv2d_std_8x8_untraced
+#define xa_nn_conv2d_std_16x16                                       xa_nn_conv2d_std_16x16_untraced
+#define xa_nn_conv2d_std_f32                                         xa_nn_conv2d_std_f32_untraced
+#define xa_nn_conv2d_std_f16                                         xa_nn_conv2d_std_f16_untraced
+#define xa_nn_conv2d_pointwise_f32                                   xa_nn_conv2d_pointwise_f32_untraced
+#define xa_nn_conv2d_pointwise_f16                                   xa_nn_conv2d_pointwise_f16_untraced
+#define xa_nn_conv2d_pointwise_8x16                                  xa_nn_conv2d_pointwise_8x16_untraced
+#define xa_nn_conv2d_pointwise_8x8                                   xa_nn_conv2d_pointwise_8x8_untraced
+#define xa_nn_conv2d_depthwise_getsize                               xa_nn_conv2d_depthwise_getsize_untraced
+#define xa_nn_conv2d_depthwise_pointwise_getsize                     xa_nn_conv2d_depthwise_pointwise_getsize_untraced
+#define xa_nn_dilated_conv2d_depthwise_getsize                       xa_nn_dilated_conv2d_depthwise_getsize_untraced
+#define xa_nn_conv2d_depthwise_8x8                                   xa_nn_conv2d_depthwise_8x8_untraced
+#define xa_nn_conv2d_depthwise_f32                                   xa_nn_conv2d_depthwise_f32_untraced
+#define xa_nn_dilated_conv2d_depthwise_f32                           xa_nn_dilated_conv2d_depthwise_f32_untraced
+#define xa_nn_conv2d_depthwise_f16                                   xa_nn_conv2d_depthwise_f16_untraced
+#define xa_nn_conv2d_depthwise_8x16                                  xa_nn_conv2d_depthwise_8x16_untraced
+#define xa_nn_conv2d_depthwise_16x16                                 xa_nn_conv2d_depthwise_16x16_untraced
+#define xa_nn_conv2d_pointwise_16x16                                 xa_nn_conv2d_pointwise_16x16_untraced
+#define xa_nn_avgpool_8                                              xa_nn_avgpool_8_untraced
+#define xa_nn_avgpool_16                                             xa_nn_avgpool_16_untraced
+#define xa_nn_avgpool_f32                                            xa_nn_avgpool_f32_untraced
+#define xa_nn_avgpool_asym8u                                         xa_nn_avgpool_asym8u_untraced
+#define xa_nn_avgpool_getsize                                        xa_nn_avgpool_getsize_untraced
+#define xa_nn_maxpool_8                                              xa_nn_maxpool_8_untraced
+#define xa_nn_maxpool_16                                             xa_nn_maxpool_16_untraced
+#define xa_nn_maxpool_f32                                            xa_nn_maxpool_f32_untraced
+#define xa_nn_maxpool_asym8u                                         xa_nn_maxpool_asym8u_untraced
+#define xa_nn_maxpool_getsize                                        xa_nn_maxpool_getsize_untraced
+#define xa_nn_fully_connected_f16                                    xa_nn_fully_connected_f16_untraced
+#define xa_nn_fully_connected_f32                                    xa_nn_fully_connected_f32_untraced
+#define xa_nn_fully_connected_16x16_16                               xa_nn_fully_connected_16x16_16_untraced
+#define xa_nn_fully_connected_8x16_16                                xa_nn_fully_connected_8x16_16_untraced
+#define xa_nn_fully_connected_8x8_8                                  xa_nn_fully_connected_8x8_8_untraced
+#define xa_nn_fully_connected_asym8uxasym8u_asym8u                   xa_nn_fully_connected_asym8uxasym8u_asym8u_untraced
+#define xa_nn_fully_connected_sym8sxasym8s_asym8s                    xa_nn_fully_connected_sym8sxasym8s_asym8s_untraced
+#define xa_nn_fully_connected_sym8sxsym16s_sym16s                    xa_nn_fully_connected_sym8sxsym16s_sym16s_untraced
+#define xa_nn_fully_connected_asym8sxasym8s_asym8s                   xa_nn_fully_connected_asym8sxasym8s_asym8s_untraced
+#define xa_nn_fully_connected_v2_asym8sxasym8s_asym8s                xa_nn_fully_connected_v2_asym8sxasym8s_asym8s_untraced
+#define xa_nn_fully_connected_v2_slice_asym8sxasym8s_asym8s          xa_nn_fully_connected_v2_slice_asym8sxasym8s_asym8s_untraced
+#define xa_nn_fully_connected_v2_residual_asym8sxasym8s_asym8s       xa_nn_fully_connected_v2_residual_asym8sxasym8s_asym8s_untraced
+#define xa_nn_fully_connected_v2_act_asym8sxasym8s_asym8s            xa_nn_fully_connected_v2_act_asym8sxasym8s_asym8s_untraced
+#define xa_nn_fully_connected_v2_softmax_asym8sxasym8s               xa_nn_fully_connected_v2_softmax_asym8sxasym8s_untraced
+#define xa_nn_fully_connected_v2_f32io_asym8sxasym8s_asym8s          xa_nn_fully_connected_v2_f32io_asym8sxasym8s_asym8s_untraced
+#define xa_nn_fully_connected_v2_sym8sxsym16s_sym16s                 xa_nn_fully_connected_v2_sym8sxsym16s_sym16s_untraced
+#define xa_nn_fully_connected_asym4sxasym8s_asym8s                   xa_nn_fully_connected_asym4sxasym8s_asym8s_untraced
+#define xa_nn_vec_activation_min_max_asym8u_asym8u                   xa_nn_vec_activation_min_max_asym8u_asym8u_untraced
+#define xa_nn_vec_activation_min_max_f32_f32                         xa_nn_vec_activation_min_max_f32_f32_untraced
+#define xa_nn_vec_softmax_asym8u_asym8u                              xa_nn_vec_softmax_asym8u_asym8u_untraced
+#define xa_nn_vec_softmax_asym8s_asym8s                              xa_nn_vec_softmax_asym8s_asym8s_untraced
+#define xa_nn_vec_softmax_asym8s_16                                  xa_nn_vec_softmax_asym8s_16_untraced
+#define xa_nn_vec_softmax_sym16s_16                                  xa_nn_vec_softmax_sym16s_16_untraced
+#define xa_nn_vec_sigmoid_asym8u_asym8u                              xa_nn_vec_sigmoid_asym8u_asym8u_untraced
+#define xa_nn_vec_sigmoid_asym8s_asym8s                              xa_nn_vec_sigmoid_asym8s_asym8s_untraced
+#define xa_nn_vec_sigmoid_sym16s_sym16s                              xa_nn_vec_sigmoid_sym16s_sym16s_untraced
+#define xa_nn_fully_connected_v2_softmax_getsize                     xa_nn_fully_connected_v2_softmax_getsize_untraced
+#define xa_nn_vec_activation_min_max_8_8                             xa_nn_vec_activation_min_max_8_8_untraced
+#define xa_nn_vec_activation_min_max_16_16                           xa_nn_vec_activation_min_max_16_16_untraced
+#define xa_nn_vec_relu_asym8u_asym8u                                 xa_nn_vec_relu_asym8u_asym8u_untraced
+#define xa_nn_vec_relu_asym8s_asym8s                                 xa_nn_vec_relu_asym8s_asym8s_untraced
+#define xa_nn_vec_prelu_asym8s_asym8s                                xa_nn_vec_prelu_asym8s_asym8s_untraced
+#define xa_nn_vec_leaky_relu_asym8s_asym8s                           xa_nn_vec_leaky_relu_asym8s_asym8s_untraced
+#define xa_nn_vec_leaky_relu_asym16s_asym16s                         xa_nn_vec_leaky_relu_asym16s_asym16s_untraced
+#define xa_nn_vec_hard_swish_asym8s_asym8s                           xa_nn_vec_hard_swish_asym8s_asym8s_untraced
+#define xa_nn_vec_tanh_asym8s_asym8s                                 xa_nn_vec_tanh_asym8s_asym8s_untraced
+#define xa_nn_vec_activation_lut_asym8s                              xa_nn_vec_activation_lut_asym8s_untraced
+#define xa_nn_vec_tanh_sym16s_sym16s                                 xa_nn_vec_tanh_sym16s_sym16s_untraced
+#define xa_nn_vec_gelu_asym8s_asym8s                                 xa_nn_vec_gelu_asym8s_asym8s_untraced
+#define xa_nn_vec_silu_asym8s_asym8s                                 xa_nn_vec_silu_asym8s_asym8s_untraced
+#define xa_nn_vec_gelu_sym16s_sym16s                                 xa_nn_vec_gelu_sym16s_sym16s_untraced
+#define xa_nn_vec_silu_sym16s_sym16s                                 xa_nn_vec_silu_sym16s_sym16s_untraced
+#define xa_nn_conv1d_std_asym8uxasym8u                               xa_nn_conv1d_std_asym8uxasym8u_untraced
+#define xa_nn_conv2d_std_asym8uxasym8u                               xa_nn_conv2d_std_asym8uxasym8u_untraced
+#define xa_nn_conv2d_std_per_chan_sym8sxsym16s                       xa_nn_conv2d_std_per_chan_sym8sxsym16s_untraced
+#define xa_nn_dilated_conv2d_std_per_chan_sym8sxsym16s               xa_nn_dilated_conv2d_std_per_chan_sym8sxsym16s_untraced
+#define xa_nn_conv2d_per_chan_sym8sxsym16s                           xa_nn_conv2d_per_chan_sym8sxsym16s_untraced
+#define xa_nn_conv2d_std_v2_per_chan_sym8sxsym16s                    xa_nn_conv2d_std_v2_per_chan_sym8sxsym16s_untraced
+#define xa_nn_conv2d_std_prepack_sym8sxsym16s                        xa_nn_conv2d_std_prepack_sym8sxsym16s_untraced
+#define xa_nn_conv2d_std_v2_prepacked_per_chan_sym8sxsym16s          xa_nn_conv2d_std_v2_prepacked_per_chan_sym8sxsym16s_untraced
+#define xa_nn_dilated_conv2d_std_v2_per_chan_sym8sxsym16s            xa_nn_dilated_conv2d_std_v2_per_chan_sym8sxsym16s_untraced
+#define xa_nn_conv2d_v2_per_chan_sym8sxsym16s                        xa_nn_conv2d_v2_per_chan_sym8sxsym16s_untraced
+#define xa_nn_conv2d_std_per_chan_sym8sxasym8s                       xa_nn_conv2d_std_per_chan_sym8sxasym8s_untraced
+#define xa_nn_conv2d_std_v2_per_chan_sym8sxasym8s                    xa_nn_conv2d_std_v2_per_chan_sym8sxasym8s_untraced
+#define xa_nn_conv2d_std_v2_tiled_per_chan_sym8sxasym8s              xa_nn_conv2d_std_v2_tiled_per_chan_sym8sxasym8s_untraced
+#define xa_nn_conv2d_std_v2_slice_per_chan_sym8sxasym8s              xa_nn_conv2d_std_v2_slice_per_chan_sym8sxasym8s_untraced
+#define xa_nn_conv2d_std_v2_residual_per_chan_sym8sxasym8s           xa_nn_conv2d_std_v2_residual_per_chan_sym8sxasym8s_untraced
+#define xa_nn_conv2d_std_v2_act_per_chan_sym8sxasym8s                xa_nn_conv2d_std_v2_act_per_chan_sym8sxasym8s_untraced
+#define xa_nn_conv2d_std_v2_pad_per_chan_sym8sxasym8s                xa_nn_conv2d_std_v2_pad_per_chan_sym8sxasym8s_untraced
+#define xa_nn_conv2d_std_v2_f32io_per_chan_sym8sxasym8s              xa_nn_conv2d_std_v2_f32io_per_chan_sym8sxasym8s_untraced
+#define xa_nn_conv2d_std_v2_pool_per_chan_sym8sxasym8s               xa_nn_conv2d_std_v2_pool_per_chan_sym8sxasym8s_untraced
+#define xa_nn_conv2d_per_chan_sym8sxasym8s                           xa_nn_conv2d_per_chan_sym8sxasym8s_untraced
+#define xa_nn_conv2d_v2_per_chan_sym8sxasym8s                        xa_nn_conv2d_v2_per_chan_sym8sxasym8s_untraced
+#define xa_nn_conv2d_v2_pad_per_chan_sym8sxasym8s                    xa_nn_conv2d_v2_pad_per_chan_sym8sxasym8s_untraced
+#define xa_nn_conv2d_std_per_chan_sym4sxasym8s                       xa_nn_conv2d_std_per_chan_sym4sxasym8s_untraced
+#define xa_nn_conv2d_std_prepack_sym4s                               xa_nn_conv2d_std_prepack_sym4s_untraced
+#define xa_nn_conv2d_std_prepacked_per_chan_sym4sxasym8s             xa_nn_conv2d_std_prepacked_per_chan_sym4sxasym8s_untraced
+#define xa_nn_dilated_conv2d_std_v2_per_chan_sym8sxasym8s            xa_nn_dilated_conv2d_std_v2_per_chan_sym8sxasym8s_untraced
+#define xa_nn_dilated_conv2d_std_per_chan_sym8sxasym8s               xa_nn_dilated_conv2d_std_per_chan_sym8sxasym8s_untraced
+#define xa_nn_matXvec_batch_asym8uxasym8u_asym8u                     xa_nn_matXvec_batch_asym8uxasym8u_asym8u_untraced
+#define xa_nn_matmul_asym8uxasym8u_asym8u                            xa_nn_matmul_asym8uxasym8u_asym8u_untraced
+#define xa_nn_matmul_asym8sxasym8s_asym8s                            xa_nn_matmul_asym8sxasym8s_asym8s_untraced
+#define xa_nn_matmul_v2_asym8sxasym8s_asym8s                         xa_nn_matmul_v2_asym8sxasym8s_asym8s_untraced
+#define xa_nn_matmul_asym4sxasym8s_asym8s                            xa_nn_matmul_asym4sxasym8s_asym8s_untraced
+#define xa_nn_matmul_per_chan_sym8sxasym8s_asym8s                    xa_nn_matmul_per_chan_sym8sxasym8s_asym8s_untraced
+#define xa_nn_matmul_v2_per_chan_sym8sxasym8s_asym8s                 xa_nn_matmul_v2_per_chan_sym8sxasym8s_asym8s_untraced
+#define xa_nn_matmul_v2_slice_per_chan_sym8sxasym8s_asym8s           xa_nn_matmul_v2_slice_per_chan_sym8sxasym8s_asym8s_untraced
+#define xa_nn_matmul_per_chan_sym8sxsym16s_sym16s                    xa_nn_matmul_per_chan_sym8sxsym16s_sym16s_untraced
+#define xa_nn_matmul_sym8sxsym16s_sym16s                             xa_nn_matmul_sym8sxsym16s_sym16s_untraced
+#define xa_nn_matmul_v2_sym8sxsym16s_sym16s                          xa_nn_matmul_v2_sym8sxsym16s_sym16s_untraced
+#define xa_nn_attention_getsize                                      xa_nn_attention_getsize_untraced
+#define xa_nn_attention_asym8s                                       xa_nn_attention_asym8s_untraced
+#define xa_nn_attention_sym16s                                       xa_nn_attention_sym16s_untraced
+#define xa_nn_kv_cache_append_asym8s                                 xa_nn_kv_cache_append_asym8s_untraced
+#define xa_nn_kv_cache_append_sym16s                                 xa_nn_kv_cache_append_sym16s_untraced
+#define xa_nn_kv_cache_attend_asym8s                                 xa_nn_kv_cache_attend_asym8s_untraced
+#define xa_nn_kv_cache_attend_sym16s                                 xa_nn_kv_cache_attend_sym16s_untraced
+#define xa_nn_batch_matmul_getsize                                   xa_nn_batch_matmul_getsize_untraced
+#define xa_nn_batch_matmul_asym8sxasym8s_asym8s                      xa_nn_batch_matmul_asym8sxasym8s_asym8s_untraced
+#define xa_nn_batch_matmul_sym16sxsym16s_sym16s                      xa_nn_batch_matmul_sym16sxsym16s_sym16s_untraced
+#define xa_nn_batch_matmul_rope_sym16sxsym16s_sym16s                 xa_nn_batch_matmul_rope_sym16sxsym16s_sym16s_untraced
+#define xa_nn_rope_sym16s_sym16s                                     xa_nn_rope_sym16s_sym16s_untraced
+#define xa_nn_rope_f32_f32                                           xa_nn_rope_f32_f32_untraced
+#define xa_nn_conv2d_depthwise_asym8uxasym8u                         xa_nn_conv2d_depthwise_asym8uxasym8u_untraced
+#define xa_nn_conv2d_pointwise_asym8uxasym8u                         xa_nn_conv2d_pointwise_asym8uxasym8u_untraced
+#define xa_nn_conv2d_depthwise_per_chan_sym8sxasym8s                 xa_nn_conv2d_depthwise_per_chan_sym8sxasym8s_untraced
+#define xa_nn_conv2d_depthwise_v2_per_chan_sym8sxasym8s              xa_nn_conv2d_depthwise_v2_per_chan_sym8sxasym8s_untraced
+#define xa_nn_conv2d_depthwise_v2_act_per_chan_sym8sxasym8s          xa_nn_conv2d_depthwise_v2_act_per_chan_sym8sxasym8s_untraced
+#define xa_nn_conv2d_depthwise_v2_pad_per_chan_sym8sxasym8s          xa_nn_conv2d_depthwise_v2_pad_per_chan_sym8sxasym8s_untraced
+#define xa_nn_dilated_conv2d_depthwise_per_chan_sym8sxasym8s         xa_nn_dilated_conv2d_depthwise_per_chan_sym8sxasym8s_untraced
+#define xa_nn_dilated_conv2d_depthwise_v2_per_chan_sym8sxasym8s      xa_nn_dilated_conv2d_depthwise_v2_per_chan_sym8sxasym8s_untraced
+#define xa_nn_conv2d_depthwise_per_chan_sym8sxsym16s                 xa_nn_conv2d_depthwise_per_chan_sym8sxsym16s_untraced
+#define xa_nn_conv2d_depthwise_v2_per_chan_sym8sxsym16s              xa_nn_conv2d_depthwise_v2_per_chan_sym8sxsym16s_untraced
+#define xa_nn_dilated_conv2d_depthwise_v2_per_chan_sym8sxsym16s      xa_nn_dilated_conv2d_depthwise_v2_per_chan_sym8sxsym16s_untraced
+#define xa_nn_conv2d_pointwise_per_chan_sym8sxasym8s                 xa_nn_conv2d_pointwise_per_chan_sym8sxasym8s_untraced
+#define xa_nn_conv2d_pointwise_v2_per_chan_sym8sxasym8s              xa_nn_conv2d_pointwise_v2_per_chan_sym8sxasym8s_untraced
+#define xa_nn_conv2d_pointwise_v2_slice_per_chan_sym8sxasym8s        xa_nn_conv2d_pointwise_v2_slice_per_chan_sym8sxasym8s_untraced
+#define xa_nn_conv2d_pointwise_v2_residual_per_chan_sym8sxasym8s     xa_nn_conv2d_pointwise_v2_residual_per_chan_sym8sxasym8s_untraced
+#define xa_nn_conv2d_pointwise_v2_act_per_chan_sym8sxasym8s          xa_nn_conv2d_pointwise_v2_act_per_chan_sym8sxasym8s_untraced
+#define xa_nn_conv2d_pointwise_v2_pool_per_chan_sym8sxasym8s         xa_nn_conv2d_pointwise_v2_pool_per_chan_sym8sxasym8s_untraced
+#define xa_nn_conv2d_depthwise_pointwise_v2_per_chan_sym8sxasym8s    xa_nn_conv2d_depthwise_pointwise_v2_per_chan_sym8sxasym8s_untraced
+#define xa_nn_conv2d_pointwise_per_chan_sym8sxsym16s                 xa_nn_conv2d_pointwise_per_chan_sym8sxsym16s_untraced
+#define xa_nn_conv2d_pointwise_v2_per_chan_sym8sxsym16s              xa_nn_conv2d_pointwise_v2_per_chan_sym8sxsym16s_untraced
+#define xa_nn_matXvec_acc_batch_sym8sx8_asym16s                      xa_nn_matXvec_acc_batch_sym8sx8_asym16s_untraced
+#define xa_nn_matXvec_acc_batch_sym8sx8_asym16s_hU                   xa_nn_matXvec_acc_batch_sym8sx8_asym16s_hU_untraced
+#define xa_nn_elm_mul_f32xf32_f32                                    xa_nn_elm_mul_f32xf32_f32_untraced
+#define xa_nn_elm_add_f32xf32_f32                                    xa_nn_elm_add_f32xf32_f32_untraced
+#define xa_nn_elm_mul_acc_f32xf32_f32                                xa_nn_elm_mul_acc_f32xf32_f32_untraced
+#define xa_nn_elm_sub_f32xf32_f32                                    xa_nn_elm_sub_f32xf32_f32_untraced
+#define xa_nn_elm_div_f32xf32_f32                                    xa_nn_elm_div_f32xf32_f32_untraced
+#define xa_nn_elm_floor_f32_f32                                      xa_nn_elm_floor_f32_f32_untraced
+#define xa_nn_elm_add_asym8uxasym8u_asym8u                           xa_nn_elm_add_asym8uxasym8u_asym8u_untraced
+#define xa_nn_elm_add_asym8sxasym8s_asym8s                           xa_nn_elm_add_asym8sxasym8s_asym8s_untraced
+#define xa_nn_elm_add_broadcast_4D_asym8sxasym8s_asym8s              xa_nn_elm_add_broadcast_4D_asym8sxasym8s_asym8s_untraced
+#define xa_nn_elm_add_broadcast_4D_asym16sxasym16s_asym16s           xa_nn_elm_add_broadcast_4D_asym16sxasym16s_asym16s_untraced
+#define xa_nn_elm_add_broadcast_4D_f32xf32_f32                       xa_nn_elm_add_broadcast_4D_f32xf32_f32_untraced
+#define xa_nn_elm_add_16x16_16                                       xa_nn_elm_add_16x16_16_untraced
+#define xa_nn_elm_sub_broadcast_4D_asym16sxasym16s_asym16s           xa_nn_elm_sub_broadcast_4D_asym16sxasym16s_asym16s_untraced
+#define xa_nn_elm_sub_broadcast_4D_f32xf32_f32                       xa_nn_elm_sub_broadcast_4D_f32xf32_f32_untraced
+#define xa_nn_elm_sub_asym8uxasym8u_asym8u                           xa_nn_elm_sub_asym8uxasym8u_asym8u_untraced
+#define xa_nn_elm_sub_asym8sxasym8s_asym8s                           xa_nn_elm_sub_asym8sxasym8s_asym8s_untraced
+#define xa_nn_elm_sub_broadcast_4D_asym8sxasym8s_asym8s              xa_nn_elm_sub_broadcast_4D_asym8sxasym8s_asym8s_untraced
+#define xa_nn_elm_mul_asym8uxasym8u_asym8u                           xa_nn_elm_mul_asym8uxasym8u_asym8u_untraced
+#define xa_nn_elm_mul_asym8sxasym8s_asym8s                           xa_nn_elm_mul_asym8sxasym8s_asym8s_untraced
+#define xa_nn_elm_mul_broadcast_4D_asym8sxasym8s_asym8s              xa_nn_elm_mul_broadcast_4D_asym8sxasym8s_asym8s_untraced
+#define xa_nn_elm_mul_broadcast_4D_sym16sxsym16s_sym16s              xa_nn_elm_mul_broadcast_4D_sym16sxsym16s_sym16s_untraced
+#define xa_nn_elm_mul_broadcast_4D_f32xf32_f32                       xa_nn_elm_mul_broadcast_4D_f32xf32_f32_untraced
+#define xa_nn_elm_mul_sym16sxsym16s_asym8s                           xa_nn_elm_mul_sym16sxsym16s_asym8s_untraced
+#define xa_nn_elm_squared_diff_broadcast_4D_asym8sxasym8s_asym8s     xa_nn_elm_squared_diff_broadcast_4D_asym8sxasym8s_asym8s_untraced
+#define xa_nn_elm_squared_diff_broadcast_4D_sym16sxsym16s_sym16s     xa_nn_elm_squared_diff_broadcast_4D_sym16sxsym16s_sym16s_untraced
+#define xa_nn_lstm_cell_state_update_16                              xa_nn_lstm_cell_state_update_16_untraced
+#define xa_nn_gru_hidden_state_update_8                              xa_nn_gru_hidden_state_update_8_untraced
+#define xa_nn_elm_requantize_asym32s_asym16s                         xa_nn_elm_requantize_asym32s_asym16s_untraced
+#define xa_nn_elm_requantize_asym32s_asym8s                          xa_nn_elm_requantize_asym32s_asym8s_untraced
+#define xa_nn_elm_requantize_asym8s_asym8u                           xa_nn_elm_requantize_asym8s_asym8u_untraced
+#define xa_nn_elm_requantize_asym8s_asym16s                          xa_nn_elm_requantize_asym8s_asym16s_untraced
+#define xa_nn_elm_requantize_asym8s_asym16u                          xa_nn_elm_requantize_asym8s_asym16u_untraced
+#define xa_nn_elm_requantize_asym8u_asym8s                           xa_nn_elm_requantize_asym8u_asym8s_untraced
+#define xa_nn_elm_requantize_asym16s_asym8s                          xa_nn_elm_requantize_asym16s_asym8s_untraced
+#define xa_nn_elm_requantize_asym16s_asym16s                         xa_nn_elm_requantize_asym16s_asym16s_untraced
+#define xa_nn_elm_requantize_asym16s_asym32s                         xa_nn_elm_requantize_asym16s_asym32s_untraced
+#define xa_nn_elm_requantize_asym8s_asym32s                          xa_nn_elm_requantize_asym8s_asym32s_untraced
+#define xa_nn_elm_requantize_asym8s_asym8s                           xa_nn_elm_requantize_asym8s_asym8s_untraced
+#define xa_nn_elm_dequantize_asym8s_f32                              xa_nn_elm_dequantize_asym8s_f32_untraced
+#define xa_nn_elm_dequantize_asym8u_f32                              xa_nn_elm_dequantize_asym8u_f32_untraced
+#define xa_nn_elm_dequantize_asym16s_f32                             xa_nn_elm_dequantize_asym16s_f32_untraced
+#define xa_nn_elm_quantize_f32_asym8s                                xa_nn_elm_quantize_f32_asym8s_untraced
+#define xa_nn_elm_quantize_f32_asym8u                                xa_nn_elm_quantize_f32_asym8u_untraced
+#define xa_nn_elm_quantize_f32_asym16s                               xa_nn_elm_quantize_f32_asym16s_untraced
+#define xa_nn_elm_prog_asym8s                                        xa_nn_elm_prog_asym8s_untraced
+#define xa_nn_elm_max_8x8_8                                          xa_nn_elm_max_8x8_8_untraced
+#define xa_nn_elm_max_f32xf32_f32                                    xa_nn_elm_max_f32xf32_f32_untraced
+#define xa_nn_elm_min_f32xf32_f32                                    xa_nn_elm_min_f32xf32_f32_untraced
+#define xa_nn_elm_min_8x8_8                                          xa_nn_elm_min_8x8_8_untraced
+#define xa_nn_elm_min_4D_Bcast_8x8_8                                 xa_nn_elm_min_4D_Bcast_8x8_8_untraced
+#define xa_nn_elm_max_4D_Bcast_8x8_8                                 xa_nn_elm_max_4D_Bcast_8x8_8_untraced
+#define xa_nn_elm_min_8D_Bcast_8x8_8                                 xa_nn_elm_min_8D_Bcast_8x8_8_untraced
+#define xa_nn_elm_max_8D_Bcast_8x8_8                                 xa_nn_elm_max_8D_Bcast_8x8_8_untraced
+#define xa_nn_broadcast_8_8                                          xa_nn_broadcast_8_8_untraced
+#define xa_nn_broadcast_32_32                                        xa_nn_broadcast_32_32_untraced
+#define xa_nn_elm_min_4D_Bcast_f32xf32_f32                           xa_nn_elm_min_4D_Bcast_f32xf32_f32_untraced
+#define xa_nn_elm_max_4D_Bcast_f32xf32_f32                           xa_nn_elm_max_4D_Bcast_f32xf32_f32_untraced
+#define xa_nn_elm_clamp_f32xf32xf32_f32                              xa_nn_elm_clamp_f32xf32xf32_f32_untraced
+#define xa_nn_elm_equal_asym8sxasym8s                                xa_nn_elm_equal_asym8sxasym8s_untraced
+#define xa_nn_elm_notequal_asym8sxasym8s                             xa_nn_elm_notequal_asym8sxasym8s_untraced
+#define xa_nn_elm_greater_asym8sxasym8s                              xa_nn_elm_greater_asym8sxasym8s_untraced
+#define xa_nn_elm_greaterequal_asym8sxasym8s                         xa_nn_elm_greaterequal_asym8sxasym8s_untraced
+#define xa_nn_elm_compare_f32xf32_f32                                xa_nn_elm_compare_f32xf32_f32_untraced
+#define xa_nn_elm_compare_broadcast_4D_f32xf32_f32                   xa_nn_elm_compare_broadcast_4D_f32xf32_f32_untraced
+#define xa_nn_elm_less_asym8sxasym8s                                 xa_nn_elm_less_asym8sxasym8s_untraced
+#define xa_nn_elm_lessequal_asym8sxasym8s                            xa_nn_elm_lessequal_asym8sxasym8s_untraced
+#define xa_nn_memmove_16                                             xa_nn_memmove_16_untraced
+#define xa_nn_reduce_getsize_nhwc                                    xa_nn_reduce_getsize_nhwc_untraced
+#define xa_nn_reduce_max_4D_asym8s_asym8s                            xa_nn_reduce_max_4D_asym8s_asym8s_untraced
+#define xa_nn_reduce_mean_4D_asym8s_asym8s                           xa_nn_reduce_mean_4D_asym8s_asym8s_untraced
+#define xa_nn_reduce_max_4D_asym16s_asym16s                          xa_nn_reduce_max_4D_asym16s_asym16s_untraced
+#define xa_nn_reduce_mean_4D_asym16s_asym16s                         xa_nn_reduce_mean_4D_asym16s_asym16s_untraced
+#define xa_nn_elm_logicaland_boolxbool_bool                          xa_nn_elm_logicaland_boolxbool_bool_untraced
+#define xa_nn_elm_logicalor_boolxbool_bool                           xa_nn_elm_logicalor_boolxbool_bool_untraced
+#define xa_nn_elm_logicalnot_bool_bool                               xa_nn_elm_logicalnot_bool_bool_untraced
+#define xa_nn_elm_sine_f32_f32                                       xa_nn_elm_sine_f32_f32_untraced
+#define xa_nn_elm_cosine_f32_f32                                     xa_nn_elm_cosine_f32_f32_untraced
+#define xa_nn_elm_logn_f32_f32                                       xa_nn_elm_logn_f32_f32_untraced
+#define xa_nn_elm_abs_f32_f32                                        xa_nn_elm_abs_f32_f32_untraced
+#define xa_nn_elm_ceil_f32_f32                                       xa_nn_elm_ceil_f32_f32_untraced
+#define xa_nn_elm_round_f32_f32                                      xa_nn_elm_round_f32_f32_untraced
+#define xa_nn_elm_neg_f32_f32                                        xa_nn_elm_neg_f32_f32_untraced
+#define xa_nn_elm_square_f32_f32                                     xa_nn_elm_square_f32_f32_untraced
+#define xa_nn_elm_rsqrt_f32_f32                                      xa_nn_elm_rsqrt_f32_f32_untraced
+#define xa_nn_elm_sqrt_f32_f32                                       xa_nn_elm_sqrt_f32_f32_untraced
+#define xa_nn_memmove_8_8                                            xa_nn_memmove_8_8_untraced
+#define xa_nn_memset_f32_f32                                         xa_nn_memset_f32_f32_untraced
+#define xa_nn_l2_norm_f32                                            xa_nn_l2_norm_f32_untraced
+#define xa_nn_l2_norm_asym8s_asym8s                                  xa_nn_l2_norm_asym8s_asym8s_untraced
+#define xa_nn_dot_prod_f32xf32_f32                                   xa_nn_dot_prod_f32xf32_f32_untraced
+#define xa_nn_dot_prod_16x16_asym8s                                  xa_nn_dot_prod_16x16_asym8s_untraced
+#define xa_nn_depth_to_space_8_8                                     xa_nn_depth_to_space_8_8_untraced
+#define xa_nn_space_to_depth_8_8                                     xa_nn_space_to_depth_8_8_untraced
+#define xa_nn_batch_to_space_nd_8_8                                  xa_nn_batch_to_space_nd_8_8_untraced
+#define xa_nn_space_to_batch_nd_8_8                                  xa_nn_space_to_batch_nd_8_8_untraced
+#define xa_nn_pad_8_8                                                xa_nn_pad_8_8_untraced
+#define xa_nn_pad_16_16                                              xa_nn_pad_16_16_untraced
+#define xa_nn_pad_32_32                                              xa_nn_pad_32_32_untraced
+#define xa_nn_strided_slice_int32                                    xa_nn_strided_slice_int32_untraced
+#define xa_nn_strided_slice_int16                                    xa_nn_strided_slice_int16_untraced
+#define xa_nn_strided_slice_int8                                     xa_nn_strided_slice_int8_untraced
+#define xa_nn_transpose_8_8                                          xa_nn_transpose_8_8_untraced
+#define xa_nn_transpose_16_16                                        xa_nn_transpose_16_16_untraced
+#define xa_nn_transpose_32_32                                        xa_nn_transpose_32_32_untraced
+#define xa_nn_batch_norm_3D_8_8                                      xa_nn_batch_norm_3D_8_8_untraced
+#define xa_nn_norm_calc_3D_8_nhwc                                    xa_nn_norm_calc_3D_8_nhwc_untraced
+#define xa_nn_norm_calc_3D_16_nhwc                                   xa_nn_norm_calc_3D_16_nhwc_untraced
+#define xa_nn_norm_apply_3D_8_nhwc                                   xa_nn_norm_apply_3D_8_nhwc_untraced
+#define xa_nn_norm_apply_3D_16_nhwc                                  xa_nn_norm_apply_3D_16_nhwc_untraced
+#define xa_nn_renorm_asym8s_asym8s                                   xa_nn_renorm_asym8s_asym8s_untraced
+#define xa_nn_layer_norm_asym8s_asym8s                               xa_nn_layer_norm_asym8s_asym8s_untraced
+#define xa_nn_layer_norm_sym16s_sym16s                               xa_nn_layer_norm_sym16s_sym16s_untraced
+#define xa_nn_resize_bilinear_8_8                                    xa_nn_resize_bilinear_8_8_untraced
+#define xa_nn_resize_nearest_neighbour_8_8                           xa_nn_resize_nearest_neighbour_8_8_untraced
+#define xa_nn_concat_8_8                                             xa_nn_concat_8_8_untraced
+#define xa_nn_concat_32_32                                           xa_nn_concat_32_32_untraced
+#define xa_nn_split_v_8_8                                            xa_nn_split_v_8_8_untraced
+#define xa_nn_shuffle_3D_8_8                                         xa_nn_shuffle_3D_8_8_untraced
+#define xa_nn_elm_div_broadcast_4D_f32xf32_f32                       xa_nn_elm_div_broadcast_4D_f32xf32_f32_untraced
+#define xa_nn_elm_select_32x32_32                                    xa_nn_elm_select_32x32_32_untraced
+#define xa_nn_elm_select_broadcast_4D_32x32_32                       xa_nn_elm_select_broadcast_4D_32x32_32_untraced
+#define xa_nn_lstm_getsize                                           xa_nn_lstm_getsize_untraced
+#define xa_nn_lstm_sym8sxasym8s_16                                   xa_nn_lstm_sym8sxasym8s_16_untraced
+#define xa_nn_lstm_fused_weights_getsize                             xa_nn_lstm_fused_weights_getsize_untraced
+#define xa_nn_lstm_fused_pack_weights_sym8s                          xa_nn_lstm_fused_pack_weights_sym8s_untraced
+#define xa_nn_lstm_fused_sym8sxasym8s_16                             xa_nn_lstm_fused_sym8sxasym8s_16_untraced
+#define xa_nn_gru_getsize                                            xa_nn_gru_getsize_untraced
+#define xa_nn_gru_sym8sxasym8s                                       xa_nn_gru_sym8sxasym8s_untraced
+#define xa_nn_gru_fused_weights_getsize                              xa_nn_gru_fused_weights_getsize_untraced
+#define xa_nn_gru_fused_pack_weights_sym8s                           xa_nn_gru_fused_pack_weights_sym8s_untraced
+#define xa_nn_gru_fused_sym8sxasym8s                                 xa_nn_gru_fused_sym8sxasym8s_untraced
+
+#endif /* __XA_NNLIB_TRACE_RENAME_H__ */
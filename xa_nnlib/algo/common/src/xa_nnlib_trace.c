@@ -0,0 +1,94 @@
+/*******************************************************************************
+* Copyright (c) 2018-2025 Cadence Design Systems, Inc.
+*
+* Permission is hereby granted, free of charge, to any person obtaining
+* a copy of this software and associated documentation files (the
+* "Software"), to use this Software with Cadence processor cores only and
+* not with any other processors and platforms, subject to
+* the following conditions:
+*
+* The above copyright notice and this permission notice shall be included
+* in all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+******************************************************************************/
+#if !defined(__XTENSA__)
+#define _POSIX_C_SOURCE 199309L
+#include <time.h>
+#endif
+#include <stddef.h>
+#include "xa_type_def.h"
+#include "xa_nnlib_trace_api.h"
+#include "xa_nnlib_trace.h"
+
+xa_nnlib_trace_callback_t xa_nnlib_trace_callback = NULL;
+static void *p_trace_user = NULL;
+
+#if defined(__XTENSA__)
+/* CCOUNT extended to 64 bits, assumes at least one read per wrap period */
+static UWORD32 trace_ccount_last = 0;
+static UWORD32 trace_ccount_high = 0;
+#endif
+
+WORD32 xa_nnlib_trace_set_callback(xa_nnlib_trace_callback_t callback, void *p_user)
+{
+#ifdef XA_NNLIB_TRACE
+  p_trace_user = p_user;
+  xa_nnlib_trace_callback = callback;
+  return 0;
+#else
+  (void)callback;
+  (void)p_user;
+  return -1;
+#endif
+}
+
+UWORD64 xa_nnlib_trace_timestamp(void)
+{
+#if defined(__XTENSA__)
+  UWORD32 ccount;
+  __asm__ volatile ("rsr.ccount %0" : "=r" (ccount));
+  if(ccount < trace_ccount_last)
+    trace_ccount_high++;
+  trace_ccount_last = ccount;
+  return ((UWORD64)trace_ccount_high << 32) | ccount;
+#else
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (UWORD64)ts.tv_sec * 1000000000ULL + (UWORD64)ts.tv_nsec;
+#endif
+}
+
+VOID xa_nnlib_trace_emit(WORD32 kernel_id, const char *p_kernel_name, WORD32 phase,
+                         WORD32 ret, const WORD32 *p_dims, WORD32 n_dims)
+{
+  xa_nnlib_trace_event_t event;
+  xa_nnlib_trace_callback_t callback = xa_nnlib_trace_callback;
+  WORD32 itr;
+
+  if(callback == NULL)
+    return;
+
+  event.kernel_id = kernel_id;
+  event.p_kernel_name = p_kernel_name;
+  event.phase = phase;
+  event.ret = ret;
+  event.n_dims = n_dims;
+  for(itr = 0; itr < n_dims; itr++)
+  {
+    event.dims[itr] = p_dims[itr];
+  }
+  for(; itr < XA_NNLIB_TRACE_MAX_DIMS; itr++)
+  {
+    event.dims[itr] = 0;
+  }
+  event.timestamp = xa_nnlib_trace_timestamp();
+  callback(&event, p_trace_user);
+}
@@ -0,0 +1,1888 @@
+/*******************************************************************************
+* Copyright (c) 2018-2025 Cadence Design Systems, Inc.
+*
+* Permission is hereby granted, free of charge, to any person obtaining
+* a copy of this software and associated documentation files (the
+* "Software"), to use this Software with Cadence processor cores only and
+* not with any other processors and platforms, subject to
+* the following conditions:
+*
+* The above copyright notice and this permission notice shall be included
+* in all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+******************************************************************************/
+/* Generated by build/gen_trace_wrappers.py, do not edit */
+#define XA_NNLIB_TRACE_WRAPPERS
+#include "xa_nnlib_common.h"
+#include "xa_nnlib_common_fpu.h"
+#include "xa_nnlib_trace_api.h"
+#include "xa_nnlib_trace.h"
+
+#ifdef XA_NNLIB_TRACE
+
+XA_NNLIB_TRACE_WRAP(0, xa_nn_matXvec_16x16_16,
+    (WORD16 * __restrict__ p_out, WORD16 * __restrict__ p_mat1, WORD16 * __restrict__ p_mat2, WORD16 * __restrict__ p_vec1, WORD16 * __restrict__ p_vec2, WORD16 * __restrict__ p_bias, WORD32 rows, WORD32 cols1, WORD32 cols2, WORD32 row_stride1, WORD32 row_stride2, WORD32 acc_shift, WORD32 bias_shift),
+    (p_out, p_mat1, p_mat2, p_vec1, p_vec2, p_bias, rows, cols1, cols2, row_stride1, row_stride2, acc_shift, bias_shift),
+    3, (rows, cols1, cols2))
+
+XA_NNLIB_TRACE_WRAP(1, xa_nn_matXvec_16x16_32,
+    (WORD32 * __restrict__ p_out, WORD16 * __restrict__ p_mat1, WORD16 * __restrict__ p_mat2, WORD16 * __restrict__ p_vec1, WORD16 * __restrict__ p_vec2, WORD16 * __restrict__ p_bias, WORD32 rows, WORD32 cols1, WORD32 cols2, WORD32 row_stride1, WORD32 row_stride2, WORD32 acc_shift, WORD32 bias_shift),
+    (p_out, p_mat1, p_mat2, p_vec1, p_vec2, p_bias, rows, cols1, cols2, row_stride1, row_stride2, acc_shift, bias_shift),
+    3, (rows, cols1, cols2))
+
+XA_NNLIB_TRACE_WRAP(2, xa_nn_matXvec_16x16_64,
+    (WORD64 * __restrict__ p_out, WORD16 * __restrict__ p_mat1, WORD16 * __restrict__ p_mat2, WORD16 * __restrict__ p_vec1, WORD16 * __restrict__ p_vec2, WORD16 * __restrict__ p_bias, WORD32 rows, WORD32 cols1, WORD32 cols2, WORD32 row_stride1, WORD32 row_stride2, WORD32 acc_shift, WORD32 bias_shift),
+    (p_out, p_mat1, p_mat2, p_vec1, p_vec2, p_bias, rows, cols1, cols2, row_stride1, row_stride2, acc_shift, bias_shift),
+    3, (rows, cols1, cols2))
+
+XA_NNLIB_TRACE_WRAP(3, xa_nn_matXvec_16x16_16_tanh,
+    (WORD16 * __restrict__ p_out, WORD16 * __restrict__ p_mat1, WORD16 * __restrict__ p_mat2, WORD16 * __restrict__ p_vec1, WORD16 * __restrict__ p_vec2, VOID * __restrict__ p_bias, WORD32 rows, WORD32 cols1, WORD32 cols2, WORD32 row_stride1, WORD32 row_stride2, WORD32 acc_shift, WORD32 bias_shift, WORD32 bias_precision, VOID * __restrict__ p_scratch),
+    (p_out, p_mat1, p_mat2, p_vec1, p_vec2, p_bias, rows, cols1, cols2, row_stride1, row_stride2, acc_shift, bias_shift, bias_precision, p_scratch),
+    3, (rows, cols1, cols2))
+
+XA_NNLIB_TRACE_WRAP(4, xa_nn_matXvec_16x16_16_sigmoid,
+    (WORD16 * __restrict__ p_out, WORD16 * __restrict__ p_mat1, WORD16 * __restrict__ p_mat2, WORD16 * __restrict__ p_vec1, WORD16 * __restrict__ p_vec2, VOID * __restrict__ p_bias, WORD32 rows, WORD32 cols1, WORD32 cols2, WORD32 row_stride1, WORD32 row_stride2, WORD32 acc_shift, WORD32 bias_shift, WORD32 bias_precision, VOID * __restrict__ p_scratch),
+    (p_out, p_mat1, p_mat2, p_vec1, p_vec2, p_bias, rows, cols1, cols2, row_stride1, row_stride2, acc_shift, bias_shift, bias_precision, p_scratch),
+    3, (rows, cols1, cols2))
+
+XA_NNLIB_TRACE_WRAP(5, xa_nn_matXvec_batch_16x16_64,
+    (WORD64 ** __restrict__ p_out, WORD16 * __restrict__ p_mat1, WORD16 ** __restrict__ p_vec1, WORD16 * __restrict__ p_bias, WORD32 rows, WORD32 cols1, WORD32 row_stride1, WORD32 acc_shift, WORD32 bias_shift, WORD32 vec_count),
+    (p_out, p_mat1, p_vec1, p_bias, rows, cols1, row_stride1, acc_shift, bias_shift, vec_count),
+    3, (rows, cols1, vec_count))
+
+XA_NNLIB_TRACE_WRAP(6, xa_nn_matmul_16x16_16,
+    (WORD16 * __restrict__ p_out, const WORD16 * __restrict__ p_mat1, const WORD16 * __restrict__ p_mat2, const WORD16 * __restrict__ p_bias, WORD32 rows, WORD32 cols, WORD32 row_stride, WORD32 acc_shift, WORD32 bias_shift, WORD32 vec_count, WORD32 vec_offset, WORD32 out_offset, WORD32 out_stride),
+    (p_out, p_mat1, p_mat2, p_bias, rows, cols, row_stride, acc_shift, bias_shift, vec_count, vec_offset, out_offset, out_stride),
+    3, (rows, cols, vec_count))
+
+XA_NNLIB_TRACE_WRAP(7, xa_nn_matXvec_8x16_16,
+    (WORD16 * __restrict__ p_out, WORD8 * __restrict__ p_mat1, WORD8 * __restrict__ p_mat2, WORD16 * __restrict__ p_vec1, WORD16 * __restrict__ p_vec2, WORD16 * __restrict__ p_bias, WORD32 rows, WORD32 cols1, WORD32 cols2, WORD32 row_stride1, WORD32 row_stride2, WORD32 acc_shift, WORD32 bias_shift),
+    (p_out, p_mat1, p_mat2, p_vec1, p_vec2, p_bias, rows, cols1, cols2, row_stride1, row_stride2, acc_shift, bias_shift),
+    3, (rows, cols1, cols2))
+
+XA_NNLIB_TRACE_WRAP(8, xa_nn_matXvec_8x16_32,
+    (WORD32 * __restrict__ p_out, WORD8 * __restrict__ p_mat1, WORD8 * __restrict__ p_mat2, WORD16 * __restrict__ p_vec1, WORD16 * __restrict__ p_vec2, WORD16 * __restrict__ p_bias, WORD32 rows, WORD32 cols1, WORD32 cols2, WORD32 row_stride1, WORD32 row_stride2, WORD32 acc_shift, WORD32 bias_shift),
+    (p_out, p_mat1, p_mat2, p_vec1, p_vec2, p_bias, rows, cols1, cols2, row_stride1, row_stride2, acc_shift, bias_shift),
+    3, (rows, cols1, cols2))
+
+XA_NNLIB_TRACE_WRAP(9, xa_nn_matXvec_8x16_64,
+    (WORD64 * __restrict__ p_out, WORD8 * __restrict__ p_mat1, WORD8 * __restrict__ p_mat2, WORD16 * __restrict__ p_vec1, WORD16 * __restrict__ p_vec2, WORD16 * __restrict__ p_bias, WORD32 rows, WORD32 cols1, WORD32 cols2, WORD32 row_stride1, WORD32 row_stride2, WORD32 acc_shift, WORD32 bias_shift),
+    (p_out, p_mat1, p_mat2, p_vec1, p_vec2, p_bias, rows, cols1, cols2, row_stride1, row_stride2, acc_shift, bias_shift),
+    3, (rows, cols1, cols2))
+
+XA_NNLIB_TRACE_WRAP(10, xa_nn_matXvec_8x16_16_tanh,
+    (WORD16 * __restrict__ p_out, WORD8 * __restrict__ p_mat1, WORD8 * __restrict__ p_mat2, WORD16 * __restrict__ p_vec1, WORD16 * __restrict__ p_vec2, VOID * __restrict__ p_bias, WORD32 rows, WORD32 cols1, WORD32 cols2, WORD32 row_stride1, WORD32 row_stride2, WORD32 acc_shift, WORD32 bias_shift, WORD32 bias_precision, VOID * __restrict__ p_scratch),
+    (p_out, p_mat1, p_mat2, p_vec1, p_vec2, p_bias, rows, cols1, cols2, row_stride1, row_stride2, acc_shift, bias_shift, bias_precision, p_scratch),
+    3, (rows, cols1, cols2))
+
+XA_NNLIB_TRACE_WRAP(11, xa_nn_matXvec_8x16_16_sigmoid,
+    (WORD16 * __restrict__ p_out, WORD8 * __restrict__ p_mat1, WORD8 * __restrict__ p_mat2, WORD16 * __restrict__ p_vec1, WORD16 * __restrict__ p_vec2, VOID * __restrict__ p_bias, WORD32 rows, WORD32 cols1, WORD32 cols2, WORD32 row_stride1, WORD32 row_stride2, WORD32 acc_shift, WORD32 bias_shift, WORD32 bias_precision, VOID * __restrict__ p_scratch),
+    (p_out, p_mat1, p_mat2, p_vec1, p_vec2, p_bias, rows, cols1, cols2, row_stride1, row_stride2, acc_shift, bias_shift, bias_precision, p_scratch),
+    3, (rows, cols1, cols2))
+
+XA_NNLIB_TRACE_WRAP(12, xa_nn_matXvec_batch_8x16_64,
+    (WORD64 ** __restrict__ p_out, WORD8 * __restrict__ p_mat1, WORD16 ** __restrict__ p_vec1, WORD16 * __restrict__ p_bias, WORD32 rows, WORD32 cols1, WORD32 row_stride1, WORD32 acc_shift, WORD32 bias_shift, WORD32 vec_count),
+    (p_out, p_mat1, p_vec1, p_bias, rows, cols1, row_stride1, acc_shift, bias_shift, vec_count),
+    3, (rows, cols1, vec_count))
+
+XA_NNLIB_TRACE_WRAP(13, xa_nn_matmul_8x16_16,
+    (WORD16 * __restrict__ p_out, const WORD8 * __restrict__ p_mat1, const WORD16 * __restrict__ p_mat2, const WORD16 * __restrict__ p_bias, WORD32 rows, WORD32 cols, WORD32 row_stride, WORD32 acc_shift, WORD32 bias_shift, WORD32 vec_count, WORD32 vec_offset, WORD32 out_offset, WORD32 out_stride),
+    (p_out, p_mat1, p_mat2, p_bias, rows, cols, row_stride, acc_shift, bias_shift, vec_count, vec_offset, out_offset, out_stride),
+    3, (rows, cols, vec_count))
+
+XA_NNLIB_TRACE_WRAP(14, xa_nn_matXvec_8x8_8,
+    (WORD8 * __restrict__ p_out, WORD8 * __restrict__ p_mat1, WORD8 * __restrict__ p_mat2, WORD8 * __restrict__ p_vec1, WORD8 * __restrict__ p_vec2, WORD8 * __restrict__ p_bias, WORD32 rows, WORD32 cols1, WORD32 cols2, WORD32 row_stride1, WORD32 row_stride2, WORD32 acc_shift, WORD32 bias_shift),
+    (p_out, p_mat1, p_mat2, p_vec1, p_vec2, p_bias, rows, cols1, cols2, row_stride1, row_stride2, acc_shift, bias_shift),
+    3, (rows, cols1, cols2))
+
+XA_NNLIB_TRACE_WRAP(15, xa_nn_matXvec_8x8_16,
+    (WORD16 * __restrict__ p_out, WORD8 * __restrict__ p_mat1, WORD8 * __restrict__ p_mat2, WORD8 * __restrict__ p_vec1, WORD8 * __restrict__ p_vec2, WORD8 * __restrict__ p_bias, WORD32 rows, WORD32 cols1, WORD32 cols2, WORD32 row_stride1, WORD32 row_stride2, WORD32 acc_shift, WORD32 bias_shift),
+    (p_out, p_mat1, p_mat2, p_vec1, p_vec2, p_bias, rows, cols1, cols2, row_stride1, row_stride2, acc_shift, bias_shift),
+    3, (rows, cols1, cols2))
+
+XA_NNLIB_TRACE_WRAP(16, xa_nn_matXvec_8x8_32,
+    (WORD32 * __restrict__ p_out, WORD8 * __restrict__ p_mat1, WORD8 * __restrict__ p_mat2, WORD8 * __restrict__ p_vec1, WORD8 * __restrict__ p_vec2, WORD8 * __restrict__ p_bias, WORD32 rows, WORD32 cols1, WORD32 cols2, WORD32 row_stride1, WORD32 row_stride2, WORD32 acc_shift, WORD32 bias_shift),
+    (p_out, p_mat1, p_mat2, p_vec1, p_vec2, p_bias, rows, cols1, cols2, row_stride1, row_stride2, acc_shift, bias_shift),
+    3, (rows, cols1, cols2))
+
+XA_NNLIB_TRACE_WRAP(17, xa_nn_matXvec_8x8_8_tanh,
+    (WORD8 * __restrict__ p_out, WORD8 * __restrict__ p_mat1, WORD8 * __restrict__ p_mat2, WORD8 * __restrict__ p_vec1, WORD8 * __restrict__ p_vec2, VOID * __restrict__ p_bias, WORD32 rows, WORD32 cols1, WORD32 cols2, WORD32 row_stride1, WORD32 row_stride2, WORD32 acc_shift, WORD32 bias_shift, WORD32 bias_precision, VOID * __restrict__ p_scratch),
+    (p_out, p_mat1, p_mat2, p_vec1, p_vec2, p_bias, rows, cols1, cols2, row_stride1, row_stride2, acc_shift, bias_shift, bias_precision, p_scratch),
+    3, (rows, cols1, cols2))
+
+XA_NNLIB_TRACE_WRAP(18, xa_nn_matXvec_8x8_8_sigmoid,
+    (WORD8 * __restrict__ p_out, WORD8 * __restrict__ p_mat1, WORD8 * __restrict__ p_mat2, WORD8 * __restrict__ p_vec1, WORD8 * __restrict__ p_vec2, VOID * __restrict__ p_bias, WORD32 rows, WORD32 cols1, WORD32 cols2, WORD32 row_stride1, WORD32 row_stride2, WORD32 acc_shift, WORD32 bias_shift, WORD32 bias_precision, VOID * __restrict__ p_scratch),
+    (p_out, p_mat1, p_mat2, p_vec1, p_vec2, p_bias, rows, cols1, cols2, row_stride1, row_stride2, acc_shift, bias_shift, bias_precision, p_scratch),
+    3, (rows, cols1, cols2))
+
+XA_NNLIB_TRACE_WRAP(19, xa_nn_matXvec_batch_8x8_32,
+    (WORD32 ** __restrict__ p_out, WORD8 * __restrict__ p_mat1, WORD8 ** __restrict__ p_vec1, WORD8 * __restrict__ p_bias, WORD32 rows, WORD32 cols1, WORD32 row_stride1, WORD32 acc_shift, WORD32 bias_shift, WORD32 vec_count),
+    (p_out, p_mat1, p_vec1, p_bias, rows, cols1, row_stride1, acc_shift, bias_shift, vec_count),
+    3, (rows, cols1, vec_count))
+
+XA_NNLIB_TRACE_WRAP(20, xa_nn_matmul_8x8_8,
+    (WORD8 * __restrict__ p_out, const WORD8 * __restrict__ p_mat1, const WORD8 * __restrict__ p_mat2, const WORD8 * __restrict__ p_bias, WORD32 rows, WORD32 cols, WORD32 row_stride, WORD32 acc_shift, WORD32 bias_shift, WORD32 vec_count, WORD32 vec_offset, WORD32 out_offset, WORD32 out_stride),
+    (p_out, p_mat1, p_mat2, p_bias, rows, cols, row_stride, acc_shift, bias_shift, vec_count, vec_offset, out_offset, out_stride),
+    3, (rows, cols, vec_count))
+
+#if HAVE_VFPU
+XA_NNLIB_TRACE_WRAP(21, xa_nn_matXvec_f32xf32_f32_sigmoid,
+    (FLOAT32 * __restrict__ p_out, FLOAT32 * __restrict__ p_mat1, FLOAT32 * __restrict__ p_mat2, FLOAT32 * __restrict__ p_vec1, FLOAT32 * __restrict__ p_vec2, FLOAT32 * __restrict__ p_bias, WORD32 rows, WORD32 cols1, WORD32 cols2, WORD32 row_stride1, WORD32 row_stride2, FLOAT32 * __restrict__ p_scratch),
+    (p_out, p_mat1, p_mat2, p_vec1, p_vec2, p_bias, rows, cols1, cols2, row_stride1, row_stride2, p_scratch),
+    3, (rows, cols1, cols2))
+#endif
+
+#if HAVE_VFPU
+XA_NNLIB_TRACE_WRAP(22, xa_nn_matXvec_f32xf32_f32_tanh,
+    (FLOAT32 * __restrict__ p_out, FLOAT32 * __restrict__ p_mat1, FLOAT32 * __restrict__ p_mat2, FLOAT32 * __restrict__ p_vec1, FLOAT32 * __restrict__ p_vec2, FLOAT32 * __restrict__ p_bias, WORD32 rows, WORD32 cols1, WORD32 cols2, WORD32 row_stride1, WORD32 row_stride2, FLOAT32 * __restrict__ p_scratch),
+    (p_out, p_mat1, p_mat2, p_vec1, p_vec2, p_bias, rows, cols1, cols2, row_stride1, row_stride2, p_scratch),
+    3, (rows, cols1, cols2))
+#endif
+
+#if HAVE_VFPU
+XA_NNLIB_TRACE_WRAP(23, xa_nn_matXvec_f32xf32_f32,
+    (FLOAT32 * __restrict__ p_out, const FLOAT32 * __restrict__ p_mat1, const FLOAT32 * __restrict__ p_mat2, const FLOAT32 * __restrict__ p_vec1, const FLOAT32 * __restrict__ p_vec2, const FLOAT32 * __restrict__ p_bias, WORD32 rows, WORD32 cols1, WORD32 cols2, WORD32 row_stride1, WORD32 row_stride2),
+    (p_out, p_mat1, p_mat2, p_vec1, p_vec2, p_bias, rows, cols1, cols2, row_stride1, row_stride2),
+    3, (rows, cols1, cols2))
+#endif
+
+#if HAVE_HP_VFPU
+XA_NNLIB_TRACE_WRAP(24, xa_nn_matXvec_f16xf16_f16,
+    (WORD16 * __restrict__ p_out, const WORD16 * __restrict__ p_mat1, const WORD16 * __restrict__ p_mat2, const WORD16 * __restrict__ p_vec1, const WORD16 * __restrict__ p_vec2, const WORD16 * __restrict__ p_bias, WORD32 rows, WORD32 cols1, WORD32 cols2, WORD32 row_stride1, WORD32 row_stride2),
+    (p_out, p_mat1, p_mat2, p_vec1, p_vec2, p_bias, rows, cols1, cols2, row_stride1, row_stride2),
+    3, (rows, cols1, cols2))
+#endif
+
+#if HAVE_HP_VFPU
+XA_NNLIB_TRACE_WRAP(25, xa_nn_matmul_f16xf16_f16,
+    (WORD16 * __restrict__ p_out, const WORD16 * __restrict__ p_mat1, const WORD16 * __restrict__ p_vec1, const WORD16 * __restrict__ p_bias, WORD32 rows, WORD32 cols1, WORD32 row_stride1, WORD32 vec_count, WORD32 vec_offset, WORD32 out_offset, WORD32 out_stride),
+    (p_out, p_mat1, p_vec1, p_bias, rows, cols1, row_stride1, vec_count, vec_offset, out_offset, out_stride),
+    3, (rows, cols1, vec_count))
+#endif
+
+#if HAVE_VFPU
+XA_NNLIB_TRACE_WRAP(26, xa_nn_matXvec_batch_f32xf32_f32,
+    (FLOAT32 ** __restrict__ p_out, FLOAT32 * __restrict__ p_mat1, FLOAT32 ** __restrict__ p_vec1, FLOAT32 * __restrict__ p_bias, WORD32 rows, WORD32 cols1, WORD32 row_stride1, WORD32 vec_count),
+    (p_out, p_mat1, p_vec1, p_bias, rows, cols1, row_stride1, vec_count),
+    3, (rows, cols1, vec_count))
+#endif
+
+#if HAVE_VFPU
+XA_NNLIB_TRACE_WRAP(27, xa_nn_matmul_f32xf32_f32,
+    (FLOAT32 * __restrict__ p_out, const FLOAT32 * __restrict__ p_mat1, const FLOAT32 * __restrict__ p_mat2, const FLOAT32 * __restrict__ p_bias, WORD32 rows, WORD32 cols, WORD32 row_stride, WORD32 vec_count, WORD32 vec_offset, WORD32 out_offset, WORD32 out_stride),
+    (p_out, p_mat1, p_mat2, p_bias, rows, cols, row_stride, vec_count, vec_offset, out_offset, out_stride),
+    3, (rows, cols, vec_count))
+#endif
+
+XA_NNLIB_TRACE_WRAP(28, xa_nn_matXvec_asym8uxasym8u_asym8u,
+    (UWORD8 * __restrict__ p_out, const UWORD8 * __restrict__ p_mat1, const UWORD8 * __restrict__ p_mat2, const UWORD8 * __restrict__ p_vec1, const UWORD8 * __restrict__ p_vec2, const WORD32 * __restrict__ p_bias, WORD32 rows, WORD32 cols1, WORD32 cols2, WORD32 row_stride1, WORD32 row_stride2, WORD32 mat1_zero_bias, WORD32 mat2_zero_bias, WORD32 vec1_zero_bias, WORD32 vec2_zero_bias, WORD32 out_multiplier, WORD32 out_shift, WORD32 out_zero_bias),
+    (p_out, p_mat1, p_mat2, p_vec1, p_vec2, p_bias, rows, cols1, cols2, row_stride1, row_stride2, mat1_zero_bias, mat2_zero_bias, vec1_zero_bias, vec2_zero_bias, out_multiplier, out_shift, out_zero_bias),
+    3, (rows, cols1, cols2))
+
+XA_NNLIB_TRACE_WRAP(29, xa_nn_matXvec_sym8sxasym8s_asym8s,
+    (WORD8 * __restrict__ p_out, const WORD8 * __restrict__ p_mat1, const WORD8 * __restrict__ p_mat2, const WORD8 * __restrict__ p_vec1, const WORD8 * __restrict__ p_vec2, const WORD32 * __restrict__ p_bias, WORD32 rows, WORD32 cols1, WORD32 cols2, WORD32 row_stride1, WORD32 row_stride2, WORD32 vec1_zero_bias, WORD32 vec2_zero_bias, WORD32 out_multiplier, WORD32 out_shift, WORD32 out_zero_bias),
+    (p_out, p_mat1, p_mat2, p_vec1, p_vec2, p_bias, rows, cols1, cols2, row_stride1, row_stride2, vec1_zero_bias, vec2_zero_bias, out_multiplier, out_shift, out_zero_bias),
+    3, (rows, cols1, cols2))
+
+XA_NNLIB_TRACE_WRAP(30, xa_nn_matXvec_sym8sxsym16s_sym16s,
+    (WORD16 * __restrict__ p_out, const WORD8 * __restrict__ p_mat1, const WORD8 * __restrict__ p_mat2, const WORD16 * __restrict__ p_vec1, const WORD16 * __restrict__ p_vec2, const WORD64 * __restrict__ p_bias, WORD32 rows, WORD32 cols1, WORD32 cols2, WORD32 row_stride1, WORD32 row_stride2, WORD32 out_multiplier, WORD32 out_shift),
+    (p_out, p_mat1, p_mat2, p_vec1, p_vec2, p_bias, rows, cols1, cols2, row_stride1, row_stride2, out_multiplier, out_shift),
+    3, (rows, cols1, cols2))
+
+XA_NNLIB_TRACE_WRAP(31, xa_nn_matXvec_v2_sym8sxsym16s_sym16s,
+    (WORD16 * __restrict__ p_out, const WORD8 * __restrict__ p_mat1, const WORD16 * __restrict__ p_vec1, const WORD64 * __restrict__ p_bias, WORD32 rows, WORD32 cols, WORD32 row_stride, WORD32 out_multiplier, WORD32 out_shift, WORD32 out_activation_min, WORD32 out_activation_max, xa_dma_cfg_t *p_dma_cfg),
+    (p_out, p_mat1, p_vec1, p_bias, rows, cols, row_stride, out_multiplier, out_shift, out_activation_min, out_activation_max, p_dma_cfg),
+    2, (rows, cols))
+
+XA_NNLIB_TRACE_WRAP(32, xa_nn_matXvec_out_stride_sym8sxasym8s_16,
+    (WORD16 * __restrict__ p_out, const WORD8 * __restrict__ p_mat1, const WORD8 * __restrict__ p_vec1, const WORD32 * __restrict__ p_bias, WORD32 rows, WORD32 cols1, WORD32 row_stride1, WORD32 out_stride, WORD32 vec1_zero_bias, WORD32 out_multiplier, WORD32 out_shift),
+    (p_out, p_mat1, p_vec1, p_bias, rows, cols1, row_stride1, out_stride, vec1_zero_bias, out_multiplier, out_shift),
+    2, (rows, cols1))
+
+XA_NNLIB_TRACE_WRAP(33, xa_nn_matXvec_asym8sxasym8s_asym8s,
+    (WORD8 * __restrict__ p_out, const WORD8 * __restrict__ p_mat1, const WORD8 * __restrict__ p_mat2, const WORD8 * __restrict__ p_vec1, const WORD8 * __restrict__ p_vec2, const WORD32 * __restrict__ p_bias, WORD32 rows, WORD32 cols1, WORD32 cols2, WORD32 row_stride1, WORD32 row_stride2, WORD32 mat1_zero_bias, WORD32 mat2_zero_bias, WORD32 vec1_zero_bias, WORD32 vec2_zero_bias, WORD32 out_multiplier, WORD32 out_shift, WORD32 out_zero_bias),
+    (p_out, p_mat1, p_mat2, p_vec1, p_vec2, p_bias, rows, cols1, cols2, row_stride1, row_stride2, mat1_zero_bias, mat2_zero_bias, vec1_zero_bias, vec2_zero_bias, out_multiplier, out_shift, out_zero_bias),
+    3, (rows, cols1, cols2))
+
+XA_NNLIB_TRACE_WRAP(34, xa_nn_matXvec_v2_asym8sxasym8s_asym8s,
+    (WORD8 * __restrict__ p_out, const WORD8 * __restrict__ p_mat, const WORD8 * __restrict__ p_vec, const WORD32 * __restrict__ p_bias, WORD32 rows, WORD32 cols, WORD32 row_stride, WORD32 mat_zero_bias, WORD32 vec_zero_bias, WORD32 out_multiplier, WORD32 out_shift, WORD32 out_zero_bias, WORD32 out_activation_min, WORD32 out_activation_max, xa_dma_cfg_t *p_dma_cfg),
+    (p_out, p_mat, p_vec, p_bias, rows, cols, row_stride, mat_zero_bias, vec_zero_bias, out_multiplier, out_shift, out_zero_bias, out_activation_min, out_activation_max, p_dma_cfg),
+    2, (rows, cols))
+
+XA_NNLIB_TRACE_WRAP(35, xa_nn_matXvec_asym4sxasym8s_asym8s,
+    (WORD8 * __restrict__ p_out, const WORD8 * __restrict__ p_mat1, const WORD8 * __restrict__ p_mat2, const WORD8 * __restrict__ p_vec1, const WORD8 * __restrict__ p_vec2, const WORD32 * __restrict__ p_bias, WORD32 rows, WORD32 cols1, WORD32 cols2, WORD32 row_stride1, WORD32 row_stride2, WORD32 mat1_zero_bias, WORD32 mat2_zero_bias, WORD32 vec1_zero_bias, WORD32 vec2_zero_bias, WORD32 out_multiplier, WORD32 out_shift, WORD32 out_zero_bias, pVOID p_scratch),
+    (p_out, p_mat1, p_mat2, p_vec1, p_vec2, p_bias, rows, cols1, cols2, row_stride1, row_stride2, mat1_zero_bias, mat2_zero_bias, vec1_zero_bias, vec2_zero_bias, out_multiplier, out_shift, out_zero_bias, p_scratch),
+    3, (rows, cols1, cols2))
+
+XA_NNLIB_TRACE_WRAP(36, xa_nn_vec_sigmoid_16_16,
+    (WORD16 *p_out, const WORD16 *p_vec, WORD32 vec_length),
+    (p_out, p_vec, vec_length),
+    1, (vec_length))
+
+XA_NNLIB_TRACE_WRAP(37, xa_nn_vec_tanh_16_16,
+    (WORD16 *p_out, const WORD16 *p_vec, WORD32 integer_bits, WORD32 vec_length),
+    (p_out, p_vec, integer_bits, vec_length),
+    1, (vec_length))
+
+#if HAVE_VFPU
+XA_NNLIB_TRACE_WRAP(38, xa_nn_vec_sigmoid_f32_f32,
+    (FLOAT32 * __restrict__ p_out, const FLOAT32 * __restrict__ p_vec, WORD32 vec_length),
+    (p_out, p_vec, vec_length),
+    1, (vec_length))
+#endif
+
+#if HAVE_HP_VFPU
+XA_NNLIB_TRACE_WRAP(39, xa_nn_vec_sigmoid_f16_f16,
+    (WORD16 * __restrict__ p_out, const WORD16 * __restrict__ p_vec, WORD32 vec_length),
+    (p_out, p_vec, vec_length),
+    1, (vec_length))
+#endif
+
+#if HAVE_VFPU
+XA_NNLIB_TRACE_WRAP(40, xa_nn_vec_tanh_f32_f32,
+    (FLOAT32 * __restrict__ p_out, const FLOAT32 * __restrict__ p_vec, WORD32 vec_length),
+    (p_out, p_vec, vec_length),
+    1, (vec_length))
+#endif
+
+#if HAVE_HP_VFPU
+XA_NNLIB_TRACE_WRAP(41, xa_nn_vec_tanh_f16_f16,
+    (WORD16 * __restrict__ p_out, const WORD16 * __restrict__ p_vec, WORD32 vec_length),
+    (p_out, p_vec, vec_length),
+    1, (vec_length))
+#endif
+
+#if HAVE_VFPU
+XA_NNLIB_TRACE_WRAP(42, xa_nn_vec_gelu_f32_f32,
+    (FLOAT32 * __restrict__ p_out, const FLOAT32 * __restrict__ p_vec, WORD32 vec_length),
+    (p_out, p_vec, vec_length),
+    1, (vec_length))
+#endif
+
+#if HAVE_VFPU
+XA_NNLIB_TRACE_WRAP(43, xa_nn_vec_silu_f32_f32,
+    (FLOAT32 * __restrict__ p_out, const FLOAT32 * __restrict__ p_vec, WORD32 vec_length),
+    (p_out, p_vec, vec_length),
+    1, (vec_length))
+#endif
+
+#if HAVE_VFPU
+XA_NNLIB_TRACE_WRAP(44, xa_nn_vec_relu_f32_f32,
+    (FLOAT32 * __restrict__ p_out, const FLOAT32 * __restrict__ p_vec, FLOAT32 threshold, WORD32 vec_length),
+    (p_out, p_vec, threshold, vec_length),
+    1, (vec_length))
+#endif
+
+#if HAVE_VFPU
+XA_NNLIB_TRACE_WRAP(45, xa_nn_vec_relu_std_f32_f32,
+    (FLOAT32 * __restrict__ p_out, const FLOAT32 * __restrict__ p_vec, WORD32 vec_length),
+    (p_out, p_vec, vec_length),
+    1, (vec_length))
+#endif
+
+#if HAVE_VFPU
+XA_NNLIB_TRACE_WRAP(46, xa_nn_vec_relu1_f32_f32,
+    (FLOAT32 * __restrict__ p_out, const FLOAT32 * __restrict__ p_vec, WORD32 vec_length),
+    (p_out, p_vec, vec_length),
+    1, (vec_length))
+#endif
+
+#if HAVE_VFPU
+XA_NNLIB_TRACE_WRAP(47, xa_nn_vec_relu6_f32_f32,
+    (FLOAT32 * __restrict__ p_out, const FLOAT32 * __restrict__ p_vec, WORD32 vec_length),
+    (p_out, p_vec, vec_length),
+    1, (vec_length))
+#endif
+
+#if HAVE_VFPU
+XA_NNLIB_TRACE_WRAP(48, xa_nn_vec_softmax_f32_f32,
+    (FLOAT32 * __restrict__ p_out, const FLOAT32 * __restrict__ p_vec, WORD32 vec_length),
+    (p_out, p_vec, vec_length),
+    1, (vec_length))
+#endif
+
+XA_NNLIB_TRACE_WRAP(49, xa_nn_vec_sigmoid_32_16,
+    (WORD16 * __restrict__ p_out, const WORD32 * __restrict__ p_vec, WORD32 vec_length),
+    (p_out, p_vec, vec_length),
+    1, (vec_length))
+
+XA_NNLIB_TRACE_WRAP(50, xa_nn_vec_tanh_32_16,
+    (WORD16 * __restrict__ p_out, const WORD32 * __restrict__ p_vec, WORD32 vec_length),
+    (p_out, p_vec, vec_length),
+    1, (vec_length))
+
+XA_NNLIB_TRACE_WRAP(51, xa_nn_vec_sigmoid_32_8,
+    (WORD8 * __restrict__ p_out, const WORD32 * __restrict__ p_vec, WORD32 vec_length),
+    (p_out, p_vec, vec_length),
+    1, (vec_length))
+
+XA_NNLIB_TRACE_WRAP(52, xa_nn_vec_tanh_32_8,
+    (WORD8 * __restrict__ p_out, const WORD32 * __restrict__ p_vec, WORD32 vec_length),
+    (p_out, p_vec, vec_length),
+    1, (vec_length))
+
+XA_NNLIB_TRACE_WRAP(53, xa_nn_vec_relu_16_16,
+    (WORD16 * __restrict__ p_out, const WORD16 * __restrict__ p_vec, WORD16 threshold, WORD32 vec_length),
+    (p_out, p_vec, threshold, vec_length),
+    1, (vec_length))
+
+XA_NNLIB_TRACE_WRAP(54, xa_nn_vec_relu_std_16_16,
+    (WORD16 * __restrict__ p_out, const WORD16 * __restrict__ p_vec, WORD32 vec_length),
+    (p_out, p_vec, vec_length),
+    1, (vec_length))
+
+XA_NNLIB_TRACE_WRAP(55, xa_nn_vec_relu_8_8,
+    (WORD8 * __restrict__ p_out, const WORD8 * __restrict__ p_vec, WORD8 threshold, WORD32 vec_length),
+    (p_out, p_vec, threshold, vec_length),
+    1, (vec_length))
+
+XA_NNLIB_TRACE_WRAP(56, xa_nn_vec_relu_std_8_8,
+    (WORD8 * __restrict__ p_out, const WORD8 * __restrict__ p_vec, WORD32 vec_length),
+    (p_out, p_vec, vec_length),
+    1, (vec_length))
+
+XA_NNLIB_TRACE_WRAP(57, xa_nn_vec_interpolation_q15,
+    (WORD16 * __restrict__ p_out, const WORD16 * __restrict__ p_ifact, const WORD16 * __restrict__ p_inp1, const WORD16 * __restrict__ p_inp2, WORD32 num_elements),
+    (p_out, p_ifact, p_inp1, p_inp2, num_elements),
+    0, (0))
+
+XA_NNLIB_TRACE_WRAP(58, xa_nn_transpose_conv_getsize,
+    (WORD32 input_height, WORD32 input_width, WORD32 input_channels, WORD32 kernel_height, WORD32 kernel_width, WORD32 x_stride, WORD32 y_stride, WORD32 output_height, WORD32 output_width, WORD32 output_channels, WORD32 num_groups, WORD32 kernel_precision, WORD32 output_precision),
+    (input_height, input_width, input_channels, kernel_height, kernel_width, x_stride, y_stride, output_height, output_width, output_channels, num_groups, kernel_precision, output_precision),
+    8, (input_height, input_width, input_channels, kernel_height, kernel_width, output_height, output_width, output_channels))
+
+XA_NNLIB_TRACE_WRAP(59, xa_nn_transpose_conv_sym8sxasym8s,
+    (WORD8* output_data, const WORD8* input_data, const WORD8* filter_data, const WORD32* bias_data, int stride_width, int stride_height, int pad_width, int pad_height, int input_depth, int output_depth, int input_height, int input_width, int filter_height, int filter_width, int output_height, int output_width, int num_elements, int num_groups, int input_offset, int output_offset, int *output_shift, int *output_multiplier, void* scratch_buffer),
+    (output_data, input_data, filter_data, bias_data, stride_width, stride_height, pad_width, pad_height, input_depth, output_depth, input_height, input_width, filter_height, filter_width, output_height, output_width, num_elements, num_groups, input_offset, output_offset, output_shift, output_multiplier, scratch_buffer),
+    8, (input_depth, output_depth, input_height, input_width, filter_height, filter_width, output_height, output_width))
+
+XA_NNLIB_TRACE_WRAP(60, xa_nn_transpose_conv_v2_sym8sxasym8s,
+    (WORD8* output_data, const WORD8* input_data, const WORD8* filter_data, const WORD32* bias_data, int stride_width, int stride_height, int pad_width, int pad_height, int input_depth, int output_depth, int input_height, int input_width, int filter_height, int filter_width, int output_height, int output_width, int num_elements, int num_groups, int input_offset, int output_offset, int *output_shift, int *output_multiplier, void* scratch_buffer, int out_activation_min, int out_activation_max, xa_dma_cfg_t *p_dma_cfg),
+    (output_data, input_data, filter_data, bias_data, stride_width, stride_height, pad_width, pad_height, input_depth, output_depth, input_height, input_width, filter_height, filter_width, output_height, output_width, num_elements, num_groups, input_offset, output_offset, output_shift, output_multiplier, scratch_buffer, out_activation_min, out_activation_max, p_dma_cfg),
+    8, (input_depth, output_depth, input_height, input_width, filter_height, filter_width, output_height, output_width))
+
+XA_NNLIB_TRACE_WRAP(61, xa_nn_transpose_conv_sym8sxsym16s,
+    (WORD16* output_data, const WORD16* input_data, const WORD8* filter_data, const WORD64* bias_data, int stride_width, int stride_height, int pad_width, int pad_height, int input_depth, int output_depth, int input_height, int input_width, int filter_height, int filter_width, int output_height, int output_width, int num_elements, int num_groups, int *output_shift, int *output_multiplier, void* scratch_buffer),
+    (output_data, input_data, filter_data, bias_data, stride_width, stride_height, pad_width, pad_height, input_depth, output_depth, input_height, input_width, filter_height, filter_width, output_height, output_width, num_elements, num_groups, output_shift, output_multiplier, scratch_buffer),
+    8, (input_depth, output_depth, input_height, input_width, filter_height, filter_width, output_height, output_width))
+
+XA_NNLIB_TRACE_WRAP(62, xa_nn_transpose_conv_v2_sym8sxsym16s,
+    (WORD16* output_data, const WORD16* input_data, const WORD8* filter_data, const WORD64* bias_data, int stride_width, int stride_height, int pad_width, int pad_height, int input_depth, int output_depth, int input_height, int input_width, int filter_height, int filter_width, int output_height, int output_width, int num_elements, int num_groups, int *output_shift, int *output_multiplier, void* scratch_buffer, int out_activation_min, int out_activation_max, xa_dma_cfg_t *p_dma_cfg),
+    (output_data, input_data, filter_data, bias_data, stride_width, stride_height, pad_width, pad_height, input_depth, output_depth, input_height, input_width, filter_height, filter_width, output_height, output_width, num_elements, num_groups, output_shift, output_multiplier, scratch_buffer, out_activation_min, out_activation_max, p_dma_cfg),
+    8, (input_depth, output_depth, input_height, input_width, filter_height, filter_width, output_height, output_width))
+
+#if HAVE_VFPU
+XA_NNLIB_TRACE_WRAP(63, xa_nn_transpose_conv_f32,
+    (FLOAT32* output_data, const FLOAT32* input_data, const FLOAT32* filter_data, const FLOAT32* bias_data, int stride_width, int stride_height, int pad_width, int pad_height, int input_depth, int output_depth, int input_height, int input_width, int filter_height, int filter_width, int output_height, int output_width, int num_elements, int num_groups, void* scratch_buffer),
+    (output_data, input_data, filter_data, bias_data, stride_width, stride_height, pad_width, pad_height, input_depth, output_depth, input_height, input_width, filter_height, filter_width, output_height, output_width, num_elements, num_groups, scratch_buffer),
+    8, (input_depth, output_depth, input_height, input_width, filter_height, filter_width, output_height, output_width))
+#endif
+
+XA_NNLIB_TRACE_WRAP(64, xa_nn_conv1d_std_getsize,
+    (WORD32 kernel_height, WORD32 input_width, WORD32 input_channels, WORD32 input_precision),
+    (kernel_height, input_width, input_channels, input_precision),
+    3, (kernel_height, input_width, input_channels))
+
+XA_NNLIB_TRACE_WRAP(65, xa_nn_conv1d_std_8x16,
+    (WORD16* __restrict__ p_out, WORD16* __restrict__ p_inp, WORD8* __restrict__ p_kernel, WORD16* __restrict__ p_bias, WORD32 input_height, WORD32 input_width, WORD32 input_channels, WORD32 kernel_height, WORD32 out_channels, WORD32 y_stride, WORD32 y_padding, WORD32 out_height, WORD32 bias_shift, WORD32 acc_shift, WORD32 out_data_format, VOID *p_handle),
+    (p_out, p_inp, p_kernel, p_bias, input_height, input_width, input_channels, kernel_height, out_channels, y_stride, y_padding, out_height, bias_shift, acc_shift, out_data_format, p_handle),
+    6, (input_height, input_width, input_channels, kernel_height, out_channels, out_height))
+
+XA_NNLIB_TRACE_WRAP(66, xa_nn_conv1d_std_8x8,
+    (WORD8* __restrict__ p_out, WORD8* __restrict__ p_inp, WORD8* __restrict__ p_kernel, WORD8* __restrict__ p_bias, WORD32 input_height, WORD32 input_width, WORD32 input_channels, WORD32 kernel_height, WORD32 out_channels, WORD32 y_stride, WORD32 y_padding, WORD32 out_height, WORD32 bias_shift, WORD32 acc_shift, WORD32 out_data_format, VOID *p_handle),
+    (p_out, p_inp, p_kernel, p_bias, input_height, input_width, input_channels, kernel_height, out_channels, y_stride, y_padding, out_height, bias_shift, acc_shift, out_data_format, p_handle),
+    6, (input_height, input_width, input_channels, kernel_height, out_channels, out_height))
+
+XA_NNLIB_TRACE_WRAP(67, xa_nn_conv1d_std_16x16,
+    (WORD16* __restrict__ p_out, WORD16* __restrict__ p_inp, WORD16* __restrict__ p_kernel, WORD16* __restrict__ p_bias, WORD32 input_height, WORD32 input_width, WORD32 input_channels, WORD32 kernel_height, WORD32 out_channels, WORD32 y_stride, WORD32 y_padding, WORD32 out_height, WORD32 bias_shift, WORD32 acc_shift, WORD32 out_data_format, VOID *p_handle),
+    (p_out, p_inp, p_kernel, p_bias, input_height, input_width, input_channels, kernel_height, out_channels, y_stride, y_padding, out_height, bias_shift, acc_shift, out_data_format, p_handle),
+    6, (input_height, input_width, input_channels, kernel_height, out_channels, out_height))
+
+XA_NNLIB_TRACE_WRAP(68, xa_nn_conv1d_std_f32,
+    (FLOAT32* __restrict__ p_out, FLOAT32* __restrict__ p_inp, FLOAT32* __restrict__ p_kernel, FLOAT32* __restrict__ p_bias, WORD32 input_height, WORD32 input_width, WORD32 input_channels, WORD32 kernel_height, WORD32 out_channels, WORD32 y_stride, WORD32 y_padding, WORD32 out_height, WORD32 out_data_format, VOID *p_handle),
+    (p_out, p_inp, p_kernel, p_bias, input_height, input_width, input_channels, kernel_height, out_channels, y_stride, y_padding, out_height, out_data_format, p_handle),
+    6, (input_height, input_width, input_channels, kernel_height, out_channels, out_height))
+
+XA_NNLIB_TRACE_WRAP(69, xa_nn_conv2d_std_getsize,
+    (WORD32 input_height, WORD32 input_width, WORD32 input_channels, WORD32 kernel_height, WORD32 kernel_width, WORD32 kernel_channels, WORD32 y_stride, WORD32 y_padding, WORD32 x_stride, WORD32 x_padding, WORD32 out_height, WORD32 out_width, WORD32 output_channels, WORD32 input_precision, WORD32 kernel_precision, WORD32 dilation_height, WORD32 dilation_width, WORD32 out_data_format),
+    (input_height, input_width, input_channels, kernel_height, kernel_width, kernel_channels, y_stride, y_padding, x_stride, x_padding, out_height, out_width, output_channels, input_precision, kernel_precision, dilation_height, dilation_width, out_data_format),
+    8, (input_height, input_width, input_channels, kernel_height, kernel_width, kernel_channels, out_height, out_width))
+
+XA_NNLIB_TRACE_WRAP(70, xa_nn_conv2d_std_v2_get_tile_plan,
+    (xa_nn_conv2d_std_tile_plan_t *p_plan, WORD32 input_height, WORD32 input_width, WORD32 input_channels, WORD32 kernel_height, WORD32 kernel_width, WORD32 out_channels, WORD32 x_stride, WORD32 y_stride, WORD32 x_padding, WORD32 y_padding, WORD32 out_height, WORD32 out_width, WORD32 input_precision, WORD32 out_data_format, WORD32 mem_budget),
+    (p_plan, input_height, input_width, input_channels, kernel_height, kernel_width, out_channels, x_stride, y_stride, x_padding, y_padding, out_height, out_width, input_precision, out_data_format, mem_budget),
+    8, (input_height, input_width, input_channels, kernel_height, kernel_width, out_channels, out_height, out_width))
+
+XA_NNLIB_TRACE_WRAP(71, xa_nn_conv2d_std_v2_pool_getsize,
+    (WORD32 input_width, WORD32 input_channels, WORD32 kernel_height, WORD32 kernel_width, WORD32 out_channels, WORD32 x_stride, WORD32 y_stride, WORD32 x_padding, WORD32 y_padding, WORD32 out_width, WORD32 pool_height, WORD32 input_precision),
+    (input_width, input_channels, kernel_height, kernel_width, out_channels, x_stride, y_stride, x_padding, y_padding, out_width, pool_height, input_precision),
+    7, (input_width, input_channels, kernel_height, kernel_width, out_channels, out_width, pool_height))
+
+XA_NNLIB_TRACE_WRAP(353, xa_nn_conv2d_pointwise_v2_pool_getsize,
+    (WORD32 input_width, WORD32 out_channels, WORD32 pool_height),
+    (input_width, out_channels, pool_height),
+    3, (input_width, out_channels, pool_height))
+
+XA_NNLIB_TRACE_WRAP(72, xa_nn_conv2d_std_v2_f32io_getsize,
+    (WORD32 input_width, WORD32 input_channels, WORD32 kernel_height, WORD32 kernel_width, WORD32 out_channels, WORD32 x_stride, WORD32 y_stride, WORD32 x_padding, WORD32 y_padding, WORD32 out_width, WORD32 band_rows),
+    (input_width, input_channels, kernel_height, kernel_width, out_channels, x_stride, y_stride, x_padding, y_padding, out_width, band_rows),
+    7, (input_width, input_channels, kernel_height, kernel_width, out_channels, out_width, band_rows))
+
+XA_NNLIB_TRACE_WRAP(73, xa_nn_conv2d_getsize,
+    (WORD32 input_height, WORD32 input_width, WORD32 input_channels, WORD32 kernel_height, WORD32 kernel_width, WORD32 kernel_channels, WORD32 dilation_height, WORD32 dilation_width, WORD32 y_stride, WORD32 y_padding, WORD32 x_stride, WORD32 x_padding, WORD32 out_height, WORD32 out_width, WORD32 output_channels, WORD32 input_precision, WORD32 kernel_precision, WORD32 out_data_format),
+    (input_height, input_width, input_channels, kernel_height, kernel_width, kernel_channels, dilation_height, dilation_width, y_stride, y_padding, x_stride, x_padding, out_height, out_width, output_channels, input_precision, kernel_precision, out_data_format),
+    8, (input_height, input_width, input_channels, kernel_height, kernel_width, kernel_channels, out_height, out_width))
+
+XA_NNLIB_TRACE_WRAP(74, xa_nn_conv2d_std_getsize_sym4s,
+    (WORD32 input_height, WORD32 input_channels, WORD32 kernel_height, WORD32 kernel_width, WORD32 y_stride, WORD32 y_padding, WORD32 out_height, WORD32 out_channels, WORD32 input_precision),
+    (input_height, input_channels, kernel_height, kernel_width, y_stride, y_padding, out_height, out_channels, input_precision),
+    6, (input_height, input_channels, kernel_height, kernel_width, out_height, out_channels))
+
+XA_NNLIB_TRACE_WRAP(75, xa_nn_conv2d_std_prepack_getsize_sym4s,
+    (WORD32 input_channels, WORD32 kernel_height, WORD32 kernel_width, WORD32 out_channels),
+    (input_channels, kernel_height, kernel_width, out_channels),
+    4, (input_channels, kernel_height, kernel_width, out_channels))
+
+XA_NNLIB_TRACE_WRAP(76, xa_nn_conv2d_std_prepack_getsize_sym8sxsym16s,
+    (WORD32 input_channels, WORD32 kernel_height, WORD32 kernel_width, WORD32 out_channels),
+    (input_channels, kernel_height, kernel_width, out_channels),
+    4, (input_channels, kernel_height, kernel_width, out_channels))
+
+XA_NNLIB_TRACE_WRAP(352, xa_nn_conv2d_std_v2_prepacked_getsize_sym8sxsym16s,
+    (WORD32 input_height, WORD32 input_width, WORD32 input_channels, WORD32 kernel_height, WORD32 kernel_width, WORD32 y_stride, WORD32 y_padding, WORD32 x_stride, WORD32 x_padding, WORD32 out_height, WORD32 out_width, WORD32 out_channels, WORD32 out_data_format),
+    (input_height, input_width, input_channels, kernel_height, kernel_width, y_stride, y_padding, x_stride, x_padding, out_height, out_width, out_channels, out_data_format),
+    8, (input_height, input_width, input_channels, kernel_height, kernel_width, out_height, out_width, out_channels))
+
+XA_NNLIB_TRACE_WRAP(77, xa_nn_dilated_conv2d_std_getsize,
+    (WORD32 input_height, WORD32 input_channels, WORD32 kernel_height, WORD32 kernel_width, WORD32 y_stride, WORD32 y_padding, WORD32 out_height, WORD32 out_channels, WORD32 input_precision, WORD32 dilation_height),
+    (input_height, input_channels, kernel_height, kernel_width, y_stride, y_padding, out_height, out_channels, input_precision, dilation_height),
+    6, (input_height, input_channels, kernel_height, kernel_width, out_height, out_channels))
+
+XA_NNLIB_TRACE_WRAP(78, xa_nn_conv2d_std_8x16,
+    (WORD16* __restrict__ p_out, WORD16* __restrict__ p_inp, WORD8* __restrict__ p_kernel, WORD16* __restrict__ p_bias, WORD32 input_height, WORD32 input_width, WORD32 input_channels, WORD32 kernel_height, WORD32 kernel_width, WORD32 out_channels, WORD32 x_stride, WORD32 y_stride, WORD32 x_padding, WORD32 y_padding, WORD32 out_height, WORD32 out_width, WORD32 bias_shift, WORD32 acc_shift, WORD32 out_data_format, VOID *p_handle),
+    (p_out, p_inp, p_kernel, p_bias, input_height, input_width, input_channels, kernel_height, kernel_width, out_channels, x_stride, y_stride, x_padding, y_padding, out_height, out_width, bias_shift, acc_shift, out_data_format, p_handle),
+    8, (input_height, input_width, input_channels, kernel_height, kernel_width, out_channels, out_height, out_width))
+
+XA_NNLIB_TRACE_WRAP(79, xa_nn_conv2d_std_8x8,
+    (WORD8* __restrict__ p_out, WORD8* __restrict__ p_inp, WORD8* __restrict__ p_kernel, WORD8* __restrict__ p_bias, WORD32 input_height, WORD32 input_width, WORD32 input_channels, WORD32 kernel_height, WORD32 kernel_width, WORD32 out_channels, WORD32 x_stride, WORD32 y_stride, WORD32 x_padding, WORD32 y_padding, WORD32 out_height, WORD32 out_width, WORD32 bias_shift, WORD32 acc_shift, WORD32 out_data_format, VOID *p_handle),
+    (p_out, p_inp, p_kernel, p_bias, input_height, input_width, input_channels, kernel_height, kernel_width, out_channels, x_stride, y_stride, x_padding, y_padding, out_height, out_width, bias_shift, acc_shift, out_data_format, p_handle),
+    8, (input_height, input_width, input_channels, kernel_height, kernel_width, out_channels, out_height, out_width))
+
+XA_NNLIB_TRACE_WRAP(80, xa_nn_conv2d_std_16x16,
+    (WORD16* __restrict__ p_out, WORD16* __restrict__ p_inp, WORD16* __restrict__ p_kernel, WORD16* __restrict__ p_bias, WORD32 input_height, WORD32 input_width, WORD32 input_channels, WORD32 kernel_height, WORD32 kernel_width, WORD32 out_channels, WORD32 x_stride, WORD32 y_stride, WORD32 x_padding, WORD32 y_padding, WORD32 out_height, WORD32 out_width, WORD32 bias_shift, WORD32 acc_shift, WORD32 out_data_format, VOID *p_handle),
+    (p_out, p_inp, p_kernel, p_bias, input_height, input_width, input_channels, kernel_height, kernel_width, out_channels, x_stride, y_stride, x_padding, y_padding, out_height, out_width, bias_shift, acc_shift, out_data_format, p_handle),
+    8, (input_height, input_width, input_channels, kernel_height, kernel_width, out_channels, out_height, out_width))
+
+#if HAVE_VFPU
+XA_NNLIB_TRACE_WRAP(81, xa_nn_conv2d_std_f32,
+    (FLOAT32* __restrict__ p_out, const FLOAT32* __restrict__ p_inp, const FLOAT32* __restrict__ p_kernel, const FLOAT32* __restrict__ p_bias, WORD32 input_height, WORD32 input_width, WORD32 input_channels, WORD32 kernel_height, WORD32 kernel_width, WORD32 out_channels, WORD32 x_stride, WORD32 y_stride, WORD32 x_padding, WORD32 y_padding, WORD32 out_height, WORD32 out_width, WORD32 out_data_format, VOID *p_handle),
+    (p_out, p_inp, p_kernel, p_bias, input_height, input_width, input_channels, kernel_height, kernel_width, out_channels, x_stride, y_stride, x_padding, y_padding, out_height, out_width, out_data_format, p_handle),
+    8, (input_height, input_width, input_channels, kernel_height, kernel_width, out_channels, out_height, out_width))
+#endif
+
+#if HAVE_HP_VFPU
+XA_NNLIB_TRACE_WRAP(82, xa_nn_conv2d_std_f16,
+    (WORD16* __restrict__ p_out, const WORD16* __restrict__ p_inp, const WORD16* __restrict__ p_kernel, const WORD16* __restrict__ p_bias, WORD32 input_height, WORD32 input_width, WORD32 input_channels, WORD32 kernel_height, WORD32 kernel_width, WORD32 out_channels, WORD32 x_stride, WORD32 y_stride, WORD32 x_padding, WORD32 y_padding, WORD32 out_height, WORD32 out_width, WORD32 out_data_format, VOID *p_scratch),
+    (p_out, p_inp, p_kernel, p_bias, input_height, input_width, input_channels, kernel_height, kernel_width, out_channels, x_stride, y_stride, x_padding, y_padding, out_height, out_width, out_data_format, p_scratch),
+    8, (input_height, input_width, input_channels, kernel_height, kernel_width, out_channels, out_height, out_width))
+#endif
+
+#if HAVE_VFPU
+XA_NNLIB_TRACE_WRAP(83, xa_nn_conv2d_pointwise_f32,
+    (FLOAT32* __restrict__ p_out, FLOAT32* __restrict__ p_kernel, FLOAT32* __restrict__ p_inp, FLOAT32* __restrict__ p_bias, WORD32 input_height, WORD32 input_width, WORD32 input_channels, WORD32 out_channels, WORD32 out_data_format),
+    (p_out, p_kernel, p_inp, p_bias, input_height, input_width, input_channels, out_channels, out_data_format),
+    4, (input_height, input_width, input_channels, out_channels))
+#endif
+
+#if HAVE_HP_VFPU
+XA_NNLIB_TRACE_WRAP(84, xa_nn_conv2d_pointwise_f16,
+    (WORD16* __restrict__ p_out, WORD16* __restrict__ p_kernel, WORD16* __restrict__ p_inp, WORD16* __restrict__ p_bias, WORD32 input_height, WORD32 input_width, WORD32 input_channels, WORD32 out_channels, WORD32 out_data_format),
+    (p_out, p_kernel, p_inp, p_bias, input_height, input_width, input_channels, out_channels, out_data_format),
+    4, (input_height, input_width, input_channels, out_channels))
+#endif
+
+XA_NNLIB_TRACE_WRAP(85, xa_nn_conv2d_pointwise_8x16,
+    (pWORD16 __restrict__ p_out ,pWORD8 __restrict__ p_kernel ,pWORD16 __restrict__ p_inp ,pWORD16 __restrict__ p_bias ,WORD32 input_height ,WORD32 input_width ,WORD32 input_channels ,WORD32 out_channels ,WORD32 acc_shift ,WORD32 bias_shift ,WORD32 out_data_format),
+    (p_out, p_kernel, p_inp, p_bias, input_height, input_width, input_channels, out_channels, acc_shift, bias_shift, out_data_format),
+    4, (input_height, input_width, input_channels, out_channels))
+
+XA_NNLIB_TRACE_WRAP(86, xa_nn_conv2d_pointwise_8x8,
+    (pWORD8 __restrict__ p_out ,pWORD8 __restrict__ p_kernel ,pWORD8 __restrict__ p_inp ,pWORD8 __restrict__ p_bias ,WORD32 input_height ,WORD32 input_width ,WORD32 input_channels ,WORD32 out_channels ,WORD32 acc_shift ,WORD32 bias_shift ,WORD32 out_data_format),
+    (p_out, p_kernel, p_inp, p_bias, input_height, input_width, input_channels, out_channels, acc_shift, bias_shift, out_data_format),
+    4, (input_height, input_width, input_channels, out_channels))
+
+XA_NNLIB_TRACE_WRAP(87, xa_nn_conv2d_depthwise_getsize,
+    (WORD32 input_height ,WORD32 input_width ,WORD32 input_channels ,WORD32 kernel_height ,WORD32 kernel_width ,WORD32 channels_multiplier ,WORD32 x_stride ,WORD32 y_stride ,WORD32 x_padding ,WORD32 y_padding ,WORD32 output_height ,WORD32 output_width ,WORD32 circ_buf_precision ,WORD32 inp_data_format),
+    (input_height, input_width, input_channels, kernel_height, kernel_width, channels_multiplier, x_stride, y_stride, x_padding, y_padding, output_height, output_width, circ_buf_precision, inp_data_format),
+    7, (input_height, input_width, input_channels, kernel_height, kernel_width, output_height, output_width))
+
+XA_NNLIB_TRACE_WRAP(88, xa_nn_conv2d_depthwise_pointwise_getsize,
+    (WORD32 input_width ,WORD32 input_channels ,WORD32 kernel_height ,WORD32 kernel_width ,WORD32 channels_multiplier ,WORD32 x_stride ,WORD32 y_stride ,WORD32 x_padding ,WORD32 y_padding ,WORD32 output_width ,WORD32 rows_per_block ,WORD32 input_precision),
+    (input_width, input_channels, kernel_height, kernel_width, channels_multiplier, x_stride, y_stride, x_padding, y_padding, output_width, rows_per_block, input_precision),
+    6, (input_width, input_channels, kernel_height, kernel_width, output_width, rows_per_block))
+
+XA_NNLIB_TRACE_WRAP(89, xa_nn_dilated_conv2d_depthwise_getsize,
+    (WORD32 input_height ,WORD32 input_width ,WORD32 input_channels ,WORD32 kernel_height ,WORD32 kernel_width ,WORD32 channels_multiplier ,WORD32 dilation_height ,WORD32 dilation_width ,WORD32 x_stride ,WORD32 y_stride ,WORD32 x_padding ,WORD32 y_padding ,WORD32 output_height ,WORD32 output_width ,WORD32 circ_buf_precision ,WORD32 inp_data_format),
+    (input_height, input_width, input_channels, kernel_height, kernel_width, channels_multiplier, dilation_height, dilation_width, x_stride, y_stride, x_padding, y_padding, output_height, output_width, circ_buf_precision, inp_data_format),
+    7, (input_height, input_width, input_channels, kernel_height, kernel_width, output_height, output_width))
+
+XA_NNLIB_TRACE_WRAP(90, xa_nn_conv2d_depthwise_8x8,
+    (pWORD8 __restrict__ p_out ,const WORD8 *__restrict__ p_kernel ,const WORD8 *__restrict__ p_inp ,const WORD8 *__restrict__ p_bias ,WORD32 input_height ,WORD32 input_width ,WORD32 input_channels ,WORD32 kernel_height ,WORD32 kernel_width ,WORD32 channels_multiplier ,WORD32 x_stride ,WORD32 y_stride ,WORD32 x_padding ,WORD32 y_padding ,WORD32 out_height ,WORD32 out_width ,WORD32 acc_shift ,WORD32 bias_shift ,WORD32 inp_data_format ,WORD32 out_data_format ,pVOID p_scratch),
+    (p_out, p_kernel, p_inp, p_bias, input_height, input_width, input_channels, kernel_height, kernel_width, channels_multiplier, x_stride, y_stride, x_padding, y_padding, out_height, out_width, acc_shift, bias_shift, inp_data_format, out_data_format, p_scratch),
+    7, (input_height, input_width, input_channels, kernel_height, kernel_width, out_height, out_width))
+
+#if HAVE_VFPU
+XA_NNLIB_TRACE_WRAP(91, xa_nn_conv2d_depthwise_f32,
+    (FLOAT32* __restrict__ p_out, const FLOAT32* __restrict__ p_kernel, const FLOAT32* __restrict__ p_inp, const FLOAT32* __restrict__ p_bias, WORD32 input_height, WORD32 input_width, WORD32 input_channels, WORD32 kernel_height, WORD32 kernel_width, WORD32 channels_multiplier, WORD32 x_stride, WORD32 y_stride, WORD32 x_padding, WORD32 y_padding, WORD32 out_height, WORD32 out_width, WORD32 inp_data_format, WORD32 out_data_format, pVOID p_scratch),
+    (p_out, p_kernel, p_inp, p_bias, input_height, input_width, input_channels, kernel_height, kernel_width, channels_multiplier, x_stride, y_stride, x_padding, y_padding, out_height, out_width, inp_data_format, out_data_format, p_scratch),
+    7, (input_height, input_width, input_channels, kernel_height, kernel_width, out_height, out_width))
+#endif
+
+#if HAVE_VFPU
+XA_NNLIB_TRACE_WRAP(92, xa_nn_dilated_conv2d_depthwise_f32,
+    (FLOAT32* __restrict__ p_out, const FLOAT32* __restrict__ p_kernel, const FLOAT32* __restrict__ p_inp, const FLOAT32* __restrict__ p_bias, WORD32 input_height, WORD32 input_width, WORD32 input_channels, WORD32 kernel_height, WORD32 kernel_width, WORD32 channels_multiplier, WORD32 dilation_height, WORD32 dilation_width, WORD32 x_stride, WORD32 y_stride, WORD32 x_padding, WORD32 y_padding, WORD32 out_height, WORD32 out_width, WORD32 inp_data_format, WORD32 out_data_format, pVOID p_scratch),
+    (p_out, p_kernel, p_inp, p_bias, input_height, input_width, input_channels, kernel_height, kernel_width, channels_multiplier, dilation_height, dilation_width, x_stride, y_stride, x_padding, y_padding, out_height, out_width, inp_data_format, out_data_format, p_scratch),
+    7, (input_height, input_width, input_channels, kernel_height, kernel_width, out_height, out_width))
+#endif
+
+#if HAVE_HP_VFPU
+XA_NNLIB_TRACE_WRAP(93, xa_nn_conv2d_depthwise_f16,
+    (WORD16* __restrict__ p_out, const WORD16* __restrict__ p_kernel, const WORD16* __restrict__ p_inp, const WORD16* __restrict__ p_bias, WORD32 input_height, WORD32 input_width, WORD32 input_channels, WORD32 kernel_height, WORD32 kernel_width, WORD32 channels_multiplier, WORD32 x_stride, WORD32 y_stride, WORD32 x_padding, WORD32 y_padding, WORD32 out_height, WORD32 out_width, WORD32 inp_data_format, WORD32 out_data_format, pVOID p_scratch),
+    (p_out, p_kernel, p_inp, p_bias, input_height, input_width, input_channels, kernel_height, kernel_width, channels_multiplier, x_stride, y_stride, x_padding, y_padding, out_height, out_width, inp_data_format, out_data_format, p_scratch),
+    7, (input_height, input_width, input_channels, kernel_height, kernel_width, out_height, out_width))
+#endif
+
+XA_NNLIB_TRACE_WRAP(94, xa_nn_conv2d_depthwise_8x16,
+    (pWORD16 __restrict__ p_out ,const WORD8 *__restrict__ p_kernel ,const WORD16 *__restrict__ p_inp ,const WORD16 *__restrict__ p_bias ,WORD32 input_height ,WORD32 input_width ,WORD32 input_channels ,WORD32 kernel_height ,WORD32 kernel_width ,WORD32 channels_multiplier ,WORD32 x_stride ,WORD32 y_stride ,WORD32 x_padding ,WORD32 y_padding ,WORD32 out_height ,WORD32 out_width ,WORD32 acc_shift ,WORD32 bias_shift ,WORD32 inp_data_format ,WORD32 out_data_format ,pVOID p_scratch),
+    (p_out, p_kernel, p_inp, p_bias, input_height, input_width, input_channels, kernel_height, kernel_width, channels_multiplier, x_stride, y_stride, x_padding, y_padding, out_height, out_width, acc_shift, bias_shift, inp_data_format, out_data_format, p_scratch),
+    7, (input_height, input_width, input_channels, kernel_height, kernel_width, out_height, out_width))
+
+XA_NNLIB_TRACE_WRAP(95, xa_nn_conv2d_depthwise_16x16,
+    (pWORD16 __restrict__ p_out ,const WORD16 *__restrict__ p_kernel ,const WORD16 *__restrict__ p_inp ,const WORD16 *__restrict__ p_bias ,WORD32 input_height ,WORD32 input_width ,WORD32 input_channels ,WORD32 kernel_height ,WORD32 kernel_width ,WORD32 channels_multiplier ,WORD32 x_stride ,WORD32 y_stride ,WORD32 x_padding ,WORD32 y_padding ,WORD32 out_height ,WORD32 out_width ,WORD32 acc_shift ,WORD32 bias_shift ,WORD32 inp_data_format ,WORD32 out_data_format ,pVOID p_scratch),
+    (p_out, p_kernel, p_inp, p_bias, input_height, input_width, input_channels, kernel_height, kernel_width, channels_multiplier, x_stride, y_stride, x_padding, y_padding, out_height, out_width, acc_shift, bias_shift, inp_data_format, out_data_format, p_scratch),
+    7, (input_height, input_width, input_channels, kernel_height, kernel_width, out_height, out_width))
+
+XA_NNLIB_TRACE_WRAP(96, xa_nn_conv2d_pointwise_16x16,
+    (pWORD16 __restrict__ p_out ,pWORD16 __restrict__ p_kernel ,pWORD16 __restrict__ p_inp ,pWORD16 __restrict__ p_bias ,WORD32 input_height ,WORD32 input_width ,WORD32 input_channels ,WORD32 out_channels ,WORD32 acc_shift ,WORD32 bias_shift ,WORD32 out_data_format),
+    (p_out, p_kernel, p_inp, p_bias, input_height, input_width, input_channels, out_channels, acc_shift, bias_shift, out_data_format),
+    4, (input_height, input_width, input_channels, out_channels))
+
+XA_NNLIB_TRACE_WRAP(97, xa_nn_avgpool_8,
+    (WORD8 *__restrict__ p_out, const WORD8 *__restrict__ p_inp, WORD32 input_height, WORD32 input_width, WORD32 input_channels, WORD32 kernel_height, WORD32 kernel_width, WORD32 x_stride, WORD32 y_stride, WORD32 x_padding, WORD32 y_padding, WORD32 out_height, WORD32 out_width, WORD32 inp_data_format, WORD32 out_data_format, VOID *p_scratch),
+    (p_out, p_inp, input_height, input_width, input_channels, kernel_height, kernel_width, x_stride, y_stride, x_padding, y_padding, out_height, out_width, inp_data_format, out_data_format, p_scratch),
+    7, (input_height, input_width, input_channels, kernel_height, kernel_width, out_height, out_width))
+
+XA_NNLIB_TRACE_WRAP(98, xa_nn_avgpool_16,
+    (WORD16 *__restrict__ p_out, const WORD16 *__restrict__ p_inp, WORD32 input_height, WORD32 input_width, WORD32 input_channels, WORD32 kernel_height, WORD32 kernel_width, WORD32 x_stride, WORD32 y_stride, WORD32 x_padding, WORD32 y_padding, WORD32 out_height, WORD32 out_width, WORD32 inp_data_format, WORD32 out_data_format, VOID *p_scratch),
+    (p_out, p_inp, input_height, input_width, input_channels, kernel_height, kernel_width, x_stride, y_stride, x_padding, y_padding, out_height, out_width, inp_data_format, out_data_format, p_scratch),
+    7, (input_height, input_width, input_channels, kernel_height, kernel_width, out_height, out_width))
+
+#if HAVE_VFPU
+XA_NNLIB_TRACE_WRAP(99, xa_nn_avgpool_f32,
+    (FLOAT32 *__restrict__ p_out, const FLOAT32 *__restrict__ p_inp, WORD32 input_height, WORD32 input_width, WORD32 input_channels, WORD32 kernel_height, WORD32 kernel_width, WORD32 x_stride, WORD32 y_stride, WORD32 x_padding, WORD32 y_padding, WORD32 out_height, WORD32 out_width, WORD32 inp_data_format, WORD32 out_data_format, VOID *p_scratch),
+    (p_out, p_inp, input_height, input_width, input_channels, kernel_height, kernel_width, x_stride, y_stride, x_padding, y_padding, out_height, out_width, inp_data_format, out_data_format, p_scratch),
+    7, (input_height, input_width, input_channels, kernel_height, kernel_width, out_height, out_width))
+#endif
+
+XA_NNLIB_TRACE_WRAP(100, xa_nn_avgpool_asym8u,
+    (UWORD8* __restrict__ p_out, const UWORD8* __restrict__ p_inp, WORD32 input_height, WORD32 input_width, WORD32 input_channels, WORD32 kernel_height, WORD32 kernel_width, WORD32 x_stride, WORD32 y_stride, WORD32 x_padding, WORD32 y_padding, WORD32 out_height, WORD32 out_width, WORD32 inp_data_format, WORD32 out_data_format, VOID *p_scratch),
+    (p_out, p_inp, input_height, input_width, input_channels, kernel_height, kernel_width, x_stride, y_stride, x_padding, y_padding, out_height, out_width, inp_data_format, out_data_format, p_scratch),
+    7, (input_height, input_width, input_channels, kernel_height, kernel_width, out_height, out_width))
+
+XA_NNLIB_TRACE_WRAP(101, xa_nn_avgpool_getsize,
+    (WORD32 input_channels, WORD32 inp_precision, WORD32 out_precision, WORD32 input_height, WORD32 input_width, WORD32 kernel_height, WORD32 kernel_width, WORD32 x_stride, WORD32 y_stride, WORD32 x_padding, WORD32 y_padding, WORD32 out_height, WORD32 out_width, WORD32 inp_data_format, WORD32 out_data_format),
+    (input_channels, inp_precision, out_precision, input_height, input_width, kernel_height, kernel_width, x_stride, y_stride, x_padding, y_padding, out_height, out_width, inp_data_format, out_data_format),
+    7, (input_channels, input_height, input_width, kernel_height, kernel_width, out_height, out_width))
+
+XA_NNLIB_TRACE_WRAP(102, xa_nn_maxpool_8,
+    (WORD8 *__restrict__ p_out, const WORD8 *__restrict__ p_inp , WORD32 input_height, WORD32 input_width, WORD32 input_channels, WORD32 kernel_height, WORD32 kernel_width, WORD32 x_stride, WORD32 y_stride, WORD32 x_padding, WORD32 y_padding, WORD32 out_height, WORD32 out_width, WORD32 inp_data_format, WORD32 out_data_format, VOID *p_scratch),
+    (p_out, p_inp, input_height, input_width, input_channels, kernel_height, kernel_width, x_stride, y_stride, x_padding, y_padding, out_height, out_width, inp_data_format, out_data_format, p_scratch),
+    7, (input_height, input_width, input_channels, kernel_height, kernel_width, out_height, out_width))
+
+XA_NNLIB_TRACE_WRAP(103, xa_nn_maxpool_16,
+    (WORD16 *__restrict__ p_out, const WORD16 *__restrict__ p_inp , WORD32 input_height, WORD32 input_width, WORD32 input_channels, WORD32 kernel_height, WORD32 kernel_width, WORD32 x_stride, WORD32 y_stride, WORD32 x_padding, WORD32 y_padding, WORD32 out_height, WORD32 out_width, WORD32 inp_data_format, WORD32 out_data_format, VOID *p_scratch),
+    (p_out, p_inp, input_height, input_width, input_channels, kernel_height, kernel_width, x_stride, y_stride, x_padding, y_padding, out_height, out_width, inp_data_format, out_data_format, p_scratch),
+    7, (input_height, input_width, input_channels, kernel_height, kernel_width, out_height, out_width))
+
+#if HAVE_VFPU
+XA_NNLIB_TRACE_WRAP(104, xa_nn_maxpool_f32,
+    (FLOAT32 *__restrict__ p_out, const FLOAT32 *__restrict__ p_inp , WORD32 input_height, WORD32 input_width, WORD32 input_channels, WORD32 kernel_height, WORD32 kernel_width, WORD32 x_stride, WORD32 y_stride, WORD32 x_padding, WORD32 y_padding, WORD32 out_height, WORD32 out_width, WORD32 inp_data_format, WORD32 out_data_format, VOID *p_scratch),
+    (p_out, p_inp, input_height, input_width, input_channels, kernel_height, kernel_width, x_stride, y_stride, x_padding, y_padding, out_height, out_width, inp_data_format, out_data_format, p_scratch),
+    7, (input_height, input_width, input_channels, kernel_height, kernel_width, out_height, out_width))
+#endif
+
+XA_NNLIB_TRACE_WRAP(105, xa_nn_maxpool_asym8u,
+    (UWORD8* __restrict__ p_out, const UWORD8* __restrict__ p_inp, WORD32 input_height, WORD32 input_width, WORD32 input_channels, WORD32 kernel_height, WORD32 kernel_width, WORD32 x_stride, WORD32 y_stride, WORD32 x_padding, WORD32 y_padding, WORD32 out_height, WORD32 out_width, WORD32 inp_data_format, WORD32 out_data_format, VOID *p_scratch),
+    (p_out, p_inp, input_height, input_width, input_channels, kernel_height, kernel_width, x_stride, y_stride, x_padding, y_padding, out_height, out_width, inp_data_format, out_data_format, p_scratch),
+    7, (input_height, input_width, input_channels, kernel_height, kernel_width, out_height, out_width))
+
+XA_NNLIB_TRACE_WRAP(106, xa_nn_maxpool_getsize,
+    (WORD32 input_channels, WORD32 inp_precision, WORD32 out_precision, WORD32 input_height, WORD32 input_width, WORD32 kernel_height, WORD32 kernel_width, WORD32 x_stride, WORD32 y_stride, WORD32 x_padding, WORD32 y_padding, WORD32 out_height, WORD32 out_width, WORD32 inp_data_format, WORD32 out_data_format),
+    (input_channels, inp_precision, out_precision, input_height, input_width, kernel_height, kernel_width, x_stride, y_stride, x_padding, y_padding, out_height, out_width, inp_data_format, out_data_format),
+    7, (input_channels, input_height, input_width, kernel_height, kernel_width, out_height, out_width))
+
+#if HAVE_HP_VFPU
+XA_NNLIB_TRACE_WRAP(107, xa_nn_fully_connected_f16,
+    (WORD16 *__restrict__ p_out ,const WORD16 *__restrict__ p_weight ,const WORD16 *__restrict__ p_inp ,const WORD16 *__restrict__ p_bias ,WORD32 weight_depth ,WORD32 out_depth),
+    (p_out, p_weight, p_inp, p_bias, weight_depth, out_depth),
+    2, (weight_depth, out_depth))
+#endif
+
+#if HAVE_VFPU
+XA_NNLIB_TRACE_WRAP(108, xa_nn_fully_connected_f32,
+    (FLOAT32 *__restrict__ p_out ,const FLOAT32 *__restrict__ p_weight ,const FLOAT32 *__restrict__ p_inp ,const FLOAT32 *__restrict__ p_bias ,WORD32 weight_depth ,WORD32 out_depth),
+    (p_out, p_weight, p_inp, p_bias, weight_depth, out_depth),
+    2, (weight_depth, out_depth))
+#endif
+
+XA_NNLIB_TRACE_WRAP(109, xa_nn_fully_connected_16x16_16,
+    (pWORD16 __restrict__ p_out ,pWORD16 __restrict__ p_weight ,pWORD16 __restrict__ p_inp ,pWORD16 __restrict__ p_bias ,WORD32 weight_depth ,WORD32 out_depth ,WORD32 acc_shift ,WORD32 bias_shift),
+    (p_out, p_weight, p_inp, p_bias, weight_depth, out_depth, acc_shift, bias_shift),
+    2, (weight_depth, out_depth))
+
+XA_NNLIB_TRACE_WRAP(110, xa_nn_fully_connected_8x16_16,
+    (pWORD16 __restrict__ p_out ,pWORD8 __restrict__ p_weight ,pWORD16 __restrict__ p_inp ,pWORD16 __restrict__ p_bias ,WORD32 weight_depth ,WORD32 out_depth ,WORD32 acc_shift ,WORD32 bias_shift),
+    (p_out, p_weight, p_inp, p_bias, weight_depth, out_depth, acc_shift, bias_shift),
+    2, (weight_depth, out_depth))
+
+XA_NNLIB_TRACE_WRAP(111, xa_nn_fully_connected_8x8_8,
+    (pWORD8 __restrict__ p_out ,pWORD8 __restrict__ p_weight ,pWORD8 __restrict__ p_inp ,pWORD8 __restrict__ p_bias ,WORD32 weight_depth ,WORD32 out_depth ,WORD32 acc_shift ,WORD32 bias_shift),
+    (p_out, p_weight, p_inp, p_bias, weight_depth, out_depth, acc_shift, bias_shift),
+    2, (weight_depth, out_depth))
+
+XA_NNLIB_TRACE_WRAP(112, xa_nn_fully_connected_asym8uxasym8u_asym8u,
+    (pUWORD8 __restrict__ p_out ,const UWORD8 *__restrict__ p_weight ,const UWORD8 *__restrict__ p_inp ,const WORD32 *__restrict__ p_bias ,WORD32 weight_depth ,WORD32 out_depth ,WORD32 input_zero_bias ,WORD32 weight_zero_bias ,WORD32 out_multiplier ,WORD32 out_shift ,WORD32 out_zero_bias),
+    (p_out, p_weight, p_inp, p_bias, weight_depth, out_depth, input_zero_bias, weight_zero_bias, out_multiplier, out_shift, out_zero_bias),
+    2, (weight_depth, out_depth))
+
+XA_NNLIB_TRACE_WRAP(113, xa_nn_fully_connected_sym8sxasym8s_asym8s,
+    (pWORD8 __restrict__ p_out ,const WORD8 *__restrict__ p_weight ,const WORD8 *__restrict__ p_inp ,const WORD32 *__restrict__ p_bias ,WORD32 weight_depth ,WORD32 out_depth ,WORD32 input_zero_bias ,WORD32 out_multiplier ,WORD32 out_shift ,WORD32 out_zero_bias),
+    (p_out, p_weight, p_inp, p_bias, weight_depth, out_depth, input_zero_bias, out_multiplier, out_shift, out_zero_bias),
+    2, (weight_depth, out_depth))
+
+XA_NNLIB_TRACE_WRAP(114, xa_nn_fully_connected_sym8sxsym16s_sym16s,
+    (pWORD16 __restrict__ p_out ,const WORD8 *__restrict__ p_weight ,const WORD16 *__restrict__ p_inp ,const WORD64 *__restrict__ p_bias ,WORD32 weight_depth ,WORD32 out_depth ,WORD32 out_multiplier ,WORD32 out_shift),
+    (p_out, p_weight, p_inp, p_bias, weight_depth, out_depth, out_multiplier, out_shift),
+    2, (weight_depth, out_depth))
+
+XA_NNLIB_TRACE_WRAP(115, xa_nn_fully_connected_asym8sxasym8s_asym8s,
+    (WORD8 *__restrict__ p_out ,const WORD8 *__restrict__ p_weight ,const WORD8 *__restrict__ p_inp ,const WORD32 *__restrict__ p_bias ,WORD32 weight_depth ,WORD32 out_depth ,WORD32 input_zero_bias ,WORD32 weight_zero_bias ,WORD32 out_multiplier ,WORD32 out_shift ,WORD32 out_zero_bias),
+    (p_out, p_weight, p_inp, p_bias, weight_depth, out_depth, input_zero_bias, weight_zero_bias, out_multiplier, out_shift, out_zero_bias),
+    2, (weight_depth, out_depth))
+
+XA_NNLIB_TRACE_WRAP(116, xa_nn_fully_connected_v2_asym8sxasym8s_asym8s,
+    (WORD8 *__restrict__ p_out ,const WORD8 *__restrict__ p_weight ,const WORD8 *__restrict__ p_inp ,const WORD32 *__restrict__ p_bias ,WORD32 weight_depth ,WORD32 out_depth ,WORD32 input_zero_bias ,WORD32 weight_zero_bias ,WORD32 out_multiplier ,WORD32 out_shift ,WORD32 out_zero_bias ,WORD32 out_activation_min ,WORD32 out_activation_max ,xa_dma_cfg_t *p_dma_cfg),
+    (p_out, p_weight, p_inp, p_bias, weight_depth, out_depth, input_zero_bias, weight_zero_bias, out_multiplier, out_shift, out_zero_bias, out_activation_min, out_activation_max, p_dma_cfg),
+    2, (weight_depth, out_depth))
+
+XA_NNLIB_TRACE_WRAP(117, xa_nn_fully_connected_v2_slice_asym8sxasym8s_asym8s,
+    (WORD8 *__restrict__ p_out ,const WORD8 *__restrict__ p_weight ,const WORD8 *__restrict__ p_inp ,const WORD32 *__restrict__ p_bias ,WORD32 weight_depth ,WORD32 out_depth ,WORD32 input_zero_bias ,WORD32 weight_zero_bias ,WORD32 out_multiplier ,WORD32 out_shift ,WORD32 out_zero_bias ,WORD32 out_activation_min ,WORD32 out_activation_max ,WORD32 out_start ,WORD32 out_end ,xa_dma_cfg_t *p_dma_cfg),
+    (p_out, p_weight, p_inp, p_bias, weight_depth, out_depth, input_zero_bias, weight_zero_bias, out_multiplier, out_shift, out_zero_bias, out_activation_min, out_activation_max, out_start, out_end, p_dma_cfg),
+    2, (weight_depth, out_depth))
+
+XA_NNLIB_TRACE_WRAP(118, xa_nn_fully_connected_v2_residual_asym8sxasym8s_asym8s,
+    (WORD8 *__restrict__ p_out ,const WORD8 *__restrict__ p_weight ,const WORD8 *__restrict__ p_inp ,const WORD32 *__restrict__ p_bias ,WORD32 weight_depth ,WORD32 out_depth ,WORD32 input_zero_bias ,WORD32 weight_zero_bias ,WORD32 out_multiplier ,WORD32 out_shift ,WORD32 out_zero_bias ,WORD32 out_activation_min ,WORD32 out_activation_max ,const xa_nn_residual_cfg_t *p_res_cfg ,xa_dma_cfg_t *p_dma_cfg),
+    (p_out, p_weight, p_inp, p_bias, weight_depth, out_depth, input_zero_bias, weight_zero_bias, out_multiplier, out_shift, out_zero_bias, out_activation_min, out_activation_max, p_res_cfg, p_dma_cfg),
+    2, (weight_depth, out_depth))
+
+XA_NNLIB_TRACE_WRAP(119, xa_nn_fully_connected_v2_act_asym8sxasym8s_asym8s,
+    (WORD8 *__restrict__ p_out ,const WORD8 *__restrict__ p_weight ,const WORD8 *__restrict__ p_inp ,const WORD32 *__restrict__ p_bias ,WORD32 weight_depth ,WORD32 out_depth ,WORD32 input_zero_bias ,WORD32 weight_zero_bias ,WORD32 out_multiplier ,WORD32 out_shift ,WORD32 out_zero_bias ,WORD32 out_activation_min ,WORD32 out_activation_max ,const xa_nn_act_cfg_t *p_act_cfg ,xa_dma_cfg_t *p_dma_cfg),
+    (p_out, p_weight, p_inp, p_bias, weight_depth, out_depth, input_zero_bias, weight_zero_bias, out_multiplier, out_shift, out_zero_bias, out_activation_min, out_activation_max, p_act_cfg, p_dma_cfg),
+    2, (weight_depth, out_depth))
+
+XA_NNLIB_TRACE_WRAP(120, xa_nn_fully_connected_v2_softmax_asym8sxasym8s,
+    (pVOID __restrict__ p_out ,WORD32 *p_top1 ,const WORD8 *__restrict__ p_weight ,const WORD8 *__restrict__ p_inp ,const WORD32 *__restrict__ p_bias ,WORD32 weight_depth ,WORD32 out_depth ,WORD32 input_zero_bias ,WORD32 weight_zero_bias ,WORD32 out_multiplier ,WORD32 out_shift ,WORD32 out_zero_bias ,WORD32 diffmin ,WORD32 input_beta_left_shift ,WORD32 input_beta_multiplier ,WORD32 out_precision ,VOID *p_scratch ,xa_dma_cfg_t *p_dma_cfg),
+    (p_out, p_top1, p_weight, p_inp, p_bias, weight_depth, out_depth, input_zero_bias, weight_zero_bias, out_multiplier, out_shift, out_zero_bias, diffmin, input_beta_left_shift, input_beta_multiplier, out_precision, p_scratch, p_dma_cfg),
+    2, (weight_depth, out_depth))
+
+#if HAVE_VFPU
+XA_NNLIB_TRACE_WRAP(121, xa_nn_fully_connected_v2_f32io_asym8sxasym8s_asym8s,
+    (pVOID __restrict__ p_out ,const WORD8 *__restrict__ p_weight ,const FLOAT32 *__restrict__ p_inp ,const WORD32 *__restrict__ p_bias ,WORD32 weight_depth ,WORD32 out_depth ,WORD32 input_zero_bias ,WORD32 weight_zero_bias ,WORD32 out_multiplier ,WORD32 out_shift ,WORD32 out_zero_bias ,WORD32 out_activation_min ,WORD32 out_activation_max ,const xa_nn_f32io_cfg_t *p_io_cfg ,VOID *p_scratch ,xa_dma_cfg_t *p_dma_cfg),
+    (p_out, p_weight, p_inp, p_bias, weight_depth, out_depth, input_zero_bias, weight_zero_bias, out_multiplier, out_shift, out_zero_bias, out_activation_min, out_activation_max, p_io_cfg, p_scratch, p_dma_cfg),
+    2, (weight_depth, out_depth))
+#endif
+
+XA_NNLIB_TRACE_WRAP(122, xa_nn_fully_connected_v2_sym8sxsym16s_sym16s,
+    (WORD16 *__restrict__ p_out ,const WORD8 *__restrict__ p_weight ,const WORD16 *__restrict__ p_inp ,const WORD64 *__restrict__ p_bias ,WORD32 weight_depth ,WORD32 out_depth ,WORD32 out_multiplier ,WORD32 out_shift ,WORD32 out_activation_min ,WORD32 out_activation_max ,xa_dma_cfg_t *p_dma_cfg),
+    (p_out, p_weight, p_inp, p_bias, weight_depth, out_depth, out_multiplier, out_shift, out_activation_min, out_activation_max, p_dma_cfg),
+    2, (weight_depth, out_depth))
+
+XA_NNLIB_TRACE_WRAP(123, xa_nn_fully_connected_asym4sxasym8s_asym8s,
+    (WORD8 *__restrict__ p_out ,const WORD8 *__restrict__ p_weight ,const WORD8 *__restrict__ p_inp ,const WORD32 *__restrict__ p_bias ,WORD32 weight_depth ,WORD32 out_depth ,WORD32 input_zero_bias ,WORD32 weight_zero_bias ,WORD32 out_multiplier ,WORD32 out_shift ,WORD32 out_zero_bias ,VOID *p_scratch),
+    (p_out, p_weight, p_inp, p_bias, weight_depth, out_depth, input_zero_bias, weight_zero_bias, out_multiplier, out_shift, out_zero_bias, p_scratch),
+    2, (weight_depth, out_depth))
+
+XA_NNLIB_TRACE_WRAP(124, xa_nn_vec_activation_min_max_asym8u_asym8u,
+    (UWORD8 * __restrict__ p_out, const UWORD8 * __restrict__ p_vec, int activation_min, int activation_max, WORD32 vec_length),
+    (p_out, p_vec, activation_min, activation_max, vec_length),
+    1, (vec_length))
+
+#if HAVE_VFPU
+XA_NNLIB_TRACE_WRAP(125, xa_nn_vec_activation_min_max_f32_f32,
+    (FLOAT32 * __restrict__ p_out, const FLOAT32 * __restrict__ p_vec, FLOAT32 activation_min, FLOAT32 activation_max, WORD32 vec_length),
+    (p_out, p_vec, activation_min, activation_max, vec_length),
+    1, (vec_length))
+#endif
+
+XA_NNLIB_TRACE_WRAP(126, xa_nn_vec_softmax_asym8u_asym8u,
+    (UWORD8 * __restrict__ p_out, const UWORD8 * __restrict__ p_vec, WORD32 diffmin, WORD32 input_left_shift, WORD32 input_multiplier, WORD32 vec_length, pVOID p_scratch),
+    (p_out, p_vec, diffmin, input_left_shift, input_multiplier, vec_length, p_scratch),
+    1, (vec_length))
+
+XA_NNLIB_TRACE_WRAP(127, xa_nn_vec_softmax_asym8s_asym8s,
+    (WORD8 * __restrict__ p_out, const WORD8 * __restrict__ p_vec, WORD32 diffmin, WORD32 input_beta_left_shift, WORD32 input_beta_multiplier, WORD32 vec_length, pVOID p_scratch),
+    (p_out, p_vec, diffmin, input_beta_left_shift, input_beta_multiplier, vec_length, p_scratch),
+    1, (vec_length))
+
+XA_NNLIB_TRACE_WRAP(128, xa_nn_vec_softmax_asym8s_16,
+    (WORD16 * __restrict__ p_out, const WORD8 * __restrict__ p_vec, WORD32 diffmin, WORD32 input_beta_left_shift, WORD32 input_beta_multiplier, WORD32 vec_length, pVOID p_scratch),
+    (p_out, p_vec, diffmin, input_beta_left_shift, input_beta_multiplier, vec_length, p_scratch),
+    1, (vec_length))
+
+XA_NNLIB_TRACE_WRAP(129, xa_nn_vec_softmax_sym16s_16,
+    (WORD16 * __restrict__ p_out, const WORD16 * __restrict__ p_vec, WORD32 input_beta_left_shift, WORD32 input_beta_multiplier, WORD32 vec_length),
+    (p_out, p_vec, input_beta_left_shift, input_beta_multiplier, vec_length),
+    1, (vec_length))
+
+XA_NNLIB_TRACE_WRAP(130, xa_nn_vec_sigmoid_asym8u_asym8u,
+    (UWORD8 *p_out, const UWORD8 *p_vec, WORD32 zero_point, WORD32 input_range_radius, WORD32 input_multiplier, WORD32 input_left_shift, WORD32 vec_length),
+    (p_out, p_vec, zero_point, input_range_radius, input_multiplier, input_left_shift, vec_length),
+    1, (vec_length))
+
+XA_NNLIB_TRACE_WRAP(131, xa_nn_vec_sigmoid_asym8s_asym8s,
+    (WORD8 *p_out, const WORD8 *p_vec, WORD32 zero_point, WORD32 input_range_radius, WORD32 input_multiplier, WORD32 input_left_shift, WORD32 vec_length),
+    (p_out, p_vec, zero_point, input_range_radius, input_multiplier, input_left_shift, vec_length),
+    1, (vec_length))
+
+XA_NNLIB_TRACE_WRAP(132, xa_nn_vec_sigmoid_sym16s_sym16s,
+    (WORD16 *p_out, const WORD16 *p_vec, WORD32 input_multiplier, WORD32 input_left_shift, WORD32 vec_length),
+    (p_out, p_vec, input_multiplier, input_left_shift, vec_length),
+    1, (vec_length))
+
+XA_NNLIB_TRACE_WRAP(351, xa_nn_fully_connected_v2_softmax_getsize,
+    (int out_depth, int out_precision),
+    (out_depth, out_precision),
+    1, (out_depth))
+
+XA_NNLIB_TRACE_WRAP(133, xa_nn_vec_activation_min_max_8_8,
+    (WORD8 * __restrict__ p_out, const WORD8 * __restrict__ p_vec, int activation_min, int activation_max, WORD32 vec_length),
+    (p_out, p_vec, activation_min, activation_max, vec_length),
+    1, (vec_length))
+
+XA_NNLIB_TRACE_WRAP(134, xa_nn_vec_activation_min_max_16_16,
+    (WORD16 * __restrict__ p_out, const WORD16 * __restrict__ p_vec, int activation_min, int activation_max, WORD32 vec_length),
+    (p_out, p_vec, activation_min, activation_max, vec_length),
+    1, (vec_length))
+
+XA_NNLIB_TRACE_WRAP(135, xa_nn_vec_relu_asym8u_asym8u,
+    (UWORD8 * __restrict__ p_out, const UWORD8 * __restrict__ p_vec, WORD32 inp_zero_bias, WORD32 out_multiplier, WORD32 out_shift, WORD32 out_zero_bias, WORD32 quantized_activation_min, WORD32 quantized_activation_max, WORD32 vec_length),
+    (p_out, p_vec, inp_zero_bias, out_multiplier, out_shift, out_zero_bias, quantized_activation_min, quantized_activation_max, vec_length),
+    1, (vec_length))
+
+XA_NNLIB_TRACE_WRAP(136, xa_nn_vec_relu_asym8s_asym8s,
+    (WORD8 * __restrict__ p_out, const WORD8 * __restrict__ p_vec, WORD32 inp_zero_bias, WORD32 out_multiplier, WORD32 out_shift, WORD32 out_zero_bias, WORD32 quantized_activation_min, WORD32 quantized_activation_max, WORD32 vec_length),
+    (p_out, p_vec, inp_zero_bias, out_multiplier, out_shift, out_zero_bias, quantized_activation_min, quantized_activation_max, vec_length),
+    1, (vec_length))
+
+XA_NNLIB_TRACE_WRAP(137, xa_nn_vec_prelu_asym8s_asym8s,
+    (WORD8 * __restrict__ p_out, const WORD8 * __restrict__ p_vec, const WORD8 * __restrict__ p_vec_alpha, WORD32 inp_zero_bias, WORD32 alpha_zero_bias, WORD32 alpha_multiplier, WORD32 alpha_shift, WORD32 out_multiplier, WORD32 out_shift, WORD32 out_zero_bias, WORD32 vec_length),
+    (p_out, p_vec, p_vec_alpha, inp_zero_bias, alpha_zero_bias, alpha_multiplier, alpha_shift, out_multiplier, out_shift, out_zero_bias, vec_length),
+    1, (vec_length))
+
+XA_NNLIB_TRACE_WRAP(138, xa_nn_vec_leaky_relu_asym8s_asym8s,
+    (WORD8 * __restrict__ p_out, const WORD8 * __restrict__ p_vec, WORD32 inp_zero_bias, WORD32 alpha_multiplier, WORD32 alpha_shift, WORD32 out_multiplier, WORD32 out_shift, WORD32 out_zero_bias, WORD32 vec_length),
+    (p_out, p_vec, inp_zero_bias, alpha_multiplier, alpha_shift, out_multiplier, out_shift, out_zero_bias, vec_length),
+    1, (vec_length))
+
+XA_NNLIB_TRACE_WRAP(139, xa_nn_vec_leaky_relu_asym16s_asym16s,
+    (WORD16 * __restrict__ p_out, const WORD16 * __restrict__ p_vec, WORD32 inp_zero_bias, WORD32 alpha_multiplier, WORD32 alpha_shift, WORD32 out_multiplier, WORD32 out_shift, WORD32 out_zero_bias, WORD32 vec_length),
+    (p_out, p_vec, inp_zero_bias, alpha_multiplier, alpha_shift, out_multiplier, out_shift, out_zero_bias, vec_length),
+    1, (vec_length))
+
+XA_NNLIB_TRACE_WRAP(140, xa_nn_vec_hard_swish_asym8s_asym8s,
+    (WORD8 * __restrict__ p_out, const WORD8 * __restrict__ p_vec, WORD32 inp_zero_bias, WORD16 reluish_multiplier, WORD32 reluish_shift, WORD16 out_multiplier, WORD32 out_shift, WORD32 out_zero_bias, WORD32 vec_length),
+    (p_out, p_vec, inp_zero_bias, reluish_multiplier, reluish_shift, out_multiplier, out_shift, out_zero_bias, vec_length),
+    1, (vec_length))
+
+XA_NNLIB_TRACE_WRAP(141, xa_nn_vec_tanh_asym8s_asym8s,
+    (WORD8 *p_out, const WORD8 *p_vec, WORD32 zero_point, WORD32 input_range_radius, WORD32 input_multiplier, WORD32 input_left_shift, WORD32 vec_length),
+    (p_out, p_vec, zero_point, input_range_radius, input_multiplier, input_left_shift, vec_length),
+    1, (vec_length))
+
+XA_NNLIB_TRACE_WRAP(142, xa_nn_vec_activation_lut_asym8s,
+    (WORD8 *p_lut, const xa_nn_act_params_t *p_params, WORD32 lut_channels),
+    (p_lut, p_params, lut_channels),
+    1, (lut_channels))
+
+XA_NNLIB_TRACE_WRAP(143, xa_nn_vec_tanh_sym16s_sym16s,
+    (WORD16 *p_out, const WORD16 *p_vec, WORD32 input_multiplier, WORD32 input_left_shift, WORD32 vec_length),
+    (p_out, p_vec, input_multiplier, input_left_shift, vec_length),
+    1, (vec_length))
+
+XA_NNLIB_TRACE_WRAP(144, xa_nn_vec_gelu_asym8s_asym8s,
+    (WORD8 * __restrict__ p_out, const WORD8 * __restrict__ p_vec, WORD32 inp_zero_bias, WORD32 input_multiplier, WORD32 input_shift, WORD32 out_multiplier, WORD32 out_shift, WORD32 out_zero_bias, WORD32 vec_length),
+    (p_out, p_vec, inp_zero_bias, input_multiplier, input_shift, out_multiplier, out_shift, out_zero_bias, vec_length),
+    1, (vec_length))
+
+XA_NNLIB_TRACE_WRAP(145, xa_nn_vec_silu_asym8s_asym8s,
+    (WORD8 * __restrict__ p_out, const WORD8 * __restrict__ p_vec, WORD32 inp_zero_bias, WORD32 input_multiplier, WORD32 input_shift, WORD32 out_multiplier, WORD32 out_shift, WORD32 out_zero_bias, WORD32 vec_length),
+    (p_out, p_vec, inp_zero_bias, input_multiplier, input_shift, out_multiplier, out_shift, out_zero_bias, vec_length),
+    1, (vec_length))
+
+XA_NNLIB_TRACE_WRAP(146, xa_nn_vec_gelu_sym16s_sym16s,
+    (WORD16 * __restrict__ p_out, const WORD16 * __restrict__ p_vec, WORD32 input_multiplier, WORD32 input_shift, WORD32 out_multiplier, WORD32 out_shift, WORD32 vec_length),
+    (p_out, p_vec, input_multiplier, input_shift, out_multiplier, out_shift, vec_length),
+    1, (vec_length))
+
+XA_NNLIB_TRACE_WRAP(147, xa_nn_vec_silu_sym16s_sym16s,
+    (WORD16 * __restrict__ p_out, const WORD16 * __restrict__ p_vec, WORD32 input_multiplier, WORD32 input_shift, WORD32 out_multiplier, WORD32 out_shift, WORD32 vec_length),
+    (p_out, p_vec, input_multiplier, input_shift, out_multiplier, out_shift, vec_length),
+    1, (vec_length))
+
+XA_NNLIB_TRACE_WRAP(148, xa_nn_conv1d_std_asym8uxasym8u,
+    (UWORD8* __restrict__ p_out, UWORD8* __restrict__ p_inp, UWORD8* __restrict__ p_kernel, WORD32* __restrict__ p_bias, WORD32 input_height, WORD32 input_width, WORD32 input_channels, WORD32 kernel_height, WORD32 out_channels, WORD32 y_stride, WORD32 y_padding, WORD32 out_height, WORD32 input_zero_bias, WORD32 kernel_zero_bias, WORD32 out_multiplier, WORD32 out_shift, WORD32 out_zero_bias, WORD32 out_data_format, VOID *p_scratch),
+    (p_out, p_inp, p_kernel, p_bias, input_height, input_width, input_channels, kernel_height, out_channels, y_stride, y_padding, out_height, input_zero_bias, kernel_zero_bias, out_multiplier, out_shift, out_zero_bias, out_data_format, p_scratch),
+    6, (input_height, input_width, input_channels, kernel_height, out_channels, out_height))
+
+XA_NNLIB_TRACE_WRAP(149, xa_nn_conv2d_std_asym8uxasym8u,
+    (UWORD8* __restrict__ p_out, const UWORD8* __restrict__ p_inp, const UWORD8* __restrict__ p_kernel, const WORD32* __restrict__ p_bias, WORD32 input_height, WORD32 input_width, WORD32 input_channels, WORD32 kernel_height, WORD32 kernel_width, WORD32 out_channels, WORD32 x_stride, WORD32 y_stride, WORD32 x_padding, WORD32 y_padding, WORD32 out_height, WORD32 out_width, WORD32 input_zero_bias, WORD32 kernel_zero_bias, WORD32 out_multiplier, WORD32 out_shift, WORD32 out_zero_bias, WORD32 out_data_format, VOID *p_scratch),
+    (p_out, p_inp, p_kernel, p_bias, input_height, input_width, input_channels, kernel_height, kernel_width, out_channels, x_stride, y_stride, x_padding, y_padding, out_height, out_width, input_zero_bias, kernel_zero_bias, out_multiplier, out_shift, out_zero_bias, out_data_format, p_scratch),
+    8, (input_height, input_width, input_channels, kernel_height, kernel_width, out_channels, out_height, out_width))
+
+XA_NNLIB_TRACE_WRAP(150, xa_nn_conv2d_std_per_chan_sym8sxsym16s,
+    (WORD16* __restrict__ p_out, const WORD16* __restrict__ p_inp, const WORD8* __restrict__ p_kernel, const WORD64* __restrict__ p_bias, WORD32 input_height, WORD32 input_width, WORD32 input_channels, WORD32 kernel_height, WORD32 kernel_width, WORD32 out_channels, WORD32 x_stride, WORD32 y_stride, WORD32 x_padding, WORD32 y_padding, WORD32 out_height, WORD32 out_width, WORD32 input_zero_bias, WORD32 * p_out_multiplier, WORD32 * p_out_shift, WORD32 out_zero_bias, WORD32 out_data_format, VOID *p_scratch),
+    (p_out, p_inp, p_kernel, p_bias, input_height, input_width, input_channels, kernel_height, kernel_width, out_channels, x_stride, y_stride, x_padding, y_padding, out_height, out_width, input_zero_bias, p_out_multiplier, p_out_shift, out_zero_bias, out_data_format, p_scratch),
+    8, (input_height, input_width, input_channels, kernel_height, kernel_width, out_channels, out_height, out_width))
+
+XA_NNLIB_TRACE_WRAP(151, xa_nn_dilated_conv2d_std_per_chan_sym8sxsym16s,
+    (WORD16* __restrict__ p_out, const WORD16* __restrict__ p_inp, const WORD8* __restrict__ p_kernel, const WORD64* __restrict__ p_bias, WORD32 input_height, WORD32 input_width, WORD32 input_channels, WORD32 kernel_height, WORD32 kernel_width, WORD32 out_channels, WORD32 x_stride, WORD32 y_stride, WORD32 x_padding, WORD32 y_padding, WORD32 out_height, WORD32 out_width, WORD32 input_zero_bias, WORD32 * p_out_multiplier, WORD32 * p_out_shift, WORD32 out_zero_bias, WORD32 out_data_format, VOID *p_scratch, WORD32 dilation_height, WORD32 dilation_width),
+    (p_out, p_inp, p_kernel, p_bias, input_height, input_width, input_channels, kernel_height, kernel_width, out_channels, x_stride, y_stride, x_padding, y_padding, out_height, out_width, input_zero_bias, p_out_multiplier, p_out_shift, out_zero_bias, out_data_format, p_scratch, dilation_height, dilation_width),
+    8, (input_height, input_width, input_channels, kernel_height, kernel_width, out_channels, out_height, out_width))
+
+XA_NNLIB_TRACE_WRAP(152, xa_nn_conv2d_per_chan_sym8sxsym16s,
+    (WORD16* __restrict__ p_out, const WORD16* __restrict__ p_inp, const WORD8* __restrict__ p_kernel, const WORD64* __restrict__ p_bias, WORD32 input_height, WORD32 input_width, WORD32 input_channels, WORD32 kernel_height, WORD32 kernel_width, WORD32 kernel_channels, WORD32 dilation_height, WORD32 dilation_width, WORD32 out_channels, WORD32 x_stride, WORD32 y_stride, WORD32 x_padding, WORD32 y_padding, WORD32 out_height, WORD32 out_width, WORD32 input_zero_bias, WORD32 * p_out_multiplier, WORD32 * p_out_shift, WORD32 out_zero_bias, WORD32 out_data_format, VOID *p_scratch),
+    (p_out, p_inp, p_kernel, p_bias, input_height, input_width, input_channels, kernel_height, kernel_width, kernel_channels, dilation_height, dilation_width, out_channels, x_stride, y_stride, x_padding, y_padding, out_height, out_width, input_zero_bias, p_out_multiplier, p_out_shift, out_zero_bias, out_data_format, p_scratch),
+    8, (input_height, input_width, input_channels, kernel_height, kernel_width, kernel_channels, out_channels, out_height))
+
+XA_NNLIB_TRACE_WRAP(153, xa_nn_conv2d_std_v2_per_chan_sym8sxsym16s,
+    (WORD16* __restrict__ p_out, const WORD16* __restrict__ p_inp, const WORD8* __restrict__ p_kernel, const WORD64* __restrict__ p_bias, WORD32 input_height, WORD32 input_width, WORD32 input_channels, WORD32 kernel_height, WORD32 kernel_width, WORD32 out_channels, WORD32 x_stride, WORD32 y_stride, WORD32 x_padding, WORD32 y_padding, WORD32 out_height, WORD32 out_width, WORD32 input_zero_bias, WORD32 * p_out_multiplier, WORD32 * p_out_shift, WORD32 out_zero_bias, WORD32 out_data_format, VOID *p_scratch, WORD32 out_activation_min, WORD32 out_activation_max, xa_dma_cfg_t *p_dma_cfg),
+    (p_out, p_inp, p_kernel, p_bias, input_height, input_width, input_channels, kernel_height, kernel_width, out_channels, x_stride, y_stride, x_padding, y_padding, out_height, out_width, input_zero_bias, p_out_multiplier, p_out_shift, out_zero_bias, out_data_format, p_scratch, out_activation_min, out_activation_max, p_dma_cfg),
+    8, (input_height, input_width, input_channels, kernel_height, kernel_width, out_channels, out_height, out_width))
+
+XA_NNLIB_TRACE_WRAP(154, xa_nn_conv2d_std_prepack_sym8sxsym16s,
+    (WORD8* __restrict__ p_kernel_packed, const WORD8* __restrict__ p_kernel, WORD32 input_channels, WORD32 kernel_height, WORD32 kernel_width, WORD32 out_channels),
+    (p_kernel_packed, p_kernel, input_channels, kernel_height, kernel_width, out_channels),
+    4, (input_channels, kernel_height, kernel_width, out_channels))
+
+XA_NNLIB_TRACE_WRAP(155, xa_nn_conv2d_std_v2_prepacked_per_chan_sym8sxsym16s,
+    (WORD16* __restrict__ p_out, const WORD16* __restrict__ p_inp, const WORD8* __restrict__ p_kernel, const WORD64* __restrict__ p_bias, WORD32 input_height, WORD32 input_width, WORD32 input_channels, WORD32 kernel_height, WORD32 kernel_width, WORD32 out_channels, WORD32 x_stride, WORD32 y_stride, WORD32 x_padding, WORD32 y_padding, WORD32 out_height, WORD32 out_width, WORD32 input_zero_bias, WORD32 * p_out_multiplier, WORD32 * p_out_shift, WORD32 out_zero_bias, WORD32 out_data_format, VOID *p_scratch, WORD32 out_activation_min, WORD32 out_activation_max, xa_dma_cfg_t *p_dma_cfg),
+    (p_out, p_inp, p_kernel, p_bias, input_height, input_width, input_channels, kernel_height, kernel_width, out_channels, x_stride, y_stride, x_padding, y_padding, out_height, out_width, input_zero_bias, p_out_multiplier, p_out_shift, out_zero_bias, out_data_format, p_scratch, out_activation_min, out_activation_max, p_dma_cfg),
+    8, (input_height, input_width, input_channels, kernel_height, kernel_width, out_channels, out_height, out_width))
+
+XA_NNLIB_TRACE_WRAP(156, xa_nn_dilated_conv2d_std_v2_per_chan_sym8sxsym16s,
+    (WORD16* __restrict__ p_out, const WORD16* __restrict__ p_inp, const WORD8* __restrict__ p_kernel, const WORD64* __restrict__ p_bias, WORD32 input_height, WORD32 input_width, WORD32 input_channels, WORD32 kernel_height, WORD32 kernel_width, WORD32 out_channels, WORD32 x_stride, WORD32 y_stride, WORD32 x_padding, WORD32 y_padding, WORD32 out_height, WORD32 out_width, WORD32 input_zero_bias, WORD32 * p_out_multiplier, WORD32 * p_out_shift, WORD32 out_zero_bias, WORD32 out_data_format, VOID *p_scratch, WORD32 dilation_height, WORD32 dilation_width, WORD32 out_activation_min, WORD32 out_activation_max, xa_dma_cfg_t *p_dma_cfg),
+    (p_out, p_inp, p_kernel, p_bias, input_height, input_width, input_channels, kernel_height, kernel_width, out_channels, x_stride, y_stride, x_padding, y_padding, out_height, out_width, input_zero_bias, p_out_multiplier, p_out_shift, out_zero_bias, out_data_format, p_scratch, dilation_height, dilation_width, out_activation_min, out_activation_max, p_dma_cfg),
+    8, (input_height, input_width, input_channels, kernel_height, kernel_width, out_channels, out_height, out_width))
+
+XA_NNLIB_TRACE_WRAP(157, xa_nn_conv2d_v2_per_chan_sym8sxsym16s,
+    (WORD16* __restrict__ p_out, const WORD16* __restrict__ p_inp, const WORD8* __restrict__ p_kernel, const WORD64* __restrict__ p_bias, WORD32 input_height, WORD32 input_width, WORD32 input_channels, WORD32 kernel_height, WORD32 kernel_width, WORD32 kernel_channels, WORD32 dilation_height, WORD32 dilation_width, WORD32 out_channels, WORD32 x_stride, WORD32 y_stride, WORD32 x_padding, WORD32 y_padding, WORD32 out_height, WORD32 out_width, WORD32 input_zero_bias, WORD32 * p_out_multiplier, WORD32 * p_out_shift, WORD32 out_zero_bias, WORD32 out_data_format, VOID *p_scratch, WORD32 out_activation_min, WORD32 out_activation_max, xa_dma_cfg_t *p_dma_cfg),
+    (p_out, p_inp, p_kernel, p_bias, input_height, input_width, input_channels, kernel_height, kernel_width, kernel_channels, dilation_height, dilation_width, out_channels, x_stride, y_stride, x_padding, y_padding, out_height, out_width, input_zero_bias, p_out_multiplier, p_out_shift, out_zero_bias, out_data_format, p_scratch, out_activation_min, out_activation_max, p_dma_cfg),
+    8, (input_height, input_width, input_channels, kernel_height, kernel_width, kernel_channels, out_channels, out_height))
+
+XA_NNLIB_TRACE_WRAP(158, xa_nn_conv2d_std_per_chan_sym8sxasym8s,
+    (WORD8* __restrict__ p_out, const WORD8* __restrict__ p_inp, const WORD8* __restrict__ p_kernel, const WORD32* __restrict__ p_bias, WORD32 input_height, WORD32 input_width, WORD32 input_channels, WORD32 kernel_height, WORD32 kernel_width, WORD32 out_channels, WORD32 x_stride, WORD32 y_stride, WORD32 x_padding, WORD32 y_padding, WORD32 out_height, WORD32 out_width, WORD32 input_zero_bias, WORD32 * p_out_multiplier, WORD32 * p_out_shift, WORD32 out_zero_bias, WORD32 out_data_format, VOID *p_scratch),
+    (p_out, p_inp, p_kernel, p_bias, input_height, input_width, input_channels, kernel_height, kernel_width, out_channels, x_stride, y_stride, x_padding, y_padding, out_height, out_width, input_zero_bias, p_out_multiplier, p_out_shift, out_zero_bias, out_data_format, p_scratch),
+    8, (input_height, input_width, input_channels, kernel_height, kernel_width, out_channels, out_height, out_width))
+
+XA_NNLIB_TRACE_WRAP(159, xa_nn_conv2d_std_v2_per_chan_sym8sxasym8s,
+    (WORD8* __restrict__ p_out, const WORD8* __restrict__ p_inp, const WORD8* __restrict__ p_kernel, const WORD32* __restrict__ p_bias, WORD32 input_height, WORD32 input_width, WORD32 input_channels, WORD32 kernel_height, WORD32 kernel_width, WORD32 out_channels, WORD32 x_stride, WORD32 y_stride, WORD32 x_padding, WORD32 y_padding, WORD32 out_height, WORD32 out_width, WORD32 input_zero_bias, WORD32 * p_out_multiplier, WORD32 * p_out_shift, WORD32 out_zero_bias, WORD32 out_data_format, VOID *p_scratch, WORD32 out_activation_min, WORD32 out_activation_max, xa_dma_cfg_t *p_dma_cfg),
+    (p_out, p_inp, p_kernel, p_bias, input_height, input_width, input_channels, kernel_height, kernel_width, out_channels, x_stride, y_stride, x_padding, y_padding, out_height, out_width, input_zero_bias, p_out_multiplier, p_out_shift, out_zero_bias, out_data_format, p_scratch, out_activation_min, out_activation_max, p_dma_cfg),
+    8, (input_height, input_width, input_channels, kernel_height, kernel_width, out_channels, out_height, out_width))
+
+XA_NNLIB_TRACE_WRAP(160, xa_nn_conv2d_std_v2_tiled_per_chan_sym8sxasym8s,
+    (WORD8* __restrict__ p_out, const WORD8* __restrict__ p_inp, const WORD8* __restrict__ p_kernel, const WORD32* __restrict__ p_bias, WORD32 input_height, WORD32 input_width, WORD32 input_channels, WORD32 kernel_height, WORD32 kernel_width, WORD32 out_channels, WORD32 x_stride, WORD32 y_stride, WORD32 x_padding, WORD32 y_padding, WORD32 out_height, WORD32 out_width, WORD32 input_zero_bias, WORD32 * p_out_multiplier, WORD32 * p_out_shift, WORD32 out_zero_bias, WORD32 out_data_format, VOID *p_scratch, WORD32 out_activation_min, WORD32 out_activation_max, const xa_nn_conv2d_std_tile_plan_t *p_plan, xa_dma_cfg_t *p_dma_cfg),
+    (p_out, p_inp, p_kernel, p_bias, input_height, input_width, input_channels, kernel_height, kernel_width, out_channels, x_stride, y_stride, x_padding, y_padding, out_height, out_width, input_zero_bias, p_out_multiplier, p_out_shift, out_zero_bias, out_data_format, p_scratch, out_activation_min, out_activation_max, p_plan, p_dma_cfg),
+    8, (input_height, input_width, input_channels, kernel_height, kernel_width, out_channels, out_height, out_width))
+
+XA_NNLIB_TRACE_WRAP(161, xa_nn_conv2d_std_v2_slice_per_chan_sym8sxasym8s,
+    (WORD8* __restrict__ p_out, const WORD8* __restrict__ p_inp, const WORD8* __restrict__ p_kernel, const WORD32* __restrict__ p_bias, WORD32 input_height, WORD32 input_width, WORD32 input_channels, WORD32 kernel_height, WORD32 kernel_width, WORD32 out_channels, WORD32 x_stride, WORD32 y_stride, WORD32 x_padding, WORD32 y_padding, WORD32 out_height, WORD32 out_width, WORD32 input_zero_bias, WORD32 * p_out_multiplier, WORD32 * p_out_shift, WORD32 out_zero_bias, WORD32 out_data_format, VOID *p_scratch, WORD32 out_activation_min, WORD32 out_activation_max, WORD32 out_row_start, WORD32 out_row_end, WORD32 out_ch_start, WORD32 out_ch_end, xa_dma_cfg_t *p_dma_cfg),
+    (p_out, p_inp, p_kernel, p_bias, input_height, input_width, input_channels, kernel_height, kernel_width, out_channels, x_stride, y_stride, x_padding, y_padding, out_height, out_width, input_zero_bias, p_out_multiplier, p_out_shift, out_zero_bias, out_data_format, p_scratch, out_activation_min, out_activation_max, out_row_start, out_row_end, out_ch_start, out_ch_end, p_dma_cfg),
+    8, (input_height, input_width, input_channels, kernel_height, kernel_width, out_channels, out_height, out_width))
+
+XA_NNLIB_TRACE_WRAP(162, xa_nn_conv2d_std_v2_residual_per_chan_sym8sxasym8s,
+    (WORD8* __restrict__ p_out, const WORD8* __restrict__ p_inp, const WORD8* __restrict__ p_kernel, const WORD32* __restrict__ p_bias, WORD32 input_height, WORD32 input_width, WORD32 input_channels, WORD32 kernel_height, WORD32 kernel_width, WORD32 out_channels, WORD32 x_stride, WORD32 y_stride, WORD32 x_padding, WORD32 y_padding, WORD32 out_height, WORD32 out_width, WORD32 input_zero_bias, WORD32 * p_out_multiplier, WORD32 * p_out_shift, WORD32 out_zero_bias, WORD32 out_data_format, VOID *p_scratch, WORD32 out_activation_min, WORD32 out_activation_max, const xa_nn_residual_cfg_t *p_res_cfg, xa_dma_cfg_t *p_dma_cfg),
+    (p_out, p_inp, p_kernel, p_bias, input_height, input_width, input_channels, kernel_height, kernel_width, out_channels, x_stride, y_stride, x_padding, y_padding, out_height, out_width, input_zero_bias, p_out_multiplier, p_out_shift, out_zero_bias, out_data_format, p_scratch, out_activation_min, out_activation_max, p_res_cfg, p_dma_cfg),
+    8, (input_height, input_width, input_channels, kernel_height, kernel_width, out_channels, out_height, out_width))
+
+XA_NNLIB_TRACE_WRAP(163, xa_nn_conv2d_std_v2_act_per_chan_sym8sxasym8s,
+    (WORD8* __restrict__ p_out, const WORD8* __restrict__ p_inp, const WORD8* __restrict__ p_kernel, const WORD32* __restrict__ p_bias, WORD32 input_height, WORD32 input_width, WORD32 input_channels, WORD32 kernel_height, WORD32 kernel_width, WORD32 out_channels, WORD32 x_stride, WORD32 y_stride, WORD32 x_padding, WORD32 y_padding, WORD32 out_height, WORD32 out_width, WORD32 input_zero_bias, WORD32 * p_out_multiplier, WORD32 * p_out_shift, WORD32 out_zero_bias, WORD32 out_data_format, VOID *p_scratch, WORD32 out_activation_min, WORD32 out_activation_max, const xa_nn_act_cfg_t *p_act_cfg, xa_dma_cfg_t *p_dma_cfg),
+    (p_out, p_inp, p_kernel, p_bias, input_height, input_width, input_channels, kernel_height, kernel_width, out_channels, x_stride, y_stride, x_padding, y_padding, out_height, out_width, input_zero_bias, p_out_multiplier, p_out_shift, out_zero_bias, out_data_format, p_scratch, out_activation_min, out_activation_max, p_act_cfg, p_dma_cfg),
+    8, (input_height, input_width, input_channels, kernel_height, kernel_width, out_channels, out_height, out_width))
+
+XA_NNLIB_TRACE_WRAP(164, xa_nn_conv2d_std_v2_pad_per_chan_sym8sxasym8s,
+    (WORD8* __restrict__ p_out, const WORD8* __restrict__ p_inp, const WORD8* __restrict__ p_kernel, const WORD32* __restrict__ p_bias, WORD32 input_height, WORD32 input_width, WORD32 input_channels, WORD32 kernel_height, WORD32 kernel_width, WORD32 out_channels, WORD32 x_stride, WORD32 y_stride, WORD32 x_padding, WORD32 y_padding, WORD32 out_height, WORD32 out_width, WORD32 input_zero_bias, WORD32 * p_out_multiplier, WORD32 * p_out_shift, WORD32 out_zero_bias, WORD32 out_data_format, VOID *p_scratch, WORD32 out_activation_min, WORD32 out_activation_max, const xa_nn_pad_cfg_t *p_pad_cfg, xa_dma_cfg_t *p_dma_cfg),
+    (p_out, p_inp, p_kernel, p_bias, input_height, input_width, input_channels, kernel_height, kernel_width, out_channels, x_stride, y_stride, x_padding, y_padding, out_height, out_width, input_zero_bias, p_out_multiplier, p_out_shift, out_zero_bias, out_data_format, p_scratch, out_activation_min, out_activation_max, p_pad_cfg, p_dma_cfg),
+    8, (input_height, input_width, input_channels, kernel_height, kernel_width, out_channels, out_height, out_width))
+
+#if HAVE_VFPU
+XA_NNLIB_TRACE_WRAP(165, xa_nn_conv2d_std_v2_f32io_per_chan_sym8sxasym8s,
+    (pVOID __restrict__ p_out, const FLOAT32* __restrict__ p_inp, const WORD8* __restrict__ p_kernel, const WORD32* __restrict__ p_bias, WORD32 input_height, WORD32 input_width, WORD32 input_channels, WORD32 kernel_height, WORD32 kernel_width, WORD32 out_channels, WORD32 x_stride, WORD32 y_stride, WORD32 x_padding, WORD32 y_padding, WORD32 out_height, WORD32 out_width, WORD32 input_zero_bias, WORD32 * p_out_multiplier, WORD32 * p_out_shift, WORD32 out_zero_bias, VOID *p_scratch, WORD32 out_activation_min, WORD32 out_activation_max, const xa_nn_f32io_cfg_t *p_io_cfg),
+    (p_out, p_inp, p_kernel, p_bias, input_height, input_width, input_channels, kernel_height, kernel_width, out_channels, x_stride, y_stride, x_padding, y_padding, out_height, out_width, input_zero_bias, p_out_multiplier, p_out_shift, out_zero_bias, p_scratch, out_activation_min, out_activation_max, p_io_cfg),
+    8, (input_height, input_width, input_channels, kernel_height, kernel_width, out_channels, out_height, out_width))
+#endif
+
+XA_NNLIB_TRACE_WRAP(166, xa_nn_conv2d_std_v2_pool_per_chan_sym8sxasym8s,
+    (WORD8* __restrict__ p_out, const WORD8* __restrict__ p_inp, const WORD8* __restrict__ p_kernel, const WORD32* __restrict__ p_bias, WORD32 input_height, WORD32 input_width, WORD32 input_channels, WORD32 kernel_height, WORD32 kernel_width, WORD32 out_channels, WORD32 x_stride, WORD32 y_stride, WORD32 x_padding, WORD32 y_padding, WORD32 out_height, WORD32 out_width, WORD32 input_zero_bias, WORD32 * p_out_multiplier, WORD32 * p_out_shift, WORD32 out_zero_bias, WORD32 out_activation_min, WORD32 out_activation_max, WORD32 pool_type, WORD32 pool_height, WORD32 pool_width, WORD32 pool_x_stride, WORD32 pool_y_stride, WORD32 pool_x_padding, WORD32 pool_y_padding, WORD32 pool_out_height, WORD32 pool_out_width, VOID *p_scratch),
+    (p_out, p_inp, p_kernel, p_bias, input_height, input_width, input_channels, kernel_height, kernel_width, out_channels, x_stride, y_stride, x_padding, y_padding, out_height, out_width, input_zero_bias, p_out_multiplier, p_out_shift, out_zero_bias, out_activation_min, out_activation_max, pool_type, pool_height, pool_width, pool_x_stride, pool_y_stride, pool_x_padding, pool_y_padding, pool_out_height, pool_out_width, p_scratch),
+    8, (input_height, input_width, input_channels, kernel_height, kernel_width, out_channels, out_height, out_width))
+
+XA_NNLIB_TRACE_WRAP(167, xa_nn_conv2d_per_chan_sym8sxasym8s,
+    (WORD8* __restrict__ p_out, const WORD8* __restrict__ p_inp, const WORD8* __restrict__ p_kernel, const WORD32* __restrict__ p_bias, WORD32 input_height, WORD32 input_width, WORD32 input_channels, WORD32 kernel_height, WORD32 kernel_width, WORD32 kernel_channels, WORD32 dilation_height, WORD32 dilation_width, WORD32 out_channels, WORD32 x_stride, WORD32 y_stride, WORD32 x_padding, WORD32 y_padding, WORD32 out_height, WORD32 out_width, WORD32 input_zero_bias, WORD32 * p_out_multiplier, WORD32 * p_out_shift, WORD32 out_zero_bias, WORD32 out_data_format, VOID *p_scratch),
+    (p_out, p_inp, p_kernel, p_bias, input_height, input_width, input_channels, kernel_height, kernel_width, kernel_channels, dilation_height, dilation_width, out_channels, x_stride, y_stride, x_padding, y_padding, out_height, out_width, input_zero_bias, p_out_multiplier, p_out_shift, out_zero_bias, out_data_format, p_scratch),
+    8, (input_height, input_width, input_channels, kernel_height, kernel_width, kernel_channels, out_channels, out_height))
+
+XA_NNLIB_TRACE_WRAP(168, xa_nn_conv2d_v2_per_chan_sym8sxasym8s,
+    (WORD8* __restrict__ p_out, const WORD8* __restrict__ p_inp, const WORD8* __restrict__ p_kernel, const WORD32* __restrict__ p_bias, WORD32 input_height, WORD32 input_width, WORD32 input_channels, WORD32 kernel_height, WORD32 kernel_width, WORD32 kernel_channels, WORD32 dilation_height, WORD32 dilation_width, WORD32 out_channels, WORD32 x_stride, WORD32 y_stride, WORD32 x_padding, WORD32 y_padding, WORD32 out_height, WORD32 out_width, WORD32 input_zero_bias, WORD32 * p_out_multiplier, WORD32 * p_out_shift, WORD32 out_zero_bias, WORD32 out_data_format, VOID *p_scratch, WORD32 out_activation_min, WORD32 out_activation_max, xa_dma_cfg_t *p_dma_cfg),
+    (p_out, p_inp, p_kernel, p_bias, input_height, input_width, input_channels, kernel_height, kernel_width, kernel_channels, dilation_height, dilation_width, out_channels, x_stride, y_stride, x_padding, y_padding, out_height, out_width, input_zero_bias, p_out_multiplier, p_out_shift, out_zero_bias, out_data_format, p_scratch, out_activation_min, out_activation_max, p_dma_cfg),
+    8, (input_height, input_width, input_channels, kernel_height, kernel_width, kernel_channels, out_channels, out_height))
+
+XA_NNLIB_TRACE_WRAP(169, xa_nn_conv2d_v2_pad_per_chan_sym8sxasym8s,
+    (WORD8* __restrict__ p_out, const WORD8* __restrict__ p_inp, const WORD8* __restrict__ p_kernel, const WORD32* __restrict__ p_bias, WORD32 input_height, WORD32 input_width, WORD32 input_channels, WORD32 kernel_height, WORD32 kernel_width, WORD32 kernel_channels, WORD32 dilation_height, WORD32 dilation_width, WORD32 out_channels, WORD32 x_stride, WORD32 y_stride, WORD32 x_padding, WORD32 y_padding, WORD32 out_height, WORD32 out_width, WORD32 input_zero_bias, WORD32 * p_out_multiplier, WORD32 * p_out_shift, WORD32 out_zero_bias, WORD32 out_data_format, VOID *p_scratch, WORD32 out_activation_min, WORD32 out_activation_max, const xa_nn_pad_cfg_t *p_pad_cfg, xa_dma_cfg_t *p_dma_cfg),
+    (p_out, p_inp, p_kernel, p_bias, input_height, input_width, input_channels, kernel_height, kernel_width, kernel_channels, dilation_height, dilation_width, out_channels, x_stride, y_stride, x_padding, y_padding, out_height, out_width, input_zero_bias, p_out_multiplier, p_out_shift, out_zero_bias, out_data_format, p_scratch, out_activation_min, out_activation_max, p_pad_cfg, p_dma_cfg),
+    8, (input_height, input_width, input_channels, kernel_height, kernel_width, kernel_channels, out_channels, out_height))
+
+XA_NNLIB_TRACE_WRAP(170, xa_nn_conv2d_std_per_chan_sym4sxasym8s,
+    (WORD8* __restrict__ p_out, const WORD8* __restrict__ p_inp, const WORD8* __restrict__ p_kernel, const WORD32* __restrict__ p_bias, WORD32 input_height, WORD32 input_width, WORD32 input_channels, WORD32 kernel_height, WORD32 kernel_width, WORD32 out_channels, WORD32 x_stride, WORD32 y_stride, WORD32 x_padding, WORD32 y_padding, WORD32 out_height, WORD32 out_width, WORD32 input_zero_bias, WORD32 * p_out_multiplier, WORD32 * p_out_shift, WORD32 out_zero_bias, WORD32 out_data_format, VOID *p_scratch),
+    (p_out, p_inp, p_kernel, p_bias, input_height, input_width, input_channels, kernel_height, kernel_width, out_channels, x_stride, y_stride, x_padding, y_padding, out_height, out_width, input_zero_bias, p_out_multiplier, p_out_shift, out_zero_bias, out_data_format, p_scratch),
+    8, (input_height, input_width, input_channels, kernel_height, kernel_width, out_channels, out_height, out_width))
+
+XA_NNLIB_TRACE_WRAP(171, xa_nn_conv2d_std_prepack_sym4s,
+    (WORD8* __restrict__ p_kernel_packed, const WORD8* __restrict__ p_kernel, WORD32 input_channels, WORD32 kernel_height, WORD32 kernel_width, WORD32 out_channels),
+    (p_kernel_packed, p_kernel, input_channels, kernel_height, kernel_width, out_channels),
+    4, (input_channels, kernel_height, kernel_width, out_channels))
+
+XA_NNLIB_TRACE_WRAP(172, xa_nn_conv2d_std_prepacked_per_chan_sym4sxasym8s,
+    (WORD8* __restrict__ p_out, const WORD8* __restrict__ p_inp, const WORD8* __restrict__ p_kernel, const WORD32* __restrict__ p_bias, WORD32 input_height, WORD32 input_width, WORD32 input_channels, WORD32 kernel_height, WORD32 kernel_width, WORD32 out_channels, WORD32 x_stride, WORD32 y_stride, WORD32 x_padding, WORD32 y_padding, WORD32 out_height, WORD32 out_width, WORD32 input_zero_bias, WORD32 * p_out_multiplier, WORD32 * p_out_shift, WORD32 out_zero_bias, WORD32 out_data_format, VOID *p_scratch),
+    (p_out, p_inp, p_kernel, p_bias, input_height, input_width, input_channels, kernel_height, kernel_width, out_channels, x_stride, y_stride, x_padding, y_padding, out_height, out_width, input_zero_bias, p_out_multiplier, p_out_shift, out_zero_bias, out_data_format, p_scratch),
+    8, (input_height, input_width, input_channels, kernel_height, kernel_width, out_channels, out_height, out_width))
+
+XA_NNLIB_TRACE_WRAP(173, xa_nn_dilated_conv2d_std_v2_per_chan_sym8sxasym8s,
+    (WORD8* __restrict__ p_out, const WORD8* __restrict__ p_inp, const WORD8* __restrict__ p_kernel, const WORD32* __restrict__ p_bias, WORD32 input_height, WORD32 input_width, WORD32 input_channels, WORD32 kernel_height, WORD32 kernel_width, WORD32 out_channels, WORD32 x_stride, WORD32 y_stride, WORD32 x_padding, WORD32 y_padding, WORD32 out_height, WORD32 out_width, WORD32 input_zero_bias, WORD32 * p_out_multiplier, WORD32 * p_out_shift, WORD32 out_zero_bias, WORD32 out_data_format, VOID *p_scratch, WORD32 dilation_height, WORD32 dilation_width, WORD32 out_activation_min, WORD32 out_activation_max, xa_dma_cfg_t *p_dma_cfg),
+    (p_out, p_inp, p_kernel, p_bias, input_height, input_width, input_channels, kernel_height, kernel_width, out_channels, x_stride, y_stride, x_padding, y_padding, out_height, out_width, input_zero_bias, p_out_multiplier, p_out_shift, out_zero_bias, out_data_format, p_scratch, dilation_height, dilation_width, out_activation_min, out_activation_max, p_dma_cfg),
+    8, (input_height, input_width, input_channels, kernel_height, kernel_width, out_channels, out_height, out_width))
+
+XA_NNLIB_TRACE_WRAP(174, xa_nn_dilated_conv2d_std_per_chan_sym8sxasym8s,
+    (WORD8* __restrict__ p_out, const WORD8* __restrict__ p_inp, const WORD8* __restrict__ p_kernel, const WORD32* __restrict__ p_bias, WORD32 input_height, WORD32 input_width, WORD32 input_channels, WORD32 kernel_height, WORD32 kernel_width, WORD32 out_channels, WORD32 x_stride, WORD32 y_stride, WORD32 x_padding, WORD32 y_padding, WORD32 out_height, WORD32 out_width, WORD32 input_zero_bias, WORD32 * p_out_multiplier, WORD32 * p_out_shift, WORD32 out_zero_bias, WORD32 out_data_format, VOID *p_scratch, WORD32 dilation_height, WORD32 dilation_width),
+    (p_out, p_inp, p_kernel, p_bias, input_height, input_width, input_channels, kernel_height, kernel_width, out_channels, x_stride, y_stride, x_padding, y_padding, out_height, out_width, input_zero_bias, p_out_multiplier, p_out_shift, out_zero_bias, out_data_format, p_scratch, dilation_height, dilation_width),
+    8, (input_height, input_width, input_channels, kernel_height, kernel_width, out_channels, out_height, out_width))
+
+XA_NNLIB_TRACE_WRAP(175, xa_nn_matXvec_batch_asym8uxasym8u_asym8u,
+    (UWORD8 ** __restrict__ p_out, UWORD8 * __restrict__ p_mat1, UWORD8 ** __restrict__ p_vec1, WORD32 * __restrict__ p_bias, WORD32 rows, WORD32 cols1, WORD32 row_stride1, WORD32 vec_count, WORD32 mat1_zero_bias, WORD32 vec1_zero_bias, WORD32 out_multiplier, WORD32 out_shift, WORD32 out_zero_bias),
+    (p_out, p_mat1, p_vec1, p_bias, rows, cols1, row_stride1, vec_count, mat1_zero_bias, vec1_zero_bias, out_multiplier, out_shift, out_zero_bias),
+    3, (rows, cols1, vec_count))
+
+XA_NNLIB_TRACE_WRAP(176, xa_nn_matmul_asym8uxasym8u_asym8u,
+    (UWORD8 * __restrict__ p_out, const UWORD8 * __restrict__ p_mat1, const UWORD8 * __restrict__ p_mat2, const WORD32 * __restrict__ p_bias, WORD32 rows, WORD32 cols, WORD32 row_stride, WORD32 vec_count, WORD32 vec_offset, WORD32 out_offset, WORD32 out_stride, WORD32 mat1_zero_bias, WORD32 vec1_zero_bias, WORD32 out_multiplier, WORD32 out_shift, WORD32 out_zero_bias),
+    (p_out, p_mat1, p_mat2, p_bias, rows, cols, row_stride, vec_count, vec_offset, out_offset, out_stride, mat1_zero_bias, vec1_zero_bias, out_multiplier, out_shift, out_zero_bias),
+    3, (rows, cols, vec_count))
+
+XA_NNLIB_TRACE_WRAP(177, xa_nn_matmul_asym8sxasym8s_asym8s,
+    (WORD8 * __restrict__ p_out, const WORD8 * __restrict__ p_mat1, const WORD8 * __restrict__ p_mat2, const WORD32 * __restrict__ p_bias, WORD32 rows, WORD32 cols, WORD32 row_stride, WORD32 vec_count, WORD32 vec_offset, WORD32 out_offset, WORD32 out_stride, WORD32 mat1_zero_bias, WORD32 vec1_zero_bias, WORD32 out_multiplier, WORD32 out_shift, WORD32 out_zero_bias),
+    (p_out, p_mat1, p_mat2, p_bias, rows, cols, row_stride, vec_count, vec_offset, out_offset, out_stride, mat1_zero_bias, vec1_zero_bias, out_multiplier, out_shift, out_zero_bias),
+    3, (rows, cols, vec_count))
+
+XA_NNLIB_TRACE_WRAP(178, xa_nn_matmul_v2_asym8sxasym8s_asym8s,
+    (WORD8 * __restrict__ p_out, const WORD8 * __restrict__ p_mat1, const WORD8 * __restrict__ p_mat2, const WORD32 * __restrict__ p_bias, WORD32 rows, WORD32 cols, WORD32 row_stride, WORD32 vec_count, WORD32 vec_offset, WORD32 out_offset, WORD32 out_stride, WORD32 mat1_zero_bias, WORD32 vec1_zero_bias, WORD32 out_multiplier, WORD32 out_shift, WORD32 out_zero_bias, WORD32 out_activation_min, WORD32 out_activation_max, xa_dma_cfg_t *p_dma_cfg),
+    (p_out, p_mat1, p_mat2, p_bias, rows, cols, row_stride, vec_count, vec_offset, out_offset, out_stride, mat1_zero_bias, vec1_zero_bias, out_multiplier, out_shift, out_zero_bias, out_activation_min, out_activation_max, p_dma_cfg),
+    3, (rows, cols, vec_count))
+
+XA_NNLIB_TRACE_WRAP(179, xa_nn_matmul_asym4sxasym8s_asym8s,
+    (WORD8 * __restrict__ p_out, const WORD8 * __restrict__ p_mat1, const WORD8 * __restrict__ p_mat2, const WORD32 * __restrict__ p_bias, WORD32 rows, WORD32 cols, WORD32 row_stride, WORD32 vec_count, WORD32 vec_offset, WORD32 out_offset, WORD32 out_stride, WORD32 mat1_zero_bias, WORD32 vec1_zero_bias, WORD32 out_multiplier, WORD32 out_shift, WORD32 out_zero_bias, void * pscratch),
+    (p_out, p_mat1, p_mat2, p_bias, rows, cols, row_stride, vec_count, vec_offset, out_offset, out_stride, mat1_zero_bias, vec1_zero_bias, out_multiplier, out_shift, out_zero_bias, pscratch),
+    3, (rows, cols, vec_count))
+
+XA_NNLIB_TRACE_WRAP(180, xa_nn_matmul_per_chan_sym8sxasym8s_asym8s,
+    (WORD8 * __restrict__ p_out, const WORD8 * __restrict__ p_mat1, const WORD8 * __restrict__ p_vec1, const WORD32 * __restrict__ p_bias, WORD32 rows, WORD32 cols1, WORD32 row_stride1, WORD32 vec_count, WORD32 vec_offset, WORD32 out_offset, WORD32 out_stride, WORD32 vec1_zero_bias, const WORD32* __restrict__ p_out_multiplier, const WORD32* __restrict__ p_out_shift, WORD32 out_zero_bias),
+    (p_out, p_mat1, p_vec1, p_bias, rows, cols1, row_stride1, vec_count, vec_offset, out_offset, out_stride, vec1_zero_bias, p_out_multiplier, p_out_shift, out_zero_bias),
+    3, (rows, cols1, vec_count))
+
+XA_NNLIB_TRACE_WRAP(181, xa_nn_matmul_v2_per_chan_sym8sxasym8s_asym8s,
+    (WORD8 * __restrict__ p_out, const WORD8 * __restrict__ p_mat1, const WORD8 * __restrict__ p_vec1, const WORD32 * __restrict__ p_bias, WORD32 rows, WORD32 cols1, WORD32 row_stride1, WORD32 vec_count, WORD32 vec_offset, WORD32 out_offset, WORD32 out_stride, WORD32 vec1_zero_bias, const WORD32* __restrict__ p_out_multiplier, const WORD32* __restrict__ p_out_shift, WORD32 out_zero_bias, WORD32 out_activation_min, WORD32 out_activation_max, xa_dma_cfg_t *p_dma_cfg),
+    (p_out, p_mat1, p_vec1, p_bias, rows, cols1, row_stride1, vec_count, vec_offset, out_offset, out_stride, vec1_zero_bias, p_out_multiplier, p_out_shift, out_zero_bias, out_activation_min, out_activation_max, p_dma_cfg),
+    3, (rows, cols1, vec_count))
+
+XA_NNLIB_TRACE_WRAP(182, xa_nn_matmul_v2_slice_per_chan_sym8sxasym8s_asym8s,
+    (WORD8 * __restrict__ p_out, const WORD8 * __restrict__ p_mat1, const WORD8 * __restrict__ p_vec1, const WORD32 * __restrict__ p_bias, WORD32 rows, WORD32 cols1, WORD32 row_stride1, WORD32 vec_count, WORD32 vec_offset, WORD32 out_offset, WORD32 out_stride, WORD32 vec1_zero_bias, const WORD32* __restrict__ p_out_multiplier, const WORD32* __restrict__ p_out_shift, WORD32 out_zero_bias, WORD32 out_activation_min, WORD32 out_activation_max, WORD32 row_start, WORD32 row_end, WORD32 vec_start, WORD32 vec_end, xa_dma_cfg_t *p_dma_cfg),
+    (p_out, p_mat1, p_vec1, p_bias, rows, cols1, row_stride1, vec_count, vec_offset, out_offset, out_stride, vec1_zero_bias, p_out_multiplier, p_out_shift, out_zero_bias, out_activation_min, out_activation_max, row_start, row_end, vec_start, vec_end, p_dma_cfg),
+    3, (rows, cols1, vec_count))
+
+XA_NNLIB_TRACE_WRAP(183, xa_nn_matmul_per_chan_sym8sxsym16s_sym16s,
+    (WORD16 * __restrict__ p_out, const WORD8 * __restrict__ p_mat1, const WORD16 * __restrict__ p_vec1, const WORD64 * __restrict__ p_bias, WORD32 rows, WORD32 cols1, WORD32 row_stride1, WORD32 vec_count, WORD32 vec_offset, WORD32 out_offset, WORD32 out_stride, WORD32 vec1_zero_bias, const WORD32* __restrict__ p_out_multiplier, const WORD32* __restrict__ p_out_shift, WORD32 out_zero_bias),
+    (p_out, p_mat1, p_vec1, p_bias, rows, cols1, row_stride1, vec_count, vec_offset, out_offset, out_stride, vec1_zero_bias, p_out_multiplier, p_out_shift, out_zero_bias),
+    3, (rows, cols1, vec_count))
+
+XA_NNLIB_TRACE_WRAP(184, xa_nn_matmul_sym8sxsym16s_sym16s,
+    (WORD16 * __restrict__ p_out, const WORD8 * __restrict__ p_mat1, const WORD16 * __restrict__ p_vec1, const WORD64 * __restrict__ p_bias, WORD32 rows, WORD32 cols1, WORD32 row_stride1, WORD32 vec_count, WORD32 vec_offset, WORD32 out_offset, WORD32 out_stride, WORD32 vec1_zero_bias, WORD32 out_multiplier, WORD32 out_shift, WORD32 out_zero_bias),
+    (p_out, p_mat1, p_vec1, p_bias, rows, cols1, row_stride1, vec_count, vec_offset, out_offset, out_stride, vec1_zero_bias, out_multiplier, out_shift, out_zero_bias),
+    3, (rows, cols1, vec_count))
+
+XA_NNLIB_TRACE_WRAP(185, xa_nn_matmul_v2_sym8sxsym16s_sym16s,
+    (WORD16 * __restrict__ p_out, const WORD8 * __restrict__ p_mat1, const WORD16 * __restrict__ p_vec1, const WORD64 * __restrict__ p_bias, WORD32 rows, WORD32 cols1, WORD32 row_stride1, WORD32 vec_count, WORD32 vec_offset, WORD32 out_offset, WORD32 out_stride, WORD32 vec1_zero_bias, WORD32 out_multiplier, WORD32 out_shift, WORD32 out_zero_bias, WORD32 out_activation_min, WORD32 out_activation_max, xa_dma_cfg_t *p_dma_cfg),
+    (p_out, p_mat1, p_vec1, p_bias, rows, cols1, row_stride1, vec_count, vec_offset, out_offset, out_stride, vec1_zero_bias, out_multiplier, out_shift, out_zero_bias, out_activation_min, out_activation_max, p_dma_cfg),
+    3, (rows, cols1, vec_count))
+
+XA_NNLIB_TRACE_WRAP(186, xa_nn_attention_getsize,
+    (WORD32 head_dim, WORD32 block_size, WORD32 precision),
+    (head_dim, block_size, precision),
+    0, (0))
+
+XA_NNLIB_TRACE_WRAP(187, xa_nn_attention_asym8s,
+    (WORD8 * __restrict__ p_out, const WORD8 * __restrict__ p_q, const WORD8 * __restrict__ p_k, const WORD8 * __restrict__ p_v, WORD32 num_heads, WORD32 num_kv_heads, WORD32 q_len, WORD32 kv_len, WORD32 head_dim, const xa_nn_attention_params_t *p_params, VOID *p_scratch),
+    (p_out, p_q, p_k, p_v, num_heads, num_kv_heads, q_len, kv_len, head_dim, p_params, p_scratch),
+    0, (0))
+
+XA_NNLIB_TRACE_WRAP(188, xa_nn_attention_sym16s,
+    (WORD16 * __restrict__ p_out, const WORD16 * __restrict__ p_q, const WORD16 * __restrict__ p_k, const WORD16 * __restrict__ p_v, WORD32 num_heads, WORD32 num_kv_heads, WORD32 q_len, WORD32 kv_len, WORD32 head_dim, const xa_nn_attention_params_t *p_params, VOID *p_scratch),
+    (p_out, p_q, p_k, p_v, num_heads, num_kv_heads, q_len, kv_len, head_dim, p_params, p_scratch),
+    0, (0))
+
+XA_NNLIB_TRACE_WRAP(189, xa_nn_kv_cache_append_asym8s,
+    (xa_nn_kv_cache_t *p_cache, const WORD8 * __restrict__ p_k, const WORD8 * __restrict__ p_v, WORD32 num_tokens),
+    (p_cache, p_k, p_v, num_tokens),
+    0, (0))
+
+XA_NNLIB_TRACE_WRAP(190, xa_nn_kv_cache_append_sym16s,
+    (xa_nn_kv_cache_t *p_cache, const WORD16 * __restrict__ p_k, const WORD16 * __restrict__ p_v, WORD32 num_tokens),
+    (p_cache, p_k, p_v, num_tokens),
+    0, (0))
+
+XA_NNLIB_TRACE_WRAP(191, xa_nn_kv_cache_attend_asym8s,
+    (WORD8 * __restrict__ p_out, const WORD8 * __restrict__ p_q, const xa_nn_kv_cache_t *p_cache, WORD32 num_heads, const xa_nn_attention_params_t *p_params, VOID *p_scratch),
+    (p_out, p_q, p_cache, num_heads, p_params, p_scratch),
+    0, (0))
+
+XA_NNLIB_TRACE_WRAP(192, xa_nn_kv_cache_attend_sym16s,
+    (WORD16 * __restrict__ p_out, const WORD16 * __restrict__ p_q, const xa_nn_kv_cache_t *p_cache, WORD32 num_heads, const xa_nn_attention_params_t *p_params, VOID *p_scratch),
+    (p_out, p_q, p_cache, num_heads, p_params, p_scratch),
+    0, (0))
+
+XA_NNLIB_TRACE_WRAP(193, xa_nn_batch_matmul_getsize,
+    (const WORD32 *const p_mat1_shape, const WORD32 *const p_mat2_shape, WORD32 mat1_transpose, WORD32 mat2_transpose, WORD32 mat1_precision, WORD32 mat2_precision),
+    (p_mat1_shape, p_mat2_shape, mat1_transpose, mat2_transpose, mat1_precision, mat2_precision),
+    0, (0))
+
+XA_NNLIB_TRACE_WRAP(194, xa_nn_batch_matmul_asym8sxasym8s_asym8s,
+    (WORD8 * __restrict__ p_out, const WORD32 *const p_out_shape, const WORD8 * __restrict__ p_mat1, const WORD32 *const p_mat1_shape, const WORD8 * __restrict__ p_mat2, const WORD32 *const p_mat2_shape, WORD32 mat1_transpose, WORD32 mat2_transpose, WORD32 mat1_zero_bias, WORD32 mat2_zero_bias, WORD32 out_multiplier, WORD32 out_shift, WORD32 out_zero_bias, VOID *p_scratch),
+    (p_out, p_out_shape, p_mat1, p_mat1_shape, p_mat2, p_mat2_shape, mat1_transpose, mat2_transpose, mat1_zero_bias, mat2_zero_bias, out_multiplier, out_shift, out_zero_bias, p_scratch),
+    0, (0))
+
+XA_NNLIB_TRACE_WRAP(195, xa_nn_batch_matmul_sym16sxsym16s_sym16s,
+    (WORD16 * __restrict__ p_out, const WORD32 *const p_out_shape, const WORD16 * __restrict__ p_mat1, const WORD32 *const p_mat1_shape, const WORD16 * __restrict__ p_mat2, const WORD32 *const p_mat2_shape, WORD32 mat1_transpose, WORD32 mat2_transpose, WORD32 mat1_zero_bias, WORD32 mat2_zero_bias, WORD32 out_multiplier, WORD32 out_shift, WORD32 out_zero_bias, VOID *p_scratch),
+    (p_out, p_out_shape, p_mat1, p_mat1_shape, p_mat2, p_mat2_shape, mat1_transpose, mat2_transpose, mat1_zero_bias, mat2_zero_bias, out_multiplier, out_shift, out_zero_bias, p_scratch),
+    0, (0))
+
+XA_NNLIB_TRACE_WRAP(196, xa_nn_batch_matmul_rope_sym16sxsym16s_sym16s,
+    (WORD16 * __restrict__ p_out, const WORD32 *const p_out_shape, const WORD16 * __restrict__ p_mat1, const WORD32 *const p_mat1_shape, const WORD16 * __restrict__ p_mat2, const WORD32 *const p_mat2_shape, WORD32 mat1_transpose, WORD32 mat2_transpose, WORD32 mat1_zero_bias, WORD32 mat2_zero_bias, WORD32 out_multiplier, WORD32 out_shift, WORD32 out_zero_bias, const xa_nn_rope_cfg_t *p_rope, VOID *p_scratch),
+    (p_out, p_out_shape, p_mat1, p_mat1_shape, p_mat2, p_mat2_shape, mat1_transpose, mat2_transpose, mat1_zero_bias, mat2_zero_bias, out_multiplier, out_shift, out_zero_bias, p_rope, p_scratch),
+    0, (0))
+
+XA_NNLIB_TRACE_WRAP(197, xa_nn_rope_sym16s_sym16s,
+    (WORD16 *p_out, const WORD16 *p_inp, const WORD16 * __restrict__ p_cos, const WORD16 * __restrict__ p_sin, WORD32 num_heads, WORD32 seq_len, WORD32 head_dim, WORD32 pos_offset, WORD32 interleaved),
+    (p_out, p_inp, p_cos, p_sin, num_heads, seq_len, head_dim, pos_offset, interleaved),
+    0, (0))
+
+XA_NNLIB_TRACE_WRAP(198, xa_nn_rope_f32_f32,
+    (FLOAT32 *p_out, const FLOAT32 *p_inp, const FLOAT32 * __restrict__ p_cos, const FLOAT32 * __restrict__ p_sin, WORD32 num_heads, WORD32 seq_len, WORD32 head_dim, WORD32 pos_offset, WORD32 interleaved),
+    (p_out, p_inp, p_cos, p_sin, num_heads, seq_len, head_dim, pos_offset, interleaved),
+    0, (0))
+
+XA_NNLIB_TRACE_WRAP(199, xa_nn_conv2d_depthwise_asym8uxasym8u,
+    (pUWORD8 __restrict__ p_out, const UWORD8 *__restrict__ p_kernel, const UWORD8 *__restrict__ p_inp, const WORD32 *__restrict__ p_bias, WORD32 input_height, WORD32 input_width, WORD32 input_channels, WORD32 kernel_height, WORD32 kernel_width, WORD32 channels_multiplier, WORD32 x_stride, WORD32 y_stride, WORD32 x_padding, WORD32 y_padding, WORD32 out_height, WORD32 out_width, WORD32 input_zero_bias, WORD32 kernel_zero_bias, WORD32 out_multiplier, WORD32 out_shift, WORD32 out_zero_bias, WORD32 inp_data_format, WORD32 out_data_format, pVOID p_scratch),
+    (p_out, p_kernel, p_inp, p_bias, input_height, input_width, input_channels, kernel_height, kernel_width, channels_multiplier, x_stride, y_stride, x_padding, y_padding, out_height, out_width, input_zero_bias, kernel_zero_bias, out_multiplier, out_shift, out_zero_bias, inp_data_format, out_data_format, p_scratch),
+    7, (input_height, input_width, input_channels, kernel_height, kernel_width, out_height, out_width))
+
+XA_NNLIB_TRACE_WRAP(200, xa_nn_conv2d_pointwise_asym8uxasym8u,
+    (pUWORD8 __restrict__ p_out ,pUWORD8 __restrict__ p_kernel ,pUWORD8 __restrict__ p_inp ,pWORD32 __restrict__ p_bias ,WORD32 input_height ,WORD32 input_width ,WORD32 input_channels ,WORD32 out_channels ,WORD32 input_zero_bias ,WORD32 kernel_zero_bias ,WORD32 out_multiplier ,WORD32 out_shift ,WORD32 out_zero_bias ,WORD32 out_data_format),
+    (p_out, p_kernel, p_inp, p_bias, input_height, input_width, input_channels, out_channels, input_zero_bias, kernel_zero_bias, out_multiplier, out_shift, out_zero_bias, out_data_format),
+    4, (input_height, input_width, input_channels, out_channels))
+
+XA_NNLIB_TRACE_WRAP(201, xa_nn_conv2d_depthwise_per_chan_sym8sxasym8s,
+    (pWORD8 __restrict__ p_out, const WORD8 *__restrict__ p_kernel, const WORD8 *__restrict__ p_inp, const WORD32 *__restrict__ p_bias, WORD32 input_height, WORD32 input_width, WORD32 input_channels, WORD32 kernel_height, WORD32 kernel_width, WORD32 channels_multiplier, WORD32 x_stride, WORD32 y_stride, WORD32 x_padding, WORD32 y_padding, WORD32 out_height, WORD32 out_width, WORD32 input_zero_bias, const WORD32 *p_out_multiplier, const WORD32 *p_out_shift, WORD32 out_zero_bias, WORD32 inp_data_format, WORD32 out_data_format, pVOID p_scratch),
+    (p_out, p_kernel, p_inp, p_bias, input_height, input_width, input_channels, kernel_height, kernel_width, channels_multiplier, x_stride, y_stride, x_padding, y_padding, out_height, out_width, input_zero_bias, p_out_multiplier, p_out_shift, out_zero_bias, inp_data_format, out_data_format, p_scratch),
+    7, (input_height, input_width, input_channels, kernel_height, kernel_width, out_height, out_width))
+
+XA_NNLIB_TRACE_WRAP(202, xa_nn_conv2d_depthwise_v2_per_chan_sym8sxasym8s,
+    (pWORD8 __restrict__ p_out, const WORD8 *__restrict__ p_kernel, const WORD8 *__restrict__ p_inp, const WORD32 *__restrict__ p_bias, WORD32 input_height, WORD32 input_width, WORD32 input_channels, WORD32 kernel_height, WORD32 kernel_width, WORD32 channels_multiplier, WORD32 x_stride, WORD32 y_stride, WORD32 x_padding, WORD32 y_padding, WORD32 out_height, WORD32 out_width, WORD32 input_zero_bias, const WORD32 *p_out_multiplier, const WORD32 *p_out_shift, WORD32 out_zero_bias, WORD32 inp_data_format, WORD32 out_data_format, pVOID p_scratch, WORD32 out_activation_min, WORD32 out_activation_max, xa_dma_cfg_t *p_dma_cfg),
+    (p_out, p_kernel, p_inp, p_bias, input_height, input_width, input_channels, kernel_height, kernel_width, channels_multiplier, x_stride, y_stride, x_padding, y_padding, out_height, out_width, input_zero_bias, p_out_multiplier, p_out_shift, out_zero_bias, inp_data_format, out_data_format, p_scratch, out_activation_min, out_activation_max, p_dma_cfg),
+    7, (input_height, input_width, input_channels, kernel_height, kernel_width, out_height, out_width))
+
+XA_NNLIB_TRACE_WRAP(203, xa_nn_conv2d_depthwise_v2_act_per_chan_sym8sxasym8s,
+    (pWORD8 __restrict__ p_out, const WORD8 *__restrict__ p_kernel, const WORD8 *__restrict__ p_inp, const WORD32 *__restrict__ p_bias, WORD32 input_height, WORD32 input_width, WORD32 input_channels, WORD32 kernel_height, WORD32 kernel_width, WORD32 channels_multiplier, WORD32 x_stride, WORD32 y_stride, WORD32 x_padding, WORD32 y_padding, WORD32 out_height, WORD32 out_width, WORD32 input_zero_bias, const WORD32 *p_out_multiplier, const WORD32 *p_out_shift, WORD32 out_zero_bias, WORD32 inp_data_format, WORD32 out_data_format, pVOID p_scratch, WORD32 out_activation_min, WORD32 out_activation_max, const xa_nn_act_cfg_t *p_act_cfg, xa_dma_cfg_t *p_dma_cfg),
+    (p_out, p_kernel, p_inp, p_bias, input_height, input_width, input_channels, kernel_height, kernel_width, channels_multiplier, x_stride, y_stride, x_padding, y_padding, out_height, out_width, input_zero_bias, p_out_multiplier, p_out_shift, out_zero_bias, inp_data_format, out_data_format, p_scratch, out_activation_min, out_activation_max, p_act_cfg, p_dma_cfg),
+    7, (input_height, input_width, input_channels, kernel_height, kernel_width, out_height, out_width))
+
+XA_NNLIB_TRACE_WRAP(204, xa_nn_conv2d_depthwise_v2_pad_per_chan_sym8sxasym8s,
+    (pWORD8 __restrict__ p_out, const WORD8 *__restrict__ p_kernel, const WORD8 *__restrict__ p_inp, const WORD32 *__restrict__ p_bias, WORD32 input_height, WORD32 input_width, WORD32 input_channels, WORD32 kernel_height, WORD32 kernel_width, WORD32 channels_multiplier, WORD32 x_stride, WORD32 y_stride, WORD32 x_padding, WORD32 y_padding, WORD32 out_height, WORD32 out_width, WORD32 input_zero_bias, const WORD32 *p_out_multiplier, const WORD32 *p_out_shift, WORD32 out_zero_bias, WORD32 inp_data_format, WORD32 out_data_format, pVOID p_scratch, WORD32 out_activation_min, WORD32 out_activation_max, const xa_nn_pad_cfg_t *p_pad_cfg, xa_dma_cfg_t *p_dma_cfg),
+    (p_out, p_kernel, p_inp, p_bias, input_height, input_width, input_channels, kernel_height, kernel_width, channels_multiplier, x_stride, y_stride, x_padding, y_padding, out_height, out_width, input_zero_bias, p_out_multiplier, p_out_shift, out_zero_bias, inp_data_format, out_data_format, p_scratch, out_activation_min, out_activation_max, p_pad_cfg, p_dma_cfg),
+    7, (input_height, input_width, input_channels, kernel_height, kernel_width, out_height, out_width))
+
+XA_NNLIB_TRACE_WRAP(205, xa_nn_dilated_conv2d_depthwise_per_chan_sym8sxasym8s,
+    (pWORD8 __restrict__ p_out ,const WORD8 *__restrict__ p_kernel ,const WORD8 *__restrict__ p_inp ,const WORD32 *__restrict__ p_bias ,WORD32 input_height ,WORD32 input_width ,WORD32 input_channels ,WORD32 kernel_height ,WORD32 kernel_width ,WORD32 channels_multiplier ,WORD32 dilation_height ,WORD32 dilation_width ,WORD32 x_stride ,WORD32 y_stride ,WORD32 x_padding ,WORD32 y_padding ,WORD32 out_height ,WORD32 out_width ,WORD32 input_zero_bias ,const WORD32 *p_out_multiplier ,const WORD32 *p_out_shift ,WORD32 out_zero_bias ,WORD32 inp_data_format ,WORD32 out_data_format ,pVOID p_scratch),
+    (p_out, p_kernel, p_inp, p_bias, input_height, input_width, input_channels, kernel_height, kernel_width, channels_multiplier, dilation_height, dilation_width, x_stride, y_stride, x_padding, y_padding, out_height, out_width, input_zero_bias, p_out_multiplier, p_out_shift, out_zero_bias, inp_data_format, out_data_format, p_scratch),
+    7, (input_height, input_width, input_channels, kernel_height, kernel_width, out_height, out_width))
+
+XA_NNLIB_TRACE_WRAP(206, xa_nn_dilated_conv2d_depthwise_v2_per_chan_sym8sxasym8s,
+    (pWORD8 __restrict__ p_out ,const WORD8 *__restrict__ p_kernel ,const WORD8 *__restrict__ p_inp ,const WORD32 *__restrict__ p_bias ,WORD32 input_height ,WORD32 input_width ,WORD32 input_channels ,WORD32 kernel_height ,WORD32 kernel_width ,WORD32 channels_multiplier ,WORD32 dilation_height ,WORD32 dilation_width ,WORD32 x_stride ,WORD32 y_stride ,WORD32 x_padding ,WORD32 y_padding ,WORD32 out_height ,WORD32 out_width ,WORD32 input_zero_bias ,const WORD32 *p_out_multiplier ,const WORD32 *p_out_shift ,WORD32 out_zero_bias ,WORD32 inp_data_format ,WORD32 out_data_format ,pVOID p_scratch ,WORD32 out_activation_min ,WORD32 out_activation_max ,xa_dma_cfg_t *p_dma_cfg),
+    (p_out, p_kernel, p_inp, p_bias, input_height, input_width, input_channels, kernel_height, kernel_width, channels_multiplier, dilation_height, dilation_width, x_stride, y_stride, x_padding, y_padding, out_height, out_width, input_zero_bias, p_out_multiplier, p_out_shift, out_zero_bias, inp_data_format, out_data_format, p_scratch, out_activation_min, out_activation_max, p_dma_cfg),
+    7, (input_height, input_width, input_channels, kernel_height, kernel_width, out_height, out_width))
+
+XA_NNLIB_TRACE_WRAP(207, xa_nn_conv2d_depthwise_per_chan_sym8sxsym16s,
+    (pWORD16 __restrict__ p_out ,const WORD8 *__restrict__ p_kernel ,const WORD16 *__restrict__ p_inp ,const WORD64 *__restrict__ p_bias ,WORD32 input_height ,WORD32 input_width ,WORD32 input_channels ,WORD32 kernel_height ,WORD32 kernel_width ,WORD32 channels_multiplier ,WORD32 x_stride ,WORD32 y_stride ,WORD32 x_padding ,WORD32 y_padding ,WORD32 out_height ,WORD32 out_width ,WORD32 input_zero_bias ,const WORD32 *p_out_multiplier ,const WORD32 *p_out_shift ,WORD32 out_zero_bias ,WORD32 inp_data_format ,WORD32 out_data_format ,pVOID p_scratch),
+    (p_out, p_kernel, p_inp, p_bias, input_height, input_width, input_channels, kernel_height, kernel_width, channels_multiplier, x_stride, y_stride, x_padding, y_padding, out_height, out_width, input_zero_bias, p_out_multiplier, p_out_shift, out_zero_bias, inp_data_format, out_data_format, p_scratch),
+    7, (input_height, input_width, input_channels, kernel_height, kernel_width, out_height, out_width))
+
+XA_NNLIB_TRACE_WRAP(208, xa_nn_conv2d_depthwise_v2_per_chan_sym8sxsym16s,
+    (pWORD16 __restrict__ p_out ,const WORD8 *__restrict__ p_kernel ,const WORD16 *__restrict__ p_inp ,const WORD64 *__restrict__ p_bias ,WORD32 input_height ,WORD32 input_width ,WORD32 input_channels ,WORD32 kernel_height ,WORD32 kernel_width ,WORD32 channels_multiplier ,WORD32 x_stride ,WORD32 y_stride ,WORD32 x_padding ,WORD32 y_padding ,WORD32 out_height ,WORD32 out_width ,WORD32 input_zero_bias ,const WORD32 *p_out_multiplier ,const WORD32 *p_out_shift ,WORD32 output_zero_bias ,WORD32 inp_data_format ,WORD32 out_data_format ,pVOID p_scratch ,WORD32 out_activation_min ,WORD32 out_activation_max ,xa_dma_cfg_t *p_dma_cfg),
+    (p_out, p_kernel, p_inp, p_bias, input_height, input_width, input_channels, kernel_height, kernel_width, channels_multiplier, x_stride, y_stride, x_padding, y_padding, out_height, out_width, input_zero_bias, p_out_multiplier, p_out_shift, output_zero_bias, inp_data_format, out_data_format, p_scratch, out_activation_min, out_activation_max, p_dma_cfg),
+    7, (input_height, input_width, input_channels, kernel_height, kernel_width, out_height, out_width))
+
+XA_NNLIB_TRACE_WRAP(209, xa_nn_dilated_conv2d_depthwise_v2_per_chan_sym8sxsym16s,
+    (pWORD16 __restrict__ p_out ,const WORD8 *__restrict__ p_kernel ,const WORD16 *__restrict__ p_inp ,const WORD64 *__restrict__ p_bias ,WORD32 input_height ,WORD32 input_width ,WORD32 input_channels ,WORD32 kernel_height ,WORD32 kernel_width ,WORD32 channels_multiplier ,WORD32 dilation_height ,WORD32 dilation_width ,WORD32 x_stride ,WORD32 y_stride ,WORD32 x_padding ,WORD32 y_padding ,WORD32 out_height ,WORD32 out_width ,WORD32 input_zero_bias ,const WORD32 *p_out_multiplier ,const WORD32 *p_out_shift ,WORD32 out_zero_bias ,WORD32 inp_data_format ,WORD32 out_data_format ,pVOID p_scratch ,WORD32 out_activation_min ,WORD32 out_activation_max ,xa_dma_cfg_t *p_dma_cfg),
+    (p_out, p_kernel, p_inp, p_bias, input_height, input_width, input_channels, kernel_height, kernel_width, channels_multiplier, dilation_height, dilation_width, x_stride, y_stride, x_padding, y_padding, out_height, out_width, input_zero_bias, p_out_multiplier, p_out_shift, out_zero_bias, inp_data_format, out_data_format, p_scratch, out_activation_min, out_activation_max, p_dma_cfg),
+    7, (input_height, input_width, input_channels, kernel_height, kernel_width, out_height, out_width))
+
+XA_NNLIB_TRACE_WRAP(210, xa_nn_conv2d_pointwise_per_chan_sym8sxasym8s,
+    (WORD8* __restrict__ p_out, WORD8* __restrict__ p_kernel, WORD8* __restrict__ p_inp, WORD32* __restrict__ p_bias, WORD32 input_height, WORD32 input_width, WORD32 input_channels, WORD32 out_channels, WORD32 input_zero_bias, WORD32* __restrict__ p_out_multiplier, WORD32* __restrict__ p_out_shift, WORD32 out_zero_bias, WORD32 out_data_format),
+    (p_out, p_kernel, p_inp, p_bias, input_height, input_width, input_channels, out_channels, input_zero_bias, p_out_multiplier, p_out_shift, out_zero_bias, out_data_format),
+    4, (input_height, input_width, input_channels, out_channels))
+
+XA_NNLIB_TRACE_WRAP(211, xa_nn_conv2d_pointwise_v2_per_chan_sym8sxasym8s,
+    (WORD8* __restrict__ p_out, WORD8* __restrict__ p_kernel, WORD8* __restrict__ p_inp, WORD32* __restrict__ p_bias, WORD32 input_height, WORD32 input_width, WORD32 input_channels, WORD32 out_channels, WORD32 input_zero_bias, WORD32* __restrict__ p_out_multiplier, WORD32* __restrict__ p_out_shift, WORD32 out_zero_bias, WORD32 out_data_format, WORD32 out_activation_min, WORD32 out_activation_max, xa_dma_cfg_t *p_dma_cfg),
+    (p_out, p_kernel, p_inp, p_bias, input_height, input_width, input_channels, out_channels, input_zero_bias, p_out_multiplier, p_out_shift, out_zero_bias, out_data_format, out_activation_min, out_activation_max, p_dma_cfg),
+    4, (input_height, input_width, input_channels, out_channels))
+
+XA_NNLIB_TRACE_WRAP(212, xa_nn_conv2d_pointwise_v2_slice_per_chan_sym8sxasym8s,
+    (WORD8* __restrict__ p_out, WORD8* __restrict__ p_kernel, WORD8* __restrict__ p_inp, WORD32* __restrict__ p_bias, WORD32 input_height, WORD32 input_width, WORD32 input_channels, WORD32 out_channels, WORD32 input_zero_bias, WORD32* __restrict__ p_out_multiplier, WORD32* __restrict__ p_out_shift, WORD32 out_zero_bias, WORD32 out_data_format, WORD32 out_activation_min, WORD32 out_activation_max, WORD32 out_row_start, WORD32 out_row_end, WORD32 out_ch_start, WORD32 out_ch_end, xa_dma_cfg_t *p_dma_cfg),
+    (p_out, p_kernel, p_inp, p_bias, input_height, input_width, input_channels, out_channels, input_zero_bias, p_out_multiplier, p_out_shift, out_zero_bias, out_data_format, out_activation_min, out_activation_max, out_row_start, out_row_end, out_ch_start, out_ch_end, p_dma_cfg),
+    4, (input_height, input_width, input_channels, out_channels))
+
+XA_NNLIB_TRACE_WRAP(213, xa_nn_conv2d_pointwise_v2_residual_per_chan_sym8sxasym8s,
+    (WORD8* __restrict__ p_out, WORD8* __restrict__ p_kernel, WORD8* __restrict__ p_inp, WORD32* __restrict__ p_bias, WORD32 input_height, WORD32 input_width, WORD32 input_channels, WORD32 out_channels, WORD32 input_zero_bias, WORD32* __restrict__ p_out_multiplier, WORD32* __restrict__ p_out_shift, WORD32 out_zero_bias, WORD32 out_data_format, WORD32 out_activation_min, WORD32 out_activation_max, const xa_nn_residual_cfg_t *p_res_cfg, xa_dma_cfg_t *p_dma_cfg),
+    (p_out, p_kernel, p_inp, p_bias, input_height, input_width, input_channels, out_channels, input_zero_bias, p_out_multiplier, p_out_shift, out_zero_bias, out_data_format, out_activation_min, out_activation_max, p_res_cfg, p_dma_cfg),
+    4, (input_height, input_width, input_channels, out_channels))
+
+XA_NNLIB_TRACE_WRAP(214, xa_nn_conv2d_pointwise_v2_act_per_chan_sym8sxasym8s,
+    (WORD8* __restrict__ p_out, WORD8* __restrict__ p_kernel, WORD8* __restrict__ p_inp, WORD32* __restrict__ p_bias, WORD32 input_height, WORD32 input_width, WORD32 input_channels, WORD32 out_channels, WORD32 input_zero_bias, WORD32* __restrict__ p_out_multiplier, WORD32* __restrict__ p_out_shift, WORD32 out_zero_bias, WORD32 out_data_format, WORD32 out_activation_min, WORD32 out_activation_max, const xa_nn_act_cfg_t *p_act_cfg, xa_dma_cfg_t *p_dma_cfg),
+    (p_out, p_kernel, p_inp, p_bias, input_height, input_width, input_channels, out_channels, input_zero_bias, p_out_multiplier, p_out_shift, out_zero_bias, out_data_format, out_activation_min, out_activation_max, p_act_cfg, p_dma_cfg),
+    4, (input_height, input_width, input_channels, out_channels))
+
+XA_NNLIB_TRACE_WRAP(354, xa_nn_conv2d_pointwise_v2_pool_per_chan_sym8sxasym8s,
+    (WORD8* __restrict__ p_out, WORD8* __restrict__ p_kernel, WORD8* __restrict__ p_inp, WORD32* __restrict__ p_bias, WORD32 input_height, WORD32 input_width, WORD32 input_channels, WORD32 out_channels, WORD32 input_zero_bias, WORD32* __restrict__ p_out_multiplier, WORD32* __restrict__ p_out_shift, WORD32 out_zero_bias, WORD32 out_activation_min, WORD32 out_activation_max, WORD32 pool_type, WORD32 pool_height, WORD32 pool_width, WORD32 pool_x_stride, WORD32 pool_y_stride, WORD32 pool_x_padding, WORD32 pool_y_padding, WORD32 pool_out_height, WORD32 pool_out_width, VOID *p_scratch),
+    (p_out, p_kernel, p_inp, p_bias, input_height, input_width, input_channels, out_channels, input_zero_bias, p_out_multiplier, p_out_shift, out_zero_bias, out_activation_min, out_activation_max, pool_type, pool_height, pool_width, pool_x_stride, pool_y_stride, pool_x_padding, pool_y_padding, pool_out_height, pool_out_width, p_scratch),
+    8, (input_height, input_width, input_channels, out_channels, pool_height, pool_width, pool_out_height, pool_out_width))
+
+XA_NNLIB_TRACE_WRAP(215, xa_nn_conv2d_depthwise_pointwise_v2_per_chan_sym8sxasym8s,
+    (WORD8* __restrict__ p_out, const WORD8* __restrict__ p_dw_kernel, const WORD8* __restrict__ p_pw_kernel, const WORD8* __restrict__ p_inp, const WORD32* __restrict__ p_dw_bias, const WORD32* __restrict__ p_pw_bias, WORD32 input_height, WORD32 input_width, WORD32 input_channels, WORD32 kernel_height, WORD32 kernel_width, WORD32 channels_multiplier, WORD32 x_stride, WORD32 y_stride, WORD32 x_padding, WORD32 y_padding, WORD32 out_height, WORD32 out_width, WORD32 out_channels, WORD32 input_zero_bias, const WORD32 *p_dw_out_multiplier, const WORD32 *p_dw_out_shift, WORD32 dw_out_zero_bias, WORD32 dw_out_activation_min, WORD32 dw_out_activation_max, WORD32 pw_input_zero_bias, const WORD32 *p_out_multiplier, const WORD32 *p_out_shift, WORD32 out_zero_bias, WORD32 out_data_format, WORD32 out_activation_min, WORD32 out_activation_max, WORD32 rows_per_block, pVOID p_scratch),
+    (p_out, p_dw_kernel, p_pw_kernel, p_inp, p_dw_bias, p_pw_bias, input_height, input_width, input_channels, kernel_height, kernel_width, channels_multiplier, x_stride, y_stride, x_padding, y_padding, out_height, out_width, out_channels, input_zero_bias, p_dw_out_multiplier, p_dw_out_shift, dw_out_zero_bias, dw_out_activation_min, dw_out_activation_max, pw_input_zero_bias, p_out_multiplier, p_out_shift, out_zero_bias, out_data_format, out_activation_min, out_activation_max, rows_per_block, p_scratch),
+    8, (input_height, input_width, input_channels, kernel_height, kernel_width, out_height, out_width, out_channels))
+
+XA_NNLIB_TRACE_WRAP(216, xa_nn_conv2d_pointwise_per_chan_sym8sxsym16s,
+    (WORD16* __restrict__ p_out, WORD8* __restrict__ p_kernel, WORD16* __restrict__ p_inp, WORD64* __restrict__ p_bias, WORD32 input_height, WORD32 input_width, WORD32 input_channels, WORD32 out_channels, WORD32 input_zero_bias, WORD32* __restrict__ p_out_multiplier, WORD32* __restrict__ p_out_shift, WORD32 out_zero_bias, WORD32 out_data_format),
+    (p_out, p_kernel, p_inp, p_bias, input_height, input_width, input_channels, out_channels, input_zero_bias, p_out_multiplier, p_out_shift, out_zero_bias, out_data_format),
+    4, (input_height, input_width, input_channels, out_channels))
+
+XA_NNLIB_TRACE_WRAP(217, xa_nn_conv2d_pointwise_v2_per_chan_sym8sxsym16s,
+    (WORD16* __restrict__ p_out, WORD8* __restrict__ p_kernel, WORD16* __restrict__ p_inp, WORD64* __restrict__ p_bias, WORD32 input_height, WORD32 input_width, WORD32 input_channels, WORD32 out_channels, WORD32 input_zero_bias, WORD32* __restrict__ p_out_multiplier, WORD32* __restrict__ p_out_shift, WORD32 out_zero_bias, WORD32 out_data_format, WORD32 out_activation_min, WORD32 out_activation_max, xa_dma_cfg_t *p_dma_cfg),
+    (p_out, p_kernel, p_inp, p_bias, input_height, input_width, input_channels, out_channels, input_zero_bias, p_out_multiplier, p_out_shift, out_zero_bias, out_data_format, out_activation_min, out_activation_max, p_dma_cfg),
+    4, (input_height, input_width, input_channels, out_channels))
+
+XA_NNLIB_TRACE_WRAP(218, xa_nn_matXvec_acc_batch_sym8sx8_asym16s,
+    (WORD16 * __restrict__ p_out, const WORD8 * __restrict__ p_mat1, const WORD8 * __restrict__ p_vec1, const WORD32 * __restrict__ p_bias, WORD32 rows, WORD32 cols1, WORD32 row_stride1, WORD32 out_multiplier, WORD32 out_shift, WORD32 out_zero_bias, WORD32 vec_count),
+    (p_out, p_mat1, p_vec1, p_bias, rows, cols1, row_stride1, out_multiplier, out_shift, out_zero_bias, vec_count),
+    3, (rows, cols1, vec_count))
+
+XA_NNLIB_TRACE_WRAP(219, xa_nn_matXvec_acc_batch_sym8sx8_asym16s_hU,
+    (WORD16 * __restrict__ p_out, const WORD8 * __restrict__ p_mat1, const WORD8 * __restrict__ p_vec1, const WORD32 * __restrict__ p_bias, WORD32 rows, WORD32 cols1, WORD32 row_stride1, WORD32 out_multiplier, WORD32 out_shift, WORD32 out_zero_bias, WORD32 vec_count),
+    (p_out, p_mat1, p_vec1, p_bias, rows, cols1, row_stride1, out_multiplier, out_shift, out_zero_bias, vec_count),
+    3, (rows, cols1, vec_count))
+
+XA_NNLIB_TRACE_WRAP(220, xa_nn_elm_mul_f32xf32_f32,
+    (FLOAT32 * __restrict__ p_out, const FLOAT32 * __restrict__ p_inp1, const FLOAT32 * __restrict__ p_inp2, WORD32 num_elm),
+    (p_out, p_inp1, p_inp2, num_elm),
+    1, (num_elm))
+
+XA_NNLIB_TRACE_WRAP(221, xa_nn_elm_add_f32xf32_f32,
+    (FLOAT32 * __restrict__ p_out, const FLOAT32 * __restrict__ p_inp1, const FLOAT32 * __restrict__ p_inp2, WORD32 num_elm),
+    (p_out, p_inp1, p_inp2, num_elm),
+    1, (num_elm))
+
+XA_NNLIB_TRACE_WRAP(222, xa_nn_elm_mul_acc_f32xf32_f32,
+    (FLOAT32 * __restrict__ p_out, const FLOAT32 * __restrict__ p_inp1, const FLOAT32 * __restrict__ p_inp2, WORD32 num_elm),
+    (p_out, p_inp1, p_inp2, num_elm),
+    1, (num_elm))
+
+XA_NNLIB_TRACE_WRAP(223, xa_nn_elm_sub_f32xf32_f32,
+    (FLOAT32 * __restrict__ p_out, const FLOAT32 * __restrict__ p_inp1, const FLOAT32 * __restrict__ p_inp2, WORD32 num_elm),
+    (p_out, p_inp1, p_inp2, num_elm),
+    1, (num_elm))
+
+XA_NNLIB_TRACE_WRAP(224, xa_nn_elm_div_f32xf32_f32,
+    (FLOAT32 * __restrict__ p_out, const FLOAT32 * __restrict__ p_inp1, const FLOAT32 * __restrict__ p_inp2, WORD32 num_elm),
+    (p_out, p_inp1, p_inp2, num_elm),
+    1, (num_elm))
+
+XA_NNLIB_TRACE_WRAP(225, xa_nn_elm_floor_f32_f32,
+    (FLOAT32 * __restrict__ p_out, const FLOAT32 * __restrict__ p_inp, WORD32 num_elm),
+    (p_out, p_inp, num_elm),
+    1, (num_elm))
+
+XA_NNLIB_TRACE_WRAP(226, xa_nn_elm_add_asym8uxasym8u_asym8u,
+    (UWORD8 * __restrict__ p_out, WORD32 out_zero_bias, WORD32 out_left_shift, WORD32 out_multiplier, WORD32 out_activation_min, WORD32 out_activation_max, const UWORD8 * __restrict__ p_inp1, WORD32 inp1_zero_bias, WORD32 inp1_left_shift, WORD32 inp1_multiplier, const UWORD8 * __restrict__ p_inp2, WORD32 inp2_zero_bias, WORD32 inp2_left_shift, WORD32 inp2_multiplier, WORD32 left_shift, WORD32 num_elm),
+    (p_out, out_zero_bias, out_left_shift, out_multiplier, out_activation_min, out_activation_max, p_inp1, inp1_zero_bias, inp1_left_shift, inp1_multiplier, p_inp2, inp2_zero_bias, inp2_left_shift, inp2_multiplier, left_shift, num_elm),
+    1, (num_elm))
+
+XA_NNLIB_TRACE_WRAP(227, xa_nn_elm_add_asym8sxasym8s_asym8s,
+    (WORD8 * __restrict__ p_out, WORD32 out_zero_bias, WORD32 out_left_shift, WORD32 out_multiplier, WORD32 out_activation_min, WORD32 out_activation_max, const WORD8 * __restrict__ p_inp1, WORD32 inp1_zero_bias, WORD32 inp1_left_shift, WORD32 inp1_multiplier, const WORD8 * __restrict__ p_inp2, WORD32 inp2_zero_bias, WORD32 inp2_left_shift, WORD32 inp2_multiplier, WORD32 left_shift, WORD32 num_elm),
+    (p_out, out_zero_bias, out_left_shift, out_multiplier, out_activation_min, out_activation_max, p_inp1, inp1_zero_bias, inp1_left_shift, inp1_multiplier, p_inp2, inp2_zero_bias, inp2_left_shift, inp2_multiplier, left_shift, num_elm),
+    1, (num_elm))
+
+XA_NNLIB_TRACE_WRAP(228, xa_nn_elm_add_broadcast_4D_asym8sxasym8s_asym8s,
+    (WORD8 * __restrict__ p_out, const WORD32 *const p_out_shape, WORD32 out_zero_bias, WORD32 out_left_shift, WORD32 out_multiplier, WORD32 out_activation_min, WORD32 out_activation_max, const WORD8 * __restrict__ p_inp1, const WORD32 *const p_inp1_shape, WORD32 inp1_zero_bias, WORD32 inp1_left_shift, WORD32 inp1_multiplier, const WORD8 * __restrict__ p_inp2, const WORD32 *const p_inp2_shape, WORD32 inp2_zero_bias, WORD32 inp2_left_shift, WORD32 inp2_multiplier, WORD32 left_shift),
+    (p_out, p_out_shape, out_zero_bias, out_left_shift, out_multiplier, out_activation_min, out_activation_max, p_inp1, p_inp1_shape, inp1_zero_bias, inp1_left_shift, inp1_multiplier, p_inp2, p_inp2_shape, inp2_zero_bias, inp2_left_shift, inp2_multiplier, left_shift),
+    0, (0))
+
+XA_NNLIB_TRACE_WRAP(229, xa_nn_elm_add_broadcast_4D_asym16sxasym16s_asym16s,
+    (WORD16 * __restrict__ p_out, const WORD32 *const p_out_shape, WORD32 out_zero_bias, WORD32 out_left_shift, WORD32 out_multiplier, WORD32 out_activation_min, WORD32 out_activation_max, const WORD16 * __restrict__ p_inp1, const WORD32 *const p_inp1_shape, WORD32 inp1_zero_bias, WORD32 inp1_left_shift, WORD32 inp1_multiplier, const WORD16 * __restrict__ p_inp2, const WORD32 *const p_inp2_shape, WORD32 inp2_zero_bias, WORD32 inp2_left_shift, WORD32 inp2_multiplier, WORD32 left_shift),
+    (p_out, p_out_shape, out_zero_bias, out_left_shift, out_multiplier, out_activation_min, out_activation_max, p_inp1, p_inp1_shape, inp1_zero_bias, inp1_left_shift, inp1_multiplier, p_inp2, p_inp2_shape, inp2_zero_bias, inp2_left_shift, inp2_multiplier, left_shift),
+    0, (0))
+
+XA_NNLIB_TRACE_WRAP(230, xa_nn_elm_add_broadcast_4D_f32xf32_f32,
+    (FLOAT32 * __restrict__ p_out, const WORD32 *const p_out_shape, const FLOAT32 * __restrict__ p_inp1, const WORD32 *const p_inp1_shape, const FLOAT32 * __restrict__ p_inp2, const WORD32 *const p_inp2_shape),
+    (p_out, p_out_shape, p_inp1, p_inp1_shape, p_inp2, p_inp2_shape),
+    0, (0))
+
+XA_NNLIB_TRACE_WRAP(231, xa_nn_elm_add_16x16_16,
+    (WORD16 * __restrict__ p_out, const WORD16 * __restrict__ p_inp1, const WORD16 * __restrict__ p_inp2, WORD32 num_elm),
+    (p_out, p_inp1, p_inp2, num_elm),
+    1, (num_elm))
+
+XA_NNLIB_TRACE_WRAP(232, xa_nn_elm_sub_broadcast_4D_asym16sxasym16s_asym16s,
+    (WORD16 * __restrict__ p_out, const WORD32 *const p_out_shape, WORD32 out_zero_bias, WORD32 out_left_shift, WORD32 out_multiplier, WORD32 out_activation_min, WORD32 out_activation_max, const WORD16 * __restrict__ p_inp1, const WORD32 *const p_inp1_shape, WORD32 inp1_zero_bias, WORD32 inp1_left_shift, WORD32 inp1_multiplier, const WORD16 * __restrict__ p_inp2, const WORD32 *const p_inp2_shape, WORD32 inp2_zero_bias, WORD32 inp2_left_shift, WORD32 inp2_multiplier, WORD32 left_shift),
+    (p_out, p_out_shape, out_zero_bias, out_left_shift, out_multiplier, out_activation_min, out_activation_max, p_inp1, p_inp1_shape, inp1_zero_bias, inp1_left_shift, inp1_multiplier, p_inp2, p_inp2_shape, inp2_zero_bias, inp2_left_shift, inp2_multiplier, left_shift),
+    0, (0))
+
+XA_NNLIB_TRACE_WRAP(233, xa_nn_elm_sub_broadcast_4D_f32xf32_f32,
+    (FLOAT32 * __restrict__ p_out, const WORD32 *const p_out_shape, const FLOAT32 * __restrict__ p_inp1, const WORD32 *const p_inp1_shape, const FLOAT32 * __restrict__ p_inp2, const WORD32 *const p_inp2_shape),
+    (p_out, p_out_shape, p_inp1, p_inp1_shape, p_inp2, p_inp2_shape),
+    0, (0))
+
+XA_NNLIB_TRACE_WRAP(234, xa_nn_elm_sub_asym8uxasym8u_asym8u,
+    (UWORD8 * __restrict__ p_out, WORD32 out_zero_bias, WORD32 out_left_shift, WORD32 out_multiplier, WORD32 out_activation_min, WORD32 out_activation_max, const UWORD8 * __restrict__ p_inp1, WORD32 inp1_zero_bias, WORD32 inp1_left_shift, WORD32 inp1_multiplier, const UWORD8 * __restrict__ p_inp2, WORD32 inp2_zero_bias, WORD32 inp2_left_shift, WORD32 inp2_multiplier, WORD32 left_shift, WORD32 num_elm),
+    (p_out, out_zero_bias, out_left_shift, out_multiplier, out_activation_min, out_activation_max, p_inp1, inp1_zero_bias, inp1_left_shift, inp1_multiplier, p_inp2, inp2_zero_bias, inp2_left_shift, inp2_multiplier, left_shift, num_elm),
+    1, (num_elm))
+
+XA_NNLIB_TRACE_WRAP(235, xa_nn_elm_sub_asym8sxasym8s_asym8s,
+    (WORD8 * __restrict__ p_out, WORD32 out_zero_bias, WORD32 out_left_shift, WORD32 out_multiplier, WORD32 out_activation_min, WORD32 out_activation_max, const WORD8 * __restrict__ p_inp1, WORD32 inp1_zero_bias, WORD32 inp1_left_shift, WORD32 inp1_multiplier, const WORD8 * __restrict__ p_inp2, WORD32 inp2_zero_bias, WORD32 inp2_left_shift, WORD32 inp2_multiplier, WORD32 left_shift, WORD32 num_elm),
+    (p_out, out_zero_bias, out_left_shift, out_multiplier, out_activation_min, out_activation_max, p_inp1, inp1_zero_bias, inp1_left_shift, inp1_multiplier, p_inp2, inp2_zero_bias, inp2_left_shift, inp2_multiplier, left_shift, num_elm),
+    1, (num_elm))
+
+XA_NNLIB_TRACE_WRAP(236, xa_nn_elm_sub_broadcast_4D_asym8sxasym8s_asym8s,
+    (WORD8 * __restrict__ p_out, const WORD32 *const p_out_shape, WORD32 out_zero_bias, WORD32 out_left_shift, WORD32 out_multiplier, WORD32 out_activation_min, WORD32 out_activation_max, const WORD8 * __restrict__ p_inp1, const WORD32 *const p_inp1_shape, WORD32 inp1_zero_bias, WORD32 inp1_left_shift, WORD32 inp1_multiplier, const WORD8 * __restrict__ p_inp2, const WORD32 *const p_inp2_shape, WORD32 inp2_zero_bias, WORD32 inp2_left_shift, WORD32 inp2_multiplier, WORD32 left_shift),
+    (p_out, p_out_shape, out_zero_bias, out_left_shift, out_multiplier, out_activation_min, out_activation_max, p_inp1, p_inp1_shape, inp1_zero_bias, inp1_left_shift, inp1_multiplier, p_inp2, p_inp2_shape, inp2_zero_bias, inp2_left_shift, inp2_multiplier, left_shift),
+    0, (0))
+
+XA_NNLIB_TRACE_WRAP(237, xa_nn_elm_mul_asym8uxasym8u_asym8u,
+    (UWORD8 * __restrict__ p_out, WORD32 out_zero_bias, WORD32 out_shift, WORD32 out_multiplier, WORD32 out_activation_min, WORD32 out_activation_max, const UWORD8 * __restrict__ p_inp1, WORD32 inp1_zero_bias, const UWORD8 * __restrict__ p_inp2, WORD32 inp2_zero_bias, WORD32 num_elm),
+    (p_out, out_zero_bias, out_shift, out_multiplier, out_activation_min, out_activation_max, p_inp1, inp1_zero_bias, p_inp2, inp2_zero_bias, num_elm),
+    1, (num_elm))
+
+XA_NNLIB_TRACE_WRAP(238, xa_nn_elm_mul_asym8sxasym8s_asym8s,
+    (WORD8 * __restrict__ p_out, WORD32 out_zero_bias, WORD32 out_shift, WORD32 out_multiplier, WORD32 out_activation_min, WORD32 out_activation_max, const WORD8 * __restrict__ p_inp1, WORD32 inp1_zero_bias, const WORD8 * __restrict__ p_inp2, WORD32 inp2_zero_bias, WORD32 num_elm),
+    (p_out, out_zero_bias, out_shift, out_multiplier, out_activation_min, out_activation_max, p_inp1, inp1_zero_bias, p_inp2, inp2_zero_bias, num_elm),
+    1, (num_elm))
+
+XA_NNLIB_TRACE_WRAP(239, xa_nn_elm_mul_broadcast_4D_asym8sxasym8s_asym8s,
+    (WORD8 * __restrict__ p_out, const WORD32 *const p_out_shape, WORD32 out_zero_bias, WORD32 out_shift, WORD32 out_multiplier, WORD32 out_activation_min, WORD32 out_activation_max, const WORD8 * __restrict__ p_inp1, const WORD32 *const p_inp1_shape, WORD32 inp1_zero_bias, const WORD8 * __restrict__ p_inp2, const WORD32 *const p_inp2_shape, WORD32 inp2_zero_bias),
+    (p_out, p_out_shape, out_zero_bias, out_shift, out_multiplier, out_activation_min, out_activation_max, p_inp1, p_inp1_shape, inp1_zero_bias, p_inp2, p_inp2_shape, inp2_zero_bias),
+    0, (0))
+
+XA_NNLIB_TRACE_WRAP(240, xa_nn_elm_mul_broadcast_4D_sym16sxsym16s_sym16s,
+    (WORD16 * __restrict__ p_out, const WORD32 *const p_out_shape, WORD32 out_shift, WORD32 out_multiplier, WORD32 out_activation_min, WORD32 out_activation_max, const WORD16 * __restrict__ p_inp1, const WORD32 *const p_inp1_shape, const WORD16 * __restrict__ p_inp2, const WORD32 *const p_inp2_shape),
+    (p_out, p_out_shape, out_shift, out_multiplier, out_activation_min, out_activation_max, p_inp1, p_inp1_shape, p_inp2, p_inp2_shape),
+    0, (0))
+
+XA_NNLIB_TRACE_WRAP(241, xa_nn_elm_mul_broadcast_4D_f32xf32_f32,
+    (FLOAT32 * __restrict__ p_out, const WORD32 *const p_out_shape, const FLOAT32 * __restrict__ p_inp1, const WORD32 *const p_inp1_shape, const FLOAT32 * __restrict__ p_inp2, const WORD32 *const p_inp2_shape),
+    (p_out, p_out_shape, p_inp1, p_inp1_shape, p_inp2, p_inp2_shape),
+    0, (0))
+
+XA_NNLIB_TRACE_WRAP(242, xa_nn_elm_mul_sym16sxsym16s_asym8s,
+    (WORD8 * __restrict__ p_out, WORD32 out_zero_bias, WORD32 out_shift, WORD32 out_multiplier, WORD32 out_activation_min, WORD32 out_activation_max, const WORD16 * __restrict__ p_inp1, const WORD16 * __restrict__ p_inp2, WORD32 num_elm),
+    (p_out, out_zero_bias, out_shift, out_multiplier, out_activation_min, out_activation_max, p_inp1, p_inp2, num_elm),
+    1, (num_elm))
+
+XA_NNLIB_TRACE_WRAP(243, xa_nn_elm_squared_diff_broadcast_4D_asym8sxasym8s_asym8s,
+    (WORD8 * __restrict__ p_out, const WORD32 *const p_out_shape, WORD32 out_zero_bias, WORD32 out_left_shift, WORD32 out_multiplier, WORD32 out_activation_min, WORD32 out_activation_max, const WORD8 * __restrict__ p_inp1, const WORD32 *const p_inp1_shape, WORD32 inp1_zero_bias, WORD32 inp1_left_shift, WORD32 inp1_multiplier, const WORD8 * __restrict__ p_inp2, const WORD32 *const p_inp2_shape, WORD32 inp2_zero_bias, WORD32 inp2_left_shift, WORD32 inp2_multiplier, WORD32 left_shift),
+    (p_out, p_out_shape, out_zero_bias, out_left_shift, out_multiplier, out_activation_min, out_activation_max, p_inp1, p_inp1_shape, inp1_zero_bias, inp1_left_shift, inp1_multiplier, p_inp2, p_inp2_shape, inp2_zero_bias, inp2_left_shift, inp2_multiplier, left_shift),
+    0, (0))
+
+XA_NNLIB_TRACE_WRAP(244, xa_nn_elm_squared_diff_broadcast_4D_sym16sxsym16s_sym16s,
+    (WORD16 * __restrict__ p_out, const WORD32 *const p_out_shape, WORD32 out_left_shift, WORD32 out_multiplier, WORD32 out_activation_min, WORD32 out_activation_max, const WORD16 * __restrict__ p_inp1, const WORD32 *const p_inp1_shape, WORD32 inp1_left_shift, WORD32 inp1_multiplier, const WORD16 * __restrict__ p_inp2, const WORD32 *const p_inp2_shape, WORD32 inp2_left_shift, WORD32 inp2_multiplier, WORD32 left_shift),
+    (p_out, p_out_shape, out_left_shift, out_multiplier, out_activation_min, out_activation_max, p_inp1, p_inp1_shape, inp1_left_shift, inp1_multiplier, p_inp2, p_inp2_shape, inp2_left_shift, inp2_multiplier, left_shift),
+    0, (0))
+
+XA_NNLIB_TRACE_WRAP(245, xa_nn_lstm_cell_state_update_16,
+    (WORD16* p_cell_state, const WORD16* p_forget_gate, const WORD16* p_cell_gate, const WORD16* p_input_gate, WORD32 cell_to_forget_shift, WORD32 cell_to_input_shift, WORD32 clip, WORD32 num_elms),
+    (p_cell_state, p_forget_gate, p_cell_gate, p_input_gate, cell_to_forget_shift, cell_to_input_shift, clip, num_elms),
+    1, (num_elms))
+
+XA_NNLIB_TRACE_WRAP(246, xa_nn_gru_hidden_state_update_8,
+    (WORD8* p_hidden_state, const WORD16* p_update_gate, const WORD16* p_modulated_state, WORD32 update_to_modulated_state_multiplier, WORD32 update_to_modulated_state_shift, WORD32 update_to_hidden_state_multiplier, WORD32 update_to_hidden_state_shift, WORD32 out_multiplier, WORD32 out_shift, WORD32 hidden_zero_bias, WORD32 num_elms),
+    (p_hidden_state, p_update_gate, p_modulated_state, update_to_modulated_state_multiplier, update_to_modulated_state_shift, update_to_hidden_state_multiplier, update_to_hidden_state_shift, out_multiplier, out_shift, hidden_zero_bias, num_elms),
+    1, (num_elms))
+
+XA_NNLIB_TRACE_WRAP(247, xa_nn_elm_requantize_asym32s_asym16s,
+    (WORD16 * __restrict__ p_out, const WORD32 * __restrict__ p_inp, WORD32 inp_zero_bias, WORD32 out_zero_bias, WORD32 out_shift, WORD32 out_multiplier, WORD32 num_elm),
+    (p_out, p_inp, inp_zero_bias, out_zero_bias, out_shift, out_multiplier, num_elm),
+    1, (num_elm))
+
+XA_NNLIB_TRACE_WRAP(248, xa_nn_elm_requantize_asym32s_asym8s,
+    (WORD8 * __restrict__ p_out, const WORD32 * __restrict__ p_inp, WORD32 inp_zero_bias, WORD32 out_zero_bias, WORD32 out_shift, WORD32 out_multiplier, WORD32 num_elm),
+    (p_out, p_inp, inp_zero_bias, out_zero_bias, out_shift, out_multiplier, num_elm),
+    1, (num_elm))
+
+XA_NNLIB_TRACE_WRAP(249, xa_nn_elm_requantize_asym8s_asym8u,
+    (UWORD8 * __restrict__ p_out, const WORD8 * __restrict__ p_inp, WORD32 inp_zero_bias, WORD32 out_zero_bias, WORD32 out_shift, WORD32 out_multiplier, WORD32 num_elm),
+    (p_out, p_inp, inp_zero_bias, out_zero_bias, out_shift, out_multiplier, num_elm),
+    1, (num_elm))
+
+XA_NNLIB_TRACE_WRAP(250, xa_nn_elm_requantize_asym8s_asym16s,
+    (WORD16 * __restrict__ p_out, const WORD8 * __restrict__ p_inp, WORD32 inp_zero_bias, WORD32 out_zero_bias, WORD32 out_shift, WORD32 out_multiplier, WORD32 num_elm),
+    (p_out, p_inp, inp_zero_bias, out_zero_bias, out_shift, out_multiplier, num_elm),
+    1, (num_elm))
+
+XA_NNLIB_TRACE_WRAP(251, xa_nn_elm_requantize_asym8s_asym16u,
+    (UWORD16 * __restrict__ p_out, const WORD8 * __restrict__ p_inp, WORD32 inp_zero_bias, WORD32 out_zero_bias, WORD32 out_shift, WORD32 out_multiplier, WORD32 num_elm),
+    (p_out, p_inp, inp_zero_bias, out_zero_bias, out_shift, out_multiplier, num_elm),
+    1, (num_elm))
+
+XA_NNLIB_TRACE_WRAP(252, xa_nn_elm_requantize_asym8u_asym8s,
+    (WORD8 * __restrict__ p_out, const UWORD8 * __restrict__ p_inp, WORD32 inp_zero_bias, WORD32 out_zero_bias, WORD32 out_shift, WORD32 out_multiplier, WORD32 num_elm),
+    (p_out, p_inp, inp_zero_bias, out_zero_bias, out_shift, out_multiplier, num_elm),
+    1, (num_elm))
+
+XA_NNLIB_TRACE_WRAP(253, xa_nn_elm_requantize_asym16s_asym8s,
+    (WORD8 * __restrict__ p_out, const WORD16 * __restrict__ p_inp, WORD32 inp_zero_bias, WORD32 out_zero_bias, WORD32 out_shift, WORD32 out_multiplier, WORD32 num_elm),
+    (p_out, p_inp, inp_zero_bias, out_zero_bias, out_shift, out_multiplier, num_elm),
+    1, (num_elm))
+
+XA_NNLIB_TRACE_WRAP(254, xa_nn_elm_requantize_asym16s_asym16s,
+    (WORD16 * __restrict__ p_out, const WORD16 * __restrict__ p_inp, WORD32 inp_zero_bias, WORD32 out_zero_bias, WORD32 out_shift, WORD32 out_multiplier, WORD32 num_elm),
+    (p_out, p_inp, inp_zero_bias, out_zero_bias, out_shift, out_multiplier, num_elm),
+    1, (num_elm))
+
+XA_NNLIB_TRACE_WRAP(255, xa_nn_elm_requantize_asym16s_asym32s,
+    (WORD32 * __restrict__ p_out, const WORD16 * __restrict__ p_inp, WORD32 inp_zero_bias, WORD32 out_zero_bias, WORD32 out_shift, WORD32 out_multiplier, WORD32 num_elm),
+    (p_out, p_inp, inp_zero_bias, out_zero_bias, out_shift, out_multiplier, num_elm),
+    1, (num_elm))
+
+XA_NNLIB_TRACE_WRAP(256, xa_nn_elm_requantize_asym8s_asym32s,
+    (WORD32 * __restrict__ p_out, const WORD8 * __restrict__ p_inp, WORD32 inp_zero_bias, WORD32 out_zero_bias, WORD32 out_shift, WORD32 out_multiplier, WORD32 num_elm),
+    (p_out, p_inp, inp_zero_bias, out_zero_bias, out_shift, out_multiplier, num_elm),
+    1, (num_elm))
+
+XA_NNLIB_TRACE_WRAP(257, xa_nn_elm_requantize_asym8s_asym8s,
+    (WORD8 * __restrict__ p_out, const WORD8 * __restrict__ p_inp, WORD32 inp_zero_bias, WORD32 out_zero_bias, WORD32 out_shift, WORD32 out_multiplier, WORD32 num_elm),
+    (p_out, p_inp, inp_zero_bias, out_zero_bias, out_shift, out_multiplier, num_elm),
+    1, (num_elm))
+
+#if HAVE_VFPU
+XA_NNLIB_TRACE_WRAP(258, xa_nn_elm_dequantize_asym8s_f32,
+    (FLOAT32 * __restrict__ p_out, const WORD8 * __restrict__ p_inp, WORD32 inp_zero_bias, FLOAT32 inp_scale, WORD32 num_elm),
+    (p_out, p_inp, inp_zero_bias, inp_scale, num_elm),
+    1, (num_elm))
+#endif
+
+#if HAVE_VFPU
+XA_NNLIB_TRACE_WRAP(259, xa_nn_elm_dequantize_asym8u_f32,
+    (FLOAT32 * __restrict__ p_out, const UWORD8 * __restrict__ p_inp, WORD32 inp_zero_bias, FLOAT32 inp_scale, WORD32 num_elm),
+    (p_out, p_inp, inp_zero_bias, inp_scale, num_elm),
+    1, (num_elm))
+#endif
+
+#if HAVE_VFPU
+XA_NNLIB_TRACE_WRAP(260, xa_nn_elm_dequantize_asym16s_f32,
+    (FLOAT32 * __restrict__ p_out, const WORD16 * __restrict__ p_inp, WORD32 inp_zero_bias, FLOAT32 inp_scale, WORD32 num_elm),
+    (p_out, p_inp, inp_zero_bias, inp_scale, num_elm),
+    1, (num_elm))
+#endif
+
+#if HAVE_VFPU
+XA_NNLIB_TRACE_WRAP(261, xa_nn_elm_quantize_f32_asym8s,
+    (WORD8 * __restrict__ p_out, const FLOAT32 * __restrict__ p_inp, FLOAT32 out_scale, WORD32 out_zero_bias, WORD32 num_elm),
+    (p_out, p_inp, out_scale, out_zero_bias, num_elm),
+    1, (num_elm))
+#endif
+
+#if HAVE_VFPU
+XA_NNLIB_TRACE_WRAP(262, xa_nn_elm_quantize_f32_asym8u,
+    (UWORD8 * __restrict__ p_out, const FLOAT32 * __restrict__ p_inp, FLOAT32 out_scale, WORD32 out_zero_bias, WORD32 num_elm),
+    (p_out, p_inp, out_scale, out_zero_bias, num_elm),
+    1, (num_elm))
+#endif
+
+#if HAVE_VFPU
+XA_NNLIB_TRACE_WRAP(263, xa_nn_elm_quantize_f32_asym16s,
+    (WORD16 * __restrict__ p_out, const FLOAT32 * __restrict__ p_inp, FLOAT32 out_scale, WORD32 out_zero_bias, WORD32 num_elm),
+    (p_out, p_inp, out_scale, out_zero_bias, num_elm),
+    1, (num_elm))
+#endif
+
+XA_NNLIB_TRACE_WRAP(264, xa_nn_elm_prog_asym8s,
+    (WORD8 * __restrict__ p_out, const WORD32 *const p_out_shape, const WORD8 **pp_inps, const WORD32 **pp_inp_shapes, WORD32 num_inps, const xa_nn_elm_prog_instr_t *p_prog, WORD32 num_instrs),
+    (p_out, p_out_shape, pp_inps, pp_inp_shapes, num_inps, p_prog, num_instrs),
+    0, (0))
+
+XA_NNLIB_TRACE_WRAP(265, xa_nn_elm_max_8x8_8,
+    (WORD8* __restrict__ p_out, const WORD8* __restrict__ p_in1, const WORD8* __restrict__ p_in2, WORD32 num_element),
+    (p_out, p_in1, p_in2, num_element),
+    0, (0))
+
+XA_NNLIB_TRACE_WRAP(266, xa_nn_elm_max_f32xf32_f32,
+    (FLOAT32 * __restrict__ p_out, const FLOAT32 * __restrict__ p_inp1, const FLOAT32 * __restrict__ p_inp2, WORD32 num_elm),
+    (p_out, p_inp1, p_inp2, num_elm),
+    1, (num_elm))
+
+XA_NNLIB_TRACE_WRAP(267, xa_nn_elm_min_f32xf32_f32,
+    (FLOAT32 * __restrict__ p_out, const FLOAT32 * __restrict__ p_inp1, const FLOAT32 * __restrict__ p_inp2, WORD32 num_elm),
+    (p_out, p_inp1, p_inp2, num_elm),
+    1, (num_elm))
+
+XA_NNLIB_TRACE_WRAP(268, xa_nn_elm_min_8x8_8,
+    (WORD8* __restrict__ p_out, const WORD8* __restrict__ p_in1, const WORD8* __restrict__ p_in2, WORD32 num_element),
+    (p_out, p_in1, p_in2, num_element),
+    0, (0))
+
+XA_NNLIB_TRACE_WRAP(269, xa_nn_elm_min_4D_Bcast_8x8_8,
+    (WORD8* __restrict__ out, const int *const out_shape, const WORD8* __restrict__ in1, const int * const in1_strides, const WORD8* __restrict__ in2, const int * const in2_strides),
+    (out, out_shape, in1, in1_strides, in2, in2_strides),
+    0, (0))
+
+XA_NNLIB_TRACE_WRAP(270, xa_nn_elm_max_4D_Bcast_8x8_8,
+    (WORD8* __restrict__ out, const int *const out_shape, const WORD8* __restrict__ in1, const int * const in1_strides, const WORD8* __restrict__ in2, const int * const in2_strides),
+    (out, out_shape, in1, in1_strides, in2, in2_strides),
+    0, (0))
+
+XA_NNLIB_TRACE_WRAP(271, xa_nn_elm_min_8D_Bcast_8x8_8,
+    (WORD8* __restrict__ out, const int *const out_shape, const WORD8* __restrict__ in1, const int * const in1_strides, const WORD8* __restrict__ in2, const int * const in2_strides),
+    (out, out_shape, in1, in1_strides, in2, in2_strides),
+    0, (0))
+
+XA_NNLIB_TRACE_WRAP(272, xa_nn_elm_max_8D_Bcast_8x8_8,
+    (WORD8* __restrict__ out, const int *const out_shape, const WORD8* __restrict__ in1, const int * const in1_strides, const WORD8* __restrict__ in2, const int * const in2_strides),
+    (out, out_shape, in1, in1_strides, in2, in2_strides),
+    0, (0))
+
+XA_NNLIB_TRACE_WRAP(273, xa_nn_broadcast_8_8,
+    (WORD8* __restrict__ p_out, const int *const out_shape, const WORD8* __restrict__ p_in, const int * const in_shape, int num_dims),
+    (p_out, out_shape, p_in, in_shape, num_dims),
+    0, (0))
+
+XA_NNLIB_TRACE_WRAP(274, xa_nn_broadcast_32_32,
+    (WORD32* __restrict__ p_out, const int *const out_shape, const WORD32* __restrict__ p_in, const int * const in_shape, int num_dims),
+    (p_out, out_shape, p_in, in_shape, num_dims),
+    0, (0))
+
+XA_NNLIB_TRACE_WRAP(275, xa_nn_elm_min_4D_Bcast_f32xf32_f32,
+    (FLOAT32 * __restrict__ p_out, const WORD32 *const p_out_shape, const FLOAT32 * __restrict__ p_inp1, const WORD32 *const p_inp1_shape, const FLOAT32 * __restrict__ p_inp2, const WORD32 *const p_inp2_shape),
+    (p_out, p_out_shape, p_inp1, p_inp1_shape, p_inp2, p_inp2_shape),
+    0, (0))
+
+XA_NNLIB_TRACE_WRAP(276, xa_nn_elm_max_4D_Bcast_f32xf32_f32,
+    (FLOAT32 * __restrict__ p_out, const WORD32 *const p_out_shape, const FLOAT32 * __restrict__ p_inp1, const WORD32 *const p_inp1_shape, const FLOAT32 * __restrict__ p_inp2, const WORD32 *const p_inp2_shape),
+    (p_out, p_out_shape, p_inp1, p_inp1_shape, p_inp2, p_inp2_shape),
+    0, (0))
+
+XA_NNLIB_TRACE_WRAP(277, xa_nn_elm_clamp_f32xf32xf32_f32,
+    (FLOAT32 * __restrict__ p_out, const FLOAT32 * __restrict__ p_inp, const FLOAT32 * __restrict__ p_min, const FLOAT32 * __restrict__ p_max, WORD32 num_elm),
+    (p_out, p_inp, p_min, p_max, num_elm),
+    1, (num_elm))
+
+XA_NNLIB_TRACE_WRAP(278, xa_nn_elm_equal_asym8sxasym8s,
+    (WORD8 * __restrict__ p_out, const WORD8 * __restrict__ p_inp1, WORD32 inp1_zero_bias, WORD32 inp1_shift, WORD32 inp1_multiplier, const WORD8 * __restrict__ p_inp2, WORD32 inp2_zero_bias, WORD32 inp2_shift, WORD32 inp2_multiplier, WORD32 left_shift, WORD32 num_elm),
+    (p_out, p_inp1, inp1_zero_bias, inp1_shift, inp1_multiplier, p_inp2, inp2_zero_bias, inp2_shift, inp2_multiplier, left_shift, num_elm),
+    1, (num_elm))
+
+XA_NNLIB_TRACE_WRAP(279, xa_nn_elm_notequal_asym8sxasym8s,
+    (WORD8 * __restrict__ p_out, const WORD8 * __restrict__ p_inp1, WORD32 inp1_zero_bias, WORD32 inp1_shift, WORD32 inp1_multiplier, const WORD8 * __restrict__ p_inp2, WORD32 inp2_zero_bias, WORD32 inp2_shift, WORD32 inp2_multiplier, WORD32 left_shift, WORD32 num_elm),
+    (p_out, p_inp1, inp1_zero_bias, inp1_shift, inp1_multiplier, p_inp2, inp2_zero_bias, inp2_shift, inp2_multiplier, left_shift, num_elm),
+    1, (num_elm))
+
+XA_NNLIB_TRACE_WRAP(280, xa_nn_elm_greater_asym8sxasym8s,
+    (WORD8 * __restrict__ p_out, const WORD8 * __restrict__ p_inp1, WORD32 inp1_zero_bias, WORD32 inp1_shift, WORD32 inp1_multiplier, const WORD8 * __restrict__ p_inp2, WORD32 inp2_zero_bias, WORD32 inp2_shift, WORD32 inp2_multiplier, WORD32 left_shift, WORD32 num_elm),
+    (p_out, p_inp1, inp1_zero_bias, inp1_shift, inp1_multiplier, p_inp2, inp2_zero_bias, inp2_shift, inp2_multiplier, left_shift, num_elm),
+    1, (num_elm))
+
+XA_NNLIB_TRACE_WRAP(281, xa_nn_elm_greaterequal_asym8sxasym8s,
+    (WORD8 * __restrict__ p_out, const WORD8 * __restrict__ p_inp1, WORD32 inp1_zero_bias, WORD32 inp1_shift, WORD32 inp1_multiplier, const WORD8 * __restrict__ p_inp2, WORD32 inp2_zero_bias, WORD32 inp2_shift, WORD32 inp2_multiplier, WORD32 left_shift, WORD32 num_elm),
+    (p_out, p_inp1, inp1_zero_bias, inp1_shift, inp1_multiplier, p_inp2, inp2_zero_bias, inp2_shift, inp2_multiplier, left_shift, num_elm),
+    1, (num_elm))
+
+XA_NNLIB_TRACE_WRAP(282, xa_nn_elm_compare_f32xf32_f32,
+    (WORD8 * __restrict__ p_out, const FLOAT32 * __restrict__ p_inp1, const FLOAT32 * __restrict__ p_inp2, WORD32 num_elm, compare_ops_t kernel_type),
+    (p_out, p_inp1, p_inp2, num_elm, kernel_type),
+    1, (num_elm))
+
+XA_NNLIB_TRACE_WRAP(283, xa_nn_elm_compare_broadcast_4D_f32xf32_f32,
+    (WORD8 * __restrict__ p_out, const WORD32 *const p_out_shape, const FLOAT32 * __restrict__ p_inp1, const WORD32 *const p_inp1_shape, const FLOAT32 * __restrict__ p_inp2, const WORD32 *const p_inp2_shape, compare_ops_t kernel_type),
+    (p_out, p_out_shape, p_inp1, p_inp1_shape, p_inp2, p_inp2_shape, kernel_type),
+    0, (0))
+
+XA_NNLIB_TRACE_WRAP(284, xa_nn_elm_less_asym8sxasym8s,
+    (WORD8 * __restrict__ p_out, const WORD8 * __restrict__ p_inp1, WORD32 inp1_zero_bias, WORD32 inp1_shift, WORD32 inp1_multiplier, const WORD8 * __restrict__ p_inp2, WORD32 inp2_zero_bias, WORD32 inp2_shift, WORD32 inp2_multiplier, WORD32 left_shift, WORD32 num_elm),
+    (p_out, p_inp1, inp1_zero_bias, inp1_shift, inp1_multiplier, p_inp2, inp2_zero_bias, inp2_shift, inp2_multiplier, left_shift, num_elm),
+    1, (num_elm))
+
+XA_NNLIB_TRACE_WRAP(285, xa_nn_elm_lessequal_asym8sxasym8s,
+    (WORD8 * __restrict__ p_out, const WORD8 * __restrict__ p_inp1, WORD32 inp1_zero_bias, WORD32 inp1_shift, WORD32 inp1_multiplier, const WORD8 * __restrict__ p_inp2, WORD32 inp2_zero_bias, WORD32 inp2_shift, WORD32 inp2_multiplier, WORD32 left_shift, WORD32 num_elm),
+    (p_out, p_inp1, inp1_zero_bias, inp1_shift, inp1_multiplier, p_inp2, inp2_zero_bias, inp2_shift, inp2_multiplier, left_shift, num_elm),
+    1, (num_elm))
+
+XA_NNLIB_TRACE_WRAP(286, xa_nn_memmove_16,
+    (void *pdst, const void *psrc, WORD32 n),
+    (pdst, psrc, n),
+    0, (0))
+
+XA_NNLIB_TRACE_WRAP(287, xa_nn_reduce_getsize_nhwc,
+    (WORD32 inp_precision ,const WORD32 *const p_inp_shape ,WORD32 num_inp_dims ,const WORD32 *p_axis ,WORD32 num_axis_dims ,WORD32 reduce_ops),
+    (inp_precision, p_inp_shape, num_inp_dims, p_axis, num_axis_dims, reduce_ops),
+    1, (num_inp_dims))
+
+XA_NNLIB_TRACE_WRAP(288, xa_nn_reduce_max_4D_asym8s_asym8s,
+    (WORD8 * __restrict__ p_out ,const WORD32 *const p_out_shape ,const WORD8 * __restrict__ p_inp ,const WORD32 *const p_inp_shape ,const WORD32 * __restrict__ p_axis ,WORD32 num_out_dims ,WORD32 num_inp_dims ,WORD32 num_axis_dims ,pVOID p_scratch_in),
+    (p_out, p_out_shape, p_inp, p_inp_shape, p_axis, num_out_dims, num_inp_dims, num_axis_dims, p_scratch_in),
+    1, (num_inp_dims))
+
+XA_NNLIB_TRACE_WRAP(289, xa_nn_reduce_mean_4D_asym8s_asym8s,
+    (WORD8 * __restrict__ p_out ,const WORD32 *const p_out_shape ,const WORD8 * __restrict__ p_inp ,const WORD32 *const p_inp_shape ,const WORD32 * __restrict__ p_axis ,WORD32 num_out_dims ,WORD32 num_inp_dims ,WORD32 num_axis_dims ,WORD32 inp_zero_bias ,WORD32 out_multiplier ,WORD32 out_shift ,WORD32 out_zero_bias ,pVOID p_scratch_in),
+    (p_out, p_out_shape, p_inp, p_inp_shape, p_axis, num_out_dims, num_inp_dims, num_axis_dims, inp_zero_bias, out_multiplier, out_shift, out_zero_bias, p_scratch_in),
+    1, (num_inp_dims))
+
+XA_NNLIB_TRACE_WRAP(290, xa_nn_reduce_max_4D_asym16s_asym16s,
+    (WORD16 * __restrict__ p_out ,const WORD32 *const p_out_shape ,const WORD16 * __restrict__ p_inp ,const WORD32 *const p_inp_shape ,const WORD32 * __restrict__ p_axis ,WORD32 num_out_dims ,WORD32 num_inp_dims ,WORD32 num_axis_dims ,pVOID p_scratch_in),
+    (p_out, p_out_shape, p_inp, p_inp_shape, p_axis, num_out_dims, num_inp_dims, num_axis_dims, p_scratch_in),
+    1, (num_inp_dims))
+
+XA_NNLIB_TRACE_WRAP(291, xa_nn_reduce_mean_4D_asym16s_asym16s,
+    (WORD16 * __restrict__ p_out ,const WORD32 *const p_out_shape ,const WORD16 * __restrict__ p_inp ,const WORD32 *const p_inp_shape ,const WORD32 * __restrict__ p_axis ,WORD32 num_out_dims ,WORD32 num_inp_dims ,WORD32 num_axis_dims ,WORD32 inp_zero_bias ,WORD32 out_multiplier ,WORD32 out_shift ,WORD32 out_zero_bias ,pVOID p_scratch_in),
+    (p_out, p_out_shape, p_inp, p_inp_shape, p_axis, num_out_dims, num_inp_dims, num_axis_dims, inp_zero_bias, out_multiplier, out_shift, out_zero_bias, p_scratch_in),
+    1, (num_inp_dims))
+
+XA_NNLIB_TRACE_WRAP(292, xa_nn_elm_logicaland_boolxbool_bool,
+    (WORD8 * __restrict__ p_out, const WORD8 * __restrict__ p_inp1, const WORD8 * __restrict__ p_inp2, WORD32 num_elm),
+    (p_out, p_inp1, p_inp2, num_elm),
+    1, (num_elm))
+
+XA_NNLIB_TRACE_WRAP(293, xa_nn_elm_logicalor_boolxbool_bool,
+    (WORD8 * __restrict__ p_out, const WORD8 * __restrict__ p_inp1, const WORD8 * __restrict__ p_inp2, WORD32 num_elm),
+    (p_out, p_inp1, p_inp2, num_elm),
+    1, (num_elm))
+
+XA_NNLIB_TRACE_WRAP(294, xa_nn_elm_logicalnot_bool_bool,
+    (WORD8 * __restrict__ p_out, const WORD8 * __restrict__ p_inp, WORD32 num_elm),
+    (p_out, p_inp, num_elm),
+    1, (num_elm))
+
+XA_NNLIB_TRACE_WRAP(295, xa_nn_elm_sine_f32_f32,
+    (FLOAT32 * __restrict__ p_out, const FLOAT32 * __restrict__ p_inp, WORD32 num_elm),
+    (p_out, p_inp, num_elm),
+    1, (num_elm))
+
+XA_NNLIB_TRACE_WRAP(296, xa_nn_elm_cosine_f32_f32,
+    (FLOAT32 * __restrict__ p_out, const FLOAT32 * __restrict__ p_inp, WORD32 num_elm),
+    (p_out, p_inp, num_elm),
+    1, (num_elm))
+
+XA_NNLIB_TRACE_WRAP(297, xa_nn_elm_logn_f32_f32,
+    (FLOAT32 * __restrict__ p_out, const FLOAT32 * __restrict__ p_inp, WORD32 num_elm),
+    (p_out, p_inp, num_elm),
+    1, (num_elm))
+
+XA_NNLIB_TRACE_WRAP(298, xa_nn_elm_abs_f32_f32,
+    (FLOAT32 * __restrict__ p_out, const FLOAT32 * __restrict__ p_inp, WORD32 num_elm),
+    (p_out, p_inp, num_elm),
+    1, (num_elm))
+
+XA_NNLIB_TRACE_WRAP(299, xa_nn_elm_ceil_f32_f32,
+    (FLOAT32 * __restrict__ p_out, const FLOAT32 * __restrict__ p_inp, WORD32 num_elm),
+    (p_out, p_inp, num_elm),
+    1, (num_elm))
+
+XA_NNLIB_TRACE_WRAP(300, xa_nn_elm_round_f32_f32,
+    (FLOAT32 * __restrict__ p_out, const FLOAT32 * __restrict__ p_inp, WORD32 num_elm),
+    (p_out, p_inp, num_elm),
+    1, (num_elm))
+
+XA_NNLIB_TRACE_WRAP(301, xa_nn_elm_neg_f32_f32,
+    (FLOAT32 * __restrict__ p_out, const FLOAT32 * __restrict__ p_inp, WORD32 num_elm),
+    (p_out, p_inp, num_elm),
+    1, (num_elm))
+
+XA_NNLIB_TRACE_WRAP(302, xa_nn_elm_square_f32_f32,
+    (FLOAT32 * __restrict__ p_out, const FLOAT32 * __restrict__ p_inp, WORD32 num_elm),
+    (p_out, p_inp, num_elm),
+    1, (num_elm))
+
+XA_NNLIB_TRACE_WRAP(303, xa_nn_elm_rsqrt_f32_f32,
+    (FLOAT32 * __restrict__ p_out, const FLOAT32 * __restrict__ p_inp, WORD32 num_elm),
+    (p_out, p_inp, num_elm),
+    1, (num_elm))
+
+XA_NNLIB_TRACE_WRAP(304, xa_nn_elm_sqrt_f32_f32,
+    (FLOAT32 * __restrict__ p_out, const FLOAT32 * __restrict__ p_inp, WORD32 num_elm),
+    (p_out, p_inp, num_elm),
+    1, (num_elm))
+
+XA_NNLIB_TRACE_WRAP(305, xa_nn_memmove_8_8,
+    (void *pdst, const void *psrc, WORD32 n),
+    (pdst, psrc, n),
+    0, (0))
+
+XA_NNLIB_TRACE_WRAP(306, xa_nn_memset_f32_f32,
+    (FLOAT32 * __restrict__ p_out, FLOAT32 val, WORD32 num_elm),
+    (p_out, val, num_elm),
+    1, (num_elm))
+
+XA_NNLIB_TRACE_WRAP(307, xa_nn_l2_norm_f32,
+    (FLOAT32 * __restrict__ p_out, const FLOAT32 * __restrict__ p_inp, WORD32 num_elm),
+    (p_out, p_inp, num_elm),
+    1, (num_elm))
+
+XA_NNLIB_TRACE_WRAP(308, xa_nn_l2_norm_asym8s_asym8s,
+    (WORD8 *p_out, const WORD8 *p_inp, WORD32 zero_point, WORD32 num_elm),
+    (p_out, p_inp, zero_point, num_elm),
+    1, (num_elm))
+
+#if HAVE_VFPU
+XA_NNLIB_TRACE_WRAP(309, xa_nn_dot_prod_f32xf32_f32,
+    (FLOAT32 * __restrict__ p_out, const FLOAT32 * __restrict__ p_inp1, const FLOAT32 * __restrict__ p_inp2, WORD32 vec_length, WORD32 num_vecs),
+    (p_out, p_inp1, p_inp2, vec_length, num_vecs),
+    1, (vec_length))
+#endif
+
+XA_NNLIB_TRACE_WRAP(310, xa_nn_dot_prod_16x16_asym8s,
+    (WORD8 * __restrict__ p_out, const WORD16 * __restrict__ p_inp1_start, const WORD16 * __restrict__ p_inp2_start, const WORD32 * bias_ptr, WORD32 vec_length, WORD32 out_multiplier, WORD32 out_shift, WORD32 out_zero_bias, WORD32 vec_count),
+    (p_out, p_inp1_start, p_inp2_start, bias_ptr, vec_length, out_multiplier, out_shift, out_zero_bias, vec_count),
+    2, (vec_length, vec_count))
+
+XA_NNLIB_TRACE_WRAP(311, xa_nn_depth_to_space_8_8,
+    (WORD8 *__restrict__ p_out, const WORD8 *__restrict__ p_inp, WORD32 input_height, WORD32 input_width, WORD32 input_channels, WORD32 block_size, WORD32 out_height, WORD32 out_width, WORD32 out_channels, WORD32 inp_data_format, WORD32 out_data_format),
+    (p_out, p_inp, input_height, input_width, input_channels, block_size, out_height, out_width, out_channels, inp_data_format, out_data_format),
+    6, (input_height, input_width, input_channels, out_height, out_width, out_channels))
+
+XA_NNLIB_TRACE_WRAP(312, xa_nn_space_to_depth_8_8,
+    (WORD8 *__restrict__ p_out, const WORD8 *__restrict__ p_inp, WORD32 input_height, WORD32 input_width, WORD32 input_channels, WORD32 block_size, WORD32 out_height, WORD32 out_width, WORD32 out_channels, WORD32 inp_data_format, WORD32 out_data_format),
+    (p_out, p_inp, input_height, input_width, input_channels, block_size, out_height, out_width, out_channels, inp_data_format, out_data_format),
+    6, (input_height, input_width, input_channels, out_height, out_width, out_channels))
+
+XA_NNLIB_TRACE_WRAP(313, xa_nn_batch_to_space_nd_8_8,
+    (WORD8 *__restrict__ p_out, const WORD32 *const p_out_shape, const WORD8 *__restrict__ p_inp, const WORD32 *const p_inp_shape, const WORD32 *const p_block_sizes, const WORD32 *const p_crop_sizes, WORD32 num_out_dims, WORD32 num_inp_dims),
+    (p_out, p_out_shape, p_inp, p_inp_shape, p_block_sizes, p_crop_sizes, num_out_dims, num_inp_dims),
+    1, (num_inp_dims))
+
+XA_NNLIB_TRACE_WRAP(314, xa_nn_space_to_batch_nd_8_8,
+    (WORD8 *__restrict__ p_out, const WORD32 *const p_out_shape, const WORD8 *__restrict__ p_inp, const WORD32 *const p_inp_shape, const WORD32 *const p_block_sizes, const WORD32 *const p_pad_sizes, WORD32 num_out_dims, WORD32 num_inp_dims, WORD32 pad_value),
+    (p_out, p_out_shape, p_inp, p_inp_shape, p_block_sizes, p_pad_sizes, num_out_dims, num_inp_dims, pad_value),
+    1, (num_inp_dims))
+
+XA_NNLIB_TRACE_WRAP(315, xa_nn_pad_8_8,
+    (WORD8 * __restrict__ p_out ,const WORD32 *const p_out_shape ,const WORD8 * __restrict__ p_inp ,const WORD32 *const p_inp_shape ,const WORD32 * __restrict__ p_pad_values ,const WORD32 *const p_pad_shape ,WORD32 num_out_dims ,WORD32 num_inp_dims ,WORD32 num_pad_dims ,WORD32 pad_value),
+    (p_out, p_out_shape, p_inp, p_inp_shape, p_pad_values, p_pad_shape, num_out_dims, num_inp_dims, num_pad_dims, pad_value),
+    1, (num_inp_dims))
+
+XA_NNLIB_TRACE_WRAP(316, xa_nn_pad_16_16,
+    (WORD16 * __restrict__ p_out ,const WORD32 *const p_out_shape ,const WORD16 * __restrict__ p_inp ,const WORD32 *const p_inp_shape ,const WORD32 * __restrict__ p_pad_values ,const WORD32 *const p_pad_shape ,WORD32 num_out_dims ,WORD32 num_inp_dims ,WORD32 num_pad_dims ,WORD32 pad_value),
+    (p_out, p_out_shape, p_inp, p_inp_shape, p_pad_values, p_pad_shape, num_out_dims, num_inp_dims, num_pad_dims, pad_value),
+    1, (num_inp_dims))
+
+XA_NNLIB_TRACE_WRAP(317, xa_nn_pad_32_32,
+    (WORD32 * __restrict__ p_out ,const WORD32 *const p_out_shape ,const WORD32 * __restrict__ p_inp ,const WORD32 *const p_inp_shape ,const WORD32 * __restrict__ p_pad_values ,const WORD32 *const p_pad_shape ,WORD32 num_out_dims ,WORD32 num_inp_dims ,WORD32 num_pad_dims ,WORD32 pad_value),
+    (p_out, p_out_shape, p_inp, p_inp_shape, p_pad_values, p_pad_shape, num_out_dims, num_inp_dims, num_pad_dims, pad_value),
+    1, (num_inp_dims))
+
+XA_NNLIB_TRACE_WRAP(318, xa_nn_strided_slice_int32,
+    (WORD32 * __restrict__ p_out, const WORD32 * __restrict__ p_inp, WORD32 start_0, WORD32 stop_0, WORD32 start_1, WORD32 stop_1, WORD32 start_2, WORD32 stop_2, WORD32 start_3, WORD32 stop_3, WORD32 start_4, WORD32 stop_4, WORD32 stride_0, WORD32 stride_1, WORD32 stride_2, WORD32 stride_3, WORD32 stride_4, WORD32 dims_1, WORD32 dims_2, WORD32 dims_3, WORD32 dims_4),
+    (p_out, p_inp, start_0, stop_0, start_1, stop_1, start_2, stop_2, start_3, stop_3, start_4, stop_4, stride_0, stride_1, stride_2, stride_3, stride_4, dims_1, dims_2, dims_3, dims_4),
+    0, (0))
+
+XA_NNLIB_TRACE_WRAP(319, xa_nn_strided_slice_int16,
+    (WORD16 * __restrict__ p_out, const WORD16 * __restrict__ p_inp, WORD32 start_0, WORD32 stop_0, WORD32 start_1, WORD32 stop_1, WORD32 start_2, WORD32 stop_2, WORD32 start_3, WORD32 stop_3, WORD32 start_4, WORD32 stop_4, WORD32 stride_0, WORD32 stride_1, WORD32 stride_2, WORD32 stride_3, WORD32 stride_4, WORD32 dims_1, WORD32 dims_2, WORD32 dims_3, WORD32 dims_4),
+    (p_out, p_inp, start_0, stop_0, start_1, stop_1, start_2, stop_2, start_3, stop_3, start_4, stop_4, stride_0, stride_1, stride_2, stride_3, stride_4, dims_1, dims_2, dims_3, dims_4),
+    0, (0))
+
+XA_NNLIB_TRACE_WRAP(320, xa_nn_strided_slice_int8,
+    (WORD8 * __restrict__ p_out, const WORD8 * __restrict__ p_inp, WORD32 start_0, WORD32 stop_0, WORD32 start_1, WORD32 stop_1, WORD32 start_2, WORD32 stop_2, WORD32 start_3, WORD32 stop_3, WORD32 start_4, WORD32 stop_4, WORD32 stride_0, WORD32 stride_1, WORD32 stride_2, WORD32 stride_3, WORD32 stride_4, WORD32 dims_1, WORD32 dims_2, WORD32 dims_3, WORD32 dims_4),
+    (p_out, p_inp, start_0, stop_0, start_1, stop_1, start_2, stop_2, start_3, stop_3, start_4, stop_4, stride_0, stride_1, stride_2, stride_3, stride_4, dims_1, dims_2, dims_3, dims_4),
+    0, (0))
+
+XA_NNLIB_TRACE_WRAP(321, xa_nn_transpose_8_8,
+    (WORD8 * __restrict__ p_out ,const WORD32 *const p_out_shape ,const WORD8 * __restrict__ p_inp ,const WORD32 *const p_inp_shape ,const WORD32 * __restrict__ p_permute_vec ,WORD32 num_out_dims ,WORD32 num_inp_dims),
+    (p_out, p_out_shape, p_inp, p_inp_shape, p_permute_vec, num_out_dims, num_inp_dims),
+    1, (num_inp_dims))
+
+XA_NNLIB_TRACE_WRAP(322, xa_nn_transpose_16_16,
+    (WORD16 * __restrict__ p_out ,const WORD32 *const p_out_shape ,const WORD16 * __restrict__ p_inp ,const WORD32 *const p_inp_shape ,const WORD32 * __restrict__ p_permute_vec ,WORD32 num_out_dims ,WORD32 num_inp_dims),
+    (p_out, p_out_shape, p_inp, p_inp_shape, p_permute_vec, num_out_dims, num_inp_dims),
+    1, (num_inp_dims))
+
+XA_NNLIB_TRACE_WRAP(323, xa_nn_transpose_32_32,
+    (WORD32 * __restrict__ p_out ,const WORD32 *const p_out_shape ,const WORD32 * __restrict__ p_inp ,const WORD32 *const p_inp_shape ,const WORD32 * __restrict__ p_permute_vec ,WORD32 num_out_dims ,WORD32 num_inp_dims),
+    (p_out, p_out_shape, p_inp, p_inp_shape, p_permute_vec, num_out_dims, num_inp_dims),
+    1, (num_inp_dims))
+
+XA_NNLIB_TRACE_WRAP(324, xa_nn_batch_norm_3D_8_8,
+    (WORD8 * __restrict__ p_out ,const WORD8 * __restrict__ p_inp ,const WORD16 * __restrict__ p_alpha ,const WORD32 * __restrict__ p_beta ,WORD32 io_height ,WORD32 io_width ,WORD32 io_depth ,WORD32 out_shift ,WORD32 out_activation_min ,WORD32 out_activation_max ,WORD32 inp_data_format ,WORD32 out_data_format),
+    (p_out, p_inp, p_alpha, p_beta, io_height, io_width, io_depth, out_shift, out_activation_min, out_activation_max, inp_data_format, out_data_format),
+    3, (io_height, io_width, io_depth))
+
+XA_NNLIB_TRACE_WRAP(325, xa_nn_norm_calc_3D_8_nhwc,
+    (WORD16 * p_out ,const WORD8 * p_inp ,int input_height, int input_width, int input_channels ,int accross_depth_flag ,int out_shift ,const UWORD16 *prsqrt, int rsqrt_shift, int rsqrt_table_len ,const UWORD16 *precip, int recip_shift),
+    (p_out, p_inp, input_height, input_width, input_channels, accross_depth_flag, out_shift, prsqrt, rsqrt_shift, rsqrt_table_len, precip, recip_shift),
+    3, (input_height, input_width, input_channels))
+
+XA_NNLIB_TRACE_WRAP(326, xa_nn_norm_calc_3D_16_nhwc,
+    (UWORD16 * p_outnorm ,WORD8 * p_outnsa ,const WORD16 * p_inp ,int input_height, int input_width, int input_channels ,int accros_depth_flag ,int out_shift ,const UWORD16 *prsqrt, int rsqrt_table_len),
+    (p_outnorm, p_outnsa, p_inp, input_height, input_width, input_channels, accros_depth_flag, out_shift, prsqrt, rsqrt_table_len),
+    3, (input_height, input_width, input_channels))
+
+XA_NNLIB_TRACE_WRAP(327, xa_nn_norm_apply_3D_8_nhwc,
+    (WORD8 * p_out, const WORD8 * p_inp, WORD16 *p_inp_normdata, int input_height, int input_width, int input_channels, int accross_depth_flag, int per_chan_flag, WORD16 * p_out_multiplier, WORD32 out_shift, WORD32 rsqrt_shift),
+    (p_out, p_inp, p_inp_normdata, input_height, input_width, input_channels, accross_depth_flag, per_chan_flag, p_out_multiplier, out_shift, rsqrt_shift),
+    3, (input_height, input_width, input_channels))
+
+XA_NNLIB_TRACE_WRAP(328, xa_nn_norm_apply_3D_16_nhwc,
+    (WORD16 * p_out, const WORD16 * p_inp, const UWORD16 *p_inp_normdata, const WORD8 *p_inp_nsadata, int input_height, int input_width, int input_channels, int accross_depth_flag, int per_chan_flag, WORD16 * p_out_multiplier, WORD32 out_shift, WORD32 rsqrt_shift),
+    (p_out, p_inp, p_inp_normdata, p_inp_nsadata, input_height, input_width, input_channels, accross_depth_flag, per_chan_flag, p_out_multiplier, out_shift, rsqrt_shift),
+    3, (input_height, input_width, input_channels))
+
+XA_NNLIB_TRACE_WRAP(329, xa_nn_renorm_asym8s_asym8s,
+    (WORD8 * __restrict__ p_out, const WORD8 * __restrict__ p_inp, WORD32 num_elm, WORD32 renorm_scale, WORD32 renorm_shift, WORD32 input_zero_bias, WORD32 output_zero_bias),
+    (p_out, p_inp, num_elm, renorm_scale, renorm_shift, input_zero_bias, output_zero_bias),
+    1, (num_elm))
+
+XA_NNLIB_TRACE_WRAP(330, xa_nn_layer_norm_asym8s_asym8s,
+    (WORD8 * __restrict__ p_out ,const WORD8 * __restrict__ p_inp ,const WORD16 * __restrict__ p_gamma ,const WORD32 * __restrict__ p_beta ,WORD32 num_rows ,WORD32 row_len ,WORD32 variance_epsilon ,WORD32 out_multiplier ,WORD32 out_shift ,WORD32 out_zero_bias ,WORD32 out_activation_min ,WORD32 out_activation_max),
+    (p_out, p_inp, p_gamma, p_beta, num_rows, row_len, variance_epsilon, out_multiplier, out_shift, out_zero_bias, out_activation_min, out_activation_max),
+    1, (num_rows))
+
+XA_NNLIB_TRACE_WRAP(331, xa_nn_layer_norm_sym16s_sym16s,
+    (WORD16 * __restrict__ p_out ,const WORD16 * __restrict__ p_inp ,const WORD16 * __restrict__ p_gamma ,const WORD32 * __restrict__ p_beta ,WORD32 num_rows ,WORD32 row_len ,WORD32 variance_epsilon ,WORD32 out_multiplier ,WORD32 out_shift ,WORD32 out_activation_min ,WORD32 out_activation_max),
+    (p_out, p_inp, p_gamma, p_beta, num_rows, row_len, variance_epsilon, out_multiplier, out_shift, out_activation_min, out_activation_max),
+    1, (num_rows))
+
+XA_NNLIB_TRACE_WRAP(332, xa_nn_resize_bilinear_8_8,
+    (pWORD8 __restrict__ p_out ,const WORD8 *__restrict__ p_inp ,WORD32 input_batch ,WORD32 input_height ,WORD32 input_width ,WORD32 input_channels ,WORD32 out_batch ,WORD32 out_height ,WORD32 out_width ,WORD32 out_channels ,WORD32 height_scale_10 ,WORD32 width_scale_10 ,WORD32 height_shift ,WORD32 width_shift),
+    (p_out, p_inp, input_batch, input_height, input_width, input_channels, out_batch, out_height, out_width, out_channels, height_scale_10, width_scale_10, height_shift, width_shift),
+    8, (input_batch, input_height, input_width, input_channels, out_batch, out_height, out_width, out_channels))
+
+#if HAVE_VFPU
+XA_NNLIB_TRACE_WRAP(333, xa_nn_resize_nearest_neighbour_8_8,
+    (pWORD8 __restrict__ p_out ,const WORD8 *__restrict__ p_inp ,WORD32 input_batch ,WORD32 input_height ,WORD32 input_width ,WORD32 input_channels ,WORD32 out_batch ,WORD32 out_height ,WORD32 out_width ,WORD32 out_channels ,FLOAT32 height_scale ,FLOAT32 width_scale ,FLOAT32 height_offset ,FLOAT32 width_offset ,WORD32 align_corners),
+    (p_out, p_inp, input_batch, input_height, input_width, input_channels, out_batch, out_height, out_width, out_channels, height_scale, width_scale, height_offset, width_offset, align_corners),
+    8, (input_batch, input_height, input_width, input_channels, out_batch, out_height, out_width, out_channels))
+#endif
+
+XA_NNLIB_TRACE_WRAP(334, xa_nn_concat_8_8,
+    (WORD8 * __restrict__ p_out ,const WORD32 *const p_out_shape ,const WORD8 **p_inps ,const WORD32 *const *pp_inps_shape ,WORD32 num_out_dims ,WORD32 num_inp ,WORD32 num_inp_dims ,WORD32 axis),
+    (p_out, p_out_shape, p_inps, pp_inps_shape, num_out_dims, num_inp, num_inp_dims, axis),
+    1, (num_inp_dims))
+
+XA_NNLIB_TRACE_WRAP(335, xa_nn_concat_32_32,
+    (WORD32 * __restrict__ p_out ,const WORD32 *const p_out_shape ,const WORD32 **pp_inps ,const WORD32 *const *pp_inps_shape ,WORD32 num_out_dims ,WORD32 num_inp ,WORD32 num_inp_dims ,WORD32 axis),
+    (p_out, p_out_shape, pp_inps, pp_inps_shape, num_out_dims, num_inp, num_inp_dims, axis),
+    1, (num_inp_dims))
+
+XA_NNLIB_TRACE_WRAP(336, xa_nn_split_v_8_8,
+    (WORD8 ** __restrict__ pp_outs ,const WORD32 *const *pp_outs_shape ,const WORD8 *p_inp ,const WORD32 *const p_inp_shape ,WORD32 num_out ,WORD32 num_out_dims ,WORD32 num_inp_dims ,WORD32 axis),
+    (pp_outs, pp_outs_shape, p_inp, p_inp_shape, num_out, num_out_dims, num_inp_dims, axis),
+    1, (num_inp_dims))
+
+XA_NNLIB_TRACE_WRAP(337, xa_nn_shuffle_3D_8_8,
+    (WORD8 * __restrict__ p_out ,const WORD8 * __restrict__ p_inp ,WORD32 input_height ,WORD32 input_width ,WORD32 input_channel ,WORD32 output_height ,WORD32 output_width ,WORD32 output_channel ,WORD32 interleave_groups),
+    (p_out, p_inp, input_height, input_width, input_channel, output_height, output_width, output_channel, interleave_groups),
+    4, (input_height, input_width, output_height, output_width))
+
+XA_NNLIB_TRACE_WRAP(338, xa_nn_elm_div_broadcast_4D_f32xf32_f32,
+    (FLOAT32 * __restrict__ p_out, const WORD32 *const p_out_shape, const FLOAT32 * __restrict__ p_inp1, const WORD32 *const p_inp1_shape, const FLOAT32 * __restrict__ p_inp2, const WORD32 *const p_inp2_shape),
+    (p_out, p_out_shape, p_inp1, p_inp1_shape, p_inp2, p_inp2_shape),
+    0, (0))
+
+XA_NNLIB_TRACE_WRAP(339, xa_nn_elm_select_32x32_32,
+    (WORD32 * __restrict__ p_out, const WORD32 * __restrict__ p_inp1, const WORD32 * __restrict__ p_inp2, const unsigned char *__restrict__ p_condition, WORD32 num_elm),
+    (p_out, p_inp1, p_inp2, p_condition, num_elm),
+    1, (num_elm))
+
+XA_NNLIB_TRACE_WRAP(340, xa_nn_elm_select_broadcast_4D_32x32_32,
+    (WORD32 * __restrict__ p_out, const WORD32 *const p_out_shape, const WORD32 * __restrict__ p_inp1, const WORD32 *const p_inp1_shape, const WORD32 * __restrict__ p_inp2, const WORD32 *const p_inp2_shape, const unsigned char *__restrict__ p_condition, const WORD32 *const p_condition_shape),
+    (p_out, p_out_shape, p_inp1, p_inp1_shape, p_inp2, p_inp2_shape, p_condition, p_condition_shape),
+    0, (0))
+
+XA_NNLIB_TRACE_WRAP(341, xa_nn_lstm_getsize,
+    (WORD32 n_batch, WORD32 n_itr, WORD32 n_cell, WORD32 cell_state_precision),
+    (n_batch, n_itr, n_cell, cell_state_precision),
+    3, (n_batch, n_itr, n_cell))
+
+XA_NNLIB_TRACE_WRAP(342, xa_nn_lstm_sym8sxasym8s_16,
+    (WORD8* p_out, WORD8* p_hidden_state, WORD16* p_cell_state, lstm_weights_ptrs *p_lstm_weights, lstm_bias_ptrs *p_lstm_biases, WORD8* p_inp, WORD32 inp_size, WORD32 hidden_size, WORD32 out_size, WORD32 n_batch, WORD32 n_itr, WORD32 n_cell, lstm_quant_params *p_lstm_qp, lstm_flags *p_lstm_flags, void* p_scratch),
+    (p_out, p_hidden_state, p_cell_state, p_lstm_weights, p_lstm_biases, p_inp, inp_size, hidden_size, out_size, n_batch, n_itr, n_cell, p_lstm_qp, p_lstm_flags, p_scratch),
+    4, (hidden_size, n_batch, n_itr, n_cell))
+
+XA_NNLIB_TRACE_WRAP(343, xa_nn_lstm_fused_weights_getsize,
+    (WORD32 inp_size, WORD32 n_cell),
+    (inp_size, n_cell),
+    1, (n_cell))
+
+XA_NNLIB_TRACE_WRAP(344, xa_nn_lstm_fused_pack_weights_sym8s,
+    (lstm_fused_weights *p_fused, void* p_buf, lstm_weights_ptrs *p_lstm_weights, lstm_bias_ptrs *p_lstm_biases, lstm_quant_params *p_lstm_qp, WORD32 inp_size, WORD32 n_cell),
+    (p_fused, p_buf, p_lstm_weights, p_lstm_biases, p_lstm_qp, inp_size, n_cell),
+    1, (n_cell))
+
+XA_NNLIB_TRACE_WRAP(345, xa_nn_lstm_fused_sym8sxasym8s_16,
+    (WORD8* p_out, WORD8* p_hidden_state, WORD16* p_cell_state, lstm_fused_weights *p_fused, WORD8* p_inp, WORD32 inp_size, WORD32 hidden_size, WORD32 out_size, WORD32 n_batch, WORD32 n_itr, WORD32 n_cell, lstm_quant_params *p_lstm_qp, lstm_flags *p_lstm_flags, void* p_scratch),
+    (p_out, p_hidden_state, p_cell_state, p_fused, p_inp, inp_size, hidden_size, out_size, n_batch, n_itr, n_cell, p_lstm_qp, p_lstm_flags, p_scratch),
+    4, (hidden_size, n_batch, n_itr, n_cell))
+
+XA_NNLIB_TRACE_WRAP(346, xa_nn_gru_getsize,
+    (WORD32 n_batch, WORD32 n_itr, WORD32 hidden_size, WORD32 hidden_precision),
+    (n_batch, n_itr, hidden_size, hidden_precision),
+    3, (n_batch, n_itr, hidden_size))
+
+XA_NNLIB_TRACE_WRAP(347, xa_nn_gru_sym8sxasym8s,
+    (WORD8* p_out, const WORD8* p_hidden_state, const gru_weights_ptrs *p_gru_weights, const gru_bias_ptrs *p_gru_biases, const WORD8* p_inp, WORD32 inp_size, WORD32 hidden_size, WORD32 out_size, WORD32 n_batch, WORD32 n_itr, const gru_quant_params *p_gru_qp, WORD32 time_major, void* p_scratch),
+    (p_out, p_hidden_state, p_gru_weights, p_gru_biases, p_inp, inp_size, hidden_size, out_size, n_batch, n_itr, p_gru_qp, time_major, p_scratch),
+    3, (hidden_size, n_batch, n_itr))
+
+XA_NNLIB_TRACE_WRAP(348, xa_nn_gru_fused_weights_getsize,
+    (WORD32 inp_size, WORD32 hidden_size),
+    (inp_size, hidden_size),
+    1, (hidden_size))
+
+XA_NNLIB_TRACE_WRAP(349, xa_nn_gru_fused_pack_weights_sym8s,
+    (gru_fused_weights *p_fused, void* p_buf, const gru_weights_ptrs *p_gru_weights, const gru_bias_ptrs *p_gru_biases, const gru_quant_params *p_gru_qp, WORD32 inp_size, WORD32 hidden_size),
+    (p_fused, p_buf, p_gru_weights, p_gru_biases, p_gru_qp, inp_size, hidden_size),
+    1, (hidden_size))
+
+XA_NNLIB_TRACE_WRAP(350, xa_nn_gru_fused_sym8sxasym8s,
+    (WORD8* p_out, const WORD8* p_hidden_state, const gru_fused_weights *p_fused, const WORD8* p_inp, WORD32 inp_size, WORD32 hidden_size, WORD32 out_size, WORD32 n_batch, WORD32 n_itr, const gru_quant_params *p_gru_qp, WORD32 time_major, void* p_scratch),
+    (p_out, p_hidden_state, p_fused, p_inp, inp_size, hidden_size, out_size, n_batch, n_itr, p_gru_qp, time_major, p_scratch),
+    3, (hidden_size, n_batch, n_itr))
+
+#endif /* XA_NNLIB_TRACE */
@@ -0,0 +1,109 @@
+/*******************************************************************************
+* Copyright (c) 2018-2025 Cadence Design Systems, Inc.
+*
+* Permission is hereby granted, free of charge, to any person obtaining
+* a copy of this software and associated documentation files (the
+* "Software"), to use this Software with Cadence processor cores only and
+* not with any other processors and platforms, subject to
+* the following conditions:
+*
+* The above copyright notice and this permission notice shall be included
+* in all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+******************************************************************************/
+#include "xa_type_def.h"
+#include "xa_nnlib_common.h"
+#include "xa_nnlib_err_chk.h"
+#include "xa_nnlib_kernels_api.h"
+#include <string.h>
+
+#define ACT_LUT_SIZE 256
+
+WORD32 xa_nn_vec_activation_lut_asym8s(WORD8 *p_lut,
+    const xa_nn_act_params_t *p_params,
+    WORD32 lut_channels)
+{
+  /* NULL pointer checks */
+  XA_NNLIB_ARG_CHK_PTR(p_lut, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_params, -1);
+  /* Basic Parameter checks */
+  XA_NNLIB_ARG_CHK_COND((lut_channels <= 0), -1);
+  XA_NNLIB_ARG_CHK_COND((p_params->act_type < ACT_RELU || p_params->act_type > ACT_SILU), -1);
+  XA_NNLIB_ARG_CHK_COND((p_params->act_type == ACT_PRELU && p_params->p_alpha == NULL), -1);
+
+  WORD8 ALIGN(16) inp[ACT_LUT_SIZE];
+  WORD8 ALIGN(16) alpha[ACT_LUT_SIZE];
+  WORD32 itr, ch, ret = 0;
+
+  for(itr = 0; itr < ACT_LUT_SIZE; itr++)
+  {
+    inp[itr] = (WORD8)(itr - 128);
+  }
+
+  /* Entries come from the vector kernels themselves, the kernels check the
+   * quantization parameters */
+  switch(p_params->act_type)
+  {
+    case ACT_RELU:
+      ret = xa_nn_vec_relu_asym8s_asym8s(p_lut, inp, p_params->inp_zero_bias,
+              p_params->out_multiplier, p_params->out_shift, p_params->out_zero_bias,
+              p_params->activation_min, p_params->activation_max, ACT_LUT_SIZE);
+      break;
+    case ACT_LEAKY_RELU:
+      ret = xa_nn_vec_leaky_relu_asym8s_asym8s(p_lut, inp, p_params->inp_zero_bias,
+              p_params->alpha_multiplier, p_params->alpha_shift,
+              p_params->out_multiplier, p_params->out_shift, p_params->out_zero_bias, ACT_LUT_SIZE);
+      break;
+    case ACT_PRELU:
+      for(ch = 0; ch < lut_channels && ret == 0; ch++)
+      {
+        memset(alpha, p_params->p_alpha[ch], ACT_LUT_SIZE);
+        ret = xa_nn_vec_prelu_asym8s_asym8s(&p_lut[ch * ACT_LUT_SIZE], inp, alpha,
+                p_params->inp_zero_bias, p_params->alpha_zero_bias,
+                p_params->alpha_multiplier, p_params->alpha_shift,
+                p_params->out_multiplier, p_params->out_shift, p_params->out_zero_bias, ACT_LUT_SIZE);
+      }
+      return ret;
+    case ACT_HARD_SWISH:
+      ret = xa_nn_vec_hard_swish_asym8s_asym8s(p_lut, inp, p_params->inp_zero_bias,
+              (WORD16)p_params->alpha_multiplier, p_params->alpha_shift,
+              (WORD16)p_params->out_multiplier, p_params->out_shift, p_params->out_zero_bias, ACT_LUT_SIZE);
+      break;
+    case ACT_SIGMOID:
+      ret = xa_nn_vec_sigmoid_asym8s_asym8s(p_lut, inp, p_params->inp_zero_bias,
+              p_params->input_range_radius, p_params->input_multiplier, p_params->input_left_shift, ACT_LUT_SIZE);
+      break;
+    case ACT_TANH:
+      ret = xa_nn_vec_tanh_asym8s_asym8s(p_lut, inp, p_params->inp_zero_bias,
+              p_params->input_range_radius, p_params->input_multiplier, p_params->input_left_shift, ACT_LUT_SIZE);
+      break;
+    case ACT_GELU:
+      ret = xa_nn_vec_gelu_asym8s_asym8s(p_lut, inp, p_params->inp_zero_bias,
+              p_params->input_multiplier, p_params->input_left_shift,
+              p_params->out_multiplier, p_params->out_shift, p_params->out_zero_bias, ACT_LUT_SIZE);
+      break;
+    case ACT_SILU:
+      ret = xa_nn_vec_silu_asym8s_asym8s(p_lut, inp, p_params->inp_zero_bias,
+              p_params->input_multiplier, p_params->input_left_shift,
+              p_params->out_multiplier, p_params->out_shift, p_params->out_zero_bias, ACT_LUT_SIZE);
+      break;
+  }
+  if(ret < 0)
+    return ret;
+
+  /* Channel independent activations use the same table for every channel */
+  for(ch = 1; ch < lut_channels; ch++)
+  {
+    memcpy(&p_lut[ch * ACT_LUT_SIZE], p_lut, ACT_LUT_SIZE);
+  }
+
+  return 0;
+}
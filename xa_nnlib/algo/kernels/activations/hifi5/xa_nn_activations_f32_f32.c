@@ -204,6 +204,90 @@ WORD32 xa_nn_vec_tanh_f32_f32(
 }
 #endif /* !HAVE_VFPU */
 
+#define GELU_SILU_TILE 256
+
+/* GELU uses the tanh form, 0.5*x*(1 + tanh(sqrt(2/pi)*(x + 0.044715*x^3))),
+ * written as x*sigmoid(2*sqrt(2/pi)*(x + 0.044715*x^3)) */
+#if !HAVE_VFPU
+DISCARD_FUN_FOR_NONVOID_RETURN(WORD32,xa_nn_vec_gelu_f32_f32,(
+    FLOAT32       *  p_out,
+    const FLOAT32 *  p_vec,
+    WORD32        vec_length)                  )
+#else
+WORD32 xa_nn_vec_gelu_f32_f32(
+    FLOAT32       * __restrict__ p_out,        /* result, floating point */
+    const FLOAT32 * __restrict__ p_vec,        /* input data, floating point */
+    WORD32        vec_length)                  /* length of vectors */
+{
+  FLOAT32 ALIGN(16) arg[GELU_SILU_TILE];
+  FLOAT32 ALIGN(16) sig[GELU_SILU_TILE];
+  const FLOAT32 c2 = 1.5957691216f;
+  const FLOAT32 c1c2 = 0.0713548162f;
+  int i, j, n;
+
+  /* NULL pointer checks */
+  XA_NNLIB_ARG_CHK_PTR(p_out, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_vec, -1);
+  /* Pointer alignment checks */
+  XA_NNLIB_ARG_CHK_ALIGN(p_out, sizeof(FLOAT32), -1);
+  XA_NNLIB_ARG_CHK_ALIGN(p_vec, sizeof(FLOAT32), -1);
+  /* Basic Parameter checks */
+  XA_NNLIB_ARG_CHK_COND((vec_length <= 0), -1);
+
+  for(j = 0; j < vec_length; j += n)
+  {
+    n = vec_length - j < GELU_SILU_TILE ? vec_length - j : GELU_SILU_TILE;
+    for(i = 0; i < n; i++)
+    {
+      FLOAT32 x = p_vec[j + i];
+      arg[i] = x * (c2 + c1c2 * x * x);
+    }
+    xa_nnlib_vec_sigmoidf(sig, arg, n);
+    for(i = 0; i < n; i++)
+    {
+      p_out[j + i] = p_vec[j + i] * sig[i];
+    }
+  }
+  return 0;
+}
+#endif /* !HAVE_VFPU */
+
+#if !HAVE_VFPU
+DISCARD_FUN_FOR_NONVOID_RETURN(WORD32,xa_nn_vec_silu_f32_f32,(
+    FLOAT32       *  p_out,
+    const FLOAT32 *  p_vec,
+    WORD32        vec_length)                  )
+#else
+WORD32 xa_nn_vec_silu_f32_f32(
+    FLOAT32       * __restrict__ p_out,        /* result, floating point */
+    const FLOAT32 * __restrict__ p_vec,        /* input data, floating point */
+    WORD32        vec_length)                  /* length of vectors */
+{
+  FLOAT32 ALIGN(16) sig[GELU_SILU_TILE];
+  int i, j, n;
+
+  /* NULL pointer checks */
+  XA_NNLIB_ARG_CHK_PTR(p_out, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_vec, -1);
+  /* Pointer alignment checks */
+  XA_NNLIB_ARG_CHK_ALIGN(p_out, sizeof(FLOAT32), -1);
+  XA_NNLIB_ARG_CHK_ALIGN(p_vec, sizeof(FLOAT32), -1);
+  /* Basic Parameter checks */
+  XA_NNLIB_ARG_CHK_COND((vec_length <= 0), -1);
+
+  for(j = 0; j < vec_length; j += n)
+  {
+    n = vec_length - j < GELU_SILU_TILE ? vec_length - j : GELU_SILU_TILE;
+    xa_nnlib_vec_sigmoidf(sig, &p_vec[j], n);
+    for(i = 0; i < n; i++)
+    {
+      p_out[j + i] = p_vec[j + i] * sig[i];
+    }
+  }
+  return 0;
+}
+#endif /* !HAVE_VFPU */
+
 #if !HAVE_VFPU
 DISCARD_FUN_FOR_NONVOID_RETURN(WORD32,xa_nn_vec_relu_std_f32_f32,(
     FLOAT32       *  p_out,
@@ -0,0 +1,350 @@
+/*******************************************************************************
+* Copyright (c) 2018-2025 Cadence Design Systems, Inc.
+*
+* Permission is hereby granted, free of charge, to any person obtaining
+* a copy of this software and associated documentation files (the
+* "Software"), to use this Software with Cadence processor cores only and
+* not with any other processors and platforms, subject to
+* the following conditions:
+*
+* The above copyright notice and this permission notice shall be included
+* in all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+******************************************************************************/
+#include "xa_type_def.h"
+#include "xa_nnlib_common.h"
+#include "xa_nnlib_err_chk.h"
+#include "xa_nnlib_kernels_api.h"
+#include "xa_nnlib_common_macros_hifi5.h"
+#include "xa_nnlib_common_act_lut.h"
+#include <string.h>
+
+/* GELU (tanh form) and SiLU are both written as x * sigmoid(g(x)):
+ *   SiLU: g(x) = x
+ *   GELU: g(x) = 2*sqrt(2/pi)*(x + 0.044715*x^3)
+ * and sigmoid(g) = (1 + tanh(g/2)) / 2. g/2 is computed in Q3.12 and fed to
+ * xa_nn_vec_tanh_sym16s_sym16s so the TIE / LUT path is shared with the
+ * existing kernels; this covers |g| < 16 with a Q16 sigmoid. The 8-bit
+ * kernels build a 256-entry table with the same code.
+ * input_multiplier/input_shift quantize the input scale, out_multiplier/
+ * out_shift the ratio of input to output scale. */
+
+#define GS_TILE         256
+#define GS_ARG_MAX      32768       /* 8.0 in Q3.12 */
+#define GS_SIG_ONE      65536       /* 1.0 in Q16 */
+#define GS_GELU_C1_Q31  96024731    /* 0.044715 */
+#define GS_GELU_C2_Q29  856722024   /* 2*sqrt(2/pi) */
+
+/* p_x holds zero-point corrected inputs and is zero padded here to a multiple
+ * of 4, p_res gets the requantized result without the output zero bias,
+ * n <= GS_TILE */
+static void gs_tile(WORD32 *p_res,
+    WORD32 *p_x,
+    WORD32 n,
+    WORD32 is_gelu,
+    WORD32 input_multiplier,
+    WORD32 input_shift,
+    WORD32 out_multiplier,
+    WORD32 out_shift)
+{
+  WORD16 ALIGN(16) arg[GS_TILE];
+  WORD16 ALIGN(16) th[GS_TILE];
+  const ae_int32x4 *p_x4;
+  ae_int32x4 *p_r4;
+  ae_int16x4 *p_a4;
+  const ae_int16x4 *p_t4;
+  WORD32 i;
+
+  /* The Q16 sigmoid is folded into the output shift, products are rounded
+   * first by the part of that shift beyond 31 */
+  WORD32 o_shift = out_shift - 16;
+  WORD32 pre_shift = o_shift < -31 ? -31 - o_shift : 0;
+  o_shift += pre_shift;
+
+#if TFLITE_SINGLE_ROUNDING
+  int i_left_shift = input_shift;
+  int i_right_shift = input_shift;
+  int o_left_shift = o_shift;
+  int o_right_shift = o_shift;
+  /* Single rounding macro doesn't need two shifts so this is not used */
+  (void)i_right_shift;
+  (void)o_right_shift;
+#else /* #if TFLITE_SINGLE_ROUNDING */
+  int i_left_shift = input_shift < 0 ? 0 : input_shift;
+  int i_right_shift = input_shift > 0 ? 0 : -input_shift;
+  int o_left_shift = o_shift < 0 ? 0 : o_shift;
+  int o_right_shift = o_shift > 0 ? 0 : -o_shift;
+#endif /* #if TFLITE_SINGLE_ROUNDING */
+
+  ae_int32x2 z_lim = SW_MOVDA32(is_gelu ? 4 * GS_ARG_MAX : 8 * GS_ARG_MAX);
+  ae_int32x2 arg_max = SW_MOVDA32(GS_ARG_MAX);
+  ae_int32x2 arg_min = SW_MOVDA32(-GS_ARG_MAX);
+  ae_f32x2 c1 = AE_MOVF32X2_FROMINT32X2(SW_MOVDA32(GS_GELU_C1_Q31));
+  ae_f32x2 c2 = AE_MOVF32X2_FROMINT32X2(SW_MOVDA32(GS_GELU_C2_Q29));
+
+  for(i = n; i & 3; i++)
+    p_x[i] = 0;
+
+  /* g(x)/2 in Q3.12, saturated to +/-GS_ARG_MAX */
+  p_x4 = (const ae_int32x4 *)p_x;
+  p_r4 = (ae_int32x4 *)p_res;
+  p_a4 = (ae_int16x4 *)arg;
+  for(i = 0; i < n; i += 4)
+  {
+    ae_int32x2 d_x0, d_x1, d_z0, d_z1;
+
+    AE_L32X2X2_IP(d_x0, d_x1, p_x4, 4 * sizeof(WORD32));
+    /* g is evaluated in Q13, |g| < 32 here */
+    d_x0 = AE_SLAI32(d_x0, 13);
+    d_x1 = AE_SLAI32(d_x1, 13);
+    MPY_BY_QUANT_MULT_X2X2_OUT32(d_z0, d_z1, d_x0, d_x1, input_multiplier, i_left_shift, i_right_shift);
+    d_z0 = AE_MAX32(AE_MIN32(d_z0, z_lim), AE_NEG32(z_lim));
+    d_z1 = AE_MAX32(AE_MIN32(d_z1, z_lim), AE_NEG32(z_lim));
+
+    if(is_gelu)
+    {
+      /* z in Q5.26, z^2 in Q10.21, z^3 and u in Q16, g in Q14 */
+      ae_f32x2 d_q0, d_q1, d_t0, d_t1;
+
+      d_q0 = AE_MOVF32X2_FROMINT32X2(AE_SLAI32(d_z0, 13));
+      d_q1 = AE_MOVF32X2_FROMINT32X2(AE_SLAI32(d_z1, 13));
+      AE_MULF2P32X4RAS(d_t0, d_t1, d_q0, d_q1, d_q0, d_q1);
+      AE_MULF2P32X4RAS(d_t0, d_t1, d_t0, d_t1, d_q0, d_q1);
+      AE_MULF2P32X4RAS(d_t0, d_t1, d_t0, d_t1, c1, c1);
+      d_t0 = AE_ADD32S(d_t0, AE_MOVF32X2_FROMINT32X2(AE_SLAI32(d_z0, 3)));
+      d_t1 = AE_ADD32S(d_t1, AE_MOVF32X2_FROMINT32X2(AE_SLAI32(d_z1, 3)));
+      AE_MULF2P32X4RAS(d_t0, d_t1, d_t0, d_t1, c2, c2);
+      d_z0 = AE_SRAI32R(AE_MOVINT32X2_FROMF32X2(d_t0), 3);
+      d_z1 = AE_SRAI32R(AE_MOVINT32X2_FROMF32X2(d_t1), 3);
+    }
+    else
+    {
+      d_z0 = AE_SRAI32R(d_z0, 2);
+      d_z1 = AE_SRAI32R(d_z1, 2);
+    }
+    d_z0 = AE_MAX32(AE_MIN32(d_z0, arg_max), arg_min);
+    d_z1 = AE_MAX32(AE_MIN32(d_z1, arg_max), arg_min);
+
+    AE_S32X2X2_IP(d_z0, d_z1, p_r4, 4 * sizeof(WORD32));
+    /* +GS_ARG_MAX saturates to the largest tanh input */
+    AE_S16X4_IP(AE_SAT16X4(d_z0, d_z1), p_a4, 4 * sizeof(WORD16));
+  }
+
+  xa_nn_vec_tanh_sym16s_sym16s(th, arg, 0, 0, n);
+
+  /* x * (1 + tanh(g/2)) / 2, requantized */
+  p_x4 = (const ae_int32x4 *)p_x;
+  p_r4 = (ae_int32x4 *)p_res;
+  p_t4 = (const ae_int16x4 *)th;
+  for(i = 0; i < n; i += 4)
+  {
+    ae_int16x4 d_th;
+    ae_int32x2 d_x0, d_x1, d_r0, d_r1, d_s0, d_s1;
+    xtbool2 b0, b1;
+
+    AE_L16X4_IP(d_th, p_t4, 4 * sizeof(WORD16));
+    AE_L32X2X2_IP(d_x0, d_x1, p_x4, 4 * sizeof(WORD32));
+    AE_L32X2X2_I(d_r0, d_r1, p_r4, 0);
+
+    AE_MUL16X4(d_s0, d_s1, d_th, AE_MOVDA16(1));
+    d_s0 = AE_ADD32(d_s0, SW_MOVDA32(32768));
+    d_s1 = AE_ADD32(d_s1, SW_MOVDA32(32768));
+    /* Sigmoid is exactly 1 or 0 where g/2 saturated */
+    b0 = AE_EQ32(d_r0, arg_max);
+    b1 = AE_EQ32(d_r1, arg_max);
+    AE_MOVT32X2(d_s0, SW_MOVDA32(GS_SIG_ONE), b0);
+    AE_MOVT32X2(d_s1, SW_MOVDA32(GS_SIG_ONE), b1);
+    b0 = AE_EQ32(d_r0, arg_min);
+    b1 = AE_EQ32(d_r1, arg_min);
+    AE_MOVT32X2(d_s0, AE_ZERO32(), b0);
+    AE_MOVT32X2(d_s1, AE_ZERO32(), b1);
+
+    /* |x| <= 32768, so x * s fits in 32 bits */
+    AE_MUL2P32X4S(d_s0, d_s1, d_x0, d_x1, d_s0, d_s1);
+    d_s0 = AE_SRAA32SYMS(d_s0, pre_shift);
+    d_s1 = AE_SRAA32SYMS(d_s1, pre_shift);
+    MPY_BY_QUANT_MULT_X2X2_OUT32(d_r0, d_r1, d_s0, d_s1, out_multiplier, o_left_shift, o_right_shift);
+    AE_S32X2X2_IP(d_r0, d_r1, p_r4, 4 * sizeof(WORD32));
+  }
+}
+
+static WORD32 gs_asym8s(WORD8 * __restrict__ p_out,
+    const WORD8 * __restrict__ p_vec,
+    WORD32 is_gelu,
+    WORD32 inp_zero_bias,
+    WORD32 input_multiplier,
+    WORD32 input_shift,
+    WORD32 out_multiplier,
+    WORD32 out_shift,
+    WORD32 out_zero_bias,
+    WORD32 vec_length)
+{
+  WORD32 ALIGN(16) x[GS_TILE];
+  WORD32 ALIGN(16) res[GS_TILE];
+  WORD8 ALIGN(16) lut[GS_TILE];
+  WORD32 i, y;
+
+  /* NULL pointer checks */
+  XA_NNLIB_ARG_CHK_PTR(p_out, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_vec, -1);
+  /* Basic Parameter checks */
+  XA_NNLIB_ARG_CHK_COND((vec_length <= 0), -1);
+  XA_NNLIB_ARG_CHK_COND(((inp_zero_bias < -128) || (inp_zero_bias > 127)), -1);
+  XA_NNLIB_ARG_CHK_COND((input_multiplier < 0), -1);
+  XA_NNLIB_ARG_CHK_COND(((input_shift < -31) || (input_shift > 31)), -1);
+  XA_NNLIB_ARG_CHK_COND((out_multiplier < 0), -1);
+  XA_NNLIB_ARG_CHK_COND(((out_shift < -31) || (out_shift > 31)), -1);
+  XA_NNLIB_ARG_CHK_COND(((out_zero_bias < -128) || (out_zero_bias > 127)), -1);
+
+  /* Short vectors are cheaper to evaluate directly than to tabulate */
+  if(vec_length < GS_TILE)
+  {
+    for(i = 0; i < vec_length; i++)
+      x[i] = p_vec[i] - inp_zero_bias;
+    gs_tile(res, x, vec_length, is_gelu, input_multiplier, input_shift, out_multiplier, out_shift);
+    for(i = 0; i < vec_length; i++)
+    {
+      y = res[i] + out_zero_bias;
+      p_out[i] = (WORD8)(y > 127 ? 127 : (y < -128 ? -128 : y));
+    }
+    return 0;
+  }
+
+  for(i = 0; i < GS_TILE; i++)
+    x[i] = i - 128 - inp_zero_bias;
+  gs_tile(res, x, GS_TILE, is_gelu, input_multiplier, input_shift, out_multiplier, out_shift);
+  for(i = 0; i < GS_TILE; i++)
+  {
+    y = res[i] + out_zero_bias;
+    lut[i] = (WORD8)(y > 127 ? 127 : (y < -128 ? -128 : y));
+  }
+
+  memcpy(p_out, p_vec, vec_length);
+  xa_nn_act_lut_asym8s(p_out, &lut[128], 0, vec_length);
+  return 0;
+}
+
+static WORD32 gs_sym16s(WORD16 * __restrict__ p_out,
+    const WORD16 * __restrict__ p_vec,
+    WORD32 is_gelu,
+    WORD32 input_multiplier,
+    WORD32 input_shift,
+    WORD32 out_multiplier,
+    WORD32 out_shift,
+    WORD32 vec_length)
+{
+  WORD32 ALIGN(16) x[GS_TILE];
+  WORD32 ALIGN(16) res[GS_TILE];
+  WORD32 i, j, n, y;
+  const ae_int16x4 *p_i = (const ae_int16x4 *)p_vec;
+  ae_int16x4 *p_o = (ae_int16x4 *)p_out;
+  ae_valign a_i, a_o;
+
+  /* NULL pointer checks */
+  XA_NNLIB_ARG_CHK_PTR(p_out, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_vec, -1);
+  /* Pointer alignment checks */
+  XA_NNLIB_ARG_CHK_ALIGN(p_out, sizeof(WORD16), -1);
+  XA_NNLIB_ARG_CHK_ALIGN(p_vec, sizeof(WORD16), -1);
+  /* Basic Parameter checks */
+  XA_NNLIB_ARG_CHK_COND((vec_length <= 0), -1);
+  XA_NNLIB_ARG_CHK_COND((input_multiplier < 0), -1);
+  XA_NNLIB_ARG_CHK_COND(((input_shift < -31) || (input_shift > 31)), -1);
+  XA_NNLIB_ARG_CHK_COND((out_multiplier < 0), -1);
+  XA_NNLIB_ARG_CHK_COND(((out_shift < -31) || (out_shift > 31)), -1);
+
+  a_i = AE_LA64_PP(p_i);
+  for(j = 0; j < vec_length; j += n)
+  {
+    ae_int32x4 *p_x4 = (ae_int32x4 *)x;
+    const ae_int32x4 *p_r4 = (const ae_int32x4 *)res;
+    ae_int16x4 d_v;
+    ae_int32x2 d_0, d_1;
+
+    n = vec_length - j < GS_TILE ? vec_length - j : GS_TILE;
+    for(i = 0; i < (n >> 2); i++)
+    {
+      AE_LA16X4_IP(d_v, a_i, p_i);
+      AE_MUL16X4(d_0, d_1, d_v, AE_MOVDA16(1));
+      AE_S32X2X2_IP(d_0, d_1, p_x4, 4 * sizeof(WORD32));
+    }
+    for(i = i << 2; i < n; i++)
+      x[i] = p_vec[j + i];
+
+    gs_tile(res, x, n, is_gelu, input_multiplier, input_shift, out_multiplier, out_shift);
+
+    a_o = AE_ZALIGN64();
+    for(i = 0; i < (n >> 2); i++)
+    {
+      AE_L32X2X2_IP(d_0, d_1, p_r4, 4 * sizeof(WORD32));
+      AE_SA16X4_IP(AE_SAT16X4(d_0, d_1), a_o, p_o);
+    }
+    AE_SA64POS_FP(a_o, p_o);
+    for(i = i << 2; i < n; i++)
+    {
+      y = res[i];
+      p_out[j + i] = (WORD16)(y > 32767 ? 32767 : (y < -32768 ? -32768 : y));
+    }
+  }
+  return 0;
+}
+
+WORD32 xa_nn_vec_gelu_asym8s_asym8s(WORD8 * __restrict__ p_out,
+    const WORD8 * __restrict__ p_vec,
+    WORD32 inp_zero_bias,
+    WORD32 input_multiplier,
+    WORD32 input_shift,
+    WORD32 out_multiplier,
+    WORD32 out_shift,
+    WORD32 out_zero_bias,
+    WORD32 vec_length)
+{
+  return gs_asym8s(p_out, p_vec, 1, inp_zero_bias, input_multiplier, input_shift,
+      out_multiplier, out_shift, out_zero_bias, vec_length);
+}
+
+WORD32 xa_nn_vec_silu_asym8s_asym8s(WORD8 * __restrict__ p_out,
+    const WORD8 * __restrict__ p_vec,
+    WORD32 inp_zero_bias,
+    WORD32 input_multiplier,
+    WORD32 input_shift,
+    WORD32 out_multiplier,
+    WORD32 out_shift,
+    WORD32 out_zero_bias,
+    WORD32 vec_length)
+{
+  return gs_asym8s(p_out, p_vec, 0, inp_zero_bias, input_multiplier, input_shift,
+      out_multiplier, out_shift, out_zero_bias, vec_length);
+}
+
+WORD32 xa_nn_vec_gelu_sym16s_sym16s(WORD16 * __restrict__ p_out,
+    const WORD16 * __restrict__ p_vec,
+    WORD32 input_multiplier,
+    WORD32 input_shift,
+    WORD32 out_multiplier,
+    WORD32 out_shift,
+    WORD32 vec_length)
+{
+  return gs_sym16s(p_out, p_vec, 1, input_multiplier, input_shift,
+      out_multiplier, out_shift, vec_length);
+}
+
+WORD32 xa_nn_vec_silu_sym16s_sym16s(WORD16 * __restrict__ p_out,
+    const WORD16 * __restrict__ p_vec,
+    WORD32 input_multiplier,
+    WORD32 input_shift,
+    WORD32 out_multiplier,
+    WORD32 out_shift,
+    WORD32 vec_length)
+{
+  return gs_sym16s(p_out, p_vec, 0, input_multiplier, input_shift,
+      out_multiplier, out_shift, vec_length);
+}
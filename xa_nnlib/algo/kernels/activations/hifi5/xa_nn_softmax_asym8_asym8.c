@@ -1049,6 +1049,19 @@ int get_softmax_scratch_size(int inp_precision, int out_precision, int length)
     return total_bytes;
 }
 
+/* Logits of the fused classifier head followed by the softmax scratch */
+int xa_nn_fully_connected_v2_softmax_getsize(int out_depth, int out_precision)
+{
+    XA_NNLIB_CHK_COND((out_depth <= 0), -1);
+    XA_NNLIB_CHK_COND((out_precision != PREC_ASYM8S && out_precision != PREC_16), -1);
+
+    int softmax_bytes = get_softmax_scratch_size(PREC_ASYM8S, out_precision, out_depth);
+    if(softmax_bytes < 0)
+        return -1;
+
+    return ALIGNED_SIZE(out_depth, ALIGNMENT) + softmax_bytes;
+}
+
 
 
 
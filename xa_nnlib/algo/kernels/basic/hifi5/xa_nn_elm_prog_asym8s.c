@@ -0,0 +1,219 @@
+/*******************************************************************************
+* Copyright (c) 2018-2025 Cadence Design Systems, Inc.
+*
+* Permission is hereby granted, free of charge, to any person obtaining
+* a copy of this software and associated documentation files (the
+* "Software"), to use this Software with Cadence processor cores only and
+* not with any other processors and platforms, subject to
+* the following conditions:
+*
+* The above copyright notice and this permission notice shall be included
+* in all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+******************************************************************************/
+#include "xa_nnlib_common.h"
+#include "xa_nn_basic_state.h"
+#include <string.h>
+
+#define ELM_PROG_TILE 128
+#define ELM_PROG_NUM_REGS (XA_NN_ELM_PROG_MAX_INPS + XA_NN_ELM_PROG_MAX_TEMPS)
+
+static WORD32 elm_prog_is_binary(WORD32 opcode)
+{
+  return (opcode == ELM_PROG_ADD || opcode == ELM_PROG_SUB || opcode == ELM_PROG_MUL ||
+          opcode == ELM_PROG_MIN || opcode == ELM_PROG_MAX);
+}
+
+static WORD32 elm_prog_exec(WORD8 * __restrict__ p_dst,
+    const WORD8 * __restrict__ p_src0,
+    const WORD8 * __restrict__ p_src1,
+    const xa_nn_elm_prog_instr_t *p_ins,
+    WORD32 num_elm)
+{
+  switch(p_ins->opcode)
+  {
+    case ELM_PROG_ADD:
+      return xa_nn_elm_add_asym8sxasym8s_asym8s(p_dst, p_ins->out_zero_bias, p_ins->out_shift,
+          p_ins->out_multiplier, p_ins->out_activation_min, p_ins->out_activation_max,
+          p_src0, p_ins->inp1_zero_bias, p_ins->inp1_left_shift, p_ins->inp1_multiplier,
+          p_src1, p_ins->inp2_zero_bias, p_ins->inp2_left_shift, p_ins->inp2_multiplier,
+          p_ins->left_shift, num_elm);
+    case ELM_PROG_SUB:
+      return xa_nn_elm_sub_asym8sxasym8s_asym8s(p_dst, p_ins->out_zero_bias, p_ins->out_shift,
+          p_ins->out_multiplier, p_ins->out_activation_min, p_ins->out_activation_max,
+          p_src0, p_ins->inp1_zero_bias, p_ins->inp1_left_shift, p_ins->inp1_multiplier,
+          p_src1, p_ins->inp2_zero_bias, p_ins->inp2_left_shift, p_ins->inp2_multiplier,
+          p_ins->left_shift, num_elm);
+    case ELM_PROG_MUL:
+      return xa_nn_elm_mul_asym8sxasym8s_asym8s(p_dst, p_ins->out_zero_bias, p_ins->out_shift,
+          p_ins->out_multiplier, p_ins->out_activation_min, p_ins->out_activation_max,
+          p_src0, p_ins->inp1_zero_bias, p_src1, p_ins->inp2_zero_bias, num_elm);
+    case ELM_PROG_MIN:
+      return xa_nn_elm_min_8x8_8(p_dst, p_src0, p_src1, num_elm);
+    case ELM_PROG_MAX:
+      return xa_nn_elm_max_8x8_8(p_dst, p_src0, p_src1, num_elm);
+    case ELM_PROG_CLAMP:
+      return xa_nn_vec_activation_min_max_8_8(p_dst, p_src0, p_ins->out_activation_min,
+          p_ins->out_activation_max, num_elm);
+    case ELM_PROG_SIGMOID:
+      return xa_nn_vec_sigmoid_asym8s_asym8s(p_dst, p_src0, p_ins->inp1_zero_bias,
+          p_ins->input_range_radius, p_ins->input_multiplier, p_ins->input_left_shift, num_elm);
+    case ELM_PROG_TANH:
+      return xa_nn_vec_tanh_asym8s_asym8s(p_dst, p_src0, p_ins->inp1_zero_bias,
+          p_ins->input_range_radius, p_ins->input_multiplier, p_ins->input_left_shift, num_elm);
+    default:
+      return -1;
+  }
+}
+
+/*
+ * Runs a chain of asym8s elementwise ops over the output one tile of the
+ * innermost dimension at a time, so temporaries stay in local buffers and
+ * the output is written once. Input broadcasting follows the 4D stride
+ * scheme of CALL_BCAST.
+ */
+WORD32 xa_nn_elm_prog_asym8s(WORD8 * __restrict__ p_out,
+                      const WORD32 *const p_out_shape,
+                      const WORD8 **pp_inps,
+                      const WORD32 **pp_inp_shapes,
+                      WORD32 num_inps,
+                      const xa_nn_elm_prog_instr_t *p_prog,
+                      WORD32 num_instrs)
+{
+  WORD8 ALIGN(16) tmp_buf[XA_NN_ELM_PROG_MAX_TEMPS][ELM_PROG_TILE];
+  WORD8 ALIGN(16) bcast_buf[XA_NN_ELM_PROG_MAX_INPS][ELM_PROG_TILE];
+  const WORD8 *p_regs[ELM_PROG_NUM_REGS];
+  WORD32 inp_strides[XA_NN_ELM_PROG_MAX_INPS][4];
+  WORD32 num_regs, written;
+  WORD32 i, j, ret;
+
+  /* NULL pointer checks */
+  XA_NNLIB_ARG_CHK_PTR(p_out, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_out_shape, -1);
+  XA_NNLIB_ARG_CHK_PTR(pp_inps, -1);
+  XA_NNLIB_ARG_CHK_PTR(pp_inp_shapes, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_prog, -1);
+  /* Basic Parameter checks */
+  XA_NNLIB_ARG_CHK_COND(((num_inps <= 0) || (num_inps > XA_NN_ELM_PROG_MAX_INPS)), -1);
+  XA_NNLIB_ARG_CHK_COND(((num_instrs <= 0) || (num_instrs > XA_NN_ELM_PROG_MAX_INSTRS)), -1);
+  for(i = 0; i < 4; i++)
+  {
+    XA_NNLIB_ARG_CHK_COND((p_out_shape[i] <= 0), -1);
+  }
+  for(j = 0; j < num_inps; j++)
+  {
+    XA_NNLIB_ARG_CHK_PTR(pp_inps[j], -1);
+    XA_NNLIB_ARG_CHK_PTR(pp_inp_shapes[j], -1);
+    for(i = 0; i < 4; i++)
+    {
+      XA_NNLIB_ARG_CHK_COND(((pp_inp_shapes[j][i] != p_out_shape[i]) && (pp_inp_shapes[j][i] != 1)), -1);
+    }
+  }
+
+  /* Program checks: every source must be written before it is read,
+   * temporaries are the only destinations and never alias a source */
+  num_regs = num_inps + XA_NN_ELM_PROG_MAX_TEMPS;
+  written = (1 << num_inps) - 1;
+  for(i = 0; i < num_instrs; i++)
+  {
+    const xa_nn_elm_prog_instr_t *p_ins = &p_prog[i];
+    WORD32 binary = elm_prog_is_binary(p_ins->opcode);
+    XA_NNLIB_ARG_CHK_COND(((p_ins->opcode < ELM_PROG_ADD) || (p_ins->opcode > ELM_PROG_TANH)), -1);
+    XA_NNLIB_ARG_CHK_COND(((p_ins->src0 < 0) || (p_ins->src0 >= num_regs)), -1);
+    XA_NNLIB_ARG_CHK_COND((!((written >> p_ins->src0) & 1)), -1);
+    if(binary)
+    {
+      XA_NNLIB_ARG_CHK_COND(((p_ins->src1 < 0) || (p_ins->src1 >= num_regs)), -1);
+      XA_NNLIB_ARG_CHK_COND((!((written >> p_ins->src1) & 1)), -1);
+    }
+    if(i < num_instrs - 1)
+    {
+      XA_NNLIB_ARG_CHK_COND(((p_ins->dst < num_inps) || (p_ins->dst >= num_regs)), -1);
+      XA_NNLIB_ARG_CHK_COND((p_ins->dst == p_ins->src0), -1);
+      XA_NNLIB_ARG_CHK_COND((binary && (p_ins->dst == p_ins->src1)), -1);
+      written |= 1 << p_ins->dst;
+    }
+  }
+
+  /* Input strides, 0 along broadcast dimensions */
+  WORD32 need_broadcast = 0;
+  for(j = 0; j < num_inps; j++)
+  {
+    WORD32 stride = 1;
+    for(i = 3; i >= 0; i--)
+    {
+      inp_strides[j][i] = (pp_inp_shapes[j][i] == 1 && p_out_shape[i] != 1) ? 0 : stride;
+      stride *= pp_inp_shapes[j][i];
+      if(pp_inp_shapes[j][i] != p_out_shape[i])
+        need_broadcast = 1;
+    }
+  }
+
+  WORD32 d0 = p_out_shape[0], d1 = p_out_shape[1], d2 = p_out_shape[2], d3 = p_out_shape[3];
+  if(need_broadcast == 0)
+  {
+    /* Flat tensors, run the program over one row of all elements */
+    d3 = d0 * d1 * d2 * d3;
+    d0 = d1 = d2 = 1;
+  }
+
+  for(i = 0; i < XA_NN_ELM_PROG_MAX_TEMPS; i++)
+  {
+    p_regs[num_inps + i] = tmp_buf[i];
+  }
+
+  WORD8 *p_out_row = p_out;
+  WORD32 itr0, itr1, itr2, col;
+  for(itr0 = 0; itr0 < d0; itr0++)
+  {
+    for(itr1 = 0; itr1 < d1; itr1++)
+    {
+      for(itr2 = 0; itr2 < d2; itr2++)
+      {
+        for(col = 0; col < d3; col += ELM_PROG_TILE)
+        {
+          WORD32 num_elm = XT_MIN(ELM_PROG_TILE, d3 - col);
+
+          /* Point each input register at its tile, splat inputs broadcast
+           * along the innermost dimension */
+          for(j = 0; j < num_inps; j++)
+          {
+            const WORD8 *p_inp = pp_inps[j] + itr0 * inp_strides[j][0]
+                                            + itr1 * inp_strides[j][1]
+                                            + itr2 * inp_strides[j][2];
+            if(inp_strides[j][3] == 0)
+            {
+              memset(bcast_buf[j], *p_inp, num_elm);
+              p_regs[j] = bcast_buf[j];
+            }
+            else
+            {
+              p_regs[j] = p_inp + col;
+            }
+          }
+
+          for(i = 0; i < num_instrs; i++)
+          {
+            const xa_nn_elm_prog_instr_t *p_ins = &p_prog[i];
+            WORD8 *p_dst = (i == num_instrs - 1) ? &p_out_row[col] : (WORD8 *)p_regs[p_ins->dst];
+            const WORD8 *p_src1 = elm_prog_is_binary(p_ins->opcode) ? p_regs[p_ins->src1] : NULL;
+            ret = elm_prog_exec(p_dst, p_regs[p_ins->src0], p_src1, p_ins, num_elm);
+            if(ret != 0)
+              return -1;
+          }
+        }
+        p_out_row += d3;
+      }
+    }
+  }
+
+  return 0;
+}
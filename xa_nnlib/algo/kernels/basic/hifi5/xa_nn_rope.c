@@ -0,0 +1,237 @@
+/*******************************************************************************
+* Copyright (c) 2018-2025 Cadence Design Systems, Inc.
+*
+* Permission is hereby granted, free of charge, to any person obtaining
+* a copy of this software and associated documentation files (the
+* "Software"), to use this Software with Cadence processor cores only and
+* not with any other processors and platforms, subject to
+* the following conditions:
+*
+* The above copyright notice and this permission notice shall be included
+* in all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+******************************************************************************/
+#include "xa_nnlib_common_fpu.h"
+#include "xa_nnlib_common.h"
+
+/*
+ * Rotary positional embedding. Input and output are
+ * num_heads x seq_len x head_dim, row s of every head is at position
+ * pos_offset + s. p_cos and p_sin hold head_dim / 2 entries per position,
+ * entry k rotating pair (2k, 2k + 1) when interleaved, else (k, k + head_dim / 2).
+ * p_out may be equal to p_inp.
+ */
+
+static inline WORD16 rope_sat16(WORD32 x)
+{
+  x = x > 32767 ? 32767 : x;
+  x = x < -32768 ? -32768 : x;
+  return (WORD16)x;
+}
+
+/* Q15 rotation of 4 pairs with Q31 products, rounded as (v + 2^14) >> 15.
+ * Sums beyond +/-1.0 saturate where the Q15 result does, only a -1.0 * -1.0
+ * product is 1 LSB below 1.0 in Q31 */
+#define ROPE_ROTATE_Q15X4(d_xr, d_yr, d_x, d_y, d_c, d_s) \
+{ \
+  ae_f32x2 d_p0, d_p1, d_q0, d_q1; \
+  AE_MULF16X4SS(d_p0, d_p1, AE_MOVF16X4_FROMINT16X4(d_x), AE_MOVF16X4_FROMINT16X4(d_c)); \
+  AE_MULF16X4SS(d_q0, d_q1, AE_MOVF16X4_FROMINT16X4(d_y), AE_MOVF16X4_FROMINT16X4(d_s)); \
+  d_xr = AE_MOVINT16X4_FROMF16X4(AE_ROUND16X4F32SASYM(AE_SUB32S(d_p0, d_q0), AE_SUB32S(d_p1, d_q1))); \
+  AE_MULF16X4SS(d_p0, d_p1, AE_MOVF16X4_FROMINT16X4(d_x), AE_MOVF16X4_FROMINT16X4(d_s)); \
+  AE_MULF16X4SS(d_q0, d_q1, AE_MOVF16X4_FROMINT16X4(d_y), AE_MOVF16X4_FROMINT16X4(d_c)); \
+  d_yr = AE_MOVINT16X4_FROMF16X4(AE_ROUND16X4F32SASYM(AE_ADD32S(d_p0, d_q0), AE_ADD32S(d_p1, d_q1))); \
+}
+
+WORD32 xa_nn_rope_sym16s_sym16s(
+    WORD16 *p_out,
+    const WORD16 *p_inp,
+    const WORD16 * __restrict__ p_cos,
+    const WORD16 * __restrict__ p_sin,
+    WORD32 num_heads,
+    WORD32 seq_len,
+    WORD32 head_dim,
+    WORD32 pos_offset,
+    WORD32 interleaved)
+{
+  /* NULL pointer checks */
+  XA_NNLIB_ARG_CHK_PTR(p_out, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_inp, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_cos, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_sin, -1);
+  /* Pointer alignment checks */
+  XA_NNLIB_ARG_CHK_ALIGN(p_out, sizeof(WORD16), -1);
+  XA_NNLIB_ARG_CHK_ALIGN(p_inp, sizeof(WORD16), -1);
+  XA_NNLIB_ARG_CHK_ALIGN(p_cos, sizeof(WORD16), -1);
+  XA_NNLIB_ARG_CHK_ALIGN(p_sin, sizeof(WORD16), -1);
+  /* Basic Parameter checks */
+  XA_NNLIB_ARG_CHK_COND((num_heads <= 0 || seq_len <= 0), -1);
+  XA_NNLIB_ARG_CHK_COND((head_dim <= 0 || (head_dim & 1)), -1);
+  XA_NNLIB_ARG_CHK_COND((pos_offset < 0), -1);
+  XA_NNLIB_ARG_CHK_COND((interleaved != 0 && interleaved != 1), -1);
+
+  WORD32 half = head_dim >> 1;
+  WORD32 x_step = interleaved ? 2 : 1;
+  WORD32 y_off = interleaved ? 1 : half;
+  WORD32 h, s, k;
+
+  for(h = 0; h < num_heads; h++)
+  {
+    for(s = 0; s < seq_len; s++)
+    {
+      const WORD16 *p_x = p_inp + (h * seq_len + s) * head_dim;
+      WORD16 *p_y = p_out + (h * seq_len + s) * head_dim;
+      const WORD16 *p_c = p_cos + (pos_offset + s) * half;
+      const WORD16 *p_s = p_sin + (pos_offset + s) * half;
+      const ae_int16x4 *p_c4 = (const ae_int16x4 *)p_c;
+      const ae_int16x4 *p_s4 = (const ae_int16x4 *)p_s;
+      ae_valign a_c = AE_LA64_PP(p_c4);
+      ae_valign a_s = AE_LA64_PP(p_s4);
+      ae_int16x4 d_c, d_s, d_x, d_y, d_xr, d_yr;
+
+      /* Each group of 4 pairs is loaded before it is stored, so p_out may
+       * be p_inp */
+      if(interleaved)
+      {
+        const ae_int16x4 *p_i4 = (const ae_int16x4 *)p_x;
+        ae_int16x4 *p_o4 = (ae_int16x4 *)p_y;
+        ae_valign a_i = AE_LA64_PP(p_i4);
+        ae_valign a_o = AE_ZALIGN64();
+        ae_int16x4 d_01, d_23;
+
+        for(k = 0; k < (half >> 2); k++)
+        {
+          AE_LA16X4_IP(d_c, a_c, p_c4);
+          AE_LA16X4_IP(d_s, a_s, p_s4);
+          AE_LA16X4_IP(d_01, a_i, p_i4);
+          AE_LA16X4_IP(d_23, a_i, p_i4);
+          d_x = AE_SEL16_7531(d_01, d_23);
+          d_y = AE_SEL16_6420(d_01, d_23);
+          ROPE_ROTATE_Q15X4(d_xr, d_yr, d_x, d_y, d_c, d_s);
+          d_01 = AE_SEL16_7362(d_xr, d_yr);
+          d_23 = AE_SEL16_7362(AE_SEL16_5432(d_xr, d_xr), AE_SEL16_5432(d_yr, d_yr));
+          AE_SA16X4_IP(d_01, a_o, p_o4);
+          AE_SA16X4_IP(d_23, a_o, p_o4);
+        }
+        AE_SA64POS_FP(a_o, p_o4);
+      }
+      else
+      {
+        const ae_int16x4 *p_ix4 = (const ae_int16x4 *)p_x;
+        const ae_int16x4 *p_iy4 = (const ae_int16x4 *)&p_x[half];
+        ae_int16x4 *p_ox4 = (ae_int16x4 *)p_y;
+        ae_int16x4 *p_oy4 = (ae_int16x4 *)&p_y[half];
+        ae_valign a_ix = AE_LA64_PP(p_ix4);
+        ae_valign a_iy = AE_LA64_PP(p_iy4);
+        ae_valign a_ox = AE_ZALIGN64();
+        ae_valign a_oy = AE_ZALIGN64();
+
+        for(k = 0; k < (half >> 2); k++)
+        {
+          AE_LA16X4_IP(d_c, a_c, p_c4);
+          AE_LA16X4_IP(d_s, a_s, p_s4);
+          AE_LA16X4_IP(d_x, a_ix, p_ix4);
+          AE_LA16X4_IP(d_y, a_iy, p_iy4);
+          ROPE_ROTATE_Q15X4(d_xr, d_yr, d_x, d_y, d_c, d_s);
+          AE_SA16X4_IP(d_xr, a_ox, p_ox4);
+          AE_SA16X4_IP(d_yr, a_oy, p_oy4);
+        }
+        AE_SA64POS_FP(a_ox, p_ox4);
+        AE_SA64POS_FP(a_oy, p_oy4);
+      }
+
+      for(k = k << 2; k < half; k++)
+      {
+        WORD32 i = k * x_step;
+        WORD64 x = p_x[i];
+        WORD64 y = p_x[i + y_off];
+        WORD64 c = p_c[k];
+        WORD64 sn = p_s[k];
+        /* Q15 rotation, the sums reach 2^31 for -32768 operands */
+        WORD64 x_rot = (x * c - y * sn + (1 << 14)) >> 15;
+        WORD64 y_rot = (x * sn + y * c + (1 << 14)) >> 15;
+        p_y[i] = rope_sat16((WORD32)x_rot);
+        p_y[i + y_off] = rope_sat16((WORD32)y_rot);
+      }
+    }
+  }
+  return 0;
+}
+
+#if !HAVE_VFPU
+DISCARD_FUN_FOR_NONVOID_RETURN(
+             WORD32, xa_nn_rope_f32_f32,
+             (
+                FLOAT32 *p_out,
+                const FLOAT32 *p_inp,
+                const FLOAT32 *p_cos,
+                const FLOAT32 *p_sin,
+                WORD32 num_heads,
+                WORD32 seq_len,
+                WORD32 head_dim,
+                WORD32 pos_offset,
+                WORD32 interleaved
+             )
+           )
+#else
+WORD32 xa_nn_rope_f32_f32(
+    FLOAT32 *p_out,
+    const FLOAT32 *p_inp,
+    const FLOAT32 * __restrict__ p_cos,
+    const FLOAT32 * __restrict__ p_sin,
+    WORD32 num_heads,
+    WORD32 seq_len,
+    WORD32 head_dim,
+    WORD32 pos_offset,
+    WORD32 interleaved)
+{
+  /* NULL pointer checks */
+  XA_NNLIB_ARG_CHK_PTR(p_out, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_inp, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_cos, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_sin, -1);
+  /* Pointer alignment checks */
+  XA_NNLIB_ARG_CHK_ALIGN(p_out, sizeof(FLOAT32), -1);
+  XA_NNLIB_ARG_CHK_ALIGN(p_inp, sizeof(FLOAT32), -1);
+  XA_NNLIB_ARG_CHK_ALIGN(p_cos, sizeof(FLOAT32), -1);
+  XA_NNLIB_ARG_CHK_ALIGN(p_sin, sizeof(FLOAT32), -1);
+  /* Basic Parameter checks */
+  XA_NNLIB_ARG_CHK_COND((num_heads <= 0 || seq_len <= 0), -1);
+  XA_NNLIB_ARG_CHK_COND((head_dim <= 0 || (head_dim & 1)), -1);
+  XA_NNLIB_ARG_CHK_COND((pos_offset < 0), -1);
+  XA_NNLIB_ARG_CHK_COND((interleaved != 0 && interleaved != 1), -1);
+
+  WORD32 half = head_dim >> 1;
+  WORD32 x_step = interleaved ? 2 : 1;
+  WORD32 y_off = interleaved ? 1 : half;
+  WORD32 h, s, k;
+
+  for(h = 0; h < num_heads; h++)
+  {
+    for(s = 0; s < seq_len; s++)
+    {
+      const FLOAT32 *p_x = p_inp + (h * seq_len + s) * head_dim;
+      FLOAT32 *p_y = p_out + (h * seq_len + s) * head_dim;
+      const FLOAT32 *p_c = p_cos + (pos_offset + s) * half;
+      const FLOAT32 *p_s = p_sin + (pos_offset + s) * half;
+      for(k = 0; k < half; k++)
+      {
+        WORD32 i = k * x_step;
+        FLOAT32 x = p_x[i];
+        FLOAT32 y = p_x[i + y_off];
+        p_y[i] = x * p_c[k] - y * p_s[k];
+        p_y[i + y_off] = x * p_s[k] + y * p_c[k];
+      }
+    }
+  }
+  return 0;
+}
+#endif /* !HAVE_VFPU */
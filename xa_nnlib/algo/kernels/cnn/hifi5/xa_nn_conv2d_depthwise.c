@@ -693,3 +693,56 @@ WORD32 xa_nn_dilated_conv2d_depthwise_getsize
 
   return total_size;
 }
+
+/* Scratch for xa_nn_conv2d_depthwise_pointwise_v2_per_chan_sym8sxasym8s:
+ * rows_per_block depthwise output rows plus the depthwise scratch for one
+ * block of rows */
+WORD32 xa_nn_conv2d_depthwise_pointwise_getsize
+(WORD32 input_width
+ ,WORD32 input_channels
+ ,WORD32 kernel_height
+ ,WORD32 kernel_width
+ ,WORD32 channels_multiplier
+ ,WORD32 x_stride
+ ,WORD32 y_stride
+ ,WORD32 x_padding
+ ,WORD32 y_padding
+ ,WORD32 output_width
+ ,WORD32 rows_per_block
+ ,WORD32 input_precision
+ )
+{
+  XA_NNLIB_CHK_COND((input_width <= 0), -1);
+  XA_NNLIB_CHK_COND((input_channels <= 0), -1);
+  XA_NNLIB_CHK_COND((kernel_height <= 0), -1);
+  XA_NNLIB_CHK_COND((kernel_width <= 0), -1);
+  XA_NNLIB_CHK_COND((channels_multiplier <= 0), -1);
+  XA_NNLIB_CHK_COND((x_stride <= 0), -1);
+  XA_NNLIB_CHK_COND((y_stride <= 0), -1);
+  XA_NNLIB_CHK_COND((x_padding < 0), -1);
+  XA_NNLIB_CHK_COND((y_padding < 0), -1);
+  XA_NNLIB_CHK_COND((output_width <= 0), -1);
+  XA_NNLIB_CHK_COND((rows_per_block <= 0), -1);
+  XA_NNLIB_CHK_COND((input_precision != PREC_ASYM8S), -1);
+
+  WORD32 dw_scratch_size = xa_nn_conv2d_depthwise_getsize
+    ((rows_per_block - 1) * y_stride + kernel_height
+     ,input_width
+     ,input_channels
+     ,kernel_height
+     ,kernel_width
+     ,channels_multiplier
+     ,x_stride
+     ,y_stride
+     ,x_padding
+     ,y_padding
+     ,rows_per_block
+     ,output_width
+     ,input_precision
+     ,0
+    );
+  if(dw_scratch_size < 0)
+    return -1;
+
+  return ALIGNED_SIZE(rows_per_block * output_width * input_channels * channels_multiplier, ALIGNMENT_16) + dw_scratch_size;
+}
@@ -0,0 +1,187 @@
+/*******************************************************************************
+* Copyright (c) 2018-2025 Cadence Design Systems, Inc.
+*
+* Permission is hereby granted, free of charge, to any person obtaining
+* a copy of this software and associated documentation files (the
+* "Software"), to use this Software with Cadence processor cores only and
+* not with any other processors and platforms, subject to
+* the following conditions:
+*
+* The above copyright notice and this permission notice shall be included
+* in all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+******************************************************************************/
+#include "xa_nnlib_common.h"
+#include "xa_nn_conv2d_depthwise_state.h"
+#include "xa_nnlib_common_macros_hifi5.h"
+
+/* Input rows needed for depthwise output rows starting at input row itr_ih
+ * (may be negative inside the top padding) */
+static void dw_block_inp_rows(
+    WORD32 itr_ih,
+    WORD32 block_height,
+    WORD32 inp_h,
+    WORD32 ker_h,
+    WORD32 y_str,
+    WORD32 *p_inp_h_idx,
+    WORD32 *p_y_padding_cur,
+    WORD32 *p_inp_height_cur)
+{
+  WORD32 inp_h_idx = itr_ih < 0 ? 0 : itr_ih;
+  WORD32 y_padding_cur = itr_ih < 0 ? -itr_ih : 0;
+  WORD32 inp_height_cur = (block_height - 1)*y_str + ker_h - y_padding_cur;
+  inp_height_cur = inp_height_cur > inp_h - inp_h_idx ? inp_h - inp_h_idx : inp_height_cur;
+  *p_inp_h_idx = inp_h_idx;
+  *p_y_padding_cur = y_padding_cur;
+  *p_inp_height_cur = inp_height_cur;
+}
+
+/* Depthwise conv followed by pointwise conv, NHWC input. Depthwise output
+ * is produced rows_per_block rows at a time into scratch and consumed by the
+ * pointwise matmul right away, so the full depthwise output tensor is never
+ * stored. Output is bit-exact with xa_nn_conv2d_depthwise_v2 followed by
+ * xa_nn_conv2d_pointwise_v2 with input_zero_bias = pw_input_zero_bias. */
+WORD32 xa_nn_conv2d_depthwise_pointwise_v2_per_chan_sym8sxasym8s(
+    WORD8* __restrict__ p_out,
+    const WORD8* __restrict__ p_dw_kernel,
+    const WORD8* __restrict__ p_pw_kernel,
+    const WORD8* __restrict__ p_inp,
+    const WORD32* __restrict__ p_dw_bias,
+    const WORD32* __restrict__ p_pw_bias,
+    WORD32  input_height,
+    WORD32  input_width,
+    WORD32  input_channels,
+    WORD32  kernel_height,
+    WORD32  kernel_width,
+    WORD32  channels_multiplier,
+    WORD32  x_stride,
+    WORD32  y_stride,
+    WORD32  x_padding,
+    WORD32  y_padding,
+    WORD32  out_height,
+    WORD32  out_width,
+    WORD32  out_channels,
+    WORD32  input_zero_bias,
+    const WORD32 *p_dw_out_multiplier,
+    const WORD32 *p_dw_out_shift,
+    WORD32  dw_out_zero_bias,
+    WORD32  dw_out_activation_min,
+    WORD32  dw_out_activation_max,
+    WORD32  pw_input_zero_bias,
+    const WORD32 *p_out_multiplier,
+    const WORD32 *p_out_shift,
+    WORD32  out_zero_bias,
+    WORD32  out_data_format,
+    WORD32  out_activation_min,
+    WORD32  out_activation_max,
+    WORD32  rows_per_block,
+    pVOID p_scratch)
+{
+  /* NULL pointer checks */
+  XA_NNLIB_ARG_CHK_PTR(p_out, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_dw_kernel, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_pw_kernel, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_inp, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_dw_bias, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_pw_bias, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_scratch, -1);
+  /* Pointer alignment checks */
+  XA_NNLIB_ARG_CHK_ALIGN(p_scratch, ALIGNMENT_16, -1);
+  /* Basic Parameter checks */
+  XA_NNLIB_ARG_CHK_COND((input_height <= 0 || input_width <= 0), -1);
+  XA_NNLIB_ARG_CHK_COND((input_channels <= 0), -1);
+  XA_NNLIB_ARG_CHK_COND((kernel_height <= 0 || kernel_width <= 0), -1);
+  XA_NNLIB_ARG_CHK_COND((channels_multiplier <= 0), -1);
+  XA_NNLIB_ARG_CHK_COND((y_stride <= 0 || x_stride <= 0), -1);
+  XA_NNLIB_ARG_CHK_COND((x_padding < 0), -1);
+  XA_NNLIB_ARG_CHK_COND((out_height <= 0 || out_width <= 0), -1);
+  XA_NNLIB_ARG_CHK_COND((out_channels <= 0), -1);
+  XA_NNLIB_ARG_CHK_COND((out_data_format != 0 && out_data_format != 1), -1);
+  XA_NNLIB_ARG_CHK_COND((rows_per_block <= 0), -1);
+  /* Every depthwise output row must see at least one input row */
+  XA_NNLIB_ARG_CHK_COND((y_padding < 0 || y_padding >= kernel_height), -1);
+  XA_NNLIB_ARG_CHK_COND(((out_height - 1) * y_stride - y_padding >= input_height), -1);
+
+  WORD32 ret;
+  WORD32 itr_oh, cur_h;
+  WORD32 inp_h_idx, y_padding_cur, inp_height_cur;
+  WORD32 dw_channels = input_channels * channels_multiplier;
+  WORD32 out_plane_size = out_height * out_width;
+  WORD32 out_offset = out_data_format ? 1 : out_channels;
+  WORD32 out_stride = out_data_format ? out_plane_size : 1;
+
+  rows_per_block = rows_per_block > out_height ? out_height : rows_per_block;
+
+  WORD8 *p_dw_out = (WORD8 *)p_scratch;
+  pVOID p_dw_scratch = (pVOID)((WORD8 *)p_scratch + ALIGNED_SIZE(rows_per_block * out_width * dw_channels, ALIGNMENT_16));
+
+  for(itr_oh = 0; itr_oh < out_height; itr_oh += cur_h)
+  {
+    cur_h = rows_per_block < out_height - itr_oh ? rows_per_block : out_height - itr_oh;
+    dw_block_inp_rows(itr_oh * y_stride - y_padding, cur_h, input_height, kernel_height, y_stride,
+        &inp_h_idx, &y_padding_cur, &inp_height_cur);
+
+    /* depthwise checks its own zero biases, shifts and activation range */
+    ret = xa_nn_conv2d_depthwise_v2_per_chan_sym8sxasym8s(
+        p_dw_out,
+        p_dw_kernel,
+        &p_inp[inp_h_idx * input_width * input_channels],
+        p_dw_bias,
+        inp_height_cur,
+        input_width,
+        input_channels,
+        kernel_height,
+        kernel_width,
+        channels_multiplier,
+        x_stride,
+        y_stride,
+        x_padding,
+        y_padding_cur,
+        cur_h,
+        out_width,
+        input_zero_bias,
+        p_dw_out_multiplier,
+        p_dw_out_shift,
+        dw_out_zero_bias,
+        0,
+        0,
+        p_dw_scratch,
+        dw_out_activation_min,
+        dw_out_activation_max,
+        NULL);
+    if(ret < 0)
+      return ret;
+
+    ret = xa_nn_matmul_v2_per_chan_sym8sxasym8s_asym8s(
+        &p_out[itr_oh * out_width * out_offset],
+        p_pw_kernel,
+        p_dw_out,
+        p_pw_bias,
+        out_channels,
+        dw_channels,
+        dw_channels,
+        cur_h * out_width,
+        dw_channels,
+        out_offset,
+        out_stride,
+        pw_input_zero_bias,
+        p_out_multiplier,
+        p_out_shift,
+        out_zero_bias,
+        out_activation_min,
+        out_activation_max,
+        NULL);
+    if(ret < 0)
+      return ret;
+  }
+
+  return 0;
+}
@@ -22,6 +22,7 @@
 #include "xa_nnlib_common.h"
 #include "xa_nnlib_common_macros_hifi5.h"
 #include "xa_nn_conv2d_depthwise_state.h"
+#include "xa_nnlib_common_act_lut.h"
 #include <string.h>
 
 #ifdef AE_MULZB3X3O8X8
@@ -1312,7 +1313,7 @@ static inline void __attribute__((always_inline)) conv2d_v2_nhwc_per_chan_sym8sx
 }
 #endif
 
-WORD32 xa_nn_conv2d_depthwise_v2_nhwc_per_chan_sym8sxasym8s
+static WORD32 internal_conv2d_depthwise_v2_nhwc_per_chan_sym8sxasym8s
   (pWORD8 __restrict__ p_out
   ,const WORD8 *__restrict__ p_kernel
   ,const WORD8 *__restrict__ p_inp
@@ -1330,6 +1331,7 @@ WORD32 xa_nn_conv2d_depthwise_v2_nhwc_per_chan_sym8sxasym8s
   ,WORD32  out_height
   ,WORD32  out_width
   ,WORD32  input_zero_bias
+  ,WORD32  pad_val
   ,const WORD32  *p_out_multiplier
   ,const WORD32  *p_out_shift
   ,WORD32  out_zero_bias
@@ -1369,7 +1371,7 @@ WORD32 xa_nn_conv2d_depthwise_v2_nhwc_per_chan_sym8sxasym8s
   XA_NNLIB_ARG_CHK_COND((out_activation_max < out_activation_min || out_activation_max > 127), -1);
 
   (VOID) out_data_format;
-  UWORD8 input_zero_bias_neg = (WORD8)-input_zero_bias;
+  UWORD8 pad_val_u8 = (WORD8)pad_val;
   xa_nn_dilated_conv2d_depthwise_init
     (p_scratch
     ,input_height
@@ -1388,7 +1390,7 @@ WORD32 xa_nn_conv2d_depthwise_v2_nhwc_per_chan_sym8sxasym8s
     ,out_width
     ,8
     ,0
-    ,(pVOID)(&input_zero_bias_neg)
+    ,(pVOID)(&pad_val_u8)
     );
 
   xa_nn_circ_buf_t *p_state = (xa_nn_circ_buf_t *)p_scratch;
@@ -1446,7 +1448,7 @@ WORD32 xa_nn_conv2d_depthwise_v2_nhwc_per_chan_sym8sxasym8s
     ,out_height
     ,p_circ_buf
     ,pt_inp
-    ,&input_zero_bias_neg
+    ,&pad_val_u8
     );
 
 #pragma loop_count min=1
@@ -1470,7 +1472,7 @@ WORD32 xa_nn_conv2d_depthwise_v2_nhwc_per_chan_sym8sxasym8s
       ,out_height
       ,p_circ_buf
       ,pt_inp
-      ,&input_zero_bias_neg
+      ,&pad_val_u8
       );
 
     p_inp_circ = (WORD8 *)p_circ_buf->p_curr;
@@ -1499,6 +1501,62 @@ WORD32 xa_nn_conv2d_depthwise_v2_nhwc_per_chan_sym8sxasym8s
   return 0;
 }
 
+WORD32 xa_nn_conv2d_depthwise_v2_nhwc_per_chan_sym8sxasym8s
+  (pWORD8 __restrict__ p_out
+  ,const WORD8 *__restrict__ p_kernel
+  ,const WORD8 *__restrict__ p_inp
+  ,const WORD32 *__restrict__ p_bias
+  ,WORD32  input_height
+  ,WORD32  input_width
+  ,WORD32  input_channels
+  ,WORD32  kernel_height
+  ,WORD32  kernel_width
+  ,WORD32  channels_multiplier
+  ,WORD32  x_stride
+  ,WORD32  y_stride
+  ,WORD32  x_padding
+  ,WORD32  y_padding
+  ,WORD32  out_height
+  ,WORD32  out_width
+  ,WORD32  input_zero_bias
+  ,const WORD32  *p_out_multiplier
+  ,const WORD32  *p_out_shift
+  ,WORD32  out_zero_bias
+  ,WORD32  out_data_format
+  ,pVOID p_scratch
+  ,WORD32  out_activation_min
+  ,WORD32  out_activation_max
+  )
+{
+  return internal_conv2d_depthwise_v2_nhwc_per_chan_sym8sxasym8s
+    (p_out
+    ,p_kernel
+    ,p_inp
+    ,p_bias
+    ,input_height
+    ,input_width
+    ,input_channels
+    ,kernel_height
+    ,kernel_width
+    ,channels_multiplier
+    ,x_stride
+    ,y_stride
+    ,x_padding
+    ,y_padding
+    ,out_height
+    ,out_width
+    ,input_zero_bias
+    ,-input_zero_bias
+    ,p_out_multiplier
+    ,p_out_shift
+    ,out_zero_bias
+    ,out_data_format
+    ,p_scratch
+    ,out_activation_min
+    ,out_activation_max
+    );
+}
+
 #ifndef DISABLE_DEPTHWISE_CONV2D_K3X3_SPECIAL_CASE
 
 #define KH_3X3 3
@@ -3060,6 +3118,247 @@ WORD32 xa_nn_conv2d_depthwise_v2_per_chan_sym8sxasym8s
   }
 }
 
+/* Input rows needed for depthwise output rows starting at input row itr_ih
+ * (may be negative inside the top padding) */
+static void dw_block_inp_rows(
+    WORD32 itr_ih,
+    WORD32 block_height,
+    WORD32 inp_h,
+    WORD32 ker_h,
+    WORD32 y_str,
+    WORD32 *p_inp_h_idx,
+    WORD32 *p_y_padding_cur,
+    WORD32 *p_inp_height_cur)
+{
+  WORD32 inp_h_idx = itr_ih < 0 ? 0 : itr_ih;
+  WORD32 y_padding_cur = itr_ih < 0 ? -itr_ih : 0;
+  WORD32 inp_height_cur = (block_height - 1)*y_str + ker_h - y_padding_cur;
+  inp_height_cur = inp_height_cur > inp_h - inp_h_idx ? inp_h - inp_h_idx : inp_height_cur;
+  *p_inp_h_idx = inp_h_idx;
+  *p_y_padding_cur = y_padding_cur;
+  *p_inp_height_cur = inp_height_cur;
+}
+
+/* Depthwise conv v2 followed by the activation in p_act_cfg. With NHWC
+ * input and output the output is produced in row tiles and the activation
+ * is applied to each tile right after it is computed. */
+WORD32 xa_nn_conv2d_depthwise_v2_act_per_chan_sym8sxasym8s
+  (pWORD8 __restrict__ p_out
+  ,const WORD8 *__restrict__ p_kernel
+  ,const WORD8 *__restrict__ p_inp
+  ,const WORD32 *__restrict__ p_bias
+  ,WORD32  input_height
+  ,WORD32  input_width
+  ,WORD32  input_channels
+  ,WORD32  kernel_height
+  ,WORD32  kernel_width
+  ,WORD32  channels_multiplier
+  ,WORD32  x_stride
+  ,WORD32  y_stride
+  ,WORD32  x_padding
+  ,WORD32  y_padding
+  ,WORD32  out_height
+  ,WORD32  out_width
+  ,WORD32  input_zero_bias
+  ,const WORD32 *p_out_multiplier
+  ,const WORD32 *p_out_shift
+  ,WORD32  out_zero_bias
+  ,WORD32  inp_data_format
+  ,WORD32  out_data_format
+  ,pVOID p_scratch
+  ,WORD32  out_activation_min
+  ,WORD32  out_activation_max
+  ,const xa_nn_act_cfg_t *p_act_cfg
+  ,xa_dma_cfg_t *p_dma_cfg
+  )
+{
+  WORD32 ret;
+  WORD32 out_channels = input_channels * channels_multiplier;
+
+  if(p_act_cfg != NULL)
+  {
+    XA_NNLIB_ARG_CHK_PTR(p_act_cfg->p_lut, -1);
+    XA_NNLIB_ARG_CHK_COND((out_height <= 0 || out_width <= 0 || out_channels <= 0), -1);
+    XA_NNLIB_ARG_CHK_COND((p_act_cfg->lut_channels != 1 && p_act_cfg->lut_channels != out_channels), -1);
+  }
+
+  /* Row tiles need NHWC in and out, and every tile must see an input row */
+  if(p_act_cfg == NULL || inp_data_format != 0 || out_data_format != 0 ||
+     y_padding < 0 || y_padding >= kernel_height || y_stride <= 0 ||
+     (out_height - 1) * y_stride - y_padding >= input_height)
+  {
+    ret = xa_nn_conv2d_depthwise_v2_per_chan_sym8sxasym8s(p_out, p_kernel, p_inp, p_bias,
+            input_height, input_width, input_channels, kernel_height, kernel_width, channels_multiplier,
+            x_stride, y_stride, x_padding, y_padding, out_height, out_width,
+            input_zero_bias, p_out_multiplier, p_out_shift, out_zero_bias,
+            inp_data_format, out_data_format, p_scratch,
+            out_activation_min, out_activation_max, p_dma_cfg);
+    if(ret < 0 || p_act_cfg == NULL)
+      return ret;
+    xa_nn_act_lut_rows_asym8s(p_out, p_act_cfg, 0, out_height, out_height, out_width, out_channels, out_data_format);
+    return 0;
+  }
+
+  /* Row tiles whose output fits in a quarter of the data cache */
+  WORD32 row_bytes = out_width * out_channels;
+  WORD32 tile_height = (XCHAL_DCACHE_SIZE >> 2) / row_bytes;
+  tile_height = tile_height < 4 ? 4 : tile_height;
+  tile_height = tile_height > out_height ? out_height : tile_height;
+
+  WORD32 itr_oh, cur_h;
+  WORD32 inp_h_idx, y_padding_cur, inp_height_cur;
+  for(itr_oh = 0; itr_oh < out_height; itr_oh += cur_h)
+  {
+    cur_h = XT_MIN(tile_height, out_height - itr_oh);
+    dw_block_inp_rows(itr_oh * y_stride - y_padding, cur_h, input_height, kernel_height, y_stride,
+        &inp_h_idx, &y_padding_cur, &inp_height_cur);
+
+    ret = xa_nn_conv2d_depthwise_v2_per_chan_sym8sxasym8s(&p_out[itr_oh * row_bytes], p_kernel,
+            &p_inp[inp_h_idx * input_width * input_channels], p_bias,
+            inp_height_cur, input_width, input_channels, kernel_height, kernel_width, channels_multiplier,
+            x_stride, y_stride, x_padding, y_padding_cur, cur_h, out_width,
+            input_zero_bias, p_out_multiplier, p_out_shift, out_zero_bias,
+            0, 0, p_scratch,
+            out_activation_min, out_activation_max, p_dma_cfg);
+    if(ret < 0)
+      return ret;
+
+    xa_nn_act_lut_rows_asym8s(p_out, p_act_cfg, itr_oh, cur_h, out_height, out_width, out_channels, 0);
+  }
+
+  return 0;
+}
+
+/* Depthwise v2 with explicit right/bottom padding and a pad value from
+ * p_pad_cfg, written into the circular buffer in place of the zero point. */
+WORD32 xa_nn_conv2d_depthwise_v2_pad_per_chan_sym8sxasym8s
+  (pWORD8 __restrict__ p_out
+  ,const WORD8 *__restrict__ p_kernel
+  ,const WORD8 *__restrict__ p_inp
+  ,const WORD32 *__restrict__ p_bias
+  ,WORD32  input_height
+  ,WORD32  input_width
+  ,WORD32  input_channels
+  ,WORD32  kernel_height
+  ,WORD32  kernel_width
+  ,WORD32  channels_multiplier
+  ,WORD32  x_stride
+  ,WORD32  y_stride
+  ,WORD32  x_padding
+  ,WORD32  y_padding
+  ,WORD32  out_height
+  ,WORD32  out_width
+  ,WORD32  input_zero_bias
+  ,const WORD32  *p_out_multiplier
+  ,const WORD32  *p_out_shift
+  ,WORD32  out_zero_bias
+  ,WORD32  inp_data_format
+  ,WORD32  out_data_format
+  ,pVOID p_scratch
+  ,WORD32  out_activation_min
+  ,WORD32  out_activation_max
+  ,const xa_nn_pad_cfg_t *p_pad_cfg
+  ,xa_dma_cfg_t *p_dma_cfg
+  )
+{
+  if(p_pad_cfg != NULL)
+  {
+    XA_NNLIB_ARG_CHK_COND((y_stride <= 0 || x_stride <= 0), -1);
+    XA_NNLIB_ARG_CHK_COND((p_pad_cfg->y_b_padding < 0 || p_pad_cfg->x_r_padding < 0), -1);
+    XA_NNLIB_ARG_CHK_COND((p_pad_cfg->pad_val < -128 || p_pad_cfg->pad_val > 127), -1);
+    /* Output size has to follow from the four pad amounts */
+    XA_NNLIB_ARG_CHK_COND((out_height != (y_padding + input_height + p_pad_cfg->y_b_padding - kernel_height) / y_stride + 1), -1);
+    XA_NNLIB_ARG_CHK_COND((out_width != (x_padding + input_width + p_pad_cfg->x_r_padding - kernel_width) / x_stride + 1), -1);
+  }
+
+  if(p_pad_cfg == NULL || p_pad_cfg->pad_val == -input_zero_bias)
+  {
+    return xa_nn_conv2d_depthwise_v2_per_chan_sym8sxasym8s(p_out, p_kernel, p_inp, p_bias,
+            input_height, input_width, input_channels, kernel_height, kernel_width, channels_multiplier,
+            x_stride, y_stride, x_padding, y_padding, out_height, out_width,
+            input_zero_bias, p_out_multiplier, p_out_shift, out_zero_bias,
+            inp_data_format, out_data_format, p_scratch,
+            out_activation_min, out_activation_max, p_dma_cfg);
+  }
+
+  XA_NNLIB_CHK_COND((inp_data_format != 0), -1);
+  /* For single input channel, use the standard convolution with the same
+   * pad value, scratch is sized for it by the depthwise getsize */
+  if(input_channels == 1)
+  {
+    XA_NNLIB_ARG_CHK_PTR(p_scratch, -1);
+    XA_NNLIB_ARG_CHK_ALIGN(p_scratch, ALIGNMENT_16, -1);
+    XA_NNLIB_ARG_CHK_COND((kernel_height <= 0 || kernel_width <= 0 || channels_multiplier <= 0), -1);
+
+    pWORD8 p_kernel_nchw;
+    p_scratch = (void *)ALIGN_PTR(p_scratch, ALIGNMENT_16);
+    p_kernel_nchw = (pWORD8)p_scratch;
+    p_scratch += ALIGNED_SIZE(channels_multiplier * kernel_height * kernel_width, ALIGNMENT_16);
+
+    /* Rearrange the kernel in NCHW format */
+    xa_nn_rearrange_hwc_to_chw(p_kernel_nchw, p_kernel, kernel_height, kernel_width, channels_multiplier);
+
+    return xa_nn_conv2d_std_v2_pad_per_chan_sym8sxasym8s
+      (p_out
+      ,p_inp
+      ,p_kernel_nchw
+      ,p_bias
+      ,input_height
+      ,input_width
+      ,input_channels
+      ,kernel_height
+      ,kernel_width
+      ,channels_multiplier
+      ,x_stride
+      ,y_stride
+      ,x_padding
+      ,y_padding
+      ,out_height
+      ,out_width
+      ,input_zero_bias
+      ,(WORD32 *)p_out_multiplier
+      ,(WORD32 *)p_out_shift
+      ,out_zero_bias
+      ,out_data_format
+      ,p_scratch
+      ,out_activation_min
+      ,out_activation_max
+      ,p_pad_cfg
+      ,p_dma_cfg
+      );
+  }
+
+  /* Other pad values go through the generic NHWC kernel, the 3x3 path pads
+   * with the zero point */
+  return internal_conv2d_depthwise_v2_nhwc_per_chan_sym8sxasym8s
+    (p_out
+    ,p_kernel
+    ,p_inp
+    ,p_bias
+    ,input_height
+    ,input_width
+    ,input_channels
+    ,kernel_height
+    ,kernel_width
+    ,channels_multiplier
+    ,x_stride
+    ,y_stride
+    ,x_padding
+    ,y_padding
+    ,out_height
+    ,out_width
+    ,input_zero_bias
+    ,p_pad_cfg->pad_val
+    ,p_out_multiplier
+    ,p_out_shift
+    ,out_zero_bias
+    ,out_data_format
+    ,p_scratch
+    ,out_activation_min
+    ,out_activation_max
+    );
+}
+
 WORD32 xa_nn_conv2d_depthwise_per_chan_sym8sxasym8s
   (pWORD8 __restrict__ p_out
   ,const WORD8 *__restrict__ p_kernel
@@ -23,6 +23,79 @@
 #include "xa_nnlib_common.h"
 #include "xa_nn_conv2d_depthwise_state.h"
 #include "xa_nnlib_common_macros_hifi5.h"
+#include "xa_nnlib_common_dma.h"
+#include "xa_nnlib_common_act_lut.h"
+#include "xa_nnlib_common_residual.h"
+
+/* Input pixels of the next tile are fetched through DMA while the current
+ * tile is multiplied, works for both NHWC (out_offset = out_channels,
+ * out_stride = 1) and NCHW (out_offset = 1, out_stride = plane size) */
+static WORD32 xa_nn_conv2d_pointwise_v2_dma_per_chan_sym8sxasym8s(
+    WORD8* __restrict__ p_out,
+    WORD8* __restrict__ p_kernel,
+    WORD8* __restrict__ p_inp,
+    WORD32* __restrict__ p_bias,
+    WORD32  out_plane_size,
+    WORD32  input_channels,
+    WORD32  out_channels,
+    WORD32  out_offset,
+    WORD32  out_stride,
+    WORD32  input_zero_bias,
+    WORD32*  __restrict__ p_out_multiplier,
+    WORD32*  __restrict__ p_out_shift,
+    WORD32  out_zero_bias,
+    WORD32  out_activation_min,
+    WORD32  out_activation_max,
+    WORD32  tile_size,
+    xa_dma_cfg_t *p_dma_cfg)
+{
+  int ret = 0, itr_t = 0, buf_idx = 0, dma_id;
+  int cur_size = tile_size < out_plane_size ? tile_size : out_plane_size;
+
+  dma_id = xa_nn_dma_fetch(p_dma_cfg, buf_idx, p_inp, cur_size * input_channels * sizeof(WORD8));
+  do
+  {
+    int next_t = itr_t + cur_size;
+    int next_size = tile_size < out_plane_size - next_t ? tile_size : out_plane_size - next_t;
+    int next_dma_id = -1;
+    WORD8 *p_tile_inp;
+
+    /* Start fetching the next tile into the other buffer */
+    if(next_size > 0)
+      next_dma_id = xa_nn_dma_fetch(p_dma_cfg, buf_idx ^ 1, &p_inp[next_t*input_channels], next_size * input_channels * sizeof(WORD8));
+
+    /* Read in place if the transfer could not be started */
+    p_tile_inp = dma_id >= 0 ? (WORD8 *)p_dma_cfg->p_local_buf[buf_idx] : &p_inp[itr_t*input_channels];
+    xa_nn_dma_wait(p_dma_cfg, dma_id);
+    ret |= xa_nn_matmul_v2_per_chan_sym8sxasym8s_asym8s(&p_out[itr_t*out_offset],
+                                          p_kernel,
+                                          p_tile_inp,
+                                          p_bias,
+                                          out_channels,
+                                          input_channels,
+                                          input_channels,
+                                          cur_size,
+                                          input_channels,
+                                          out_offset,
+                                          out_stride,
+                                          input_zero_bias,
+                                          p_out_multiplier,
+                                          p_out_shift,
+                                          out_zero_bias,
+                                          out_activation_min,
+                                          out_activation_max,
+                                          NULL
+                                          );
+    itr_t = next_t;
+    cur_size = next_size;
+    dma_id = next_dma_id;
+    buf_idx ^= 1;
+  } while(itr_t < out_plane_size);
+
+  if(ret<0)
+      return -1;
+  return 0;
+}
 
 static WORD32 xa_nn_conv2d_pointwise_v2_nhwc_per_chan_sym8sxasym8s(
     WORD8* __restrict__ p_out,
@@ -187,6 +260,35 @@ WORD32 xa_nn_conv2d_pointwise_v2_per_chan_sym8sxasym8s(
   }
   int ret = 0;
 
+  if(XA_NN_DMA_CFG_VALID(p_dma_cfg))
+  {
+    /* Largest multiple of 4 input pixels that fits in one local buffer */
+    int out_plane_size = input_height*input_width;
+    int dma_tile_size = p_dma_cfg->local_buf_size / (input_channels * (int)sizeof(WORD8));
+    dma_tile_size = dma_tile_size > 4 ? (dma_tile_size & (~3)) : dma_tile_size;
+    if(dma_tile_size > 0)
+    {
+      return xa_nn_conv2d_pointwise_v2_dma_per_chan_sym8sxasym8s(
+          p_out,
+          p_kernel,
+          p_inp,
+          p_bias,
+          out_plane_size,
+          input_channels,
+          out_channels,
+          out_data_format ? 1 : out_channels,
+          out_data_format ? out_plane_size : 1,
+          input_zero_bias,
+          p_out_multiplier,
+          p_out_shift,
+          out_zero_bias,
+          out_activation_min,
+          out_activation_max,
+          dma_tile_size,
+          p_dma_cfg);
+    }
+  }
+
   if(out_data_format == 0){
     ret = xa_nn_conv2d_pointwise_v2_nhwc_per_chan_sym8sxasym8s(
           p_out,
@@ -226,6 +328,227 @@ WORD32 xa_nn_conv2d_pointwise_v2_per_chan_sym8sxasym8s(
   return ret;
 }
 
+/* Computes output rows [out_row_start, out_row_end) and output channels
+ * [out_ch_start, out_ch_end) of the full output tensor, so that disjoint
+ * slices can run concurrently. */
+WORD32 xa_nn_conv2d_pointwise_v2_slice_per_chan_sym8sxasym8s(
+    WORD8* __restrict__ p_out,
+    WORD8* __restrict__ p_kernel,
+    WORD8* __restrict__ p_inp,
+    WORD32* __restrict__ p_bias,
+    WORD32  input_height,
+    WORD32  input_width,
+    WORD32  input_channels,
+    WORD32  out_channels,
+    WORD32  input_zero_bias,
+    WORD32* __restrict__ p_out_multiplier,
+    WORD32* __restrict__ p_out_shift,
+    WORD32  out_zero_bias,
+    WORD32  out_data_format,
+    WORD32  out_activation_min,
+    WORD32  out_activation_max,
+    WORD32  out_row_start,
+    WORD32  out_row_end,
+    WORD32  out_ch_start,
+    WORD32  out_ch_end,
+    xa_dma_cfg_t *p_dma_cfg)
+{
+  /* NULL pointer checks */
+  XA_NNLIB_ARG_CHK_PTR(p_out, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_kernel, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_inp, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_bias, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_out_multiplier, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_out_shift, -1);
+  /* Pointer alignment checks */
+  XA_NNLIB_ARG_CHK_ALIGN(p_bias, sizeof(WORD32), -1);
+  XA_NNLIB_ARG_CHK_ALIGN(p_out_multiplier, sizeof(WORD32), -1);
+  XA_NNLIB_ARG_CHK_ALIGN(p_out_shift, sizeof(WORD32), -1);
+  /* Basic Parameter checks */
+  XA_NNLIB_ARG_CHK_COND((input_height <= 0 || input_width <= 0), -1);
+  XA_NNLIB_ARG_CHK_COND((input_channels <= 0), -1);
+  XA_NNLIB_ARG_CHK_COND((out_channels <= 0), -1);
+  XA_NNLIB_ARG_CHK_COND((out_data_format != 0 && out_data_format != 1), -1);
+  XA_NNLIB_ARG_CHK_COND((out_row_start < 0 || out_row_end > input_height || out_row_start >= out_row_end), -1);
+  XA_NNLIB_ARG_CHK_COND((out_ch_start < 0 || out_ch_end > out_channels || out_ch_start >= out_ch_end), -1);
+
+  int out_plane_size = input_height*input_width;
+  int pix_start = out_row_start*input_width;
+  int pix_count = (out_row_end - out_row_start)*input_width;
+  int out_offset = out_data_format ? 1 : out_channels;
+  int out_stride = out_data_format ? out_plane_size : 1;
+  int ret;
+
+  /* matmul checks the zero biases, shifts and activation range */
+  ret = xa_nn_matmul_v2_per_chan_sym8sxasym8s_asym8s(&p_out[pix_start*out_offset + out_ch_start*out_stride],
+                                        &p_kernel[out_ch_start*input_channels],
+                                        &p_inp[pix_start*input_channels],
+                                        &p_bias[out_ch_start],
+                                        out_ch_end - out_ch_start,
+                                        input_channels,
+                                        input_channels,
+                                        pix_count,
+                                        input_channels,
+                                        out_offset,
+                                        out_stride,
+                                        input_zero_bias,
+                                        &p_out_multiplier[out_ch_start],
+                                        &p_out_shift[out_ch_start],
+                                        out_zero_bias,
+                                        out_activation_min,
+                                        out_activation_max,
+                                        p_dma_cfg
+                                        );
+  if(ret<0)
+      return ret;
+  return 0;
+}
+
+/* Pointwise conv v2 with a residual add, applied per row tile right after
+ * the tile is computed with the full int8 range. The tile is saturated to
+ * int8 before the add, see xa_nn_residual_cfg_t. */
+WORD32 xa_nn_conv2d_pointwise_v2_residual_per_chan_sym8sxasym8s(
+    WORD8* __restrict__ p_out,
+    WORD8* __restrict__ p_kernel,
+    WORD8* __restrict__ p_inp,
+    WORD32* __restrict__ p_bias,
+    WORD32  input_height,
+    WORD32  input_width,
+    WORD32  input_channels,
+    WORD32  out_channels,
+    WORD32  input_zero_bias,
+    WORD32* __restrict__ p_out_multiplier,
+    WORD32* __restrict__ p_out_shift,
+    WORD32  out_zero_bias,
+    WORD32  out_data_format,
+    WORD32  out_activation_min,
+    WORD32  out_activation_max,
+    const xa_nn_residual_cfg_t *p_res_cfg,
+    xa_dma_cfg_t *p_dma_cfg)
+{
+  if(p_res_cfg == NULL)
+  {
+    return xa_nn_conv2d_pointwise_v2_per_chan_sym8sxasym8s(p_out, p_kernel, p_inp, p_bias,
+              input_height, input_width, input_channels, out_channels, input_zero_bias,
+              p_out_multiplier, p_out_shift, out_zero_bias, out_data_format,
+              out_activation_min, out_activation_max, p_dma_cfg);
+  }
+
+  XA_NNLIB_ARG_CHK_PTR(p_res_cfg->p_res, -1);
+  XA_NNLIB_ARG_CHK_COND((input_height <= 0 || input_width <= 0 || out_channels <= 0), -1);
+  XA_NNLIB_ARG_CHK_COND((p_res_cfg->res_zero_bias < -127 || p_res_cfg->res_zero_bias > 128), -1);
+  XA_NNLIB_ARG_CHK_COND((p_res_cfg->res_shift < -31 || p_res_cfg->res_shift > 31), -1);
+  XA_NNLIB_ARG_CHK_COND((out_activation_min < -128 || out_activation_min > 127), -1);
+  XA_NNLIB_ARG_CHK_COND((out_activation_max < out_activation_min || out_activation_max > 127), -1);
+
+  /* Row tiles whose output and residual fit in half of the data cache */
+  WORD32 row_bytes = input_width * out_channels;
+  WORD32 tile_height = (XCHAL_DCACHE_SIZE >> 2) / row_bytes;
+  tile_height = tile_height < 1 ? 1 : tile_height;
+  tile_height = tile_height > input_height ? input_height : tile_height;
+
+  WORD32 plane_size = input_height * input_width;
+  WORD32 itr_h, itr_oc, ret;
+  for(itr_h = 0; itr_h < input_height; itr_h += tile_height)
+  {
+    WORD32 cur_h = XT_MIN(tile_height, input_height - itr_h);
+
+    /* Slice API checks the remaining arguments */
+    ret = xa_nn_conv2d_pointwise_v2_slice_per_chan_sym8sxasym8s(p_out, p_kernel, p_inp, p_bias,
+              input_height, input_width, input_channels, out_channels, input_zero_bias,
+              p_out_multiplier, p_out_shift, out_zero_bias, out_data_format,
+              -128, 127, itr_h, itr_h + cur_h, 0, out_channels, p_dma_cfg);
+    if(ret < 0)
+      return ret;
+
+    if(out_data_format == 0)
+    {
+      xa_nn_residual_add_asym8s(&p_out[itr_h * row_bytes],
+          &p_res_cfg->p_res[itr_h * row_bytes],
+          cur_h * row_bytes,
+          p_res_cfg->res_zero_bias,
+          p_res_cfg->res_multiplier,
+          p_res_cfg->res_shift,
+          out_activation_min,
+          out_activation_max);
+    }
+    else
+    {
+      for(itr_oc = 0; itr_oc < out_channels; itr_oc++)
+      {
+        xa_nn_residual_add_asym8s(&p_out[itr_oc * plane_size + itr_h * input_width],
+            &p_res_cfg->p_res[itr_oc * plane_size + itr_h * input_width],
+            cur_h * input_width,
+            p_res_cfg->res_zero_bias,
+            p_res_cfg->res_multiplier,
+            p_res_cfg->res_shift,
+            out_activation_min,
+            out_activation_max);
+      }
+    }
+  }
+
+  return 0;
+}
+
+/* Pointwise conv v2 followed by the activation in p_act_cfg, applied to
+ * each row tile right after it is computed. */
+WORD32 xa_nn_conv2d_pointwise_v2_act_per_chan_sym8sxasym8s(
+    WORD8* __restrict__ p_out,
+    WORD8* __restrict__ p_kernel,
+    WORD8* __restrict__ p_inp,
+    WORD32* __restrict__ p_bias,
+    WORD32  input_height,
+    WORD32  input_width,
+    WORD32  input_channels,
+    WORD32  out_channels,
+    WORD32  input_zero_bias,
+    WORD32* __restrict__ p_out_multiplier,
+    WORD32* __restrict__ p_out_shift,
+    WORD32  out_zero_bias,
+    WORD32  out_data_format,
+    WORD32  out_activation_min,
+    WORD32  out_activation_max,
+    const xa_nn_act_cfg_t *p_act_cfg,
+    xa_dma_cfg_t *p_dma_cfg)
+{
+  if(p_act_cfg == NULL)
+  {
+    return xa_nn_conv2d_pointwise_v2_per_chan_sym8sxasym8s(p_out, p_kernel, p_inp, p_bias,
+              input_height, input_width, input_channels, out_channels, input_zero_bias,
+              p_out_multiplier, p_out_shift, out_zero_bias, out_data_format,
+              out_activation_min, out_activation_max, p_dma_cfg);
+  }
+
+  XA_NNLIB_ARG_CHK_PTR(p_act_cfg->p_lut, -1);
+  XA_NNLIB_ARG_CHK_COND((input_height <= 0 || input_width <= 0 || out_channels <= 0), -1);
+  XA_NNLIB_ARG_CHK_COND((p_act_cfg->lut_channels != 1 && p_act_cfg->lut_channels != out_channels), -1);
+
+  /* Row tiles whose output fits in a quarter of the data cache */
+  WORD32 row_bytes = input_width * out_channels;
+  WORD32 tile_height = (XCHAL_DCACHE_SIZE >> 2) / row_bytes;
+  tile_height = tile_height < 1 ? 1 : tile_height;
+  tile_height = tile_height > input_height ? input_height : tile_height;
+
+  WORD32 itr_h, ret;
+  for(itr_h = 0; itr_h < input_height; itr_h += tile_height)
+  {
+    WORD32 cur_h = XT_MIN(tile_height, input_height - itr_h);
+
+    /* Slice API checks the remaining arguments */
+    ret = xa_nn_conv2d_pointwise_v2_slice_per_chan_sym8sxasym8s(p_out, p_kernel, p_inp, p_bias,
+              input_height, input_width, input_channels, out_channels, input_zero_bias,
+              p_out_multiplier, p_out_shift, out_zero_bias, out_data_format,
+              out_activation_min, out_activation_max, itr_h, itr_h + cur_h, 0, out_channels, p_dma_cfg);
+    if(ret < 0)
+      return ret;
+
+    xa_nn_act_lut_rows_asym8s(p_out, p_act_cfg, itr_h, cur_h, input_height, input_width, out_channels, out_data_format);
+  }
+
+  return 0;
+}
+
 WORD32 xa_nn_conv2d_pointwise_per_chan_sym8sxasym8s(
     WORD8* __restrict__ p_out,
     WORD8* __restrict__ p_kernel,
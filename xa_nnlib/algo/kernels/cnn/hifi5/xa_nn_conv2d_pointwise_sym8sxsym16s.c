@@ -22,6 +22,77 @@
 #include "xa_nnlib_common_fpu.h"
 #include "xa_nnlib_common.h"
 #include "xa_nnlib_common_macros_hifi5.h"
+#include "xa_nnlib_common_dma.h"
+
+/* Input pixels of the next tile are fetched through DMA while the current
+ * tile is multiplied, works for both NHWC (out_offset = out_channels,
+ * out_stride = 1) and NCHW (out_offset = 1, out_stride = plane size) */
+static WORD32 xa_nn_conv2d_pointwise_v2_dma_per_chan_sym8sxsym16s(
+    WORD16* __restrict__ p_out,
+    WORD8* __restrict__ p_kernel,
+    WORD16* __restrict__ p_inp,
+    WORD64* __restrict__ p_bias,
+    WORD32  out_plane_size,
+    WORD32  input_channels,
+    WORD32  out_channels,
+    WORD32  out_offset,
+    WORD32  out_stride,
+    WORD32  input_zero_bias,
+    WORD32*  __restrict__ p_out_multiplier,
+    WORD32*  __restrict__ p_out_shift,
+    WORD32  out_zero_bias,
+    WORD32  out_activation_min,
+    WORD32  out_activation_max,
+    WORD32  tile_size,
+    xa_dma_cfg_t *p_dma_cfg)
+{
+  int ret = 0, itr_t = 0, buf_idx = 0, dma_id;
+  int cur_size = tile_size < out_plane_size ? tile_size : out_plane_size;
+
+  dma_id = xa_nn_dma_fetch(p_dma_cfg, buf_idx, p_inp, cur_size * input_channels * sizeof(WORD16));
+  do
+  {
+    int next_t = itr_t + cur_size;
+    int next_size = tile_size < out_plane_size - next_t ? tile_size : out_plane_size - next_t;
+    int next_dma_id = -1;
+    WORD16 *p_tile_inp;
+
+    /* Start fetching the next tile into the other buffer */
+    if(next_size > 0)
+      next_dma_id = xa_nn_dma_fetch(p_dma_cfg, buf_idx ^ 1, &p_inp[next_t*input_channels], next_size * input_channels * sizeof(WORD16));
+
+    /* Read in place if the transfer could not be started */
+    p_tile_inp = dma_id >= 0 ? (WORD16 *)p_dma_cfg->p_local_buf[buf_idx] : &p_inp[itr_t*input_channels];
+    xa_nn_dma_wait(p_dma_cfg, dma_id);
+    ret |= xa_nn_matmul_v2_per_chan_sym8sxsym16s_sym16s(&p_out[itr_t*out_offset],
+                                          p_kernel,
+                                          p_tile_inp,
+                                          p_bias,
+                                          out_channels,
+                                          input_channels,
+                                          input_channels,
+                                          cur_size,
+                                          input_channels,
+                                          out_offset,
+                                          out_stride,
+                                          input_zero_bias,
+                                          p_out_multiplier,
+                                          p_out_shift,
+                                          out_zero_bias,
+                                          out_activation_min,
+                                          out_activation_max,
+                                          NULL
+                                          );
+    itr_t = next_t;
+    cur_size = next_size;
+    dma_id = next_dma_id;
+    buf_idx ^= 1;
+  } while(itr_t < out_plane_size);
+
+  if(ret<0)
+      return -1;
+  return 0;
+}
 
 static WORD32 xa_nn_conv2d_pointwise_v2_nhwc_per_chan_sym8sxsym16s(
     WORD16* __restrict__ p_out,
@@ -171,6 +242,35 @@ WORD32 xa_nn_conv2d_pointwise_v2_per_chan_sym8sxsym16s(
   }
   int ret = 0;
 
+  if(XA_NN_DMA_CFG_VALID(p_dma_cfg))
+  {
+    /* Largest multiple of 4 input pixels that fits in one local buffer */
+    int out_plane_size = input_height*input_width;
+    int dma_tile_size = p_dma_cfg->local_buf_size / (input_channels * (int)sizeof(WORD16));
+    dma_tile_size = dma_tile_size > 4 ? (dma_tile_size & (~3)) : dma_tile_size;
+    if(dma_tile_size > 0)
+    {
+      return xa_nn_conv2d_pointwise_v2_dma_per_chan_sym8sxsym16s(
+          p_out,
+          p_kernel,
+          p_inp,
+          p_bias,
+          out_plane_size,
+          input_channels,
+          out_channels,
+          out_data_format ? 1 : out_channels,
+          out_data_format ? out_plane_size : 1,
+          input_zero_bias,
+          p_out_multiplier,
+          p_out_shift,
+          out_zero_bias,
+          out_activation_min,
+          out_activation_max,
+          dma_tile_size,
+          p_dma_cfg);
+    }
+  }
+
   if(out_data_format == 0){
       ret = xa_nn_conv2d_pointwise_v2_nhwc_per_chan_sym8sxsym16s(
               p_out,
@@ -158,6 +158,238 @@ WORD32 xa_nn_conv2d_std_getsize(
   return mem_req;
 }
 
+/* Estimated working set of one conv2d_std tile: output block, kernel block,
+ * input rows, scratch and per channel quantization parameters */
+static WORD32 conv2d_std_tile_mem_req(
+    WORD32 tile_height,
+    WORD32 out_channels_block,
+    WORD32 inp_w,
+    WORD32 input_channels,
+    WORD32 ker_h,
+    WORD32 ker_w,
+    WORD32 y_str,
+    WORD32 out_w,
+    WORD32 input_bytewidth,
+    WORD32 scratch_size)
+{
+  WORD32 mem_req = tile_height * out_w * out_channels_block;
+  mem_req += ker_h * ker_w * input_channels * out_channels_block;
+  mem_req += ((tile_height - 1) * y_str + ker_h) * inp_w * input_channels * input_bytewidth;
+  mem_req += scratch_size;
+  mem_req += out_channels_block * 3 * sizeof(WORD32);
+  return mem_req;
+}
+
+/* Picks the largest tile whose estimated working set fits in mem_budget.
+ * Output channels are blocked first while the kernel block alone takes more
+ * than half of the budget, then output rows, then output channels again.
+ * If even the smallest tile does not fit, it is returned with mem_req above
+ * the budget. */
+WORD32 xa_nn_conv2d_std_v2_get_tile_plan(
+    xa_nn_conv2d_std_tile_plan_t *p_plan,
+    WORD32 input_height,
+    WORD32 input_width,
+    WORD32 input_channels,
+    WORD32 kernel_height,
+    WORD32 kernel_width,
+    WORD32 out_channels,
+    WORD32 x_stride,
+    WORD32 y_stride,
+    WORD32 x_padding,
+    WORD32 y_padding,
+    WORD32 out_height,
+    WORD32 out_width,
+    WORD32 input_precision,
+    WORD32 out_data_format,
+    WORD32 mem_budget)
+{
+  XA_NNLIB_CHK_COND((p_plan == NULL), -1);
+  XA_NNLIB_CHK_COND((input_height <= 0), -1);
+  XA_NNLIB_CHK_COND((input_width <= 0), -1);
+  XA_NNLIB_CHK_COND((input_channels <= 0), -1);
+  XA_NNLIB_CHK_COND((kernel_height <= 0), -1);
+  XA_NNLIB_CHK_COND((kernel_width <= 0), -1);
+  XA_NNLIB_CHK_COND((out_channels <= 0), -1);
+  XA_NNLIB_CHK_COND((y_stride <= 0), -1);
+  XA_NNLIB_CHK_COND((y_padding < 0), -1);
+  XA_NNLIB_CHK_COND((x_stride <= 0), -1);
+  XA_NNLIB_CHK_COND((x_padding < 0), -1);
+  XA_NNLIB_CHK_COND((out_height <= 0), -1);
+  XA_NNLIB_CHK_COND((out_width <= 0), -1);
+  XA_NNLIB_CHK_COND((input_precision != PREC_ASYM8S), -1);
+  XA_NNLIB_CHK_COND((out_data_format != 0 && out_data_format != 1), -1);
+  XA_NNLIB_CHK_COND((mem_budget <= 0), -1);
+
+  WORD32 inp_h, inp_w, ker_h, ker_w, x_str, y_str, x_pad, y_pad, out_h, out_w;
+  WORD32 input_bytewidth = 1;
+
+  if ((input_height == 1) && (kernel_height == 1) && (out_height == 1))
+  {
+    inp_h = input_width;
+    inp_w = input_height;
+    ker_h = kernel_width;
+    ker_w = kernel_height;
+    x_str = y_stride;
+    y_str = x_stride;
+    x_pad = y_padding;
+    y_pad = x_padding;
+    out_h = out_width;
+    out_w = out_height;
+  }
+  else
+  {
+    inp_h = input_height;
+    inp_w = input_width;
+    ker_h = kernel_height;
+    ker_w = kernel_width;
+    x_str = x_stride;
+    y_str = y_stride;
+    x_pad = x_padding;
+    y_pad = y_padding;
+    out_h = out_height;
+    out_w = out_width;
+  }
+
+  /* To remove LLVM15 warning */
+  (void)inp_h;
+
+  WORD32 tile_height = out_h;
+  WORD32 out_channels_block = out_channels;
+  WORD32 scratch_size, mem_req;
+
+  /* Kernel block should leave at least half of the budget for the rest */
+  while(out_channels_block > 4 && ker_h * ker_w * input_channels * out_channels_block > (mem_budget >> 1))
+  {
+    out_channels_block = ((out_channels_block >> 1) + 3) & (~3);
+  }
+
+  do
+  {
+    scratch_size = xa_nn_conv2d_std_getsize((tile_height - 1)*y_str + ker_h, inp_w, input_channels,
+                    ker_h, ker_w, input_channels, y_str, y_pad, x_str, x_pad, tile_height, out_w, out_channels_block,
+                    input_precision, PREC_SYM8S, 1, 1, out_data_format);
+    if(scratch_size < 0)
+      return -1;
+    mem_req = conv2d_std_tile_mem_req(tile_height, out_channels_block, inp_w, input_channels,
+                    ker_h, ker_w, y_str, out_w, input_bytewidth, scratch_size);
+    if(mem_req <= mem_budget)
+      break;
+    if(tile_height > 1)
+      tile_height = tile_height > 4 ? ((tile_height - 1) & (~3)) : tile_height - 1;
+    else if(out_channels_block > 4)
+      out_channels_block = ((out_channels_block >> 1) + 3) & (~3);
+    else
+      break;
+  } while(1);
+
+  p_plan->tile_height = tile_height;
+  p_plan->out_channels_block = out_channels_block;
+  p_plan->scratch_size = scratch_size;
+  p_plan->mem_req = mem_req;
+
+  return 0;
+}
+
+/* Scratch for xa_nn_conv2d_std_v2_pool_per_chan_sym8sxasym8s: a band of
+ * pool_height conv output rows, per channel average accumulators and the
+ * conv scratch for pool_height output rows */
+WORD32 xa_nn_conv2d_std_v2_pool_getsize(
+    WORD32 input_width,
+    WORD32 input_channels,
+    WORD32 kernel_height,
+    WORD32 kernel_width,
+    WORD32 out_channels,
+    WORD32 x_stride,
+    WORD32 y_stride,
+    WORD32 x_padding,
+    WORD32 y_padding,
+    WORD32 out_width,
+    WORD32 pool_height,
+    WORD32 input_precision)
+{
+  XA_NNLIB_CHK_COND((input_width <= 0), -1);
+  XA_NNLIB_CHK_COND((input_channels <= 0), -1);
+  XA_NNLIB_CHK_COND((kernel_height <= 0), -1);
+  XA_NNLIB_CHK_COND((kernel_width <= 0), -1);
+  XA_NNLIB_CHK_COND((out_channels <= 0), -1);
+  XA_NNLIB_CHK_COND((x_stride <= 0), -1);
+  XA_NNLIB_CHK_COND((y_stride <= 0), -1);
+  XA_NNLIB_CHK_COND((x_padding < 0), -1);
+  XA_NNLIB_CHK_COND((y_padding < 0), -1);
+  XA_NNLIB_CHK_COND((out_width <= 0), -1);
+  XA_NNLIB_CHK_COND((pool_height <= 0), -1);
+  XA_NNLIB_CHK_COND((input_precision != PREC_ASYM8S), -1);
+
+  WORD32 conv_scratch_size = xa_nn_conv2d_std_getsize((pool_height - 1)*y_stride + kernel_height, input_width, input_channels,
+                  kernel_height, kernel_width, input_channels, y_stride, y_padding, x_stride, x_padding, pool_height, out_width, out_channels,
+                  input_precision, PREC_SYM8S, 1, 1, 0);
+  if(conv_scratch_size < 0)
+    return -1;
+
+  WORD32 mem_req = ALIGNED_SIZE(pool_height * out_width * out_channels, ALIGNMENT);
+  mem_req += ALIGNED_SIZE(out_channels * sizeof(WORD32), ALIGNMENT);
+  mem_req += conv_scratch_size;
+
+  return mem_req;
+}
+
+WORD32 xa_nn_conv2d_std_v2_f32io_getsize(
+    WORD32 input_width,
+    WORD32 input_channels,
+    WORD32 kernel_height,
+    WORD32 kernel_width,
+    WORD32 out_channels,
+    WORD32 x_stride,
+    WORD32 y_stride,
+    WORD32 x_padding,
+    WORD32 y_padding,
+    WORD32 out_width,
+    WORD32 band_rows)
+{
+  XA_NNLIB_CHK_COND((input_width <= 0), -1);
+  XA_NNLIB_CHK_COND((input_channels <= 0), -1);
+  XA_NNLIB_CHK_COND((kernel_height <= 0), -1);
+  XA_NNLIB_CHK_COND((kernel_width <= 0), -1);
+  XA_NNLIB_CHK_COND((out_channels <= 0), -1);
+  XA_NNLIB_CHK_COND((x_stride <= 0), -1);
+  XA_NNLIB_CHK_COND((y_stride <= 0), -1);
+  XA_NNLIB_CHK_COND((x_padding < 0), -1);
+  XA_NNLIB_CHK_COND((y_padding < 0), -1);
+  XA_NNLIB_CHK_COND((out_width <= 0), -1);
+  XA_NNLIB_CHK_COND((band_rows <= 0), -1);
+
+  WORD32 band_inp_rows = (band_rows - 1)*y_stride + kernel_height;
+  WORD32 conv_scratch_size = xa_nn_conv2d_std_getsize(band_inp_rows, input_width, input_channels,
+                  kernel_height, kernel_width, input_channels, y_stride, y_padding, x_stride, x_padding, band_rows, out_width, out_channels,
+                  PREC_ASYM8S, PREC_SYM8S, 1, 1, 0);
+  if(conv_scratch_size < 0)
+    return -1;
+
+  /* Quantized input band, int8 output band, conv scratch */
+  WORD32 mem_req = ALIGNED_SIZE(band_inp_rows * input_width * input_channels, ALIGNMENT);
+  mem_req += ALIGNED_SIZE(band_rows * out_width * out_channels, ALIGNMENT);
+  mem_req += conv_scratch_size;
+
+  return mem_req;
+}
+
+/* Scratch for xa_nn_conv2d_pointwise_v2_pool_per_chan_sym8sxasym8s: a band
+ * of pool_height conv output rows and per channel average accumulators */
+WORD32 xa_nn_conv2d_pointwise_v2_pool_getsize(
+    WORD32 input_width,
+    WORD32 out_channels,
+    WORD32 pool_height)
+{
+  XA_NNLIB_CHK_COND((input_width <= 0), -1);
+  XA_NNLIB_CHK_COND((out_channels <= 0), -1);
+  XA_NNLIB_CHK_COND((pool_height <= 0), -1);
+
+  WORD32 mem_req = ALIGNED_SIZE(pool_height * input_width * out_channels, ALIGNMENT);
+  mem_req += ALIGNED_SIZE(out_channels * sizeof(WORD32), ALIGNMENT);
+
+  return mem_req;
+}
+
 WORD32 xa_nn_conv2d_getsize(
     WORD32 input_height,
     WORD32 input_width,
@@ -395,6 +627,83 @@ WORD32 xa_nn_conv2d_std_getsize_sym4s(
   return mem_req;
 }
 
+WORD32 xa_nn_conv2d_std_prepack_getsize_sym4s(
+    WORD32 input_channels,
+    WORD32 kernel_height,
+    WORD32 kernel_width,
+    WORD32 out_channels)
+{
+  XA_NNLIB_CHK_COND((input_channels <= 0), -1);
+  XA_NNLIB_CHK_COND((kernel_height <= 0), -1);
+  XA_NNLIB_CHK_COND((kernel_width <= 0), -1);
+  XA_NNLIB_CHK_COND((out_channels <= 0), -1);
+  XA_NNLIB_CHK_COND((((input_channels * kernel_width * kernel_height) % 2) != 0), -1);
+
+  /* Nibble swapped kernel, each output channel padded to 16 bytes */
+  return out_channels * PADDED_SIZE(((kernel_height * kernel_width * input_channels) / 2), 16);
+}
+
+WORD32 xa_nn_conv2d_std_prepack_getsize_sym8sxsym16s(
+    WORD32 input_channels,
+    WORD32 kernel_height,
+    WORD32 kernel_width,
+    WORD32 out_channels)
+{
+  XA_NNLIB_CHK_COND((input_channels <= 0), -1);
+  XA_NNLIB_CHK_COND((kernel_height <= 0), -1);
+  XA_NNLIB_CHK_COND((kernel_width <= 0), -1);
+  XA_NNLIB_CHK_COND((out_channels <= 0), -1);
+
+  /* Every kernel row (kernel_width x input_channels) padded to 8 bytes,
+   * followed by an unpadded copy when the rows needed padding */
+  WORD32 row_length = kernel_width * input_channels;
+  WORD32 mem_req = out_channels * kernel_height * PADDED_SIZE(row_length, 8);
+  if (PADDED_SIZE(row_length, 8) != row_length)
+  {
+    mem_req = ALIGNED_SIZE(mem_req, ALIGNMENT) + out_channels * kernel_height * row_length;
+  }
+  return mem_req;
+}
+
+WORD32 xa_nn_conv2d_std_v2_prepacked_getsize_sym8sxsym16s(
+    WORD32 input_height,
+    WORD32 input_width,
+    WORD32 input_channels,
+    WORD32 kernel_height,
+    WORD32 kernel_width,
+    WORD32 y_stride,
+    WORD32 y_padding,
+    WORD32 x_stride,
+    WORD32 x_padding,
+    WORD32 out_height,
+    WORD32 out_width,
+    WORD32 out_channels,
+    WORD32 out_data_format)
+{
+  XA_NNLIB_CHK_COND((input_height <= 0), -1);
+  XA_NNLIB_CHK_COND((input_width <= 0), -1);
+  XA_NNLIB_CHK_COND((input_channels <= 0), -1);
+  XA_NNLIB_CHK_COND((kernel_height <= 0), -1);
+  XA_NNLIB_CHK_COND((kernel_width <= 0), -1);
+  XA_NNLIB_CHK_COND((y_stride <= 0), -1);
+  XA_NNLIB_CHK_COND((y_padding < 0), -1);
+  XA_NNLIB_CHK_COND((x_stride <= 0), -1);
+  XA_NNLIB_CHK_COND((x_padding < 0), -1);
+  XA_NNLIB_CHK_COND((out_height <= 0), -1);
+  XA_NNLIB_CHK_COND((out_width <= 0), -1);
+  XA_NNLIB_CHK_COND((out_channels <= 0), -1);
+
+  /* Padded kernel path reads the prepacked kernel in place, no scratch */
+  if (!(x_padding) && !(input_channels & 0x1) && !(out_channels & 0x3) && !(out_width & 0x1) && (out_data_format == 0) && ((out_width - 1) * x_stride <= (input_width - kernel_width)))
+  {
+    return ALIGNMENT;
+  }
+
+  return xa_nn_conv2d_std_getsize(input_height, input_width, input_channels,
+      kernel_height, kernel_width, input_channels, y_stride, y_padding, x_stride, x_padding,
+      out_height, out_width, out_channels, PREC_SYM16S, PREC_SYM8S, 1, 1, out_data_format);
+}
+
 WORD32 xa_nn_dilated_conv2d_std_getsize(
     WORD32 input_height,
     WORD32 input_channels,
@@ -651,9 +960,22 @@ VOID xa_nn_conv2d_std_init_state_sym4s(
   AE_SETCEND0(p_state->cir_buf.p_end);
 
   p_mem = ALIGNED_ADDR(p_mem, 16);
-  ae_int8x16 *dest_ker = (ae_int8x16 *)p_mem;
   p_state->p_kernel_padded = (void *)p_mem;
+  conv2d_std_pack_kernel_sym4s(p_mem, p_kernel, kernel_height * kernel_width * input_channels_pad, output_channels);
+}
+
+/* Swaps the nibbles of each sym4s kernel byte and pads every output channel
+ * to a multiple of 16 bytes, the layout xa_nn_matXvec_sym4sxasym8s_asym8s_circ
+ * expects for its vec operand. p_dst must be 16 byte aligned. */
+VOID conv2d_std_pack_kernel_sym4s(
+    VOID *p_dst,
+    const VOID *p_kernel,
+    WORD32 kernel_size,
+    WORD32 output_channels)
+{
+  ae_int8x16 *dest_ker = (ae_int8x16 *)p_dst;
   ae_int8x16 *src_ker = (ae_int8x16 *)p_kernel;
+  WORD32 kernel_bytes = kernel_size / 2;
 
   for(int num_ker=0; num_ker< output_channels; num_ker++)
   {
@@ -663,7 +985,7 @@ VOID xa_nn_conv2d_std_init_state_sym4s(
     ae_int64 mask_higher_64 = AE_MOVINT64_FROMINT32X2(AE_MOVDA32X2(0xF0F0F0F0, 0xF0F0F0F0));
     ae_int8x8 mask_lower = AE_MOVINT8X8_FROMINT64(mask_lower_64);
     ae_int8x8 mask_higher = AE_MOVINT8X8_FROMINT64(mask_higher_64);
-    for(itr=0; itr < ((kernel_width * kernel_height * input_channels_pad) / 2) >> 4; itr++)
+    for(itr=0; itr < kernel_bytes >> 4; itr++)
     {
       ae_int8x8 dr0, dr1;
       ae_int8x8 lower_dr0 = AE_MOVDA8(0);
@@ -685,7 +1007,7 @@ VOID xa_nn_conv2d_std_init_state_sym4s(
       dr1 = AE_INT8X8_OR_INT8X8(lower_dr1, higher_dr1);
       AE_SA8X8X2_IP(dr0, dr1, desc_align, dest_ker);
     }
-    if(((kernel_width * kernel_height * input_channels_pad) / 2)&15)
+    if(kernel_bytes&15)
     {
       ae_int8x8 dr0, dr1;
       ae_int8x8 lower_dr0 = AE_MOVDA8(0);
@@ -694,7 +1016,7 @@ VOID xa_nn_conv2d_std_init_state_sym4s(
       ae_int8x8 higher_dr1 = AE_MOVDA8(0);          
       src_align = AE_LA128_PP(src_ker);
       desc_align = AE_ZALIGN128();
-      AE_LAV8X8X2_XP(dr0, dr1, src_align, src_ker, ((kernel_width * kernel_height * input_channels_pad) / 2)&15);
+      AE_LAV8X8X2_XP(dr0, dr1, src_align, src_ker, kernel_bytes&15);
       lower_dr0 = AE_INT8X8_AND_INT8X8(dr0, mask_lower);
       higher_dr0 = AE_INT8X8_AND_INT8X8(dr0, mask_higher);
       lower_dr1 = AE_INT8X8_AND_INT8X8(dr1, mask_lower);
@@ -705,15 +1027,14 @@ VOID xa_nn_conv2d_std_init_state_sym4s(
       higher_dr1 = AE_SRLI8(higher_dr1, 4);
       dr0 = AE_INT8X8_OR_INT8X8(lower_dr0, higher_dr0);
       dr1 = AE_INT8X8_OR_INT8X8(lower_dr1, higher_dr1);
-      AE_SAV8X8X2_XP(dr0, dr1, desc_align, dest_ker, ((kernel_width * kernel_height * input_channels_pad) / 2)&15);    
+      AE_SAV8X8X2_XP(dr0, dr1, desc_align, dest_ker, kernel_bytes&15);    
     }
     AE_SA128POS_FP(desc_align, dest_ker);
-    memset(dest_ker, 0, PADDED_SIZE(((kernel_width * kernel_height * input_channels_pad) / 2), 16) - ((kernel_width * kernel_height * input_channels_pad) / 2));
-    dest_ker = (ae_int8x16 *)((WORD8 *)dest_ker + (PADDED_SIZE(((kernel_width * kernel_height * input_channels_pad) / 2), 16) - ((kernel_width * kernel_height * input_channels_pad) / 2)));
+    memset(dest_ker, 0, PADDED_SIZE(kernel_bytes, 16) - kernel_bytes);
+    dest_ker = (ae_int8x16 *)((WORD8 *)dest_ker + (PADDED_SIZE(kernel_bytes, 16) - kernel_bytes));
   }
 }
 
-
 VOID xa_nn_conv2d_dilation_init_state(
     VOID *p_scratch,
     VOID *p_kernel,
@@ -2350,4 +2671,25 @@ VOID conv2d_std_update_cir_buf_asym8(
 
 }
 
+/* Input row window [inp_h_idx, inp_h_idx + inp_height_cur) needed for output rows starting at itr_ih */
+VOID conv2d_std_tile_inp_rows(
+    WORD32 itr_ih,
+    WORD32 tile_height,
+    WORD32 inp_h,
+    WORD32 ker_h,
+    WORD32 y_str,
+    WORD32 *p_inp_h_idx,
+    WORD32 *p_y_padding_cur,
+    WORD32 *p_inp_height_cur)
+{
+  WORD32 inp_h_idx = itr_ih < 0 ? 0 : (itr_ih >= inp_h ? inp_h - 1 : itr_ih);
+  WORD32 y_padding_cur = itr_ih < 0 ? -itr_ih : 0;
+  WORD32 inp_height_cur = (tile_height - 1)*y_str + ker_h - y_padding_cur;
+  inp_height_cur = inp_height_cur > inp_h - inp_h_idx ? inp_h - inp_h_idx : inp_height_cur;
+  inp_height_cur = itr_ih >= inp_h ? 0 : inp_height_cur;
+  *p_inp_h_idx = inp_h_idx;
+  *p_y_padding_cur = y_padding_cur;
+  *p_inp_height_cur = inp_height_cur;
+}
+
 #endif /* ENABLE_SCRATCH_SIZE_API_ONLY */
@@ -95,6 +95,12 @@ VOID xa_nn_conv2d_std_init_state_sym4s(
     WORD32 out_channels,
     WORD32 input_precision);
 
+VOID conv2d_std_pack_kernel_sym4s(
+    VOID *p_dst,
+    const VOID *p_kernel,
+    WORD32 kernel_size,
+    WORD32 output_channels);
+
 VOID xa_nn_dilated_conv2d_std_init_circ_buf(
     VOID *p_handle,
     VOID *p_kernel,
@@ -381,5 +387,15 @@ VOID conv2d_std_update_cir_buf_asym8(
     xa_nn_conv_state_t *p_state,
     WORD32 pad_val);
 
+VOID conv2d_std_tile_inp_rows(
+    WORD32 itr_ih,
+    WORD32 tile_height,
+    WORD32 inp_h,
+    WORD32 ker_h,
+    WORD32 y_str,
+    WORD32 *p_inp_h_idx,
+    WORD32 *p_y_padding_cur,
+    WORD32 *p_inp_height_cur);
+
 #endif /* __XA_NN_CONV2D_STD_STATE_H__ */
 
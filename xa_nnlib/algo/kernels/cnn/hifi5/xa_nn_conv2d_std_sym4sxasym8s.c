@@ -226,14 +226,24 @@ static WORD32 internal_xa_nn_conv2d_std_per_chan_sym4sxasym8s(
     WORD32 * p_out_shift,
     WORD32 out_zero_bias,
     WORD32 out_data_format,
-    VOID *p_scratch)
+    VOID *p_scratch,
+    WORD32 kernel_prepacked)
 {
   WORD32 j;
   WORD32 input_bytewidth = 1;
   VOID *pp_inp = (VOID *)p_inp;
 
   xa_nn_conv_state_t *p_state = (xa_nn_conv_state_t *)p_scratch;
-  xa_nn_conv2d_std_init_state_sym4s((void*)p_state,(void*)p_kernel,input_height,input_channels,kernel_height,kernel_width,x_stride,y_stride,y_padding,out_height,out_channels,-4);
+  if(kernel_prepacked)
+  {
+    /* Kernel already in the layout produced by xa_nn_conv2d_std_prepack_sym4s */
+    xa_nn_conv2d_std_init_state((void*)p_state,(void*)p_kernel,input_height,input_channels,kernel_height,kernel_width,x_stride,y_stride,y_padding,out_height,-4);
+    p_state->p_kernel_padded = (void*)p_kernel;
+  }
+  else
+  {
+    xa_nn_conv2d_std_init_state_sym4s((void*)p_state,(void*)p_kernel,input_height,input_channels,kernel_height,kernel_width,x_stride,y_stride,y_padding,out_height,out_channels,-4);
+  }
 
   WORD32 out_channels_offset = out_data_format ? out_height * out_width : 1;
   WORD32 out_height_offset = out_data_format ? out_width : out_width * out_channels;
@@ -310,7 +320,7 @@ static WORD32 internal_xa_nn_conv2d_std_per_chan_sym4sxasym8s(
 }
 
 
-WORD32 xa_nn_conv2d_std_per_chan_sym4sxasym8s(
+static WORD32 conv2d_std_per_chan_sym4sxasym8s(
     WORD8* __restrict__ p_out,
     const WORD8* __restrict__ p_inp,
     const WORD8* __restrict__ p_kernel,
@@ -332,7 +342,8 @@ WORD32 xa_nn_conv2d_std_per_chan_sym4sxasym8s(
     WORD32 * p_out_shift,
     WORD32 out_zero_bias,
     WORD32 out_data_format,
-    VOID *p_scratch)
+    VOID *p_scratch,
+    WORD32 kernel_prepacked)
 {
    /* NULL pointer checks */
   XA_NNLIB_ARG_CHK_PTR(p_out, -1);
@@ -433,7 +444,8 @@ WORD32 xa_nn_conv2d_std_per_chan_sym4sxasym8s(
         p_out_shift,
         out_zero_bias,
         out_data_format,
-        p_scratch);
+        p_scratch,
+        kernel_prepacked);
   }
   else
   {
@@ -484,7 +496,8 @@ WORD32 xa_nn_conv2d_std_per_chan_sym4sxasym8s(
             p_out_shift,
             out_zero_bias,
             out_data_format,
-            p_scratch);
+            p_scratch,
+            kernel_prepacked);
       }
       itr_oh += tile_height;
       itr_ih += tile_height * y_str;
@@ -494,3 +507,90 @@ WORD32 xa_nn_conv2d_std_per_chan_sym4sxasym8s(
 
   return ret;
 }
+
+WORD32 xa_nn_conv2d_std_per_chan_sym4sxasym8s(
+    WORD8* __restrict__ p_out,
+    const WORD8* __restrict__ p_inp,
+    const WORD8* __restrict__ p_kernel,
+    const WORD32* __restrict__ p_bias,
+    WORD32 input_height,
+    WORD32 input_width,
+    WORD32 input_channels,
+    WORD32 kernel_height,
+    WORD32 kernel_width,
+    WORD32 out_channels,
+    WORD32 x_stride,
+    WORD32 y_stride,
+    WORD32 x_padding,
+    WORD32 y_padding,
+    WORD32 out_height,
+    WORD32 out_width,
+    WORD32 input_zero_bias,
+    WORD32 * p_out_multiplier,
+    WORD32 * p_out_shift,
+    WORD32 out_zero_bias,
+    WORD32 out_data_format,
+    VOID *p_scratch)
+{
+  return conv2d_std_per_chan_sym4sxasym8s(p_out, p_inp, p_kernel, p_bias,
+      input_height, input_width, input_channels, kernel_height, kernel_width, out_channels,
+      x_stride, y_stride, x_padding, y_padding, out_height, out_width,
+      input_zero_bias, p_out_multiplier, p_out_shift, out_zero_bias, out_data_format, p_scratch, 0);
+}
+
+WORD32 xa_nn_conv2d_std_prepack_sym4s(
+    WORD8* __restrict__ p_kernel_packed,
+    const WORD8* __restrict__ p_kernel,
+    WORD32 input_channels,
+    WORD32 kernel_height,
+    WORD32 kernel_width,
+    WORD32 out_channels)
+{
+  /* NULL pointer checks */
+  XA_NNLIB_ARG_CHK_PTR(p_kernel_packed, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_kernel, -1);
+  /* Pointer alignment checks */
+  XA_NNLIB_ARG_CHK_ALIGN(p_kernel_packed, ALIGNMENT_16, -1);
+  /* Basic Parameter checks */
+  XA_NNLIB_ARG_CHK_COND((input_channels <= 0), -1);
+  XA_NNLIB_ARG_CHK_COND((kernel_height <= 0 || kernel_width <= 0), -1);
+  XA_NNLIB_ARG_CHK_COND((out_channels <= 0), -1);
+  XA_NNLIB_ARG_CHK_COND((((input_channels * kernel_width * kernel_height) % 2) != 0), -1);
+
+  conv2d_std_pack_kernel_sym4s(p_kernel_packed, p_kernel, kernel_height * kernel_width * input_channels, out_channels);
+
+  return 0;
+}
+
+WORD32 xa_nn_conv2d_std_prepacked_per_chan_sym4sxasym8s(
+    WORD8* __restrict__ p_out,
+    const WORD8* __restrict__ p_inp,
+    const WORD8* __restrict__ p_kernel,
+    const WORD32* __restrict__ p_bias,
+    WORD32 input_height,
+    WORD32 input_width,
+    WORD32 input_channels,
+    WORD32 kernel_height,
+    WORD32 kernel_width,
+    WORD32 out_channels,
+    WORD32 x_stride,
+    WORD32 y_stride,
+    WORD32 x_padding,
+    WORD32 y_padding,
+    WORD32 out_height,
+    WORD32 out_width,
+    WORD32 input_zero_bias,
+    WORD32 * p_out_multiplier,
+    WORD32 * p_out_shift,
+    WORD32 out_zero_bias,
+    WORD32 out_data_format,
+    VOID *p_scratch)
+{
+  /* Pointer alignment checks */
+  XA_NNLIB_ARG_CHK_ALIGN(p_kernel, ALIGNMENT_16, -1);
+
+  return conv2d_std_per_chan_sym4sxasym8s(p_out, p_inp, p_kernel, p_bias,
+      input_height, input_width, input_channels, kernel_height, kernel_width, out_channels,
+      x_stride, y_stride, x_padding, y_padding, out_height, out_width,
+      input_zero_bias, p_out_multiplier, p_out_shift, out_zero_bias, out_data_format, p_scratch, 1);
+}
@@ -19,9 +19,15 @@
 * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 
 ******************************************************************************/
+#include <string.h>
+#include <math.h>
 #include "xa_nnlib_common.h"
+#include "xa_nnlib_common_fpu.h"
 #include "xa_nn_conv2d_std_state.h"
 #include "xa_nnlib_common_macros_hifi5.h"
+#include "xa_nnlib_common_dma.h"
+#include "xa_nnlib_common_act_lut.h"
+#include "xa_nnlib_common_residual.h"
 
 static WORD32 conv_x_left_pad(
     WORD32 x_padding,
@@ -141,11 +147,14 @@ static WORD32 conv_x_right_pad(
   return out_width_over_x_r_pad;
 }
 
-static void conv_y_pad_nhwc_out(
+static void conv_y_pad_out(
     WORD8 *__restrict__ p_out,
     WORD32 out_height,
     WORD32 out_width,
     WORD32 out_channels,
+    WORD32 out_channels_offset,
+    WORD32 out_width_offset,
+    WORD32 out_height_offset,
     const WORD32* __restrict__ p_bias,
     WORD32 * p_out_multiplier,
     WORD32 * p_out_shift,
@@ -156,11 +165,6 @@ static void conv_y_pad_nhwc_out(
 {
   WORD32 i,j,k;
   WORD32 left_shift, right_shift;
-  WORD32 out_height_offset, out_width_offset, out_channels_offset;
-
-  out_channels_offset = 1;
-  out_width_offset = out_channels;
-  out_height_offset = out_width * out_width_offset;
 
   ae_int32x2 max_int8 = SW_MOVDA32(out_activation_max);
   ae_int32x2 min_int8 = SW_MOVDA32(out_activation_min);
@@ -620,10 +624,13 @@ static WORD32 internal_xa_nn_conv2d_std_per_chan_sym8sxasym8s(
     WORD32 out_height,
     WORD32 out_width,
     WORD32 input_zero_bias,
+    WORD32 pad_val,
     WORD32 * p_out_multiplier,
     WORD32 * p_out_shift,
     WORD32 out_zero_bias,
-    WORD32 out_data_format,
+    WORD32 out_channels_offset,
+    WORD32 out_height_offset,
+    WORD32 out_width_offset,
     VOID *p_scratch,
     WORD32 out_activation_min,
     WORD32 out_activation_max,
@@ -636,16 +643,15 @@ static WORD32 internal_xa_nn_conv2d_std_per_chan_sym8sxasym8s(
   xa_nn_conv_state_t *p_state = (xa_nn_conv_state_t *)p_scratch;
   xa_nn_conv2d_std_init_state((void*)p_state,(void*)p_kernel,input_height,input_channels,kernel_height,kernel_width,x_stride,y_stride,y_padding,out_height,-4);
 
-  WORD32 out_channels_offset = out_data_format ? out_height * out_width : 1;
-  WORD32 out_height_offset = out_data_format ? out_width : out_width * out_channels;
-  WORD32 out_width_offset = out_data_format ? 1 : out_channels;
-
   WORD32 x_padding_var = x_padding;
   WORD32 input_channels_pad = input_channels;
 
+  /* Outputs over the pad region only are bias-only when padding with the zero point */
+  WORD32 pad_is_zero_point = (pad_val == -input_zero_bias);
+
   /* When kernel convolves over x-left pad region only */
   WORD32 out_width_over_x_pad = 0;
-  if(x_padding_var >= kernel_width)
+  if(x_padding_var >= kernel_width && pad_is_zero_point)
   {
     out_width_over_x_pad = conv_x_left_pad(x_padding, kernel_width, x_stride, out_width, out_height, out_channels, out_channels_offset, out_width_offset, out_height_offset, p_bias, p_out, p_out_multiplier, p_out_shift, out_zero_bias, out_activation_min, out_activation_max, p_dma_cfg);
     x_padding_var -= out_width_over_x_pad * x_stride;
@@ -656,7 +662,7 @@ static WORD32 internal_xa_nn_conv2d_std_per_chan_sym8sxasym8s(
   // Determine x-right padding
   WORD32 x_r_pad = kernel_width + (out_width - 1) * x_stride - (x_padding + input_width);
   x_r_pad = x_r_pad < 0 ? 0 : x_r_pad;
-  if(x_r_pad >= kernel_width)
+  if(x_r_pad >= kernel_width && pad_is_zero_point)
   {
     out_width_over_x_r_pad = conv_x_right_pad(x_padding, input_width, x_stride, out_width, out_height, out_channels, out_channels_offset, out_width_offset, out_height_offset, p_bias, p_out, p_out_multiplier, p_out_shift, out_zero_bias, out_activation_min, out_activation_max, p_dma_cfg);
   }
@@ -668,7 +674,7 @@ static WORD32 internal_xa_nn_conv2d_std_per_chan_sym8sxasym8s(
   WORD32 y_b_pad = kernel_height + (out_height - 1) * y_stride - (y_padding + input_height);
   y_b_pad = y_b_pad < 0 ? 0 : y_b_pad;
 
-  conv2d_std_init_cir_buf_asym8(input_channels, input_channels_pad, input_bytewidth, input_width, input_height, y_padding, y_b_pad, x_padding_var, kernel_width, x_stride, (VOID**)&pp_inp, p_state, -input_zero_bias);
+  conv2d_std_init_cir_buf_asym8(input_channels, input_channels_pad, input_bytewidth, input_width, input_height, y_padding, y_b_pad, x_padding_var, kernel_width, x_stride, (VOID**)&pp_inp, p_state, pad_val);
 
   // Index to padded input width
   WORD32 idx_beg_inp_width_pad = kernel_width - x_stride;
@@ -679,7 +685,7 @@ static WORD32 internal_xa_nn_conv2d_std_per_chan_sym8sxasym8s(
   for(j=0;j<out_width-out_width_over_x_pad-out_width_over_x_r_pad;j++)
   {
     // Add x_stride x (input_height x input_channels) new planes to circular buffer
-    conv2d_std_update_cir_buf_asym8(input_channels, input_channels_pad, input_bytewidth, input_width, input_height, y_padding, y_b_pad, x_padding_var, kernel_width, x_stride, (VOID**)&pp_inp, idx_beg_inp_width_pad, p_state, -input_zero_bias);
+    conv2d_std_update_cir_buf_asym8(input_channels, input_channels_pad, input_bytewidth, input_width, input_height, y_padding, y_b_pad, x_padding_var, kernel_width, x_stride, (VOID**)&pp_inp, idx_beg_inp_width_pad, p_state, pad_val);
 
     // Update index to input width padded
     idx_beg_inp_width_pad += x_stride;
@@ -711,7 +717,279 @@ static WORD32 internal_xa_nn_conv2d_std_per_chan_sym8sxasym8s(
   return 0;
 }
 
-WORD32 xa_nn_conv2d_std_v2_per_chan_sym8sxasym8s(
+/* Row-tiled NHWC convolution with input rows of the next tile fetched
+ * through DMA while the current tile is being computed */
+static WORD32 conv2d_std_v2_dma_per_chan_sym8sxasym8s(
+    WORD8* __restrict__ p_out,
+    const WORD8* __restrict__ p_inp,
+    const WORD8* __restrict__ p_kernel,
+    const WORD32* __restrict__ p_bias,
+    WORD32 inp_h,
+    WORD32 inp_w,
+    WORD32 input_channels,
+    WORD32 ker_h,
+    WORD32 ker_w,
+    WORD32 out_channels,
+    WORD32 x_str,
+    WORD32 y_str,
+    WORD32 x_pad,
+    WORD32 y_pad,
+    WORD32 out_h,
+    WORD32 out_w,
+    WORD32 input_zero_bias,
+    WORD32 * p_out_multiplier,
+    WORD32 * p_out_shift,
+    WORD32 out_zero_bias,
+    VOID *p_scratch,
+    WORD32 out_activation_min,
+    WORD32 out_activation_max,
+    WORD32 tile_height,
+    xa_dma_cfg_t *p_dma_cfg)
+{
+  WORD32 ret = 0;
+  WORD32 row_bytes = inp_w * input_channels;
+  WORD32 itr_oh = 0, itr_ih = -y_pad, buf_idx = 0;
+  WORD32 cur_h = tile_height > out_h ? out_h : tile_height;
+  WORD32 inp_h_idx, y_padding_cur, inp_height_cur, dma_id = -1;
+
+  conv2d_std_tile_inp_rows(itr_ih, cur_h, inp_h, ker_h, y_str, &inp_h_idx, &y_padding_cur, &inp_height_cur);
+  if(inp_height_cur > 0)
+    dma_id = xa_nn_dma_fetch(p_dma_cfg, buf_idx, &p_inp[inp_h_idx * row_bytes], inp_height_cur * row_bytes);
+
+  do
+  {
+    WORD32 next_oh = itr_oh + cur_h;
+    WORD32 next_ih = itr_ih + cur_h * y_str;
+    WORD32 next_h = tile_height > out_h - next_oh ? out_h - next_oh : tile_height;
+    WORD32 next_inp_h_idx = 0, next_y_padding_cur = 0, next_inp_height_cur = 0, next_dma_id = -1;
+
+    /* Start fetching the next tile into the other buffer */
+    if(next_oh < out_h)
+    {
+      conv2d_std_tile_inp_rows(next_ih, next_h, inp_h, ker_h, y_str, &next_inp_h_idx, &next_y_padding_cur, &next_inp_height_cur);
+      if(next_inp_height_cur > 0)
+        next_dma_id = xa_nn_dma_fetch(p_dma_cfg, buf_idx ^ 1, &p_inp[next_inp_h_idx * row_bytes], next_inp_height_cur * row_bytes);
+    }
+
+    if(inp_height_cur <= 0)
+    {
+      conv_y_pad_out(
+          &p_out[itr_oh * out_w * out_channels],
+          cur_h,
+          out_w,
+          out_channels,
+          1,
+          out_channels,
+          out_w * out_channels,
+          p_bias,
+          p_out_multiplier,
+          p_out_shift,
+          out_zero_bias,
+          out_activation_min,
+          out_activation_max,
+          NULL);
+    }
+    else
+    {
+      /* Read in place if the transfer could not be started */
+      const WORD8 *p_tile_inp = dma_id >= 0 ? (const WORD8 *)p_dma_cfg->p_local_buf[buf_idx] : &p_inp[inp_h_idx * row_bytes];
+      xa_nn_dma_wait(p_dma_cfg, dma_id);
+      ret |= internal_xa_nn_conv2d_std_per_chan_sym8sxasym8s(
+          &p_out[itr_oh * out_w * out_channels],
+          p_tile_inp,
+          p_kernel,
+          p_bias,
+          inp_height_cur,
+          inp_w,
+          input_channels,
+          ker_h,
+          ker_w,
+          out_channels,
+          x_str,
+          y_str,
+          x_pad,
+          y_padding_cur,
+          cur_h,
+          out_w,
+          input_zero_bias,
+          -input_zero_bias,
+          p_out_multiplier,
+          p_out_shift,
+          out_zero_bias,
+          1,
+          out_w * out_channels,
+          out_channels,
+          p_scratch,
+          out_activation_min,
+          out_activation_max,
+          NULL);
+    }
+
+    itr_oh = next_oh;
+    itr_ih = next_ih;
+    cur_h = next_h;
+    inp_h_idx = next_inp_h_idx;
+    y_padding_cur = next_y_padding_cur;
+    inp_height_cur = next_inp_height_cur;
+    dma_id = next_dma_id;
+    buf_idx ^= 1;
+  } while(itr_oh < out_h);
+
+  return ret;
+}
+
+/* Convolution of output rows [row_start, row_end) and output channels
+ * [oc_start, oc_end) in tiles of out_channels_block channels by tile_height
+ * rows, for both NHWC and NCHW output */
+static WORD32 conv2d_std_v2_tiles_per_chan_sym8sxasym8s(
+    WORD8* __restrict__ p_out,
+    const WORD8* __restrict__ p_inp,
+    const WORD8* __restrict__ p_kernel,
+    const WORD32* __restrict__ p_bias,
+    WORD32 inp_h,
+    WORD32 inp_w,
+    WORD32 input_channels,
+    WORD32 ker_h,
+    WORD32 ker_w,
+    WORD32 out_channels,
+    WORD32 x_str,
+    WORD32 y_str,
+    WORD32 x_pad,
+    WORD32 y_pad,
+    WORD32 out_h,
+    WORD32 out_w,
+    WORD32 input_zero_bias,
+    WORD32 * p_out_multiplier,
+    WORD32 * p_out_shift,
+    WORD32 out_zero_bias,
+    WORD32 out_data_format,
+    VOID *p_scratch,
+    WORD32 out_activation_min,
+    WORD32 out_activation_max,
+    WORD32 row_start,
+    WORD32 row_end,
+    WORD32 oc_start,
+    WORD32 oc_end,
+    WORD32 tile_height,
+    WORD32 out_channels_block,
+    xa_dma_cfg_t *p_dma_cfg)
+{
+  WORD32 ret = 0;
+  WORD32 itr_oc, itr_oh, itr_ih, cur_oc, cur_h;
+  WORD32 inp_h_idx, y_padding_cur, inp_height_cur;
+
+  WORD32 out_channels_offset = out_data_format ? out_h * out_w : 1;
+  WORD32 out_height_offset = out_data_format ? out_w : out_w * out_channels;
+  WORD32 out_width_offset = out_data_format ? 1 : out_channels;
+
+  for(itr_oc = oc_start; itr_oc < oc_end; itr_oc += cur_oc)
+  {
+    cur_oc = out_channels_block > oc_end - itr_oc ? oc_end - itr_oc : out_channels_block;
+    const WORD8 *p_kernel_blk = &p_kernel[itr_oc * ker_h * ker_w * input_channels];
+    const WORD32 *p_bias_blk = p_bias != NULL ? &p_bias[itr_oc] : NULL;
+    WORD8 *p_out_blk = &p_out[itr_oc * out_channels_offset];
+
+    /* Whole output plane in one tile, no need to split the input */
+    if(row_start == 0 && row_end == out_h && tile_height >= out_h)
+    {
+      ret |= internal_xa_nn_conv2d_std_per_chan_sym8sxasym8s(
+          p_out_blk,
+          p_inp,
+          p_kernel_blk,
+          p_bias_blk,
+          inp_h,
+          inp_w,
+          input_channels,
+          ker_h,
+          ker_w,
+          cur_oc,
+          x_str,
+          y_str,
+          x_pad,
+          y_pad,
+          out_h,
+          out_w,
+          input_zero_bias,
+          -input_zero_bias,
+          &p_out_multiplier[itr_oc],
+          &p_out_shift[itr_oc],
+          out_zero_bias,
+          out_channels_offset,
+          out_height_offset,
+          out_width_offset,
+          p_scratch,
+          out_activation_min,
+          out_activation_max,
+          p_dma_cfg);
+      continue;
+    }
+
+    itr_oh = row_start;
+    itr_ih = row_start * y_str - y_pad;
+    do
+    {
+      cur_h = tile_height > row_end - itr_oh ? row_end - itr_oh : tile_height;
+      conv2d_std_tile_inp_rows(itr_ih, cur_h, inp_h, ker_h, y_str, &inp_h_idx, &y_padding_cur, &inp_height_cur);
+
+      if(inp_height_cur <= 0)
+      {
+        conv_y_pad_out(
+            &p_out_blk[itr_oh * out_height_offset],
+            cur_h,
+            out_w,
+            cur_oc,
+            out_channels_offset,
+            out_width_offset,
+            out_height_offset,
+            p_bias_blk,
+            &p_out_multiplier[itr_oc],
+            &p_out_shift[itr_oc],
+            out_zero_bias,
+            out_activation_min,
+            out_activation_max,
+            p_dma_cfg);
+      }
+      else
+      {
+        ret |= internal_xa_nn_conv2d_std_per_chan_sym8sxasym8s(
+            &p_out_blk[itr_oh * out_height_offset],
+            &p_inp[inp_h_idx * inp_w * input_channels],
+            p_kernel_blk,
+            p_bias_blk,
+            inp_height_cur,
+            inp_w,
+            input_channels,
+            ker_h,
+            ker_w,
+            cur_oc,
+            x_str,
+            y_str,
+            x_pad,
+            y_padding_cur,
+            cur_h,
+            out_w,
+            input_zero_bias,
+            -input_zero_bias,
+            &p_out_multiplier[itr_oc],
+            &p_out_shift[itr_oc],
+            out_zero_bias,
+            out_channels_offset,
+            out_height_offset,
+            out_width_offset,
+            p_scratch,
+            out_activation_min,
+            out_activation_max,
+            p_dma_cfg);
+      }
+      itr_oh += cur_h;
+      itr_ih += cur_h * y_str;
+    } while(itr_oh < row_end);
+  }
+
+  return ret;
+}
+
+WORD32 xa_nn_conv2d_std_v2_tiled_per_chan_sym8sxasym8s(
     WORD8* __restrict__ p_out,
     const WORD8* __restrict__ p_inp,
     const WORD8* __restrict__ p_kernel,
@@ -736,6 +1014,7 @@ WORD32 xa_nn_conv2d_std_v2_per_chan_sym8sxasym8s(
     VOID *p_scratch,
     WORD32 out_activation_min,
     WORD32 out_activation_max,
+    const xa_nn_conv2d_std_tile_plan_t *p_plan,
     xa_dma_cfg_t *p_dma_cfg)
 {
    /* NULL pointer checks */
@@ -760,6 +1039,12 @@ WORD32 xa_nn_conv2d_std_v2_per_chan_sym8sxasym8s(
   XA_NNLIB_ARG_CHK_COND((out_activation_min < -128 || out_activation_min > 127), -1);
   XA_NNLIB_ARG_CHK_COND((out_activation_max < out_activation_min || out_activation_max > 127), -1);
 
+  if(p_plan != NULL)
+  {
+    XA_NNLIB_ARG_CHK_COND((p_plan->tile_height <= 0), -1);
+    XA_NNLIB_ARG_CHK_COND((p_plan->out_channels_block <= 0), -1);
+  }
+
   int itr;
   for(itr=0;itr<out_channels;itr++){
     XA_NNLIB_ARG_CHK_COND((p_out_shift[itr] < -31 || p_out_shift[itr] > 31), -1);
@@ -796,118 +1081,1196 @@ WORD32 xa_nn_conv2d_std_v2_per_chan_sym8sxasym8s(
 
   int ret = 0;
   int tile_height = out_h;
+  int out_channels_block = out_channels;
   int mem_req = 0;
 
-  do
+  if(p_plan != NULL)
   {
-    mem_req = tile_height * out_w * out_channels + ker_h * ker_w * input_channels;
-    mem_req += ((tile_height - 1)*y_str + ker_h) * inp_w * input_channels;
-    mem_req += xa_nn_conv2d_std_getsize(((tile_height - 1)*y_str + ker_h),inp_w, input_channels,
-                    ker_h, ker_w, input_channels, y_str, y_pad, x_str, x_pad, tile_height, out_w, out_channels, PREC_ASYM8S, PREC_SYM8S,1,1,out_data_format);
-    mem_req += tile_height * 3 * sizeof(WORD32);
-    if(mem_req < XCHAL_DCACHE_SIZE || tile_height <= 0)
-      break;
-    tile_height = (tile_height - 8) & (~3);
-  } while(1);
-
-  if(tile_height <= 0)
-    tile_height = out_h;
-
-  if(tile_height == out_h || out_data_format == 1)
-  {
-    ret |= internal_xa_nn_conv2d_std_per_chan_sym8sxasym8s(
-        p_out,
-        p_inp,
-        p_kernel,
-        p_bias,
-        inp_h,
-        inp_w,
-        input_channels,
-        ker_h,
-        ker_w,
-        out_channels,
-        x_str,
-        y_str,
-        x_pad,
-        y_pad,
-        out_h,
-        out_w,
-        input_zero_bias,
-        p_out_multiplier,
-        p_out_shift,
-        out_zero_bias,
-        out_data_format,
-        p_scratch,
-        out_activation_min,
-        out_activation_max,
-        p_dma_cfg);
+    tile_height = p_plan->tile_height > out_h ? out_h : p_plan->tile_height;
+    out_channels_block = p_plan->out_channels_block > out_channels ? out_channels : p_plan->out_channels_block;
   }
   else
   {
-    int itr_oh, itr_ih;
-    itr_oh = 0;
-    itr_ih = -y_pad;
+    /* Default plan: row tiles sized to the data cache */
     do
     {
-      int inp_h_idx = itr_ih < 0 ? 0 : (itr_ih >= inp_h ? inp_h - 1 : itr_ih);
-      int y_padding_cur = itr_ih < 0 ? -itr_ih : 0;
-      int inp_height_cur = (tile_height - 1)*y_str + ker_h - y_padding_cur;
-      inp_height_cur = inp_height_cur > inp_h - inp_h_idx ? inp_h - inp_h_idx : inp_height_cur;
-      inp_height_cur = itr_ih >= inp_h ? 0 : inp_height_cur;
+      mem_req = tile_height * out_w * out_channels + ker_h * ker_w * input_channels;
+      mem_req += ((tile_height - 1)*y_str + ker_h) * inp_w * input_channels;
+      mem_req += xa_nn_conv2d_std_getsize(((tile_height - 1)*y_str + ker_h),inp_w, input_channels,
+                      ker_h, ker_w, input_channels, y_str, y_pad, x_str, x_pad, tile_height, out_w, out_channels, PREC_ASYM8S, PREC_SYM8S,1,1,out_data_format);
+      mem_req += tile_height * 3 * sizeof(WORD32);
+      if(mem_req < XCHAL_DCACHE_SIZE || tile_height <= 0)
+        break;
+      tile_height = (tile_height - 8) & (~3);
+    } while(1);
+
+    if(tile_height <= 0)
+      tile_height = out_h;
+  }
 
-      if(inp_height_cur == 0)
-      {
-        conv_y_pad_nhwc_out(
-            &p_out[itr_oh * out_w * out_channels],
-            tile_height,
-            out_w,
-            out_channels,
-            p_bias,
-            p_out_multiplier,
-            p_out_shift,
-            out_zero_bias,
-            out_activation_min,
-            out_activation_max,
-            p_dma_cfg);
-      }
-      else
-      {
-        ret |= internal_xa_nn_conv2d_std_per_chan_sym8sxasym8s(
-            &p_out[itr_oh * out_w * out_channels],
-            &p_inp[inp_h_idx * inp_w * input_channels],
-            p_kernel,
-            p_bias,
-            inp_height_cur,
-            inp_w,
-            input_channels,
-            ker_h,
-            ker_w,
-            out_channels,
-            x_str,
-            y_str,
-            x_pad,
-            y_padding_cur,
-            tile_height,
-            out_w,
-            input_zero_bias,
-            p_out_multiplier,
-            p_out_shift,
-            out_zero_bias,
-            out_data_format,
-            p_scratch,
-            out_activation_min,
-            out_activation_max,
-            p_dma_cfg);
-      }
-      itr_oh += tile_height;
-      itr_ih += tile_height * y_str;
-      tile_height = tile_height > out_h - itr_oh ? out_h - itr_oh : tile_height;
-    } while(itr_oh < out_h);
+  if(XA_NN_DMA_CFG_VALID(p_dma_cfg) && out_data_format == 0 && out_channels_block >= out_channels)
+  {
+    /* Shrink the tile till its input rows fit in one local buffer */
+    int row_bytes = inp_w * input_channels;
+    int dma_tile_height = tile_height;
+    while(dma_tile_height > 1 && ((dma_tile_height - 1)*y_str + ker_h) * row_bytes > p_dma_cfg->local_buf_size)
+    {
+      dma_tile_height = dma_tile_height > 4 ? ((dma_tile_height - 1) & (~3)) : dma_tile_height - 1;
+    }
+    if(((dma_tile_height - 1)*y_str + ker_h) * row_bytes <= p_dma_cfg->local_buf_size)
+    {
+      return conv2d_std_v2_dma_per_chan_sym8sxasym8s(
+          p_out,
+          p_inp,
+          p_kernel,
+          p_bias,
+          inp_h,
+          inp_w,
+          input_channels,
+          ker_h,
+          ker_w,
+          out_channels,
+          x_str,
+          y_str,
+          x_pad,
+          y_pad,
+          out_h,
+          out_w,
+          input_zero_bias,
+          p_out_multiplier,
+          p_out_shift,
+          out_zero_bias,
+          p_scratch,
+          out_activation_min,
+          out_activation_max,
+          dma_tile_height,
+          p_dma_cfg);
+    }
   }
 
+  ret = conv2d_std_v2_tiles_per_chan_sym8sxasym8s(
+      p_out,
+      p_inp,
+      p_kernel,
+      p_bias,
+      inp_h,
+      inp_w,
+      input_channels,
+      ker_h,
+      ker_w,
+      out_channels,
+      x_str,
+      y_str,
+      x_pad,
+      y_pad,
+      out_h,
+      out_w,
+      input_zero_bias,
+      p_out_multiplier,
+      p_out_shift,
+      out_zero_bias,
+      out_data_format,
+      p_scratch,
+      out_activation_min,
+      out_activation_max,
+      0,
+      out_h,
+      0,
+      out_channels,
+      tile_height,
+      out_channels_block,
+      p_dma_cfg);
+
+  return ret;
+}
+
+WORD32 xa_nn_conv2d_std_v2_per_chan_sym8sxasym8s(
+    WORD8* __restrict__ p_out,
+    const WORD8* __restrict__ p_inp,
+    const WORD8* __restrict__ p_kernel,
+    const WORD32* __restrict__ p_bias,
+    WORD32 input_height,
+    WORD32 input_width,
+    WORD32 input_channels,
+    WORD32 kernel_height,
+    WORD32 kernel_width,
+    WORD32 out_channels,
+    WORD32 x_stride,
+    WORD32 y_stride,
+    WORD32 x_padding,
+    WORD32 y_padding,
+    WORD32 out_height,
+    WORD32 out_width,
+    WORD32 input_zero_bias,
+    WORD32 * p_out_multiplier,
+    WORD32 * p_out_shift,
+    WORD32 out_zero_bias,
+    WORD32 out_data_format,
+    VOID *p_scratch,
+    WORD32 out_activation_min,
+    WORD32 out_activation_max,
+    xa_dma_cfg_t *p_dma_cfg)
+{
+  WORD32 ret;
+  ret = xa_nn_conv2d_std_v2_tiled_per_chan_sym8sxasym8s(p_out, p_inp, p_kernel, p_bias,
+            input_height, input_width, input_channels, kernel_height, kernel_width, out_channels,
+            x_stride, y_stride, x_padding, y_padding, out_height, out_width,
+            input_zero_bias, p_out_multiplier, p_out_shift, out_zero_bias, out_data_format, p_scratch,
+            out_activation_min, out_activation_max, NULL, p_dma_cfg);
   return ret;
 }
 
+/* Computes output rows [out_row_start, out_row_end) and output channels
+ * [out_ch_start, out_ch_end) of the full output tensor, so that disjoint
+ * slices can run concurrently with separate scratch buffers. */
+WORD32 xa_nn_conv2d_std_v2_slice_per_chan_sym8sxasym8s(
+    WORD8* __restrict__ p_out,
+    const WORD8* __restrict__ p_inp,
+    const WORD8* __restrict__ p_kernel,
+    const WORD32* __restrict__ p_bias,
+    WORD32 input_height,
+    WORD32 input_width,
+    WORD32 input_channels,
+    WORD32 kernel_height,
+    WORD32 kernel_width,
+    WORD32 out_channels,
+    WORD32 x_stride,
+    WORD32 y_stride,
+    WORD32 x_padding,
+    WORD32 y_padding,
+    WORD32 out_height,
+    WORD32 out_width,
+    WORD32 input_zero_bias,
+    WORD32 * p_out_multiplier,
+    WORD32 * p_out_shift,
+    WORD32 out_zero_bias,
+    WORD32 out_data_format,
+    VOID *p_scratch,
+    WORD32 out_activation_min,
+    WORD32 out_activation_max,
+    WORD32 out_row_start,
+    WORD32 out_row_end,
+    WORD32 out_ch_start,
+    WORD32 out_ch_end,
+    xa_dma_cfg_t *p_dma_cfg)
+{
+   /* NULL pointer checks */
+  XA_NNLIB_ARG_CHK_PTR(p_out, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_kernel, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_inp, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_scratch, -1);
+  /* Pointer alignment checks */
+  XA_NNLIB_ARG_CHK_ALIGN(p_bias, sizeof(WORD32), -1);
+  // XA_NNLIB_ARG_CHK_ALIGN(p_scratch, ALIGNMENT, -1);
+  /* Basic Parameter checks */
+  XA_NNLIB_ARG_CHK_COND((input_height <= 0 || input_width <= 0), -1);
+  XA_NNLIB_ARG_CHK_COND((input_channels <= 0), -1);
+  XA_NNLIB_ARG_CHK_COND((kernel_height <= 0 || kernel_width <= 0), -1);
+  XA_NNLIB_ARG_CHK_COND((out_channels <= 0), -1);
+  XA_NNLIB_ARG_CHK_COND((y_stride <= 0 || x_stride <= 0), -1);
+  XA_NNLIB_ARG_CHK_COND((y_padding < 0 || x_padding < 0), -1);
+  XA_NNLIB_ARG_CHK_COND((out_height <= 0 || out_width <= 0), -1);
+  XA_NNLIB_ARG_CHK_COND((input_zero_bias < -127 || input_zero_bias > 128), -1);
+  XA_NNLIB_ARG_CHK_COND((out_zero_bias < -128 || out_zero_bias > 127), -1);
+  XA_NNLIB_ARG_CHK_COND((out_data_format != 0 && out_data_format != 1), -1);
+  XA_NNLIB_ARG_CHK_COND((out_activation_min < -128 || out_activation_min > 127), -1);
+  XA_NNLIB_ARG_CHK_COND((out_activation_max < out_activation_min || out_activation_max > 127), -1);
+
+  XA_NNLIB_ARG_CHK_COND((out_row_start < 0 || out_row_end > out_height || out_row_start >= out_row_end), -1);
+  XA_NNLIB_ARG_CHK_COND((out_ch_start < 0 || out_ch_end > out_channels || out_ch_start >= out_ch_end), -1);
+
+  int itr;
+  for(itr=0;itr<out_channels;itr++){
+    XA_NNLIB_ARG_CHK_COND((p_out_shift[itr] < -31 || p_out_shift[itr] > 31), -1);
+  }
+  
+  /* Interchange height and width dimensions when i_h = k_h = o_h = 1 for better throughput */
+  WORD32 inp_h, inp_w, ker_h, ker_w, x_str, y_str, x_pad, y_pad, out_h, out_w;
+  if (input_height == 1 && kernel_height == 1 && out_height == 1)
+  {
+    inp_h = input_width;
+    inp_w = input_height;
+    ker_h = kernel_width;
+    ker_w = kernel_height;
+    x_str = y_stride;
+    y_str = x_stride;
+    x_pad = y_padding;
+    y_pad = x_padding;
+    out_h = out_width;
+    out_w = out_height;
+  }
+  else
+  {
+    inp_h = input_height;
+    inp_w = input_width;
+    ker_h = kernel_height;
+    ker_w = kernel_width;
+    x_str = x_stride;
+    y_str = y_stride;
+    x_pad = x_padding;
+    y_pad = y_padding;
+    out_h = out_height;
+    out_w = out_width;
+  }
+
+  /* Row range follows the height/width interchange, which only happens for
+   * a single output row */
+  WORD32 row_start = out_row_start, row_end = out_row_end;
+  if (input_height == 1 && kernel_height == 1 && out_height == 1)
+  {
+    row_start = 0;
+    row_end = out_h;
+  }
+
+  return conv2d_std_v2_tiles_per_chan_sym8sxasym8s(
+      p_out,
+      p_inp,
+      p_kernel,
+      p_bias,
+      inp_h,
+      inp_w,
+      input_channels,
+      ker_h,
+      ker_w,
+      out_channels,
+      x_str,
+      y_str,
+      x_pad,
+      y_pad,
+      out_h,
+      out_w,
+      input_zero_bias,
+      p_out_multiplier,
+      p_out_shift,
+      out_zero_bias,
+      out_data_format,
+      p_scratch,
+      out_activation_min,
+      out_activation_max,
+      row_start,
+      row_end,
+      out_ch_start,
+      out_ch_end,
+      row_end - row_start,
+      out_ch_end - out_ch_start,
+      p_dma_cfg);
+}
+
+/* Computes conv output rows [row_start, row_end) in NHWC order into p_rows */
+static WORD32 conv2d_std_rows_nhwc_per_chan_sym8sxasym8s(
+    WORD8* __restrict__ p_rows,
+    const WORD8* __restrict__ p_inp,
+    const WORD8* __restrict__ p_kernel,
+    const WORD32* __restrict__ p_bias,
+    WORD32 inp_h,
+    WORD32 inp_w,
+    WORD32 input_channels,
+    WORD32 ker_h,
+    WORD32 ker_w,
+    WORD32 out_channels,
+    WORD32 x_str,
+    WORD32 y_str,
+    WORD32 x_pad,
+    WORD32 y_pad,
+    WORD32 out_w,
+    WORD32 input_zero_bias,
+    WORD32 * p_out_multiplier,
+    WORD32 * p_out_shift,
+    WORD32 out_zero_bias,
+    VOID *p_scratch,
+    WORD32 out_activation_min,
+    WORD32 out_activation_max,
+    WORD32 row_start,
+    WORD32 row_end)
+{
+  WORD32 cur_h = row_end - row_start;
+  WORD32 inp_h_idx, y_padding_cur, inp_height_cur;
+
+  conv2d_std_tile_inp_rows(row_start * y_str - y_pad, cur_h, inp_h, ker_h, y_str, &inp_h_idx, &y_padding_cur, &inp_height_cur);
+
+  if(inp_height_cur <= 0)
+  {
+    conv_y_pad_out(
+        p_rows,
+        cur_h,
+        out_w,
+        out_channels,
+        1,
+        out_channels,
+        out_w * out_channels,
+        p_bias,
+        p_out_multiplier,
+        p_out_shift,
+        out_zero_bias,
+        out_activation_min,
+        out_activation_max,
+        NULL);
+    return 0;
+  }
+
+  return internal_xa_nn_conv2d_std_per_chan_sym8sxasym8s(
+      p_rows,
+      &p_inp[inp_h_idx * inp_w * input_channels],
+      p_kernel,
+      p_bias,
+      inp_height_cur,
+      inp_w,
+      input_channels,
+      ker_h,
+      ker_w,
+      out_channels,
+      x_str,
+      y_str,
+      x_pad,
+      y_padding_cur,
+      cur_h,
+      out_w,
+      input_zero_bias,
+      -input_zero_bias,
+      p_out_multiplier,
+      p_out_shift,
+      out_zero_bias,
+      1,
+      out_w * out_channels,
+      out_channels,
+      p_scratch,
+      out_activation_min,
+      out_activation_max,
+      NULL);
+}
+
+/* p_dst[i] = max(p_dst[i], p_src[i]) for i in [0, n) */
+static void pool_max8_inplace(
+    WORD8 *p_dst,
+    const WORD8 *p_src,
+    WORD32 n)
+{
+  WORD32 i;
+  ae_int8x16 *p_d_rd = (ae_int8x16 *)p_dst;
+  ae_int8x16 *p_d_wr = (ae_int8x16 *)p_dst;
+  ae_int8x16 *p_s = (ae_int8x16 *)p_src;
+  ae_valignx2 align_d = AE_LA128_PP(p_d_rd);
+  ae_valignx2 align_s = AE_LA128_PP(p_s);
+  ae_valignx2 align_out = AE_ZALIGN128();
+  ae_int8x8 d0, d1, s0, s1;
+
+  for(i = 0; i < (n >> 4); i++)
+  {
+    AE_LA8X8X2_IP(d0, d1, align_d, p_d_rd);
+    AE_LA8X8X2_IP(s0, s1, align_s, p_s);
+    AE_SA8X8X2_IP(AE_MAX8(d0, s0), AE_MAX8(d1, s1), align_out, p_d_wr);
+  }
+  WORD32 rem_itr = (n & 15);
+  AE_LAV8X8X2_XP(d0, d1, align_d, p_d_rd, rem_itr);
+  AE_LAV8X8X2_XP(s0, s1, align_s, p_s, rem_itr);
+  AE_SAV8X8X2_XP(AE_MAX8(d0, s0), AE_MAX8(d1, s1), align_out, p_d_wr, rem_itr);
+  AE_SA128POS_FP(align_out, p_d_wr);
+}
+
+/* Pools one output row from conv rows [0, n_rows) of the band */
+static void pool_band_row_nhwc(
+    WORD8 *__restrict__ p_out,
+    const WORD8 *__restrict__ p_band,
+    WORD32 *p_acc,
+    WORD32 n_rows,
+    WORD32 out_w,
+    WORD32 out_channels,
+    WORD32 pool_type,
+    WORD32 pool_width,
+    WORD32 pool_x_stride,
+    WORD32 pool_x_padding,
+    WORD32 pool_out_width)
+{
+  WORD32 itr_pw, itr_r, itr_c, itr_ch;
+  WORD32 row_size = out_w * out_channels;
+
+  for(itr_pw = 0; itr_pw < pool_out_width; itr_pw++)
+  {
+    WORD32 c0 = itr_pw * pool_x_stride - pool_x_padding;
+    WORD32 c1 = XT_MIN(c0 + pool_width, out_w);
+    WORD8 *p_dst = &p_out[itr_pw * out_channels];
+    c0 = XT_MAX(c0, 0);
+
+    if(pool_type == POOL_MAX)
+    {
+      memcpy(p_dst, &p_band[c0 * out_channels], out_channels);
+      for(itr_r = 0; itr_r < n_rows; itr_r++)
+      {
+        for(itr_c = c0; itr_c < c1; itr_c++)
+        {
+          if(itr_r == 0 && itr_c == c0)
+            continue;
+          pool_max8_inplace(p_dst, &p_band[itr_r * row_size + itr_c * out_channels], out_channels);
+        }
+      }
+    }
+    else
+    {
+      /* Count excludes padding, rounded to nearest as in TFLite */
+      WORD32 count = n_rows * (c1 - c0);
+      memset(p_acc, 0, out_channels * sizeof(WORD32));
+      for(itr_r = 0; itr_r < n_rows; itr_r++)
+      {
+        for(itr_c = c0; itr_c < c1; itr_c++)
+        {
+          const WORD8 *p_src = &p_band[itr_r * row_size + itr_c * out_channels];
+          for(itr_ch = 0; itr_ch < out_channels; itr_ch++)
+            p_acc[itr_ch] += p_src[itr_ch];
+        }
+      }
+      for(itr_ch = 0; itr_ch < out_channels; itr_ch++)
+      {
+        WORD32 acc = p_acc[itr_ch];
+        acc = acc > 0 ? (acc + (count >> 1)) / count : (acc - (count >> 1)) / count;
+        p_dst[itr_ch] = (WORD8)acc;
+      }
+    }
+  }
+}
+
+/* Conv (std or pointwise) followed by max or average pooling in NHWC,
+ * without writing the full-resolution conv output. Conv output rows are
+ * produced into a band of up to pool_height rows in scratch; rows shared by
+ * consecutive pooling windows are kept, rows skipped by the pooling stride
+ * are never computed. Pointwise layers run xa_nn_conv2d_pointwise_v2 on the
+ * matching input rows and need no conv scratch. */
+static WORD32 conv2d_v2_pool_nhwc_per_chan_sym8sxasym8s(
+    WORD8* __restrict__ p_out,
+    const WORD8* __restrict__ p_inp,
+    const WORD8* __restrict__ p_kernel,
+    const WORD32* __restrict__ p_bias,
+    WORD32 input_height,
+    WORD32 input_width,
+    WORD32 input_channels,
+    WORD32 kernel_height,
+    WORD32 kernel_width,
+    WORD32 out_channels,
+    WORD32 x_stride,
+    WORD32 y_stride,
+    WORD32 x_padding,
+    WORD32 y_padding,
+    WORD32 out_height,
+    WORD32 out_width,
+    WORD32 input_zero_bias,
+    WORD32 * p_out_multiplier,
+    WORD32 * p_out_shift,
+    WORD32 out_zero_bias,
+    WORD32 out_activation_min,
+    WORD32 out_activation_max,
+    WORD32 pool_type,
+    WORD32 pool_height,
+    WORD32 pool_width,
+    WORD32 pool_x_stride,
+    WORD32 pool_y_stride,
+    WORD32 pool_x_padding,
+    WORD32 pool_y_padding,
+    WORD32 pool_out_height,
+    WORD32 pool_out_width,
+    VOID *p_scratch,
+    WORD32 pointwise)
+{
+  XA_NNLIB_ARG_CHK_COND((pool_type != POOL_MAX && pool_type != POOL_AVG), -1);
+  XA_NNLIB_ARG_CHK_COND((pool_height <= 0 || pool_width <= 0), -1);
+  XA_NNLIB_ARG_CHK_COND((pool_y_stride <= 0 || pool_x_stride <= 0), -1);
+  XA_NNLIB_ARG_CHK_COND((pool_y_padding < 0 || pool_y_padding >= pool_height), -1);
+  XA_NNLIB_ARG_CHK_COND((pool_x_padding < 0 || pool_x_padding >= pool_width), -1);
+  XA_NNLIB_ARG_CHK_COND((pool_out_height <= 0 || pool_out_width <= 0), -1);
+  /* Every pooling window must overlap the conv output */
+  XA_NNLIB_ARG_CHK_COND(((pool_out_height - 1) * pool_y_stride - pool_y_padding >= out_height), -1);
+  XA_NNLIB_ARG_CHK_COND(((pool_out_width - 1) * pool_x_stride - pool_x_padding >= out_width), -1);
+
+  int itr;
+  for(itr=0;itr<out_channels;itr++){
+    XA_NNLIB_ARG_CHK_COND((p_out_shift[itr] < -31 || p_out_shift[itr] > 31), -1);
+  }
+
+  WORD32 ret = 0;
+  WORD32 row_size = out_width * out_channels;
+  WORD32 band_start = 0, band_end = 0;
+  WORD32 itr_ph;
+
+  /* Scratch: band of pool_height conv rows, average accumulators, conv scratch */
+  WORD8 *p_band = (WORD8 *)p_scratch;
+  WORD32 *p_acc = (WORD32 *)((WORD8 *)p_band + ALIGNED_SIZE(pool_height * row_size, ALIGNMENT));
+  VOID *p_conv_scratch = (VOID *)((WORD8 *)p_acc + ALIGNED_SIZE(out_channels * sizeof(WORD32), ALIGNMENT));
+
+  for(itr_ph = 0; itr_ph < pool_out_height; itr_ph++)
+  {
+    WORD32 r0 = itr_ph * pool_y_stride - pool_y_padding;
+    WORD32 r1 = XT_MIN(r0 + pool_height, out_height);
+    r0 = XT_MAX(r0, 0);
+
+    /* Drop band rows above the window, keep the overlap at the top */
+    if(r0 >= band_end)
+    {
+      band_start = band_end = r0;
+    }
+    else if(r0 > band_start)
+    {
+      memmove(p_band, &p_band[(r0 - band_start) * row_size], (band_end - r0) * row_size);
+      band_start = r0;
+    }
+
+    if(r1 > band_end && pointwise)
+    {
+      ret |= xa_nn_conv2d_pointwise_v2_per_chan_sym8sxasym8s(
+          &p_band[(band_end - band_start) * row_size],
+          (WORD8 *)p_kernel,
+          (WORD8 *)&p_inp[band_end * input_width * input_channels],
+          (WORD32 *)p_bias,
+          r1 - band_end,
+          input_width,
+          input_channels,
+          out_channels,
+          input_zero_bias,
+          p_out_multiplier,
+          p_out_shift,
+          out_zero_bias,
+          0,
+          out_activation_min,
+          out_activation_max,
+          NULL);
+      band_end = r1;
+    }
+    else if(r1 > band_end)
+    {
+      ret |= conv2d_std_rows_nhwc_per_chan_sym8sxasym8s(
+          &p_band[(band_end - band_start) * row_size],
+          p_inp,
+          p_kernel,
+          p_bias,
+          input_height,
+          input_width,
+          input_channels,
+          kernel_height,
+          kernel_width,
+          out_channels,
+          x_stride,
+          y_stride,
+          x_padding,
+          y_padding,
+          out_width,
+          input_zero_bias,
+          p_out_multiplier,
+          p_out_shift,
+          out_zero_bias,
+          p_conv_scratch,
+          out_activation_min,
+          out_activation_max,
+          band_end,
+          r1);
+      band_end = r1;
+    }
+
+    pool_band_row_nhwc(
+        &p_out[itr_ph * pool_out_width * out_channels],
+        p_band,
+        p_acc,
+        r1 - r0,
+        out_width,
+        out_channels,
+        pool_type,
+        pool_width,
+        pool_x_stride,
+        pool_x_padding,
+        pool_out_width);
+  }
+
+  return ret;
+}
+
+/* Conv2d std followed by max or average pooling in NHWC, see
+ * conv2d_v2_pool_nhwc_per_chan_sym8sxasym8s */
+WORD32 xa_nn_conv2d_std_v2_pool_per_chan_sym8sxasym8s(
+    WORD8* __restrict__ p_out,
+    const WORD8* __restrict__ p_inp,
+    const WORD8* __restrict__ p_kernel,
+    const WORD32* __restrict__ p_bias,
+    WORD32 input_height,
+    WORD32 input_width,
+    WORD32 input_channels,
+    WORD32 kernel_height,
+    WORD32 kernel_width,
+    WORD32 out_channels,
+    WORD32 x_stride,
+    WORD32 y_stride,
+    WORD32 x_padding,
+    WORD32 y_padding,
+    WORD32 out_height,
+    WORD32 out_width,
+    WORD32 input_zero_bias,
+    WORD32 * p_out_multiplier,
+    WORD32 * p_out_shift,
+    WORD32 out_zero_bias,
+    WORD32 out_activation_min,
+    WORD32 out_activation_max,
+    WORD32 pool_type,
+    WORD32 pool_height,
+    WORD32 pool_width,
+    WORD32 pool_x_stride,
+    WORD32 pool_y_stride,
+    WORD32 pool_x_padding,
+    WORD32 pool_y_padding,
+    WORD32 pool_out_height,
+    WORD32 pool_out_width,
+    VOID *p_scratch)
+{
+   /* NULL pointer checks */
+  XA_NNLIB_ARG_CHK_PTR(p_out, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_kernel, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_inp, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_scratch, -1);
+  /* Pointer alignment checks */
+  XA_NNLIB_ARG_CHK_ALIGN(p_bias, sizeof(WORD32), -1);
+  XA_NNLIB_ARG_CHK_ALIGN(p_scratch, ALIGNMENT, -1);
+  /* Basic Parameter checks */
+  XA_NNLIB_ARG_CHK_COND((input_height <= 0 || input_width <= 0), -1);
+  XA_NNLIB_ARG_CHK_COND((input_channels <= 0), -1);
+  XA_NNLIB_ARG_CHK_COND((kernel_height <= 0 || kernel_width <= 0), -1);
+  XA_NNLIB_ARG_CHK_COND((out_channels <= 0), -1);
+  XA_NNLIB_ARG_CHK_COND((y_stride <= 0 || x_stride <= 0), -1);
+  XA_NNLIB_ARG_CHK_COND((y_padding < 0 || x_padding < 0), -1);
+  XA_NNLIB_ARG_CHK_COND((out_height <= 0 || out_width <= 0), -1);
+  XA_NNLIB_ARG_CHK_COND((input_zero_bias < -127 || input_zero_bias > 128), -1);
+  XA_NNLIB_ARG_CHK_COND((out_zero_bias < -128 || out_zero_bias > 127), -1);
+  XA_NNLIB_ARG_CHK_COND((out_activation_min < -128 || out_activation_min > 127), -1);
+  XA_NNLIB_ARG_CHK_COND((out_activation_max < out_activation_min || out_activation_max > 127), -1);
+
+  return conv2d_v2_pool_nhwc_per_chan_sym8sxasym8s(
+      p_out, p_inp, p_kernel, p_bias,
+      input_height, input_width, input_channels, kernel_height, kernel_width, out_channels,
+      x_stride, y_stride, x_padding, y_padding, out_height, out_width,
+      input_zero_bias, p_out_multiplier, p_out_shift, out_zero_bias,
+      out_activation_min, out_activation_max,
+      pool_type, pool_height, pool_width, pool_x_stride, pool_y_stride,
+      pool_x_padding, pool_y_padding, pool_out_height, pool_out_width,
+      p_scratch, 0);
+}
+
+/* Pointwise conv followed by max or average pooling in NHWC, the conv
+ * output is input_height x input_width */
+WORD32 xa_nn_conv2d_pointwise_v2_pool_per_chan_sym8sxasym8s(
+    WORD8* __restrict__ p_out,
+    WORD8* __restrict__ p_kernel,
+    WORD8* __restrict__ p_inp,
+    WORD32* __restrict__ p_bias,
+    WORD32  input_height,
+    WORD32  input_width,
+    WORD32  input_channels,
+    WORD32  out_channels,
+    WORD32  input_zero_bias,
+    WORD32* __restrict__ p_out_multiplier,
+    WORD32* __restrict__ p_out_shift,
+    WORD32  out_zero_bias,
+    WORD32  out_activation_min,
+    WORD32  out_activation_max,
+    WORD32  pool_type,
+    WORD32  pool_height,
+    WORD32  pool_width,
+    WORD32  pool_x_stride,
+    WORD32  pool_y_stride,
+    WORD32  pool_x_padding,
+    WORD32  pool_y_padding,
+    WORD32  pool_out_height,
+    WORD32  pool_out_width,
+    VOID *p_scratch)
+{
+  /* NULL pointer checks */
+  XA_NNLIB_ARG_CHK_PTR(p_out, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_kernel, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_inp, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_bias, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_scratch, -1);
+  /* Pointer alignment checks */
+  XA_NNLIB_ARG_CHK_ALIGN(p_bias, sizeof(WORD32), -1);
+  XA_NNLIB_ARG_CHK_ALIGN(p_scratch, ALIGNMENT, -1);
+  /* Basic Parameter checks */
+  XA_NNLIB_ARG_CHK_COND((input_height <= 0 || input_width <= 0), -1);
+  XA_NNLIB_ARG_CHK_COND((input_channels <= 0), -1);
+  XA_NNLIB_ARG_CHK_COND((out_channels <= 0), -1);
+  XA_NNLIB_ARG_CHK_COND((input_zero_bias < -127 || input_zero_bias > 128), -1);
+  XA_NNLIB_ARG_CHK_COND((out_zero_bias < -128 || out_zero_bias > 127), -1);
+  XA_NNLIB_ARG_CHK_COND((out_activation_min < -128 || out_activation_min > 127), -1);
+  XA_NNLIB_ARG_CHK_COND((out_activation_max < out_activation_min || out_activation_max > 127), -1);
+
+  return conv2d_v2_pool_nhwc_per_chan_sym8sxasym8s(
+      p_out, p_inp, p_kernel, p_bias,
+      input_height, input_width, input_channels, 1, 1, out_channels,
+      1, 1, 0, 0, input_height, input_width,
+      input_zero_bias, p_out_multiplier, p_out_shift, out_zero_bias,
+      out_activation_min, out_activation_max,
+      pool_type, pool_height, pool_width, pool_x_stride, pool_y_stride,
+      pool_x_padding, pool_y_padding, pool_out_height, pool_out_width,
+      p_scratch, 1);
+}
+
+/* Conv2d std v2 with a residual add: each row tile is computed with the
+ * full int8 range and the residual is added to it while it is still in
+ * cache, before the out_activation_min/max clamp. The tile is saturated to
+ * int8 before the add, see xa_nn_residual_cfg_t. */
+WORD32 xa_nn_conv2d_std_v2_residual_per_chan_sym8sxasym8s(
+    WORD8* __restrict__ p_out,
+    const WORD8* __restrict__ p_inp,
+    const WORD8* __restrict__ p_kernel,
+    const WORD32* __restrict__ p_bias,
+    WORD32 input_height,
+    WORD32 input_width,
+    WORD32 input_channels,
+    WORD32 kernel_height,
+    WORD32 kernel_width,
+    WORD32 out_channels,
+    WORD32 x_stride,
+    WORD32 y_stride,
+    WORD32 x_padding,
+    WORD32 y_padding,
+    WORD32 out_height,
+    WORD32 out_width,
+    WORD32 input_zero_bias,
+    WORD32 * p_out_multiplier,
+    WORD32 * p_out_shift,
+    WORD32 out_zero_bias,
+    WORD32 out_data_format,
+    VOID *p_scratch,
+    WORD32 out_activation_min,
+    WORD32 out_activation_max,
+    const xa_nn_residual_cfg_t *p_res_cfg,
+    xa_dma_cfg_t *p_dma_cfg)
+{
+  if(p_res_cfg == NULL)
+  {
+    return xa_nn_conv2d_std_v2_per_chan_sym8sxasym8s(p_out, p_inp, p_kernel, p_bias,
+              input_height, input_width, input_channels, kernel_height, kernel_width, out_channels,
+              x_stride, y_stride, x_padding, y_padding, out_height, out_width,
+              input_zero_bias, p_out_multiplier, p_out_shift, out_zero_bias, out_data_format, p_scratch,
+              out_activation_min, out_activation_max, p_dma_cfg);
+  }
+
+  XA_NNLIB_ARG_CHK_PTR(p_res_cfg->p_res, -1);
+  XA_NNLIB_ARG_CHK_COND((out_height <= 0 || out_width <= 0 || out_channels <= 0), -1);
+  XA_NNLIB_ARG_CHK_COND((p_res_cfg->res_zero_bias < -127 || p_res_cfg->res_zero_bias > 128), -1);
+  XA_NNLIB_ARG_CHK_COND((p_res_cfg->res_shift < -31 || p_res_cfg->res_shift > 31), -1);
+  XA_NNLIB_ARG_CHK_COND((out_activation_min < -128 || out_activation_min > 127), -1);
+  XA_NNLIB_ARG_CHK_COND((out_activation_max < out_activation_min || out_activation_max > 127), -1);
+
+  /* Row tiles whose output and residual fit in half of the data cache */
+  WORD32 row_bytes = out_width * out_channels;
+  WORD32 tile_height = (XCHAL_DCACHE_SIZE >> 2) / row_bytes;
+  tile_height = tile_height < 4 ? 4 : tile_height;
+  tile_height = tile_height > out_height ? out_height : tile_height;
+
+  WORD32 plane_size = out_height * out_width;
+  WORD32 itr_oh, itr_oc, ret;
+  for(itr_oh = 0; itr_oh < out_height; itr_oh += tile_height)
+  {
+    WORD32 cur_h = XT_MIN(tile_height, out_height - itr_oh);
+
+    /* Slice API checks the remaining arguments */
+    ret = xa_nn_conv2d_std_v2_slice_per_chan_sym8sxasym8s(p_out, p_inp, p_kernel, p_bias,
+              input_height, input_width, input_channels, kernel_height, kernel_width, out_channels,
+              x_stride, y_stride, x_padding, y_padding, out_height, out_width,
+              input_zero_bias, p_out_multiplier, p_out_shift, out_zero_bias, out_data_format, p_scratch,
+              -128, 127, itr_oh, itr_oh + cur_h, 0, out_channels, p_dma_cfg);
+    if(ret < 0)
+      return ret;
+
+    if(out_data_format == 0)
+    {
+      xa_nn_residual_add_asym8s(&p_out[itr_oh * row_bytes],
+          &p_res_cfg->p_res[itr_oh * row_bytes],
+          cur_h * row_bytes,
+          p_res_cfg->res_zero_bias,
+          p_res_cfg->res_multiplier,
+          p_res_cfg->res_shift,
+          out_activation_min,
+          out_activation_max);
+    }
+    else
+    {
+      for(itr_oc = 0; itr_oc < out_channels; itr_oc++)
+      {
+        xa_nn_residual_add_asym8s(&p_out[itr_oc * plane_size + itr_oh * out_width],
+            &p_res_cfg->p_res[itr_oc * plane_size + itr_oh * out_width],
+            cur_h * out_width,
+            p_res_cfg->res_zero_bias,
+            p_res_cfg->res_multiplier,
+            p_res_cfg->res_shift,
+            out_activation_min,
+            out_activation_max);
+      }
+    }
+  }
+
+  return 0;
+}
+
+/* Conv2d std v2 followed by the activation in p_act_cfg, applied to each
+ * row tile right after it is computed. */
+WORD32 xa_nn_conv2d_std_v2_act_per_chan_sym8sxasym8s(
+    WORD8* __restrict__ p_out,
+    const WORD8* __restrict__ p_inp,
+    const WORD8* __restrict__ p_kernel,
+    const WORD32* __restrict__ p_bias,
+    WORD32 input_height,
+    WORD32 input_width,
+    WORD32 input_channels,
+    WORD32 kernel_height,
+    WORD32 kernel_width,
+    WORD32 out_channels,
+    WORD32 x_stride,
+    WORD32 y_stride,
+    WORD32 x_padding,
+    WORD32 y_padding,
+    WORD32 out_height,
+    WORD32 out_width,
+    WORD32 input_zero_bias,
+    WORD32 * p_out_multiplier,
+    WORD32 * p_out_shift,
+    WORD32 out_zero_bias,
+    WORD32 out_data_format,
+    VOID *p_scratch,
+    WORD32 out_activation_min,
+    WORD32 out_activation_max,
+    const xa_nn_act_cfg_t *p_act_cfg,
+    xa_dma_cfg_t *p_dma_cfg)
+{
+  if(p_act_cfg == NULL)
+  {
+    return xa_nn_conv2d_std_v2_per_chan_sym8sxasym8s(p_out, p_inp, p_kernel, p_bias,
+              input_height, input_width, input_channels, kernel_height, kernel_width, out_channels,
+              x_stride, y_stride, x_padding, y_padding, out_height, out_width,
+              input_zero_bias, p_out_multiplier, p_out_shift, out_zero_bias, out_data_format, p_scratch,
+              out_activation_min, out_activation_max, p_dma_cfg);
+  }
+
+  XA_NNLIB_ARG_CHK_PTR(p_act_cfg->p_lut, -1);
+  XA_NNLIB_ARG_CHK_COND((out_height <= 0 || out_width <= 0 || out_channels <= 0), -1);
+  XA_NNLIB_ARG_CHK_COND((p_act_cfg->lut_channels != 1 && p_act_cfg->lut_channels != out_channels), -1);
+
+  /* Row tiles whose output fits in a quarter of the data cache */
+  WORD32 row_bytes = out_width * out_channels;
+  WORD32 tile_height = (XCHAL_DCACHE_SIZE >> 2) / row_bytes;
+  tile_height = tile_height < 4 ? 4 : tile_height;
+  tile_height = tile_height > out_height ? out_height : tile_height;
+
+  WORD32 itr_oh, ret;
+  for(itr_oh = 0; itr_oh < out_height; itr_oh += tile_height)
+  {
+    WORD32 cur_h = XT_MIN(tile_height, out_height - itr_oh);
+
+    /* Slice API checks the remaining arguments */
+    ret = xa_nn_conv2d_std_v2_slice_per_chan_sym8sxasym8s(p_out, p_inp, p_kernel, p_bias,
+              input_height, input_width, input_channels, kernel_height, kernel_width, out_channels,
+              x_stride, y_stride, x_padding, y_padding, out_height, out_width,
+              input_zero_bias, p_out_multiplier, p_out_shift, out_zero_bias, out_data_format, p_scratch,
+              out_activation_min, out_activation_max, itr_oh, itr_oh + cur_h, 0, out_channels, p_dma_cfg);
+    if(ret < 0)
+      return ret;
+
+    xa_nn_act_lut_rows_asym8s(p_out, p_act_cfg, itr_oh, cur_h, out_height, out_width, out_channels, out_data_format);
+  }
+
+  return 0;
+}
+
+/* Conv2d std v2 with explicit right/bottom padding and a pad value from
+ * p_pad_cfg, read straight into the circular buffer. */
+WORD32 xa_nn_conv2d_std_v2_pad_per_chan_sym8sxasym8s(
+    WORD8* __restrict__ p_out,
+    const WORD8* __restrict__ p_inp,
+    const WORD8* __restrict__ p_kernel,
+    const WORD32* __restrict__ p_bias,
+    WORD32 input_height,
+    WORD32 input_width,
+    WORD32 input_channels,
+    WORD32 kernel_height,
+    WORD32 kernel_width,
+    WORD32 out_channels,
+    WORD32 x_stride,
+    WORD32 y_stride,
+    WORD32 x_padding,
+    WORD32 y_padding,
+    WORD32 out_height,
+    WORD32 out_width,
+    WORD32 input_zero_bias,
+    WORD32 * p_out_multiplier,
+    WORD32 * p_out_shift,
+    WORD32 out_zero_bias,
+    WORD32 out_data_format,
+    VOID *p_scratch,
+    WORD32 out_activation_min,
+    WORD32 out_activation_max,
+    const xa_nn_pad_cfg_t *p_pad_cfg,
+    xa_dma_cfg_t *p_dma_cfg)
+{
+  if(p_pad_cfg == NULL)
+  {
+    return xa_nn_conv2d_std_v2_per_chan_sym8sxasym8s(p_out, p_inp, p_kernel, p_bias,
+              input_height, input_width, input_channels, kernel_height, kernel_width, out_channels,
+              x_stride, y_stride, x_padding, y_padding, out_height, out_width,
+              input_zero_bias, p_out_multiplier, p_out_shift, out_zero_bias, out_data_format, p_scratch,
+              out_activation_min, out_activation_max, p_dma_cfg);
+  }
+
+  XA_NNLIB_ARG_CHK_COND((y_stride <= 0 || x_stride <= 0), -1);
+  XA_NNLIB_ARG_CHK_COND((p_pad_cfg->y_b_padding < 0 || p_pad_cfg->x_r_padding < 0), -1);
+  XA_NNLIB_ARG_CHK_COND((p_pad_cfg->pad_val < -128 || p_pad_cfg->pad_val > 127), -1);
+  /* Output size has to follow from the four pad amounts */
+  XA_NNLIB_ARG_CHK_COND((out_height != (y_padding + input_height + p_pad_cfg->y_b_padding - kernel_height) / y_stride + 1), -1);
+  XA_NNLIB_ARG_CHK_COND((out_width != (x_padding + input_width + p_pad_cfg->x_r_padding - kernel_width) / x_stride + 1), -1);
+
+  if(p_pad_cfg->pad_val == -input_zero_bias)
+  {
+    return xa_nn_conv2d_std_v2_per_chan_sym8sxasym8s(p_out, p_inp, p_kernel, p_bias,
+              input_height, input_width, input_channels, kernel_height, kernel_width, out_channels,
+              x_stride, y_stride, x_padding, y_padding, out_height, out_width,
+              input_zero_bias, p_out_multiplier, p_out_shift, out_zero_bias, out_data_format, p_scratch,
+              out_activation_min, out_activation_max, p_dma_cfg);
+  }
+
+  /* NULL pointer checks */
+  XA_NNLIB_ARG_CHK_PTR(p_out, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_kernel, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_inp, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_scratch, -1);
+  /* Pointer alignment checks */
+  XA_NNLIB_ARG_CHK_ALIGN(p_bias, sizeof(WORD32), -1);
+  XA_NNLIB_ARG_CHK_ALIGN(p_scratch, ALIGNMENT, -1);
+  /* Basic Parameter checks */
+  XA_NNLIB_ARG_CHK_COND((input_height <= 0 || input_width <= 0), -1);
+  XA_NNLIB_ARG_CHK_COND((input_channels <= 0), -1);
+  XA_NNLIB_ARG_CHK_COND((kernel_height <= 0 || kernel_width <= 0), -1);
+  XA_NNLIB_ARG_CHK_COND((out_channels <= 0), -1);
+  XA_NNLIB_ARG_CHK_COND((y_padding < 0 || x_padding < 0), -1);
+  XA_NNLIB_ARG_CHK_COND((out_height <= 0 || out_width <= 0), -1);
+  XA_NNLIB_ARG_CHK_COND((input_zero_bias < -127 || input_zero_bias > 128), -1);
+  XA_NNLIB_ARG_CHK_COND((out_zero_bias < -128 || out_zero_bias > 127), -1);
+  XA_NNLIB_ARG_CHK_COND((out_data_format != 0 && out_data_format != 1), -1);
+  XA_NNLIB_ARG_CHK_COND((out_activation_min < -128 || out_activation_min > 127), -1);
+  XA_NNLIB_ARG_CHK_COND((out_activation_max < out_activation_min || out_activation_max > 127), -1);
+
+  int itr;
+  for(itr=0;itr<out_channels;itr++){
+    XA_NNLIB_ARG_CHK_COND((p_out_shift[itr] < -31 || p_out_shift[itr] > 31), -1);
+  }
+
+  /* Whole plane in one pass: the pad-only output shortcuts of the tiled
+   * path assume padding with the zero point */
+  WORD32 out_channels_offset = out_data_format ? out_height * out_width : 1;
+  WORD32 out_height_offset = out_data_format ? out_width : out_width * out_channels;
+  WORD32 out_width_offset = out_data_format ? 1 : out_channels;
+
+  return internal_xa_nn_conv2d_std_per_chan_sym8sxasym8s(
+      p_out,
+      p_inp,
+      p_kernel,
+      p_bias,
+      input_height,
+      input_width,
+      input_channels,
+      kernel_height,
+      kernel_width,
+      out_channels,
+      x_stride,
+      y_stride,
+      x_padding,
+      y_padding,
+      out_height,
+      out_width,
+      input_zero_bias,
+      p_pad_cfg->pad_val,
+      p_out_multiplier,
+      p_out_shift,
+      out_zero_bias,
+      out_channels_offset,
+      out_height_offset,
+      out_width_offset,
+      p_scratch,
+      out_activation_min,
+      out_activation_max,
+      p_dma_cfg);
+}
+
+/* Conv2d std v2 with f32 input, quantized band by band into scratch right
+ * before use, and optionally f32 output dequantized from the band. NHWC only,
+ * p_scratch is sized by xa_nn_conv2d_std_v2_f32io_getsize. */
+#if !HAVE_VFPU
+DISCARD_FUN_FOR_NONVOID_RETURN(WORD32, xa_nn_conv2d_std_v2_f32io_per_chan_sym8sxasym8s,
+    (pVOID __restrict__ p_out,
+    const FLOAT32* __restrict__ p_inp,
+    const WORD8* __restrict__ p_kernel,
+    const WORD32* __restrict__ p_bias,
+    WORD32 input_height,
+    WORD32 input_width,
+    WORD32 input_channels,
+    WORD32 kernel_height,
+    WORD32 kernel_width,
+    WORD32 out_channels,
+    WORD32 x_stride,
+    WORD32 y_stride,
+    WORD32 x_padding,
+    WORD32 y_padding,
+    WORD32 out_height,
+    WORD32 out_width,
+    WORD32 input_zero_bias,
+    WORD32 * p_out_multiplier,
+    WORD32 * p_out_shift,
+    WORD32 out_zero_bias,
+    VOID *p_scratch,
+    WORD32 out_activation_min,
+    WORD32 out_activation_max,
+    const xa_nn_f32io_cfg_t *p_io_cfg))
+#else /* #if !HAVE_VFPU */
+WORD32 xa_nn_conv2d_std_v2_f32io_per_chan_sym8sxasym8s(
+    pVOID __restrict__ p_out,
+    const FLOAT32* __restrict__ p_inp,
+    const WORD8* __restrict__ p_kernel,
+    const WORD32* __restrict__ p_bias,
+    WORD32 input_height,
+    WORD32 input_width,
+    WORD32 input_channels,
+    WORD32 kernel_height,
+    WORD32 kernel_width,
+    WORD32 out_channels,
+    WORD32 x_stride,
+    WORD32 y_stride,
+    WORD32 x_padding,
+    WORD32 y_padding,
+    WORD32 out_height,
+    WORD32 out_width,
+    WORD32 input_zero_bias,
+    WORD32 * p_out_multiplier,
+    WORD32 * p_out_shift,
+    WORD32 out_zero_bias,
+    VOID *p_scratch,
+    WORD32 out_activation_min,
+    WORD32 out_activation_max,
+    const xa_nn_f32io_cfg_t *p_io_cfg)
+{
+  /* NULL pointer checks */
+  XA_NNLIB_ARG_CHK_PTR(p_out, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_kernel, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_inp, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_scratch, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_io_cfg, -1);
+  /* Pointer alignment checks */
+  XA_NNLIB_ARG_CHK_ALIGN(p_out, p_io_cfg->out_f32 ? sizeof(FLOAT32) : sizeof(WORD8), -1);
+  XA_NNLIB_ARG_CHK_ALIGN(p_inp, sizeof(FLOAT32), -1);
+  XA_NNLIB_ARG_CHK_ALIGN(p_bias, sizeof(WORD32), -1);
+  XA_NNLIB_ARG_CHK_ALIGN(p_scratch, ALIGNMENT, -1);
+  /* Basic Parameter checks */
+  XA_NNLIB_ARG_CHK_COND((input_height <= 0 || input_width <= 0), -1);
+  XA_NNLIB_ARG_CHK_COND((input_channels <= 0), -1);
+  XA_NNLIB_ARG_CHK_COND((kernel_height <= 0 || kernel_width <= 0), -1);
+  XA_NNLIB_ARG_CHK_COND((out_channels <= 0), -1);
+  XA_NNLIB_ARG_CHK_COND((y_stride <= 0 || x_stride <= 0), -1);
+  XA_NNLIB_ARG_CHK_COND((y_padding < 0 || x_padding < 0), -1);
+  XA_NNLIB_ARG_CHK_COND((out_height <= 0 || out_width <= 0), -1);
+  XA_NNLIB_ARG_CHK_COND((input_zero_bias < -127 || input_zero_bias > 128), -1);
+  XA_NNLIB_ARG_CHK_COND((out_zero_bias < -128 || out_zero_bias > 127), -1);
+  XA_NNLIB_ARG_CHK_COND((out_activation_min < -128 || out_activation_min > 127), -1);
+  XA_NNLIB_ARG_CHK_COND((out_activation_max < out_activation_min || out_activation_max > 127), -1);
+  XA_NNLIB_ARG_CHK_COND((p_io_cfg->band_rows <= 0), -1);
+  XA_NNLIB_ARG_CHK_COND((p_io_cfg->inp_scale == 0.0f || !isfinite(p_io_cfg->inp_scale)), -1);
+  XA_NNLIB_ARG_CHK_COND((p_io_cfg->out_f32 && (p_io_cfg->out_scale == 0.0f || !isfinite(p_io_cfg->out_scale))), -1);
+
+  int itr;
+  for(itr=0;itr<out_channels;itr++){
+    XA_NNLIB_ARG_CHK_COND((p_out_shift[itr] < -31 || p_out_shift[itr] > 31), -1);
+  }
+
+  WORD32 ret = 0;
+  WORD32 band_rows = p_io_cfg->band_rows;
+  WORD32 inp_row_size = input_width * input_channels;
+  WORD32 out_row_size = out_width * out_channels;
+  WORD32 band_inp_rows = (band_rows - 1) * y_stride + kernel_height;
+  WORD32 itr_oh;
+
+  /* Scratch: quantized input band, int8 output band, conv scratch */
+  WORD8 *p_band_inp = (WORD8 *)p_scratch;
+  WORD8 *p_band_out = p_band_inp + ALIGNED_SIZE(band_inp_rows * inp_row_size, ALIGNMENT);
+  VOID *p_conv_scratch = (VOID *)(p_band_out + ALIGNED_SIZE(band_rows * out_row_size, ALIGNMENT));
+
+  for(itr_oh = 0; itr_oh < out_height; itr_oh += band_rows)
+  {
+    WORD32 cur_h = XT_MIN(band_rows, out_height - itr_oh);
+    WORD32 inp_h_idx, y_padding_cur, inp_height_cur;
+    WORD8 *p_dst = p_io_cfg->out_f32 ? p_band_out : &((WORD8 *)p_out)[itr_oh * out_row_size];
+
+    conv2d_std_tile_inp_rows(itr_oh * y_stride - y_padding, cur_h, input_height, kernel_height, y_stride, &inp_h_idx, &y_padding_cur, &inp_height_cur);
+
+    if(inp_height_cur <= 0)
+    {
+      conv_y_pad_out(
+          p_dst,
+          cur_h,
+          out_width,
+          out_channels,
+          1,
+          out_channels,
+          out_row_size,
+          p_bias,
+          p_out_multiplier,
+          p_out_shift,
+          out_zero_bias,
+          out_activation_min,
+          out_activation_max,
+          NULL);
+    }
+    else
+    {
+      /* Rows shared with the previous band are quantized again, they are
+       * still in cache */
+      ret = xa_nn_elm_quantize_f32_asym8s(p_band_inp, &p_inp[inp_h_idx * inp_row_size],
+                p_io_cfg->inp_scale, -input_zero_bias, inp_height_cur * inp_row_size);
+      if(ret < 0)
+        return ret;
+
+      ret = internal_xa_nn_conv2d_std_per_chan_sym8sxasym8s(
+          p_dst,
+          p_band_inp,
+          p_kernel,
+          p_bias,
+          inp_height_cur,
+          input_width,
+          input_channels,
+          kernel_height,
+          kernel_width,
+          out_channels,
+          x_stride,
+          y_stride,
+          x_padding,
+          y_padding_cur,
+          cur_h,
+          out_width,
+          input_zero_bias,
+          -input_zero_bias,
+          p_out_multiplier,
+          p_out_shift,
+          out_zero_bias,
+          1,
+          out_row_size,
+          out_channels,
+          p_conv_scratch,
+          out_activation_min,
+          out_activation_max,
+          NULL);
+      if(ret < 0)
+        return ret;
+    }
+
+    if(p_io_cfg->out_f32)
+    {
+      ret = xa_nn_elm_dequantize_asym8s_f32(&((FLOAT32 *)p_out)[itr_oh * out_row_size], p_band_out,
+                out_zero_bias, p_io_cfg->out_scale, cur_h * out_row_size);
+      if(ret < 0)
+        return ret;
+    }
+  }
+
+  return 0;
+}
+#endif /* #if !HAVE_VFPU */
+
 WORD32 xa_nn_conv2d_std_per_chan_sym8sxasym8s(
     WORD8* __restrict__ p_out,
     const WORD8* __restrict__ p_inp,
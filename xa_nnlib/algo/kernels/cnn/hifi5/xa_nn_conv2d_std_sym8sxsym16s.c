@@ -20,6 +20,7 @@
 
 ******************************************************************************/
 // #include <stdio.h>
+#include <string.h>
 #include "xa_nnlib_common.h"
 #include "xa_nnlib_common_macros_hifi5.h"
 #include "xa_nn_conv2d_std_state.h"
@@ -847,7 +848,7 @@ WORD32 xa_nn_dilated_conv2d_std_per_chan_sym8sxsym16s(
               NULL);
 }
 
-WORD32 xa_nn_conv2d_std_v2_per_chan_sym8sxsym16s(
+static WORD32 conv2d_std_v2_per_chan_sym8sxsym16s(
     WORD16 *__restrict__ p_out,
     const WORD16 *__restrict__ p_inp,
     const WORD8 *__restrict__ p_kernel,
@@ -872,7 +873,8 @@ WORD32 xa_nn_conv2d_std_v2_per_chan_sym8sxsym16s(
     VOID *p_scratch,
     WORD32 out_activation_min,
     WORD32 out_activation_max,
-    xa_dma_cfg_t *p_dma_cfg)
+    xa_dma_cfg_t *p_dma_cfg,
+    WORD32 kernel_prepacked)
 {
   /* NULL pointer checks */
   XA_NNLIB_ARG_CHK_PTR(p_out, -1);
@@ -934,7 +936,8 @@ WORD32 xa_nn_conv2d_std_v2_per_chan_sym8sxsym16s(
   if (!(x_padding) && !(input_channels & 0x1) && !(out_channels & 0x3) && !(out_width & 0x1) && (out_data_format == 0) && ((out_width - 1) * x_stride <= (input_width - kernel_width)) && p_bias)
   {
     int ret_val = 0;
-    VOID *p_kernel_padded = align_weightbuffer_rows(p_scratch /*dest*/, p_kernel /*src*/, out_channels, kernel_height, kernel_width, input_channels);
+    VOID *p_kernel_padded = kernel_prepacked ? (VOID *)p_kernel :
+      align_weightbuffer_rows(p_scratch /*dest*/, p_kernel /*src*/, out_channels, kernel_height, kernel_width, input_channels);
     ret_val = xa_nn_conv2d_std_per_chan_sym8sxsym16s_no_circ_buf_vec_unaligned(p_out,
                                                                                p_inp,
                                                                                p_kernel_padded,
@@ -962,6 +965,13 @@ WORD32 xa_nn_conv2d_std_v2_per_chan_sym8sxsym16s(
     return ret_val;
   }
 
+  /* Remaining paths read the kernel unpadded, a prepacked kernel with padded
+   * rows carries an unpadded copy after the padded one */
+  if (kernel_prepacked && (PADDED_SIZE(kernel_width * input_channels, 8) != (size_t)(kernel_width * input_channels)))
+  {
+    p_kernel += ALIGNED_SIZE(out_channels * kernel_height * PADDED_SIZE(kernel_width * input_channels, 8), ALIGNMENT);
+  }
+
   /* Interchange height and width dimensions when i_h = k_h = o_h = 1 for better throughput */
   WORD32 inp_h, inp_w, ker_h, ker_w, x_str, y_str, x_pad, y_pad, out_h, out_w;
   if (input_height == 1 && kernel_height == 1 && out_height == 1)
@@ -1071,6 +1081,120 @@ WORD32 xa_nn_conv2d_std_v2_per_chan_sym8sxsym16s(
   return 0;
 }
 
+WORD32 xa_nn_conv2d_std_v2_per_chan_sym8sxsym16s(
+    WORD16 *__restrict__ p_out,
+    const WORD16 *__restrict__ p_inp,
+    const WORD8 *__restrict__ p_kernel,
+    const WORD64 *__restrict__ p_bias,
+    WORD32 input_height,
+    WORD32 input_width,
+    WORD32 input_channels,
+    WORD32 kernel_height,
+    WORD32 kernel_width,
+    WORD32 out_channels,
+    WORD32 x_stride,
+    WORD32 y_stride,
+    WORD32 x_padding,
+    WORD32 y_padding,
+    WORD32 out_height,
+    WORD32 out_width,
+    WORD32 input_zero_bias,
+    WORD32 *p_out_multiplier,
+    WORD32 *p_out_shift,
+    WORD32 out_zero_bias,
+    WORD32 out_data_format,
+    VOID *p_scratch,
+    WORD32 out_activation_min,
+    WORD32 out_activation_max,
+    xa_dma_cfg_t *p_dma_cfg)
+{
+  return conv2d_std_v2_per_chan_sym8sxsym16s(
+              p_out, p_inp, p_kernel, p_bias,
+              input_height, input_width, input_channels, kernel_height,
+              kernel_width, out_channels, x_stride, y_stride,
+              x_padding, y_padding, out_height, out_width,
+              input_zero_bias, p_out_multiplier, p_out_shift,
+              out_zero_bias, out_data_format, p_scratch,
+              out_activation_min, out_activation_max, p_dma_cfg, 0);
+}
+
+WORD32 xa_nn_conv2d_std_prepack_sym8sxsym16s(
+    WORD8 *__restrict__ p_kernel_packed,
+    const WORD8 *__restrict__ p_kernel,
+    WORD32 input_channels,
+    WORD32 kernel_height,
+    WORD32 kernel_width,
+    WORD32 out_channels)
+{
+  /* NULL pointer checks */
+  XA_NNLIB_ARG_CHK_PTR(p_kernel_packed, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_kernel, -1);
+  /* Pointer alignment checks */
+  XA_NNLIB_ARG_CHK_ALIGN(p_kernel_packed, ALIGNMENT, -1);
+  /* Basic Parameter checks */
+  XA_NNLIB_ARG_CHK_COND((input_channels <= 0), -1);
+  XA_NNLIB_ARG_CHK_COND((kernel_height <= 0 || kernel_width <= 0), -1);
+  XA_NNLIB_ARG_CHK_COND((out_channels <= 0), -1);
+
+  int row_length = kernel_width * input_channels;
+  int row_length_pad = PADDED_SIZE(row_length, 8);
+  int itr;
+
+  for (itr = 0; itr < out_channels * kernel_height; itr++)
+  {
+    memcpy(&p_kernel_packed[itr * row_length_pad], &p_kernel[itr * row_length], row_length);
+    memset(&p_kernel_packed[itr * row_length_pad + row_length], 0, row_length_pad - row_length);
+  }
+
+  /* Circular buffer path reads the kernel unpadded, keep a copy after the padded rows */
+  if (row_length_pad != row_length)
+  {
+    memcpy(&p_kernel_packed[ALIGNED_SIZE(out_channels * kernel_height * row_length_pad, ALIGNMENT)], p_kernel, out_channels * kernel_height * row_length);
+  }
+
+  return 0;
+}
+
+WORD32 xa_nn_conv2d_std_v2_prepacked_per_chan_sym8sxsym16s(
+    WORD16 *__restrict__ p_out,
+    const WORD16 *__restrict__ p_inp,
+    const WORD8 *__restrict__ p_kernel,
+    const WORD64 *__restrict__ p_bias,
+    WORD32 input_height,
+    WORD32 input_width,
+    WORD32 input_channels,
+    WORD32 kernel_height,
+    WORD32 kernel_width,
+    WORD32 out_channels,
+    WORD32 x_stride,
+    WORD32 y_stride,
+    WORD32 x_padding,
+    WORD32 y_padding,
+    WORD32 out_height,
+    WORD32 out_width,
+    WORD32 input_zero_bias,
+    WORD32 *p_out_multiplier,
+    WORD32 *p_out_shift,
+    WORD32 out_zero_bias,
+    WORD32 out_data_format,
+    VOID *p_scratch,
+    WORD32 out_activation_min,
+    WORD32 out_activation_max,
+    xa_dma_cfg_t *p_dma_cfg)
+{
+  /* Pointer alignment checks */
+  XA_NNLIB_ARG_CHK_ALIGN(p_kernel, ALIGNMENT, -1);
+
+  return conv2d_std_v2_per_chan_sym8sxsym16s(
+              p_out, p_inp, p_kernel, p_bias,
+              input_height, input_width, input_channels, kernel_height,
+              kernel_width, out_channels, x_stride, y_stride,
+              x_padding, y_padding, out_height, out_width,
+              input_zero_bias, p_out_multiplier, p_out_shift,
+              out_zero_bias, out_data_format, p_scratch,
+              out_activation_min, out_activation_max, p_dma_cfg, 1);
+}
+
 WORD32 xa_nn_conv2d_std_per_chan_sym8sxsym16s(
     WORD16 *__restrict__ p_out,
     const WORD16 *__restrict__ p_inp,
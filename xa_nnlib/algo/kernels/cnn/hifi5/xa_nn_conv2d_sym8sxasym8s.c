@@ -22,6 +22,7 @@
 #include "xa_nnlib_common.h"
 #include "xa_nn_conv2d_std_state.h"
 #include "xa_nnlib_common_macros_hifi5.h"
+#include "xa_nnlib_common_dma.h"
 
 static WORD32 conv_x_left_pad(
     WORD32 x_padding,
@@ -587,6 +588,7 @@ static WORD32 internal_xa_nn_conv2d_v2_per_chan_sym8sxasym8s(
     WORD32 out_height,
     WORD32 out_width,
     WORD32 input_zero_bias,
+    WORD32 pad_val,
     WORD32 * p_out_multiplier,
     WORD32 * p_out_shift,
     WORD32 out_zero_bias,
@@ -612,9 +614,12 @@ static WORD32 internal_xa_nn_conv2d_v2_per_chan_sym8sxasym8s(
   WORD32 groups = input_channels/kernel_channels;
   WORD32 kernels_per_group = out_channels/groups;
 
+  /* Outputs over the pad region only are bias-only when padding with the zero point */
+  WORD32 pad_is_zero_point = (pad_val == -input_zero_bias);
+
   /* When kernel convolves over x-left pad region only */
   WORD32 out_width_over_x_pad = 0;
-  if(x_padding_var >= kernel_width)
+  if(x_padding_var >= kernel_width && pad_is_zero_point)
   {
     out_width_over_x_pad = conv_x_left_pad(x_padding, kernel_width, x_stride, out_width, out_height, out_channels, out_channels_offset, out_width_offset, out_height_offset, p_bias, p_out, p_out_multiplier, p_out_shift, out_zero_bias, out_activation_min, out_activation_max);
     x_padding_var -= out_width_over_x_pad * x_stride;
@@ -625,7 +630,7 @@ static WORD32 internal_xa_nn_conv2d_v2_per_chan_sym8sxasym8s(
   // Determine x-right padding
   WORD32 x_r_pad = kernel_width + (out_width - 1) * x_stride - (x_padding + input_width);
   x_r_pad = x_r_pad < 0 ? 0 : x_r_pad;
-  if(x_r_pad >= kernel_width)
+  if(x_r_pad >= kernel_width && pad_is_zero_point)
   {
     out_width_over_x_r_pad = conv_x_right_pad(x_padding, input_width, x_stride, out_width, out_height, out_channels, out_channels_offset, out_width_offset, out_height_offset, p_bias, p_out, p_out_multiplier, p_out_shift, out_zero_bias, out_activation_min, out_activation_max);
   }
@@ -642,7 +647,7 @@ static WORD32 internal_xa_nn_conv2d_v2_per_chan_sym8sxasym8s(
   tmp_out=p_out+grp_i*kernels_per_group*out_channels_offset;
   xa_nn_conv2d_std_init_state((void*)p_state,(void*)p_kernel,input_height,kernel_channels,kernel_height,kernel_width,x_stride,y_stride,y_padding,out_height,-4);  
   pp_inp = (VOID *)(p_inp+grp_i*kernel_channels);
-  conv2d_group_init_cir_buf(input_channels, input_channels_pad,kernel_channels,input_bytewidth, input_width, input_height, y_padding, y_b_pad, x_padding_var, kernel_width, x_stride, (VOID**)&pp_inp, p_state, -input_zero_bias);
+  conv2d_group_init_cir_buf(input_channels, input_channels_pad,kernel_channels,input_bytewidth, input_width, input_height, y_padding, y_b_pad, x_padding_var, kernel_width, x_stride, (VOID**)&pp_inp, p_state, pad_val);
 
   // Index to padded input width
   WORD32 idx_beg_inp_width_pad = kernel_width - x_stride;
@@ -653,7 +658,7 @@ static WORD32 internal_xa_nn_conv2d_v2_per_chan_sym8sxasym8s(
   for(j=0;j<out_width-out_width_over_x_pad-out_width_over_x_r_pad;j++)
   {
     // Add x_stride x (input_height x input_channels) new planes to circular buffer
-    conv2d_group_update_cir_buf(input_channels, input_channels_pad,kernel_channels,input_bytewidth, input_width, input_height, y_padding, y_b_pad, x_padding_var, kernel_width, x_stride, (VOID**)&pp_inp, idx_beg_inp_width_pad, p_state, -input_zero_bias);
+    conv2d_group_update_cir_buf(input_channels, input_channels_pad,kernel_channels,input_bytewidth, input_width, input_height, y_padding, y_b_pad, x_padding_var, kernel_width, x_stride, (VOID**)&pp_inp, idx_beg_inp_width_pad, p_state, pad_val);
 
     // Update index to input width padded
     idx_beg_inp_width_pad += x_stride;
@@ -691,6 +696,123 @@ static WORD32 internal_xa_nn_conv2d_v2_per_chan_sym8sxasym8s(
   return 0;
 }
 
+/* Row-tiled NHWC convolution with input rows of the next tile fetched
+ * through DMA while the current tile is being computed */
+static WORD32 conv2d_v2_dma_per_chan_sym8sxasym8s(
+    WORD8* __restrict__ p_out,
+    const WORD8* __restrict__ p_inp,
+    const WORD8* __restrict__ p_kernel,
+    const WORD32* __restrict__ p_bias,
+    WORD32 inp_h,
+    WORD32 inp_w,
+    WORD32 input_channels,
+    WORD32 ker_h,
+    WORD32 ker_w,
+    WORD32 kernel_channels,
+    WORD32 out_channels,
+    WORD32 x_str,
+    WORD32 y_str,
+    WORD32 x_pad,
+    WORD32 y_pad,
+    WORD32 out_h,
+    WORD32 out_w,
+    WORD32 input_zero_bias,
+    WORD32 * p_out_multiplier,
+    WORD32 * p_out_shift,
+    WORD32 out_zero_bias,
+    VOID *p_scratch,
+    WORD32 out_activation_min,
+    WORD32 out_activation_max,
+    WORD32 tile_height,
+    xa_dma_cfg_t *p_dma_cfg)
+{
+  WORD32 ret = 0;
+  WORD32 row_bytes = inp_w * input_channels;
+  WORD32 itr_oh = 0, itr_ih = -y_pad, buf_idx = 0;
+  WORD32 cur_h = tile_height > out_h ? out_h : tile_height;
+  WORD32 inp_h_idx, y_padding_cur, inp_height_cur, dma_id = -1;
+
+  conv2d_std_tile_inp_rows(itr_ih, cur_h, inp_h, ker_h, y_str, &inp_h_idx, &y_padding_cur, &inp_height_cur);
+  if(inp_height_cur > 0)
+    dma_id = xa_nn_dma_fetch(p_dma_cfg, buf_idx, &p_inp[inp_h_idx * row_bytes], inp_height_cur * row_bytes);
+
+  do
+  {
+    WORD32 next_oh = itr_oh + cur_h;
+    WORD32 next_ih = itr_ih + cur_h * y_str;
+    WORD32 next_h = tile_height > out_h - next_oh ? out_h - next_oh : tile_height;
+    WORD32 next_inp_h_idx = 0, next_y_padding_cur = 0, next_inp_height_cur = 0, next_dma_id = -1;
+
+    /* Start fetching the next tile into the other buffer */
+    if(next_oh < out_h)
+    {
+      conv2d_std_tile_inp_rows(next_ih, next_h, inp_h, ker_h, y_str, &next_inp_h_idx, &next_y_padding_cur, &next_inp_height_cur);
+      if(next_inp_height_cur > 0)
+        next_dma_id = xa_nn_dma_fetch(p_dma_cfg, buf_idx ^ 1, &p_inp[next_inp_h_idx * row_bytes], next_inp_height_cur * row_bytes);
+    }
+
+    if(inp_height_cur <= 0)
+    {
+      conv_y_pad_nhwc_out(
+          &p_out[itr_oh * out_w * out_channels],
+          cur_h,
+          out_w,
+          out_channels,
+          p_bias,
+          p_out_multiplier,
+          p_out_shift,
+          out_zero_bias,
+          out_activation_min,
+          out_activation_max);
+    }
+    else
+    {
+      /* Read in place if the transfer could not be started */
+      const WORD8 *p_tile_inp = dma_id >= 0 ? (const WORD8 *)p_dma_cfg->p_local_buf[buf_idx] : &p_inp[inp_h_idx * row_bytes];
+      xa_nn_dma_wait(p_dma_cfg, dma_id);
+      ret |= internal_xa_nn_conv2d_v2_per_chan_sym8sxasym8s(
+          &p_out[itr_oh * out_w * out_channels],
+          p_tile_inp,
+          p_kernel,
+          p_bias,
+          inp_height_cur,
+          inp_w,
+          input_channels,
+          ker_h,
+          ker_w,
+          kernel_channels,
+          out_channels,
+          x_str,
+          y_str,
+          x_pad,
+          y_padding_cur,
+          cur_h,
+          out_w,
+          input_zero_bias,
+          -input_zero_bias,
+          p_out_multiplier,
+          p_out_shift,
+          out_zero_bias,
+          0,
+          p_scratch,
+          out_activation_min,
+          out_activation_max,
+          NULL);
+    }
+
+    itr_oh = next_oh;
+    itr_ih = next_ih;
+    cur_h = next_h;
+    inp_h_idx = next_inp_h_idx;
+    y_padding_cur = next_y_padding_cur;
+    inp_height_cur = next_inp_height_cur;
+    dma_id = next_dma_id;
+    buf_idx ^= 1;
+  } while(itr_oh < out_h);
+
+  return ret;
+}
+
 /*
 static void xa_nn_rearrange_chw_to_hwc
               (pWORD8 __restrict__ p_out
@@ -931,6 +1053,47 @@ WORD32 xa_nn_conv2d_v2_per_chan_sym8sxasym8s(
   if(tile_height <= 0)
     tile_height = out_h;
 
+  if(XA_NN_DMA_CFG_VALID(p_dma_cfg) && out_data_format == 0)
+  {
+    /* Shrink the tile till its input rows fit in one local buffer */
+    int row_bytes = inp_w * input_channels;
+    int dma_tile_height = tile_height;
+    while(dma_tile_height > 1 && ((dma_tile_height - 1)*y_str + ker_h) * row_bytes > p_dma_cfg->local_buf_size)
+    {
+      dma_tile_height = dma_tile_height > 4 ? ((dma_tile_height - 1) & (~3)) : dma_tile_height - 1;
+    }
+    if(((dma_tile_height - 1)*y_str + ker_h) * row_bytes <= p_dma_cfg->local_buf_size)
+    {
+      return conv2d_v2_dma_per_chan_sym8sxasym8s(
+          p_out,
+          p_inp,
+          p_kernel,
+          p_bias,
+          inp_h,
+          inp_w,
+          input_channels,
+          ker_h,
+          ker_w,
+          kernel_channels,
+          out_channels,
+          x_str,
+          y_str,
+          x_pad,
+          y_pad,
+          out_h,
+          out_w,
+          input_zero_bias,
+          p_out_multiplier,
+          p_out_shift,
+          out_zero_bias,
+          p_scratch,
+          out_activation_min,
+          out_activation_max,
+          dma_tile_height,
+          p_dma_cfg);
+    }
+  }
+
   if(tile_height == out_h || out_data_format == 1)
   {
     ret |= internal_xa_nn_conv2d_v2_per_chan_sym8sxasym8s(
@@ -952,6 +1115,7 @@ WORD32 xa_nn_conv2d_v2_per_chan_sym8sxasym8s(
         out_h,
         out_w,
         input_zero_bias,
+        -input_zero_bias,
         p_out_multiplier,
         p_out_shift,
         out_zero_bias,
@@ -1009,6 +1173,7 @@ WORD32 xa_nn_conv2d_v2_per_chan_sym8sxasym8s(
             tile_height,
             out_w,
             input_zero_bias,
+            -input_zero_bias,
             p_out_multiplier,
             p_out_shift,
             out_zero_bias,
@@ -1027,6 +1192,163 @@ WORD32 xa_nn_conv2d_v2_per_chan_sym8sxasym8s(
   return ret;
 }
 
+/* Grouped conv2d v2 with explicit right/bottom padding and a pad value
+ * from p_pad_cfg, read straight into the circular buffer. */
+WORD32 xa_nn_conv2d_v2_pad_per_chan_sym8sxasym8s(
+    WORD8* __restrict__ p_out,
+    const WORD8* __restrict__ p_inp,
+    const WORD8* __restrict__ p_kernel,
+    const WORD32* __restrict__ p_bias,
+    WORD32 input_height,
+    WORD32 input_width,
+    WORD32 input_channels,
+    WORD32 kernel_height,
+    WORD32 kernel_width,
+    WORD32 kernel_channels,
+    WORD32 dilation_height,
+    WORD32 dilation_width,
+    WORD32 out_channels,
+    WORD32 x_stride,
+    WORD32 y_stride,
+    WORD32 x_padding,
+    WORD32 y_padding,
+    WORD32 out_height,
+    WORD32 out_width,
+    WORD32 input_zero_bias,
+    WORD32 * p_out_multiplier,
+    WORD32 * p_out_shift,
+    WORD32 out_zero_bias,
+    WORD32 out_data_format,
+    VOID *p_scratch,
+    WORD32 out_activation_min,
+    WORD32 out_activation_max,
+    const xa_nn_pad_cfg_t *p_pad_cfg,
+    xa_dma_cfg_t *p_dma_cfg)
+{
+  if(p_pad_cfg != NULL)
+  {
+    XA_NNLIB_ARG_CHK_COND((y_stride <= 0 || x_stride <= 0), -1);
+    XA_NNLIB_ARG_CHK_COND((p_pad_cfg->y_b_padding < 0 || p_pad_cfg->x_r_padding < 0), -1);
+    XA_NNLIB_ARG_CHK_COND((p_pad_cfg->pad_val < -128 || p_pad_cfg->pad_val > 127), -1);
+    /* Output size has to follow from the four pad amounts */
+    XA_NNLIB_ARG_CHK_COND((out_height != (y_padding + input_height + p_pad_cfg->y_b_padding - kernel_height) / y_stride + 1), -1);
+    XA_NNLIB_ARG_CHK_COND((out_width != (x_padding + input_width + p_pad_cfg->x_r_padding - kernel_width) / x_stride + 1), -1);
+  }
+
+  if(p_pad_cfg == NULL || p_pad_cfg->pad_val == -input_zero_bias)
+  {
+    return xa_nn_conv2d_v2_per_chan_sym8sxasym8s(p_out, p_inp, p_kernel, p_bias,
+              input_height, input_width, input_channels, kernel_height, kernel_width, kernel_channels,
+              dilation_height, dilation_width, out_channels, x_stride, y_stride, x_padding, y_padding,
+              out_height, out_width, input_zero_bias, p_out_multiplier, p_out_shift, out_zero_bias,
+              out_data_format, p_scratch, out_activation_min, out_activation_max, p_dma_cfg);
+  }
+
+  /* NULL pointer checks */
+  XA_NNLIB_ARG_CHK_PTR(p_out, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_kernel, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_inp, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_scratch, -1);
+  /* Pointer alignment checks */
+  XA_NNLIB_ARG_CHK_ALIGN(p_bias, sizeof(WORD32), -1);
+  XA_NNLIB_ARG_CHK_ALIGN(p_scratch, ALIGNMENT, -1);
+  /* Basic Parameter checks */
+  XA_NNLIB_ARG_CHK_COND((input_height <= 0 || input_width <= 0), -1);
+  XA_NNLIB_ARG_CHK_COND((input_channels <= 0), -1);
+  XA_NNLIB_ARG_CHK_COND((kernel_channels <= 0), -1);
+  XA_NNLIB_ARG_CHK_COND((kernel_height <= 0 || kernel_width <= 0), -1);
+  XA_NNLIB_ARG_CHK_COND((out_channels <= 0), -1);
+  XA_NNLIB_ARG_CHK_COND((y_padding < 0 || x_padding < 0), -1);
+  XA_NNLIB_ARG_CHK_COND((out_height <= 0 || out_width <= 0), -1);
+  XA_NNLIB_ARG_CHK_COND((input_zero_bias < -127 || input_zero_bias > 128), -1);
+  XA_NNLIB_ARG_CHK_COND((out_zero_bias < -128 || out_zero_bias > 127), -1);
+  XA_NNLIB_ARG_CHK_COND((out_data_format != 0 && out_data_format != 1), -1);
+  XA_NNLIB_ARG_CHK_COND((dilation_height!= 1), -1);
+  XA_NNLIB_ARG_CHK_COND((dilation_width!= 1), -1);
+  XA_NNLIB_ARG_CHK_COND((out_activation_min < -128 || out_activation_min > 127), -1);
+  XA_NNLIB_ARG_CHK_COND((out_activation_max < out_activation_min || out_activation_max > 127), -1);
+
+  int itr;
+  for(itr=0;itr<out_channels;itr++){
+    XA_NNLIB_ARG_CHK_COND((p_out_shift[itr] < -31 || p_out_shift[itr] > 31), -1);
+  }
+  const int groups = input_channels/kernel_channels;
+  XA_NNLIB_ARG_CHK_COND((groups<=0), -1);
+  XA_NNLIB_ARG_CHK_COND(((input_channels %kernel_channels)!=0),-1);
+  XA_NNLIB_ARG_CHK_COND(((out_channels%groups)!=0),-1);
+
+  if((groups==input_channels) && (out_channels>=input_channels) && (out_data_format==0) && p_bias)
+  {
+    WORD32 channel_multiplier=out_channels/input_channels;
+    pWORD8 p_kernel_nhwc;
+    p_scratch = (void *)ALIGNED_ADDR(p_scratch, ALIGNMENT_16);
+    p_kernel_nhwc = (pWORD8)p_scratch;
+    p_scratch += PADDED_SIZE(out_channels * kernel_height * kernel_width, ALIGNMENT_16);
+    xa_nn_rearrange_chw_to_hwc(p_kernel_nhwc,p_kernel,kernel_width,kernel_height,out_channels);
+
+    return xa_nn_conv2d_depthwise_v2_pad_per_chan_sym8sxasym8s
+                (p_out
+                ,p_kernel_nhwc
+                ,p_inp
+                ,p_bias
+                ,input_height
+                ,input_width
+                ,input_channels
+                ,kernel_height
+                ,kernel_width
+                ,channel_multiplier
+                ,x_stride
+                ,y_stride
+                ,x_padding
+                ,y_padding
+                ,out_height
+                ,out_width
+                ,input_zero_bias
+                ,p_out_multiplier
+                ,p_out_shift
+                ,out_zero_bias
+                ,0
+                ,out_data_format
+                ,p_scratch
+                ,out_activation_min
+                ,out_activation_max
+                ,p_pad_cfg
+                ,NULL
+                );
+  }
+
+  /* Whole plane in one pass: the pad-only output shortcuts of the tiled
+   * path assume padding with the zero point */
+  return internal_xa_nn_conv2d_v2_per_chan_sym8sxasym8s(
+      p_out,
+      p_inp,
+      p_kernel,
+      p_bias,
+      input_height,
+      input_width,
+      input_channels,
+      kernel_height,
+      kernel_width,
+      kernel_channels,
+      out_channels,
+      x_stride,
+      y_stride,
+      x_padding,
+      y_padding,
+      out_height,
+      out_width,
+      input_zero_bias,
+      p_pad_cfg->pad_val,
+      p_out_multiplier,
+      p_out_shift,
+      out_zero_bias,
+      out_data_format,
+      p_scratch,
+      out_activation_min,
+      out_activation_max,
+      p_dma_cfg);
+}
+
 WORD32 xa_nn_conv2d_per_chan_sym8sxasym8s(
     WORD8* __restrict__ p_out,
     const WORD8* __restrict__ p_inp,
@@ -19,10 +19,18 @@
 * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 
 ******************************************************************************/
+#include <math.h>
 #include "xa_nnlib_common_fpu.h"
 #include "xa_type_def.h"
 #include "xa_nnlib_kernels_api.h"
 #include "xa_nnlib_err_chk.h"
+#include "xa_nnlib_common.h"
+#include "xa_nnlib_common_macros_hifi5.h"
+#include "xa_nnlib_common_act_lut.h"
+#include "xa_nnlib_common_residual.h"
+
+#define ALIGNMENT   16   /* 16 bytes alignment */
+#define ALIGNED_SIZE(x, bytes)  (((x)+(bytes-1))&(~(bytes-1)))
 
 WORD32 xa_nn_fully_connected_v2_asym8sxasym8s_asym8s
   (WORD8 *__restrict__ p_out
@@ -79,6 +87,373 @@ WORD32 xa_nn_fully_connected_v2_asym8sxasym8s_asym8s
   return ret;
 }
 
+/* Computes outputs [out_start, out_end), so that disjoint slices can run
+ * concurrently. out_start must be a multiple of 16 to keep the output,
+ * weight and bias pointers of the slice aligned. */
+WORD32 xa_nn_fully_connected_v2_slice_asym8sxasym8s_asym8s
+  (WORD8 *__restrict__ p_out
+   ,const WORD8 *__restrict__ p_weight
+   ,const WORD8 *__restrict__ p_inp
+   ,const WORD32 *__restrict__ p_bias
+   ,WORD32  weight_depth
+   ,WORD32  out_depth
+   ,WORD32  input_zero_bias
+   ,WORD32  weight_zero_bias
+   ,WORD32  out_multiplier
+   ,WORD32  out_shift
+   ,WORD32  out_zero_bias
+   ,WORD32  out_activation_min
+   ,WORD32  out_activation_max
+   ,WORD32  out_start
+   ,WORD32  out_end
+   ,xa_dma_cfg_t *p_dma_cfg
+  )
+{
+  /* NULL pointer checks */
+  XA_NNLIB_ARG_CHK_PTR(p_out, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_weight, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_inp, -1);
+  /* Basic Parameter checks */
+  XA_NNLIB_ARG_CHK_COND((out_start < 0 || out_end > out_depth || out_start >= out_end), -1);
+  XA_NNLIB_ARG_CHK_COND((out_start & 15), -1);
+
+  return xa_nn_fully_connected_v2_asym8sxasym8s_asym8s
+    (&p_out[out_start]
+     ,&p_weight[out_start * weight_depth]
+     ,p_inp
+     ,p_bias != NULL ? &p_bias[out_start] : NULL
+     ,weight_depth
+     ,out_end - out_start
+     ,input_zero_bias
+     ,weight_zero_bias
+     ,out_multiplier
+     ,out_shift
+     ,out_zero_bias
+     ,out_activation_min
+     ,out_activation_max
+     ,p_dma_cfg
+    );
+}
+
+/* Fully connected v2 with a residual add on the out_depth outputs,
+ * applied before the out_activation_min/max clamp. The outputs are
+ * saturated to int8 before the add, see xa_nn_residual_cfg_t. */
+WORD32 xa_nn_fully_connected_v2_residual_asym8sxasym8s_asym8s
+  (WORD8 *__restrict__ p_out
+   ,const WORD8 *__restrict__ p_weight
+   ,const WORD8 *__restrict__ p_inp
+   ,const WORD32 *__restrict__ p_bias
+   ,WORD32  weight_depth
+   ,WORD32  out_depth
+   ,WORD32  input_zero_bias
+   ,WORD32  weight_zero_bias
+   ,WORD32  out_multiplier
+   ,WORD32  out_shift
+   ,WORD32  out_zero_bias
+   ,WORD32  out_activation_min
+   ,WORD32  out_activation_max
+   ,const xa_nn_residual_cfg_t *p_res_cfg
+   ,xa_dma_cfg_t *p_dma_cfg
+  )
+{
+  if(p_res_cfg == NULL)
+  {
+    return xa_nn_fully_connected_v2_asym8sxasym8s_asym8s
+      (p_out, p_weight, p_inp, p_bias, weight_depth, out_depth
+       ,input_zero_bias, weight_zero_bias, out_multiplier, out_shift, out_zero_bias
+       ,out_activation_min, out_activation_max, p_dma_cfg);
+  }
+
+  XA_NNLIB_ARG_CHK_PTR(p_res_cfg->p_res, -1);
+  XA_NNLIB_ARG_CHK_COND((p_res_cfg->res_zero_bias < -127 || p_res_cfg->res_zero_bias > 128), -1);
+  XA_NNLIB_ARG_CHK_COND((p_res_cfg->res_shift < -31 || p_res_cfg->res_shift > 31), -1);
+  XA_NNLIB_ARG_CHK_COND((out_activation_min < -128 || out_activation_min > 127), -1);
+  XA_NNLIB_ARG_CHK_COND((out_activation_max < out_activation_min || out_activation_max > 127), -1);
+
+  WORD32 ret = 0;
+  ret = xa_nn_fully_connected_v2_asym8sxasym8s_asym8s
+    (p_out
+     ,p_weight
+     ,p_inp
+     ,p_bias
+     ,weight_depth
+     ,out_depth
+     ,input_zero_bias
+     ,weight_zero_bias
+     ,out_multiplier
+     ,out_shift
+     ,out_zero_bias
+     ,-128
+     ,127
+     ,p_dma_cfg
+    );
+  if(ret < 0)
+    return ret;
+
+  xa_nn_residual_add_asym8s(p_out
+      ,p_res_cfg->p_res
+      ,out_depth
+      ,p_res_cfg->res_zero_bias
+      ,p_res_cfg->res_multiplier
+      ,p_res_cfg->res_shift
+      ,out_activation_min
+      ,out_activation_max);
+
+  return 0;
+}
+
+/* Fully connected v2 followed by the activation in p_act_cfg, lut_channels
+ * is 1 or out_depth. */
+WORD32 xa_nn_fully_connected_v2_act_asym8sxasym8s_asym8s
+  (WORD8 *__restrict__ p_out
+   ,const WORD8 *__restrict__ p_weight
+   ,const WORD8 *__restrict__ p_inp
+   ,const WORD32 *__restrict__ p_bias
+   ,WORD32  weight_depth
+   ,WORD32  out_depth
+   ,WORD32  input_zero_bias
+   ,WORD32  weight_zero_bias
+   ,WORD32  out_multiplier
+   ,WORD32  out_shift
+   ,WORD32  out_zero_bias
+   ,WORD32  out_activation_min
+   ,WORD32  out_activation_max
+   ,const xa_nn_act_cfg_t *p_act_cfg
+   ,xa_dma_cfg_t *p_dma_cfg
+  )
+{
+  WORD32 ret = 0;
+  ret = xa_nn_fully_connected_v2_asym8sxasym8s_asym8s
+    (p_out
+     ,p_weight
+     ,p_inp
+     ,p_bias
+     ,weight_depth
+     ,out_depth
+     ,input_zero_bias
+     ,weight_zero_bias
+     ,out_multiplier
+     ,out_shift
+     ,out_zero_bias
+     ,out_activation_min
+     ,out_activation_max
+     ,p_dma_cfg
+    );
+  if(ret < 0 || p_act_cfg == NULL)
+    return ret;
+
+  XA_NNLIB_ARG_CHK_PTR(p_act_cfg->p_lut, -1);
+  XA_NNLIB_ARG_CHK_COND((p_act_cfg->lut_channels != 1 && p_act_cfg->lut_channels != out_depth), -1);
+
+  /* Entry 0 of each table is for -128 */
+  xa_nn_act_lut_asym8s(p_out, p_act_cfg->p_lut + 128, p_act_cfg->lut_channels == 1 ? 0 : 256, out_depth);
+
+  return 0;
+}
+
+/* Logit rows per FC step of the softmax head, multiple of 16 */
+#define FC_SOFTMAX_TILE 64
+
+/* Fully connected v2 classifier head: the requantized logits stay in
+ * p_scratch and feed xa_nn_vec_softmax_asym8s_[asym8s|16] (out_precision
+ * PREC_ASYM8S or PREC_16). The top-1 index is tracked tile by tile during the
+ * FC when p_top1 is not NULL; with p_out NULL only p_top1 is produced.
+ * p_scratch is sized by xa_nn_fully_connected_v2_softmax_getsize. */
+WORD32 xa_nn_fully_connected_v2_softmax_asym8sxasym8s
+  (pVOID __restrict__ p_out
+   ,WORD32 *p_top1
+   ,const WORD8 *__restrict__ p_weight
+   ,const WORD8 *__restrict__ p_inp
+   ,const WORD32 *__restrict__ p_bias
+   ,WORD32  weight_depth
+   ,WORD32  out_depth
+   ,WORD32  input_zero_bias
+   ,WORD32  weight_zero_bias
+   ,WORD32  out_multiplier
+   ,WORD32  out_shift
+   ,WORD32  out_zero_bias
+   ,WORD32  diffmin
+   ,WORD32  input_beta_left_shift
+   ,WORD32  input_beta_multiplier
+   ,WORD32  out_precision
+   ,VOID *p_scratch
+   ,xa_dma_cfg_t *p_dma_cfg
+  )
+{
+  /* NULL pointer checks */
+  XA_NNLIB_ARG_CHK_COND((p_out == NULL && p_top1 == NULL), -1);
+  XA_NNLIB_ARG_CHK_PTR(p_scratch, -1);
+  /* Pointer alignment checks */
+  XA_NNLIB_ARG_CHK_ALIGN(p_out, out_precision == PREC_16 ? sizeof(WORD16) : sizeof(WORD8), -1);
+  XA_NNLIB_ARG_CHK_ALIGN(p_scratch, ALIGNMENT, -1);
+  /* Basic Parameter checks */
+  XA_NNLIB_ARG_CHK_COND((out_precision != PREC_ASYM8S && out_precision != PREC_16), -1);
+
+  WORD32 ret = 0;
+  WORD8 *p_logits = (WORD8 *)p_scratch;
+  VOID *p_softmax_scratch = (VOID *)(p_logits + ALIGNED_SIZE(out_depth, ALIGNMENT));
+  WORD32 max_val = -129, max_idx = 0;
+  WORD32 itr, i;
+
+  for(itr = 0; itr < out_depth; itr += FC_SOFTMAX_TILE)
+  {
+    WORD32 cur_depth = XT_MIN(FC_SOFTMAX_TILE, out_depth - itr);
+    ret = xa_nn_fully_connected_v2_asym8sxasym8s_asym8s
+      (&p_logits[itr]
+       ,&p_weight[itr * weight_depth]
+       ,p_inp
+       ,p_bias != NULL ? &p_bias[itr] : NULL
+       ,weight_depth
+       ,cur_depth
+       ,input_zero_bias
+       ,weight_zero_bias
+       ,out_multiplier
+       ,out_shift
+       ,out_zero_bias
+       ,-128
+       ,127
+       ,p_dma_cfg
+      );
+    if(ret < 0)
+      return ret;
+
+    /* Strict compare keeps the first index of the maximum */
+    if(p_top1 != NULL)
+    {
+      for(i = itr; i < itr + cur_depth; i++)
+      {
+        if(p_logits[i] > max_val)
+        {
+          max_val = p_logits[i];
+          max_idx = i;
+        }
+      }
+    }
+  }
+
+  if(p_top1 != NULL)
+    *p_top1 = max_idx;
+
+  if(p_out == NULL)
+    return 0;
+
+  if(out_precision == PREC_16)
+  {
+    return xa_nn_vec_softmax_asym8s_16((WORD16 *)p_out, p_logits, diffmin,
+              input_beta_left_shift, input_beta_multiplier, out_depth, p_softmax_scratch);
+  }
+  return xa_nn_vec_softmax_asym8s_asym8s((WORD8 *)p_out, p_logits, diffmin,
+            input_beta_left_shift, input_beta_multiplier, out_depth, p_softmax_scratch);
+}
+
+/* Outputs per dequantize step, kept on the stack */
+#define FC_F32IO_OUT_TILE 64
+
+/* Fully connected v2 with f32 input and optionally f32 output, see
+ * xa_nn_f32io_cfg_t. p_scratch holds the quantized input, weight_depth
+ * bytes; the f32 output is dequantized tile by tile while still in cache. */
+#if !HAVE_VFPU
+DISCARD_FUN_FOR_NONVOID_RETURN(WORD32, xa_nn_fully_connected_v2_f32io_asym8sxasym8s_asym8s,
+  (pVOID __restrict__ p_out
+   ,const WORD8 *__restrict__ p_weight
+   ,const FLOAT32 *__restrict__ p_inp
+   ,const WORD32 *__restrict__ p_bias
+   ,WORD32  weight_depth
+   ,WORD32  out_depth
+   ,WORD32  input_zero_bias
+   ,WORD32  weight_zero_bias
+   ,WORD32  out_multiplier
+   ,WORD32  out_shift
+   ,WORD32  out_zero_bias
+   ,WORD32  out_activation_min
+   ,WORD32  out_activation_max
+   ,const xa_nn_f32io_cfg_t *p_io_cfg
+   ,VOID *p_scratch
+   ,xa_dma_cfg_t *p_dma_cfg
+  ))
+#else /* #if !HAVE_VFPU */
+WORD32 xa_nn_fully_connected_v2_f32io_asym8sxasym8s_asym8s
+  (pVOID __restrict__ p_out
+   ,const WORD8 *__restrict__ p_weight
+   ,const FLOAT32 *__restrict__ p_inp
+   ,const WORD32 *__restrict__ p_bias
+   ,WORD32  weight_depth
+   ,WORD32  out_depth
+   ,WORD32  input_zero_bias
+   ,WORD32  weight_zero_bias
+   ,WORD32  out_multiplier
+   ,WORD32  out_shift
+   ,WORD32  out_zero_bias
+   ,WORD32  out_activation_min
+   ,WORD32  out_activation_max
+   ,const xa_nn_f32io_cfg_t *p_io_cfg
+   ,VOID *p_scratch
+   ,xa_dma_cfg_t *p_dma_cfg
+  )
+{
+  /* NULL pointer checks */
+  XA_NNLIB_ARG_CHK_PTR(p_out, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_inp, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_io_cfg, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_scratch, -1);
+  /* Pointer alignment checks */
+  XA_NNLIB_ARG_CHK_ALIGN(p_out, p_io_cfg->out_f32 ? sizeof(FLOAT32) : sizeof(WORD64), -1);
+  XA_NNLIB_ARG_CHK_ALIGN(p_inp, sizeof(FLOAT32), -1);
+  XA_NNLIB_ARG_CHK_ALIGN(p_scratch, sizeof(WORD64), -1);
+  /* Basic Parameter checks */
+  XA_NNLIB_ARG_CHK_COND((weight_depth <= 0), -1);
+  XA_NNLIB_ARG_CHK_COND((p_io_cfg->out_f32 && (p_io_cfg->out_scale == 0.0f || !isfinite(p_io_cfg->out_scale))), -1);
+
+  WORD32 ret = 0;
+  WORD8 *p_inp_q = (WORD8 *)p_scratch;
+
+  ret = xa_nn_elm_quantize_f32_asym8s(p_inp_q, p_inp, p_io_cfg->inp_scale, -input_zero_bias, weight_depth);
+  if(ret < 0)
+    return ret;
+
+  if(!p_io_cfg->out_f32)
+  {
+    return xa_nn_fully_connected_v2_asym8sxasym8s_asym8s
+      ((WORD8 *)p_out, p_weight, p_inp_q, p_bias, weight_depth, out_depth
+       ,input_zero_bias, weight_zero_bias, out_multiplier, out_shift, out_zero_bias
+       ,out_activation_min, out_activation_max, p_dma_cfg);
+  }
+
+  /* Tile start stays a multiple of 16 so weight and bias keep their alignment */
+  WORD8 ALIGN(16) out_tile[FC_F32IO_OUT_TILE];
+  FLOAT32 *p_out_f32 = (FLOAT32 *)p_out;
+  WORD32 itr;
+  for(itr = 0; itr < out_depth; itr += FC_F32IO_OUT_TILE)
+  {
+    WORD32 cur_depth = XT_MIN(FC_F32IO_OUT_TILE, out_depth - itr);
+    ret = xa_nn_fully_connected_v2_asym8sxasym8s_asym8s
+      (out_tile
+       ,&p_weight[itr * weight_depth]
+       ,p_inp_q
+       ,p_bias != NULL ? &p_bias[itr] : NULL
+       ,weight_depth
+       ,cur_depth
+       ,input_zero_bias
+       ,weight_zero_bias
+       ,out_multiplier
+       ,out_shift
+       ,out_zero_bias
+       ,out_activation_min
+       ,out_activation_max
+       ,p_dma_cfg
+      );
+    if(ret < 0)
+      return ret;
+
+    ret = xa_nn_elm_dequantize_asym8s_f32(&p_out_f32[itr], out_tile, out_zero_bias, p_io_cfg->out_scale, cur_depth);
+    if(ret < 0)
+      return ret;
+  }
+
+  return 0;
+}
+#endif /* #if !HAVE_VFPU */
+
 WORD32 xa_nn_fully_connected_v2_sym8sxsym16s_sym16s
   (WORD16 *__restrict__ p_out
    ,const WORD8 *__restrict__ p_weight
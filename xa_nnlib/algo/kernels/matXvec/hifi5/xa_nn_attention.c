@@ -0,0 +1,1057 @@
+/*******************************************************************************
+* Copyright (c) 2018-2025 Cadence Design Systems, Inc.
+*
+* Permission is hereby granted, free of charge, to any person obtaining
+* a copy of this software and associated documentation files (the
+* "Software"), to use this Software with Cadence processor cores only and
+* not with any other processors and platforms, subject to
+* the following conditions:
+*
+* The above copyright notice and this permission notice shall be included
+* in all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+******************************************************************************/
+#include "xa_nnlib_common.h"
+#include "xa_nnlib_common_macros_hifi5.h"
+#include <string.h>
+
+#define ALIGNED_ADDR( addr, align ) \
+  (void*)( ( (UWORD32)(addr) + ( (align) - 1 ) ) & ~( (align) - 1 ) )
+
+#define PADDED_SIZE( size, align ) \
+  ( ( (size_t)(size) + (align) - 1 ) & ~( (align) - 1 ) )
+
+#define ALIGNMENT 16
+
+/* Entries of the asym8s score difference to weight table */
+#define ATTN_LUT_SIZE 256
+
+/* Fraction bits of the attention-weighted V before output requantization */
+#define ATTN_FRAC_BITS_ASYM8S 16
+#define ATTN_FRAC_BITS_SYM16S 15
+
+/* Keys per int32 asym8s P.V product, 512 * 128 * 32767 is below 2^31 */
+#define ATTN_PV_COLS_ASYM8S 512
+
+WORD32 xa_nn_attention_getsize(
+    WORD32 head_dim,
+    WORD32 block_size,
+    WORD32 precision)
+{
+  /* Basic Parameter checks */
+  XA_NNLIB_CHK_COND((head_dim <= 0), -1);
+  XA_NNLIB_CHK_COND((block_size <= 0), -1);
+  XA_NNLIB_CHK_COND((precision != PREC_ASYM8S && precision != PREC_SYM16S), -1);
+
+  WORD32 elm_size = precision == PREC_SYM16S ? sizeof(WORD16) : sizeof(WORD8);
+  WORD32 size = 0;
+
+  /* Block of scores, running max, running sum, weighted V, weight table */
+  size += PADDED_SIZE(block_size * block_size * elm_size, ALIGNMENT);
+  size += PADDED_SIZE(block_size * sizeof(WORD32), ALIGNMENT);
+  size += PADDED_SIZE(block_size * sizeof(WORD64), ALIGNMENT);
+  size += PADDED_SIZE(block_size * head_dim * sizeof(WORD64), ALIGNMENT);
+  size += PADDED_SIZE(ATTN_LUT_SIZE * sizeof(WORD32), ALIGNMENT);
+  /* Weights of one row, P.V of one row, zero bias */
+  size += PADDED_SIZE(block_size * sizeof(WORD16), ALIGNMENT);
+  size += PADDED_SIZE(head_dim * sizeof(WORD64), ALIGNMENT);
+  size += PADDED_SIZE(head_dim * sizeof(WORD16), ALIGNMENT);
+
+  /* Alignment of the scratch base */
+  return size + ALIGNMENT;
+}
+
+#ifndef ENABLE_SCRATCH_SIZE_API_ONLY
+/* Scratch of one call, see xa_nn_attention_getsize */
+typedef struct _attn_scratch_t
+{
+  VOID *p_scores;   /* block x block scores */
+  WORD32 *p_max;    /* running max per query row */
+  WORD64 *p_sum;    /* running weight sum per query row */
+  WORD64 *p_acc;    /* running weighted V per query row */
+  WORD32 *p_lut;    /* asym8s score difference to weight */
+  WORD16 *p_w;      /* weights of one query row */
+  VOID *p_pv;       /* P.V of one query row */
+  WORD16 *p_zero;   /* zero bias of the P.V matXvec */
+} attn_scratch_t;
+
+static VOID attn_scratch_init(attn_scratch_t *p_s, VOID *p_scratch, WORD32 head_dim, WORD32 block, WORD32 elm_size)
+{
+  WORD8 *p = (WORD8 *)ALIGNED_ADDR(p_scratch, ALIGNMENT);
+
+  p_s->p_scores = p;
+  p += PADDED_SIZE(block * block * elm_size, ALIGNMENT);
+  p_s->p_max = (WORD32 *)p;
+  p += PADDED_SIZE(block * sizeof(WORD32), ALIGNMENT);
+  p_s->p_sum = (WORD64 *)p;
+  p += PADDED_SIZE(block * sizeof(WORD64), ALIGNMENT);
+  p_s->p_acc = (WORD64 *)p;
+  p += PADDED_SIZE(block * head_dim * sizeof(WORD64), ALIGNMENT);
+  p_s->p_lut = (WORD32 *)p;
+  p += PADDED_SIZE(ATTN_LUT_SIZE * sizeof(WORD32), ALIGNMENT);
+  p_s->p_w = (WORD16 *)p;
+  p += PADDED_SIZE(block * sizeof(WORD16), ALIGNMENT);
+  p_s->p_pv = p;
+  p += PADDED_SIZE(head_dim * sizeof(WORD64), ALIGNMENT);
+  p_s->p_zero = (WORD16 *)p;
+
+  memset(p_s->p_zero, 0, head_dim * sizeof(WORD16));
+}
+
+/* Scalar gemmlowp fixed point helpers, used on one value per score */
+static WORD32 attn_srdhm(WORD32 a, WORD32 b)
+{
+  WORD64 ab;
+  WORD32 nudge;
+  if(a == b && a == (WORD32)0x80000000)
+    return 0x7fffffff;
+  ab = (WORD64)a * b;
+  nudge = ab >= 0 ? (1 << 30) : (1 - (1 << 30));
+  return (WORD32)((ab + nudge) / ((WORD64)1 << 31));
+}
+
+static WORD32 attn_rdbpot(WORD32 x, WORD32 exponent)
+{
+  WORD32 mask = (WORD32)(((WORD64)1 << exponent) - 1);
+  WORD32 remainder = x & mask;
+  WORD32 threshold = (mask >> 1) + (x < 0 ? 1 : 0);
+  return (x >> exponent) + (remainder > threshold ? 1 : 0);
+}
+
+static WORD32 attn_sat32(WORD64 x)
+{
+  return x > 0x7fffffff ? 0x7fffffff : (x < -(WORD64)0x80000000 ? (WORD32)0x80000000 : (WORD32)x);
+}
+
+/* exp(a) for a in [-1/4, 0), Q0.31 in and out */
+static WORD32 attn_exp_quarter(WORD32 a)
+{
+  const WORD32 constant_term = 1895147668;
+  const WORD32 constant_1_over_3 = 715827883;
+  WORD32 x = a + (1 << 28);
+  WORD32 x2 = attn_srdhm(x, x);
+  WORD32 x3 = attn_srdhm(x2, x);
+  WORD32 x4 = attn_srdhm(x2, x2);
+  WORD32 x4_over_4 = attn_rdbpot(x4, 2);
+  WORD32 poly = attn_rdbpot(attn_srdhm(x4_over_4 + x3, constant_1_over_3) + x2, 1);
+  return constant_term + attn_srdhm(constant_term, x + poly);
+}
+
+/* exp(a) for a <= 0 in Q5.26, result in Q0.31 */
+static WORD32 attn_exp_neg_q26(WORD32 a)
+{
+  /* exp(-1/4), exp(-1/2), exp(-1), ..., exp(-16) in Q0.31 */
+  static const WORD32 barrel_mult[7] = {1672461947, 1302514674, 790015084, 290630308, 39332535, 720401, 242};
+  const WORD32 one_quarter = 1 << 24;
+  WORD32 a_mod = (a & (one_quarter - 1)) - one_quarter;
+  WORD32 result = attn_exp_quarter(a_mod << 5);
+  WORD32 remainder = a_mod - a;
+  int i;
+
+  if(a == 0)
+    return 0x7fffffff;
+
+  for(i = 0; i < 7; i++)
+  {
+    if(remainder & (1 << (24 + i)))
+      result = attn_srdhm(result, barrel_mult[i]);
+  }
+  return result;
+}
+
+/* Softmax weight in Q15 of a score diff <= 0 from the row max, 1.0 is
+ * saturated to 32767 so that weights are 16-bit matXvec operands */
+static WORD32 attn_weight(WORD32 diff, const xa_nn_attention_params_t *p_params)
+{
+  WORD32 x, e;
+  if(diff < p_params->diffmin)
+    return 0;
+  x = attn_sat32((WORD64)diff << p_params->input_beta_left_shift);
+  x = attn_srdhm(x, p_params->input_beta_multiplier);
+  e = attn_exp_neg_q26(x);
+  return XT_MIN(32767, (WORD32)(((WORD64)e + (1 << 15)) >> 16));
+}
+
+/* Vector exp(a) for a <= 0 in Q5.26, as in xa_nn_vec_softmax_asym8_asym8 */
+static const int CONSTANT_TERM =  (0x70f5a894);
+static const int CONSTANT_1_OVER_3 = (0x2aaaaaab);
+static const int CONSTANT_1_OVER_8 = (0x10000000);
+static const int ONE_QUATER_Q26 = (0x1000000); // Q6.26
+static const int MASK = (0xffffff);
+static const int Q31 = 0x7fffffff;
+
+#define EXP_ON_INTERVAL_BETWEEN_NEGATIVE_ONE_QUARTER_AND_0_EXCLX2(y_out1, y_out2, inp1, inp2)\
+{\
+    ae_f32x2 x1_in, x2, x3, x4, x4_by_4, y1, y2, y3, y4, y5, y6;\
+    ae_f32x2 l1_in, l2, l3, l4, l4_by_4, m1, m2, m3, m4, m5, m6;\
+\
+    x1_in = AE_ADD32S(AE_MOVF32X2_FROMINT32X2(inp1), AE_MOVF32X2_FROMINT32X2(CT_1_BY_8));\
+    l1_in = AE_ADD32S(AE_MOVF32X2_FROMINT32X2(inp2), AE_MOVF32X2_FROMINT32X2(CT_1_BY_8));\
+    AE_MULF2P32X4RAS(x2, l2, x1_in, l1_in, x1_in, l1_in);\
+    AE_MULF2P32X4RAS(x3, x4, x2, x2, x1_in, x2);\
+    AE_MULF2P32X4RAS(l3, l4, l2, l2, l1_in, l2);\
+    x4_by_4 = AE_MOVF32X2_FROMINT32X2(AE_SRAI32R(AE_MOVINT32X2_FROMF32X2(x4), 2));\
+    l4_by_4 = AE_MOVF32X2_FROMINT32X2(AE_SRAI32R(AE_MOVINT32X2_FROMF32X2(l4), 2));\
+    y1 = AE_ADD32S(x4_by_4, x3);\
+    m1 = AE_ADD32S(l4_by_4, l3);\
+    AE_MULF2P32X4RAS(y2, m2, y1, m1, AE_MOVF32X2_FROMINT32X2(CT_1_BY_3), AE_MOVF32X2_FROMINT32X2(CT_1_BY_3));\
+    y3 = AE_ADD32S(y2, x2);\
+    m3 = AE_ADD32S(m2, l2);\
+    y4 = AE_MOVF32X2_FROMINT32X2(AE_SRAI32R(AE_MOVINT32X2_FROMF32X2(y3), 1));\
+    m4 = AE_MOVF32X2_FROMINT32X2(AE_SRAI32R(AE_MOVINT32X2_FROMF32X2(m3), 1));\
+\
+    y5 = AE_ADD32S(x1_in, y4); \
+    m5 = AE_ADD32S(l1_in, m4); \
+    AE_MULF2P32X4RAS(y6, m6, y5, m5, AE_MOVF32X2_FROMINT32X2(CT), AE_MOVF32X2_FROMINT32X2(CT));\
+    y_out1 = AE_MOVINT32X2_FROMF32X2(AE_ADD32S(y6, AE_MOVF32X2_FROMINT32X2(CT)));\
+    y_out2 = AE_MOVINT32X2_FROMF32X2(AE_ADD32S(m6, AE_MOVF32X2_FROMINT32X2(CT)));\
+}
+
+#define GEMMLOWP_EXP_BARREL_SHIFTERX2(out_1, out_2, exponent, FixedPointMultiplier, remainder1, remainder2)\
+{\
+    int shift_amount;\
+    ae_int32x2 mask1, mask2, scale;\
+    ae_f32x2 out1, out2;\
+    xtbool2 b1, b2;\
+\
+    shift_amount = 26 + exponent;\
+    scale = AE_SLAA32(ONE, shift_amount);\
+\
+    mask1 = AE_AND32(remainder1,  scale);\
+    mask2 = AE_AND32(remainder2,  scale);\
+\
+    b1 = AE_LT32(z, mask1);\
+    b2 = AE_LT32(z, mask2);\
+\
+    AE_MULF2P32X4RAS(out1, out2, AE_MOVF32X2_FROMINT32X2(out_1), AE_MOVF32X2_FROMINT32X2(out_2), AE_MOVF32X2_FROMINT32X2(SW_MOVDA32(FixedPointMultiplier)), AE_MOVF32X2_FROMINT32X2(SW_MOVDA32(FixedPointMultiplier)));\
+    AE_MOVT32X2(out_1, AE_MOVINT32X2_FROMF32X2(out1), b1);\
+    AE_MOVT32X2(out_2, AE_MOVINT32X2_FROMF32X2(out2), b2);\
+}
+
+#define EXP_Q26X2(y1, y2, inp1, inp2)\
+{\
+    xtbool2 b;\
+    ae_int32x2 x_in1, x_in2, x2, remainder1, remainder2;\
+    ae_int32x2 a_mod_quater_minus_q_1_by_4_first;\
+    ae_int32x2 a_mod_quater_minus_q_1_by_4_second;\
+\
+    x2 = AE_AND32(inp1, mask_6fs);\
+    a_mod_quater_minus_q_1_by_4_first = AE_SUB32(x2, q_1_by_4);\
+    x_in1 = AE_SLAI32(a_mod_quater_minus_q_1_by_4_first, 5);\
+\
+    x2 = AE_AND32(inp2, mask_6fs);\
+    a_mod_quater_minus_q_1_by_4_second = AE_SUB32(x2, q_1_by_4);\
+    x_in2 = AE_SLAI32(a_mod_quater_minus_q_1_by_4_second, 5);\
+\
+    EXP_ON_INTERVAL_BETWEEN_NEGATIVE_ONE_QUARTER_AND_0_EXCLX2(y1, y2, x_in1, x_in2)\
+\
+    remainder1 = AE_SUB32(a_mod_quater_minus_q_1_by_4_first, inp1);\
+    remainder2 = AE_SUB32(a_mod_quater_minus_q_1_by_4_second, inp2);\
+\
+    GEMMLOWP_EXP_BARREL_SHIFTERX2(y1, y2, -2, 1672461947, remainder1, remainder2);\
+    GEMMLOWP_EXP_BARREL_SHIFTERX2(y1, y2, -1, 1302514674, remainder1, remainder2);\
+    GEMMLOWP_EXP_BARREL_SHIFTERX2(y1, y2, 0, 790015084,   remainder1, remainder2);\
+    GEMMLOWP_EXP_BARREL_SHIFTERX2(y1, y2, 1, 290630308,   remainder1, remainder2);\
+    GEMMLOWP_EXP_BARREL_SHIFTERX2(y1, y2, 2, 39332535,    remainder1, remainder2);\
+    GEMMLOWP_EXP_BARREL_SHIFTERX2(y1, y2, 3, 720401,      remainder1, remainder2);\
+    GEMMLOWP_EXP_BARREL_SHIFTERX2(y1, y2, 4, 242,         remainder1, remainder2);\
+\
+    b = AE_EQ32(inp1, z);\
+    AE_MOVT32X2(y1, SW_MOVDA32(Q31), b);\
+\
+    b = AE_EQ32(inp2, z);\
+    AE_MOVT32X2(y2, SW_MOVDA32(Q31), b);\
+}
+
+/* Weights of n sym16s scores against the row max into p_w, 4 per iteration,
+ * returns their sum */
+static WORD32 attn_weights_sym16s(WORD16 *p_w,
+    const WORD16 *p_row,
+    WORD32 n,
+    WORD32 row_max,
+    const xa_nn_attention_params_t *p_params)
+{
+  const ae_int16x4 *p_s = (const ae_int16x4 *)p_row;
+  ae_int16x4 *p_o = (ae_int16x4 *)p_w;
+  ae_valign a_s = AE_LA64_PP(p_s);
+  ae_valign a_o = AE_ZALIGN64();
+  WORD32 input_beta_multiplier = p_params->input_beta_multiplier;
+  WORD32 input_beta_left_shift = p_params->input_beta_left_shift;
+  ae_int32x2 z = AE_ZERO32();
+  ae_int32x2 CT = SW_MOVDA32(CONSTANT_TERM);
+  ae_int32x2 CT_1_BY_3 = SW_MOVDA32(CONSTANT_1_OVER_3);
+  ae_int32x2 CT_1_BY_8 = SW_MOVDA32(CONSTANT_1_OVER_8);
+  ae_int32x2 mask_6fs = SW_MOVDA32(MASK);
+  ae_int32x2 q_1_by_4 = SW_MOVDA32(ONE_QUATER_Q26);
+  ae_int32x2 ONE = SW_MOVDA32(1);
+  ae_int32x2 d_max = SW_MOVDA32(row_max);
+  ae_int32x2 diff_min = SW_MOVDA32(p_params->diffmin);
+  ae_int32x2 w_max = SW_MOVDA32(32767);
+  ae_int32x2 d_sum = z;
+  WORD32 i, sum;
+
+  for(i = 0; i < (n >> 2); i++)
+  {
+    ae_int16x4 d_s, d_w;
+    ae_int32x2 d_0, d_1, x_0, x_1, e_0, e_1;
+    xtbool2 b_0, b_1;
+
+    AE_LA16X4_IP(d_s, a_s, p_s);
+    AE_MUL16X4(d_0, d_1, d_s, AE_MOVDA16(1));
+    d_0 = AE_SUB32(d_0, d_max);
+    d_1 = AE_SUB32(d_1, d_max);
+    b_0 = AE_LE32(diff_min, d_0);
+    b_1 = AE_LE32(diff_min, d_1);
+
+    MPY_BY_QUANT_MULT_GT_ONE_X2X2_OUT32(x_0, x_1, d_0, d_1, input_beta_multiplier, input_beta_left_shift)
+    EXP_Q26X2(e_0, e_1, x_0, x_1);
+    AE_MOVF32X2(e_0, z, b_0);
+    AE_MOVF32X2(e_1, z, b_1);
+
+    /* Q0.31 to Q15 */
+    e_0 = AE_MIN32(AE_SRAI32R(e_0, 16), w_max);
+    e_1 = AE_MIN32(AE_SRAI32R(e_1, 16), w_max);
+    d_sum = AE_ADD32(d_sum, AE_ADD32(e_0, e_1));
+    d_w = AE_SAT16X4(e_0, e_1);
+    AE_SA16X4_IP(d_w, a_o, p_o);
+  }
+  AE_SA64POS_FP(a_o, p_o);
+
+  sum = AE_MOVAD32_H(d_sum) + AE_MOVAD32_L(d_sum);
+  for(i = i << 2; i < n; i++)
+  {
+    p_w[i] = (WORD16)attn_weight(p_row[i] - row_max, p_params);
+    sum += p_w[i];
+  }
+  return sum;
+}
+
+/* Scales the running sum and weighted V of one row by a Q15 weight */
+static void attn_rescale_row(WORD64 *p_sum, WORD64 *p_acc, WORD32 head_dim, WORD32 scale)
+{
+  WORD32 dd;
+  *p_sum = (*p_sum * scale + (1 << 14)) >> 15;
+  for(dd = 0; dd < head_dim; dd++)
+  {
+    p_acc[dd] = (p_acc[dd] * scale + (1 << 14)) >> 15;
+  }
+}
+
+/* Weighted V / sum in Q(frac_bits), requantized with out_multiplier and
+ * out_shift, without the output zero bias */
+static WORD32 attn_requant(WORD64 acc, WORD64 sum, WORD32 frac_bits, WORD32 out_multiplier, WORD32 out_shift)
+{
+  WORD64 num = acc * ((WORD64)1 << frac_bits);
+  WORD64 ratio = (num >= 0 ? num + (sum >> 1) : num - (sum >> 1)) / sum;
+  WORD32 shift = out_shift - frac_bits;
+  WORD32 left_shift = shift > 0 ? shift : 0;
+  WORD32 right_shift = shift > 0 ? 0 : -shift;
+  WORD32 x = attn_sat32(ratio << left_shift);
+  x = attn_srdhm(x, out_multiplier);
+  return right_shift > 31 ? 0 : attn_rdbpot(x, right_shift);
+}
+
+static WORD32 attn_check_params(
+    WORD32 num_heads,
+    WORD32 num_kv_heads,
+    WORD32 q_len,
+    WORD32 kv_len,
+    WORD32 head_dim,
+    const xa_nn_attention_params_t *p_params)
+{
+  XA_NNLIB_ARG_CHK_COND((num_heads <= 0 || num_kv_heads <= 0), -1);
+  XA_NNLIB_ARG_CHK_COND((num_heads % num_kv_heads != 0), -1);
+  XA_NNLIB_ARG_CHK_COND((q_len <= 0 || kv_len <= 0 || head_dim <= 0), -1);
+  XA_NNLIB_ARG_CHK_COND((p_params->block_size <= 0), -1);
+  XA_NNLIB_ARG_CHK_COND((p_params->causal != 0 && p_params->causal != 1), -1);
+  XA_NNLIB_ARG_CHK_COND((p_params->input_beta_left_shift < 0 || p_params->input_beta_left_shift > 31), -1);
+  XA_NNLIB_ARG_CHK_COND((p_params->input_beta_multiplier < 0), -1);
+  XA_NNLIB_ARG_CHK_COND((p_params->diffmin > 0), -1);
+  XA_NNLIB_ARG_CHK_COND((p_params->score_shift < -31 || p_params->score_shift > 31), -1);
+  XA_NNLIB_ARG_CHK_COND((p_params->out_shift < -31 || p_params->out_shift > 31), -1);
+  return 0;
+}
+
+/* Adds the weights p_w[0..n) times the first n columns of the transposed V
+ * run p_vt to p_acc, in int32 per ATTN_PV_COLS_ASYM8S keys */
+static WORD32 attn_pv_asym8s(
+    const attn_scratch_t *p_s,
+    WORD64 *p_acc,
+    const WORD8 *p_vt,
+    WORD16 *p_w,
+    WORD32 n,
+    WORD32 row_stride,
+    WORD32 head_dim)
+{
+  WORD32 *p_pv = (WORD32 *)p_s->p_pv;
+  WORD32 c0, dd, ret;
+
+  for(c0 = 0; c0 < n; c0 += ATTN_PV_COLS_ASYM8S)
+  {
+    ret = xa_nn_matXvec_8x16_32(p_pv, (WORD8 *)&p_vt[c0], NULL, &p_w[c0], NULL, p_s->p_zero,
+              head_dim, XT_MIN(ATTN_PV_COLS_ASYM8S, n - c0), 0, row_stride, 0, 0, 0);
+    if(ret < 0)
+      return ret;
+    for(dd = 0; dd < head_dim; dd++)
+    {
+      p_acc[dd] += p_pv[dd];
+    }
+  }
+  return 0;
+}
+
+/* Folds key block [j0, j0 + nb) into the running max / sum / weighted V of
+ * nq query rows, row r sees the first XT_MIN(nb, n_diag + r) keys and its
+ * scores are at p_scores[r * block]. The transposed V columns of the block
+ * are p_vt[0..nb - n_wrap) followed by p_vt_wrap[0..n_wrap), each a run of
+ * head_dim rows vt_stride / wrap_stride apart, n_wrap is only non-zero for a
+ * kv cache block across the end of the ring. P.V is a matXvec of each run
+ * with the weights. */
+static WORD32 attn_fold_block_asym8s(
+    const attn_scratch_t *p_s,
+    const WORD8 *p_vt,
+    WORD32 vt_stride,
+    const WORD8 *p_vt_wrap,
+    WORD32 wrap_stride,
+    WORD32 nq,
+    WORD32 nb,
+    WORD32 n_wrap,
+    WORD32 n_diag,
+    WORD32 head_dim,
+    const xa_nn_attention_params_t *p_params)
+{
+  WORD32 block = p_params->block_size;
+  WORD32 n_a = nb - n_wrap;
+  WORD32 r, j, dd, ret;
+
+  for(r = 0; r < nq; r++)
+  {
+    const WORD8 *p_row = &((const WORD8 *)p_s->p_scores)[r * block];
+    WORD64 *p_acc_r = &p_s->p_acc[r * head_dim];
+    WORD32 n_valid = XT_MIN(nb, n_diag + r);
+    WORD32 blk_max = -129;
+    WORD32 blk_sum = 0;
+
+    if(n_valid <= 0)
+      continue;
+
+    for(j = 0; j < n_valid; j++)
+    {
+      blk_max = XT_MAX(blk_max, p_row[j]);
+    }
+
+    /* Online softmax: move the row to the new max */
+    if(blk_max > p_s->p_max[r])
+    {
+      if(p_s->p_max[r] > -129)
+      {
+        attn_rescale_row(&p_s->p_sum[r], p_acc_r, head_dim, p_s->p_lut[blk_max - p_s->p_max[r]]);
+      }
+      p_s->p_max[r] = blk_max;
+    }
+
+    for(j = 0; j < n_valid; j++)
+    {
+      p_s->p_w[j] = (WORD16)p_s->p_lut[p_s->p_max[r] - p_row[j]];
+      blk_sum += p_s->p_w[j];
+    }
+    p_s->p_sum[r] += blk_sum;
+
+    /* The V zero bias adds v_zero_bias times the weight sum */
+    for(dd = 0; dd < head_dim; dd++)
+    {
+      p_acc_r[dd] += (WORD64)blk_sum * p_params->v_zero_bias;
+    }
+    ret = attn_pv_asym8s(p_s, p_acc_r, p_vt, p_s->p_w, XT_MIN(n_valid, n_a), vt_stride, head_dim);
+    if(ret == 0 && n_valid > n_a)
+    {
+      ret = attn_pv_asym8s(p_s, p_acc_r, p_vt_wrap, &p_s->p_w[n_a], n_valid - n_a, wrap_stride, head_dim);
+    }
+    if(ret < 0)
+      return ret;
+  }
+  return 0;
+}
+
+/* As attn_pv_asym8s, 16-bit weights times 16-bit V need the 64-bit matXvec */
+static WORD32 attn_pv_sym16s(
+    const attn_scratch_t *p_s,
+    WORD64 *p_acc,
+    const WORD16 *p_vt,
+    WORD16 *p_w,
+    WORD32 n,
+    WORD32 row_stride,
+    WORD32 head_dim)
+{
+  WORD64 *p_pv = (WORD64 *)p_s->p_pv;
+  WORD32 dd, ret;
+
+  ret = xa_nn_matXvec_16x16_64(p_pv, (WORD16 *)p_vt, NULL, p_w, NULL, p_s->p_zero,
+            head_dim, n, 0, row_stride, 0, 0, 0);
+  if(ret < 0)
+    return ret;
+  for(dd = 0; dd < head_dim; dd++)
+  {
+    p_acc[dd] += p_pv[dd];
+  }
+  return 0;
+}
+
+/* As attn_fold_block_asym8s */
+static WORD32 attn_fold_block_sym16s(
+    const attn_scratch_t *p_s,
+    const WORD16 *p_vt,
+    WORD32 vt_stride,
+    const WORD16 *p_vt_wrap,
+    WORD32 wrap_stride,
+    WORD32 nq,
+    WORD32 nb,
+    WORD32 n_wrap,
+    WORD32 n_diag,
+    WORD32 head_dim,
+    const xa_nn_attention_params_t *p_params)
+{
+  WORD32 block = p_params->block_size;
+  WORD32 n_a = nb - n_wrap;
+  WORD32 r, j, ret;
+
+  for(r = 0; r < nq; r++)
+  {
+    const WORD16 *p_row = &((const WORD16 *)p_s->p_scores)[r * block];
+    WORD64 *p_acc_r = &p_s->p_acc[r * head_dim];
+    WORD32 n_valid = XT_MIN(nb, n_diag + r);
+    WORD32 blk_max = -32769;
+
+    if(n_valid <= 0)
+      continue;
+
+    for(j = 0; j < n_valid; j++)
+    {
+      blk_max = XT_MAX(blk_max, p_row[j]);
+    }
+
+    /* 16-bit score differences are too wide for a table, the rescale
+     * weight is computed on its own */
+    if(blk_max > p_s->p_max[r])
+    {
+      if(p_s->p_max[r] > -32769)
+      {
+        attn_rescale_row(&p_s->p_sum[r], p_acc_r, head_dim, attn_weight(p_s->p_max[r] - blk_max, p_params));
+      }
+      p_s->p_max[r] = blk_max;
+    }
+
+    p_s->p_sum[r] += attn_weights_sym16s(p_s->p_w, p_row, n_valid, p_s->p_max[r], p_params);
+
+    ret = attn_pv_sym16s(p_s, p_acc_r, p_vt, p_s->p_w, XT_MIN(n_valid, n_a), vt_stride, head_dim);
+    if(ret == 0 && n_valid > n_a)
+    {
+      ret = attn_pv_sym16s(p_s, p_acc_r, p_vt_wrap, &p_s->p_w[n_a], n_valid - n_a, wrap_stride, head_dim);
+    }
+    if(ret < 0)
+      return ret;
+  }
+  return 0;
+}
+
+WORD32 xa_nn_attention_asym8s(
+    WORD8 * __restrict__ p_out,
+    const WORD8 * __restrict__ p_q,
+    const WORD8 * __restrict__ p_k,
+    const WORD8 * __restrict__ p_v,
+    WORD32 num_heads,
+    WORD32 num_kv_heads,
+    WORD32 q_len,
+    WORD32 kv_len,
+    WORD32 head_dim,
+    const xa_nn_attention_params_t *p_params,
+    VOID *p_scratch)
+{
+  /* NULL pointer checks */
+  XA_NNLIB_ARG_CHK_PTR(p_out, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_q, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_k, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_v, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_params, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_scratch, -1);
+  /* Basic Parameter checks */
+  XA_NNLIB_ARG_CHK_COND(attn_check_params(num_heads, num_kv_heads, q_len, kv_len, head_dim, p_params), -1);
+  XA_NNLIB_ARG_CHK_COND((p_params->q_zero_bias < -127 || p_params->q_zero_bias > 128), -1);
+  XA_NNLIB_ARG_CHK_COND((p_params->k_zero_bias < -127 || p_params->k_zero_bias > 128), -1);
+  XA_NNLIB_ARG_CHK_COND((p_params->v_zero_bias < -127 || p_params->v_zero_bias > 128), -1);
+  XA_NNLIB_ARG_CHK_COND((p_params->score_zero_bias < -128 || p_params->score_zero_bias > 127), -1);
+  XA_NNLIB_ARG_CHK_COND((p_params->out_zero_bias < -128 || p_params->out_zero_bias > 127), -1);
+
+  WORD32 block = p_params->block_size;
+  WORD32 heads_per_kv = num_heads / num_kv_heads;
+  WORD32 causal_off = kv_len - q_len;
+  WORD32 h, i0, j0, r, j, dd;
+  WORD32 ret;
+  attn_scratch_t s;
+
+  attn_scratch_init(&s, p_scratch, head_dim, block, sizeof(WORD8));
+
+  /* Score differences of two int8 values fit the table */
+  for(j = 0; j < ATTN_LUT_SIZE; j++)
+  {
+    s.p_lut[j] = attn_weight(-j, p_params);
+  }
+
+  for(h = 0; h < num_heads; h++)
+  {
+    const WORD8 *p_q_h = &p_q[h * q_len * head_dim];
+    const WORD8 *p_k_h = &p_k[(h / heads_per_kv) * kv_len * head_dim];
+    const WORD8 *p_vt_h = &p_v[(h / heads_per_kv) * head_dim * kv_len];
+    WORD8 *p_out_h = &p_out[h * q_len * head_dim];
+
+    for(i0 = 0; i0 < q_len; i0 += block)
+    {
+      WORD32 nq = XT_MIN(block, q_len - i0);
+      WORD32 kv_end = p_params->causal ? XT_MIN(kv_len, i0 + nq + causal_off) : kv_len;
+
+      for(r = 0; r < nq; r++)
+      {
+        s.p_max[r] = -129;
+        s.p_sum[r] = 0;
+      }
+      memset(s.p_acc, 0, nq * head_dim * sizeof(WORD64));
+
+      for(j0 = 0; j0 < kv_end; j0 += block)
+      {
+        WORD32 nb = XT_MIN(block, kv_end - j0);
+
+        /* Scores of the query tile against this key block, row r at p_scores[r * block] */
+        ret = xa_nn_matmul_asym8sxasym8s_asym8s((WORD8 *)s.p_scores, &p_k_h[j0 * head_dim], &p_q_h[i0 * head_dim], NULL,
+                  nb, head_dim, head_dim, nq, head_dim, block, 1,
+                  p_params->k_zero_bias, p_params->q_zero_bias,
+                  p_params->score_multiplier, p_params->score_shift, p_params->score_zero_bias);
+        if(ret < 0)
+          return ret;
+
+        ret = attn_fold_block_asym8s(&s, &p_vt_h[j0], kv_len, NULL, 0, nq, nb, 0,
+                  p_params->causal ? i0 + causal_off + 1 - j0 : nb, head_dim, p_params);
+        if(ret < 0)
+          return ret;
+      }
+
+      for(r = 0; r < nq; r++)
+      {
+        WORD8 *p_out_r = &p_out_h[(i0 + r) * head_dim];
+        for(dd = 0; dd < head_dim; dd++)
+        {
+          WORD32 out = s.p_sum[r] > 0 ? attn_requant(s.p_acc[r * head_dim + dd], s.p_sum[r], ATTN_FRAC_BITS_ASYM8S, p_params->out_multiplier, p_params->out_shift) : 0;
+          out += p_params->out_zero_bias;
+          p_out_r[dd] = (WORD8)XT_MAX(-128, XT_MIN(127, out));
+        }
+      }
+    }
+  }
+
+  return 0;
+}
+
+WORD32 xa_nn_attention_sym16s(
+    WORD16 * __restrict__ p_out,
+    const WORD16 * __restrict__ p_q,
+    const WORD16 * __restrict__ p_k,
+    const WORD16 * __restrict__ p_v,
+    WORD32 num_heads,
+    WORD32 num_kv_heads,
+    WORD32 q_len,
+    WORD32 kv_len,
+    WORD32 head_dim,
+    const xa_nn_attention_params_t *p_params,
+    VOID *p_scratch)
+{
+  /* NULL pointer checks */
+  XA_NNLIB_ARG_CHK_PTR(p_out, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_q, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_k, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_v, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_params, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_scratch, -1);
+  /* Pointer alignment checks */
+  XA_NNLIB_ARG_CHK_ALIGN(p_out, sizeof(WORD16), -1);
+  XA_NNLIB_ARG_CHK_ALIGN(p_q, sizeof(WORD16), -1);
+  XA_NNLIB_ARG_CHK_ALIGN(p_k, sizeof(WORD16), -1);
+  XA_NNLIB_ARG_CHK_ALIGN(p_v, sizeof(WORD16), -1);
+  /* Basic Parameter checks */
+  XA_NNLIB_ARG_CHK_COND(attn_check_params(num_heads, num_kv_heads, q_len, kv_len, head_dim, p_params), -1);
+  XA_NNLIB_ARG_CHK_COND((p_params->q_zero_bias != 0 || p_params->k_zero_bias != 0 || p_params->v_zero_bias != 0), -1);
+  XA_NNLIB_ARG_CHK_COND((p_params->score_zero_bias != 0 || p_params->out_zero_bias != 0), -1);
+
+  WORD32 block = p_params->block_size;
+  WORD32 heads_per_kv = num_heads / num_kv_heads;
+  WORD32 causal_off = kv_len - q_len;
+  WORD32 h, i0, j0, r, dd;
+  WORD32 ret;
+  attn_scratch_t s;
+
+  attn_scratch_init(&s, p_scratch, head_dim, block, sizeof(WORD16));
+
+  for(h = 0; h < num_heads; h++)
+  {
+    const WORD16 *p_q_h = &p_q[h * q_len * head_dim];
+    const WORD16 *p_k_h = &p_k[(h / heads_per_kv) * kv_len * head_dim];
+    const WORD16 *p_vt_h = &p_v[(h / heads_per_kv) * head_dim * kv_len];
+    WORD16 *p_out_h = &p_out[h * q_len * head_dim];
+
+    for(i0 = 0; i0 < q_len; i0 += block)
+    {
+      WORD32 nq = XT_MIN(block, q_len - i0);
+      WORD32 kv_end = p_params->causal ? XT_MIN(kv_len, i0 + nq + causal_off) : kv_len;
+
+      for(r = 0; r < nq; r++)
+      {
+        s.p_max[r] = -32769;
+        s.p_sum[r] = 0;
+      }
+      memset(s.p_acc, 0, nq * head_dim * sizeof(WORD64));
+
+      for(j0 = 0; j0 < kv_end; j0 += block)
+      {
+        WORD32 nb = XT_MIN(block, kv_end - j0);
+
+        ret = xa_nn_matmul_sym16sxsym16s_sym16s((WORD16 *)s.p_scores, &p_k_h[j0 * head_dim], &p_q_h[i0 * head_dim], NULL,
+                  nb, head_dim, head_dim, nq, head_dim, block, 1,
+                  0, 0, p_params->score_multiplier, p_params->score_shift, 0);
+        if(ret < 0)
+          return ret;
+
+        ret = attn_fold_block_sym16s(&s, &p_vt_h[j0], kv_len, NULL, 0, nq, nb, 0,
+                  p_params->causal ? i0 + causal_off + 1 - j0 : nb, head_dim, p_params);
+        if(ret < 0)
+          return ret;
+      }
+
+      for(r = 0; r < nq; r++)
+      {
+        WORD16 *p_out_r = &p_out_h[(i0 + r) * head_dim];
+        for(dd = 0; dd < head_dim; dd++)
+        {
+          WORD32 out = s.p_sum[r] > 0 ? attn_requant(s.p_acc[r * head_dim + dd], s.p_sum[r], ATTN_FRAC_BITS_SYM16S, p_params->out_multiplier, p_params->out_shift) : 0;
+          p_out_r[dd] = (WORD16)XT_MAX(-32768, XT_MIN(32767, out));
+        }
+      }
+    }
+  }
+
+  return 0;
+}
+
+static WORD32 kv_cache_check(const xa_nn_kv_cache_t *p_cache)
+{
+  XA_NNLIB_ARG_CHK_PTR(p_cache->p_k, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_cache->p_v, -1);
+  XA_NNLIB_ARG_CHK_COND((p_cache->num_kv_heads <= 0 || p_cache->capacity <= 0 || p_cache->head_dim <= 0), -1);
+  XA_NNLIB_ARG_CHK_COND((p_cache->start < 0 || p_cache->start >= p_cache->capacity), -1);
+  XA_NNLIB_ARG_CHK_COND((p_cache->len < 0 || p_cache->len > p_cache->capacity), -1);
+  return 0;
+}
+
+/* Copies each new step into the slot after the newest one, the oldest step
+ * is dropped once the cache is full. V is stored transposed so that P.V
+ * reads the cache in place */
+static VOID kv_cache_append(xa_nn_kv_cache_t *p_cache,
+    const WORD8 *p_k,
+    const WORD8 *p_v,
+    WORD32 num_tokens,
+    WORD32 elm_size)
+{
+  WORD32 cap = p_cache->capacity;
+  WORD32 head_dim = p_cache->head_dim;
+  WORD32 row_bytes = head_dim * elm_size;
+  WORD8 *p_ck = (WORD8 *)p_cache->p_k;
+  WORD8 *p_cv = (WORD8 *)p_cache->p_v;
+  WORD32 t, h, d, slot;
+
+  for(t = 0; t < num_tokens; t++)
+  {
+    slot = p_cache->start + p_cache->len;
+    slot = slot >= cap ? slot - cap : slot;
+    for(h = 0; h < p_cache->num_kv_heads; h++)
+    {
+      WORD32 src = (t * p_cache->num_kv_heads + h) * row_bytes;
+      WORD32 dst = (h * cap + slot) * row_bytes;
+      memcpy(&p_ck[dst], &p_k[src], row_bytes);
+      if(elm_size == sizeof(WORD16))
+      {
+        for(d = 0; d < head_dim; d++)
+          ((WORD16 *)p_cv)[(h * head_dim + d) * cap + slot] = ((const WORD16 *)&p_v[src])[d];
+      }
+      else
+      {
+        for(d = 0; d < head_dim; d++)
+          p_cv[(h * head_dim + d) * cap + slot] = p_v[src + d];
+      }
+    }
+    if(p_cache->len < cap)
+      p_cache->len++;
+    else
+      p_cache->start = p_cache->start + 1 == cap ? 0 : p_cache->start + 1;
+  }
+}
+
+WORD32 xa_nn_kv_cache_append_asym8s(
+    xa_nn_kv_cache_t *p_cache,
+    const WORD8 * __restrict__ p_k,
+    const WORD8 * __restrict__ p_v,
+    WORD32 num_tokens)
+{
+  /* NULL pointer checks */
+  XA_NNLIB_ARG_CHK_PTR(p_cache, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_k, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_v, -1);
+  /* Basic Parameter checks */
+  XA_NNLIB_ARG_CHK_COND(kv_cache_check(p_cache), -1);
+  XA_NNLIB_ARG_CHK_COND((num_tokens <= 0), -1);
+
+  kv_cache_append(p_cache, p_k, p_v, num_tokens, sizeof(WORD8));
+  return 0;
+}
+
+WORD32 xa_nn_kv_cache_append_sym16s(
+    xa_nn_kv_cache_t *p_cache,
+    const WORD16 * __restrict__ p_k,
+    const WORD16 * __restrict__ p_v,
+    WORD32 num_tokens)
+{
+  /* NULL pointer checks */
+  XA_NNLIB_ARG_CHK_PTR(p_cache, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_k, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_v, -1);
+  /* Pointer alignment checks */
+  XA_NNLIB_ARG_CHK_ALIGN(p_k, sizeof(WORD16), -1);
+  XA_NNLIB_ARG_CHK_ALIGN(p_v, sizeof(WORD16), -1);
+  XA_NNLIB_ARG_CHK_ALIGN(p_cache->p_k, sizeof(WORD16), -1);
+  XA_NNLIB_ARG_CHK_ALIGN(p_cache->p_v, sizeof(WORD16), -1);
+  /* Basic Parameter checks */
+  XA_NNLIB_ARG_CHK_COND(kv_cache_check(p_cache), -1);
+  XA_NNLIB_ARG_CHK_COND((num_tokens <= 0), -1);
+
+  kv_cache_append(p_cache, (const WORD8 *)p_k, (const WORD8 *)p_v, num_tokens, sizeof(WORD16));
+  return 0;
+}
+
+/* One query against the len cached steps of one kv head, p_k_h / p_vt_h point
+ * to slot 0 of its ring, p_vt_h has head_dim rows of capacity slots. Steps [0, n0) are at slots start.., steps [n0, len)
+ * at slots 0... The blocks are those of the linearized cache, as in
+ * xa_nn_attention_*, a block across the end of the ring is read as two
+ * runs. */
+static WORD32 kv_attend_asym8s(
+    const WORD8 *p_q_h,
+    const WORD8 *p_k_h,
+    const WORD8 *p_vt_h,
+    WORD32 cap,
+    WORD32 start,
+    WORD32 n0,
+    WORD32 len,
+    WORD32 head_dim,
+    const xa_nn_attention_params_t *p_params,
+    const attn_scratch_t *p_s)
+{
+  WORD32 block = p_params->block_size;
+  WORD32 j0, ret;
+
+  for(j0 = 0; j0 < len; j0 += block)
+  {
+    WORD32 nb = XT_MIN(block, len - j0);
+    WORD32 slot = j0 < n0 ? start + j0 : j0 - n0;
+    WORD32 n_wrap = j0 < n0 ? XT_MAX(0, j0 + nb - n0) : 0;
+
+    ret = xa_nn_matmul_asym8sxasym8s_asym8s((WORD8 *)p_s->p_scores, &p_k_h[slot * head_dim], p_q_h, NULL,
+              nb - n_wrap, head_dim, head_dim, 1, head_dim, block, 1,
+              p_params->k_zero_bias, p_params->q_zero_bias,
+              p_params->score_multiplier, p_params->score_shift, p_params->score_zero_bias);
+    if(ret == 0 && n_wrap > 0)
+    {
+      ret = xa_nn_matmul_asym8sxasym8s_asym8s(&((WORD8 *)p_s->p_scores)[nb - n_wrap], p_k_h, p_q_h, NULL,
+                n_wrap, head_dim, head_dim, 1, head_dim, block, 1,
+                p_params->k_zero_bias, p_params->q_zero_bias,
+                p_params->score_multiplier, p_params->score_shift, p_params->score_zero_bias);
+    }
+    if(ret < 0)
+      return ret;
+
+    ret = attn_fold_block_asym8s(p_s, &p_vt_h[slot], cap, p_vt_h, cap, 1, nb, n_wrap, nb, head_dim, p_params);
+    if(ret < 0)
+      return ret;
+  }
+  return 0;
+}
+
+static WORD32 kv_attend_sym16s(
+    const WORD16 *p_q_h,
+    const WORD16 *p_k_h,
+    const WORD16 *p_vt_h,
+    WORD32 cap,
+    WORD32 start,
+    WORD32 n0,
+    WORD32 len,
+    WORD32 head_dim,
+    const xa_nn_attention_params_t *p_params,
+    const attn_scratch_t *p_s)
+{
+  WORD32 block = p_params->block_size;
+  WORD32 j0, ret;
+
+  for(j0 = 0; j0 < len; j0 += block)
+  {
+    WORD32 nb = XT_MIN(block, len - j0);
+    WORD32 slot = j0 < n0 ? start + j0 : j0 - n0;
+    WORD32 n_wrap = j0 < n0 ? XT_MAX(0, j0 + nb - n0) : 0;
+
+    ret = xa_nn_matmul_sym16sxsym16s_sym16s((WORD16 *)p_s->p_scores, &p_k_h[slot * head_dim], p_q_h, NULL,
+              nb - n_wrap, head_dim, head_dim, 1, head_dim, block, 1,
+              0, 0, p_params->score_multiplier, p_params->score_shift, 0);
+    if(ret == 0 && n_wrap > 0)
+    {
+      ret = xa_nn_matmul_sym16sxsym16s_sym16s(&((WORD16 *)p_s->p_scores)[nb - n_wrap], p_k_h, p_q_h, NULL,
+                n_wrap, head_dim, head_dim, 1, head_dim, block, 1,
+                0, 0, p_params->score_multiplier, p_params->score_shift, 0);
+    }
+    if(ret < 0)
+      return ret;
+
+    ret = attn_fold_block_sym16s(p_s, &p_vt_h[slot], cap, p_vt_h, cap, 1, nb, n_wrap, nb, head_dim, p_params);
+    if(ret < 0)
+      return ret;
+  }
+  return 0;
+}
+
+WORD32 xa_nn_kv_cache_attend_asym8s(
+    WORD8 * __restrict__ p_out,
+    const WORD8 * __restrict__ p_q,
+    const xa_nn_kv_cache_t *p_cache,
+    WORD32 num_heads,
+    const xa_nn_attention_params_t *p_params,
+    VOID *p_scratch)
+{
+  /* NULL pointer checks */
+  XA_NNLIB_ARG_CHK_PTR(p_out, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_q, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_cache, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_params, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_scratch, -1);
+  /* Basic Parameter checks */
+  XA_NNLIB_ARG_CHK_COND(kv_cache_check(p_cache), -1);
+  XA_NNLIB_ARG_CHK_COND((p_cache->len <= 0), -1);
+  XA_NNLIB_ARG_CHK_COND(attn_check_params(num_heads, p_cache->num_kv_heads, 1, p_cache->len, p_cache->head_dim, p_params), -1);
+  XA_NNLIB_ARG_CHK_COND((p_params->q_zero_bias < -127 || p_params->q_zero_bias > 128), -1);
+  XA_NNLIB_ARG_CHK_COND((p_params->k_zero_bias < -127 || p_params->k_zero_bias > 128), -1);
+  XA_NNLIB_ARG_CHK_COND((p_params->v_zero_bias < -127 || p_params->v_zero_bias > 128), -1);
+  XA_NNLIB_ARG_CHK_COND((p_params->score_zero_bias < -128 || p_params->score_zero_bias > 127), -1);
+  XA_NNLIB_ARG_CHK_COND((p_params->out_zero_bias < -128 || p_params->out_zero_bias > 127), -1);
+
+  WORD32 block = p_params->block_size;
+  WORD32 head_dim = p_cache->head_dim;
+  WORD32 cap = p_cache->capacity;
+  WORD32 heads_per_kv = num_heads / p_cache->num_kv_heads;
+  /* Cached steps from start to the end of the buffer, then from slot 0 */
+  WORD32 n0 = XT_MIN(p_cache->len, cap - p_cache->start);
+  WORD32 h, j, dd, ret;
+  attn_scratch_t s;
+
+  attn_scratch_init(&s, p_scratch, head_dim, block, sizeof(WORD8));
+
+  for(j = 0; j < ATTN_LUT_SIZE; j++)
+  {
+    s.p_lut[j] = attn_weight(-j, p_params);
+  }
+
+  for(h = 0; h < num_heads; h++)
+  {
+    const WORD8 *p_q_h = &p_q[h * head_dim];
+    const WORD8 *p_k_h = &((const WORD8 *)p_cache->p_k)[(h / heads_per_kv) * cap * head_dim];
+    const WORD8 *p_vt_h = &((const WORD8 *)p_cache->p_v)[(h / heads_per_kv) * head_dim * cap];
+    WORD8 *p_out_h = &p_out[h * head_dim];
+
+    s.p_max[0] = -129;
+    s.p_sum[0] = 0;
+    memset(s.p_acc, 0, head_dim * sizeof(WORD64));
+
+    ret = kv_attend_asym8s(p_q_h, p_k_h, p_vt_h, cap, p_cache->start, n0, p_cache->len, head_dim, p_params, &s);
+    if(ret < 0)
+      return ret;
+
+    for(dd = 0; dd < head_dim; dd++)
+    {
+      WORD32 out = s.p_sum[0] > 0 ? attn_requant(s.p_acc[dd], s.p_sum[0], ATTN_FRAC_BITS_ASYM8S, p_params->out_multiplier, p_params->out_shift) : 0;
+      out += p_params->out_zero_bias;
+      p_out_h[dd] = (WORD8)XT_MAX(-128, XT_MIN(127, out));
+    }
+  }
+
+  return 0;
+}
+
+WORD32 xa_nn_kv_cache_attend_sym16s(
+    WORD16 * __restrict__ p_out,
+    const WORD16 * __restrict__ p_q,
+    const xa_nn_kv_cache_t *p_cache,
+    WORD32 num_heads,
+    const xa_nn_attention_params_t *p_params,
+    VOID *p_scratch)
+{
+  /* NULL pointer checks */
+  XA_NNLIB_ARG_CHK_PTR(p_out, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_q, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_cache, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_params, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_scratch, -1);
+  /* Pointer alignment checks */
+  XA_NNLIB_ARG_CHK_ALIGN(p_out, sizeof(WORD16), -1);
+  XA_NNLIB_ARG_CHK_ALIGN(p_q, sizeof(WORD16), -1);
+  /* Basic Parameter checks */
+  XA_NNLIB_ARG_CHK_COND(kv_cache_check(p_cache), -1);
+  XA_NNLIB_ARG_CHK_ALIGN(p_cache->p_k, sizeof(WORD16), -1);
+  XA_NNLIB_ARG_CHK_ALIGN(p_cache->p_v, sizeof(WORD16), -1);
+  XA_NNLIB_ARG_CHK_COND((p_cache->len <= 0), -1);
+  XA_NNLIB_ARG_CHK_COND(attn_check_params(num_heads, p_cache->num_kv_heads, 1, p_cache->len, p_cache->head_dim, p_params), -1);
+  XA_NNLIB_ARG_CHK_COND((p_params->q_zero_bias != 0 || p_params->k_zero_bias != 0 || p_params->v_zero_bias != 0), -1);
+  XA_NNLIB_ARG_CHK_COND((p_params->score_zero_bias != 0 || p_params->out_zero_bias != 0), -1);
+
+  WORD32 block = p_params->block_size;
+  WORD32 head_dim = p_cache->head_dim;
+  WORD32 cap = p_cache->capacity;
+  WORD32 heads_per_kv = num_heads / p_cache->num_kv_heads;
+  WORD32 n0 = XT_MIN(p_cache->len, cap - p_cache->start);
+  WORD32 h, dd, ret;
+  attn_scratch_t s;
+
+  attn_scratch_init(&s, p_scratch, head_dim, block, sizeof(WORD16));
+
+  for(h = 0; h < num_heads; h++)
+  {
+    const WORD16 *p_q_h = &p_q[h * head_dim];
+    const WORD16 *p_k_h = &((const WORD16 *)p_cache->p_k)[(h / heads_per_kv) * cap * head_dim];
+    const WORD16 *p_vt_h = &((const WORD16 *)p_cache->p_v)[(h / heads_per_kv) * head_dim * cap];
+    WORD16 *p_out_h = &p_out[h * head_dim];
+
+    s.p_max[0] = -32769;
+    s.p_sum[0] = 0;
+    memset(s.p_acc, 0, head_dim * sizeof(WORD64));
+
+    ret = kv_attend_sym16s(p_q_h, p_k_h, p_vt_h, cap, p_cache->start, n0, p_cache->len, head_dim, p_params, &s);
+    if(ret < 0)
+      return ret;
+
+    for(dd = 0; dd < head_dim; dd++)
+    {
+      WORD32 out = s.p_sum[0] > 0 ? attn_requant(s.p_acc[dd], s.p_sum[0], ATTN_FRAC_BITS_SYM16S, p_params->out_multiplier, p_params->out_shift) : 0;
+      p_out_h[dd] = (WORD16)XT_MAX(-32768, XT_MIN(32767, out));
+    }
+  }
+
+  return 0;
+}
+#endif /* #ifndef ENABLE_SCRATCH_SIZE_API_ONLY */
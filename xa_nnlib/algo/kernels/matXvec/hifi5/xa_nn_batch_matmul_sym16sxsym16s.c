@@ -779,7 +779,8 @@ WORD32 xa_nn_matmul_mat1_trans_sym16sxsym16s_sym16s(
   return 0;
 }
 
-WORD32 xa_nn_batch_matmul_sym16sxsym16s_sym16s(
+/* p_rope, if not NULL, is applied to each output block once it is computed */
+static WORD32 batch_matmul_sym16s_core(
     WORD16 * __restrict__ p_out,
     const WORD32 *const p_out_shape,
     const WORD16 * __restrict__ p_mat1,
@@ -793,6 +794,7 @@ WORD32 xa_nn_batch_matmul_sym16sxsym16s_sym16s(
     WORD32 out_multiplier,
     WORD32 out_shift,
     WORD32 out_zero_bias,
+    const xa_nn_rope_cfg_t *p_rope,
     VOID   *p_scratch)
 {
   /* NULL pointer checks */
@@ -884,6 +886,10 @@ WORD32 xa_nn_batch_matmul_sym16sxsym16s_sym16s(
   mat2_ext1 = p_mat2_shape[1] == 1 ? 0 : p_mat2_shape[2] * p_mat2_shape[3] * p_mat2_shape[4];
   mat2_ext2 = p_mat2_shape[2] == 1 ? 0 : p_mat2_shape[3] * p_mat2_shape[4];
 
+  WORD32 out_rows, out_cols;
+  out_rows = mat2_transpose ? p_mat2_shape[4] : p_mat2_shape[3];
+  out_cols = mat1_transpose ? p_mat1_shape[4] : p_mat1_shape[3];
+
   WORD32 b0, b1, b2;
   for(b0 = 0; b0 < p_out_shape[0]; b0++)
   {
@@ -952,8 +958,105 @@ WORD32 xa_nn_batch_matmul_sym16sxsym16s_sym16s(
         }
         if(ret != 0)
           return -1;
+        if(p_rope != NULL)
+        {
+          WORD16 *ptr_out = p_out + ((b0 * p_out_shape[1] + b1) * p_out_shape[2] + b2) * out_rows * out_cols;
+          ret = xa_nn_rope_sym16s_sym16s(ptr_out,
+                                         ptr_out,
+                                         p_rope->p_cos,
+                                         p_rope->p_sin,
+                                         1,
+                                         out_rows,
+                                         out_cols,
+                                         p_rope->pos_offset,
+                                         p_rope->interleaved);
+          if(ret != 0)
+            return -1;
+        }
       }
     }
   }
   return 0;
 }
+
+WORD32 xa_nn_batch_matmul_sym16sxsym16s_sym16s(
+    WORD16 * __restrict__ p_out,
+    const WORD32 *const p_out_shape,
+    const WORD16 * __restrict__ p_mat1,
+    const WORD32 *const p_mat1_shape,
+    const WORD16 * __restrict__ p_mat2,
+    const WORD32 *const p_mat2_shape,
+    WORD32 mat1_transpose,
+    WORD32 mat2_transpose,
+    WORD32 mat1_zero_bias,
+    WORD32 mat2_zero_bias,
+    WORD32 out_multiplier,
+    WORD32 out_shift,
+    WORD32 out_zero_bias,
+    VOID   *p_scratch)
+{
+  return batch_matmul_sym16s_core(p_out,
+                                  p_out_shape,
+                                  p_mat1,
+                                  p_mat1_shape,
+                                  p_mat2,
+                                  p_mat2_shape,
+                                  mat1_transpose,
+                                  mat2_transpose,
+                                  mat1_zero_bias,
+                                  mat2_zero_bias,
+                                  out_multiplier,
+                                  out_shift,
+                                  out_zero_bias,
+                                  NULL,
+                                  p_scratch);
+}
+
+WORD32 xa_nn_batch_matmul_rope_sym16sxsym16s_sym16s(
+    WORD16 * __restrict__ p_out,
+    const WORD32 *const p_out_shape,
+    const WORD16 * __restrict__ p_mat1,
+    const WORD32 *const p_mat1_shape,
+    const WORD16 * __restrict__ p_mat2,
+    const WORD32 *const p_mat2_shape,
+    WORD32 mat1_transpose,
+    WORD32 mat2_transpose,
+    WORD32 mat1_zero_bias,
+    WORD32 mat2_zero_bias,
+    WORD32 out_multiplier,
+    WORD32 out_shift,
+    WORD32 out_zero_bias,
+    const xa_nn_rope_cfg_t *p_rope,
+    VOID   *p_scratch)
+{
+  /* NULL pointer checks */
+  XA_NNLIB_ARG_CHK_PTR(p_rope, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_rope->p_cos, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_rope->p_sin, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_mat1_shape, -1);
+  /* Pointer alignment checks */
+  XA_NNLIB_ARG_CHK_ALIGN(p_rope->p_cos, sizeof(WORD16), -1);
+  XA_NNLIB_ARG_CHK_ALIGN(p_rope->p_sin, sizeof(WORD16), -1);
+  XA_NNLIB_ARG_CHK_ALIGN(p_mat1_shape, sizeof(WORD32), -1);
+  /* Basic Parameter checks */
+  XA_NNLIB_ARG_CHK_COND((mat1_transpose != 0 && mat1_transpose != 1), -1);
+  XA_NNLIB_ARG_CHK_COND((p_rope->pos_offset < 0), -1);
+  XA_NNLIB_ARG_CHK_COND((p_rope->interleaved != 0 && p_rope->interleaved != 1), -1);
+  XA_NNLIB_ARG_CHK_COND(((mat1_transpose ? p_mat1_shape[4] : p_mat1_shape[3]) & 1), -1);
+
+  return batch_matmul_sym16s_core(p_out,
+                                  p_out_shape,
+                                  p_mat1,
+                                  p_mat1_shape,
+                                  p_mat2,
+                                  p_mat2_shape,
+                                  mat1_transpose,
+                                  mat2_transpose,
+                                  mat1_zero_bias,
+                                  mat2_zero_bias,
+                                  out_multiplier,
+                                  out_shift,
+                                  out_zero_bias,
+                                  p_rope,
+                                  p_scratch);
+}
@@ -21,6 +21,7 @@
 ******************************************************************************/
 #include "xa_nnlib_common.h"
 #include "xa_nnlib_common_macros_hifi5.h"
+#include "xa_nnlib_common_dma.h"
 // Defining macros for HiFi5 RI.6 and HiFi5 RI.5(< RI.6) compatibility
 #ifndef AE_MULAZB8Q8X8 // HiFI5 RI.5 
 
@@ -542,6 +543,69 @@ static inline void _xa_nn_dot_product_1_rows_1_vecs_unaligned
   *out_1_0 = acc_row1_vec0;
 }
 
+/* Weight rows are fetched block by block into the local ping-pong buffers
+ * while the previous block is multiplied */
+static WORD32 xa_nn_matXvec_v2_dma_asym8sxasym8s_asym8s(
+    WORD8 * __restrict__ p_out,
+    const WORD8 * __restrict__ p_mat,
+    const WORD8 * __restrict__ p_vec,
+    const WORD32 * __restrict__ p_bias,
+    WORD32 rows,
+    WORD32 cols,
+    WORD32 row_stride,
+    WORD32 mat_zero_bias,
+    WORD32 vec_zero_bias,
+    WORD32 out_multiplier,
+    WORD32 out_shift,
+    WORD32 out_zero_bias,
+    WORD32 out_activation_min,
+    WORD32 out_activation_max,
+    WORD32 block_rows,
+    xa_dma_cfg_t *p_dma_cfg)
+{
+  int ret = 0, m_itr = 0, buf_idx = 0, dma_id;
+  int cur_rows = block_rows < rows ? block_rows : rows;
+
+  dma_id = xa_nn_dma_fetch(p_dma_cfg, buf_idx, p_mat, (cur_rows - 1) * row_stride + cols);
+  do
+  {
+    int next_itr = m_itr + cur_rows;
+    int next_rows = block_rows < rows - next_itr ? block_rows : rows - next_itr;
+    int next_dma_id = -1;
+    const WORD8 *p_mat_blk;
+
+    if(next_rows > 0)
+      next_dma_id = xa_nn_dma_fetch(p_dma_cfg, buf_idx ^ 1, &p_mat[next_itr * row_stride], (next_rows - 1) * row_stride + cols);
+
+    /* Read in place if the transfer could not be started */
+    p_mat_blk = dma_id >= 0 ? (const WORD8 *)p_dma_cfg->p_local_buf[buf_idx] : &p_mat[m_itr * row_stride];
+    xa_nn_dma_wait(p_dma_cfg, dma_id);
+    ret |= xa_nn_matXvec_v2_asym8sxasym8s_asym8s(&p_out[m_itr],
+                                                 p_mat_blk,
+                                                 p_vec,
+                                                 p_bias != NULL ? &p_bias[m_itr] : NULL,
+                                                 cur_rows,
+                                                 cols,
+                                                 row_stride,
+                                                 mat_zero_bias,
+                                                 vec_zero_bias,
+                                                 out_multiplier,
+                                                 out_shift,
+                                                 out_zero_bias,
+                                                 out_activation_min,
+                                                 out_activation_max,
+                                                 NULL);
+    m_itr = next_itr;
+    cur_rows = next_rows;
+    dma_id = next_dma_id;
+    buf_idx ^= 1;
+  } while(m_itr < rows);
+
+  if(ret < 0)
+    return -1;
+  return 0;
+}
+
 WORD32 xa_nn_matXvec_v2_asym8sxasym8s_asym8s(
     WORD8 * __restrict__ p_out,
     const WORD8 * __restrict__ p_mat,
@@ -576,6 +640,19 @@ WORD32 xa_nn_matXvec_v2_asym8sxasym8s_asym8s(
   XA_NNLIB_ARG_CHK_COND((mat_zero_bias < -127 || mat_zero_bias > 128), -1);
   XA_NNLIB_ARG_CHK_COND((out_shift < -31 || out_shift > 31), -1);
   XA_NNLIB_ARG_CHK_COND((out_zero_bias < -128 || out_zero_bias > 127), -1);
+
+  if(XA_NN_DMA_CFG_VALID(p_dma_cfg))
+  {
+    /* Output and bias of each block must stay 16 byte aligned */
+    int block_rows = xa_nn_dma_block_rows(p_dma_cfg, row_stride * sizeof(WORD8), 16, 16);
+    if(block_rows > 0 && block_rows < rows)
+    {
+      return xa_nn_matXvec_v2_dma_asym8sxasym8s_asym8s(p_out, p_mat, p_vec, p_bias,
+          rows, cols, row_stride, mat_zero_bias, vec_zero_bias,
+          out_multiplier, out_shift, out_zero_bias,
+          out_activation_min, out_activation_max, block_rows, p_dma_cfg);
+    }
+  }
   /* Iterators used in for loops */
   int m_itr, ii;
   /* Assign initial value so this value will be used in trailing loop */
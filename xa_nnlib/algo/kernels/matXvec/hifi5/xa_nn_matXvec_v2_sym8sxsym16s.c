@@ -21,6 +21,7 @@
 ******************************************************************************/
 #include "xa_nnlib_common.h"
 #include "xa_nnlib_common_macros_hifi5.h"
+#include "xa_nnlib_common_dma.h"
 static inline void _xa_nn_dot_product_8_rows_1_vecs_aligned
     (ae_int64* out_0_0
     ,ae_int8x16* p_mat1_0
@@ -578,6 +579,63 @@ static inline void _xa_nn_dot_product_1_rows_1_vecs_unaligned
 }
 
 
+/* Weight rows are fetched block by block into the local ping-pong buffers
+ * while the previous block is multiplied */
+static WORD32 xa_nn_matXvec_v2_dma_sym8sxsym16s_sym16s(
+    WORD16 * __restrict__ p_out,
+    const WORD8 * __restrict__ p_mat1,
+    const WORD16 * __restrict__ p_vec1,
+    const WORD64 * __restrict__ p_bias,
+    WORD32 rows,
+    WORD32 cols1,
+    WORD32 row_stride1,
+    WORD32 out_multiplier,
+    WORD32 out_shift,
+    WORD32 out_activation_min,
+    WORD32 out_activation_max,
+    WORD32 block_rows,
+    xa_dma_cfg_t *p_dma_cfg)
+{
+  int ret = 0, m_itr = 0, buf_idx = 0, dma_id;
+  int cur_rows = block_rows < rows ? block_rows : rows;
+
+  dma_id = xa_nn_dma_fetch(p_dma_cfg, buf_idx, p_mat1, (cur_rows - 1) * row_stride1 + cols1);
+  do
+  {
+    int next_itr = m_itr + cur_rows;
+    int next_rows = block_rows < rows - next_itr ? block_rows : rows - next_itr;
+    int next_dma_id = -1;
+    const WORD8 *p_mat_blk;
+
+    if(next_rows > 0)
+      next_dma_id = xa_nn_dma_fetch(p_dma_cfg, buf_idx ^ 1, &p_mat1[next_itr * row_stride1], (next_rows - 1) * row_stride1 + cols1);
+
+    /* Read in place if the transfer could not be started */
+    p_mat_blk = dma_id >= 0 ? (const WORD8 *)p_dma_cfg->p_local_buf[buf_idx] : &p_mat1[m_itr * row_stride1];
+    xa_nn_dma_wait(p_dma_cfg, dma_id);
+    ret |= xa_nn_matXvec_v2_sym8sxsym16s_sym16s(&p_out[m_itr],
+                                                p_mat_blk,
+                                                p_vec1,
+                                                p_bias != NULL ? &p_bias[m_itr] : NULL,
+                                                cur_rows,
+                                                cols1,
+                                                row_stride1,
+                                                out_multiplier,
+                                                out_shift,
+                                                out_activation_min,
+                                                out_activation_max,
+                                                NULL);
+    m_itr = next_itr;
+    cur_rows = next_rows;
+    dma_id = next_dma_id;
+    buf_idx ^= 1;
+  } while(m_itr < rows);
+
+  if(ret < 0)
+    return -1;
+  return 0;
+}
+
 WORD32 xa_nn_matXvec_v2_sym8sxsym16s_sym16s(
     WORD16 * __restrict__ p_out,
     const WORD8 * __restrict__ p_mat1,
@@ -606,6 +664,18 @@ WORD32 xa_nn_matXvec_v2_sym8sxsym16s_sym16s(
   XA_NNLIB_ARG_CHK_COND((cols1 <= 0), -1);
   XA_NNLIB_ARG_CHK_COND((row_stride1 < cols1), -1);
   XA_NNLIB_ARG_CHK_COND((out_shift < -31 || out_shift > 15), -1);
+
+  if(XA_NN_DMA_CFG_VALID(p_dma_cfg))
+  {
+    /* Output and bias of each block must stay 16 byte aligned */
+    int block_rows = xa_nn_dma_block_rows(p_dma_cfg, row_stride1 * sizeof(WORD8), 8, 16);
+    if(block_rows > 0 && block_rows < rows)
+    {
+      return xa_nn_matXvec_v2_dma_sym8sxsym16s_sym16s(p_out, p_mat1, p_vec1, p_bias,
+          rows, cols1, row_stride1, out_multiplier, out_shift,
+          out_activation_min, out_activation_max, block_rows, p_dma_cfg);
+    }
+  }
   /* Iterators used in for loops */
   int m_itr, ii;
   /* Assign initial value so this value will be used in trailing loop */
@@ -21,6 +21,9 @@
 ******************************************************************************/
 #include "xa_nnlib_common.h"
 #include "xa_nnlib_common_macros_hifi5.h"
+#if XA_NNLIB_HOST_SIMD
+#include "xa_nnlib_host_simd.h"
+#endif
 
 #ifdef AE_MULAZB8Q8X8
   #define MAT_VEC_MAC(...)  AE_MULAZB8Q8X8(__VA_ARGS__)
@@ -1245,6 +1248,45 @@ static inline void _xa_nn_dot_product_1_rows_1_vecs_unaligned
   *out_1_0 = acc_row0_vec1;
 }
 
+#if XA_NNLIB_HOST_SIMD
+/* Host build: same results as the HiFi5 code below */
+static WORD32 host_matmul_per_chan_sym8sxasym8s_asym8s(
+    WORD8 * __restrict__ p_out,
+    const WORD8 * __restrict__ p_mat1,
+    const WORD8 * __restrict__ p_vec1,
+    const WORD32 * __restrict__ p_bias,
+    WORD32 rows,
+    WORD32 cols1,
+    WORD32 row_stride1,
+    WORD32 vec_count,
+    WORD32 vec_offset,
+    WORD32 out_offset,
+    WORD32 out_stride,
+    WORD32 vec1_zero_bias,
+    const WORD32* __restrict__ p_out_multiplier,
+    const WORD32* __restrict__ p_out_shift,
+    WORD32 out_zero_bias,
+    WORD32 out_activation_min,
+    WORD32 out_activation_max)
+{
+  int m_itr, vec_itr;
+  for(vec_itr = 0; vec_itr < vec_count; vec_itr++)
+  {
+    const WORD8 *p_vec = p_vec1 + vec_itr * vec_offset;
+    for(m_itr = 0; m_itr < rows; m_itr++)
+    {
+      WORD32 acc = xa_nn_host_dot_8x8_zb(p_mat1 + m_itr * row_stride1, p_vec, vec1_zero_bias, cols1);
+      if(p_bias != NULL)
+        acc += p_bias[m_itr];
+      acc = xa_nn_host_requant_out16_zb(acc, p_out_multiplier[m_itr], p_out_shift[m_itr], out_zero_bias);
+      acc = acc < out_activation_min ? out_activation_min : (acc > out_activation_max ? out_activation_max : acc);
+      p_out[vec_itr * out_offset + m_itr * out_stride] = (WORD8)acc;
+    }
+  }
+  return 0;
+}
+#endif /* #if XA_NNLIB_HOST_SIMD */
+
 WORD32 xa_nn_matmul_v2_per_chan_sym8sxasym8s_asym8s(
     WORD8 * __restrict__ p_out,
     const WORD8 * __restrict__ p_mat1,
@@ -1294,6 +1336,12 @@ WORD32 xa_nn_matmul_v2_per_chan_sym8sxasym8s_asym8s(
     XA_NNLIB_ARG_CHK_COND((p_out_shift[itr] < -31 || p_out_shift[itr] > 31), -1);
   }
 
+#if XA_NNLIB_HOST_SIMD
+  (void)p_dma_cfg;
+  return host_matmul_per_chan_sym8sxasym8s_asym8s(p_out, p_mat1, p_vec1, p_bias, rows, cols1, row_stride1,
+      vec_count, vec_offset, out_offset, out_stride, vec1_zero_bias, p_out_multiplier, p_out_shift,
+      out_zero_bias, out_activation_min, out_activation_max);
+#else /* #if XA_NNLIB_HOST_SIMD */
   ae_int32x2 ALIGN(16) acc_buffer[4];
   WORD8 * __restrict__ p_dst_0;
   ae_int8x16* __restrict__ p_vec_0;
@@ -2981,6 +3029,7 @@ WORD32 xa_nn_matmul_v2_per_chan_sym8sxasym8s_asym8s(
     return -1;
   }
     return 0;
+#endif /* #if XA_NNLIB_HOST_SIMD */
 }
 
 WORD32 xa_nn_matmul_per_chan_sym8sxasym8s_asym8s(
@@ -3021,6 +3070,63 @@ WORD32 xa_nn_matmul_per_chan_sym8sxasym8s_asym8s(
               NULL);
 }
 
+/* Computes rows [row_start, row_end) for vectors [vec_start, vec_end) of
+ * the full output, so that disjoint slices can run concurrently. */
+WORD32 xa_nn_matmul_v2_slice_per_chan_sym8sxasym8s_asym8s(
+    WORD8 * __restrict__ p_out,
+    const WORD8 * __restrict__ p_mat1,
+    const WORD8 * __restrict__ p_vec1,
+    const WORD32 * __restrict__ p_bias,
+    WORD32 rows,
+    WORD32 cols1,
+    WORD32 row_stride1,
+    WORD32 vec_count,
+    WORD32 vec_offset,
+    WORD32 out_offset,
+    WORD32 out_stride,
+    WORD32 vec1_zero_bias,
+    const WORD32* __restrict__ p_out_multiplier,
+    const WORD32* __restrict__ p_out_shift,
+    WORD32 out_zero_bias,
+    WORD32 out_activation_min,
+    WORD32 out_activation_max,
+    WORD32 row_start,
+    WORD32 row_end,
+    WORD32 vec_start,
+    WORD32 vec_end,
+    xa_dma_cfg_t *p_dma_cfg)
+{
+  /* NULL pointer checks */
+  XA_NNLIB_ARG_CHK_PTR(p_out, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_mat1, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_vec1, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_out_multiplier, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_out_shift, -1);
+  /* Basic Parameter checks */
+  XA_NNLIB_ARG_CHK_COND((row_start < 0 || row_end > rows || row_start >= row_end), -1);
+  XA_NNLIB_ARG_CHK_COND((vec_start < 0 || vec_end > vec_count || vec_start >= vec_end), -1);
+
+  return xa_nn_matmul_v2_per_chan_sym8sxasym8s_asym8s(
+              &p_out[vec_start * out_offset + row_start * out_stride],
+              &p_mat1[row_start * row_stride1],
+              &p_vec1[vec_start * vec_offset],
+              p_bias != NULL ? &p_bias[row_start] : NULL,
+              row_end - row_start,
+              cols1,
+              row_stride1,
+              vec_end - vec_start,
+              vec_offset,
+              out_offset,
+              out_stride,
+              vec1_zero_bias,
+              &p_out_multiplier[row_start],
+              &p_out_shift[row_start],
+              out_zero_bias,
+              out_activation_min,
+              out_activation_max,
+              p_dma_cfg);
+}
+
 WORD32 xa_nn_matmul_sym8sxasym8s_sym16s(
     WORD16 * __restrict__ p_out,
     const WORD8 * __restrict__ p_mat1,
@@ -4346,3 +4452,386 @@ WORD32 xa_nn_matmul_sym8sxasym8s_sym16s(
   }
   return 0;
 }
+
+/* Same as xa_nn_matmul_sym8sxasym8s_sym16s, but with an output multiplier and
+ * shift per row. Lets several stacked weight matrices with different output
+ * scales share a single pass over the input vectors. */
+WORD32 xa_nn_matmul_per_chan_sym8sxasym8s_sym16s(
+    WORD16 * __restrict__ p_out,
+    const WORD8 * __restrict__ p_mat1,
+    const WORD8 * __restrict__ p_vec1,
+    const WORD32 * __restrict__ p_bias,
+    WORD32 rows,
+    WORD32 cols1,
+    WORD32 row_stride1,
+    WORD32 vec_count,
+    WORD32 vec_offset,
+    WORD32 out_offset,
+    WORD32 out_stride,
+    WORD32 vec1_zero_bias,
+    const WORD32 * __restrict__ p_out_multiplier,
+    const WORD32 * __restrict__ p_out_shift)
+{
+  /* NULL pointer checks */
+  XA_NNLIB_ARG_CHK_PTR(p_out, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_mat1, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_vec1, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_out_multiplier, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_out_shift, -1);
+  /* Pointer alignment checks */
+  XA_NNLIB_ARG_CHK_ALIGN(p_bias, sizeof(WORD32), -1);
+  XA_NNLIB_ARG_CHK_ALIGN(p_out_multiplier, sizeof(WORD32), -1);
+  XA_NNLIB_ARG_CHK_ALIGN(p_out_shift, sizeof(WORD32), -1);
+  /* Basic Parameter checks */
+  XA_NNLIB_ARG_CHK_COND((rows <= 0), -1);
+  XA_NNLIB_ARG_CHK_COND((cols1 <= 0), -1);
+  XA_NNLIB_ARG_CHK_COND((row_stride1 < cols1), -1);
+  XA_NNLIB_ARG_CHK_COND((vec_offset < cols1), -1);
+  XA_NNLIB_ARG_CHK_COND((out_offset <= 0), -1);
+  XA_NNLIB_ARG_CHK_COND((out_stride <= 0), -1);
+  XA_NNLIB_ARG_CHK_COND((vec1_zero_bias < -127 || vec1_zero_bias > 128), -1);
+
+  ae_int32x2 ALIGN(16) acc_buffer[4];
+  WORD32 left_shift[4], right_shift[4];
+
+  /* Iterators used in for loops */
+  int m_itr, vec_itr;
+  int ii;
+
+  for(m_itr = 0; m_itr < rows; m_itr++)
+  {
+    XA_NNLIB_ARG_CHK_COND((p_out_shift[m_itr] < -31 || p_out_shift[m_itr] > 31), -1);
+  }
+
+#ifndef AE_MULAZB8Q8X8
+  ae_int8x8 vec_z_b = AE_MOVDA8(-vec1_zero_bias);
+#else
+  int vec_z_b = -vec1_zero_bias;
+#endif
+
+#undef VEC_UNROLL
+#define VEC_UNROLL 4
+
+#ifndef AE_MULAZB8Q8X8
+  ae_int8x8 mat1_row0_0, mat1_row0_1;
+  ae_int8x8 mat1_row1_0, mat1_row1_1;
+  ae_int8x8 mat1_row2_0, mat1_row2_1;
+  ae_int8x8 mat1_row3_0, mat1_row3_1;
+
+  int rem_cols = cols1 & 15;
+  int rem_cols_shift_0 = ((rem_cols) <= 8)?(8 - (rem_cols)) * 8:0;
+  int rem_cols_shift_1 = ((rem_cols) > 8)?(16 - (rem_cols)) * 8:64;
+#endif
+
+  // Process loop for 4 rows and 4 vectors 
+  for(m_itr = 0; m_itr < (rows & ~(4 - 1)); m_itr += 4)
+  {
+    for(ii = 0; ii < 4; ii++)
+    {
+#if TFLITE_SINGLE_ROUNDING
+      left_shift[ii] = p_out_shift[m_itr + ii];
+      right_shift[ii] = 0;
+#else
+      left_shift[ii] = p_out_shift[m_itr + ii] < 0 ? 0 : p_out_shift[m_itr + ii];
+      right_shift[ii] = p_out_shift[m_itr + ii] > 0 ? 0 : -p_out_shift[m_itr + ii];
+#endif
+    }
+    ae_int32x2 mult_01 = AE_MOVDA32X2(p_out_multiplier[m_itr + 0], p_out_multiplier[m_itr + 1]);
+    ae_int32x2 mult_23 = AE_MOVDA32X2(p_out_multiplier[m_itr + 2], p_out_multiplier[m_itr + 3]);
+    ae_int32x2 ls_01 = AE_MOVDA32X2(left_shift[0], left_shift[1]);
+    ae_int32x2 ls_23 = AE_MOVDA32X2(left_shift[2], left_shift[3]);
+    ae_int32x2 rs_01 = AE_MOVDA32X2(right_shift[0], right_shift[1]);
+    ae_int32x2 rs_23 = AE_MOVDA32X2(right_shift[2], right_shift[3]);
+
+    ae_int32x2 acc_row0 = ZERO32; 
+    ae_int32x2 acc_row1 = ZERO32;
+
+#ifndef AE_MULAZB8Q8X8
+    ae_int8x16 *p_mat1_0 = (ae_int8x16 *) &p_mat1[(m_itr + 0) * row_stride1];
+    ae_int8x16 *p_mat1_1 = (ae_int8x16*)((WORD8 *)p_mat1_0 + row_stride1); 
+    ae_int8x16 *p_mat1_2 = (ae_int8x16*)((WORD8 *)p_mat1_1 + row_stride1); 
+    ae_int8x16 *p_mat1_3 = (ae_int8x16*)((WORD8 *)p_mat1_2 + row_stride1); 
+    
+    ae_valignx2 align_p_mat1_0 = AE_LA128_PP(p_mat1_0);
+    ae_valignx2 align_p_mat1_1 = AE_LA128_PP(p_mat1_1);
+    ae_valignx2 align_p_mat1_2 = AE_LA128_PP(p_mat1_2);
+    ae_valignx2 align_p_mat1_3 = AE_LA128_PP(p_mat1_3);
+
+    int c_itr=0;
+    int cols_count=cols1 - rem_cols;
+    for(c_itr = 0; c_itr < (cols_count >> 4); c_itr++)
+    {
+      AE_LA8X8X2_IP(mat1_row0_0, mat1_row0_1, align_p_mat1_0, p_mat1_0);
+      AE_LA8X8X2_IP(mat1_row1_0, mat1_row1_1, align_p_mat1_1, p_mat1_1);
+      AE_LA8X8X2_IP(mat1_row2_0, mat1_row2_1, align_p_mat1_2, p_mat1_2);
+      AE_LA8X8X2_IP(mat1_row3_0, mat1_row3_1, align_p_mat1_3, p_mat1_3);
+
+      AE_MULA8Q8X8(acc_row0 , acc_row1 , mat1_row0_0, mat1_row1_0, mat1_row2_0, mat1_row3_0, vec_z_b);
+      AE_MULA8Q8X8(acc_row0 , acc_row1 , mat1_row0_1, mat1_row1_1, mat1_row2_1, mat1_row3_1, vec_z_b);
+    }
+
+    //Remainder loop for cols1
+    if(cols_count!=cols1)
+    {
+      AE_LA8X8X2_IP(mat1_row0_0, mat1_row0_1, align_p_mat1_0, p_mat1_0);
+      AE_LA8X8X2_IP(mat1_row1_0, mat1_row1_1, align_p_mat1_1, p_mat1_1);
+      AE_LA8X8X2_IP(mat1_row2_0, mat1_row2_1, align_p_mat1_2, p_mat1_2);
+      AE_LA8X8X2_IP(mat1_row3_0, mat1_row3_1, align_p_mat1_3, p_mat1_3);
+
+      mat1_row0_0 = AE_MOVINT8X8_FROMINT64(AE_SLAA64(AE_SRLA64(AE_MOVINT64_FROMINT8X8(mat1_row0_0), rem_cols_shift_0), rem_cols_shift_0));
+      mat1_row1_0 = AE_MOVINT8X8_FROMINT64(AE_SLAA64(AE_SRLA64(AE_MOVINT64_FROMINT8X8(mat1_row1_0), rem_cols_shift_0), rem_cols_shift_0));
+      mat1_row2_0 = AE_MOVINT8X8_FROMINT64(AE_SLAA64(AE_SRLA64(AE_MOVINT64_FROMINT8X8(mat1_row2_0), rem_cols_shift_0), rem_cols_shift_0));
+      mat1_row3_0 = AE_MOVINT8X8_FROMINT64(AE_SLAA64(AE_SRLA64(AE_MOVINT64_FROMINT8X8(mat1_row3_0), rem_cols_shift_0), rem_cols_shift_0));
+
+      AE_MULA8Q8X8(acc_row0, acc_row1, mat1_row0_0, mat1_row1_0, mat1_row2_0, mat1_row3_0, vec_z_b);
+
+      if(rem_cols > 8)
+      {
+        mat1_row0_1 = AE_MOVINT8X8_FROMINT64(AE_SLAA64(AE_SRLA64(AE_MOVINT64_FROMINT8X8(mat1_row0_1), rem_cols_shift_1), rem_cols_shift_1));
+        mat1_row1_1 = AE_MOVINT8X8_FROMINT64(AE_SLAA64(AE_SRLA64(AE_MOVINT64_FROMINT8X8(mat1_row1_1), rem_cols_shift_1), rem_cols_shift_1));
+        mat1_row2_1 = AE_MOVINT8X8_FROMINT64(AE_SLAA64(AE_SRLA64(AE_MOVINT64_FROMINT8X8(mat1_row2_1), rem_cols_shift_1), rem_cols_shift_1));
+        mat1_row3_1 = AE_MOVINT8X8_FROMINT64(AE_SLAA64(AE_SRLA64(AE_MOVINT64_FROMINT8X8(mat1_row3_1), rem_cols_shift_1), rem_cols_shift_1));
+
+        AE_MULA8Q8X8(acc_row0, acc_row1, mat1_row0_1, mat1_row1_1, mat1_row2_1, mat1_row3_1, vec_z_b);
+      }
+    }
+#else
+    AE_MOVZBVCDR(AE_MOVINT64_FROMINT32X2(AE_MOVDA32X2(0, vec_z_b)));
+#endif
+
+    ae_int32x2 bias_01 = AE_ZERO32(), bias_23 = AE_ZERO32();
+    if(p_bias)
+    {
+      bias_01 = AE_MOVDA32X2(p_bias[m_itr + 0], p_bias[m_itr + 1]);
+      bias_23 = AE_MOVDA32X2(p_bias[m_itr + 2], p_bias[m_itr + 3]);
+    }
+    acc_row0 = SW_SUB32S_INT32X2_INT32X2(bias_01, acc_row0);
+    acc_row1 = SW_SUB32S_INT32X2_INT32X2(bias_23, acc_row1);
+
+    AE_S32X2X2_I(SW_MOVDA32(AE_MOVAD32_H(acc_row0)), SW_MOVDA32(AE_MOVAD32_L(acc_row0)), (ae_int32x4*)acc_buffer, 0);
+    AE_S32X2X2_I(SW_MOVDA32(AE_MOVAD32_H(acc_row1)), SW_MOVDA32(AE_MOVAD32_L(acc_row1)), (ae_int32x4*)acc_buffer, 16);
+
+
+    ae_int16* p_dst_0 = (ae_int16*)p_out + (m_itr + 0) * out_stride;
+    ae_int16* p_dst_1 = (ae_int16*)p_out + (m_itr + 1) * out_stride;
+    ae_int16* p_dst_2 = (ae_int16*)p_out + (m_itr + 2) * out_stride;
+    ae_int16* p_dst_3 = (ae_int16*)p_out + (m_itr + 3) * out_stride;
+
+    vec_itr = 0;
+
+    for (vec_itr = 0; vec_itr < (vec_count & ~(VEC_UNROLL-1)); vec_itr += VEC_UNROLL)
+    {
+      ae_int32x2 acc_row0_vec0;
+      ae_int32x2 acc_row1_vec0;
+      ae_int32x2 acc_row0_vec1;
+      ae_int32x2 acc_row1_vec1;
+      ae_int32x2 acc_row0_vec2;
+      ae_int32x2 acc_row1_vec2;
+      ae_int32x2 acc_row0_vec3;
+      ae_int32x2 acc_row1_vec3;
+
+      /* Initialize accumulators */
+      AE_L32X2X2_I(acc_row0_vec0, acc_row0_vec1, (ae_int32x4*)acc_buffer, 0);
+      AE_L32X2X2_I(acc_row1_vec0, acc_row1_vec1, (ae_int32x4*)acc_buffer, 0);
+      AE_L32X2X2_I(acc_row0_vec2, acc_row0_vec3, (ae_int32x4*)acc_buffer, 16);
+      AE_L32X2X2_I(acc_row1_vec2, acc_row1_vec3, (ae_int32x4*)acc_buffer, 16);
+
+      ae_int8* p_vec_0  = (ae_int8 *)(p_vec1 + vec_itr * vec_offset);
+      ae_int8x8 *p_mat1_0 = (ae_int8x8 *) &p_mat1[(m_itr + 0) * row_stride1]; 
+
+      _xa_nn_dot_product_4_rows_4_vecs_unaligned
+        (&acc_row0_vec0
+         ,&acc_row0_vec1
+         ,&acc_row0_vec2
+         ,&acc_row0_vec3
+         ,&acc_row1_vec0
+         ,&acc_row1_vec1
+         ,&acc_row1_vec2
+         ,&acc_row1_vec3
+         ,p_mat1_0
+         ,p_vec_0
+         ,cols1
+         ,row_stride1
+         ,vec_offset
+         ,vec1_zero_bias
+        );
+
+      ae_int16x4 out_0, out_1, out_2, out_3;
+
+      MPY_BY_QUANT_MULT_X2X2_OUT16(out_0, acc_row0_vec0, acc_row1_vec0, p_out_multiplier[m_itr + 0], left_shift[0], right_shift[0]);
+      MPY_BY_QUANT_MULT_X2X2_OUT16(out_1, acc_row0_vec1, acc_row1_vec1, p_out_multiplier[m_itr + 1], left_shift[1], right_shift[1]);
+      MPY_BY_QUANT_MULT_X2X2_OUT16(out_2, acc_row0_vec2, acc_row1_vec2, p_out_multiplier[m_itr + 2], left_shift[2], right_shift[2]);
+      MPY_BY_QUANT_MULT_X2X2_OUT16(out_3, acc_row0_vec3, acc_row1_vec3, p_out_multiplier[m_itr + 3], left_shift[3], right_shift[3]);
+
+      *p_dst_0 = AE_MOVINT16_FROMINT16X4(AE_SEL16_6543(out_0, out_0));   p_dst_0 += out_offset;
+      *p_dst_0 = AE_MOVINT16_FROMINT16X4(AE_SEL16_5432(out_0, out_0));   p_dst_0 += out_offset;
+      *p_dst_0 = AE_MOVINT16_FROMINT16X4(AE_SEL16_4321(out_0, out_0));   p_dst_0 += out_offset;
+      *p_dst_0 = AE_MOVINT16_FROMINT16X4(out_0);                         p_dst_0 += out_offset;
+
+      *p_dst_1 = AE_MOVINT16_FROMINT16X4(AE_SEL16_6543(out_1, out_1));   p_dst_1 += out_offset;
+      *p_dst_1 = AE_MOVINT16_FROMINT16X4(AE_SEL16_5432(out_1, out_1));   p_dst_1 += out_offset;
+      *p_dst_1 = AE_MOVINT16_FROMINT16X4(AE_SEL16_4321(out_1, out_1));   p_dst_1 += out_offset;
+      *p_dst_1 = AE_MOVINT16_FROMINT16X4(out_1);                         p_dst_1 += out_offset;
+
+      *p_dst_2 = AE_MOVINT16_FROMINT16X4(AE_SEL16_6543(out_2, out_2));   p_dst_2 += out_offset;
+      *p_dst_2 = AE_MOVINT16_FROMINT16X4(AE_SEL16_5432(out_2, out_2));   p_dst_2 += out_offset;
+      *p_dst_2 = AE_MOVINT16_FROMINT16X4(AE_SEL16_4321(out_2, out_2));   p_dst_2 += out_offset;
+      *p_dst_2 = AE_MOVINT16_FROMINT16X4(out_2);                         p_dst_2 += out_offset;
+
+      *p_dst_3 = AE_MOVINT16_FROMINT16X4(AE_SEL16_6543(out_3, out_3));   p_dst_3 += out_offset;
+      *p_dst_3 = AE_MOVINT16_FROMINT16X4(AE_SEL16_5432(out_3, out_3));   p_dst_3 += out_offset;
+      *p_dst_3 = AE_MOVINT16_FROMINT16X4(AE_SEL16_4321(out_3, out_3));   p_dst_3 += out_offset;
+      *p_dst_3 = AE_MOVINT16_FROMINT16X4(out_3);                         p_dst_3 += out_offset;
+    }
+
+    // Remaining vectors
+#ifdef AE_MULAZB8Q8X8
+    AE_MOVZBVCDR(AE_MOVINT64_FROMINT32X2(AE_MOVDA32X2(vec_z_b, 0)));
+#endif
+    for (; vec_itr < vec_count; vec_itr++)
+    {
+      ae_int32x2 acc_row0_vec0 = acc_row0;
+      ae_int32x2 acc_row1_vec0 = acc_row1;
+
+      ae_int8* p_vec_0  = (ae_int8 *)(p_vec1 + vec_itr * vec_offset);
+      ae_int8x8 *p_mat1_0 = (ae_int8x8 *) &p_mat1[(m_itr + 0) * row_stride1];
+
+      _xa_nn_dot_product_4_rows_1_vecs_unaligned
+        (&acc_row0_vec0
+         ,&acc_row1_vec0
+         ,p_mat1_0
+         ,p_vec_0
+         ,cols1
+         ,row_stride1
+         ,0
+         ,vec1_zero_bias
+        );
+
+      ae_int16x4 out_0;
+
+      MPY_BY_QUANT_MULT_PER_CHAN_X2X2_OUT16_ZB(out_0, acc_row0_vec0, acc_row1_vec0, mult_01, mult_23, ls_01, ls_23, rs_01, rs_23, 0);
+
+      *p_dst_0 = AE_MOVINT16_FROMINT16X4(AE_SEL16_6543(out_0, out_0));   p_dst_0 += out_offset;
+      *p_dst_1 = AE_MOVINT16_FROMINT16X4(AE_SEL16_5432(out_0, out_0));   p_dst_1 += out_offset;
+      *p_dst_2 = AE_MOVINT16_FROMINT16X4(AE_SEL16_4321(out_0, out_0));   p_dst_2 += out_offset;
+      *p_dst_3 = AE_MOVINT16_FROMINT16X4(out_0);                         p_dst_3 += out_offset;
+    }
+  }
+
+  // remaining rows
+  for(; m_itr < rows; m_itr++)
+  {
+#if TFLITE_SINGLE_ROUNDING
+    left_shift[0] = p_out_shift[m_itr];
+    right_shift[0] = 0;
+#else
+    left_shift[0] = p_out_shift[m_itr] < 0 ? 0 : p_out_shift[m_itr];
+    right_shift[0] = p_out_shift[m_itr] > 0 ? 0 : -p_out_shift[m_itr];
+#endif
+    ae_int32x2 acc_row0 = ZERO32; 
+    
+#ifndef AE_MULAZB8Q8X8
+    ae_int8x8 *p_mat1_0 = (ae_int8x8 *) &p_mat1[(m_itr + 0) * row_stride1];
+    ae_valign align_p_mat1_0 = AE_LA64_PP(p_mat1_0);
+
+    ae_int32x2 acc_row1 = ZERO32;
+    
+    int rem_cols_shift = 64 - (cols1 & 7) * 8;
+
+    int c_itr=0;
+    int cols_count=cols1-(cols1&7);
+    for(c_itr = 0; c_itr < (cols_count >> 3); c_itr++)
+    {
+      AE_LA8X8_IP(mat1_row0_0, align_p_mat1_0, p_mat1_0);
+      AE_MULA8Q8X8(acc_row0 , acc_row1 , mat1_row0_0 , mat1_row0_0 , mat1_row0_0 , mat1_row0_0 , vec_z_b);
+    }
+
+    //Remainder loop for cols1
+    if(cols_count!=cols1)
+    {
+      AE_LA8X8_IP(mat1_row0_0, align_p_mat1_0, p_mat1_0);
+
+      mat1_row0_0 = AE_MOVINT8X8_FROMINT64(AE_SLAA64(AE_SRLA64(AE_MOVINT64_FROMINT8X8(mat1_row0_0), rem_cols_shift), rem_cols_shift));
+
+      AE_MULA8Q8X8(acc_row0 , acc_row1 , mat1_row0_0 , mat1_row0_0 , mat1_row0_0 , mat1_row0_0 , vec_z_b);
+    }
+#else
+    int  mat_z_b = -vec1_zero_bias;
+    AE_MOVZBVCDR(AE_MOVINT64_FROMINT32X2(AE_MOVDA32X2(0, mat_z_b)));
+#endif
+
+    ae_int32x2 bias_0 = AE_ZERO32();
+    if(p_bias)
+    {
+      bias_0 = SW_MOVDA32(p_bias[m_itr + 0]);
+    }
+    acc_row0 = SW_SUB32S_INT32X2_INT32X2(bias_0, acc_row0);
+    AE_S32X2X2_I(acc_row0, acc_row0, (ae_int32x4*)acc_buffer, 0);
+
+    ae_int16* p_dst = (ae_int16*)p_out + (m_itr + 0) * out_stride;
+
+    vec_itr = 0;
+
+    for (vec_itr = 0; vec_itr < (vec_count & ~(VEC_UNROLL-1)); vec_itr += VEC_UNROLL)
+    {
+      ae_int32x2 acc_row0_vec0;
+      ae_int32x2 acc_row0_vec1;
+
+      /* Initialize accumulators */
+      AE_L32X2X2_I(acc_row0_vec0, acc_row0_vec1, (ae_int32x4*)acc_buffer, 0);
+
+      ae_int8x8* p_vec_0  = (ae_int8x8*)(p_vec1 + vec_itr * vec_offset);
+      ae_int8 *p_mat1_0 = (ae_int8*) &p_mat1[m_itr * row_stride1]; 
+
+      _xa_nn_dot_product_4_rows_1_vecs_unaligned
+        (&acc_row0_vec0
+         ,&acc_row0_vec1
+         ,p_vec_0
+         ,p_mat1_0
+         ,cols1
+         ,vec_offset
+         ,vec1_zero_bias
+         ,0
+        );
+
+      ae_int16x4 out_0;
+
+      MPY_BY_QUANT_MULT_X2X2_OUT16(out_0, acc_row0_vec0, acc_row0_vec1, p_out_multiplier[m_itr], left_shift[0], right_shift[0]);
+
+      *p_dst = AE_MOVINT16_FROMINT16X4(AE_SEL16_6543(out_0, out_0));   p_dst += out_offset;
+      *p_dst = AE_MOVINT16_FROMINT16X4(AE_SEL16_5432(out_0, out_0));   p_dst += out_offset;
+      *p_dst = AE_MOVINT16_FROMINT16X4(AE_SEL16_4321(out_0, out_0));   p_dst += out_offset;
+      *p_dst = AE_MOVINT16_FROMINT16X4(out_0);                         p_dst += out_offset;
+    }
+
+    // Remaining vectors
+#ifdef AE_MULAZB8Q8X8
+    AE_MOVZBVCDR(AE_MOVINT64_FROMINT32X2(AE_MOVDA32X2(vec_z_b, 0)));
+#endif
+    for (; vec_itr < vec_count; vec_itr++)
+    {
+      ae_int32x2 acc_row0_vec0;
+      ae_int32x2 acc_row0_vec1;
+
+      /* Initialize accumulators */
+      AE_L32X2X2_I(acc_row0_vec0, acc_row0_vec1, (ae_int32x4*)acc_buffer, 0);
+
+      ae_int8* p_vec_0  = (ae_int8*)(p_vec1 + vec_itr * vec_offset);
+      ae_int8x8 *p_mat1_0 = (ae_int8x8*) &p_mat1[m_itr * row_stride1]; 
+
+      _xa_nn_dot_product_1_rows_1_vecs_unaligned
+        (&acc_row0_vec0
+         ,&acc_row0_vec1
+         ,p_mat1_0
+         ,p_vec_0
+         ,cols1
+         ,vec1_zero_bias
+        );
+
+      ae_int16x4 out_0;
+      MPY_BY_QUANT_MULT_X2_OUT16(out_0, acc_row0_vec0, p_out_multiplier[m_itr], left_shift[0], right_shift[0]);
+      *p_dst = AE_MOVINT16_FROMINT16X4(out_0);                         p_dst += out_offset;
+    }
+  }
+  return 0;
+}
@@ -0,0 +1,450 @@
+/*******************************************************************************
+* Copyright (c) 2018-2025 Cadence Design Systems, Inc.
+*
+* Permission is hereby granted, free of charge, to any person obtaining
+* a copy of this software and associated documentation files (the
+* "Software"), to use this Software with Cadence processor cores only and
+* not with any other processors and platforms, subject to
+* the following conditions:
+*
+* The above copyright notice and this permission notice shall be included
+* in all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+******************************************************************************/
+#include "xa_nnlib_common.h"
+#include "xa_nnlib_quant_macros_hifi5.h"
+#include <string.h>
+
+#define ZERO32   AE_ZERO32()
+
+/* Row length limit, keeps the asym8s sums in 32 bits and n*x - sum in 32 bits */
+#define LAYER_NORM_MAX_ROW_LEN 32768
+
+/* Fraction bits of the normalized value before gamma */
+#define LAYER_NORM_FRAC_BITS 20
+
+/* Integer square root of d in [2^60, 2^62), result in [2^30, 2^31) */
+static WORD32 layer_norm_isqrt62(UWORD64 d)
+{
+  UWORD64 res = 0, bit = (UWORD64)1 << 60;
+  while(bit != 0)
+  {
+    if(d >= res + bit)
+    {
+      d -= res + bit;
+      res = (res >> 1) + bit;
+    }
+    else
+    {
+      res >>= 1;
+    }
+    bit >>= 2;
+  }
+  return (WORD32)res;
+}
+
+/*
+ * For a row with n elements, sum s and sum of squares q, the normalized value
+ * of x is (n*x - s) / sqrt(n*q - s*s + n*n*eps). Returns the reciprocal
+ * square root as a multiplier and right shift such that
+ * ((n*x - s) * mult) >> shift is the normalized value in Q20.
+ */
+static void layer_norm_inv_std(WORD32 *p_mult, WORD32 *p_shift, WORD64 n, WORD64 s, WORD64 q, WORD32 variance_epsilon)
+{
+  UWORD64 d = (UWORD64)(n * q - s * s) + (UWORD64)(n * n) * (UWORD32)variance_epsilon;
+  WORD32 k = 0;
+  WORD64 sq, inv;
+
+  if(d == 0)
+  {
+    *p_mult = 0;
+    *p_shift = 61 - LAYER_NORM_FRAC_BITS;
+    return;
+  }
+  /* d << 2k in [2^60, 2^62), sqrt(d) = isqrt(d << 2k) >> k */
+  while(d < ((UWORD64)1 << 60))
+  {
+    d <<= 2;
+    k++;
+  }
+  sq = layer_norm_isqrt62(d);
+  inv = (((WORD64)1 << 61) + (sq >> 1)) / sq;
+  *p_mult = inv > 0x7fffffff ? 0x7fffffff : (WORD32)inv;
+  *p_shift = 61 - LAYER_NORM_FRAC_BITS - k;
+}
+
+/* gamma * normalized + beta of 4 centered values n*x - s, requantized with
+ * out_multiplier and out_shift, without the output zero bias */
+static inline void layer_norm_out_x4(ae_int32x2 *p_out0, ae_int32x2 *p_out1,
+    ae_int32x2 d_c0, ae_int32x2 d_c1, ae_int16x4 d_gamma, ae_int32x2 d_beta0, ae_int32x2 d_beta1,
+    WORD32 inv_mult, WORD32 inv_shift, WORD32 out_multiplier, WORD32 left_shift, WORD32 right_shift)
+{
+  WORD64 rnd_norm = (WORD64)1 << (inv_shift - 1);
+  ae_int64 d_rnd_norm = AE_MOVINT64_FROMINT32X2(AE_MOVDA32X2((WORD32)(rnd_norm >> 32), (WORD32)rnd_norm));
+  ae_int64 d_rnd_frac = AE_MOVINT64_FROMINT32X2(AE_MOVDA32X2(0, 1 << (LAYER_NORM_FRAC_BITS - 1)));
+  ae_int64 d_p0, d_p1, d_p2, d_p3;
+  ae_int32x2 d_norm0, d_norm1, d_acc0, d_acc1;
+
+  /* ((n*x - s) * mult) >> shift, rounded, is the normalized value in Q20 */
+  AE_MUL32X2S_HH_LL(d_p0, d_p1, d_c0, SW_MOVDA32(inv_mult));
+  AE_MUL32X2S_HH_LL(d_p2, d_p3, d_c1, SW_MOVDA32(inv_mult));
+  d_norm0 = AE_TRUNCA32X2F64S(AE_ADD64(d_p0, d_rnd_norm), AE_ADD64(d_p1, d_rnd_norm), 32 - inv_shift);
+  d_norm1 = AE_TRUNCA32X2F64S(AE_ADD64(d_p2, d_rnd_norm), AE_ADD64(d_p3, d_rnd_norm), 32 - inv_shift);
+
+  AE_MUL32X2S_HH_LL(d_p0, d_p1, d_norm0, AE_SEXT32X2D16_32(d_gamma));
+  AE_MUL32X2S_HH_LL(d_p2, d_p3, d_norm1, AE_SEXT32X2D16_10(d_gamma));
+  d_acc0 = AE_TRUNCA32X2F64S(AE_ADD64(d_p0, d_rnd_frac), AE_ADD64(d_p1, d_rnd_frac), 32 - LAYER_NORM_FRAC_BITS);
+  d_acc1 = AE_TRUNCA32X2F64S(AE_ADD64(d_p2, d_rnd_frac), AE_ADD64(d_p3, d_rnd_frac), 32 - LAYER_NORM_FRAC_BITS);
+  d_acc0 = AE_ADD32S(d_acc0, d_beta0);
+  d_acc1 = AE_ADD32S(d_acc1, d_beta1);
+
+  MPY_BY_QUANT_MULT_X2X2_OUT32(*p_out0, *p_out1, d_acc0, d_acc1, out_multiplier, left_shift, right_shift);
+}
+
+/* Normalizes 8 elements of an asym8s row with sum d_sum */
+static inline void layer_norm_apply_asym8s_x8(WORD8 *p_out,
+    const WORD8 *p_inp,
+    const WORD16 *p_gamma,
+    const WORD32 *p_beta,
+    ae_int32x2 d_n,
+    ae_int32x2 d_sum,
+    WORD32 inv_mult,
+    WORD32 inv_shift,
+    WORD32 out_multiplier,
+    WORD32 left_shift,
+    WORD32 right_shift,
+    ae_int32x2 d_zb,
+    ae_int32x2 d_min,
+    ae_int32x2 d_max)
+{
+  const ae_int16x8 *p_g = (const ae_int16x8 *)p_gamma;
+  const ae_int32x4 *p_b = (const ae_int32x4 *)p_beta;
+  ae_int8x8 *p_o = (ae_int8x8 *)p_out;
+  ae_valign a_x = AE_LA64_PP((ae_int8x8 *)p_inp);
+  ae_valignx2 a_g = AE_LA128_PP(p_g);
+  ae_valignx2 a_b = AE_LA128_PP(p_b);
+  ae_valign a_o = AE_ZALIGN64();
+  ae_int16x4 d_x0, d_x1, d_g0, d_g1;
+  ae_int32x2 d_b0, d_b1, d_b2, d_b3;
+  ae_int32x2 d_c0, d_c1, d_c2, d_c3;
+  ae_int32x2 d_o0, d_o1, d_o2, d_o3;
+  ae_int8x8 d_out8_0, d_out8_1;
+
+  AE_LA8X4S_IP(d_x0, a_x, p_inp);
+  AE_LA8X4S_IP(d_x1, a_x, p_inp);
+  AE_LA16X4X2_IP(d_g0, d_g1, a_g, p_g);
+  AE_LA32X2X2_IP(d_b0, d_b1, a_b, p_b);
+  AE_LA32X2X2_IP(d_b2, d_b3, a_b, p_b);
+
+  /* n*x - s fits 32 bits for asym8s rows */
+  d_c0 = AE_SUB32(AE_MULP32X2(AE_SEXT32X2D16_32(d_x0), d_n), d_sum);
+  d_c1 = AE_SUB32(AE_MULP32X2(AE_SEXT32X2D16_10(d_x0), d_n), d_sum);
+  d_c2 = AE_SUB32(AE_MULP32X2(AE_SEXT32X2D16_32(d_x1), d_n), d_sum);
+  d_c3 = AE_SUB32(AE_MULP32X2(AE_SEXT32X2D16_10(d_x1), d_n), d_sum);
+
+  layer_norm_out_x4(&d_o0, &d_o1, d_c0, d_c1, d_g0, d_b0, d_b1, inv_mult, inv_shift, out_multiplier, left_shift, right_shift);
+  layer_norm_out_x4(&d_o2, &d_o3, d_c2, d_c3, d_g1, d_b2, d_b3, inv_mult, inv_shift, out_multiplier, left_shift, right_shift);
+
+  d_o0 = AE_ADD32S(d_o0, d_zb);
+  d_o1 = AE_ADD32S(d_o1, d_zb);
+  d_o2 = AE_ADD32S(d_o2, d_zb);
+  d_o3 = AE_ADD32S(d_o3, d_zb);
+  AE_MINMAX32(d_o0, d_min, d_max);
+  AE_MINMAX32(d_o1, d_min, d_max);
+  AE_MINMAX32(d_o2, d_min, d_max);
+  AE_MINMAX32(d_o3, d_min, d_max);
+
+  d_out8_0 = AE_SAT8X4X32_L(d_o0, d_o1);
+  d_out8_1 = AE_SAT8X4X32_L(d_o2, d_o3);
+  d_out8_0 = AE_SEL8X8I(d_out8_0, d_out8_1, 3);
+  AE_SA8X8_IP(d_out8_0, a_o, p_o);
+  AE_SA64POS_FP(a_o, p_o);
+}
+
+/* Normalizes 8 elements of a sym16s row with 64-bit sum d_sum */
+static inline void layer_norm_apply_sym16s_x8(WORD16 *p_out,
+    const WORD16 *p_inp,
+    const WORD16 *p_gamma,
+    const WORD32 *p_beta,
+    ae_int32x2 d_n,
+    ae_int64 d_sum,
+    WORD32 inv_mult,
+    WORD32 inv_shift,
+    WORD32 out_multiplier,
+    WORD32 left_shift,
+    WORD32 right_shift,
+    ae_int32x2 d_min,
+    ae_int32x2 d_max)
+{
+  const ae_int16x8 *p_x = (const ae_int16x8 *)p_inp;
+  const ae_int16x8 *p_g = (const ae_int16x8 *)p_gamma;
+  const ae_int32x4 *p_b = (const ae_int32x4 *)p_beta;
+  ae_int16x8 *p_o = (ae_int16x8 *)p_out;
+  ae_valignx2 a_x = AE_LA128_PP(p_x);
+  ae_valignx2 a_g = AE_LA128_PP(p_g);
+  ae_valignx2 a_b = AE_LA128_PP(p_b);
+  ae_valignx2 a_o = AE_ZALIGN128();
+  ae_int16x4 d_x0, d_x1, d_g0, d_g1;
+  ae_int32x2 d_b0, d_b1, d_b2, d_b3;
+  ae_int32x2 d_c0, d_c1, d_c2, d_c3;
+  ae_int32x2 d_o0, d_o1, d_o2, d_o3;
+  ae_int64 d_p0, d_p1, d_p2, d_p3;
+
+  AE_LA16X4X2_IP(d_x0, d_x1, a_x, p_x);
+  AE_LA16X4X2_IP(d_g0, d_g1, a_g, p_g);
+  AE_LA32X2X2_IP(d_b0, d_b1, a_b, p_b);
+  AE_LA32X2X2_IP(d_b2, d_b3, a_b, p_b);
+
+  /* n*x - s in 64 bits, saturated to 32 */
+  AE_MUL32X2S_HH_LL(d_p0, d_p1, AE_SEXT32X2D16_32(d_x0), d_n);
+  AE_MUL32X2S_HH_LL(d_p2, d_p3, AE_SEXT32X2D16_10(d_x0), d_n);
+  d_c0 = AE_TRUNCA32X2F64S(AE_SUB64(d_p0, d_sum), AE_SUB64(d_p1, d_sum), 32);
+  d_c1 = AE_TRUNCA32X2F64S(AE_SUB64(d_p2, d_sum), AE_SUB64(d_p3, d_sum), 32);
+  AE_MUL32X2S_HH_LL(d_p0, d_p1, AE_SEXT32X2D16_32(d_x1), d_n);
+  AE_MUL32X2S_HH_LL(d_p2, d_p3, AE_SEXT32X2D16_10(d_x1), d_n);
+  d_c2 = AE_TRUNCA32X2F64S(AE_SUB64(d_p0, d_sum), AE_SUB64(d_p1, d_sum), 32);
+  d_c3 = AE_TRUNCA32X2F64S(AE_SUB64(d_p2, d_sum), AE_SUB64(d_p3, d_sum), 32);
+
+  layer_norm_out_x4(&d_o0, &d_o1, d_c0, d_c1, d_g0, d_b0, d_b1, inv_mult, inv_shift, out_multiplier, left_shift, right_shift);
+  layer_norm_out_x4(&d_o2, &d_o3, d_c2, d_c3, d_g1, d_b2, d_b3, inv_mult, inv_shift, out_multiplier, left_shift, right_shift);
+
+  AE_MINMAX32(d_o0, d_min, d_max);
+  AE_MINMAX32(d_o1, d_min, d_max);
+  AE_MINMAX32(d_o2, d_min, d_max);
+  AE_MINMAX32(d_o3, d_min, d_max);
+  AE_SA16X4X2_IP(AE_SAT16X4(d_o0, d_o1), AE_SAT16X4(d_o2, d_o3), a_o, p_o);
+  AE_SA128POS_FP(a_o, p_o);
+}
+
+WORD32 xa_nn_layer_norm_asym8s_asym8s(WORD8 * __restrict__ p_out
+    ,const WORD8 * __restrict__ p_inp
+    ,const WORD16 * __restrict__ p_gamma
+    ,const WORD32 * __restrict__ p_beta
+    ,WORD32 num_rows
+    ,WORD32 row_len
+    ,WORD32 variance_epsilon
+    ,WORD32 out_multiplier
+    ,WORD32 out_shift
+    ,WORD32 out_zero_bias
+    ,WORD32 out_activation_min
+    ,WORD32 out_activation_max)
+{
+  /* NULL pointer checks */
+  XA_NNLIB_ARG_CHK_PTR(p_out, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_inp, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_gamma, -1);
+  /* Pointer alignment checks */
+  XA_NNLIB_ARG_CHK_ALIGN(p_gamma, sizeof(WORD16), -1);
+  XA_NNLIB_ARG_CHK_ALIGN(p_beta, sizeof(WORD32), -1);
+  /* Basic Parameter checks */
+  XA_NNLIB_ARG_CHK_COND((num_rows <= 0), -1);
+  XA_NNLIB_ARG_CHK_COND((row_len <= 0 || row_len > LAYER_NORM_MAX_ROW_LEN), -1);
+  XA_NNLIB_ARG_CHK_COND((variance_epsilon < 0), -1);
+  XA_NNLIB_ARG_CHK_COND((out_multiplier < 0), -1);
+  XA_NNLIB_ARG_CHK_COND((out_shift < -31 || out_shift > 31), -1);
+  XA_NNLIB_ARG_CHK_COND((out_zero_bias < -128 || out_zero_bias > 127), -1);
+  XA_NNLIB_ARG_CHK_COND((out_activation_min < -128 || out_activation_min > 127), -1);
+  XA_NNLIB_ARG_CHK_COND((out_activation_max < out_activation_min || out_activation_max > 127), -1);
+
+  WORD32 left_shift, right_shift;
+#if TFLITE_SINGLE_ROUNDING
+  left_shift = out_shift;
+  right_shift = out_shift;
+  (void)right_shift;
+#else /* #if TFLITE_SINGLE_ROUNDING */
+  left_shift = out_shift < 0 ? 0 : out_shift;
+  right_shift = out_shift > 0 ? 0 : -out_shift;
+#endif /* #if TFLITE_SINGLE_ROUNDING */
+
+  WORD32 row, i;
+  ae_int8x8 d_one = AE_MOVDA8(1);
+  ae_int8x8 d_zero = AE_MOVDA8(0);
+  ae_int32x2 d_n = SW_MOVDA32(row_len);
+  ae_int32x2 d_zb = SW_MOVDA32(out_zero_bias);
+  ae_int32x2 d_min = SW_MOVDA32(out_activation_min);
+  ae_int32x2 d_max = SW_MOVDA32(out_activation_max);
+  /* Without beta every block reads the same zeros */
+  WORD32 zero_beta[8] = {0};
+  const WORD32 *p_beta_in = p_beta != NULL ? p_beta : zero_beta;
+  WORD32 beta_step = p_beta != NULL ? 8 : 0;
+
+  for(row = 0; row < num_rows; row++)
+  {
+    const WORD8 *p_inp_row = &p_inp[row * row_len];
+    WORD8 *p_out_row = &p_out[row * row_len];
+    const WORD32 *p_b = p_beta_in;
+    WORD32 sum, sum_sq, inv_mult, inv_shift, rem;
+
+    /* Sum and sum of squares in one pass, the row stays in cache for the
+     * apply pass below. AE_MULA8Q8X8 multiplies four rows by one vector, so
+     * each 8 byte half gets its own call: the first pair of rows squares and
+     * sums d_inp1 into acc1, the second pair d_inp2 into acc2. */
+    {
+      ae_int8x16 *ptr_inp = (ae_int8x16 *)p_inp_row;
+      ae_valignx2 a_inp = AE_LA128_PP(ptr_inp);
+      ae_int8x8 d_inp1, d_inp2;
+      ae_int32x2 acc1 = ZERO32, acc2 = ZERO32;
+
+      for(i = 0; i < (row_len >> 4); i++)
+      {
+        AE_LA8X8X2_IP(d_inp1, d_inp2, a_inp, ptr_inp);
+        AE_MULA8Q8X8(acc1, acc2, d_inp1, d_one, d_zero, d_zero, d_inp1);
+        AE_MULA8Q8X8(acc1, acc2, d_zero, d_zero, d_inp2, d_one, d_inp2);
+      }
+      if(row_len & 15)
+      {
+        AE_LAV8X8X2_XP(d_inp1, d_inp2, a_inp, ptr_inp, row_len & 15);
+        AE_MULA8Q8X8(acc1, acc2, d_inp1, d_one, d_zero, d_zero, d_inp1);
+        AE_MULA8Q8X8(acc1, acc2, d_zero, d_zero, d_inp2, d_one, d_inp2);
+      }
+      acc1 = AE_ADD32(acc1, acc2);
+      sum_sq = AE_MOVAD32_H(acc1);
+      sum = AE_MOVAD32_L(acc1);
+    }
+
+    layer_norm_inv_std(&inv_mult, &inv_shift, row_len, sum, sum_sq, variance_epsilon);
+
+    for(i = 0; i < (row_len >> 3); i++)
+    {
+      layer_norm_apply_asym8s_x8(&p_out_row[i << 3], &p_inp_row[i << 3], &p_gamma[i << 3], p_b,
+          d_n, SW_MOVDA32(sum), inv_mult, inv_shift, out_multiplier, left_shift, right_shift, d_zb, d_min, d_max);
+      p_b += beta_step;
+    }
+
+    /* The last row_len % 8 elements go through the same path from zero
+     * padded copies */
+    rem = row_len & 7;
+    if(rem)
+    {
+      WORD8 inp_rem[8] = {0}, out_rem[8];
+      WORD16 gamma_rem[8] = {0};
+      WORD32 beta_rem[8] = {0};
+
+      memcpy(inp_rem, &p_inp_row[i << 3], rem);
+      memcpy(gamma_rem, &p_gamma[i << 3], rem * sizeof(WORD16));
+      memcpy(beta_rem, p_b, rem * sizeof(WORD32));
+      layer_norm_apply_asym8s_x8(out_rem, inp_rem, gamma_rem, beta_rem,
+          d_n, SW_MOVDA32(sum), inv_mult, inv_shift, out_multiplier, left_shift, right_shift, d_zb, d_min, d_max);
+      memcpy(&p_out_row[i << 3], out_rem, rem);
+    }
+  }
+
+  return 0;
+}
+
+WORD32 xa_nn_layer_norm_sym16s_sym16s(WORD16 * __restrict__ p_out
+    ,const WORD16 * __restrict__ p_inp
+    ,const WORD16 * __restrict__ p_gamma
+    ,const WORD32 * __restrict__ p_beta
+    ,WORD32 num_rows
+    ,WORD32 row_len
+    ,WORD32 variance_epsilon
+    ,WORD32 out_multiplier
+    ,WORD32 out_shift
+    ,WORD32 out_activation_min
+    ,WORD32 out_activation_max)
+{
+  /* NULL pointer checks */
+  XA_NNLIB_ARG_CHK_PTR(p_out, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_inp, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_gamma, -1);
+  /* Pointer alignment checks */
+  XA_NNLIB_ARG_CHK_ALIGN(p_out, sizeof(WORD16), -1);
+  XA_NNLIB_ARG_CHK_ALIGN(p_inp, sizeof(WORD16), -1);
+  XA_NNLIB_ARG_CHK_ALIGN(p_gamma, sizeof(WORD16), -1);
+  XA_NNLIB_ARG_CHK_ALIGN(p_beta, sizeof(WORD32), -1);
+  /* Basic Parameter checks */
+  XA_NNLIB_ARG_CHK_COND((num_rows <= 0), -1);
+  XA_NNLIB_ARG_CHK_COND((row_len <= 0 || row_len > LAYER_NORM_MAX_ROW_LEN), -1);
+  XA_NNLIB_ARG_CHK_COND((variance_epsilon < 0), -1);
+  XA_NNLIB_ARG_CHK_COND((out_multiplier < 0), -1);
+  XA_NNLIB_ARG_CHK_COND((out_shift < -31 || out_shift > 31), -1);
+  XA_NNLIB_ARG_CHK_COND((out_activation_min < -32768 || out_activation_min > 32767), -1);
+  XA_NNLIB_ARG_CHK_COND((out_activation_max < out_activation_min || out_activation_max > 32767), -1);
+
+  WORD32 left_shift, right_shift;
+#if TFLITE_SINGLE_ROUNDING
+  left_shift = out_shift;
+  right_shift = out_shift;
+  (void)right_shift;
+#else /* #if TFLITE_SINGLE_ROUNDING */
+  left_shift = out_shift < 0 ? 0 : out_shift;
+  right_shift = out_shift > 0 ? 0 : -out_shift;
+#endif /* #if TFLITE_SINGLE_ROUNDING */
+
+  WORD32 row, i;
+  ae_int32x2 d_n = SW_MOVDA32(row_len);
+  ae_int32x2 d_min = SW_MOVDA32(out_activation_min);
+  ae_int32x2 d_max = SW_MOVDA32(out_activation_max);
+  WORD32 zero_beta[8] = {0};
+  const WORD32 *p_beta_in = p_beta != NULL ? p_beta : zero_beta;
+  WORD32 beta_step = p_beta != NULL ? 8 : 0;
+
+  for(row = 0; row < num_rows; row++)
+  {
+    const WORD16 *p_inp_row = &p_inp[row * row_len];
+    WORD16 *p_out_row = &p_out[row * row_len];
+    const WORD32 *p_b = p_beta_in;
+    WORD64 sum = 0, sum_sq = 0;
+    WORD32 inv_mult, inv_shift, rem;
+    ae_int64 d_sum;
+
+    /* 16x16 squares need 64-bit sums */
+    {
+      ae_int16x8 *ptr_inp = (ae_int16x8 *)p_inp_row;
+      ae_valignx2 a_inp = AE_LA128_PP(ptr_inp);
+      ae_int16x4 d_inp1, d_inp2;
+      ae_int16x4 d_one = AE_MOVDA16(1);
+      ae_int64 acc_sq = AE_ZERO64(), acc_sum = AE_ZERO64();
+
+      for(i = 0; i < (row_len >> 3); i++)
+      {
+        AE_LA16X4X2_IP(d_inp1, d_inp2, a_inp, ptr_inp);
+        AE_MULAAAA2Q16(acc_sq, acc_sum, d_inp1, d_inp1, d_inp1, d_one);
+        AE_MULAAAA2Q16(acc_sq, acc_sum, d_inp2, d_inp2, d_inp2, d_one);
+      }
+      if(row_len & 7)
+      {
+        AE_LAV16X4X2_XP(d_inp1, d_inp2, a_inp, ptr_inp, (row_len & 7) * sizeof(WORD16));
+        AE_MULAAAA2Q16(acc_sq, acc_sum, d_inp1, d_inp1, d_inp1, d_one);
+        AE_MULAAAA2Q16(acc_sq, acc_sum, d_inp2, d_inp2, d_inp2, d_one);
+      }
+      AE_S64_I(acc_sq, (ae_int64 *)&sum_sq, 0);
+      AE_S64_I(acc_sum, (ae_int64 *)&sum, 0);
+      d_sum = acc_sum;
+    }
+
+    layer_norm_inv_std(&inv_mult, &inv_shift, row_len, sum, sum_sq, variance_epsilon);
+
+    for(i = 0; i < (row_len >> 3); i++)
+    {
+      layer_norm_apply_sym16s_x8(&p_out_row[i << 3], &p_inp_row[i << 3], &p_gamma[i << 3], p_b,
+          d_n, d_sum, inv_mult, inv_shift, out_multiplier, left_shift, right_shift, d_min, d_max);
+      p_b += beta_step;
+    }
+
+    rem = row_len & 7;
+    if(rem)
+    {
+      WORD16 inp_rem[8] = {0}, gamma_rem[8] = {0}, out_rem[8];
+      WORD32 beta_rem[8] = {0};
+
+      memcpy(inp_rem, &p_inp_row[i << 3], rem * sizeof(WORD16));
+      memcpy(gamma_rem, &p_gamma[i << 3], rem * sizeof(WORD16));
+      memcpy(beta_rem, p_b, rem * sizeof(WORD32));
+      layer_norm_apply_sym16s_x8(out_rem, inp_rem, gamma_rem, beta_rem,
+          d_n, d_sum, inv_mult, inv_shift, out_multiplier, left_shift, right_shift, d_min, d_max);
+      memcpy(&p_out_row[i << 3], out_rem, rem * sizeof(WORD16));
+    }
+  }
+
+  return 0;
+}
@@ -41,6 +41,23 @@ WORD32 xa_nn_matmul_sym8sxasym8s_sym16s(
   WORD32 vec1_zero_bias,
   WORD32 out_multiplier,
   WORD32 out_shift);
+
+WORD32 xa_nn_matmul_per_chan_sym8sxasym8s_sym16s(
+  WORD16 * __restrict__ p_out,
+  const WORD8 * __restrict__ p_mat1,
+  const WORD8 * __restrict__ p_vec1,
+  const WORD32 * __restrict__ p_bias,
+  WORD32 rows,
+  WORD32 cols1,
+  WORD32 row_stride1,
+  WORD32 vec_count,
+  WORD32 vec_offset,
+  WORD32 out_offset,
+  WORD32 out_stride,
+  WORD32 vec1_zero_bias,
+  const WORD32 * __restrict__ p_out_multiplier,
+  const WORD32 * __restrict__ p_out_shift);
+
 #endif
 
 WORD32 xa_nn_gru_getsize(
@@ -68,6 +85,23 @@ WORD32 xa_nn_gru_getsize(
   return total_scratch_size;
 }
 
+WORD32 xa_nn_gru_fused_weights_getsize(
+  WORD32 inp_size,
+  WORD32 hidden_size)
+{
+  XA_NNLIB_CHK_COND((inp_size <= 0), -1);
+  XA_NNLIB_CHK_COND((hidden_size <= 0), -1);
+
+  WORD32 quant_size, W_size, U_size;
+
+  /* W/U biases, multipliers and shifts, one per stacked row */
+  quant_size = sizeof(WORD32) * 6 * 3 * hidden_size;
+  W_size = sizeof(WORD8) * 3 * hidden_size * inp_size;
+  U_size = sizeof(WORD8) * 3 * hidden_size * hidden_size;
+
+  return quant_size + W_size + U_size;
+}
+
 #ifndef ENABLE_SCRATCH_SIZE_API_ONLY
 static void xa_nn_gru_gate_integer_8x8_16(
   WORD16 *p_out,
@@ -401,5 +435,322 @@ WORD32 xa_nn_gru_sym8sxasym8s(
   }
   return 0;
 }
+
+static void xa_nn_gru_pack_gate_sym8s(
+  WORD8  *p_W,
+  WORD8  *p_U,
+  WORD32 *p_W_bias,
+  WORD32 *p_U_bias,
+  WORD32 *p_W_out_multiplier,
+  WORD32 *p_W_out_shift,
+  WORD32 *p_U_out_multiplier,
+  WORD32 *p_U_out_shift,
+  const WORD8  *p_gate_W,
+  const WORD8  *p_gate_U,
+  const WORD32 *p_gate_W_bias,
+  const WORD32 *p_gate_U_bias,
+  WORD32 W_out_multiplier,
+  WORD32 W_out_shift,
+  WORD32 U_out_multiplier,
+  WORD32 U_out_shift,
+  WORD32 inp_size,
+  WORD32 hidden_size
+)
+{
+  int itr;
+
+  MEMCPY_8b(p_W, p_gate_W, (WORD32)(sizeof(WORD8) * hidden_size * inp_size));
+  MEMCPY_8b(p_U, p_gate_U, (WORD32)(sizeof(WORD8) * hidden_size * hidden_size));
+  for(itr = 0; itr < hidden_size; itr++)
+  {
+    p_W_bias[itr] = p_gate_W_bias[itr];
+    p_U_bias[itr] = p_gate_U_bias[itr];
+    p_W_out_multiplier[itr] = W_out_multiplier;
+    p_W_out_shift[itr] = W_out_shift;
+    p_U_out_multiplier[itr] = U_out_multiplier;
+    p_U_out_shift[itr] = U_out_shift;
+  }
+}
+
+WORD32 xa_nn_gru_fused_pack_weights_sym8s(
+  gru_fused_weights *p_fused,
+  void* p_buf,
+  const gru_weights_ptrs *p_gru_weights,
+  const gru_bias_ptrs *p_gru_biases,
+  const gru_quant_params *p_gru_qp,
+  WORD32 inp_size,
+  WORD32 hidden_size
+)
+{
+  /* NULL Pointer Checks */
+  XA_NNLIB_ARG_CHK_PTR(p_fused, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_buf, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_gru_weights, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_gru_biases, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_gru_qp, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_gru_weights->p_rg_W, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_gru_weights->p_rg_U, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_gru_weights->p_ug_W, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_gru_weights->p_ug_U, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_gru_weights->p_ms_W, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_gru_weights->p_ms_U, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_gru_biases->p_rg_W_bias, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_gru_biases->p_ug_W_bias, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_gru_biases->p_ms_W_bias, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_gru_biases->p_rg_U_bias, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_gru_biases->p_ug_U_bias, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_gru_biases->p_ms_U_bias, -1);
+  /* Pointer Alignment Checks */
+  XA_NNLIB_ARG_CHK_ALIGN(p_buf, sizeof(WORD32), -1);
+  XA_NNLIB_ARG_CHK_ALIGN(p_gru_biases->p_rg_W_bias, sizeof(WORD32), -1);
+  XA_NNLIB_ARG_CHK_ALIGN(p_gru_biases->p_ug_W_bias, sizeof(WORD32), -1);
+  XA_NNLIB_ARG_CHK_ALIGN(p_gru_biases->p_ms_W_bias, sizeof(WORD32), -1);
+  XA_NNLIB_ARG_CHK_ALIGN(p_gru_biases->p_rg_U_bias, sizeof(WORD32), -1);
+  XA_NNLIB_ARG_CHK_ALIGN(p_gru_biases->p_ug_U_bias, sizeof(WORD32), -1);
+  XA_NNLIB_ARG_CHK_ALIGN(p_gru_biases->p_ms_U_bias, sizeof(WORD32), -1);
+  /* Parameter checks */
+  XA_NNLIB_ARG_CHK_COND((inp_size <= 0), -1);
+  XA_NNLIB_ARG_CHK_COND((hidden_size <= 0), -1);
+
+  WORD32 *p_buf32 = (WORD32 *)p_buf;
+  WORD32 gate_rows = 3 * hidden_size;
+
+  p_fused->p_W_bias           = p_buf32;
+  p_fused->p_U_bias           = p_buf32 + 1 * gate_rows;
+  p_fused->p_W_out_multiplier = p_buf32 + 2 * gate_rows;
+  p_fused->p_W_out_shift      = p_buf32 + 3 * gate_rows;
+  p_fused->p_U_out_multiplier = p_buf32 + 4 * gate_rows;
+  p_fused->p_U_out_shift      = p_buf32 + 5 * gate_rows;
+  p_fused->p_W                = (WORD8 *)(p_buf32 + 6 * gate_rows);
+  p_fused->p_U                = p_fused->p_W + gate_rows * inp_size;
+
+  /* Gate order within the stacked matrices: update, reset, modulated state */
+  xa_nn_gru_pack_gate_sym8s(
+    p_fused->p_W,
+    p_fused->p_U,
+    p_fused->p_W_bias,
+    p_fused->p_U_bias,
+    p_fused->p_W_out_multiplier,
+    p_fused->p_W_out_shift,
+    p_fused->p_U_out_multiplier,
+    p_fused->p_U_out_shift,
+    (const WORD8 *)p_gru_weights->p_ug_W,
+    (const WORD8 *)p_gru_weights->p_ug_U,
+    (const WORD32 *)p_gru_biases->p_ug_W_bias,
+    (const WORD32 *)p_gru_biases->p_ug_U_bias,
+    p_gru_qp->ug_W_out_multiplier,
+    p_gru_qp->ug_W_out_shift,
+    p_gru_qp->ug_U_out_multiplier,
+    p_gru_qp->ug_U_out_shift,
+    inp_size,
+    hidden_size
+  );
+  xa_nn_gru_pack_gate_sym8s(
+    p_fused->p_W + 1 * hidden_size * inp_size,
+    p_fused->p_U + 1 * hidden_size * hidden_size,
+    p_fused->p_W_bias + 1 * hidden_size,
+    p_fused->p_U_bias + 1 * hidden_size,
+    p_fused->p_W_out_multiplier + 1 * hidden_size,
+    p_fused->p_W_out_shift + 1 * hidden_size,
+    p_fused->p_U_out_multiplier + 1 * hidden_size,
+    p_fused->p_U_out_shift + 1 * hidden_size,
+    (const WORD8 *)p_gru_weights->p_rg_W,
+    (const WORD8 *)p_gru_weights->p_rg_U,
+    (const WORD32 *)p_gru_biases->p_rg_W_bias,
+    (const WORD32 *)p_gru_biases->p_rg_U_bias,
+    p_gru_qp->rg_W_out_multiplier,
+    p_gru_qp->rg_W_out_shift,
+    p_gru_qp->rg_U_out_multiplier,
+    p_gru_qp->rg_U_out_shift,
+    inp_size,
+    hidden_size
+  );
+  xa_nn_gru_pack_gate_sym8s(
+    p_fused->p_W + 2 * hidden_size * inp_size,
+    p_fused->p_U + 2 * hidden_size * hidden_size,
+    p_fused->p_W_bias + 2 * hidden_size,
+    p_fused->p_U_bias + 2 * hidden_size,
+    p_fused->p_W_out_multiplier + 2 * hidden_size,
+    p_fused->p_W_out_shift + 2 * hidden_size,
+    p_fused->p_U_out_multiplier + 2 * hidden_size,
+    p_fused->p_U_out_shift + 2 * hidden_size,
+    (const WORD8 *)p_gru_weights->p_ms_W,
+    (const WORD8 *)p_gru_weights->p_ms_U,
+    (const WORD32 *)p_gru_biases->p_ms_W_bias,
+    (const WORD32 *)p_gru_biases->p_ms_U_bias,
+    p_gru_qp->ms_W_out_multiplier,
+    p_gru_qp->ms_W_out_shift,
+    p_gru_qp->ms_U_out_multiplier,
+    p_gru_qp->ms_U_out_shift,
+    inp_size,
+    hidden_size
+  );
+
+  return 0;
+}
+
+WORD32 xa_nn_gru_fused_sym8sxasym8s(
+  WORD8* p_out,
+  const WORD8* p_hidden_state,
+  const gru_fused_weights *p_fused,
+  const WORD8* p_inp,
+  WORD32 inp_size,
+  WORD32 hidden_size,
+  WORD32 out_size,
+  WORD32 n_batch,
+  WORD32 n_itr,
+  const gru_quant_params *p_gru_qp,
+  WORD32 time_major,
+  void* p_scratch
+)
+{
+  /* NULL Pointer Checks */
+  XA_NNLIB_ARG_CHK_PTR(p_out, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_hidden_state, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_inp, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_fused, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_fused->p_W, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_fused->p_U, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_fused->p_W_bias, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_fused->p_U_bias, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_fused->p_W_out_multiplier, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_fused->p_W_out_shift, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_fused->p_U_out_multiplier, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_fused->p_U_out_shift, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_scratch, -1);
+  /* Pointer Alignment Checks */
+  XA_NNLIB_ARG_CHK_ALIGN(p_fused->p_W_bias, sizeof(WORD32), -1);
+  XA_NNLIB_ARG_CHK_ALIGN(p_fused->p_U_bias, sizeof(WORD32), -1);
+  XA_NNLIB_ARG_CHK_ALIGN(p_scratch, 16, 1);
+  /* Check Quant Parameters */
+  XA_NNLIB_ARG_CHK_COND((p_gru_qp->rg_fcU_out_shift < -31 || p_gru_qp->rg_fcU_out_shift > 31), -1);
+  XA_NNLIB_ARG_CHK_COND((p_gru_qp->input_zero_bias < -127 || p_gru_qp->input_zero_bias > 128), -1);
+  XA_NNLIB_ARG_CHK_COND((p_gru_qp->hidden_zero_bias < -128 || p_gru_qp->hidden_zero_bias > 127), -1);
+  XA_NNLIB_ARG_CHK_COND((p_gru_qp->hidden_shift < -31      || p_gru_qp->hidden_shift > 31), -1);
+  /* Parameter checks */
+  XA_NNLIB_ARG_CHK_COND((inp_size <= 0), -1);
+  XA_NNLIB_ARG_CHK_COND((n_batch <= 0), -1);
+  XA_NNLIB_ARG_CHK_COND((n_itr <= 0), -1);
+  XA_NNLIB_ARG_CHK_COND((hidden_size <= 0), -1);
+  XA_NNLIB_ARG_CHK_COND((out_size != hidden_size), -1);
+  XA_NNLIB_ARG_CHK_COND((time_major != 0 && time_major != 1), -1);
+
+  WORD16 *fc_W_out_ptr, *fc_U_out_ptr;
+  WORD8 *updated_hidden_state;
+  WORD32 ret;
+  WORD32 gate_rows = 3 * hidden_size;
+  WORD32 shape[4] = {1, 1, 1, hidden_size};
+
+  /* Fits in xa_nn_gru_getsize, gates interleaved per vector */
+  fc_W_out_ptr = (WORD16 *)p_scratch;
+  p_scratch = (void*)((WORD16 *)p_scratch + n_itr * n_batch * gate_rows);
+  fc_U_out_ptr = (WORD16 *)p_scratch;
+  p_scratch = (void*)((WORD16 *)p_scratch + n_batch * gate_rows);
+
+  updated_hidden_state = (WORD8 *)p_scratch;
+  p_scratch = (void*)((WORD8 *)p_scratch + n_batch * hidden_size);
+
+  MEMCPY_8b(updated_hidden_state, p_hidden_state, n_batch * hidden_size);
+
+  /* All three input FCs in one pass over the input */
+  ret = xa_nn_matmul_per_chan_sym8sxasym8s_sym16s(
+          fc_W_out_ptr,
+          p_fused->p_W,
+          p_inp,
+          p_fused->p_W_bias,
+          gate_rows,
+          inp_size,
+          inp_size,
+          n_itr * n_batch,
+          inp_size,
+          gate_rows,
+          1,
+          p_gru_qp->input_zero_bias,
+          p_fused->p_W_out_multiplier,
+          p_fused->p_W_out_shift
+        );
+  if(ret != 0)
+    return ret;
+
+  WORD32 itr_t, itr_b;
+  for(itr_t = 0; itr_t < n_itr; itr_t++)
+  {
+    /* All three recurrent FCs in one pass over the hidden state */
+    ret = xa_nn_matmul_per_chan_sym8sxasym8s_sym16s(
+            fc_U_out_ptr,
+            p_fused->p_U,
+            updated_hidden_state,
+            p_fused->p_U_bias,
+            gate_rows,
+            hidden_size,
+            hidden_size,
+            n_batch,
+            hidden_size,
+            gate_rows,
+            1,
+            -p_gru_qp->hidden_zero_bias,
+            p_fused->p_U_out_multiplier,
+            p_fused->p_U_out_shift
+          );
+    if(ret != 0)
+      return ret;
+
+    /* Whole step for one batch runs on a 3 * hidden_size slice */
+    for(itr_b = 0; itr_b < n_batch; itr_b++)
+    {
+      WORD16 *p_ug = fc_U_out_ptr + itr_b * gate_rows;
+      WORD16 *p_rg = p_ug + hidden_size;
+      WORD16 *p_ms = p_rg + hidden_size;
+      WORD16 *p_W_gates = fc_W_out_ptr + (time_major ? (itr_t * n_batch + itr_b) : (itr_b * n_itr + itr_t)) * gate_rows;
+
+      /* Update and reset gates are adjacent */
+      xa_nn_elm_add_16x16_16(p_ug, p_W_gates, p_ug, 2 * hidden_size);
+      xa_nn_vec_sigmoid_sym16s_sym16s(p_ug, p_ug, 0, 0, 2 * hidden_size);
+
+      xa_nn_elm_mul_broadcast_4D_sym16sxsym16s_sym16s(
+        p_ms,
+        shape,
+        p_gru_qp->rg_fcU_out_shift,
+        p_gru_qp->rg_fcU_out_multiplier,
+        -32768,
+        32767,
+        p_ms,
+        shape,
+        p_rg,
+        shape
+      );
+      xa_nn_elm_add_16x16_16(p_ms, p_W_gates + 2 * hidden_size, p_ms, hidden_size);
+      xa_nn_vec_tanh_sym16s_sym16s(p_ms, p_ms, 0, 0, hidden_size);
+
+      xa_nn_gru_hidden_state_update_8(
+        updated_hidden_state + itr_b * hidden_size,
+        p_ug,
+        p_ms,
+        p_gru_qp->ug_ms_out_multiplier,
+        p_gru_qp->ug_ms_out_shift,
+        p_gru_qp->ug_hidden_out_multiplier,
+        p_gru_qp->ug_hidden_out_shift,
+        p_gru_qp->hidden_multiplier,
+        p_gru_qp->hidden_shift,
+        p_gru_qp->hidden_zero_bias,
+        hidden_size
+      );
+    }
+
+    /* Memcpy hidden state to output */
+    if(time_major)
+    {
+      MEMCPY_8b(&p_out[itr_t * n_batch * hidden_size], updated_hidden_state, (WORD32)(sizeof(WORD8) * n_batch * hidden_size));
+    }
+    else
+    {
+      for(itr_b = 0; itr_b < n_batch; itr_b++)
+      {
+        MEMCPY_8b(&p_out[(itr_t + itr_b * n_itr) * hidden_size], &updated_hidden_state[itr_b * hidden_size], (WORD32)(sizeof(WORD8) * hidden_size));
+      }
+    }
+  }
+  return 0;
+}
 #endif /* #ifndef ENABLE_SCRATCH_SIZE_API_ONLY */
 
@@ -41,6 +41,22 @@ WORD32 xa_nn_matmul_sym8sxasym8s_sym16s(
     WORD32 vec1_zero_bias,
     WORD32 out_multiplier,
     WORD32 out_shift);
+
+WORD32 xa_nn_matmul_per_chan_sym8sxasym8s_sym16s(
+    WORD16 * __restrict__ p_out,
+    const WORD8 * __restrict__ p_mat1,
+    const WORD8 * __restrict__ p_vec1,
+    const WORD32 * __restrict__ p_bias,
+    WORD32 rows,
+    WORD32 cols1,
+    WORD32 row_stride1,
+    WORD32 vec_count,
+    WORD32 vec_offset,
+    WORD32 out_offset,
+    WORD32 out_stride,
+    WORD32 vec1_zero_bias,
+    const WORD32 * __restrict__ p_out_multiplier,
+    const WORD32 * __restrict__ p_out_shift);
 #endif /* #ifndef ENABLE_SCRATCH_SIZE_API_ONLY */
 
 WORD32 xa_nn_lstm_getsize(
@@ -60,6 +76,23 @@ WORD32 xa_nn_lstm_getsize(
   return total_scratch_size;
 }
 
+WORD32 xa_nn_lstm_fused_weights_getsize(
+    WORD32 inp_size,
+    WORD32 n_cell)
+{
+  XA_NNLIB_CHK_COND((inp_size <= 0), -1);
+  XA_NNLIB_CHK_COND((n_cell <= 0), -1);
+
+  WORD32 quant_size, W_size, U_size;
+
+  /* W/U biases, multipliers and shifts, one per stacked row */
+  quant_size = sizeof(WORD32) * 6 * 4 * n_cell;
+  W_size = sizeof(WORD8) * 4 * n_cell * inp_size;
+  U_size = sizeof(WORD8) * 4 * n_cell * n_cell;
+
+  return quant_size + W_size + U_size;
+}
+
 #ifndef ENABLE_SCRATCH_SIZE_API_ONLY
 static void xa_nn_lstm_gate_integer_8x8_16(
     WORD16 *p_out,
@@ -588,5 +621,332 @@ WORD32 xa_nn_lstm_sym8sxasym8s_16(
   }
   return 0;
 }
-#endif /* #ifndef ENABLE_SCRATCH_SIZE_API_ONLY */
 
+static void xa_nn_lstm_pack_gate_sym8s(
+    WORD8  *p_W,
+    WORD8  *p_U,
+    WORD32 *p_W_bias,
+    WORD32 *p_U_bias,
+    WORD32 *p_W_out_multiplier,
+    WORD32 *p_W_out_shift,
+    WORD32 *p_U_out_multiplier,
+    WORD32 *p_U_out_shift,
+    const WORD8  *p_gate_W,
+    const WORD8  *p_gate_U,
+    const WORD32 *p_gate_W_bias,
+    const WORD32 *p_gate_U_bias,
+    WORD32 W_out_multiplier,
+    WORD32 W_out_shift,
+    WORD32 U_out_multiplier,
+    WORD32 U_out_shift,
+    WORD32 inp_size,
+    WORD32 n_cell)
+{
+  int itr;
+
+  MEMCPY_8b(p_W, p_gate_W, (WORD32)(sizeof(WORD8) * n_cell * inp_size));
+  MEMCPY_8b(p_U, p_gate_U, (WORD32)(sizeof(WORD8) * n_cell * n_cell));
+  for(itr = 0; itr < n_cell; itr++)
+  {
+    p_W_bias[itr] = p_gate_W_bias[itr];
+    p_U_bias[itr] = p_gate_U_bias ? p_gate_U_bias[itr] : 0;
+    p_W_out_multiplier[itr] = W_out_multiplier;
+    p_W_out_shift[itr] = W_out_shift;
+    p_U_out_multiplier[itr] = U_out_multiplier;
+    p_U_out_shift[itr] = U_out_shift;
+  }
+}
+
+WORD32 xa_nn_lstm_fused_pack_weights_sym8s(
+    lstm_fused_weights *p_fused,
+    void*  p_buf,
+    lstm_weights_ptrs *p_lstm_weights,
+    lstm_bias_ptrs    *p_lstm_biases,
+    lstm_quant_params *p_lstm_qp,
+    WORD32 inp_size,
+    WORD32 n_cell)
+{
+  /* NULL Pointer Checks */
+  XA_NNLIB_ARG_CHK_PTR(p_fused, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_buf, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_lstm_weights, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_lstm_biases, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_lstm_qp, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_lstm_weights->p_ig_W, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_lstm_weights->p_ig_U, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_lstm_weights->p_fg_W, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_lstm_weights->p_fg_U, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_lstm_weights->p_cg_W, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_lstm_weights->p_cg_U, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_lstm_weights->p_og_W, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_lstm_weights->p_og_U, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_lstm_biases->p_ig_W_bias, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_lstm_biases->p_fg_W_bias, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_lstm_biases->p_cg_W_bias, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_lstm_biases->p_og_W_bias, -1);
+  /* Pointer Alignment Checks */
+  XA_NNLIB_ARG_CHK_ALIGN(p_buf, sizeof(WORD32), -1);
+  XA_NNLIB_ARG_CHK_ALIGN(p_lstm_biases->p_ig_W_bias, sizeof(WORD32), -1);
+  XA_NNLIB_ARG_CHK_ALIGN(p_lstm_biases->p_fg_W_bias, sizeof(WORD32), -1);
+  XA_NNLIB_ARG_CHK_ALIGN(p_lstm_biases->p_cg_W_bias, sizeof(WORD32), -1);
+  XA_NNLIB_ARG_CHK_ALIGN(p_lstm_biases->p_og_W_bias, sizeof(WORD32), -1);
+  XA_NNLIB_ARG_CHK_ALIGN(p_lstm_biases->p_ig_U_bias, sizeof(WORD32), -1);
+  XA_NNLIB_ARG_CHK_ALIGN(p_lstm_biases->p_fg_U_bias, sizeof(WORD32), -1);
+  XA_NNLIB_ARG_CHK_ALIGN(p_lstm_biases->p_cg_U_bias, sizeof(WORD32), -1);
+  XA_NNLIB_ARG_CHK_ALIGN(p_lstm_biases->p_og_U_bias, sizeof(WORD32), -1);
+  /* Parameter checks */
+  XA_NNLIB_ARG_CHK_COND((inp_size <= 0), -1);
+  XA_NNLIB_ARG_CHK_COND((n_cell <= 0), -1);
+
+  WORD32 *p_buf32 = (WORD32 *)p_buf;
+  WORD32 gate_rows = 4 * n_cell;
+
+  p_fused->p_W_bias           = p_buf32;
+  p_fused->p_U_bias           = p_buf32 + 1 * gate_rows;
+  p_fused->p_W_out_multiplier = p_buf32 + 2 * gate_rows;
+  p_fused->p_W_out_shift      = p_buf32 + 3 * gate_rows;
+  p_fused->p_U_out_multiplier = p_buf32 + 4 * gate_rows;
+  p_fused->p_U_out_shift      = p_buf32 + 5 * gate_rows;
+  p_fused->p_W                = (WORD8 *)(p_buf32 + 6 * gate_rows);
+  p_fused->p_U                = p_fused->p_W + gate_rows * inp_size;
+
+  /* Gate order within the stacked matrices: input, forget, cell, output */
+  xa_nn_lstm_pack_gate_sym8s(p_fused->p_W,
+                             p_fused->p_U,
+                             p_fused->p_W_bias,
+                             p_fused->p_U_bias,
+                             p_fused->p_W_out_multiplier,
+                             p_fused->p_W_out_shift,
+                             p_fused->p_U_out_multiplier,
+                             p_fused->p_U_out_shift,
+                             (const WORD8 *)p_lstm_weights->p_ig_W,
+                             (const WORD8 *)p_lstm_weights->p_ig_U,
+                             (const WORD32 *)p_lstm_biases->p_ig_W_bias,
+                             (const WORD32 *)p_lstm_biases->p_ig_U_bias,
+                             p_lstm_qp->ig_W_out_multiplier,
+                             p_lstm_qp->ig_W_out_shift,
+                             p_lstm_qp->ig_U_out_multiplier,
+                             p_lstm_qp->ig_U_out_shift,
+                             inp_size,
+                             n_cell);
+  xa_nn_lstm_pack_gate_sym8s(p_fused->p_W + 1 * n_cell * inp_size,
+                             p_fused->p_U + 1 * n_cell * n_cell,
+                             p_fused->p_W_bias + 1 * n_cell,
+                             p_fused->p_U_bias + 1 * n_cell,
+                             p_fused->p_W_out_multiplier + 1 * n_cell,
+                             p_fused->p_W_out_shift + 1 * n_cell,
+                             p_fused->p_U_out_multiplier + 1 * n_cell,
+                             p_fused->p_U_out_shift + 1 * n_cell,
+                             (const WORD8 *)p_lstm_weights->p_fg_W,
+                             (const WORD8 *)p_lstm_weights->p_fg_U,
+                             (const WORD32 *)p_lstm_biases->p_fg_W_bias,
+                             (const WORD32 *)p_lstm_biases->p_fg_U_bias,
+                             p_lstm_qp->fg_W_out_multiplier,
+                             p_lstm_qp->fg_W_out_shift,
+                             p_lstm_qp->fg_U_out_multiplier,
+                             p_lstm_qp->fg_U_out_shift,
+                             inp_size,
+                             n_cell);
+  xa_nn_lstm_pack_gate_sym8s(p_fused->p_W + 2 * n_cell * inp_size,
+                             p_fused->p_U + 2 * n_cell * n_cell,
+                             p_fused->p_W_bias + 2 * n_cell,
+                             p_fused->p_U_bias + 2 * n_cell,
+                             p_fused->p_W_out_multiplier + 2 * n_cell,
+                             p_fused->p_W_out_shift + 2 * n_cell,
+                             p_fused->p_U_out_multiplier + 2 * n_cell,
+                             p_fused->p_U_out_shift + 2 * n_cell,
+                             (const WORD8 *)p_lstm_weights->p_cg_W,
+                             (const WORD8 *)p_lstm_weights->p_cg_U,
+                             (const WORD32 *)p_lstm_biases->p_cg_W_bias,
+                             (const WORD32 *)p_lstm_biases->p_cg_U_bias,
+                             p_lstm_qp->cg_W_out_multiplier,
+                             p_lstm_qp->cg_W_out_shift,
+                             p_lstm_qp->cg_U_out_multiplier,
+                             p_lstm_qp->cg_U_out_shift,
+                             inp_size,
+                             n_cell);
+  xa_nn_lstm_pack_gate_sym8s(p_fused->p_W + 3 * n_cell * inp_size,
+                             p_fused->p_U + 3 * n_cell * n_cell,
+                             p_fused->p_W_bias + 3 * n_cell,
+                             p_fused->p_U_bias + 3 * n_cell,
+                             p_fused->p_W_out_multiplier + 3 * n_cell,
+                             p_fused->p_W_out_shift + 3 * n_cell,
+                             p_fused->p_U_out_multiplier + 3 * n_cell,
+                             p_fused->p_U_out_shift + 3 * n_cell,
+                             (const WORD8 *)p_lstm_weights->p_og_W,
+                             (const WORD8 *)p_lstm_weights->p_og_U,
+                             (const WORD32 *)p_lstm_biases->p_og_W_bias,
+                             (const WORD32 *)p_lstm_biases->p_og_U_bias,
+                             p_lstm_qp->og_W_out_multiplier,
+                             p_lstm_qp->og_W_out_shift,
+                             p_lstm_qp->og_U_out_multiplier,
+                             p_lstm_qp->og_U_out_shift,
+                             inp_size,
+                             n_cell);
+
+  return 0;
+}
+
+WORD32 xa_nn_lstm_fused_sym8sxasym8s_16(
+    WORD8*  p_out,                      /* out */
+    WORD8*  p_hidden_state,             /* inout */
+    WORD16* p_cell_state,               /* inout */
+    lstm_fused_weights *p_fused,        /* input */
+    WORD8*  p_inp,                      /* input */
+    WORD32 inp_size,
+    WORD32 hidden_size,
+    WORD32 out_size,
+    WORD32 n_batch,
+    WORD32 n_itr,
+    WORD32 n_cell,
+    lstm_quant_params *p_lstm_qp,
+    lstm_flags *p_lstm_flags,
+    void*  p_scratch)
+{
+  /* NULL Pointer Checks */
+  XA_NNLIB_ARG_CHK_PTR(p_out, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_hidden_state, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_cell_state, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_inp, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_fused, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_fused->p_W, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_fused->p_U, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_fused->p_W_bias, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_fused->p_W_out_multiplier, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_fused->p_W_out_shift, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_fused->p_U_out_multiplier, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_fused->p_U_out_shift, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_scratch, -1);
+  /* Pointer Alignment Checks */
+  XA_NNLIB_ARG_CHK_ALIGN(p_cell_state, sizeof(WORD16), -1);
+  XA_NNLIB_ARG_CHK_ALIGN(p_fused->p_W_bias, sizeof(WORD32), -1);
+  XA_NNLIB_ARG_CHK_ALIGN(p_fused->p_U_bias, sizeof(WORD32), -1);
+  XA_NNLIB_ARG_CHK_ALIGN(p_scratch, 16, 1);
+  /* Parameter checks */
+  XA_NNLIB_ARG_CHK_COND((p_lstm_qp->input_zero_bias < -127 || p_lstm_qp->input_zero_bias > 128), -1);
+  XA_NNLIB_ARG_CHK_COND((p_lstm_qp->hidden_zero_bias < -128 || p_lstm_qp->hidden_zero_bias > 127), -1);
+  XA_NNLIB_ARG_CHK_COND((p_lstm_qp->hidden_shift < -31 || p_lstm_qp->hidden_shift > 31), -1);
+  XA_NNLIB_ARG_CHK_COND((p_lstm_qp->cell_state_scale < -29 || p_lstm_qp->cell_state_scale > 1), -1);
+  XA_NNLIB_ARG_CHK_COND((inp_size <= 0), -1);
+  XA_NNLIB_ARG_CHK_COND((n_batch <= 0 || n_cell <= 0), -1);
+  XA_NNLIB_ARG_CHK_COND((n_itr <= 0), -1);
+  XA_NNLIB_ARG_CHK_COND((out_size != n_cell || hidden_size != n_cell), -1);
+  XA_NNLIB_ARG_CHK_COND((p_lstm_flags->use_cifg != 0), -1);
+
+  WORD16 *fc_W_out_ptr, *fc_U_out_ptr;
+  WORD32 ret;
+
+  WORD32 time_major, back;
+  WORD32 gate_rows = 4 * n_cell;
+
+  time_major = p_lstm_flags->time_major;
+  back = p_lstm_flags->back;
+
+  /* Same scratch as xa_nn_lstm_getsize, but gate-interleaved per vector */
+  fc_W_out_ptr = (WORD16 *)p_scratch;
+  fc_U_out_ptr = fc_W_out_ptr + n_batch * n_itr * gate_rows;
+
+  WORD32 itr_t, itr_b;
+  /* All four input FCs in one pass over the input */
+  ret = xa_nn_matmul_per_chan_sym8sxasym8s_sym16s(fc_W_out_ptr,
+                                                  p_fused->p_W,
+                                                  p_inp,
+                                                  p_fused->p_W_bias,
+                                                  gate_rows,
+                                                  inp_size,
+                                                  inp_size,
+                                                  n_itr * n_batch,
+                                                  inp_size,
+                                                  gate_rows,
+                                                  1,
+                                                  p_lstm_qp->input_zero_bias,
+                                                  p_fused->p_W_out_multiplier,
+                                                  p_fused->p_W_out_shift);
+  if(ret != 0)
+    return ret;
+
+  for(itr_t = 0; itr_t < n_itr; itr_t++)
+  {
+    /* All four recurrent FCs in one pass over the hidden state */
+    ret = xa_nn_matmul_per_chan_sym8sxasym8s_sym16s(fc_U_out_ptr,
+                                                    p_fused->p_U,
+                                                    p_hidden_state,
+                                                    p_fused->p_U_bias,
+                                                    gate_rows,
+                                                    hidden_size,
+                                                    hidden_size,
+                                                    n_batch,
+                                                    hidden_size,
+                                                    gate_rows,
+                                                    1,
+                                                    -p_lstm_qp->hidden_zero_bias,
+                                                    p_fused->p_U_out_multiplier,
+                                                    p_fused->p_U_out_shift);
+    if(ret != 0)
+      return ret;
+
+    WORD32 t = back ? (n_itr - itr_t - 1) : itr_t;
+
+    for(itr_b = 0; itr_b < n_batch; itr_b++)
+    {
+      WORD16 *p_gates = fc_U_out_ptr + itr_b * gate_rows;
+      WORD32 W_fc_out_offset = (time_major ? (t * n_batch + itr_b) : (itr_b * n_itr + t)) * gate_rows;
+
+      xa_nn_elm_add_16x16_16(p_gates,
+                             fc_W_out_ptr + W_fc_out_offset,
+                             p_gates,
+                             gate_rows);
+      /* Input and forget gates are adjacent */
+      xa_nn_vec_sigmoid_sym16s_sym16s(p_gates,
+                                      p_gates,
+                                      0,
+                                      0,
+                                      2 * n_cell);
+      xa_nn_vec_tanh_sym16s_sym16s(p_gates + 2 * n_cell,
+                                   p_gates + 2 * n_cell,
+                                   0,
+                                   0,
+                                   n_cell);
+      xa_nn_vec_sigmoid_sym16s_sym16s(p_gates + 3 * n_cell,
+                                      p_gates + 3 * n_cell,
+                                      0,
+                                      0,
+                                      n_cell);
+      xa_nn_update_lstm_cell(p_cell_state + itr_b * n_cell,
+                             p_gates,
+                             p_gates + n_cell,
+                             p_gates + 2 * n_cell,
+                             1,
+                             n_cell,
+                             p_lstm_qp->cell_state_scale,
+                             0,
+                             p_lstm_qp->quantized_cell_clip);
+      /* Input gate slot reused as scratch here */
+      xa_nn_lstm_output_integer_16(p_hidden_state + itr_b * n_cell,
+                                   p_cell_state + itr_b * n_cell,
+                                   p_gates + 3 * n_cell,
+                                   8,
+                                   1,
+                                   n_cell,
+                                   p_lstm_qp->cell_state_scale,
+                                   p_lstm_qp->hidden_multiplier,
+                                   p_lstm_qp->hidden_shift,
+                                   p_lstm_qp->hidden_zero_bias,
+                                   p_gates);
+    }
+
+    if(time_major)
+    {
+      MEMCPY_8b(&p_out[t * n_batch * n_cell], p_hidden_state, (WORD32)(sizeof(WORD8) * n_batch * n_cell));
+    }
+    else
+    {
+      for(itr_b = 0; itr_b < n_batch; itr_b++)
+      {
+        MEMCPY_8b(&p_out[(t + itr_b * n_itr) * n_cell], &p_hidden_state[itr_b * n_cell], (WORD32)(sizeof(WORD8) * n_cell));
+      }
+    }
+  }
+  return 0;
+}
+#endif /* #ifndef ENABLE_SCRATCH_SIZE_API_ONLY */
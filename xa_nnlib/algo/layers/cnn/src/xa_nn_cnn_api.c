@@ -19,6 +19,8 @@
 * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 
 ******************************************************************************/
+/* Layer calls go through the traced kernel entry points */
+#define XA_NNLIB_TRACE_CALLER
 #include <string.h>
 #include "xa_nnlib_common.h"
 #include "xa_nnlib_common_fpu.h"
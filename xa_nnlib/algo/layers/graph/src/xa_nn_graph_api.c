@@ -0,0 +1,694 @@
+/*******************************************************************************
+* Copyright (c) 2018-2025 Cadence Design Systems, Inc.
+*
+* Permission is hereby granted, free of charge, to any person obtaining
+* a copy of this software and associated documentation files (the
+* "Software"), to use this Software with Cadence processor cores only and
+* not with any other processors and platforms, subject to
+* the following conditions:
+*
+* The above copyright notice and this permission notice shall be included
+* in all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+******************************************************************************/
+/* Layer calls go through the traced kernel entry points */
+#define XA_NNLIB_TRACE_CALLER
+#include <string.h>
+#include <math.h>
+#include "xa_nnlib_common.h"
+#include "xa_nnlib_graph_api.h"
+#include "xa_nnlib_planner_api.h"
+
+#define ALIGN_SIZE(n) (((n)+7)&(~7))
+#define CHECK_PTR(ptr, err) if(NULL == ptr) return err;
+#define CHECK_PTR_ALIGN(ptr, alignment, err) if((((unsigned)(ptr))&(alignment-1)) != 0) return err;
+
+#define ARENA_ALIGNMENT 16
+#define FC_V2_ALIGNED(ptr) ((((unsigned)(ptr)) & (ARENA_ALIGNMENT - 1)) == 0)
+
+/* softmax input integer bits, as in the TFLite reference */
+#define SOFTMAX_INPUT_INT_BITS 5
+/* elementwise add input left shift, as in the TFLite reference */
+#define ADD_LEFT_SHIFT 20
+
+typedef struct _graph_op_t
+{
+  Int32 type;
+  Int32 input[2];
+  Int32 output;
+  Int32 scratch_offset;
+
+  Int32 input_height;
+  Int32 input_width;
+  Int32 input_channels;
+  Int32 out_height;
+  Int32 out_width;
+  Int32 out_channels;
+  Int32 kernel_height;
+  Int32 kernel_width;
+  Int32 x_stride;
+  Int32 y_stride;
+  Int32 x_padding;
+  Int32 y_padding;
+
+  const WORD8 *p_weight;
+  const WORD32 *p_bias;
+  WORD32 *p_out_multiplier;     /* per output channel */
+  WORD32 *p_out_shift;
+
+  Int32 input_zero_bias[2];
+  Int32 input_multiplier[2];    /* ADD */
+  Int32 input_shift[2];         /* ADD */
+  Int32 left_shift;             /* ADD, SOFTMAX */
+  Int32 diffmin;                /* SOFTMAX */
+  Int32 out_zero_bias;
+  Int32 out_multiplier;
+  Int32 out_shift;
+  Int32 activation_min;
+  Int32 activation_max;
+} graph_op_t;
+
+typedef struct _graph_state_t
+{
+  Int32 n_tensors;
+  Int32 n_ops;
+  Int32 input_tensor;
+  Int32 output_tensor;
+  Int32 scratch_size;
+
+  graph_op_t *p_ops;
+  Int32 *p_tensor_offset;       /* arena offset of every tensor */
+} graph_state_t;
+
+typedef struct _graph_blob_t
+{
+  const xa_nnlib_graph_header_t *p_header;
+  const xa_nnlib_graph_tensor_desc_t *p_tensors;
+  const xa_nnlib_graph_op_desc_t *p_ops;
+  const WORD8 *p_const;
+} graph_blob_t;
+
+/* TFLite QuantizeMultiplier: real = multiplier * 2^(shift - 31) */
+static Int32 quantize_multiplier(double real, Int32 *p_multiplier, Int32 *p_shift)
+{
+  double q;
+  Int64 q_fixed;
+  int shift;
+
+  if(real <= 0.0)
+    return -1;
+
+  q = frexp(real, &shift);
+  q_fixed = (Int64)floor(q * (double)(1LL << 31) + 0.5);
+  if(q_fixed == (1LL << 31))
+  {
+    q_fixed /= 2;
+    shift++;
+  }
+  if(shift < -31)
+  {
+    shift = 0;
+    q_fixed = 0;
+  }
+  if(shift > 30)
+    return -1;
+
+  *p_multiplier = (Int32)q_fixed;
+  *p_shift = shift;
+  return 0;
+}
+
+static Int32 parse_graph(graph_blob_t *p_blob, const void *p_graph, Int32 graph_size)
+{
+  const xa_nnlib_graph_header_t *p_header = (const xa_nnlib_graph_header_t *)p_graph;
+  Int32 tables_size;
+
+  CHECK_PTR(p_graph, XA_NNLIB_FATAL_MEM_ALLOC);
+  CHECK_PTR_ALIGN(p_graph, 8, XA_NNLIB_FATAL_MEM_ALIGN);
+
+  if(graph_size < (Int32)sizeof(xa_nnlib_graph_header_t) ||
+     p_header->magic != XA_NNLIB_GRAPH_MAGIC ||
+     p_header->version != XA_NNLIB_GRAPH_VERSION ||
+     p_header->n_tensors <= 0 || p_header->n_ops <= 0 ||
+     p_header->const_size < 0)
+    return XA_NNLIB_GRAPH_CONFIG_FATAL_INVALID_HEADER;
+
+  tables_size = sizeof(xa_nnlib_graph_header_t) +
+                p_header->n_tensors * sizeof(xa_nnlib_graph_tensor_desc_t) +
+                p_header->n_ops * sizeof(xa_nnlib_graph_op_desc_t);
+  if(graph_size < tables_size + p_header->const_size)
+    return XA_NNLIB_GRAPH_CONFIG_FATAL_INVALID_HEADER;
+
+  if(p_header->input_tensor < 0 || p_header->input_tensor >= p_header->n_tensors ||
+     p_header->output_tensor < 0 || p_header->output_tensor >= p_header->n_tensors ||
+     p_header->input_tensor == p_header->output_tensor)
+    return XA_NNLIB_GRAPH_CONFIG_FATAL_INVALID_TENSOR;
+
+  p_blob->p_header = p_header;
+  p_blob->p_tensors = (const xa_nnlib_graph_tensor_desc_t *)(p_header + 1);
+  p_blob->p_ops = (const xa_nnlib_graph_op_desc_t *)(p_blob->p_tensors + p_header->n_tensors);
+  p_blob->p_const = (const WORD8 *)p_graph + tables_size;
+
+  return XA_NNLIB_NO_ERROR;
+}
+
+/* Number of per channel multipliers of an op */
+static Int32 op_n_channels(const graph_blob_t *p_blob, const xa_nnlib_graph_op_desc_t *p_desc)
+{
+  if(p_desc->type == XA_NNLIB_GRAPH_OP_CONV2D ||
+     p_desc->type == XA_NNLIB_GRAPH_OP_DEPTHWISE_CONV2D ||
+     p_desc->type == XA_NNLIB_GRAPH_OP_POINTWISE_CONV2D)
+  {
+    if(p_desc->output < 0 || p_desc->output >= p_blob->p_header->n_tensors)
+      return 0;
+    return p_blob->p_tensors[p_desc->output].channels;
+  }
+  return 0;
+}
+
+static Int32 get_persistent_size(const graph_blob_t *p_blob)
+{
+  Int32 itr, n_ops = p_blob->p_header->n_ops, n_tensors = p_blob->p_header->n_tensors;
+  Int32 size, n_channels = 0;
+
+  for(itr = 0; itr < n_ops; itr++)
+  {
+    n_channels += op_n_channels(p_blob, &p_blob->p_ops[itr]);
+  }
+
+  size  = ALIGN_SIZE(sizeof(graph_state_t));
+  size += ALIGN_SIZE(n_ops * sizeof(graph_op_t));
+  size += ALIGN_SIZE(n_tensors * sizeof(Int32));
+  size += 2 * ALIGN_SIZE(n_channels * sizeof(WORD32));
+  /* Planner input, only used during init */
+  size += ALIGN_SIZE(n_ops * sizeof(xa_nnlib_planner_op_t));
+  size += ALIGN_SIZE(n_tensors * sizeof(xa_nnlib_planner_tensor_t));
+
+  return size;
+}
+
+/* Checks that [offset, offset + size) lies in the constant section */
+static Int32 check_const(const graph_blob_t *p_blob, Int32 offset, Int32 size, Int32 alignment)
+{
+  if(offset < 0 || size <= 0 || (offset & (alignment - 1)) != 0 ||
+     offset > p_blob->p_header->const_size - size)
+    return XA_NNLIB_GRAPH_CONFIG_FATAL_INVALID_CONST;
+  return XA_NNLIB_NO_ERROR;
+}
+
+/* RELU / RELU6 for the kernels without an activation range. Pooling and
+ * the unaligned FC fallback only, the other ops clamp in the kernel. */
+static void clamp_in_place(WORD8 *p_data, Int32 act_min, Int32 act_max, Int32 size)
+{
+  Int32 itr;
+
+  if(act_min <= -128 && act_max >= 127)
+    return;
+  for(itr = 0; itr < size; itr++)
+  {
+    Int32 val = p_data[itr];
+    val = val < act_min ? act_min : val;
+    val = val > act_max ? act_max : val;
+    p_data[itr] = (WORD8)val;
+  }
+}
+
+static void activation_range(Int32 activation, const xa_nnlib_graph_tensor_desc_t *p_out, Int32 *p_min, Int32 *p_max)
+{
+  Int32 act_min = -128, act_max = 127;
+
+  if(activation == XA_NNLIB_GRAPH_ACT_RELU || activation == XA_NNLIB_GRAPH_ACT_RELU6)
+  {
+    act_min = p_out->zero_point > act_min ? p_out->zero_point : act_min;
+  }
+  if(activation == XA_NNLIB_GRAPH_ACT_RELU6)
+  {
+    Int32 six = p_out->zero_point + (Int32)floor(6.0 / p_out->scale + 0.5);
+    act_max = six < act_max ? six : act_max;
+  }
+  *p_min = act_min;
+  *p_max = act_max;
+}
+
+/* Validates one op and derives its kernel parameters */
+static Int32 prepare_op(const graph_blob_t *p_blob,
+                        const xa_nnlib_graph_op_desc_t *p_desc,
+                        graph_op_t *p_op,
+                        xa_nnlib_planner_op_t *p_plan_op,
+                        WORD32 **pp_channel_params)
+{
+  const xa_nnlib_graph_tensor_desc_t *p_inp, *p_inp2 = NULL, *p_out;
+  Int32 n_tensors = p_blob->p_header->n_tensors;
+  Int32 n_inputs = p_desc->type == XA_NNLIB_GRAPH_OP_ADD ? 2 : 1;
+  Int32 itr, ret, weight_size = 0, n_scales = 0, n_bias = 0;
+
+  if(p_desc->type < XA_NNLIB_GRAPH_OP_CONV2D || p_desc->type > XA_NNLIB_GRAPH_OP_SOFTMAX)
+    return XA_NNLIB_GRAPH_CONFIG_FATAL_INVALID_OP_TYPE;
+  for(itr = 0; itr < n_inputs; itr++)
+  {
+    if(p_desc->input[itr] < 0 || p_desc->input[itr] >= n_tensors)
+      return XA_NNLIB_GRAPH_CONFIG_FATAL_INVALID_TENSOR;
+  }
+  if(p_desc->output < 0 || p_desc->output >= n_tensors)
+    return XA_NNLIB_GRAPH_CONFIG_FATAL_INVALID_TENSOR;
+  if(p_desc->activation < XA_NNLIB_GRAPH_ACT_NONE || p_desc->activation > XA_NNLIB_GRAPH_ACT_RELU6)
+    return XA_NNLIB_GRAPH_CONFIG_FATAL_INVALID_OP_PARAMS;
+
+  p_inp = &p_blob->p_tensors[p_desc->input[0]];
+  p_out = &p_blob->p_tensors[p_desc->output];
+  if(n_inputs == 2)
+    p_inp2 = &p_blob->p_tensors[p_desc->input[1]];
+
+  memset(p_op, 0, sizeof(graph_op_t));
+  memset(p_plan_op, 0, sizeof(xa_nnlib_planner_op_t));
+  p_op->type = p_desc->type;
+  p_op->input[0] = p_desc->input[0];
+  p_op->input[1] = n_inputs == 2 ? p_desc->input[1] : -1;
+  p_op->output = p_desc->output;
+  p_op->input_height = p_inp->height;
+  p_op->input_width = p_inp->width;
+  p_op->input_channels = p_inp->channels;
+  p_op->out_height = p_out->height;
+  p_op->out_width = p_out->width;
+  p_op->out_channels = p_out->channels;
+  p_op->kernel_height = p_desc->kernel_height;
+  p_op->kernel_width = p_desc->kernel_width;
+  p_op->x_stride = p_desc->x_stride;
+  p_op->y_stride = p_desc->y_stride;
+  p_op->x_padding = p_desc->x_padding;
+  p_op->y_padding = p_desc->y_padding;
+  p_op->input_zero_bias[0] = -p_inp->zero_point;
+  p_op->input_zero_bias[1] = n_inputs == 2 ? -p_inp2->zero_point : 0;
+  p_op->out_zero_bias = p_out->zero_point;
+  activation_range(p_desc->activation, p_out, &p_op->activation_min, &p_op->activation_max);
+
+  switch(p_desc->type)
+  {
+    case XA_NNLIB_GRAPH_OP_CONV2D:
+    case XA_NNLIB_GRAPH_OP_DEPTHWISE_CONV2D:
+    case XA_NNLIB_GRAPH_OP_AVGPOOL:
+    case XA_NNLIB_GRAPH_OP_MAXPOOL:
+      if(p_desc->kernel_height <= 0 || p_desc->kernel_width <= 0 ||
+         p_desc->x_stride <= 0 || p_desc->y_stride <= 0 ||
+         p_desc->x_padding < 0 || p_desc->y_padding < 0)
+        return XA_NNLIB_GRAPH_CONFIG_FATAL_INVALID_OP_PARAMS;
+      if(p_desc->type != XA_NNLIB_GRAPH_OP_CONV2D && p_inp->channels != p_out->channels)
+        return XA_NNLIB_GRAPH_CONFIG_FATAL_INVALID_OP_PARAMS;
+      p_plan_op->params.conv.input_height = p_inp->height;
+      p_plan_op->params.conv.input_width = p_inp->width;
+      p_plan_op->params.conv.input_channels = p_inp->channels;
+      p_plan_op->params.conv.kernel_height = p_desc->kernel_height;
+      p_plan_op->params.conv.kernel_width = p_desc->kernel_width;
+      p_plan_op->params.conv.kernel_channels = p_inp->channels;
+      p_plan_op->params.conv.channels_multiplier = 1;
+      p_plan_op->params.conv.x_stride = p_desc->x_stride;
+      p_plan_op->params.conv.y_stride = p_desc->y_stride;
+      p_plan_op->params.conv.x_padding = p_desc->x_padding;
+      p_plan_op->params.conv.y_padding = p_desc->y_padding;
+      p_plan_op->params.conv.out_height = p_out->height;
+      p_plan_op->params.conv.out_width = p_out->width;
+      p_plan_op->params.conv.out_channels = p_out->channels;
+      p_plan_op->params.conv.dilation_height = 1;
+      p_plan_op->params.conv.dilation_width = 1;
+      p_plan_op->params.conv.input_precision = PREC_ASYM8S;
+      p_plan_op->params.conv.kernel_precision = PREC_SYM8S;
+      p_plan_op->params.conv.out_precision = PREC_ASYM8S;
+      break;
+    case XA_NNLIB_GRAPH_OP_POINTWISE_CONV2D:
+    case XA_NNLIB_GRAPH_OP_ADD:
+      if(p_inp->height != p_out->height || p_inp->width != p_out->width)
+        return XA_NNLIB_GRAPH_CONFIG_FATAL_INVALID_OP_PARAMS;
+      break;
+    case XA_NNLIB_GRAPH_OP_SOFTMAX:
+      if(p_inp->height != p_out->height || p_inp->width != p_out->width ||
+         p_inp->channels != p_out->channels)
+        return XA_NNLIB_GRAPH_CONFIG_FATAL_INVALID_OP_PARAMS;
+      break;
+    default:
+      break;
+  }
+
+  switch(p_desc->type)
+  {
+    case XA_NNLIB_GRAPH_OP_CONV2D:
+      p_plan_op->type = XA_NNLIB_PLANNER_OP_CONV2D_STD;
+      weight_size = p_out->channels * p_desc->kernel_height * p_desc->kernel_width * p_inp->channels;
+      n_scales = n_bias = p_out->channels;
+      break;
+    case XA_NNLIB_GRAPH_OP_DEPTHWISE_CONV2D:
+      p_plan_op->type = XA_NNLIB_PLANNER_OP_CONV2D_DEPTHWISE;
+      weight_size = p_desc->kernel_height * p_desc->kernel_width * p_out->channels;
+      n_scales = n_bias = p_out->channels;
+      break;
+    case XA_NNLIB_GRAPH_OP_POINTWISE_CONV2D:
+      p_plan_op->type = XA_NNLIB_PLANNER_OP_CUSTOM;
+      weight_size = p_out->channels * p_inp->channels;
+      n_scales = n_bias = p_out->channels;
+      break;
+    case XA_NNLIB_GRAPH_OP_FULLY_CONNECTED:
+      p_plan_op->type = XA_NNLIB_PLANNER_OP_CUSTOM;
+      p_op->input_channels = p_inp->height * p_inp->width * p_inp->channels;
+      p_op->out_channels = p_out->height * p_out->width * p_out->channels;
+      weight_size = p_op->out_channels * p_op->input_channels;
+      n_bias = p_op->out_channels;
+      n_scales = 1;
+      break;
+    case XA_NNLIB_GRAPH_OP_AVGPOOL:
+    case XA_NNLIB_GRAPH_OP_MAXPOOL:
+      /* Pooling works on raw 8 bit values, output quantization must match */
+      if(p_inp->zero_point != p_out->zero_point || p_inp->scale != p_out->scale)
+        return XA_NNLIB_GRAPH_CONFIG_FATAL_INVALID_QUANT;
+      p_plan_op->type = p_desc->type == XA_NNLIB_GRAPH_OP_AVGPOOL ? XA_NNLIB_PLANNER_OP_AVGPOOL : XA_NNLIB_PLANNER_OP_MAXPOOL;
+      p_plan_op->params.conv.input_precision = 8;
+      p_plan_op->params.conv.out_precision = 8;
+      break;
+    case XA_NNLIB_GRAPH_OP_ADD:
+      if(p_inp2->height != p_out->height || p_inp2->width != p_out->width ||
+         p_inp->channels != p_out->channels || p_inp2->channels != p_out->channels)
+        return XA_NNLIB_GRAPH_CONFIG_FATAL_INVALID_OP_PARAMS;
+      p_plan_op->type = XA_NNLIB_PLANNER_OP_CUSTOM;
+      break;
+    case XA_NNLIB_GRAPH_OP_SOFTMAX:
+      /* Output fixed at scale 1/256, zero point -128 */
+      if(p_out->zero_point != -128 || p_out->scale != 1.0f / 256 || p_desc->beta <= 0)
+        return XA_NNLIB_GRAPH_CONFIG_FATAL_INVALID_QUANT;
+      p_plan_op->type = XA_NNLIB_PLANNER_OP_SOFTMAX;
+      p_plan_op->params.softmax.inp_precision = PREC_ASYM8S;
+      p_plan_op->params.softmax.out_precision = PREC_ASYM8S;
+      p_plan_op->params.softmax.length = p_inp->channels;
+      break;
+    default:
+      break;
+  }
+
+  if(weight_size > 0)
+  {
+    const Flt32 *p_scales;
+
+    ret = check_const(p_blob, p_desc->weight_offset, weight_size, 1);
+    if(ret != XA_NNLIB_NO_ERROR)
+      return ret;
+    ret = check_const(p_blob, p_desc->bias_offset, n_bias * sizeof(WORD32), sizeof(WORD32));
+    if(ret != XA_NNLIB_NO_ERROR)
+      return ret;
+    ret = check_const(p_blob, p_desc->weight_scale_offset, n_scales * sizeof(Flt32), sizeof(Flt32));
+    if(ret != XA_NNLIB_NO_ERROR)
+      return ret;
+    p_op->p_weight = p_blob->p_const + p_desc->weight_offset;
+    p_op->p_bias = (const WORD32 *)(p_blob->p_const + p_desc->bias_offset);
+    p_scales = (const Flt32 *)(p_blob->p_const + p_desc->weight_scale_offset);
+
+    if(n_scales == 1)
+    {
+      ret = quantize_multiplier((double)p_inp->scale * p_scales[0] / p_out->scale,
+                                &p_op->out_multiplier, &p_op->out_shift);
+      if(ret != 0)
+        return XA_NNLIB_GRAPH_CONFIG_FATAL_INVALID_QUANT;
+    }
+    else
+    {
+      p_op->p_out_multiplier = *pp_channel_params;
+      p_op->p_out_shift = *pp_channel_params + n_scales;
+      *pp_channel_params += 2 * n_scales;
+      for(itr = 0; itr < n_scales; itr++)
+      {
+        ret = quantize_multiplier((double)p_inp->scale * p_scales[itr] / p_out->scale,
+                                  &p_op->p_out_multiplier[itr], &p_op->p_out_shift[itr]);
+        if(ret != 0)
+          return XA_NNLIB_GRAPH_CONFIG_FATAL_INVALID_QUANT;
+      }
+    }
+  }
+
+  if(p_desc->type == XA_NNLIB_GRAPH_OP_ADD)
+  {
+    double twice_max_scale = 2.0 * (p_inp->scale > p_inp2->scale ? p_inp->scale : p_inp2->scale);
+
+    p_op->left_shift = ADD_LEFT_SHIFT;
+    if(quantize_multiplier(p_inp->scale / twice_max_scale, &p_op->input_multiplier[0], &p_op->input_shift[0]) ||
+       quantize_multiplier(p_inp2->scale / twice_max_scale, &p_op->input_multiplier[1], &p_op->input_shift[1]) ||
+       quantize_multiplier(twice_max_scale / ((1 << ADD_LEFT_SHIFT) * (double)p_out->scale), &p_op->out_multiplier, &p_op->out_shift))
+      return XA_NNLIB_GRAPH_CONFIG_FATAL_INVALID_QUANT;
+  }
+  else if(p_desc->type == XA_NNLIB_GRAPH_OP_SOFTMAX)
+  {
+    double beta_real = (double)p_desc->beta * p_inp->scale * (double)(1 << (31 - SOFTMAX_INPUT_INT_BITS));
+    double max_input_rescaled;
+
+    beta_real = beta_real < 2147483647.0 ? beta_real : 2147483647.0;
+    if(quantize_multiplier(beta_real, &p_op->out_multiplier, &p_op->left_shift) || p_op->left_shift < 0)
+      return XA_NNLIB_GRAPH_CONFIG_FATAL_INVALID_QUANT;
+    max_input_rescaled = (double)((1 << SOFTMAX_INPUT_INT_BITS) - 1) *
+                         (double)(1LL << (31 - SOFTMAX_INPUT_INT_BITS)) /
+                         (double)(1LL << p_op->left_shift);
+    p_op->diffmin = -(Int32)floor(max_input_rescaled);
+  }
+
+  return XA_NNLIB_NO_ERROR;
+}
+
+Int32 xa_nnlib_graph_get_persistent_fast(const void *p_graph, Int32 graph_size)
+{
+  graph_blob_t blob;
+  Int32 ret;
+
+  ret = parse_graph(&blob, p_graph, graph_size);
+  if(ret != XA_NNLIB_NO_ERROR)
+    return ret;
+
+  return get_persistent_size(&blob);
+}
+
+Int32 xa_nnlib_graph_get_scratch(xa_nnlib_handle_t handle)
+{
+  CHECK_PTR(handle, XA_NNLIB_FATAL_MEM_ALLOC);
+
+  return ((graph_state_t *)handle)->scratch_size;
+}
+
+Int32 xa_nnlib_graph_init(xa_nnlib_handle_t handle, const void *p_graph, Int32 graph_size)
+{
+  graph_state_t *graph;
+  graph_blob_t blob;
+  xa_nnlib_planner_op_t *p_plan_ops;
+  xa_nnlib_planner_tensor_t *p_plan_tensors;
+  WORD32 *p_channel_params;
+  WORD8 *p_mem;
+  Int32 ret, itr, inp, n_ops, n_tensors, n_channels = 0;
+
+  CHECK_PTR(handle, XA_NNLIB_FATAL_MEM_ALLOC);
+  CHECK_PTR_ALIGN(handle, 8, XA_NNLIB_FATAL_MEM_ALIGN);
+
+  ret = parse_graph(&blob, p_graph, graph_size);
+  if(ret != XA_NNLIB_NO_ERROR)
+    return ret;
+
+  n_ops = blob.p_header->n_ops;
+  n_tensors = blob.p_header->n_tensors;
+  for(itr = 0; itr < n_ops; itr++)
+  {
+    n_channels += op_n_channels(&blob, &blob.p_ops[itr]);
+  }
+
+  /* Persistent layout: state, ops, tensor offsets, per channel multipliers
+   * and shifts, planner tables */
+  p_mem = (WORD8 *)handle;
+  graph = (graph_state_t *)p_mem;
+  p_mem += ALIGN_SIZE(sizeof(graph_state_t));
+  graph->p_ops = (graph_op_t *)p_mem;
+  p_mem += ALIGN_SIZE(n_ops * sizeof(graph_op_t));
+  graph->p_tensor_offset = (Int32 *)p_mem;
+  p_mem += ALIGN_SIZE(n_tensors * sizeof(Int32));
+  p_channel_params = (WORD32 *)p_mem;
+  p_mem += 2 * ALIGN_SIZE(n_channels * sizeof(WORD32));
+  p_plan_ops = (xa_nnlib_planner_op_t *)p_mem;
+  p_mem += ALIGN_SIZE(n_ops * sizeof(xa_nnlib_planner_op_t));
+  p_plan_tensors = (xa_nnlib_planner_tensor_t *)p_mem;
+
+  graph->n_ops = n_ops;
+  graph->n_tensors = n_tensors;
+  graph->input_tensor = blob.p_header->input_tensor;
+  graph->output_tensor = blob.p_header->output_tensor;
+  graph->scratch_size = 0;
+
+  for(itr = 0; itr < n_tensors; itr++)
+  {
+    const xa_nnlib_graph_tensor_desc_t *p_tensor = &blob.p_tensors[itr];
+    if(p_tensor->height <= 0 || p_tensor->width <= 0 || p_tensor->channels <= 0 ||
+       p_tensor->zero_point < -128 || p_tensor->zero_point > 127 || !(p_tensor->scale > 0))
+      return XA_NNLIB_GRAPH_CONFIG_FATAL_INVALID_TENSOR;
+
+    /* first_op = -1 marks a tensor not yet produced */
+    p_plan_tensors[itr].size = (itr == graph->input_tensor || itr == graph->output_tensor) ?
+                               0 : p_tensor->height * p_tensor->width * p_tensor->channels;
+    p_plan_tensors[itr].first_op = itr == graph->input_tensor ? 0 : -1;
+    p_plan_tensors[itr].last_op = 0;
+  }
+
+  /* Ops must come in execution order: every input produced by an earlier
+   * op or bound to the graph input, every tensor produced once */
+  for(itr = 0; itr < n_ops; itr++)
+  {
+    graph_op_t *p_op = &graph->p_ops[itr];
+
+    ret = prepare_op(&blob, &blob.p_ops[itr], p_op, &p_plan_ops[itr], &p_channel_params);
+    if(ret != XA_NNLIB_NO_ERROR)
+      return ret;
+
+    for(inp = 0; inp < 2 && p_op->input[inp] >= 0; inp++)
+    {
+      if(p_plan_tensors[p_op->input[inp]].first_op < 0)
+        return XA_NNLIB_GRAPH_CONFIG_FATAL_INVALID_TENSOR;
+      p_plan_tensors[p_op->input[inp]].last_op = itr;
+    }
+    if(p_op->output == graph->input_tensor || p_plan_tensors[p_op->output].first_op >= 0)
+      return XA_NNLIB_GRAPH_CONFIG_FATAL_INVALID_TENSOR;
+    p_plan_tensors[p_op->output].first_op = itr;
+    p_plan_tensors[p_op->output].last_op = itr;
+  }
+  if(p_plan_tensors[graph->output_tensor].first_op < 0)
+    return XA_NNLIB_GRAPH_CONFIG_FATAL_INVALID_TENSOR;
+
+  /* Tensors never produced are unused, give them an empty lifetime */
+  for(itr = 0; itr < n_tensors; itr++)
+  {
+    if(p_plan_tensors[itr].first_op < 0)
+    {
+      p_plan_tensors[itr].size = 0;
+      p_plan_tensors[itr].first_op = 0;
+    }
+  }
+
+  ret = xa_nnlib_planner_plan(p_plan_ops, n_ops, p_plan_tensors, n_tensors, ARENA_ALIGNMENT, &graph->scratch_size);
+  if(ret != XA_NNLIB_NO_ERROR)
+    return ret;
+
+  for(itr = 0; itr < n_tensors; itr++)
+  {
+    graph->p_tensor_offset[itr] = p_plan_tensors[itr].offset;
+  }
+  for(itr = 0; itr < n_ops; itr++)
+  {
+    graph->p_ops[itr].scratch_offset = p_plan_ops[itr].scratch_offset;
+  }
+
+  return XA_NNLIB_NO_ERROR;
+}
+
+Int32 xa_nnlib_graph_process(xa_nnlib_handle_t handle,
+                             void *scratch,
+                             const void *input,
+                             void *output)
+{
+  graph_state_t *graph;
+  Int32 itr, row, ret = 0;
+
+  CHECK_PTR(handle, XA_NNLIB_FATAL_MEM_ALLOC);
+  CHECK_PTR(scratch, XA_NNLIB_FATAL_MEM_ALLOC);
+  CHECK_PTR(input, XA_NNLIB_FATAL_MEM_ALLOC);
+  CHECK_PTR(output, XA_NNLIB_FATAL_MEM_ALLOC);
+  CHECK_PTR_ALIGN(scratch, ARENA_ALIGNMENT, XA_NNLIB_FATAL_MEM_ALIGN);
+
+  graph = (graph_state_t *)handle;
+
+#define TENSOR_PTR(idx) ((idx) == graph->input_tensor ? (WORD8 *)input : \
+                         (idx) == graph->output_tensor ? (WORD8 *)output : \
+                         (WORD8 *)scratch + graph->p_tensor_offset[idx])
+
+  for(itr = 0; itr < graph->n_ops; itr++)
+  {
+    const graph_op_t *p_op = &graph->p_ops[itr];
+    WORD8 *p_inp = TENSOR_PTR(p_op->input[0]);
+    WORD8 *p_out = TENSOR_PTR(p_op->output);
+    VOID *p_scratch = (WORD8 *)scratch + p_op->scratch_offset;
+    Int32 out_size = p_op->out_height * p_op->out_width * p_op->out_channels;
+
+    switch(p_op->type)
+    {
+      case XA_NNLIB_GRAPH_OP_CONV2D:
+        ret = xa_nn_conv2d_std_v2_per_chan_sym8sxasym8s(p_out, p_inp, p_op->p_weight, p_op->p_bias,
+            p_op->input_height, p_op->input_width, p_op->input_channels,
+            p_op->kernel_height, p_op->kernel_width, p_op->out_channels,
+            p_op->x_stride, p_op->y_stride, p_op->x_padding, p_op->y_padding,
+            p_op->out_height, p_op->out_width, p_op->input_zero_bias[0],
+            p_op->p_out_multiplier, p_op->p_out_shift, p_op->out_zero_bias, 0, p_scratch,
+            p_op->activation_min, p_op->activation_max, NULL);
+        break;
+      case XA_NNLIB_GRAPH_OP_DEPTHWISE_CONV2D:
+        ret = xa_nn_conv2d_depthwise_v2_per_chan_sym8sxasym8s(p_out, p_op->p_weight, p_inp, p_op->p_bias,
+            p_op->input_height, p_op->input_width, p_op->input_channels,
+            p_op->kernel_height, p_op->kernel_width, 1,
+            p_op->x_stride, p_op->y_stride, p_op->x_padding, p_op->y_padding,
+            p_op->out_height, p_op->out_width, p_op->input_zero_bias[0],
+            p_op->p_out_multiplier, p_op->p_out_shift, p_op->out_zero_bias, 0, 0, p_scratch,
+            p_op->activation_min, p_op->activation_max, NULL);
+        break;
+      case XA_NNLIB_GRAPH_OP_POINTWISE_CONV2D:
+        ret = xa_nn_conv2d_pointwise_v2_per_chan_sym8sxasym8s(p_out, (WORD8 *)p_op->p_weight, p_inp, (WORD32 *)p_op->p_bias,
+            p_op->input_height, p_op->input_width, p_op->input_channels, p_op->out_channels,
+            p_op->input_zero_bias[0], p_op->p_out_multiplier, p_op->p_out_shift, p_op->out_zero_bias, 0,
+            p_op->activation_min, p_op->activation_max, NULL);
+        break;
+      case XA_NNLIB_GRAPH_OP_FULLY_CONNECTED:
+        /* The v2 kernel clamps in place but needs 16 byte aligned operands */
+        if(FC_V2_ALIGNED(p_out) && FC_V2_ALIGNED(p_inp) &&
+           FC_V2_ALIGNED(p_op->p_weight) && FC_V2_ALIGNED(p_op->p_bias))
+        {
+          ret = xa_nn_fully_connected_v2_asym8sxasym8s_asym8s(p_out, p_op->p_weight, p_inp, p_op->p_bias,
+              p_op->input_channels, p_op->out_channels, p_op->input_zero_bias[0], 0,
+              p_op->out_multiplier, p_op->out_shift, p_op->out_zero_bias,
+              p_op->activation_min, p_op->activation_max, NULL);
+        }
+        else
+        {
+          ret = xa_nn_fully_connected_sym8sxasym8s_asym8s(p_out, p_op->p_weight, p_inp, p_op->p_bias,
+              p_op->input_channels, p_op->out_channels, p_op->input_zero_bias[0],
+              p_op->out_multiplier, p_op->out_shift, p_op->out_zero_bias);
+          clamp_in_place(p_out, p_op->activation_min, p_op->activation_max, out_size);
+        }
+        break;
+      case XA_NNLIB_GRAPH_OP_AVGPOOL:
+        ret = xa_nn_avgpool_8(p_out, p_inp, p_op->input_height, p_op->input_width, p_op->input_channels,
+            p_op->kernel_height, p_op->kernel_width, p_op->x_stride, p_op->y_stride,
+            p_op->x_padding, p_op->y_padding, p_op->out_height, p_op->out_width, 0, 0, p_scratch);
+        clamp_in_place(p_out, p_op->activation_min, p_op->activation_max, out_size);
+        break;
+      case XA_NNLIB_GRAPH_OP_MAXPOOL:
+        ret = xa_nn_maxpool_8(p_out, p_inp, p_op->input_height, p_op->input_width, p_op->input_channels,
+            p_op->kernel_height, p_op->kernel_width, p_op->x_stride, p_op->y_stride,
+            p_op->x_padding, p_op->y_padding, p_op->out_height, p_op->out_width, 0, 0, p_scratch);
+        clamp_in_place(p_out, p_op->activation_min, p_op->activation_max, out_size);
+        break;
+      case XA_NNLIB_GRAPH_OP_ADD:
+        ret = xa_nn_elm_add_asym8sxasym8s_asym8s(p_out, p_op->out_zero_bias, p_op->out_shift, p_op->out_multiplier,
+            p_op->activation_min, p_op->activation_max,
+            p_inp, p_op->input_zero_bias[0], p_op->input_shift[0], p_op->input_multiplier[0],
+            TENSOR_PTR(p_op->input[1]), p_op->input_zero_bias[1], p_op->input_shift[1], p_op->input_multiplier[1],
+            p_op->left_shift, out_size);
+        break;
+      case XA_NNLIB_GRAPH_OP_SOFTMAX:
+        for(row = 0; row < p_op->out_height * p_op->out_width && ret == 0; row++)
+        {
+          ret = xa_nn_vec_softmax_asym8s_asym8s(p_out + row * p_op->out_channels, p_inp + row * p_op->out_channels,
+              p_op->diffmin, p_op->left_shift, p_op->out_multiplier, p_op->out_channels, p_scratch);
+        }
+        break;
+      default:
+        break;
+    }
+    if(ret != 0)
+      return XA_NNLIB_GRAPH_EXECUTE_FATAL_KERNEL_FAILED;
+  }
+
+#undef TENSOR_PTR
+
+  return XA_NNLIB_NO_ERROR;
+}
@@ -0,0 +1,219 @@
+/*******************************************************************************
+* Copyright (c) 2018-2025 Cadence Design Systems, Inc.
+*
+* Permission is hereby granted, free of charge, to any person obtaining
+* a copy of this software and associated documentation files (the
+* "Software"), to use this Software with Cadence processor cores only and
+* not with any other processors and platforms, subject to
+* the following conditions:
+*
+* The above copyright notice and this permission notice shall be included
+* in all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+******************************************************************************/
+/* Layer calls go through the traced kernel entry points */
+#define XA_NNLIB_TRACE_CALLER
+#include "xa_nnlib_common.h"
+#include "xa_nnlib_planner_api.h"
+
+#define CHECK_PTR(ptr, err) if(NULL == ptr) return err;
+
+/* Buffer idx of the plan: tensors first, then one kernel scratch per op */
+#define BUF_SIZE(idx)   ((idx) < n_tensors ? p_tensors[idx].size : p_ops[(idx) - n_tensors].scratch_size)
+#define BUF_FIRST(idx)  ((idx) < n_tensors ? p_tensors[idx].first_op : (idx) - n_tensors)
+#define BUF_LAST(idx)   ((idx) < n_tensors ? p_tensors[idx].last_op : (idx) - n_tensors)
+#define BUF_OFFSET(idx) (*((idx) < n_tensors ? &p_tensors[idx].offset : &p_ops[(idx) - n_tensors].scratch_offset))
+
+#define LIVE_TOGETHER(a, b) (BUF_FIRST(a) <= BUF_LAST(b) && BUF_FIRST(b) <= BUF_LAST(a))
+
+Int32 xa_nnlib_planner_get_op_scratch_size(const xa_nnlib_planner_op_t *p_op)
+{
+  const xa_nnlib_planner_conv_params_t *p;
+  Int32 size;
+
+  CHECK_PTR(p_op, XA_NNLIB_FATAL_MEM_ALLOC);
+  p = &p_op->params.conv;
+
+  switch(p_op->type)
+  {
+    case XA_NNLIB_PLANNER_OP_CUSTOM:
+      size = p_op->params.scratch.size;
+      break;
+    case XA_NNLIB_PLANNER_OP_CONV2D_STD:
+      size = xa_nn_conv2d_std_getsize(p->input_height, p->input_width, p->input_channels,
+                                      p->kernel_height, p->kernel_width, p->kernel_channels,
+                                      p->y_stride, p->y_padding, p->x_stride, p->x_padding,
+                                      p->out_height, p->out_width, p->out_channels,
+                                      p->input_precision, p->kernel_precision,
+                                      p->dilation_height, p->dilation_width, p->out_data_format);
+      break;
+    case XA_NNLIB_PLANNER_OP_CONV2D:
+      size = xa_nn_conv2d_getsize(p->input_height, p->input_width, p->input_channels,
+                                  p->kernel_height, p->kernel_width, p->kernel_channels,
+                                  p->dilation_height, p->dilation_width,
+                                  p->y_stride, p->y_padding, p->x_stride, p->x_padding,
+                                  p->out_height, p->out_width, p->out_channels,
+                                  p->input_precision, p->kernel_precision, p->out_data_format);
+      break;
+    case XA_NNLIB_PLANNER_OP_CONV2D_DEPTHWISE:
+      size = xa_nn_conv2d_depthwise_getsize(p->input_height, p->input_width, p->input_channels,
+                                            p->kernel_height, p->kernel_width, p->channels_multiplier,
+                                            p->x_stride, p->y_stride, p->x_padding, p->y_padding,
+                                            p->out_height, p->out_width,
+                                            p->input_precision, p->inp_data_format);
+      break;
+    case XA_NNLIB_PLANNER_OP_TRANSPOSE_CONV:
+      size = xa_nn_transpose_conv_getsize(p->input_height, p->input_width, p->input_channels,
+                                          p->kernel_height, p->kernel_width, p->x_stride, p->y_stride,
+                                          p->out_height, p->out_width, p->out_channels,
+                                          p->num_groups, p->kernel_precision, p->out_precision);
+      break;
+    case XA_NNLIB_PLANNER_OP_AVGPOOL:
+      size = xa_nn_avgpool_getsize(p->input_channels, p->input_precision, p->out_precision,
+                                   p->input_height, p->input_width, p->kernel_height, p->kernel_width,
+                                   p->x_stride, p->y_stride, p->x_padding, p->y_padding,
+                                   p->out_height, p->out_width, p->inp_data_format, p->out_data_format);
+      break;
+    case XA_NNLIB_PLANNER_OP_MAXPOOL:
+      size = xa_nn_maxpool_getsize(p->input_channels, p->input_precision, p->out_precision,
+                                   p->input_height, p->input_width, p->kernel_height, p->kernel_width,
+                                   p->x_stride, p->y_stride, p->x_padding, p->y_padding,
+                                   p->out_height, p->out_width, p->inp_data_format, p->out_data_format);
+      break;
+    case XA_NNLIB_PLANNER_OP_SOFTMAX:
+      size = get_softmax_scratch_size(p_op->params.softmax.inp_precision,
+                                      p_op->params.softmax.out_precision,
+                                      p_op->params.softmax.length);
+      break;
+    case XA_NNLIB_PLANNER_OP_REDUCE:
+      size = xa_nn_reduce_getsize_nhwc(p_op->params.reduce.inp_precision,
+                                       p_op->params.reduce.inp_shape,
+                                       p_op->params.reduce.num_inp_dims,
+                                       p_op->params.reduce.axis,
+                                       p_op->params.reduce.num_axis_dims,
+                                       p_op->params.reduce.reduce_ops);
+      break;
+    case XA_NNLIB_PLANNER_OP_BATCH_MATMUL:
+      size = xa_nn_batch_matmul_getsize(p_op->params.batch_matmul.mat1_shape,
+                                        p_op->params.batch_matmul.mat2_shape,
+                                        p_op->params.batch_matmul.mat1_transpose,
+                                        p_op->params.batch_matmul.mat2_transpose,
+                                        p_op->params.batch_matmul.mat1_precision,
+                                        p_op->params.batch_matmul.mat2_precision);
+      break;
+    case XA_NNLIB_PLANNER_OP_LSTM:
+      size = xa_nn_lstm_getsize(p_op->params.rnn.n_batch, p_op->params.rnn.n_itr,
+                                p_op->params.rnn.n_cell, p_op->params.rnn.state_precision);
+      break;
+    case XA_NNLIB_PLANNER_OP_GRU:
+      size = xa_nn_gru_getsize(p_op->params.rnn.n_batch, p_op->params.rnn.n_itr,
+                               p_op->params.rnn.n_cell, p_op->params.rnn.state_precision);
+      break;
+    default:
+      return XA_NNLIB_PLANNER_CONFIG_FATAL_INVALID_OP_TYPE;
+  }
+
+  if(size < 0)
+    return XA_NNLIB_PLANNER_CONFIG_FATAL_INVALID_OP_PARAMS;
+
+  return size;
+}
+
+Int32 xa_nnlib_planner_plan(xa_nnlib_planner_op_t *p_ops,
+                            Int32 n_ops,
+                            xa_nnlib_planner_tensor_t *p_tensors,
+                            Int32 n_tensors,
+                            Int32 alignment,
+                            Int32 *p_arena_size)
+{
+  Int32 n_bufs, itr, buf, cand_buf, other, arena_size;
+
+  CHECK_PTR(p_ops, XA_NNLIB_FATAL_MEM_ALLOC);
+  CHECK_PTR(p_arena_size, XA_NNLIB_FATAL_MEM_ALLOC);
+  if(n_tensors > 0)
+  {
+    CHECK_PTR(p_tensors, XA_NNLIB_FATAL_MEM_ALLOC);
+  }
+  if(n_ops <= 0 || n_tensors < 0)
+    return XA_NNLIB_PLANNER_CONFIG_FATAL_INVALID_TENSOR;
+  if(alignment <= 0 || (alignment & (alignment - 1)) != 0)
+    return XA_NNLIB_PLANNER_CONFIG_FATAL_INVALID_ALIGNMENT;
+
+  for(itr = 0; itr < n_tensors; itr++)
+  {
+    if(p_tensors[itr].size < 0 ||
+       p_tensors[itr].first_op < 0 ||
+       p_tensors[itr].last_op < p_tensors[itr].first_op ||
+       p_tensors[itr].last_op >= n_ops)
+      return XA_NNLIB_PLANNER_CONFIG_FATAL_INVALID_TENSOR;
+    p_tensors[itr].offset = -1;
+  }
+  for(itr = 0; itr < n_ops; itr++)
+  {
+    Int32 size = xa_nnlib_planner_get_op_scratch_size(&p_ops[itr]);
+    if(size < 0)
+      return size;
+    p_ops[itr].scratch_size = size;
+    p_ops[itr].scratch_offset = -1;
+  }
+
+  /* Greedy by size: place the largest unplaced buffer at the lowest aligned
+   * offset free during its whole lifetime. Candidate offsets are 0 and the
+   * ends of the placed buffers live at the same time. */
+  n_bufs = n_tensors + n_ops;
+  arena_size = 0;
+  for(itr = 0; itr < n_bufs; itr++)
+  {
+    Int32 best_offset = -1;
+
+    buf = -1;
+    for(cand_buf = 0; cand_buf < n_bufs; cand_buf++)
+    {
+      if(BUF_OFFSET(cand_buf) < 0 && (buf < 0 || BUF_SIZE(cand_buf) > BUF_SIZE(buf)))
+        buf = cand_buf;
+    }
+
+    for(cand_buf = -1; cand_buf < n_bufs; cand_buf++)
+    {
+      Int32 offset, conflict = 0;
+
+      if(cand_buf < 0)
+      {
+        offset = 0;
+      }
+      else
+      {
+        if(BUF_OFFSET(cand_buf) < 0 || !LIVE_TOGETHER(cand_buf, buf))
+          continue;
+        offset = (BUF_OFFSET(cand_buf) + BUF_SIZE(cand_buf) + alignment - 1) & ~(alignment - 1);
+      }
+      if(best_offset >= 0 && offset >= best_offset)
+        continue;
+
+      for(other = 0; other < n_bufs && !conflict; other++)
+      {
+        conflict = (BUF_OFFSET(other) >= 0 && LIVE_TOGETHER(other, buf) &&
+                    offset < BUF_OFFSET(other) + BUF_SIZE(other) &&
+                    BUF_OFFSET(other) < offset + BUF_SIZE(buf));
+      }
+      if(!conflict)
+        best_offset = offset;
+    }
+
+    BUF_OFFSET(buf) = best_offset;
+    if(best_offset + BUF_SIZE(buf) > arena_size)
+      arena_size = best_offset + BUF_SIZE(buf);
+  }
+
+  *p_arena_size = (arena_size + alignment - 1) & ~(alignment - 1);
+
+  return XA_NNLIB_NO_ERROR;
+}
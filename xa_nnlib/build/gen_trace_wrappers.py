@@ -0,0 +1,209 @@
+#
+# Copyright (c) 2018-2025 Cadence Design Systems, Inc.
+#
+# Permission is hereby granted, free of charge, to any person obtaining
+# a copy of this software and associated documentation files (the
+# "Software"), to use this Software with Cadence processor cores only and
+# not with any other processors and platforms, subject to
+# the following conditions:
+#
+# The above copyright notice and this permission notice shall be included
+# in all copies or substantial portions of the Software.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+# EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+# MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+# IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+# CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+# TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+# SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+#
+# Regenerates the ENABLE_TRACE=1 kernel wrappers from the public kernel API.
+# Run from the build directory after adding or changing an xa_nn_* entry
+# point:
+#   python3 gen_trace_wrappers.py
+#
+# Every xa_nn_* function declared in xa_nnlib_kernels_api.h and exported in
+# symbols_nnlib.txt gets a wrapper; its implementation is renamed to
+# <name>_untraced by xa_nnlib_trace_rename.h. Functions discarded by a
+# DISCARD_FUN* on some configurations get their wrapper under the inverse
+# condition. Exported xa_nn_* functions that cannot be wrapped stop the
+# script unless listed in NOT_TRACED.
+#
+# Kernel ids come from trace_kernel_ids.txt, new functions are appended to it
+# so ids stay the same across builds and releases.
+
+import os
+import re
+
+ROOT = os.path.join(os.path.dirname(os.path.abspath(__file__)), '..')
+API_HEADER = os.path.join(ROOT, 'include', 'nnlib', 'xa_nnlib_kernels_api.h')
+SYMBOLS = os.path.join(ROOT, 'build', 'symbols_nnlib.txt')
+RENAME_HEADER = os.path.join(ROOT, 'algo', 'common', 'include', 'xa_nnlib_trace_rename.h')
+WRAPPERS = os.path.join(ROOT, 'algo', 'common', 'src', 'xa_nnlib_trace_wrappers.c')
+KERNEL_IDS = os.path.join(ROOT, 'build', 'trace_kernel_ids.txt')
+
+# Return types the wrapper can forward, all of them 32 bit int
+RET_TYPES = ('WORD32', 'int', 'Int32')
+# Exported without a prototype in xa_nnlib_kernels_api.h
+NOT_TRACED = ('xa_nn_matXvec_out_stride_f32xf32_f32',
+              'xa_nn_matmul_v2_per_chan_sym8sxsym16s_asym16s')
+
+MAX_DIMS = 8
+# Integer arguments reported as shape, in argument order
+DIM_WORDS = ('height', 'width', 'channels', 'rows', 'cols', 'count', 'depth',
+             'length', 'num_elm', 'batch', 'n_itr', 'n_cell', 'hidden', 'num_inp_dims')
+NOT_DIM_WORDS = ('zero', 'shift', 'mult', 'stride', 'padding', 'offset', 'bias',
+                 'precision', 'format', 'dilation', 'pad', 'bits', 'axis', 'flag')
+
+
+def strip_comments(text):
+    text = re.sub(r'/\*.*?\*/', '', text, flags=re.S)
+    return re.sub(r'//[^\n]*', '', text)
+
+
+def license_header():
+    with open(os.path.join(ROOT, 'include', 'nnlib', 'xa_nnlib_kernels_api.h')) as f:
+        text = f.read()
+    return text[:text.index('*/') + 2] + '\n'
+
+
+def read_prototypes():
+    """(name, return type, params) of every xa_nn_* prototype"""
+    text = strip_comments(open(API_HEADER).read())
+    text = re.sub(r'^\s*#.*$', '', text, flags=re.M)
+    protos = []
+    seen = set()
+    for m in re.finditer(r'(\w+(?:\s*\*)*)\s*\b(xa_nn_\w+)\s*\(([^;{]*?)\)\s*;', text):
+        ret, name, params = ' '.join(m.group(1).split()), m.group(2), ' '.join(m.group(3).split())
+        if name not in seen:
+            seen.add(name)
+            protos.append((name, ret, params))
+    return protos
+
+
+def kernel_ids(names):
+    """Ids from KERNEL_IDS, unknown names are appended with the next free id"""
+    lines = open(KERNEL_IDS).read().splitlines()
+    ids = {}
+    for line in lines:
+        if line.strip() and not line.startswith('#'):
+            kernel_id, name = line.split()
+            ids[name] = int(kernel_id)
+    new = [n for n in names if n not in ids]
+    if new:
+        next_id = max(ids.values()) + 1 if ids else 0
+        with open(KERNEL_IDS, 'a') as f:
+            for name in new:
+                ids[name] = next_id
+                f.write('%d %s\n' % (next_id, name))
+                next_id += 1
+    return ids
+
+
+def discard_conditions():
+    """Preprocessor condition under which each function is discarded"""
+    conds = {}
+    for base, _, files in os.walk(os.path.join(ROOT, 'algo')):
+        for fname in files:
+            if not fname.endswith(('.c', '.h')):
+                continue
+            stack = []
+            text = strip_comments(open(os.path.join(base, fname), errors='ignore').read())
+            for line in text.splitlines():
+                s = line.strip()
+                if re.match(r'#\s*if', s):
+                    m = re.match(r'#\s*if\s+(.*)', s)
+                    if m:
+                        stack.append(m.group(1).strip())
+                    else:
+                        m = re.match(r'#\s*ifn?def\s+(\w+)', s)
+                        neg = s.lstrip('# ').startswith('ifndef')
+                        stack.append(('!' if neg else '') + 'defined(%s)' % m.group(1))
+                elif re.match(r'#\s*else', s) and stack:
+                    stack[-1] = '!(%s)' % stack[-1]
+                elif re.match(r'#\s*endif', s) and stack:
+                    stack.pop()
+                m = re.search(r'DISCARD_FUN(?:_FOR_NONVOID_RETURN)?\s*\(\s*\w+\s*,\s*(xa_nn_\w+)', s)
+                if m and stack:
+                    conds[m.group(1)] = stack[-1]
+    return conds
+
+
+def param_names(params):
+    names = []
+    for p in params.split(','):
+        p = p.strip()
+        if p in ('', 'void', 'VOID'):
+            continue
+        names.append(re.findall(r'\w+', p)[-1])
+    return names
+
+
+def shape_dims(params):
+    dims = []
+    for p in params.split(','):
+        p = p.strip()
+        if '*' in p or p.startswith('p') and not p.startswith(('WORD', 'int')):
+            continue
+        words = re.findall(r'\w+', p)
+        if len(words) < 2 or words[-2] not in ('WORD32', 'int', 'Int32'):
+            continue
+        name = words[-1]
+        if any(w in name for w in DIM_WORDS) and not any(w in name for w in NOT_DIM_WORDS):
+            dims.append(name)
+    return dims[:MAX_DIMS]
+
+
+def main():
+    symbols = [l.strip() for l in open(SYMBOLS) if l.strip().startswith('xa_nn_')]
+    all_protos = dict((p[0], p) for p in read_prototypes())
+    errors = []
+    for name in symbols:
+        if name in NOT_TRACED:
+            continue
+        if name not in all_protos:
+            errors.append('%s: exported but not declared in %s' % (name, os.path.basename(API_HEADER)))
+        elif all_protos[name][1] not in RET_TYPES:
+            errors.append('%s: return type %s cannot be wrapped' % (name, all_protos[name][1]))
+    if errors:
+        raise SystemExit('gen_trace_wrappers.py: cannot trace\n  ' + '\n  '.join(errors))
+    exported = set(symbols)
+    protos = [(name, params) for name, ret, params in all_protos.values() if name in exported]
+    ids = kernel_ids([name for name, _ in protos])
+    conds = discard_conditions()
+    lic = license_header()
+
+    with open(RENAME_HEADER, 'w') as f:
+        f.write(lic)
+        f.write('/* Generated by build/gen_trace_wrappers.py, do not edit */\n')
+        f.write('#ifndef __XA_NNLIB_TRACE_RENAME_H__\n#define __XA_NNLIB_TRACE_RENAME_H__\n\n')
+        for name, _ in protos:
+            f.write('#define %-60s %s_untraced\n' % (name, name))
+        f.write('\n#endif /* __XA_NNLIB_TRACE_RENAME_H__ */\n')
+
+    with open(WRAPPERS, 'w') as f:
+        f.write(lic)
+        f.write('/* Generated by build/gen_trace_wrappers.py, do not edit */\n')
+        f.write('#define XA_NNLIB_TRACE_WRAPPERS\n')
+        f.write('#include "xa_nnlib_common.h"\n#include "xa_nnlib_common_fpu.h"\n')
+        f.write('#include "xa_nnlib_trace_api.h"\n#include "xa_nnlib_trace.h"\n\n')
+        f.write('#ifdef XA_NNLIB_TRACE\n\n')
+        for name, params in protos:
+            kernel_id = ids[name]
+            dims = shape_dims(params)
+            cond = conds.get(name)
+            if cond:
+                simple = re.match(r'!\s*(\w+)$', cond)
+                f.write('#if %s\n' % (simple.group(1) if simple else '!(%s)' % cond))
+            f.write('XA_NNLIB_TRACE_WRAP(%d, %s,\n    (%s),\n    (%s),\n    %d, (%s))\n' % (
+                kernel_id, name, params, ', '.join(param_names(params)),
+                len(dims), ', '.join(dims) if dims else '0'))
+            if cond:
+                f.write('#endif\n')
+            f.write('\n')
+        f.write('#endif /* XA_NNLIB_TRACE */\n')
+
+
+if __name__ == '__main__':
+    main()
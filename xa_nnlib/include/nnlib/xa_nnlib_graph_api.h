@@ -0,0 +1,159 @@
+/*******************************************************************************
+* Copyright (c) 2018-2025 Cadence Design Systems, Inc.
+*
+* Permission is hereby granted, free of charge, to any person obtaining
+* a copy of this software and associated documentation files (the
+* "Software"), to use this Software with Cadence processor cores only and
+* not with any other processors and platforms, subject to
+* the following conditions:
+*
+* The above copyright notice and this permission notice shall be included
+* in all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+******************************************************************************/
+#ifndef __XA_GRAPH_API_H__
+#define __XA_GRAPH_API_H__
+
+#include "xa_nnlib_standards.h"
+
+#define XA_NNLIB_GRAPH    5
+
+#define XA_NNLIB_GRAPH_MAGIC        0x52474158  /* "XAGR" */
+#define XA_NNLIB_GRAPH_VERSION      1
+
+/* Operators, all with asym8s activations and sym8s (per channel) weights */
+typedef enum _xa_nnlib_graph_op_type_t
+{
+  XA_NNLIB_GRAPH_OP_CONV2D            = 1,  // xa_nn_conv2d_std_per_chan_sym8sxasym8s
+  XA_NNLIB_GRAPH_OP_DEPTHWISE_CONV2D  = 2,  // xa_nn_conv2d_depthwise_per_chan_sym8sxasym8s
+  XA_NNLIB_GRAPH_OP_POINTWISE_CONV2D  = 3,  // xa_nn_conv2d_pointwise_per_chan_sym8sxasym8s
+  XA_NNLIB_GRAPH_OP_FULLY_CONNECTED   = 4,  // xa_nn_fully_connected_sym8sxasym8s_asym8s
+  XA_NNLIB_GRAPH_OP_AVGPOOL           = 5,  // xa_nn_avgpool_8
+  XA_NNLIB_GRAPH_OP_MAXPOOL           = 6,  // xa_nn_maxpool_8
+  XA_NNLIB_GRAPH_OP_ADD               = 7,  // xa_nn_elm_add_asym8sxasym8s_asym8s
+  XA_NNLIB_GRAPH_OP_SOFTMAX           = 8   // xa_nn_vec_softmax_asym8s_asym8s
+} xa_nnlib_graph_op_type_t;
+
+/* Fused output activation */
+typedef enum _xa_nnlib_graph_activation_t
+{
+  XA_NNLIB_GRAPH_ACT_NONE             = 0,
+  XA_NNLIB_GRAPH_ACT_RELU             = 1,
+  XA_NNLIB_GRAPH_ACT_RELU6            = 2
+} xa_nnlib_graph_activation_t;
+
+/************************************************************/
+/* Class 1: Configuration Errors                            */
+/************************************************************/
+/* Nonfatal Errors */
+/* None */
+
+/* Fatal Errors */
+typedef enum _xa_nnlib_fatal_config_graph_error_code_t
+{
+  XA_NNLIB_GRAPH_CONFIG_FATAL_INVALID_HEADER      = XA_ERROR_CODE(xa_severity_fatal, xa_class_config, XA_NNLIB_GRAPH, 0),
+  XA_NNLIB_GRAPH_CONFIG_FATAL_INVALID_TENSOR      = XA_ERROR_CODE(xa_severity_fatal, xa_class_config, XA_NNLIB_GRAPH, 1),
+  XA_NNLIB_GRAPH_CONFIG_FATAL_INVALID_OP_TYPE     = XA_ERROR_CODE(xa_severity_fatal, xa_class_config, XA_NNLIB_GRAPH, 2),
+  XA_NNLIB_GRAPH_CONFIG_FATAL_INVALID_OP_PARAMS   = XA_ERROR_CODE(xa_severity_fatal, xa_class_config, XA_NNLIB_GRAPH, 3),
+  XA_NNLIB_GRAPH_CONFIG_FATAL_INVALID_CONST       = XA_ERROR_CODE(xa_severity_fatal, xa_class_config, XA_NNLIB_GRAPH, 4),
+  XA_NNLIB_GRAPH_CONFIG_FATAL_INVALID_QUANT       = XA_ERROR_CODE(xa_severity_fatal, xa_class_config, XA_NNLIB_GRAPH, 5)
+} xa_nnlib_fatal_config_graph_error_code_t;
+
+/************************************************************/
+/* Class 2: Execution Errors                                */
+/************************************************************/
+/* Nonfatal Errors */
+/* None */
+
+/* Fatal Errors */
+typedef enum _xa_nnlib_fatal_exec_graph_error_code_t
+{
+  XA_NNLIB_GRAPH_EXECUTE_FATAL_KERNEL_FAILED      = XA_ERROR_CODE(xa_severity_fatal, xa_class_execute, XA_NNLIB_GRAPH, 0)
+} xa_nnlib_fatal_exec_graph_error_code_t;
+
+/* Serialized graph: header, tensor table, op table (in execution order) and
+ * the constant section holding weights, biases and weight scales. All
+ * offsets are in bytes from the start of the constant section. The blob
+ * must be 8 byte aligned and stay valid while the handle is in use, as
+ * weights are read in place. */
+typedef struct _xa_nnlib_graph_header_t
+{
+  Int32 magic;                  /* XA_NNLIB_GRAPH_MAGIC */
+  Int32 version;                /* XA_NNLIB_GRAPH_VERSION */
+  Int32 n_tensors;
+  Int32 n_ops;
+  Int32 input_tensor;           /* tensor bound to the process() input */
+  Int32 output_tensor;          /* tensor bound to the process() output */
+  Int32 const_size;             /* bytes of the constant section */
+  Int32 reserved;
+} xa_nnlib_graph_header_t;
+
+/* asym8s activation tensor, height x width x channels (NHWC, batch 1) */
+typedef struct _xa_nnlib_graph_tensor_desc_t
+{
+  Int32 height;
+  Int32 width;
+  Int32 channels;
+  Int32 zero_point;
+  Flt32 scale;
+} xa_nnlib_graph_tensor_desc_t;
+
+typedef struct _xa_nnlib_graph_op_desc_t
+{
+  Int32 type;                   /* xa_nnlib_graph_op_type_t */
+  Int32 input[2];               /* tensor indices, input[1] used by ADD only */
+  Int32 output;
+  Int32 kernel_height;          /* CONV2D, DEPTHWISE_CONV2D, pooling */
+  Int32 kernel_width;
+  Int32 x_stride;
+  Int32 y_stride;
+  Int32 x_padding;
+  Int32 y_padding;
+  Int32 activation;             /* xa_nnlib_graph_activation_t */
+  Int32 weight_offset;          /* WORD8 weights: CONV2D OHWI, DEPTHWISE_CONV2D HWC, POINTWISE_CONV2D and FULLY_CONNECTED OI */
+  Int32 bias_offset;            /* WORD32 bias per output channel, 4 byte aligned */
+  Int32 weight_scale_offset;    /* Flt32 weight scale per output channel (one for FULLY_CONNECTED), 4 byte aligned */
+  Flt32 beta;                   /* SOFTMAX */
+  Int32 reserved;
+} xa_nnlib_graph_op_desc_t;
+
+#if defined(__cplusplus)
+extern "C" {
+#endif    /* __cplusplus */
+
+/************************************************************/
+/* Graph Query Functions                                    */
+/************************************************************/
+Int32 xa_nnlib_graph_get_persistent_fast(const void *p_graph, Int32 graph_size);
+
+/* Activation arena and kernel scratch bytes, valid after xa_nnlib_graph_init */
+Int32 xa_nnlib_graph_get_scratch(xa_nnlib_handle_t handle);
+
+/************************************************************/
+/* Graph Initialization Function                            */
+/************************************************************/
+/* Validates the graph, derives all quantization parameters and plans the
+ * arena. Nothing is checked or derived again in xa_nnlib_graph_process. */
+Int32 xa_nnlib_graph_init(xa_nnlib_handle_t handle, const void *p_graph, Int32 graph_size);
+
+/************************************************************/
+/* Graph Execution Function                                 */
+/************************************************************/
+Int32 xa_nnlib_graph_process(xa_nnlib_handle_t handle,
+                             void *scratch,
+                             const void *input,
+                             void *output);
+
+#if defined(__cplusplus)
+}
+#endif    /* __cplusplus */
+
+#endif  /* __XA_GRAPH_API_H__ */
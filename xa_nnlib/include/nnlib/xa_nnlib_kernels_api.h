@@ -22,6 +22,11 @@
 #ifndef __XA_NNLIB_KERNELS_API_H__
 #define __XA_NNLIB_KERNELS_API_H__
 
+#if defined(XA_NNLIB_TRACE) && !defined(XA_NNLIB_TRACE_WRAPPERS) && !defined(XA_NNLIB_TRACE_CALLER) && !defined(ENABLE_SCRATCH_SIZE_API_ONLY)
+/* Kernel implementations are built as <name>_untraced, see xa_nnlib_trace_wrappers.c */
+#include "xa_nnlib_trace_rename.h"
+#endif
+
 /**
  * @file xa_nnlib_kernels_api.h
  * @brief This file gives the API definition for the HiFi NNLIB
@@ -124,11 +129,218 @@
 
 #include "xa_nnlib_standards.h"
 
+/**
+ * DMA callbacks used by the _v2_ kernels.
+ * - transfer: start copying n_bytes from p_src to p_dst, return a
+ *   non-negative transfer id (negative value on failure).
+ * - wait: block until the transfer with given id has completed.
+ * A memcpy based transfer with an empty wait is a valid implementation.
+ */
+typedef WORD32 (*xa_dma_transfer_fn_t)(VOID *p_dst, const VOID *p_src, WORD32 n_bytes, VOID *p_ctx);
+typedef WORD32 (*xa_dma_wait_fn_t)(WORD32 transfer_id, VOID *p_ctx);
+
+/**
+ * DMA configuration for the _v2_ kernels. When both callbacks and both
+ * local buffers are provided, kernels fetch the next tile of external
+ * memory data into one local buffer while computing on the other one.
+ * Conv kernels stream input rows, matXvec_v2 / fully_connected_v2 stream
+ * weight rows; the tile size is derived from local_buf_size.
+ * Passing NULL (or a zeroed structure) disables DMA.
+ */
 typedef struct _xa_dma_cfg_t
 {
-  WORD32 placeholder;
+  xa_dma_transfer_fn_t transfer;     /* transfer start callback */
+  xa_dma_wait_fn_t     wait;         /* transfer wait callback */
+  VOID                *p_ctx;        /* user context passed to callbacks */
+  VOID                *p_local_buf[2]; /* ping-pong buffers in local memory */
+  WORD32               local_buf_size; /* size of each local buffer in bytes */
 } xa_dma_cfg_t;
 
+/**
+ * Tile plan for xa_nn_conv2d_std_v2_tiled_per_chan_sym8sxasym8s, filled by
+ * xa_nn_conv2d_std_v2_get_tile_plan for a given local-memory budget.
+ * Tiles are out_channels_block output channels by tile_height output rows
+ * (output columns when input_height, kernel_height and out_height are 1).
+ */
+typedef struct _xa_nn_conv2d_std_tile_plan_t
+{
+  WORD32 tile_height;         /* output rows per tile */
+  WORD32 out_channels_block;  /* output channels per tile */
+  WORD32 scratch_size;        /* scratch bytes needed per tile */
+  WORD32 mem_req;             /* estimated working set of one tile in bytes */
+} xa_nn_conv2d_std_tile_plan_t;
+
+/**
+ * Residual input for the _v2_residual_ kernels: an int8 tensor with the
+ * same shape and layout as the output. It is requantized to the output
+ * scale and added to the output before the activation clamp.
+ * The kernel result is first requantized and saturated to int8 as in the
+ * plain v2 kernel, and the residual is rounded separately before the add.
+ * The output therefore matches the v2 kernel followed by
+ * xa_nn_elm_add_asym8sxasym8s_asym8s to within one step, not a single
+ * requantization of the int32 accumulator plus residual.
+ */
+typedef struct _xa_nn_residual_cfg_t
+{
+  const WORD8 *p_res;     /* residual tensor */
+  WORD32 res_zero_bias;   /* negated zero point of the residual */
+  WORD32 res_multiplier;  /* residual to output scale multiplier */
+  WORD32 res_shift;       /* residual to output scale shift */
+} xa_nn_residual_cfg_t;
+
+/**
+ * Parameters for xa_nn_vec_activation_lut_asym8s. Fields are passed to the
+ * xa_nn_vec_<act>_asym8s_asym8s kernel selected by act_type, fields that
+ * kernel does not take are ignored.
+ */
+typedef struct _xa_nn_act_params_t
+{
+  WORD32 act_type;            /* act_type_t */
+  WORD32 inp_zero_bias;       /* zero_point for sigmoid, tanh, gelu and silu */
+  WORD32 out_multiplier;      /* relu, leaky relu, prelu, hard swish, gelu, silu */
+  WORD32 out_shift;           /* relu, leaky relu, prelu, hard swish, gelu, silu */
+  WORD32 out_zero_bias;       /* relu, leaky relu, prelu, hard swish, gelu, silu */
+  WORD32 alpha_multiplier;    /* leaky relu, prelu; reluish_multiplier for hard swish */
+  WORD32 alpha_shift;         /* leaky relu, prelu; reluish_shift for hard swish */
+  WORD32 alpha_zero_bias;     /* prelu */
+  const WORD8 *p_alpha;       /* prelu, one alpha per LUT channel */
+  WORD32 input_range_radius;  /* sigmoid, tanh */
+  WORD32 input_multiplier;    /* sigmoid, tanh, gelu, silu */
+  WORD32 input_left_shift;    /* sigmoid, tanh; input_shift for gelu, silu */
+  WORD32 activation_min;      /* relu */
+  WORD32 activation_max;      /* relu */
+} xa_nn_act_params_t;
+
+/**
+ * Activation applied by the _v2_act_ kernels to each output tile before it
+ * leaves the cache: out = p_lut[c * 256 + out + 128], where c is the output
+ * channel when lut_channels is out_channels (PReLU) and 0 otherwise.
+ * Depthwise convolution outside NHWC in and out (or with padding that leaves
+ * an output row without input rows) and fully connected still apply the LUT
+ * as a second pass over the whole output.
+ */
+typedef struct _xa_nn_act_cfg_t
+{
+  const WORD8 *p_lut;     /* lut_channels x 256 entries */
+  WORD32 lut_channels;    /* 1 or out_channels */
+} xa_nn_act_cfg_t;
+
+/**
+ * Explicit padding for the _v2_pad_ kernels. Left and top padding are the
+ * x_padding and y_padding arguments, out_width and out_height must follow
+ * from all four pad amounts. Padded input positions read pad_val.
+ */
+typedef struct _xa_nn_pad_cfg_t
+{
+  WORD32 x_r_padding;     /* right padding */
+  WORD32 y_b_padding;     /* bottom padding */
+  WORD32 pad_val;         /* int8 value of padded input positions */
+} xa_nn_pad_cfg_t;
+
+/**
+ * Float boundary for the _v2_f32io_ kernels. The f32 input is quantized with
+ * inp_scale and zero point -input_zero_bias. With out_f32 set, p_out is f32
+ * and holds (q - out_zero_bias) * out_scale, else it is the int8 output.
+ */
+typedef struct _xa_nn_f32io_cfg_t
+{
+  FLOAT32 inp_scale;
+  FLOAT32 out_scale;
+  WORD32 out_f32;         /* 1: f32 output, 0: int8 output */
+  WORD32 band_rows;       /* conv only: output rows quantized per band */
+} xa_nn_f32io_cfg_t;
+
+/* Quantization parameters of xa_nn_attention_*. Zero biases are negated zero
+ * points and must be 0 for sym16s. Scores Q.K^T are requantized with
+ * score_multiplier/score_shift, softmax weights follow the softmax kernel
+ * (diffmin, input_beta_*), and the weighted V is requantized with out_*.
+ * With causal set, query i attends keys up to i + kv_len - q_len.
+ */
+typedef struct _xa_nn_attention_params_t
+{
+  WORD32 q_zero_bias;
+  WORD32 k_zero_bias;
+  WORD32 v_zero_bias;
+  WORD32 score_multiplier;
+  WORD32 score_shift;
+  WORD32 score_zero_bias;
+  WORD32 diffmin;
+  WORD32 input_beta_left_shift;
+  WORD32 input_beta_multiplier;
+  WORD32 out_multiplier;
+  WORD32 out_shift;
+  WORD32 out_zero_bias;
+  WORD32 causal;
+  WORD32 block_size;      /* query and key rows per block */
+} xa_nn_attention_params_t;
+
+/* Ring buffer K/V cache of xa_nn_kv_cache_*. p_k holds num_kv_heads x
+ * capacity x head_dim elements and p_v the transposed num_kv_heads x head_dim
+ * x capacity elements. The len cached steps start at
+ * slot start and wrap around at capacity; start and len are updated by
+ * xa_nn_kv_cache_append_* and are 0 for an empty cache.
+ */
+typedef struct _xa_nn_kv_cache_t
+{
+  pVOID p_k;
+  pVOID p_v;
+  WORD32 num_kv_heads;
+  WORD32 capacity;
+  WORD32 head_dim;
+  WORD32 start;
+  WORD32 len;
+} xa_nn_kv_cache_t;
+
+/* Rotary positional embedding applied by
+ * xa_nn_batch_matmul_rope_sym16sxsym16s_sym16s to every output row. p_cos and
+ * p_sin are Q15 tables of head_dim / 2 entries per position, see
+ * xa_nn_rope_sym16s_sym16s.
+ */
+typedef struct _xa_nn_rope_cfg_t
+{
+  const WORD16 *p_cos;
+  const WORD16 *p_sin;
+  WORD32 pos_offset;
+  WORD32 interleaved;     /* 1: pairs (2k, 2k + 1), 0: pairs (k, k + head_dim / 2) */
+} xa_nn_rope_cfg_t;
+
+/**
+ * Limits of xa_nn_elm_prog_asym8s. Registers 0 .. num_inps - 1 are the
+ * inputs, the next XA_NN_ELM_PROG_MAX_TEMPS registers are temporaries.
+ */
+#define XA_NN_ELM_PROG_MAX_INPS   4
+#define XA_NN_ELM_PROG_MAX_TEMPS  4
+#define XA_NN_ELM_PROG_MAX_INSTRS 16
+
+/**
+ * One instruction of an xa_nn_elm_prog_asym8s program: dst = op(src0, src1).
+ * Quantization fields are passed to the xa_nn_elm_*_asym8s or
+ * xa_nn_vec_*_asym8s kernel selected by opcode, fields that kernel does not
+ * take are ignored. The last instruction writes p_out, its dst is ignored.
+ */
+typedef struct _xa_nn_elm_prog_instr_t
+{
+  WORD32 opcode;              /* elm_prog_op_t */
+  WORD32 dst;                 /* temporary register written */
+  WORD32 src0;                /* first operand register */
+  WORD32 src1;                /* second operand register, add, sub, mul, min, max */
+  WORD32 inp1_zero_bias;      /* add, sub, mul; zero_point for sigmoid and tanh */
+  WORD32 inp1_left_shift;     /* add, sub */
+  WORD32 inp1_multiplier;     /* add, sub */
+  WORD32 inp2_zero_bias;      /* add, sub, mul */
+  WORD32 inp2_left_shift;     /* add, sub */
+  WORD32 inp2_multiplier;     /* add, sub */
+  WORD32 left_shift;          /* add, sub */
+  WORD32 out_zero_bias;       /* add, sub, mul */
+  WORD32 out_shift;           /* add, sub, mul */
+  WORD32 out_multiplier;      /* add, sub, mul */
+  WORD32 out_activation_min;  /* add, sub, mul, clamp */
+  WORD32 out_activation_max;  /* add, sub, mul, clamp */
+  WORD32 input_range_radius;  /* sigmoid, tanh */
+  WORD32 input_multiplier;    /* sigmoid, tanh */
+  WORD32 input_left_shift;    /* sigmoid, tanh */
+} xa_nn_elm_prog_instr_t;
+
 #if defined(__cplusplus)
   extern "C"
 {
@@ -138,32 +350,56 @@ typedef struct _xa_dma_cfg_t
 
 #if defined(hifi5)
 #define get_softmax_scratch_size                get_softmax_scratch_size_hifi5
+#define xa_nn_fully_connected_v2_softmax_getsize xa_nn_fully_connected_v2_softmax_getsize_hifi5
 #define xa_nn_avgpool_getsize                   xa_nn_avgpool_getsize_hifi5
+#define xa_nn_attention_getsize                 xa_nn_attention_getsize_hifi5
 #define xa_nn_batch_matmul_getsize              xa_nn_batch_matmul_getsize_hifi5
 #define xa_nn_conv2d_depthwise_getsize          xa_nn_conv2d_depthwise_getsize_hifi5
+#define xa_nn_conv2d_depthwise_pointwise_getsize xa_nn_conv2d_depthwise_pointwise_getsize_hifi5
 #define xa_nn_conv2d_getsize                    xa_nn_conv2d_getsize_hifi5
 #define xa_nn_conv2d_std_getsize                xa_nn_conv2d_std_getsize_hifi5
 #define xa_nn_conv2d_std_getsize_sym4s          xa_nn_conv2d_std_getsize_sym4s_hifi5
+#define xa_nn_conv2d_std_prepack_getsize_sym4s  xa_nn_conv2d_std_prepack_getsize_sym4s_hifi5
+#define xa_nn_conv2d_std_prepack_getsize_sym8sxsym16s xa_nn_conv2d_std_prepack_getsize_sym8sxsym16s_hifi5
+#define xa_nn_conv2d_std_v2_prepacked_getsize_sym8sxsym16s xa_nn_conv2d_std_v2_prepacked_getsize_sym8sxsym16s_hifi5
+#define xa_nn_conv2d_std_v2_get_tile_plan       xa_nn_conv2d_std_v2_get_tile_plan_hifi5
+#define xa_nn_conv2d_std_v2_pool_getsize        xa_nn_conv2d_std_v2_pool_getsize_hifi5
+#define xa_nn_conv2d_pointwise_v2_pool_getsize  xa_nn_conv2d_pointwise_v2_pool_getsize_hifi5
+#define xa_nn_conv2d_std_v2_f32io_getsize       xa_nn_conv2d_std_v2_f32io_getsize_hifi5
 #define xa_nn_dilated_conv2d_depthwise_getsize  xa_nn_dilated_conv2d_depthwise_getsize_hifi5
 #define xa_nn_dilated_conv2d_std_getsize        xa_nn_dilated_conv2d_std_getsize_hifi5
 #define xa_nn_lstm_getsize                      xa_nn_lstm_getsize_hifi5
+#define xa_nn_lstm_fused_weights_getsize        xa_nn_lstm_fused_weights_getsize_hifi5
 #define xa_nn_gru_getsize                       xa_nn_gru_getsize_hifi5
+#define xa_nn_gru_fused_weights_getsize         xa_nn_gru_fused_weights_getsize_hifi5
 #define xa_nn_maxpool_getsize                   xa_nn_maxpool_getsize_hifi5
 #define xa_nn_reduce_getsize_nhwc               xa_nn_reduce_getsize_nhwc_hifi5
 #define xa_nn_transpose_conv_getsize            xa_nn_transpose_conv_getsize_hifi5
 
 #elif defined(hifi4)
 #define get_softmax_scratch_size                get_softmax_scratch_size_hifi4
+#define xa_nn_fully_connected_v2_softmax_getsize xa_nn_fully_connected_v2_softmax_getsize_hifi4
 #define xa_nn_avgpool_getsize                   xa_nn_avgpool_getsize_hifi4
+#define xa_nn_attention_getsize                 xa_nn_attention_getsize_hifi4
 #define xa_nn_batch_matmul_getsize              xa_nn_batch_matmul_getsize_hifi4
 #define xa_nn_conv2d_depthwise_getsize          xa_nn_conv2d_depthwise_getsize_hifi4
+#define xa_nn_conv2d_depthwise_pointwise_getsize xa_nn_conv2d_depthwise_pointwise_getsize_hifi4
 #define xa_nn_conv2d_getsize                    xa_nn_conv2d_getsize_hifi4
 #define xa_nn_conv2d_std_getsize                xa_nn_conv2d_std_getsize_hifi4
 #define xa_nn_conv2d_std_getsize_sym4s          xa_nn_conv2d_std_getsize_sym4s_hifi4
+#define xa_nn_conv2d_std_prepack_getsize_sym4s  xa_nn_conv2d_std_prepack_getsize_sym4s_hifi4
+#define xa_nn_conv2d_std_prepack_getsize_sym8sxsym16s xa_nn_conv2d_std_prepack_getsize_sym8sxsym16s_hifi4
+#define xa_nn_conv2d_std_v2_prepacked_getsize_sym8sxsym16s xa_nn_conv2d_std_v2_prepacked_getsize_sym8sxsym16s_hifi4
+#define xa_nn_conv2d_std_v2_get_tile_plan       xa_nn_conv2d_std_v2_get_tile_plan_hifi4
+#define xa_nn_conv2d_std_v2_pool_getsize        xa_nn_conv2d_std_v2_pool_getsize_hifi4
+#define xa_nn_conv2d_pointwise_v2_pool_getsize  xa_nn_conv2d_pointwise_v2_pool_getsize_hifi4
+#define xa_nn_conv2d_std_v2_f32io_getsize       xa_nn_conv2d_std_v2_f32io_getsize_hifi4
 #define xa_nn_dilated_conv2d_depthwise_getsize  xa_nn_dilated_conv2d_depthwise_getsize_hifi4
 #define xa_nn_dilated_conv2d_std_getsize        xa_nn_dilated_conv2d_std_getsize_hifi4
 #define xa_nn_lstm_getsize                      xa_nn_lstm_getsize_hifi4
+#define xa_nn_lstm_fused_weights_getsize        xa_nn_lstm_fused_weights_getsize_hifi4
 #define xa_nn_gru_getsize                       xa_nn_gru_getsize_hifi4
+#define xa_nn_gru_fused_weights_getsize         xa_nn_gru_fused_weights_getsize_hifi4
 #define xa_nn_maxpool_getsize                   xa_nn_maxpool_getsize_hifi4
 #define xa_nn_reduce_getsize_nhwc               xa_nn_reduce_getsize_nhwc_hifi4
 #define xa_nn_transpose_conv_getsize            xa_nn_transpose_conv_getsize_hifi4
@@ -783,6 +1019,19 @@ typedef struct _xa_dma_cfg_t
       const WORD16 * __restrict__ p_vec,        /* input data, floating point */
       WORD32        vec_length);                  /* length of vectors */
 
+  /* GELU uses the tanh approximation */
+  WORD32 xa_nn_vec_gelu_f32_f32(
+      FLOAT32       * __restrict__ p_out,        /*!< [out] result: vec_length x 1, floating point */
+      const FLOAT32 * __restrict__ p_vec,        /*!< [in] input data: vec_length x 1, floating point */
+      WORD32        vec_length                   /*!< [in] length of vectors */
+      );
+
+  WORD32 xa_nn_vec_silu_f32_f32(
+      FLOAT32       * __restrict__ p_out,        /*!< [out] result: vec_length x 1, floating point */
+      const FLOAT32 * __restrict__ p_vec,        /*!< [in] input data: vec_length x 1, floating point */
+      WORD32        vec_length                   /*!< [in] length of vectors */
+      );
+
   WORD32 xa_nn_vec_relu_f32_f32(
       FLOAT32       * __restrict__ p_out,        /*!< [out] result: vec_length x 1, floating point */
       const FLOAT32 * __restrict__ p_vec,        /*!< [in] input data: vec_length x 1, floating point */
@@ -1059,6 +1308,56 @@ typedef struct _xa_dma_cfg_t
       WORD32 dilation_width,
       WORD32 out_data_format);
 
+  WORD32 xa_nn_conv2d_std_v2_get_tile_plan(
+      xa_nn_conv2d_std_tile_plan_t *p_plan,
+      WORD32 input_height,
+      WORD32 input_width,
+      WORD32 input_channels,
+      WORD32 kernel_height,
+      WORD32 kernel_width,
+      WORD32 out_channels,
+      WORD32 x_stride,
+      WORD32 y_stride,
+      WORD32 x_padding,
+      WORD32 y_padding,
+      WORD32 out_height,
+      WORD32 out_width,
+      WORD32 input_precision,
+      WORD32 out_data_format,
+      WORD32 mem_budget);
+
+  WORD32 xa_nn_conv2d_std_v2_pool_getsize(
+      WORD32 input_width,
+      WORD32 input_channels,
+      WORD32 kernel_height,
+      WORD32 kernel_width,
+      WORD32 out_channels,
+      WORD32 x_stride,
+      WORD32 y_stride,
+      WORD32 x_padding,
+      WORD32 y_padding,
+      WORD32 out_width,
+      WORD32 pool_height,
+      WORD32 input_precision);
+
+  WORD32 xa_nn_conv2d_pointwise_v2_pool_getsize(
+      WORD32 input_width,
+      WORD32 out_channels,
+      WORD32 pool_height);
+
+  WORD32 xa_nn_conv2d_std_v2_f32io_getsize(
+      WORD32 input_width,
+      WORD32 input_channels,
+      WORD32 kernel_height,
+      WORD32 kernel_width,
+      WORD32 out_channels,
+      WORD32 x_stride,
+      WORD32 y_stride,
+      WORD32 x_padding,
+      WORD32 y_padding,
+      WORD32 out_width,
+      WORD32 band_rows);
+
   WORD32 xa_nn_conv2d_getsize(
       WORD32 input_height,
       WORD32 input_width,
@@ -1091,6 +1390,36 @@ typedef struct _xa_dma_cfg_t
       WORD32 out_channels,
       WORD32 input_precision);
 
+  /* Sizes of the persistent buffers filled by xa_nn_conv2d_std_prepack_* */
+  WORD32 xa_nn_conv2d_std_prepack_getsize_sym4s(
+      WORD32 input_channels,
+      WORD32 kernel_height,
+      WORD32 kernel_width,
+      WORD32 out_channels);
+
+  WORD32 xa_nn_conv2d_std_prepack_getsize_sym8sxsym16s(
+      WORD32 input_channels,
+      WORD32 kernel_height,
+      WORD32 kernel_width,
+      WORD32 out_channels);
+
+  /* Scratch of xa_nn_conv2d_std_v2_prepacked_per_chan_sym8sxsym16s with a
+   * non-NULL p_bias. The prepacked kernel is read in place on every path */
+  WORD32 xa_nn_conv2d_std_v2_prepacked_getsize_sym8sxsym16s(
+      WORD32 input_height,
+      WORD32 input_width,
+      WORD32 input_channels,
+      WORD32 kernel_height,
+      WORD32 kernel_width,
+      WORD32 y_stride,
+      WORD32 y_padding,
+      WORD32 x_stride,
+      WORD32 x_padding,
+      WORD32 out_height,
+      WORD32 out_width,
+      WORD32 out_channels,
+      WORD32 out_data_format);
+
   WORD32 xa_nn_dilated_conv2d_std_getsize(
       WORD32 input_height,
       WORD32 input_channels,
@@ -1281,6 +1610,21 @@ typedef struct _xa_dma_cfg_t
      ,WORD32 inp_data_format
     );
 
+  WORD32 xa_nn_conv2d_depthwise_pointwise_getsize
+    (WORD32 input_width
+     ,WORD32 input_channels
+     ,WORD32 kernel_height
+     ,WORD32 kernel_width
+     ,WORD32 channels_multiplier
+     ,WORD32 x_stride
+     ,WORD32 y_stride
+     ,WORD32 x_padding
+     ,WORD32 y_padding
+     ,WORD32 output_width
+     ,WORD32 rows_per_block
+     ,WORD32 input_precision
+    );
+
   WORD32 xa_nn_dilated_conv2d_depthwise_getsize
     (WORD32 input_height
      ,WORD32 input_width
@@ -1753,6 +2097,101 @@ typedef struct _xa_dma_cfg_t
    ,xa_dma_cfg_t *p_dma_cfg
   );
 
+  WORD32 xa_nn_fully_connected_v2_slice_asym8sxasym8s_asym8s
+  (WORD8 *__restrict__ p_out
+   ,const WORD8 *__restrict__ p_weight
+   ,const WORD8 *__restrict__ p_inp
+   ,const WORD32 *__restrict__ p_bias
+   ,WORD32  weight_depth
+   ,WORD32  out_depth
+   ,WORD32  input_zero_bias
+   ,WORD32  weight_zero_bias
+   ,WORD32  out_multiplier
+   ,WORD32  out_shift
+   ,WORD32  out_zero_bias
+   ,WORD32  out_activation_min
+   ,WORD32  out_activation_max
+   ,WORD32  out_start
+   ,WORD32  out_end
+   ,xa_dma_cfg_t *p_dma_cfg
+  );
+
+  WORD32 xa_nn_fully_connected_v2_residual_asym8sxasym8s_asym8s
+  (WORD8 *__restrict__ p_out
+   ,const WORD8 *__restrict__ p_weight
+   ,const WORD8 *__restrict__ p_inp
+   ,const WORD32 *__restrict__ p_bias
+   ,WORD32  weight_depth
+   ,WORD32  out_depth
+   ,WORD32  input_zero_bias
+   ,WORD32  weight_zero_bias
+   ,WORD32  out_multiplier
+   ,WORD32  out_shift
+   ,WORD32  out_zero_bias
+   ,WORD32  out_activation_min
+   ,WORD32  out_activation_max
+   ,const xa_nn_residual_cfg_t *p_res_cfg
+   ,xa_dma_cfg_t *p_dma_cfg
+  );
+
+  WORD32 xa_nn_fully_connected_v2_act_asym8sxasym8s_asym8s
+  (WORD8 *__restrict__ p_out
+   ,const WORD8 *__restrict__ p_weight
+   ,const WORD8 *__restrict__ p_inp
+   ,const WORD32 *__restrict__ p_bias
+   ,WORD32  weight_depth
+   ,WORD32  out_depth
+   ,WORD32  input_zero_bias
+   ,WORD32  weight_zero_bias
+   ,WORD32  out_multiplier
+   ,WORD32  out_shift
+   ,WORD32  out_zero_bias
+   ,WORD32  out_activation_min
+   ,WORD32  out_activation_max
+   ,const xa_nn_act_cfg_t *p_act_cfg
+   ,xa_dma_cfg_t *p_dma_cfg
+  );
+
+  WORD32 xa_nn_fully_connected_v2_softmax_asym8sxasym8s
+  (pVOID __restrict__ p_out
+   ,WORD32 *p_top1
+   ,const WORD8 *__restrict__ p_weight
+   ,const WORD8 *__restrict__ p_inp
+   ,const WORD32 *__restrict__ p_bias
+   ,WORD32  weight_depth
+   ,WORD32  out_depth
+   ,WORD32  input_zero_bias
+   ,WORD32  weight_zero_bias
+   ,WORD32  out_multiplier
+   ,WORD32  out_shift
+   ,WORD32  out_zero_bias
+   ,WORD32  diffmin
+   ,WORD32  input_beta_left_shift
+   ,WORD32  input_beta_multiplier
+   ,WORD32  out_precision
+   ,VOID *p_scratch
+   ,xa_dma_cfg_t *p_dma_cfg
+  );
+
+  WORD32 xa_nn_fully_connected_v2_f32io_asym8sxasym8s_asym8s
+  (pVOID __restrict__ p_out
+   ,const WORD8 *__restrict__ p_weight
+   ,const FLOAT32 *__restrict__ p_inp
+   ,const WORD32 *__restrict__ p_bias
+   ,WORD32  weight_depth
+   ,WORD32  out_depth
+   ,WORD32  input_zero_bias
+   ,WORD32  weight_zero_bias
+   ,WORD32  out_multiplier
+   ,WORD32  out_shift
+   ,WORD32  out_zero_bias
+   ,WORD32  out_activation_min
+   ,WORD32  out_activation_max
+   ,const xa_nn_f32io_cfg_t *p_io_cfg
+   ,VOID *p_scratch
+   ,xa_dma_cfg_t *p_dma_cfg
+  );
+
   WORD32 xa_nn_fully_connected_v2_sym8sxsym16s_sym16s
   (WORD16 *__restrict__ p_out
    ,const WORD8 *__restrict__ p_weight
@@ -1849,6 +2288,8 @@ typedef struct _xa_dma_cfg_t
 
   int get_softmax_scratch_size(int inp_precision, int out_precision, int length);
 
+  int xa_nn_fully_connected_v2_softmax_getsize(int out_depth, int out_precision);
+
   WORD32 xa_nn_vec_activation_min_max_8_8(WORD8 * __restrict__ p_out,
       const  WORD8 * __restrict__ p_vec,
       int    activation_min,
@@ -1931,12 +2372,57 @@ typedef struct _xa_dma_cfg_t
       WORD32 input_left_shift,
       WORD32 vec_length);
 
+  /* Fills lut_channels x 256 entries of p_lut with the activation of every
+   * int8 value, bit-exact with the matching xa_nn_vec_*_asym8s_asym8s kernel */
+  WORD32 xa_nn_vec_activation_lut_asym8s(WORD8 *p_lut,
+      const xa_nn_act_params_t *p_params,
+      WORD32 lut_channels);
+
   WORD32 xa_nn_vec_tanh_sym16s_sym16s(WORD16 *p_out,
       const WORD16 *p_vec,
       WORD32 input_multiplier,
       WORD32 input_left_shift,
       WORD32 vec_length);
 
+  /* GELU (tanh approximation) and SiLU, input_multiplier/input_shift quantize
+   * the input scale and out_multiplier/out_shift the input to output scale
+   * ratio. The 8-bit kernels are table driven. */
+  WORD32 xa_nn_vec_gelu_asym8s_asym8s(WORD8 * __restrict__ p_out,
+      const WORD8 * __restrict__ p_vec,
+      WORD32 inp_zero_bias,
+      WORD32 input_multiplier,
+      WORD32 input_shift,
+      WORD32 out_multiplier,
+      WORD32 out_shift,
+      WORD32 out_zero_bias,
+      WORD32 vec_length);
+
+  WORD32 xa_nn_vec_silu_asym8s_asym8s(WORD8 * __restrict__ p_out,
+      const WORD8 * __restrict__ p_vec,
+      WORD32 inp_zero_bias,
+      WORD32 input_multiplier,
+      WORD32 input_shift,
+      WORD32 out_multiplier,
+      WORD32 out_shift,
+      WORD32 out_zero_bias,
+      WORD32 vec_length);
+
+  WORD32 xa_nn_vec_gelu_sym16s_sym16s(WORD16 * __restrict__ p_out,
+      const WORD16 * __restrict__ p_vec,
+      WORD32 input_multiplier,
+      WORD32 input_shift,
+      WORD32 out_multiplier,
+      WORD32 out_shift,
+      WORD32 vec_length);
+
+  WORD32 xa_nn_vec_silu_sym16s_sym16s(WORD16 * __restrict__ p_out,
+      const WORD16 * __restrict__ p_vec,
+      WORD32 input_multiplier,
+      WORD32 input_shift,
+      WORD32 out_multiplier,
+      WORD32 out_shift,
+      WORD32 vec_length);
+
   WORD32 xa_nn_conv1d_std_asym8uxasym8u(
       UWORD8* __restrict__ p_out,
       UWORD8* __restrict__ p_inp,
@@ -2088,6 +2574,46 @@ typedef struct _xa_dma_cfg_t
       WORD32 out_activation_max,
       xa_dma_cfg_t *p_dma_cfg);
 
+  /* Pads every kernel row to 8 bytes once, at model load, into caller owned
+   * memory of xa_nn_conv2d_std_prepack_getsize_sym8sxsym16s bytes */
+  WORD32 xa_nn_conv2d_std_prepack_sym8sxsym16s(
+      WORD8* __restrict__ p_kernel_packed,
+      const WORD8* __restrict__ p_kernel,
+      WORD32 input_channels,
+      WORD32 kernel_height,
+      WORD32 kernel_width,
+      WORD32 out_channels);
+
+  /* Same as xa_nn_conv2d_std_v2_per_chan_sym8sxsym16s with p_kernel from
+   * xa_nn_conv2d_std_prepack_sym8sxsym16s, p_scratch of
+   * xa_nn_conv2d_std_v2_prepacked_getsize_sym8sxsym16s bytes */
+  WORD32 xa_nn_conv2d_std_v2_prepacked_per_chan_sym8sxsym16s(
+      WORD16* __restrict__ p_out,
+      const WORD16* __restrict__ p_inp,
+      const WORD8* __restrict__ p_kernel,
+      const WORD64* __restrict__ p_bias,
+      WORD32 input_height,
+      WORD32 input_width,
+      WORD32 input_channels,
+      WORD32 kernel_height,
+      WORD32 kernel_width,
+      WORD32 out_channels,
+      WORD32 x_stride,
+      WORD32 y_stride,
+      WORD32 x_padding,
+      WORD32 y_padding,
+      WORD32 out_height,
+      WORD32 out_width,
+      WORD32 input_zero_bias,
+      WORD32 * p_out_multiplier,
+      WORD32 * p_out_shift,
+      WORD32 out_zero_bias,
+      WORD32 out_data_format,
+      VOID *p_scratch,
+      WORD32 out_activation_min,
+      WORD32 out_activation_max,
+      xa_dma_cfg_t *p_dma_cfg);
+
   WORD32 xa_nn_dilated_conv2d_std_v2_per_chan_sym8sxsym16s(
       WORD16* __restrict__ p_out,
       const WORD16* __restrict__ p_inp,
@@ -2199,7 +2725,7 @@ typedef struct _xa_dma_cfg_t
       WORD32 out_activation_max,
       xa_dma_cfg_t *p_dma_cfg);
 
-  WORD32 xa_nn_conv2d_per_chan_sym8sxasym8s(
+  WORD32 xa_nn_conv2d_std_v2_tiled_per_chan_sym8sxasym8s(
       WORD8* __restrict__ p_out,
       const WORD8* __restrict__ p_inp,
       const WORD8* __restrict__ p_kernel,
@@ -2209,9 +2735,6 @@ typedef struct _xa_dma_cfg_t
       WORD32 input_channels,
       WORD32 kernel_height,
       WORD32 kernel_width,
-      WORD32 kernel_channels,
-      WORD32 dilation_height,
-      WORD32 dilation_width,
       WORD32 out_channels,
       WORD32 x_stride,
       WORD32 y_stride,
@@ -2224,7 +2747,220 @@ typedef struct _xa_dma_cfg_t
       WORD32 * p_out_shift,
       WORD32 out_zero_bias,
       WORD32 out_data_format,
-      VOID *p_scratch);
+      VOID *p_scratch,
+      WORD32 out_activation_min,
+      WORD32 out_activation_max,
+      const xa_nn_conv2d_std_tile_plan_t *p_plan,
+      xa_dma_cfg_t *p_dma_cfg);
+
+  WORD32 xa_nn_conv2d_std_v2_slice_per_chan_sym8sxasym8s(
+      WORD8* __restrict__ p_out,
+      const WORD8* __restrict__ p_inp,
+      const WORD8* __restrict__ p_kernel,
+      const WORD32* __restrict__ p_bias,
+      WORD32 input_height,
+      WORD32 input_width,
+      WORD32 input_channels,
+      WORD32 kernel_height,
+      WORD32 kernel_width,
+      WORD32 out_channels,
+      WORD32 x_stride,
+      WORD32 y_stride,
+      WORD32 x_padding,
+      WORD32 y_padding,
+      WORD32 out_height,
+      WORD32 out_width,
+      WORD32 input_zero_bias,
+      WORD32 * p_out_multiplier,
+      WORD32 * p_out_shift,
+      WORD32 out_zero_bias,
+      WORD32 out_data_format,
+      VOID *p_scratch,
+      WORD32 out_activation_min,
+      WORD32 out_activation_max,
+      WORD32 out_row_start,
+      WORD32 out_row_end,
+      WORD32 out_ch_start,
+      WORD32 out_ch_end,
+      xa_dma_cfg_t *p_dma_cfg);
+
+  WORD32 xa_nn_conv2d_std_v2_residual_per_chan_sym8sxasym8s(
+      WORD8* __restrict__ p_out,
+      const WORD8* __restrict__ p_inp,
+      const WORD8* __restrict__ p_kernel,
+      const WORD32* __restrict__ p_bias,
+      WORD32 input_height,
+      WORD32 input_width,
+      WORD32 input_channels,
+      WORD32 kernel_height,
+      WORD32 kernel_width,
+      WORD32 out_channels,
+      WORD32 x_stride,
+      WORD32 y_stride,
+      WORD32 x_padding,
+      WORD32 y_padding,
+      WORD32 out_height,
+      WORD32 out_width,
+      WORD32 input_zero_bias,
+      WORD32 * p_out_multiplier,
+      WORD32 * p_out_shift,
+      WORD32 out_zero_bias,
+      WORD32 out_data_format,
+      VOID *p_scratch,
+      WORD32 out_activation_min,
+      WORD32 out_activation_max,
+      const xa_nn_residual_cfg_t *p_res_cfg,
+      xa_dma_cfg_t *p_dma_cfg);
+
+  WORD32 xa_nn_conv2d_std_v2_act_per_chan_sym8sxasym8s(
+      WORD8* __restrict__ p_out,
+      const WORD8* __restrict__ p_inp,
+      const WORD8* __restrict__ p_kernel,
+      const WORD32* __restrict__ p_bias,
+      WORD32 input_height,
+      WORD32 input_width,
+      WORD32 input_channels,
+      WORD32 kernel_height,
+      WORD32 kernel_width,
+      WORD32 out_channels,
+      WORD32 x_stride,
+      WORD32 y_stride,
+      WORD32 x_padding,
+      WORD32 y_padding,
+      WORD32 out_height,
+      WORD32 out_width,
+      WORD32 input_zero_bias,
+      WORD32 * p_out_multiplier,
+      WORD32 * p_out_shift,
+      WORD32 out_zero_bias,
+      WORD32 out_data_format,
+      VOID *p_scratch,
+      WORD32 out_activation_min,
+      WORD32 out_activation_max,
+      const xa_nn_act_cfg_t *p_act_cfg,
+      xa_dma_cfg_t *p_dma_cfg);
+
+  WORD32 xa_nn_conv2d_std_v2_pad_per_chan_sym8sxasym8s(
+      WORD8* __restrict__ p_out,
+      const WORD8* __restrict__ p_inp,
+      const WORD8* __restrict__ p_kernel,
+      const WORD32* __restrict__ p_bias,
+      WORD32 input_height,
+      WORD32 input_width,
+      WORD32 input_channels,
+      WORD32 kernel_height,
+      WORD32 kernel_width,
+      WORD32 out_channels,
+      WORD32 x_stride,
+      WORD32 y_stride,
+      WORD32 x_padding,
+      WORD32 y_padding,
+      WORD32 out_height,
+      WORD32 out_width,
+      WORD32 input_zero_bias,
+      WORD32 * p_out_multiplier,
+      WORD32 * p_out_shift,
+      WORD32 out_zero_bias,
+      WORD32 out_data_format,
+      VOID *p_scratch,
+      WORD32 out_activation_min,
+      WORD32 out_activation_max,
+      const xa_nn_pad_cfg_t *p_pad_cfg,
+      xa_dma_cfg_t *p_dma_cfg);
+
+  /* Conv2d std with f32 input quantized band by band and optionally f32
+   * output, see xa_nn_f32io_cfg_t. NHWC output only, p_scratch sized by
+   * xa_nn_conv2d_std_v2_f32io_getsize. */
+  WORD32 xa_nn_conv2d_std_v2_f32io_per_chan_sym8sxasym8s(
+      pVOID __restrict__ p_out,
+      const FLOAT32* __restrict__ p_inp,
+      const WORD8* __restrict__ p_kernel,
+      const WORD32* __restrict__ p_bias,
+      WORD32 input_height,
+      WORD32 input_width,
+      WORD32 input_channels,
+      WORD32 kernel_height,
+      WORD32 kernel_width,
+      WORD32 out_channels,
+      WORD32 x_stride,
+      WORD32 y_stride,
+      WORD32 x_padding,
+      WORD32 y_padding,
+      WORD32 out_height,
+      WORD32 out_width,
+      WORD32 input_zero_bias,
+      WORD32 * p_out_multiplier,
+      WORD32 * p_out_shift,
+      WORD32 out_zero_bias,
+      VOID *p_scratch,
+      WORD32 out_activation_min,
+      WORD32 out_activation_max,
+      const xa_nn_f32io_cfg_t *p_io_cfg);
+
+  /* Conv2d std with a max (POOL_MAX) or average (POOL_AVG) pooling
+   * epilogue, NHWC output of pool_out_height x pool_out_width x
+   * out_channels. The conv output (out_height x out_width) is never stored;
+   * scratch size from xa_nn_conv2d_std_v2_pool_getsize. */
+  WORD32 xa_nn_conv2d_std_v2_pool_per_chan_sym8sxasym8s(
+      WORD8* __restrict__ p_out,
+      const WORD8* __restrict__ p_inp,
+      const WORD8* __restrict__ p_kernel,
+      const WORD32* __restrict__ p_bias,
+      WORD32 input_height,
+      WORD32 input_width,
+      WORD32 input_channels,
+      WORD32 kernel_height,
+      WORD32 kernel_width,
+      WORD32 out_channels,
+      WORD32 x_stride,
+      WORD32 y_stride,
+      WORD32 x_padding,
+      WORD32 y_padding,
+      WORD32 out_height,
+      WORD32 out_width,
+      WORD32 input_zero_bias,
+      WORD32 * p_out_multiplier,
+      WORD32 * p_out_shift,
+      WORD32 out_zero_bias,
+      WORD32 out_activation_min,
+      WORD32 out_activation_max,
+      WORD32 pool_type,
+      WORD32 pool_height,
+      WORD32 pool_width,
+      WORD32 pool_x_stride,
+      WORD32 pool_y_stride,
+      WORD32 pool_x_padding,
+      WORD32 pool_y_padding,
+      WORD32 pool_out_height,
+      WORD32 pool_out_width,
+      VOID *p_scratch);
+
+  WORD32 xa_nn_conv2d_per_chan_sym8sxasym8s(
+      WORD8* __restrict__ p_out,
+      const WORD8* __restrict__ p_inp,
+      const WORD8* __restrict__ p_kernel,
+      const WORD32* __restrict__ p_bias,
+      WORD32 input_height,
+      WORD32 input_width,
+      WORD32 input_channels,
+      WORD32 kernel_height,
+      WORD32 kernel_width,
+      WORD32 kernel_channels,
+      WORD32 dilation_height,
+      WORD32 dilation_width,
+      WORD32 out_channels,
+      WORD32 x_stride,
+      WORD32 y_stride,
+      WORD32 x_padding,
+      WORD32 y_padding,
+      WORD32 out_height,
+      WORD32 out_width,
+      WORD32 input_zero_bias,
+      WORD32 * p_out_multiplier,
+      WORD32 * p_out_shift,
+      WORD32 out_zero_bias,
+      WORD32 out_data_format,
+      VOID *p_scratch);
 
   WORD32 xa_nn_conv2d_v2_per_chan_sym8sxasym8s(
       WORD8* __restrict__ p_out,
@@ -2256,6 +2992,37 @@ typedef struct _xa_dma_cfg_t
       WORD32 out_activation_max,
       xa_dma_cfg_t *p_dma_cfg);
 
+  WORD32 xa_nn_conv2d_v2_pad_per_chan_sym8sxasym8s(
+      WORD8* __restrict__ p_out,
+      const WORD8* __restrict__ p_inp,
+      const WORD8* __restrict__ p_kernel,
+      const WORD32* __restrict__ p_bias,
+      WORD32 input_height,
+      WORD32 input_width,
+      WORD32 input_channels,
+      WORD32 kernel_height,
+      WORD32 kernel_width,
+      WORD32 kernel_channels,
+      WORD32 dilation_height,
+      WORD32 dilation_width,
+      WORD32 out_channels,
+      WORD32 x_stride,
+      WORD32 y_stride,
+      WORD32 x_padding,
+      WORD32 y_padding,
+      WORD32 out_height,
+      WORD32 out_width,
+      WORD32 input_zero_bias,
+      WORD32 * p_out_multiplier,
+      WORD32 * p_out_shift,
+      WORD32 out_zero_bias,
+      WORD32 out_data_format,
+      VOID *p_scratch,
+      WORD32 out_activation_min,
+      WORD32 out_activation_max,
+      const xa_nn_pad_cfg_t *p_pad_cfg,
+      xa_dma_cfg_t *p_dma_cfg);
+
   WORD32 xa_nn_conv2d_std_per_chan_sym4sxasym8s(
       WORD8* __restrict__ p_out,
       const WORD8* __restrict__ p_inp,
@@ -2280,6 +3047,44 @@ typedef struct _xa_dma_cfg_t
       WORD32 out_data_format,
       VOID *p_scratch);
 
+  /* Writes the nibble swapped, channel padded sym4s kernel once, at model
+   * load, into caller owned 16 byte aligned memory of
+   * xa_nn_conv2d_std_prepack_getsize_sym4s bytes */
+  WORD32 xa_nn_conv2d_std_prepack_sym4s(
+      WORD8* __restrict__ p_kernel_packed,
+      const WORD8* __restrict__ p_kernel,
+      WORD32 input_channels,
+      WORD32 kernel_height,
+      WORD32 kernel_width,
+      WORD32 out_channels);
+
+  /* Same as xa_nn_conv2d_std_per_chan_sym4sxasym8s with p_kernel from
+   * xa_nn_conv2d_std_prepack_sym4s; needs only xa_nn_conv2d_std_getsize
+   * (input PREC_ASYM8S, kernel PREC_SYM4S) bytes of scratch */
+  WORD32 xa_nn_conv2d_std_prepacked_per_chan_sym4sxasym8s(
+      WORD8* __restrict__ p_out,
+      const WORD8* __restrict__ p_inp,
+      const WORD8* __restrict__ p_kernel,
+      const WORD32* __restrict__ p_bias,
+      WORD32 input_height,
+      WORD32 input_width,
+      WORD32 input_channels,
+      WORD32 kernel_height,
+      WORD32 kernel_width,
+      WORD32 out_channels,
+      WORD32 x_stride,
+      WORD32 y_stride,
+      WORD32 x_padding,
+      WORD32 y_padding,
+      WORD32 out_height,
+      WORD32 out_width,
+      WORD32 input_zero_bias,
+      WORD32 * p_out_multiplier,
+      WORD32 * p_out_shift,
+      WORD32 out_zero_bias,
+      WORD32 out_data_format,
+      VOID *p_scratch);
+
   WORD32 xa_nn_dilated_conv2d_std_v2_per_chan_sym8sxasym8s(
       WORD8* __restrict__ p_out,
       const WORD8* __restrict__ p_inp,
@@ -2463,6 +3268,30 @@ typedef struct _xa_dma_cfg_t
       WORD32 out_activation_max,
       xa_dma_cfg_t *p_dma_cfg);
 
+  WORD32 xa_nn_matmul_v2_slice_per_chan_sym8sxasym8s_asym8s(
+      WORD8 * __restrict__ p_out,
+      const WORD8 * __restrict__ p_mat1,
+      const WORD8 * __restrict__ p_vec1,
+      const WORD32 * __restrict__ p_bias,
+      WORD32 rows,
+      WORD32 cols1,
+      WORD32 row_stride1,
+      WORD32 vec_count,
+      WORD32 vec_offset,
+      WORD32 out_offset,
+      WORD32 out_stride,
+      WORD32 vec1_zero_bias,
+      const WORD32* __restrict__ p_out_multiplier,
+      const WORD32* __restrict__ p_out_shift,
+      WORD32 out_zero_bias,
+      WORD32 out_activation_min,
+      WORD32 out_activation_max,
+      WORD32 row_start,
+      WORD32 row_end,
+      WORD32 vec_start,
+      WORD32 vec_end,
+      xa_dma_cfg_t *p_dma_cfg);
+
   WORD32 xa_nn_matmul_per_chan_sym8sxsym16s_sym16s(
       WORD16 * __restrict__ p_out,
       const WORD8 * __restrict__ p_mat1,
@@ -2537,6 +3366,75 @@ typedef struct _xa_dma_cfg_t
       WORD32 out_activation_max,
       xa_dma_cfg_t *p_dma_cfg);
 
+  WORD32 xa_nn_attention_getsize(
+      WORD32 head_dim,
+      WORD32 block_size,
+      WORD32 precision);
+
+  /* p_q and p_out are num_heads x q_len x head_dim, p_k is num_kv_heads x
+   * kv_len x head_dim and p_v is passed transposed, num_kv_heads x head_dim x
+   * kv_len, so that P.V reads it in place */
+  WORD32 xa_nn_attention_asym8s(
+      WORD8 * __restrict__ p_out,
+      const WORD8 * __restrict__ p_q,
+      const WORD8 * __restrict__ p_k,
+      const WORD8 * __restrict__ p_v,
+      WORD32 num_heads,
+      WORD32 num_kv_heads,
+      WORD32 q_len,
+      WORD32 kv_len,
+      WORD32 head_dim,
+      const xa_nn_attention_params_t *p_params,
+      VOID *p_scratch);
+
+  WORD32 xa_nn_attention_sym16s(
+      WORD16 * __restrict__ p_out,
+      const WORD16 * __restrict__ p_q,
+      const WORD16 * __restrict__ p_k,
+      const WORD16 * __restrict__ p_v,
+      WORD32 num_heads,
+      WORD32 num_kv_heads,
+      WORD32 q_len,
+      WORD32 kv_len,
+      WORD32 head_dim,
+      const xa_nn_attention_params_t *p_params,
+      VOID *p_scratch);
+
+  /* Appends num_tokens steps of K and V, each num_tokens x num_kv_heads x
+   * head_dim, dropping the oldest steps once the cache is full */
+  WORD32 xa_nn_kv_cache_append_asym8s(
+      xa_nn_kv_cache_t *p_cache,
+      const WORD8 * __restrict__ p_k,
+      const WORD8 * __restrict__ p_v,
+      WORD32 num_tokens);
+
+  WORD32 xa_nn_kv_cache_append_sym16s(
+      xa_nn_kv_cache_t *p_cache,
+      const WORD16 * __restrict__ p_k,
+      const WORD16 * __restrict__ p_v,
+      WORD32 num_tokens);
+
+  /* Attention of one query step (num_heads x head_dim) over all cached steps,
+   * read in place from the ring buffer. The output is bit-exact with
+   * xa_nn_attention_* on a linear copy of the cached steps. causal is not
+   * used, p_scratch is xa_nn_attention_getsize(head_dim, block_size,
+   * precision) bytes */
+  WORD32 xa_nn_kv_cache_attend_asym8s(
+      WORD8 * __restrict__ p_out,
+      const WORD8 * __restrict__ p_q,
+      const xa_nn_kv_cache_t *p_cache,
+      WORD32 num_heads,
+      const xa_nn_attention_params_t *p_params,
+      VOID *p_scratch);
+
+  WORD32 xa_nn_kv_cache_attend_sym16s(
+      WORD16 * __restrict__ p_out,
+      const WORD16 * __restrict__ p_q,
+      const xa_nn_kv_cache_t *p_cache,
+      WORD32 num_heads,
+      const xa_nn_attention_params_t *p_params,
+      VOID *p_scratch);
+
   WORD32 xa_nn_batch_matmul_getsize(
       const WORD32 *const p_mat1_shape,
       const WORD32 *const p_mat2_shape,
@@ -2577,6 +3475,51 @@ typedef struct _xa_dma_cfg_t
       WORD32 out_zero_bias,
       VOID   *p_scratch);
 
+  /* Batch matmul whose mat2_rows x mat1_rows output blocks are rotated with
+   * RoPE right after each block is computed, row r at position
+   * p_rope->pos_offset + r. mat1_rows must be even */
+  WORD32 xa_nn_batch_matmul_rope_sym16sxsym16s_sym16s(
+      WORD16 * __restrict__ p_out,
+      const WORD32 *const p_out_shape,
+      const WORD16 * __restrict__ p_mat1,
+      const WORD32 *const p_mat1_shape,
+      const WORD16 * __restrict__ p_mat2,
+      const WORD32 *const p_mat2_shape,
+      WORD32 mat1_transpose,
+      WORD32 mat2_transpose,
+      WORD32 mat1_zero_bias,
+      WORD32 mat2_zero_bias,
+      WORD32 out_multiplier,
+      WORD32 out_shift,
+      WORD32 out_zero_bias,
+      const xa_nn_rope_cfg_t *p_rope,
+      VOID   *p_scratch);
+
+  /* Rotary positional embedding of num_heads x seq_len x head_dim rows, row s
+   * at position pos_offset + s. p_cos and p_sin hold head_dim / 2 entries per
+   * position (Q15 for sym16s), p_out may be equal to p_inp */
+  WORD32 xa_nn_rope_sym16s_sym16s(
+      WORD16 *p_out,
+      const WORD16 *p_inp,
+      const WORD16 * __restrict__ p_cos,
+      const WORD16 * __restrict__ p_sin,
+      WORD32 num_heads,
+      WORD32 seq_len,
+      WORD32 head_dim,
+      WORD32 pos_offset,
+      WORD32 interleaved);
+
+  WORD32 xa_nn_rope_f32_f32(
+      FLOAT32 *p_out,
+      const FLOAT32 *p_inp,
+      const FLOAT32 * __restrict__ p_cos,
+      const FLOAT32 * __restrict__ p_sin,
+      WORD32 num_heads,
+      WORD32 seq_len,
+      WORD32 head_dim,
+      WORD32 pos_offset,
+      WORD32 interleaved);
+
   WORD32 xa_nn_conv2d_depthwise_asym8uxasym8u(
       pUWORD8 __restrict__ p_out,
       const UWORD8 *__restrict__ p_kernel,
@@ -2672,6 +3615,64 @@ typedef struct _xa_dma_cfg_t
       WORD32 out_activation_max,
       xa_dma_cfg_t *p_dma_cfg);
 
+  WORD32 xa_nn_conv2d_depthwise_v2_act_per_chan_sym8sxasym8s(
+      pWORD8 __restrict__ p_out,
+      const WORD8 *__restrict__ p_kernel,
+      const WORD8 *__restrict__ p_inp,
+      const WORD32 *__restrict__ p_bias,
+      WORD32  input_height,
+      WORD32  input_width,
+      WORD32  input_channels,
+      WORD32  kernel_height,
+      WORD32  kernel_width,
+      WORD32  channels_multiplier,
+      WORD32  x_stride,
+      WORD32  y_stride,
+      WORD32  x_padding,
+      WORD32  y_padding,
+      WORD32  out_height,
+      WORD32  out_width,
+      WORD32  input_zero_bias,
+      const WORD32  *p_out_multiplier,
+      const WORD32  *p_out_shift,
+      WORD32  out_zero_bias,
+      WORD32  inp_data_format,
+      WORD32  out_data_format,
+      pVOID p_scratch,
+      WORD32 out_activation_min,
+      WORD32 out_activation_max,
+      const xa_nn_act_cfg_t *p_act_cfg,
+      xa_dma_cfg_t *p_dma_cfg);
+
+  WORD32 xa_nn_conv2d_depthwise_v2_pad_per_chan_sym8sxasym8s(
+      pWORD8 __restrict__ p_out,
+      const WORD8 *__restrict__ p_kernel,
+      const WORD8 *__restrict__ p_inp,
+      const WORD32 *__restrict__ p_bias,
+      WORD32  input_height,
+      WORD32  input_width,
+      WORD32  input_channels,
+      WORD32  kernel_height,
+      WORD32  kernel_width,
+      WORD32  channels_multiplier,
+      WORD32  x_stride,
+      WORD32  y_stride,
+      WORD32  x_padding,
+      WORD32  y_padding,
+      WORD32  out_height,
+      WORD32  out_width,
+      WORD32  input_zero_bias,
+      const WORD32  *p_out_multiplier,
+      const WORD32  *p_out_shift,
+      WORD32  out_zero_bias,
+      WORD32  inp_data_format,
+      WORD32  out_data_format,
+      pVOID p_scratch,
+      WORD32 out_activation_min,
+      WORD32 out_activation_max,
+      const xa_nn_pad_cfg_t *p_pad_cfg,
+      xa_dma_cfg_t *p_dma_cfg);
+
   WORD32 xa_nn_dilated_conv2d_depthwise_per_chan_sym8sxasym8s
       (pWORD8 __restrict__ p_out
       ,const WORD8 *__restrict__ p_kernel
@@ -2847,6 +3848,137 @@ typedef struct _xa_dma_cfg_t
       WORD32  out_activation_max,
       xa_dma_cfg_t *p_dma_cfg);
 
+  WORD32 xa_nn_conv2d_pointwise_v2_slice_per_chan_sym8sxasym8s(
+      WORD8* __restrict__ p_out,
+      WORD8* __restrict__ p_kernel,
+      WORD8* __restrict__ p_inp,
+      WORD32* __restrict__ p_bias,
+      WORD32  input_height,
+      WORD32  input_width,
+      WORD32  input_channels,
+      WORD32  out_channels,
+      WORD32  input_zero_bias,
+      WORD32* __restrict__ p_out_multiplier,
+      WORD32* __restrict__ p_out_shift,
+      WORD32  out_zero_bias,
+      WORD32  out_data_format,
+      WORD32  out_activation_min,
+      WORD32  out_activation_max,
+      WORD32  out_row_start,
+      WORD32  out_row_end,
+      WORD32  out_ch_start,
+      WORD32  out_ch_end,
+      xa_dma_cfg_t *p_dma_cfg);
+
+  WORD32 xa_nn_conv2d_pointwise_v2_residual_per_chan_sym8sxasym8s(
+      WORD8* __restrict__ p_out,
+      WORD8* __restrict__ p_kernel,
+      WORD8* __restrict__ p_inp,
+      WORD32* __restrict__ p_bias,
+      WORD32  input_height,
+      WORD32  input_width,
+      WORD32  input_channels,
+      WORD32  out_channels,
+      WORD32  input_zero_bias,
+      WORD32* __restrict__ p_out_multiplier,
+      WORD32* __restrict__ p_out_shift,
+      WORD32  out_zero_bias,
+      WORD32  out_data_format,
+      WORD32  out_activation_min,
+      WORD32  out_activation_max,
+      const xa_nn_residual_cfg_t *p_res_cfg,
+      xa_dma_cfg_t *p_dma_cfg);
+
+  WORD32 xa_nn_conv2d_pointwise_v2_act_per_chan_sym8sxasym8s(
+      WORD8* __restrict__ p_out,
+      WORD8* __restrict__ p_kernel,
+      WORD8* __restrict__ p_inp,
+      WORD32* __restrict__ p_bias,
+      WORD32  input_height,
+      WORD32  input_width,
+      WORD32  input_channels,
+      WORD32  out_channels,
+      WORD32  input_zero_bias,
+      WORD32* __restrict__ p_out_multiplier,
+      WORD32* __restrict__ p_out_shift,
+      WORD32  out_zero_bias,
+      WORD32  out_data_format,
+      WORD32  out_activation_min,
+      WORD32  out_activation_max,
+      const xa_nn_act_cfg_t *p_act_cfg,
+      xa_dma_cfg_t *p_dma_cfg);
+
+  /* Pointwise conv with a max (POOL_MAX) or average (POOL_AVG) pooling
+   * epilogue, NHWC output of pool_out_height x pool_out_width x
+   * out_channels. The conv output (input_height x input_width) is never
+   * stored; scratch size from xa_nn_conv2d_pointwise_v2_pool_getsize. */
+  WORD32 xa_nn_conv2d_pointwise_v2_pool_per_chan_sym8sxasym8s(
+      WORD8* __restrict__ p_out,
+      WORD8* __restrict__ p_kernel,
+      WORD8* __restrict__ p_inp,
+      WORD32* __restrict__ p_bias,
+      WORD32  input_height,
+      WORD32  input_width,
+      WORD32  input_channels,
+      WORD32  out_channels,
+      WORD32  input_zero_bias,
+      WORD32* __restrict__ p_out_multiplier,
+      WORD32* __restrict__ p_out_shift,
+      WORD32  out_zero_bias,
+      WORD32  out_activation_min,
+      WORD32  out_activation_max,
+      WORD32  pool_type,
+      WORD32  pool_height,
+      WORD32  pool_width,
+      WORD32  pool_x_stride,
+      WORD32  pool_y_stride,
+      WORD32  pool_x_padding,
+      WORD32  pool_y_padding,
+      WORD32  pool_out_height,
+      WORD32  pool_out_width,
+      VOID *p_scratch);
+
+  /* Depthwise (NHWC input) followed by pointwise conv without storing the
+   * depthwise output tensor: rows_per_block depthwise output rows at a time
+   * go through scratch, sized by xa_nn_conv2d_depthwise_pointwise_getsize.
+   * pw_input_zero_bias is the pointwise input_zero_bias, normally
+   * -dw_out_zero_bias. */
+  WORD32 xa_nn_conv2d_depthwise_pointwise_v2_per_chan_sym8sxasym8s(
+      WORD8* __restrict__ p_out,
+      const WORD8* __restrict__ p_dw_kernel,
+      const WORD8* __restrict__ p_pw_kernel,
+      const WORD8* __restrict__ p_inp,
+      const WORD32* __restrict__ p_dw_bias,
+      const WORD32* __restrict__ p_pw_bias,
+      WORD32  input_height,
+      WORD32  input_width,
+      WORD32  input_channels,
+      WORD32  kernel_height,
+      WORD32  kernel_width,
+      WORD32  channels_multiplier,
+      WORD32  x_stride,
+      WORD32  y_stride,
+      WORD32  x_padding,
+      WORD32  y_padding,
+      WORD32  out_height,
+      WORD32  out_width,
+      WORD32  out_channels,
+      WORD32  input_zero_bias,
+      const WORD32 *p_dw_out_multiplier,
+      const WORD32 *p_dw_out_shift,
+      WORD32  dw_out_zero_bias,
+      WORD32  dw_out_activation_min,
+      WORD32  dw_out_activation_max,
+      WORD32  pw_input_zero_bias,
+      const WORD32 *p_out_multiplier,
+      const WORD32 *p_out_shift,
+      WORD32  out_zero_bias,
+      WORD32  out_data_format,
+      WORD32  out_activation_min,
+      WORD32  out_activation_max,
+      WORD32  rows_per_block,
+      pVOID p_scratch);
+
   WORD32 xa_nn_conv2d_pointwise_per_chan_sym8sxsym16s(
       WORD16* __restrict__ p_out,
       WORD8* __restrict__ p_kernel,
@@ -3345,6 +4477,14 @@ WORD32 xa_nn_gru_hidden_state_update_8(WORD8* p_hidden_state,
       WORD32   out_zero_bias,
       WORD32   num_elm);
 
+  WORD32 xa_nn_elm_prog_asym8s(WORD8 * __restrict__ p_out,
+      const WORD32 *const p_out_shape,
+      const WORD8 **pp_inps,
+      const WORD32 **pp_inp_shapes,
+      WORD32 num_inps,
+      const xa_nn_elm_prog_instr_t *p_prog,
+      WORD32 num_instrs);
+
   WORD32 xa_nn_elm_max_8x8_8(  WORD8* __restrict__ p_out,
       const WORD8* __restrict__ p_in1,
       const WORD8* __restrict__ p_in2,
@@ -3875,6 +5015,31 @@ WORD32 xa_nn_gru_hidden_state_update_8(WORD8* p_hidden_state,
       WORD32 input_zero_bias,
       WORD32 output_zero_bias);
 
+  WORD32 xa_nn_layer_norm_asym8s_asym8s(WORD8 * __restrict__ p_out
+      ,const WORD8 * __restrict__ p_inp
+      ,const WORD16 * __restrict__ p_gamma
+      ,const WORD32 * __restrict__ p_beta
+      ,WORD32 num_rows
+      ,WORD32 row_len
+      ,WORD32 variance_epsilon
+      ,WORD32 out_multiplier
+      ,WORD32 out_shift
+      ,WORD32 out_zero_bias
+      ,WORD32 out_activation_min
+      ,WORD32 out_activation_max);
+
+  WORD32 xa_nn_layer_norm_sym16s_sym16s(WORD16 * __restrict__ p_out
+      ,const WORD16 * __restrict__ p_inp
+      ,const WORD16 * __restrict__ p_gamma
+      ,const WORD32 * __restrict__ p_beta
+      ,WORD32 num_rows
+      ,WORD32 row_len
+      ,WORD32 variance_epsilon
+      ,WORD32 out_multiplier
+      ,WORD32 out_shift
+      ,WORD32 out_activation_min
+      ,WORD32 out_activation_max);
+
   WORD32 xa_nn_resize_bilinear_8_8(pWORD8 __restrict__ p_out
       ,const WORD8 *__restrict__ p_inp
       ,WORD32  input_batch
@@ -4046,6 +5211,49 @@ WORD32 xa_nn_lstm_sym8sxasym8s_16(
     lstm_flags *p_lstm_flags,
     void*  p_scratch);
 
+/* Gate-stacked LSTM weights: rows [0, n_cell) hold the input gate, followed by
+ * the forget, cell and output gates. Multipliers and shifts are per row. */
+typedef struct _lstm_fused_weights
+{
+  WORD8  *p_W;                  /* [4 * n_cell][inp_size] */
+  WORD8  *p_U;                  /* [4 * n_cell][n_cell] */
+  WORD32 *p_W_bias;             /* [4 * n_cell] */
+  WORD32 *p_U_bias;             /* [4 * n_cell] */
+  WORD32 *p_W_out_multiplier;   /* [4 * n_cell] */
+  WORD32 *p_W_out_shift;        /* [4 * n_cell] */
+  WORD32 *p_U_out_multiplier;   /* [4 * n_cell] */
+  WORD32 *p_U_out_shift;        /* [4 * n_cell] */
+} lstm_fused_weights;
+
+WORD32 xa_nn_lstm_fused_weights_getsize(
+    WORD32 inp_size,
+    WORD32 n_cell);
+
+WORD32 xa_nn_lstm_fused_pack_weights_sym8s(
+    lstm_fused_weights *p_fused,        /* out */
+    void*  p_buf,                       /* out */
+    lstm_weights_ptrs *p_lstm_weights,  /* input */
+    lstm_bias_ptrs    *p_lstm_biases,   /* input */
+    lstm_quant_params *p_lstm_qp,       /* input */
+    WORD32 inp_size,
+    WORD32 n_cell);
+
+WORD32 xa_nn_lstm_fused_sym8sxasym8s_16(
+    WORD8*  p_out,                      /* out */
+    WORD8*  p_hidden_state,             /* inout */
+    WORD16* p_cell_state,               /* inout */
+    lstm_fused_weights *p_fused,        /* input */
+    WORD8*  p_inp,                      /* input */
+    WORD32 inp_size,
+    WORD32 hidden_size,
+    WORD32 out_size,
+    WORD32 n_batch,
+    WORD32 n_itr,
+    WORD32 n_cell,
+    lstm_quant_params *p_lstm_qp,
+    lstm_flags *p_lstm_flags,
+    void*  p_scratch);
+
 
 typedef struct _gru_weights_ptrs
 {
@@ -4114,6 +5322,49 @@ WORD32 xa_nn_gru_sym8sxasym8s(
     WORD32 time_major,
     void* p_scratch
 );
+
+/* Gate-stacked GRU weights: rows [0, hidden_size) hold the update gate,
+ * followed by the reset gate and the modulated state. Multipliers and shifts
+ * are per row. */
+typedef struct _gru_fused_weights
+{
+    WORD8  *p_W;                /* [3 * hidden_size][inp_size] */
+    WORD8  *p_U;                /* [3 * hidden_size][hidden_size] */
+    WORD32 *p_W_bias;           /* [3 * hidden_size] */
+    WORD32 *p_U_bias;           /* [3 * hidden_size] */
+    WORD32 *p_W_out_multiplier; /* [3 * hidden_size] */
+    WORD32 *p_W_out_shift;      /* [3 * hidden_size] */
+    WORD32 *p_U_out_multiplier; /* [3 * hidden_size] */
+    WORD32 *p_U_out_shift;      /* [3 * hidden_size] */
+} gru_fused_weights;
+
+WORD32 xa_nn_gru_fused_weights_getsize(
+    WORD32 inp_size,
+    WORD32 hidden_size);
+
+WORD32 xa_nn_gru_fused_pack_weights_sym8s(
+    gru_fused_weights *p_fused,
+    void* p_buf,
+    const gru_weights_ptrs *p_gru_weights,
+    const gru_bias_ptrs *p_gru_biases,
+    const gru_quant_params *p_gru_qp,
+    WORD32 inp_size,
+    WORD32 hidden_size);
+
+WORD32 xa_nn_gru_fused_sym8sxasym8s(
+    WORD8* p_out,
+    const WORD8* p_hidden_state,
+    const gru_fused_weights *p_fused,
+    const WORD8* p_inp,
+    WORD32 inp_size,
+    WORD32 hidden_size,
+    WORD32 out_size,
+    WORD32 n_batch,
+    WORD32 n_itr,
+    const gru_quant_params *p_gru_qp,
+    WORD32 time_major,
+    void* p_scratch
+);
     
 
 
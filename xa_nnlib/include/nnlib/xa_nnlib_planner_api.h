@@ -0,0 +1,192 @@
+/*******************************************************************************
+* Copyright (c) 2018-2025 Cadence Design Systems, Inc.
+*
+* Permission is hereby granted, free of charge, to any person obtaining
+* a copy of this software and associated documentation files (the
+* "Software"), to use this Software with Cadence processor cores only and
+* not with any other processors and platforms, subject to
+* the following conditions:
+*
+* The above copyright notice and this permission notice shall be included
+* in all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+******************************************************************************/
+#ifndef __XA_PLANNER_API_H__
+#define __XA_PLANNER_API_H__
+
+#include "xa_nnlib_standards.h"
+
+#define XA_NNLIB_PLANNER    4
+
+#define XA_NNLIB_PLANNER_MAX_DIMS   5
+
+/* Operators with a kernel scratch size query */
+typedef enum _xa_nnlib_planner_op_type_t
+{
+  XA_NNLIB_PLANNER_OP_CUSTOM              = 0,  // scratch.size given by the caller, 0 for no scratch
+  XA_NNLIB_PLANNER_OP_CONV2D_STD          = 1,  // xa_nn_conv2d_std_getsize
+  XA_NNLIB_PLANNER_OP_CONV2D              = 2,  // xa_nn_conv2d_getsize
+  XA_NNLIB_PLANNER_OP_CONV2D_DEPTHWISE    = 3,  // xa_nn_conv2d_depthwise_getsize
+  XA_NNLIB_PLANNER_OP_TRANSPOSE_CONV      = 4,  // xa_nn_transpose_conv_getsize
+  XA_NNLIB_PLANNER_OP_AVGPOOL             = 5,  // xa_nn_avgpool_getsize
+  XA_NNLIB_PLANNER_OP_MAXPOOL             = 6,  // xa_nn_maxpool_getsize
+  XA_NNLIB_PLANNER_OP_SOFTMAX             = 7,  // get_softmax_scratch_size
+  XA_NNLIB_PLANNER_OP_REDUCE              = 8,  // xa_nn_reduce_getsize_nhwc
+  XA_NNLIB_PLANNER_OP_BATCH_MATMUL        = 9,  // xa_nn_batch_matmul_getsize
+  XA_NNLIB_PLANNER_OP_LSTM                = 10, // xa_nn_lstm_getsize
+  XA_NNLIB_PLANNER_OP_GRU                 = 11  // xa_nn_gru_getsize
+} xa_nnlib_planner_op_type_t;
+
+/************************************************************/
+/* Class 1: Configuration Errors                            */
+/************************************************************/
+/* Nonfatal Errors */
+/* None */
+
+/* Fatal Errors */
+typedef enum _xa_nnlib_fatal_config_planner_error_code_t
+{
+  XA_NNLIB_PLANNER_CONFIG_FATAL_INVALID_OP_TYPE       = XA_ERROR_CODE(xa_severity_fatal, xa_class_config, XA_NNLIB_PLANNER, 0),
+  XA_NNLIB_PLANNER_CONFIG_FATAL_INVALID_OP_PARAMS     = XA_ERROR_CODE(xa_severity_fatal, xa_class_config, XA_NNLIB_PLANNER, 1),
+  XA_NNLIB_PLANNER_CONFIG_FATAL_INVALID_TENSOR        = XA_ERROR_CODE(xa_severity_fatal, xa_class_config, XA_NNLIB_PLANNER, 2),
+  XA_NNLIB_PLANNER_CONFIG_FATAL_INVALID_ALIGNMENT     = XA_ERROR_CODE(xa_severity_fatal, xa_class_config, XA_NNLIB_PLANNER, 3)
+} xa_nnlib_fatal_config_planner_error_code_t;
+
+/* Arguments of the scratch size query of one operator, named as in the
+ * corresponding *_getsize function */
+typedef struct _xa_nnlib_planner_conv_params_t
+{
+  Int32 input_height;
+  Int32 input_width;
+  Int32 input_channels;
+  Int32 kernel_height;
+  Int32 kernel_width;
+  Int32 kernel_channels;        /* conv2d_std, conv2d */
+  Int32 channels_multiplier;    /* conv2d_depthwise */
+  Int32 num_groups;             /* transpose_conv */
+  Int32 x_stride;
+  Int32 y_stride;
+  Int32 x_padding;
+  Int32 y_padding;
+  Int32 out_height;
+  Int32 out_width;
+  Int32 out_channels;
+  Int32 dilation_height;
+  Int32 dilation_width;
+  Int32 input_precision;        /* circ_buf_precision for conv2d_depthwise */
+  Int32 kernel_precision;
+  Int32 out_precision;
+  Int32 inp_data_format;
+  Int32 out_data_format;
+} xa_nnlib_planner_conv_params_t;
+
+typedef struct _xa_nnlib_planner_op_t
+{
+  xa_nnlib_planner_op_type_t type;
+  union
+  {
+    /* CONV2D_STD, CONV2D, CONV2D_DEPTHWISE, TRANSPOSE_CONV, AVGPOOL, MAXPOOL */
+    xa_nnlib_planner_conv_params_t conv;
+    struct
+    {
+      Int32 inp_precision;
+      Int32 out_precision;
+      Int32 length;
+    } softmax;
+    struct
+    {
+      Int32 inp_precision;
+      Int32 inp_shape[XA_NNLIB_PLANNER_MAX_DIMS];
+      Int32 num_inp_dims;
+      Int32 axis[XA_NNLIB_PLANNER_MAX_DIMS];
+      Int32 num_axis_dims;
+      Int32 reduce_ops;
+    } reduce;
+    struct
+    {
+      Int32 mat1_shape[XA_NNLIB_PLANNER_MAX_DIMS];
+      Int32 mat2_shape[XA_NNLIB_PLANNER_MAX_DIMS];
+      Int32 mat1_transpose;
+      Int32 mat2_transpose;
+      Int32 mat1_precision;
+      Int32 mat2_precision;
+    } batch_matmul;
+    struct
+    {
+      Int32 n_batch;
+      Int32 n_itr;
+      Int32 n_cell;             /* hidden_size for GRU */
+      Int32 state_precision;
+    } rnn;
+    struct
+    {
+      Int32 size;
+    } scratch;
+  } params;
+
+  /* Filled by xa_nnlib_planner_plan */
+  Int32 scratch_size;           /* bytes of kernel scratch */
+  Int32 scratch_offset;         /* arena offset of the kernel scratch */
+} xa_nnlib_planner_op_t;
+
+/* Activation tensor live from op first_op to op last_op (inclusive), with
+ * ops numbered in execution order. Network inputs use first_op = 0 and
+ * network outputs last_op = n_ops - 1. */
+typedef struct _xa_nnlib_planner_tensor_t
+{
+  Int32 size;                   /* bytes */
+  Int32 first_op;
+  Int32 last_op;
+
+  /* Filled by xa_nnlib_planner_plan */
+  Int32 offset;                 /* arena offset */
+} xa_nnlib_planner_tensor_t;
+
+#if defined(__cplusplus)
+extern "C" {
+#endif    /* __cplusplus */
+
+#ifdef ENABLE_SCRATCH_SIZE_API_ONLY
+#if defined(hifi5)
+#define xa_nnlib_planner_get_op_scratch_size    xa_nnlib_planner_get_op_scratch_size_hifi5
+#define xa_nnlib_planner_plan                   xa_nnlib_planner_plan_hifi5
+#elif defined(hifi4)
+#define xa_nnlib_planner_get_op_scratch_size    xa_nnlib_planner_get_op_scratch_size_hifi4
+#define xa_nnlib_planner_plan                   xa_nnlib_planner_plan_hifi4
+#endif
+#endif /* #ifdef ENABLE_SCRATCH_SIZE_API_ONLY */
+
+/************************************************************/
+/* Planner Query Functions                                  */
+/************************************************************/
+/* Kernel scratch bytes of one operator, or a negative error code */
+Int32 xa_nnlib_planner_get_op_scratch_size(const xa_nnlib_planner_op_t *p_op);
+
+/************************************************************/
+/* Planner Function                                         */
+/************************************************************/
+/* Places all tensors and per operator scratch buffers in one arena. Buffers
+ * whose lifetimes overlap never share bytes; the others are packed greedily,
+ * largest first, at the lowest free aligned offset. Kernel scratch lives only
+ * during its own operator so it is shared with every buffer not live at that
+ * point. Offsets are multiples of alignment (a power of 2). */
+Int32 xa_nnlib_planner_plan(xa_nnlib_planner_op_t *p_ops,
+                            Int32 n_ops,
+                            xa_nnlib_planner_tensor_t *p_tensors,
+                            Int32 n_tensors,
+                            Int32 alignment,
+                            Int32 *p_arena_size);
+
+#if defined(__cplusplus)
+}
+#endif    /* __cplusplus */
+
+#endif  /* __XA_PLANNER_API_H__ */
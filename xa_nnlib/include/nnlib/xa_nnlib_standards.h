@@ -94,6 +94,36 @@ typedef enum _compare_ops_t{
   COMPARE_ERROR=-1
 }compare_ops_t;
 
+//For fused pooling epilogues
+typedef enum _pool_type_t{
+  POOL_MAX = 0,
+  POOL_AVG = 1
+}pool_type_t;
+
+//For activation epilogues built by xa_nn_vec_activation_lut_asym8s
+typedef enum _act_type_t{
+  ACT_RELU = 0,
+  ACT_LEAKY_RELU = 1,
+  ACT_PRELU = 2,
+  ACT_HARD_SWISH = 3,
+  ACT_SIGMOID = 4,
+  ACT_TANH = 5,
+  ACT_GELU = 6,
+  ACT_SILU = 7
+}act_type_t;
+
+//Opcodes for xa_nn_elm_prog_asym8s instructions
+typedef enum _elm_prog_op_t{
+  ELM_PROG_ADD = 0,
+  ELM_PROG_SUB = 1,
+  ELM_PROG_MUL = 2,
+  ELM_PROG_MIN = 3,
+  ELM_PROG_MAX = 4,
+  ELM_PROG_CLAMP = 5,
+  ELM_PROG_SIGMOID = 6,
+  ELM_PROG_TANH = 7
+}elm_prog_op_t;
+
 typedef enum _xa_nnlib_prec_t
 {
   PREC_BOOL   =  1,
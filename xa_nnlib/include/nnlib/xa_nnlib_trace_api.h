@@ -0,0 +1,68 @@
+/*******************************************************************************
+* Copyright (c) 2018-2025 Cadence Design Systems, Inc.
+*
+* Permission is hereby granted, free of charge, to any person obtaining
+* a copy of this software and associated documentation files (the
+* "Software"), to use this Software with Cadence processor cores only and
+* not with any other processors and platforms, subject to
+* the following conditions:
+*
+* The above copyright notice and this permission notice shall be included
+* in all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+******************************************************************************/
+#ifndef __XA_NNLIB_TRACE_API_H__
+#define __XA_NNLIB_TRACE_API_H__
+
+#include "xa_type_def.h"
+
+#define XA_NNLIB_TRACE_MAX_DIMS   8
+
+/* Kernel tracing. With a library built with ENABLE_TRACE=1 every public
+ * xa_nn_* kernel reports an enter and an exit event to the registered
+ * callback. Without a callback the wrappers cost one pointer test. */
+
+typedef enum _xa_nnlib_trace_phase_t
+{
+  XA_NNLIB_TRACE_ENTER    = 0,
+  XA_NNLIB_TRACE_EXIT     = 1
+} xa_nnlib_trace_phase_t;
+
+typedef struct _xa_nnlib_trace_event_t
+{
+  WORD32 kernel_id;                       /* Index of the kernel in the library trace table */
+  const char *p_kernel_name;              /* Kernel function name */
+  WORD32 phase;                           /* xa_nnlib_trace_phase_t */
+  WORD32 ret;                             /* Kernel return value, XA_NNLIB_TRACE_EXIT only */
+  WORD32 n_dims;
+  WORD32 dims[XA_NNLIB_TRACE_MAX_DIMS];   /* Shape arguments (heights, widths, channels, rows, cols, lengths) in argument order */
+  UWORD64 timestamp;                      /* CCOUNT cycles on Xtensa, CLOCK_MONOTONIC nanoseconds on the host */
+} xa_nnlib_trace_event_t;
+
+typedef void (*xa_nnlib_trace_callback_t)(const xa_nnlib_trace_event_t *p_event, void *p_user);
+
+#if defined(__cplusplus)
+extern "C" {
+#endif    /* __cplusplus */
+
+/* Registers the callback (NULL disables tracing). Returns -1 if the
+ * library is built without ENABLE_TRACE=1. The callback runs on the
+ * calling thread; it is not synchronized with kernels running on others. */
+WORD32 xa_nnlib_trace_set_callback(xa_nnlib_trace_callback_t callback, void *p_user);
+
+/* Timestamp in the units of xa_nnlib_trace_event_t.timestamp */
+UWORD64 xa_nnlib_trace_timestamp(void);
+
+#if defined(__cplusplus)
+}
+#endif    /* __cplusplus */
+
+#endif /* __XA_NNLIB_TRACE_API_H__ */
@@ -181,6 +181,30 @@ int load_batch_matmul_input_data(int write_file, FILE *fptr_inp, buf2D_t *p_mat1
   return 0;
 }
 
+int load_attention_input_data(int write_file, FILE *fptr_inp, buf2D_t *p_q, buf1D_t *p_k, buf1D_t *p_v)
+{
+  if(write_file)
+  {
+    /* Set random input data */
+    set_rand_inp_buf2D(p_q);
+    set_rand_inp_buf1D(p_k);
+    set_rand_inp_buf1D(p_v);
+
+    /* Write input data into file */
+    write_buf2D_to_file(fptr_inp, p_q);
+    write_buf1D_to_file(fptr_inp, p_k);
+    write_buf1D_to_file(fptr_inp, p_v);
+  }
+  else
+  {
+    /* Read input data from file */
+    read_buf2D_from_file(fptr_inp, p_q, 0);
+    read_buf1D_from_file(fptr_inp, p_k);
+    read_buf1D_from_file(fptr_inp, p_v);
+  }
+  return 0;
+}
+
 int load_activation_input_data(int write_file, FILE *fptr_inp, buf1D_t *p_inp, buf1D_t *p_inp_alpha, char *kernel_name) 
 {  
   if(write_file)                                                                     
@@ -140,7 +140,7 @@ void show_usage(void)
     printf("\t-out_precision : 16, 32, -1(single prec float),-2(half prec float), -3 (asym8u), -4 (asym8s), -7 (asym16s) or -8 (sym16s); Default=32\n");
     printf("\t-integer_bits : number of integer bits in input for tanh_16_16 (0-6); Default=3\n");
     printf("\t-frames: Positive number; Default=2\n");
-    printf("\t-activation: sigmoid, tanh, relu, relu_std, relu1, relu6, leaky_relu, prelu, hard_swish, activation_min_max or softmax; Default=sigmoid\n");
+    printf("\t-activation: sigmoid, tanh, relu, relu_std, relu1, relu6, leaky_relu, prelu, hard_swish, gelu, silu, activation_min_max or softmax; Default=sigmoid\n");
     printf("\t-write_file: set to 1 to write input and output vectors to file; Default=0\n");
     printf("\t-read_inp_file_name: Full filename for reading input \n");
     printf("\t-read_ref_file_name: Full filename for reading reference output \n");
@@ -151,7 +151,7 @@ void show_usage(void)
     printf("\t ===== ASYM8 specific parameters =====\n ");
     printf("\t =====================================\n ");
     printf ("\t-diffmin: diffmin; Default=-15\n");
-    printf ("\t-input_left_shift: input_left_shift;   Default=27\n");
+    printf ("\t-input_left_shift: input_left_shift, input_shift for gelu and silu;   Default=27\n");
     printf ("\t-input_multiplier: input_multiplier; Default=2060158080\n");
     printf("\t-activation_max: asym8/16/8 input data activation max; Default=0\n");
     printf("\t-activation_min: asym8/16/8 input data activation min; Default=0\n");
@@ -383,6 +383,29 @@ void parse_arguments(int argc, char** argv, test_config_t *p_cfg)
                 cfg.out_zero_bias, cfg.num_elements);\
       XTPWR_PROFILER_STOP(0);\
     }
+/* input_left_shift is the input_shift of gelu and silu */
+#define GELU_SILU_ASYM8S_FN(IPREC, OPREC, ACTIVATION) \
+    if((IPREC == p_inp->precision) && (OPREC == p_out->precision) && !strcmp(cfg.activation,#ACTIVATION)) {\
+      XTPWR_PROFILER_START(0);\
+      err = xa_nn_vec_##ACTIVATION##_asym8s_asym8s ( \
+                (WORD8 *)p_out->p, (WORD8 *)p_inp->p, \
+                cfg.inp_zero_bias, \
+                cfg.input_multiplier, cfg.input_left_shift, \
+                cfg.out_multiplier, cfg.out_shift, \
+                cfg.out_zero_bias, cfg.num_elements);\
+      XTPWR_PROFILER_STOP(0);\
+    }
+
+#define GELU_SILU_SYM16S_FN(IPREC, OPREC, ACTIVATION) \
+    if((IPREC == p_inp->precision) && (OPREC == p_out->precision) && !strcmp(cfg.activation,#ACTIVATION)) {\
+      XTPWR_PROFILER_START(0);\
+      err = xa_nn_vec_##ACTIVATION##_sym16s_sym16s ( \
+                (WORD16 *)p_out->p, (WORD16 *)p_inp->p, \
+                cfg.input_multiplier, cfg.input_left_shift, \
+                cfg.out_multiplier, cfg.out_shift, \
+                cfg.num_elements);\
+      XTPWR_PROFILER_STOP(0);\
+    }
 #define SOFTMAX_ASYM8(KERNEL, IPREC, OPREC) \
   if(!strcmp(cfg.activation,#KERNEL) && (IPREC == cfg.inp_precision) && (OPREC == p_out->precision)) {\
     XTPWR_PROFILER_START(0);\
@@ -570,6 +593,8 @@ void parse_arguments(int argc, char** argv, test_config_t *p_cfg)
     else ACTIVATION_FN_F32(-1, -1, relu_std) \
     else ACTIVATION_MIN_MAX_FN_F32(-1, -1, activation_min_max) \
     else ACTIVATION_FN_F32(-1, -1, softmax) \
+    else ACTIVATION_FN_F32(-1, -1, gelu) \
+    else ACTIVATION_FN_F32(-1, -1, silu) \
     else ACTIVATION_MIN_MAX_ASYM8U_FN(-3, -3, activation_min_max) \
     else RELU_ASYM8U_FN(-3, -3, relu)\
     else RELU_ASYM8S_FN(-4, -4, relu)\
@@ -577,6 +602,10 @@ void parse_arguments(int argc, char** argv, test_config_t *p_cfg)
     else LEAKY_RELU_ASYM8S_FN(-4, -4, leaky_relu)\
     else LEAKY_RELU_ASYM16S_FN(-7, -7, leaky_relu)\
     else HSWISH_ASYM8S_FN(-4, -4, hard_swish)\
+    else GELU_SILU_ASYM8S_FN(-4, -4, gelu)\
+    else GELU_SILU_ASYM8S_FN(-4, -4, silu)\
+    else GELU_SILU_SYM16S_FN(-8, -8, gelu)\
+    else GELU_SILU_SYM16S_FN(-8, -8, silu)\
     else SOFTMAX_ASYM8(softmax, -3, -3) \
     else SOFTMAX_ASYM8s(softmax, -4, -4) \
     else SOFTMAX_ASYM8s_16(softmax, -4, 16) \
@@ -22,6 +22,7 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <math.h>
 #include <time.h>
 #include <xtensa/config/core-isa.h>
 #include "xa_type_def.h"
@@ -115,6 +116,8 @@ typedef struct _test_config_t
   int dstMemmoveOffset;
   //memsset
   float value;
+  //rope
+  int rope_interleaved;
 }test_config_t;
 
 int default_config(test_config_t *p_cfg)
@@ -167,6 +170,7 @@ int default_config(test_config_t *p_cfg)
     p_cfg->srcMemmoveOffset = 0;
     p_cfg->dstMemmoveOffset = 0;
     p_cfg->value = 0.0;
+    p_cfg->rope_interleaved = 0;
     p_cfg->kernel_type = 0;
 
     int itr;
@@ -203,9 +207,9 @@ void show_usage(void)
     printf("\t-vec_count: number of input vectors; Default=1\n");
     printf("\t-frames: Positive number; Default=2\n");
 #if HIFI_VFPU
-    printf("\t-kernel_name: elm_add, elm_sub, elm_mul, elm_mul_acc, elm_div, elm_floor, elm_min, elm_max, dot_prod, elm_equal, elm_notequal, elm_greater, elm_greaterequal, elm_less, elm_lessequal, reduce_max_4D, reduce_mean_4D, elm_sine, elm_cosine, elm_logn, elm_abs, elm_ceil, elm_round, elm_neg, elm_square, elm_rsqrt, elm_sqrt, broadcast, elm_requantize, elm_dequantize, elm_quantize, memmove, memset, elm_add_broadcast_4D, elm_sub_broadcast_4D, elm_mul_broadcast_4D, elm_div_broadcast_4D, elm_max_4D_Bcast, elm_min_4D_Bcast, elm_squared_diff_broadcast_4D, elm_sel, elm_clamp, elm_sel_broadcast_4D, elm_compare, elm_compare_broadcast_4D; Default=""elm_add""\n");
+    printf("\t-kernel_name: elm_add, elm_sub, elm_mul, elm_mul_acc, elm_div, elm_floor, elm_min, elm_max, dot_prod, elm_equal, elm_notequal, elm_greater, elm_greaterequal, elm_less, elm_lessequal, reduce_max_4D, reduce_mean_4D, elm_sine, elm_cosine, elm_logn, elm_abs, elm_ceil, elm_round, elm_neg, elm_square, elm_rsqrt, elm_sqrt, broadcast, elm_requantize, elm_dequantize, elm_quantize, memmove, memset, elm_add_broadcast_4D, elm_sub_broadcast_4D, elm_mul_broadcast_4D, elm_div_broadcast_4D, elm_max_4D_Bcast, elm_min_4D_Bcast, elm_squared_diff_broadcast_4D, elm_sel, elm_clamp, elm_sel_broadcast_4D, elm_compare, elm_compare_broadcast_4D, elm_prog, rope; Default=""elm_add""\n");
 #else
-    printf("\t-kernel_name: elm_add, elm_sub, elm_mul, elm_mul_acc, elm_div, elm_floor, elm_min, elm_max, dot_prod, elm_equal, elm_notequal, elm_greater, elm_greaterequal, elm_less, elm_lessequal, reduce_max_4D, reduce_mean_4D, elm_sine, elm_cosine, elm_logn, elm_abs, elm_ceil, elm_round, elm_neg, elm_square, elm_rsqrt, elm_sqrt, broadcast, elm_requantize, memmove, memset, elm_add_broadcast_4D, elm_sub_broadcast_4D, elm_mul_broadcast_4D, elm_div_broadcast_4D, elm_max_4D_Bcast, elm_min_4D_Bcast, elm_squared_diff_broadcast_4D, elm_sel, elm_clamp, elm_sel_broadcast_4D; Default=""elm_add""\n");
+    printf("\t-kernel_name: elm_add, elm_sub, elm_mul, elm_mul_acc, elm_div, elm_floor, elm_min, elm_max, dot_prod, elm_equal, elm_notequal, elm_greater, elm_greaterequal, elm_less, elm_lessequal, reduce_max_4D, reduce_mean_4D, elm_sine, elm_cosine, elm_logn, elm_abs, elm_ceil, elm_round, elm_neg, elm_square, elm_rsqrt, elm_sqrt, broadcast, elm_requantize, memmove, memset, elm_add_broadcast_4D, elm_sub_broadcast_4D, elm_mul_broadcast_4D, elm_div_broadcast_4D, elm_max_4D_Bcast, elm_min_4D_Bcast, elm_squared_diff_broadcast_4D, elm_sel, elm_clamp, elm_sel_broadcast_4D, elm_prog, rope; Default=""elm_add""\n");
 #endif
     printf("\t-write_file: set to 1 to write input and output vectors to file; Default=0\n");
     printf("\t-read_inp1_file_name: Full filename for reading inputs (order - inp) \n");
@@ -248,6 +252,7 @@ void show_usage(void)
     printf ("\t-input1_scale: input_scale(Float value. Only needed in dequantize operation); Default=0.5\n");
     printf ("\t-output_scale: output_scale(Float value. Only needed in quantize operation); Default=0.5\n");
     printf ("\t-val_memset: input_memset(Float value. Needed in memset operation); Default=0.0\n");
+    printf ("\t-rope_interleaved: rope pairs, 1: (2k, 2k+1), 0: (k, k+io_length/2); rope rotates vec_count rows of io_length; Default=0\n");
     printf ("\t-kernel_type: kernel type; Default=0\n");
 }
 
@@ -305,6 +310,7 @@ void parse_arguments(int argc, char** argv, test_config_t *p_cfg)
     ARGTYPE_ONETIME_CONFIG("-src_memmove_offset", p_cfg->srcMemmoveOffset);
     ARGTYPE_ONETIME_CONFIG("-dst_memmove_offset", p_cfg->dstMemmoveOffset);
     ARGTYPE_ONETIME_CONFIG_F32("-val_memset", p_cfg->value);
+    ARGTYPE_ONETIME_CONFIG("-rope_interleaved", p_cfg->rope_interleaved);
 
     ARGTYPE_ONETIME_CONFIG_ARRAY("-read_out_shape_str", p_cfg->output_shape, p_cfg->num_out_dims, p_cfg->read_out_shape_str);
 
@@ -590,6 +596,54 @@ void parse_arguments(int argc, char** argv, test_config_t *p_cfg)
     XTPWR_PROFILER_STOP(0);\
   }
 
+/* Two instruction program: out = (inp1 * inp2) + inp2 */
+#define ELM_PROG_ASYM8S(KERNEL, IPREC, OPREC) \
+  if(!strcmp(cfg.kernel_name, #KERNEL) && (IPREC == cfg.inp_precision) \
+     && (OPREC == cfg.out_precision)) {\
+    const WORD8 *pp_prog_inps[2] = {(WORD8 *) p_inp1->p, (WORD8 *) p_inp2->p};\
+    const WORD32 *pp_prog_shapes[2] = {cfg.input1_shape, cfg.input2_shape};\
+    xa_nn_elm_prog_instr_t prog[2];\
+    memset(prog, 0, sizeof(prog));\
+    prog[0].opcode = ELM_PROG_MUL;\
+    prog[0].dst = 2;\
+    prog[0].src0 = 0;\
+    prog[0].src1 = 1;\
+    prog[0].inp1_zero_bias = cfg.input1_zero_bias;\
+    prog[0].inp2_zero_bias = cfg.input2_zero_bias;\
+    prog[0].out_zero_bias = cfg.output_zero_bias;\
+    prog[0].out_shift = cfg.output_left_shift;\
+    prog[0].out_multiplier = cfg.output_multiplier;\
+    prog[0].out_activation_min = -128;\
+    prog[0].out_activation_max = 127;\
+    prog[1].opcode = ELM_PROG_ADD;\
+    prog[1].src0 = 2;\
+    prog[1].src1 = 1;\
+    prog[1].inp1_zero_bias = -cfg.output_zero_bias;\
+    prog[1].inp1_left_shift = cfg.input1_left_shift;\
+    prog[1].inp1_multiplier = cfg.input1_multiplier;\
+    prog[1].inp2_zero_bias = cfg.input2_zero_bias;\
+    prog[1].inp2_left_shift = cfg.input2_left_shift;\
+    prog[1].inp2_multiplier = cfg.input2_multiplier;\
+    prog[1].left_shift = cfg.left_shift;\
+    prog[1].out_zero_bias = cfg.output_zero_bias;\
+    prog[1].out_shift = cfg.output_left_shift > 0 ? 0 : cfg.output_left_shift;\
+    prog[1].out_multiplier = cfg.output_multiplier;\
+    prog[1].out_activation_min = cfg.output_activation_min;\
+    prog[1].out_activation_max = cfg.output_activation_max;\
+    XTPWR_PROFILER_START(0);\
+        err = xa_nn_##KERNEL##_asym8s\
+                (\
+                    (WORD8 *) p_out->p,\
+                    cfg.output_shape, \
+                    pp_prog_inps,\
+                    pp_prog_shapes,\
+                    2,\
+                    prog,\
+                    2\
+                );\
+    XTPWR_PROFILER_STOP(0);\
+  }
+
 #define MUL_BROADCAST_4D_SYM16S(KERNEL, IPREC, OPREC) \
   if(!strcmp(cfg.kernel_name, #KERNEL) && (IPREC == cfg.inp_precision) \
      && (OPREC == cfg.out_precision)) {\
@@ -1436,6 +1490,74 @@ void parse_arguments(int argc, char** argv, test_config_t *p_cfg)
                 );\
     XTPWR_PROFILER_STOP(0);\
    }
+
+/* Row s of vec_count rows is at position s, frequencies follow base 10000 */
+#define ROPE_TABLES(TYPE, SCALE) \
+    int rope_half = cfg.io_length / 2, rope_pos, rope_k;\
+    TYPE *p_rope_cos = (TYPE *)malloc(cfg.vec_count * (rope_half > 0 ? rope_half : 1) * sizeof(TYPE));\
+    TYPE *p_rope_sin = (TYPE *)malloc(cfg.vec_count * (rope_half > 0 ? rope_half : 1) * sizeof(TYPE));\
+    if(p_rope_cos == NULL || p_rope_sin == NULL) {\
+      free(p_rope_cos);\
+      free(p_rope_sin);\
+      printf("rope tables: allocation failed\n");\
+      return -1;\
+    }\
+    for(rope_pos = 0; rope_pos < cfg.vec_count; rope_pos++) {\
+      for(rope_k = 0; rope_k < rope_half; rope_k++) {\
+        double theta = rope_pos * pow(10000.0, -2.0 * rope_k / cfg.io_length);\
+        double c = cos(theta) * SCALE, s = sin(theta) * SCALE;\
+        if(SCALE > 1.0) {\
+          c = floor(c + 0.5); c = c > SCALE - 1 ? SCALE - 1 : c;\
+          s = floor(s + 0.5); s = s > SCALE - 1 ? SCALE - 1 : s;\
+        }\
+        p_rope_cos[rope_pos * rope_half + rope_k] = (TYPE)c;\
+        p_rope_sin[rope_pos * rope_half + rope_k] = (TYPE)s;\
+      }\
+    }
+
+#define ROPE_SYM16S(KERNEL, IPREC, OPREC) \
+  if(!strcmp(cfg.kernel_name, #KERNEL) && (IPREC == cfg.inp_precision) \
+     && (OPREC == cfg.out_precision)) {\
+    ROPE_TABLES(WORD16, 32768.0)\
+    XTPWR_PROFILER_START(0);\
+        err = xa_nn_##KERNEL##_sym16s_sym16s\
+                (\
+                    (WORD16 *) p_out->p,\
+                    (WORD16 *) p_inp1->p,\
+                    p_rope_cos,\
+                    p_rope_sin,\
+                    1,\
+                    cfg.vec_count,\
+                    cfg.io_length,\
+                    0,\
+                    cfg.rope_interleaved\
+                );\
+    XTPWR_PROFILER_STOP(0);\
+    free(p_rope_cos);\
+    free(p_rope_sin);\
+  }
+
+#define ROPE_F32(KERNEL, IPREC, OPREC) \
+  if(!strcmp(cfg.kernel_name, #KERNEL) && (IPREC == cfg.inp_precision) \
+     && (OPREC == cfg.out_precision)) {\
+    ROPE_TABLES(FLOAT32, 1.0)\
+    XTPWR_PROFILER_START(0);\
+        err = xa_nn_##KERNEL##_f32_f32\
+                (\
+                    (FLOAT32 *) p_out->p,\
+                    (FLOAT32 *) p_inp1->p,\
+                    p_rope_cos,\
+                    p_rope_sin,\
+                    1,\
+                    cfg.vec_count,\
+                    cfg.io_length,\
+                    0,\
+                    cfg.rope_interleaved\
+                );\
+    XTPWR_PROFILER_STOP(0);\
+    free(p_rope_cos);\
+    free(p_rope_sin);\
+  }
  
 #if HIFI_VFPU
 #define PROCESS_BASIC_FUNC \
@@ -1450,6 +1572,7 @@ void parse_arguments(int argc, char** argv, test_config_t *p_cfg)
     else MUL_ASYM8S(elm_mul, -4, -4) \
     else MUL_BROADCAST_4D_ASYM8S(elm_mul_broadcast_4D, -4, -4) \
     else MUL_BROADCAST_4D_SYM16S(elm_mul_broadcast_4D, -8, -8) \
+    else ELM_PROG_ASYM8S(elm_prog, -4, -4) \
     else ADD_ASYM8(elm_add, -3, -3) \
     else ADD_ASYM8S(elm_add, -4, -4) \
     else MATH_BROADCAST_4D_ASYM8S(elm_add_broadcast_4D, -4, -4) \
@@ -1525,6 +1648,8 @@ void parse_arguments(int argc, char** argv, test_config_t *p_cfg)
     else MEMMOVE_8_8(memmove, -4, -4) \
     else MEMMOVE_16_16(memmove, -8, -8) \
     else MEMSET_F32(memset, -1, -1) \
+    else ROPE_SYM16S(rope, -8, -8) \
+    else ROPE_F32(rope, -1, -1) \
     else {  printf("unsupported basic operation\n"); return -1;}
 #else
 #define PROCESS_BASIC_FUNC \
@@ -1532,6 +1657,7 @@ void parse_arguments(int argc, char** argv, test_config_t *p_cfg)
     else MUL_ASYM8S(elm_mul, -4, -4) \
     else MUL_BROADCAST_4D_ASYM8S(elm_mul_broadcast_4D, -4, -4) \
     else MUL_BROADCAST_4D_SYM16S(elm_mul_broadcast_4D, -8, -8) \
+    else ELM_PROG_ASYM8S(elm_prog, -4, -4) \
     else ADD_ASYM8(elm_add, -3, -3) \
     else ADD_ASYM8S(elm_add, -4, -4) \
     else MATH_BROADCAST_4D_ASYM8S(elm_add_broadcast_4D, -4, -4) \
@@ -1579,6 +1705,7 @@ void parse_arguments(int argc, char** argv, test_config_t *p_cfg)
     else REQUANTIZE_ASYM8S_ASYM16U(elm_requantize, -4, -6) \
     else MEMMOVE_8_8(memmove, -4, -4) \
     else MEMMOVE_16_16(memmove, -8, -8) \
+    else ROPE_SYM16S(rope, -8, -8) \
     else {  printf("unsupported basic operation\n"); return -1;}
 #endif
 
@@ -1766,6 +1893,7 @@ int xa_nn_main_process(int argc, char *argv[])
   else if( !strcmp(cfg.kernel_name, "elm_add_broadcast_4D") ||
            !strcmp(cfg.kernel_name, "elm_sub_broadcast_4D") ||
            !strcmp(cfg.kernel_name, "elm_mul_broadcast_4D") ||
+           !strcmp(cfg.kernel_name, "elm_prog")             ||
            !strcmp(cfg.kernel_name, "elm_div_broadcast_4D") ||
            !strcmp(cfg.kernel_name, "elm_compare_broadcast_4D") ||
            !strcmp(cfg.kernel_name, "elm_squared_diff_broadcast_4D"))
@@ -1799,7 +1927,8 @@ int xa_nn_main_process(int argc, char *argv[])
       !strcmp(cfg.kernel_name, "elm_requantize")  ||
       !strcmp(cfg.kernel_name, "elm_quantize")    ||
       !strcmp(cfg.kernel_name, "reduce_max_4D")   ||
-      !strcmp(cfg.kernel_name, "reduce_mean_4D"))
+      !strcmp(cfg.kernel_name, "reduce_mean_4D")  ||
+      !strcmp(cfg.kernel_name, "rope"))
   {
     no_of_inputs = 1;
   }
@@ -1866,6 +1995,7 @@ int xa_nn_main_process(int argc, char *argv[])
              !strcmp(cfg.kernel_name, "elm_add_broadcast_4D") ||
              !strcmp(cfg.kernel_name, "elm_sub_broadcast_4D") ||
              !strcmp(cfg.kernel_name, "elm_mul_broadcast_4D") ||
+             !strcmp(cfg.kernel_name, "elm_prog")             ||
              !strcmp(cfg.kernel_name, "elm_div_broadcast_4D") ||
              !strcmp(cfg.kernel_name, "elm_sel_broadcast_4D") ||
              !strcmp(cfg.kernel_name, "elm_compare_broadcast_4D") ||
@@ -1930,6 +2060,7 @@ int xa_nn_main_process(int argc, char *argv[])
   else if( !strcmp(cfg.kernel_name, "elm_add_broadcast_4D") || 
            !strcmp(cfg.kernel_name, "elm_sub_broadcast_4D") || 
            !strcmp(cfg.kernel_name, "elm_mul_broadcast_4D") || 
+           !strcmp(cfg.kernel_name, "elm_prog")             ||
            !strcmp(cfg.kernel_name, "elm_div_broadcast_4D") || 
            !strcmp(cfg.kernel_name, "elm_sel_broadcast_4D") ||
            !strcmp(cfg.kernel_name, "elm_compare_broadcast_4D")    ||
@@ -1966,6 +2097,7 @@ int xa_nn_main_process(int argc, char *argv[])
            !strcmp(cfg.kernel_name, "elm_add_broadcast_4D") ||
            !strcmp(cfg.kernel_name, "elm_sub_broadcast_4D") ||
            !strcmp(cfg.kernel_name, "elm_mul_broadcast_4D") ||
+           !strcmp(cfg.kernel_name, "elm_prog")             ||
            !strcmp(cfg.kernel_name, "elm_div_broadcast_4D") ||
            !strcmp(cfg.kernel_name, "elm_sel_broadcast_4D") ||
            !strcmp(cfg.kernel_name, "elm_compare_broadcast_4D")    ||
@@ -2041,6 +2173,7 @@ int xa_nn_main_process(int argc, char *argv[])
            !strcmp(cfg.kernel_name, "elm_add_broadcast_4D") ||
            !strcmp(cfg.kernel_name, "elm_sub_broadcast_4D") ||
            !strcmp(cfg.kernel_name, "elm_mul_broadcast_4D") ||
+           !strcmp(cfg.kernel_name, "elm_prog")             ||
            !strcmp(cfg.kernel_name, "elm_div_broadcast_4D") ||
            !strcmp(cfg.kernel_name, "elm_sel_broadcast_4D") ||
            !strcmp(cfg.kernel_name, "elm_compare_broadcast_4D") ||
@@ -0,0 +1,490 @@
+/*******************************************************************************
+* Copyright (c) 2018-2025 Cadence Design Systems, Inc.
+*
+* Permission is hereby granted, free of charge, to any person obtaining
+* a copy of this software and associated documentation files (the
+* "Software"), to use this Software with Cadence processor cores only and
+* not with any other processors and platforms, subject to
+* the following conditions:
+*
+* The above copyright notice and this permission notice shall be included
+* in all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+******************************************************************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "xa_type_def.h"
+#include "nnlib/xa_nnlib_api.h"
+#include "nnlib/xa_nnlib_trace_api.h"
+#include "cmdline_parser.h"
+#include "xa_nnlib_standards.h"
+
+/* Shape-sweep benchmark. Every kernel family is run over its grid of
+ * channels x spatial size x kernel size x stride, for each precision and
+ * input/output alignment offset. One CSV line is printed per point with
+ * the op count, bytes moved, best-of-frames time and the derived
+ * MACs/cycle, bytes/cycle and efficiency against the peak MAC rate.
+ * Time is CCOUNT cycles on Xtensa and nanoseconds on host builds, where
+ * the rates are per ns and the efficiency column is left empty. */
+
+#define MAX_FAMILY_NAME_LENGTH 20
+#define MAX_GRID_AXIS 8
+
+#define BENCH_PREC_8X8    (1 << 0)      /* asym8s activations, sym8s weights */
+#define BENCH_PREC_8X16   (1 << 1)      /* sym16s activations, sym8s weights */
+
+#define ALIGN_UP(n, a) (((n) + (a) - 1) & ~((a) - 1))
+
+enum bench_family_t
+{
+  FAMILY_CONV2D_STD = 0,
+  FAMILY_CONV2D_DEPTHWISE,
+  FAMILY_CONV2D_POINTWISE,
+  FAMILY_FULLY_CONNECTED,
+  FAMILY_MAXPOOL,
+  FAMILY_AVGPOOL,
+  FAMILY_ELM_ADD,
+  N_FAMILIES
+};
+
+typedef struct _bench_grid_t
+{
+  const char *name;
+  int is_mac;                        /* Efficiency is reported for MAC families only */
+  int precisions;
+  int channels[MAX_GRID_AXIS];       /* Input channels, weight depth for fully_connected */
+  int spatial[MAX_GRID_AXIS];        /* Input height = width, output depth for fully_connected */
+  int kernel[MAX_GRID_AXIS];
+  int stride[MAX_GRID_AXIS];
+}bench_grid_t;
+
+/* Zero terminated axes */
+static const bench_grid_t bench_grids[N_FAMILIES] =
+{
+  {"conv2d_std",       1, BENCH_PREC_8X8 | BENCH_PREC_8X16, {3, 8, 16, 24, 32, 64}, {8, 16, 32}, {1, 3, 5}, {1, 2}},
+  {"conv2d_depthwise", 1, BENCH_PREC_8X8 | BENCH_PREC_8X16, {8, 16, 24, 32, 64, 128}, {8, 16, 32}, {3, 5}, {1, 2}},
+  {"conv2d_pointwise", 1, BENCH_PREC_8X8 | BENCH_PREC_8X16, {8, 16, 24, 32, 64, 128}, {8, 16, 32}, {1}, {1}},
+  {"fully_connected",  1, BENCH_PREC_8X8 | BENCH_PREC_8X16, {64, 100, 128, 256, 512, 1024}, {16, 64, 250, 256}, {1}, {1}},
+  {"maxpool",          0, BENCH_PREC_8X8, {8, 16, 32, 64}, {8, 16, 32}, {2, 3}, {1, 2}},
+  {"avgpool",          0, BENCH_PREC_8X8, {8, 16, 32, 64}, {8, 16, 32}, {2, 3}, {1, 2}},
+  {"elm_add",          0, BENCH_PREC_8X8, {8, 15, 16, 64}, {8, 16, 32}, {1}, {1}},
+};
+
+typedef struct _test_config_t
+{
+  int help;
+  char family[MAX_FAMILY_NAME_LENGTH];
+  int precision;
+  int max_align;
+  int peak_8x8;
+  int peak_8x16;
+  int frames;
+}test_config_t;
+
+typedef struct _bench_point_t
+{
+  int family;
+  int precision;
+  int channels;
+  int spatial;
+  int kernel;
+  int stride;
+  int align;
+  int out_height;
+  int out_width;
+  int out_channels;
+  double ops;
+  double bytes;
+}bench_point_t;
+
+int default_config(test_config_t *p_cfg)
+{
+  if(p_cfg)
+  {
+    p_cfg->help = 0;
+    strcpy(p_cfg->family, "all");
+    p_cfg->precision = 0;
+    p_cfg->max_align = 1;
+    /* Nominal MACs/cycle, set to the values of the configured core */
+    p_cfg->peak_8x8 = 32;
+    p_cfg->peak_8x16 = 16;
+    p_cfg->frames = 2;
+    return 0;
+  }
+  else
+  {
+    return -1;
+  }
+}
+
+void show_usage(void)
+{
+    printf ("Usage xt-run <binary> [Options]\n");
+    printf("\t-family: conv2d_std, conv2d_depthwise, conv2d_pointwise, fully_connected, maxpool, avgpool, elm_add or all; Default=all\n");
+    printf("\t-precision: 0 (both), 8 (8x8) or 16 (8x16); Default=0\n");
+    printf("\t-max_align: input/output offsets 0..max_align elements from 64 byte alignment; Default=1\n");
+    printf("\t-peak_8x8: peak 8x8 MACs/cycle for the efficiency column (Xtensa only); Default=32\n");
+    printf("\t-peak_8x16: peak 8x16 MACs/cycle for the efficiency column (Xtensa only); Default=16\n");
+    printf("\t-frames: runs per point, the fastest is reported; Default=2\n");
+    printf("\t-h / -help / --help: Display this help message\n");
+}
+
+void parse_arguments(int argc, char** argv, test_config_t *p_cfg)
+{
+  int argidx;
+  for (argidx=1;argidx<argc;argidx++)
+  {
+    if(strncmp((argv[argidx]), "-", 1) != 0)
+    {
+      printf("Invalid argument: %s\n",argv[argidx]);
+      show_usage();
+      exit(1);
+    }
+    ARGTYPE_INDICATE("--help", p_cfg->help);
+    ARGTYPE_INDICATE("-help", p_cfg->help);
+    ARGTYPE_INDICATE("-h", p_cfg->help);
+    ARGTYPE_STRING("-family",p_cfg->family, MAX_FAMILY_NAME_LENGTH);
+    ARGTYPE_ONETIME_CONFIG("-precision",p_cfg->precision);
+    ARGTYPE_ONETIME_CONFIG("-max_align",p_cfg->max_align);
+    ARGTYPE_ONETIME_CONFIG("-peak_8x8",p_cfg->peak_8x8);
+    ARGTYPE_ONETIME_CONFIG("-peak_8x16",p_cfg->peak_8x16);
+    ARGTYPE_ONETIME_CONFIG("-frames",p_cfg->frames);
+
+    // If arg doesnt match with any of the above supported options, report option as invalid
+    printf("Invalid argument: %s\n",argv[argidx]);
+    show_usage();
+    exit(1);
+  }
+}
+
+static void fill_random(WORD8 *p, int bytes)
+{
+  int itr;
+  for(itr = 0; itr < bytes; itr++)
+  {
+    p[itr] = (WORD8)((rand() & 0xff) - 128);
+  }
+}
+
+/* Op count, bytes moved and output shape of one grid point ("same" padding) */
+static void point_shape(bench_point_t *p_pt)
+{
+  int act_bytes = (p_pt->precision == BENCH_PREC_8X16) ? 2 : 1;
+  int bias_bytes = (p_pt->precision == BENCH_PREC_8X16) ? 8 : 4;
+  double inp_size, out_size, weight_size;
+
+  p_pt->out_height = (p_pt->spatial + p_pt->stride - 1) / p_pt->stride;
+  p_pt->out_width = p_pt->out_height;
+  p_pt->out_channels = p_pt->channels;
+  inp_size = (double)p_pt->spatial * p_pt->spatial * p_pt->channels;
+  weight_size = 0;
+
+  switch(p_pt->family)
+  {
+    case FAMILY_CONV2D_STD:
+      weight_size = (double)p_pt->kernel * p_pt->kernel * p_pt->channels * p_pt->out_channels;
+      p_pt->ops = (double)p_pt->out_height * p_pt->out_width * weight_size;
+      break;
+    case FAMILY_CONV2D_DEPTHWISE:
+      weight_size = (double)p_pt->kernel * p_pt->kernel * p_pt->channels;
+      p_pt->ops = (double)p_pt->out_height * p_pt->out_width * weight_size;
+      break;
+    case FAMILY_CONV2D_POINTWISE:
+      weight_size = (double)p_pt->channels * p_pt->out_channels;
+      p_pt->ops = (double)p_pt->spatial * p_pt->spatial * weight_size;
+      break;
+    case FAMILY_FULLY_CONNECTED:
+      p_pt->out_height = p_pt->out_width = 1;
+      p_pt->out_channels = p_pt->spatial;
+      inp_size = p_pt->channels;
+      weight_size = (double)p_pt->channels * p_pt->out_channels;
+      p_pt->ops = weight_size;
+      break;
+    case FAMILY_MAXPOOL:
+    case FAMILY_AVGPOOL:
+      p_pt->ops = (double)p_pt->out_height * p_pt->out_width * p_pt->channels * p_pt->kernel * p_pt->kernel;
+      break;
+    case FAMILY_ELM_ADD:
+      p_pt->out_height = p_pt->out_width = p_pt->spatial;
+      inp_size *= 2;
+      p_pt->ops = (double)p_pt->spatial * p_pt->spatial * p_pt->channels;
+      break;
+  }
+  out_size = (double)p_pt->out_height * p_pt->out_width * p_pt->out_channels;
+  p_pt->bytes = (inp_size + out_size) * act_bytes + weight_size;
+  if(bench_grids[p_pt->family].is_mac)
+    p_pt->bytes += (double)p_pt->out_channels * bias_bytes;
+}
+
+static int get_scratch_size(const bench_point_t *p_pt)
+{
+  int inp_precision = (p_pt->precision == BENCH_PREC_8X16) ? PREC_SYM16S : PREC_ASYM8S;
+  int pad = (p_pt->kernel - 1) / 2;
+
+  switch(p_pt->family)
+  {
+    case FAMILY_CONV2D_STD:
+      return xa_nn_conv2d_std_getsize(p_pt->spatial, p_pt->spatial, p_pt->channels, p_pt->kernel, p_pt->kernel,
+          p_pt->channels, p_pt->stride, pad, p_pt->stride, pad, p_pt->out_height, p_pt->out_width,
+          p_pt->out_channels, inp_precision, PREC_SYM8S, 1, 1, 0);
+    case FAMILY_CONV2D_DEPTHWISE:
+      return xa_nn_conv2d_depthwise_getsize(p_pt->spatial, p_pt->spatial, p_pt->channels, p_pt->kernel, p_pt->kernel,
+          1, p_pt->stride, p_pt->stride, pad, pad, p_pt->out_height, p_pt->out_width, inp_precision, 0);
+    case FAMILY_MAXPOOL:
+      return xa_nn_maxpool_getsize(p_pt->channels, PREC_8, PREC_8, p_pt->spatial, p_pt->spatial,
+          p_pt->kernel, p_pt->kernel, p_pt->stride, p_pt->stride, pad, pad, p_pt->out_height, p_pt->out_width, 0, 0);
+    case FAMILY_AVGPOOL:
+      return xa_nn_avgpool_getsize(p_pt->channels, PREC_8, PREC_8, p_pt->spatial, p_pt->spatial,
+          p_pt->kernel, p_pt->kernel, p_pt->stride, p_pt->stride, pad, pad, p_pt->out_height, p_pt->out_width, 0, 0);
+    default:
+      return 0;
+  }
+}
+
+/* Runs one point, returns the kernel status and the fastest time in *p_time */
+static int run_point(const bench_point_t *p_pt, int frames, UWORD64 *p_time)
+{
+  int act_bytes = (p_pt->precision == BENCH_PREC_8X16) ? 2 : 1;
+  int pad = (p_pt->kernel - 1) / 2;
+  int inp_bytes = p_pt->spatial * p_pt->spatial * p_pt->channels * act_bytes;
+  int out_bytes = p_pt->out_height * p_pt->out_width * p_pt->out_channels * act_bytes;
+  int weight_bytes = p_pt->kernel * p_pt->kernel * p_pt->channels * p_pt->out_channels;
+  int scratch_size, frame, itr, err = 0;
+  WORD8 *p_inp_buf, *p_inp2_buf, *p_out_buf, *p_weight, *p_inp, *p_inp2, *p_out;
+  WORD64 *p_bias;
+  WORD32 *p_out_multiplier, *p_out_shift;
+  void *p_scratch;
+  UWORD64 start, stop;
+
+  if(p_pt->family == FAMILY_FULLY_CONNECTED)
+  {
+    inp_bytes = p_pt->channels * act_bytes;
+    weight_bytes = p_pt->channels * p_pt->out_channels;
+  }
+
+  scratch_size = get_scratch_size(p_pt);
+  if(scratch_size < 0)
+    return scratch_size;
+
+  p_inp_buf = (WORD8 *)malloc(inp_bytes + 128);
+  p_inp2_buf = (WORD8 *)malloc(inp_bytes + 128);
+  p_out_buf = (WORD8 *)malloc(out_bytes + 128);
+  p_weight = (WORD8 *)malloc(weight_bytes + 64);
+  p_bias = (WORD64 *)malloc(p_pt->out_channels * sizeof(WORD64));
+  p_out_multiplier = (WORD32 *)malloc(p_pt->out_channels * sizeof(WORD32));
+  p_out_shift = (WORD32 *)malloc(p_pt->out_channels * sizeof(WORD32));
+  p_scratch = malloc(scratch_size + 8);
+  if(p_inp_buf == NULL || p_inp2_buf == NULL || p_out_buf == NULL || p_weight == NULL ||
+     p_bias == NULL || p_out_multiplier == NULL || p_out_shift == NULL || p_scratch == NULL)
+  {
+    printf("[Error] Memory allocation failed\n");
+    exit(1);
+  }
+
+  p_inp = (WORD8 *)ALIGN_UP((unsigned long)p_inp_buf, 64) + p_pt->align * act_bytes;
+  p_inp2 = (WORD8 *)ALIGN_UP((unsigned long)p_inp2_buf, 64) + p_pt->align * act_bytes;
+  p_out = (WORD8 *)ALIGN_UP((unsigned long)p_out_buf, 64) + p_pt->align * act_bytes;
+  fill_random(p_inp, inp_bytes);
+  fill_random(p_inp2, inp_bytes);
+  fill_random(p_weight, weight_bytes);
+  for(itr = 0; itr < p_pt->out_channels; itr++)
+  {
+    if(p_pt->precision == BENCH_PREC_8X16)
+      p_bias[itr] = (rand() & 0xffff) - 0x8000;
+    else
+      ((WORD32 *)p_bias)[itr] = (rand() & 0xffff) - 0x8000;
+    p_out_multiplier[itr] = 0x40000000 + (rand() & 0xffff);
+    p_out_shift[itr] = -8;
+  }
+
+  *p_time = 0;
+  for(frame = 0; frame < frames && err == 0; frame++)
+  {
+    start = xa_nnlib_trace_timestamp();
+    switch(p_pt->family)
+    {
+      case FAMILY_CONV2D_STD:
+        if(p_pt->precision == BENCH_PREC_8X16)
+          err = xa_nn_conv2d_std_per_chan_sym8sxsym16s((WORD16 *)p_out, (WORD16 *)p_inp, p_weight, p_bias,
+              p_pt->spatial, p_pt->spatial, p_pt->channels, p_pt->kernel, p_pt->kernel, p_pt->out_channels,
+              p_pt->stride, p_pt->stride, pad, pad, p_pt->out_height, p_pt->out_width,
+              0, p_out_multiplier, p_out_shift, 0, 0, p_scratch);
+        else
+          err = xa_nn_conv2d_std_per_chan_sym8sxasym8s(p_out, p_inp, p_weight, (WORD32 *)p_bias,
+              p_pt->spatial, p_pt->spatial, p_pt->channels, p_pt->kernel, p_pt->kernel, p_pt->out_channels,
+              p_pt->stride, p_pt->stride, pad, pad, p_pt->out_height, p_pt->out_width,
+              -3, p_out_multiplier, p_out_shift, 5, 0, p_scratch);
+        break;
+      case FAMILY_CONV2D_DEPTHWISE:
+        if(p_pt->precision == BENCH_PREC_8X16)
+          err = xa_nn_conv2d_depthwise_per_chan_sym8sxsym16s((WORD16 *)p_out, p_weight, (WORD16 *)p_inp, p_bias,
+              p_pt->spatial, p_pt->spatial, p_pt->channels, p_pt->kernel, p_pt->kernel, 1,
+              p_pt->stride, p_pt->stride, pad, pad, p_pt->out_height, p_pt->out_width,
+              0, p_out_multiplier, p_out_shift, 0, 0, 0, p_scratch);
+        else
+          err = xa_nn_conv2d_depthwise_per_chan_sym8sxasym8s(p_out, p_weight, p_inp, (WORD32 *)p_bias,
+              p_pt->spatial, p_pt->spatial, p_pt->channels, p_pt->kernel, p_pt->kernel, 1,
+              p_pt->stride, p_pt->stride, pad, pad, p_pt->out_height, p_pt->out_width,
+              -3, p_out_multiplier, p_out_shift, 5, 0, 0, p_scratch);
+        break;
+      case FAMILY_CONV2D_POINTWISE:
+        if(p_pt->precision == BENCH_PREC_8X16)
+          err = xa_nn_conv2d_pointwise_per_chan_sym8sxsym16s((WORD16 *)p_out, p_weight, (WORD16 *)p_inp, p_bias,
+              p_pt->spatial, p_pt->spatial, p_pt->channels, p_pt->out_channels,
+              0, p_out_multiplier, p_out_shift, 0, 0);
+        else
+          err = xa_nn_conv2d_pointwise_per_chan_sym8sxasym8s(p_out, p_weight, p_inp, (WORD32 *)p_bias,
+              p_pt->spatial, p_pt->spatial, p_pt->channels, p_pt->out_channels,
+              -3, p_out_multiplier, p_out_shift, 5, 0);
+        break;
+      case FAMILY_FULLY_CONNECTED:
+        if(p_pt->precision == BENCH_PREC_8X16)
+          err = xa_nn_fully_connected_sym8sxsym16s_sym16s((WORD16 *)p_out, p_weight, (WORD16 *)p_inp, p_bias,
+              p_pt->channels, p_pt->out_channels, p_out_multiplier[0], p_out_shift[0]);
+        else
+          err = xa_nn_fully_connected_sym8sxasym8s_asym8s(p_out, p_weight, p_inp, (WORD32 *)p_bias,
+              p_pt->channels, p_pt->out_channels, -3, p_out_multiplier[0], p_out_shift[0], 5);
+        break;
+      case FAMILY_MAXPOOL:
+        err = xa_nn_maxpool_8(p_out, p_inp, p_pt->spatial, p_pt->spatial, p_pt->channels,
+            p_pt->kernel, p_pt->kernel, p_pt->stride, p_pt->stride, pad, pad,
+            p_pt->out_height, p_pt->out_width, 0, 0, p_scratch);
+        break;
+      case FAMILY_AVGPOOL:
+        err = xa_nn_avgpool_8(p_out, p_inp, p_pt->spatial, p_pt->spatial, p_pt->channels,
+            p_pt->kernel, p_pt->kernel, p_pt->stride, p_pt->stride, pad, pad,
+            p_pt->out_height, p_pt->out_width, 0, 0, p_scratch);
+        break;
+      case FAMILY_ELM_ADD:
+        err = xa_nn_elm_add_asym8sxasym8s_asym8s(p_out, 5, -1, 0x40000000, -128, 127,
+            p_inp, -3, -1, 0x40000000, p_inp2, 7, -1, 0x40000000, 20,
+            p_pt->spatial * p_pt->spatial * p_pt->channels);
+        break;
+    }
+    stop = xa_nnlib_trace_timestamp();
+    if(*p_time == 0 || stop - start < *p_time)
+      *p_time = stop - start;
+  }
+
+  free(p_scratch);
+  free(p_out_shift);
+  free(p_out_multiplier);
+  free(p_bias);
+  free(p_weight);
+  free(p_out_buf);
+  free(p_inp2_buf);
+  free(p_inp_buf);
+
+  return err;
+}
+
+int xa_nn_main_process(int argc, char *argv[])
+{
+  test_config_t cfg;
+  bench_point_t pt;
+  int family, prec, ic, is, ik, ist, err, n_points = 0, n_failed = 0;
+  UWORD64 time;
+
+  if(default_config(&cfg))
+  {
+    return -1;
+  }
+
+  parse_arguments(argc, argv, &cfg);
+  if(cfg.help)
+  {
+    show_usage();
+    return 0;
+  }
+
+#ifdef __XTENSA__
+  printf("family,precision,channels,spatial,kernel,stride,align,out_channels,ops,bytes,cycles,macs_per_cycle,bytes_per_cycle,efficiency,status\n");
+#else
+  printf("family,precision,channels,spatial,kernel,stride,align,out_channels,ops,bytes,ns,macs_per_ns,bytes_per_ns,efficiency,status\n");
+#endif
+
+  for(family = 0; family < N_FAMILIES; family++)
+  {
+    const bench_grid_t *p_grid = &bench_grids[family];
+
+    if(strcmp(cfg.family, "all") != 0 && strcmp(cfg.family, p_grid->name) != 0)
+      continue;
+
+    for(prec = BENCH_PREC_8X8; prec <= BENCH_PREC_8X16; prec <<= 1)
+    {
+      if(!(p_grid->precisions & prec) ||
+         (cfg.precision == 8 && prec != BENCH_PREC_8X8) ||
+         (cfg.precision == 16 && prec != BENCH_PREC_8X16))
+        continue;
+
+      for(ic = 0; ic < MAX_GRID_AXIS && p_grid->channels[ic]; ic++)
+      for(is = 0; is < MAX_GRID_AXIS && p_grid->spatial[is]; is++)
+      for(ik = 0; ik < MAX_GRID_AXIS && p_grid->kernel[ik]; ik++)
+      for(ist = 0; ist < MAX_GRID_AXIS && p_grid->stride[ist]; ist++)
+      for(pt.align = 0; pt.align <= cfg.max_align; pt.align++)
+      {
+        double macs_per_cycle, bytes_per_cycle;
+#ifdef __XTENSA__
+        int peak = (prec == BENCH_PREC_8X16) ? cfg.peak_8x16 : cfg.peak_8x8;
+#endif
+
+        pt.family = family;
+        pt.precision = prec;
+        pt.channels = p_grid->channels[ic];
+        pt.spatial = p_grid->spatial[is];
+        pt.kernel = p_grid->kernel[ik];
+        pt.stride = p_grid->stride[ist];
+        point_shape(&pt);
+
+        srand(n_points);
+        err = run_point(&pt, cfg.frames, &time);
+        n_points++;
+
+        printf("%s,%s,%d,%d,%d,%d,%d,%d,%.0f,%.0f,",
+            p_grid->name, (prec == BENCH_PREC_8X16) ? "8x16" : "8x8",
+            pt.channels, pt.spatial, pt.kernel, pt.stride, pt.align, pt.out_channels, pt.ops, pt.bytes);
+        if(err != 0 || time == 0)
+        {
+          /* Unsupported shape or alignment: no timing */
+          printf(",,,,%d\n", err);
+          n_failed += (err != 0);
+          continue;
+        }
+        macs_per_cycle = pt.ops / (double)time;
+        bytes_per_cycle = pt.bytes / (double)time;
+#ifdef __XTENSA__
+        if(p_grid->is_mac && peak > 0)
+          printf("%llu,%.3f,%.3f,%.3f,0\n", (unsigned long long)time, macs_per_cycle, bytes_per_cycle, macs_per_cycle / peak);
+        else
+#endif
+          printf("%llu,%.3f,%.3f,,0\n", (unsigned long long)time, macs_per_cycle, bytes_per_cycle);
+      }
+    }
+  }
+
+  fprintf(stdout, "\nbench: %d points, %d returned an error\n", n_points, n_failed);
+
+  return 0;
+}
+
+int main (int argc, char *argv[])
+{
+  int i;
+
+  for(i = 1; i < argc; i++)
+  {
+    fprintf(stderr, "%s ", argv[i]);
+  }
+  fprintf(stderr, "\n");
+
+  return xa_nn_main_process(argc, argv);
+}
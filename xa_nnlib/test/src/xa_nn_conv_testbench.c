@@ -98,8 +98,31 @@ typedef struct _test_config_t
   int pointwise_profile_only;
   int groups;
   int v2;
+  int dma;
+  int mem_budget;
+  int prepack;
   int out_activation_min;
   int out_activation_max;
+  int pool_type;
+  int pool_height;
+  int pool_width;
+  int pool_x_stride;
+  int pool_y_stride;
+  int pool_x_padding;
+  int pool_y_padding;
+  int pool_out_height;
+  int pool_out_width;
+  int ds_rows;
+  int res_zero_bias;
+  int res_multiplier;
+  int res_shift;
+  int act_type;
+  int explicit_pad;
+  int x_r_padding;
+  int y_b_padding;
+  int pad_val;
+  int f32io;
+  int band_rows;
 }test_config_t;
 
 int default_config(test_config_t *p_cfg)
@@ -151,8 +174,31 @@ int default_config(test_config_t *p_cfg)
     p_cfg->pointwise_profile_only = 0;
     p_cfg->groups = 1;
     p_cfg->v2 = 0;
+    p_cfg->dma = 0;
+    p_cfg->mem_budget = 0;
+    p_cfg->prepack = 0;
     p_cfg->out_activation_min = -128;
     p_cfg->out_activation_max = 127;
+    p_cfg->pool_type = -1;
+    p_cfg->pool_height = 2;
+    p_cfg->pool_width = 2;
+    p_cfg->pool_x_stride = 2;
+    p_cfg->pool_y_stride = 2;
+    p_cfg->pool_x_padding = 0;
+    p_cfg->pool_y_padding = 0;
+    p_cfg->pool_out_height = 8;
+    p_cfg->pool_out_width = 8;
+    p_cfg->ds_rows = 0;
+    p_cfg->res_zero_bias = 0;
+    p_cfg->res_multiplier = 0;
+    p_cfg->res_shift = 0;
+    p_cfg->act_type = -1;
+    p_cfg->explicit_pad = 0;
+    p_cfg->x_r_padding = 0;
+    p_cfg->y_b_padding = 0;
+    p_cfg->pad_val = 0;
+    p_cfg->f32io = 0;
+    p_cfg->band_rows = 4;
     return 0;
   }
   else
@@ -199,8 +245,24 @@ void show_usage(void)
     printf("\t-kernel_name: conv2d_std, dilated_conv2d_std, conv2d_depth, dilated_conv2d_depth, conv2d_point, conv1d_std, transpose_conv , conv2d; Default="" : conv2d_std\n");
     printf("\t-pointwise_profile_only: Applicable only when kernel_name is conv2d_depth, 0 (print conv2d depthwise and pointwise profile info), 1(print only conv2d pointwise profile info); Default=0\n");
     printf("\t-v2: Flag for v2 kernels; 0: Disable, 1: Enable; Default=0\n");
+    printf("\t-dma: Size in bytes of each local ping-pong buffer passed to v2 kernels through a memcpy based DMA config; 0: Disable; Default=0\n");
+    printf("\t-mem_budget: Local memory budget in bytes used to plan conv2d_std v2 tiles; 0: Default plan; Default=0\n");
+    printf("\t-prepack: Flag to pack the conv2d_std sym4s / sym8sxsym16s kernel once and run the prepacked kernels; 0: Disable, 1: Enable; Default=0\n");
     printf("\t-out_activation_min: Lower range of min/max activation; Default=-128\n");
     printf("\t-out_activation_max: Higher range of min/max activation; Default=127\n");
+    printf("\t-pool_type: Pooling fused after conv2d_std / conv2d_point v2 sym8sxasym8s (NHWC output); -1: None, 0: Max, 1: Avg; Default=-1\n");
+    printf("\t-pool_height, -pool_width: Pooling window; Default=2\n");
+    printf("\t-pool_x_stride, -pool_y_stride: Pooling strides; Default=2\n");
+    printf("\t-pool_x_padding, -pool_y_padding: Pooling padding; Default=0\n");
+    printf("\t-pool_out_height, -pool_out_width: Pooled output size; Default=8\n");
+    printf("\t-ds_rows: Depthwise rows per block for the fused conv2d_depth v2 sym8sxasym8s kernel; 0: Separate depthwise and pointwise calls; Default=0\n");
+    printf("\t-res_multiplier: Residual add after conv2d_std / pointwise v2 sym8sxasym8s; 0: No residual; Default=0\n");
+    printf("\t-res_zero_bias, -res_shift: Residual zero bias and shift; Default=0\n");
+    printf("\t-act_type: Activation LUT after conv2d_std / pointwise v2 sym8sxasym8s; -1: None, 0: Relu, 1: Leaky relu, 2: Prelu, 3: Hard swish, 4: Sigmoid, 5: Tanh, 6: Gelu, 7: Silu; Default=-1\n");
+    printf("\t-explicit_pad: Explicit padding for conv2d_std / conv2d / depthwise v2 sym8sxasym8s; 0: Off, 1: On; Default=0\n");
+    printf("\t-x_r_padding, -y_b_padding, -pad_val: Right and bottom padding and pad value with -explicit_pad; Default=0\n");
+    printf("\t-f32io: f32 input quantized band by band inside conv2d_std v2 sym8sxasym8s; 0: Disable, 1: Enable with asym8s NHWC output, 2: Enable with f32 output, checked against the dequantized asym8s output; Default=0\n");
+    printf("\t-band_rows: Output rows per band with -f32io; Default=4\n");
     printf("\t-write_file: set to 1 to write input and output vectors to file; Default=0\n");
     printf("\t-read_inp_file_name: Full filename for reading inputs (order - input, kernel, bias, (pointwise kernel, pointwise bias for depth separable)) \n");
     printf("\t-read_ref_file_name: Full filename for reading reference output \n");
@@ -265,8 +327,31 @@ void parse_arguments(int argc, char** argv, test_config_t *p_cfg)
     ARGTYPE_ONETIME_CONFIG("-dilation_width",p_cfg->dilation_width);
     ARGTYPE_ONETIME_CONFIG("-pointwise_profile_only",p_cfg->pointwise_profile_only);
     ARGTYPE_ONETIME_CONFIG("-v2",p_cfg->v2);
+    ARGTYPE_ONETIME_CONFIG("-dma",p_cfg->dma);
+    ARGTYPE_ONETIME_CONFIG("-mem_budget",p_cfg->mem_budget);
+    ARGTYPE_ONETIME_CONFIG("-prepack",p_cfg->prepack);
     ARGTYPE_ONETIME_CONFIG("-out_activation_min",p_cfg->out_activation_min);
     ARGTYPE_ONETIME_CONFIG("-out_activation_max",p_cfg->out_activation_max);
+    ARGTYPE_ONETIME_CONFIG("-pool_type",p_cfg->pool_type);
+    ARGTYPE_ONETIME_CONFIG("-pool_height",p_cfg->pool_height);
+    ARGTYPE_ONETIME_CONFIG("-pool_width",p_cfg->pool_width);
+    ARGTYPE_ONETIME_CONFIG("-pool_x_stride",p_cfg->pool_x_stride);
+    ARGTYPE_ONETIME_CONFIG("-pool_y_stride",p_cfg->pool_y_stride);
+    ARGTYPE_ONETIME_CONFIG("-pool_x_padding",p_cfg->pool_x_padding);
+    ARGTYPE_ONETIME_CONFIG("-pool_y_padding",p_cfg->pool_y_padding);
+    ARGTYPE_ONETIME_CONFIG("-pool_out_height",p_cfg->pool_out_height);
+    ARGTYPE_ONETIME_CONFIG("-pool_out_width",p_cfg->pool_out_width);
+    ARGTYPE_ONETIME_CONFIG("-ds_rows",p_cfg->ds_rows);
+    ARGTYPE_ONETIME_CONFIG("-res_zero_bias",p_cfg->res_zero_bias);
+    ARGTYPE_ONETIME_CONFIG("-res_multiplier",p_cfg->res_multiplier);
+    ARGTYPE_ONETIME_CONFIG("-res_shift",p_cfg->res_shift);
+    ARGTYPE_ONETIME_CONFIG("-act_type",p_cfg->act_type);
+    ARGTYPE_ONETIME_CONFIG("-explicit_pad",p_cfg->explicit_pad);
+    ARGTYPE_ONETIME_CONFIG("-x_r_padding",p_cfg->x_r_padding);
+    ARGTYPE_ONETIME_CONFIG("-y_b_padding",p_cfg->y_b_padding);
+    ARGTYPE_ONETIME_CONFIG("-pad_val",p_cfg->pad_val);
+    ARGTYPE_ONETIME_CONFIG("-f32io",p_cfg->f32io);
+    ARGTYPE_ONETIME_CONFIG("-band_rows",p_cfg->band_rows);
     
     // If arg doesnt match with any of the above supported options, report option as invalid
     printf("Invalid argument: %s\n",argv[argidx]);
@@ -302,14 +387,81 @@ void parse_arguments(int argc, char** argv, test_config_t *p_cfg)
 
 #define CONV_KERNEL_SYM8S_PC_FN(KERNEL, KPREC, IPREC, OPREC, BPREC) \
   (!strcmp(cfg.kernel_name,#KERNEL) && (KPREC == p_kernel->precision) && (IPREC == p_inp->precision) && (OPREC == p_out->precision) && (BPREC == p_bias->precision)) {\
-    if(cfg.v2){\
+    if(cfg.v2 && cfg.pool_type >= 0){\
+      XTPWR_PROFILER_START(0);\
+      err = xa_nn_##KERNEL##_v2_pool_per_chan_sym8sxasym8s ( \
+          (WORD8 *)p_out->p, (WORD8 *) p_inp->p, (WORD8 *) p_kernel->p, (WORD32 *)p_bias->p, \
+          cfg.input_height, cfg.input_width, cfg.input_channels, cfg.kernel_height, cfg.kernel_width, cfg.out_channels, \
+          cfg.x_stride, cfg.y_stride, cfg.x_padding, cfg.y_padding, cfg.out_height, cfg.out_width, \
+          cfg.input_zero_bias, cfg.p_out_multiplier, cfg.p_out_shift, cfg.out_zero_bias, \
+          cfg.out_activation_min, cfg.out_activation_max, \
+          cfg.pool_type, cfg.pool_height, cfg.pool_width, cfg.pool_x_stride, cfg.pool_y_stride, \
+          cfg.pool_x_padding, cfg.pool_y_padding, cfg.pool_out_height, cfg.pool_out_width, p_scratch);\
+      XTPWR_PROFILER_STOP(0);\
+    }\
+    else if(cfg.v2 && p_io_cfg != NULL){\
+      XTPWR_PROFILER_START(0);\
+      err = xa_nn_##KERNEL##_v2_f32io_per_chan_sym8sxasym8s ( \
+          p_io_cfg->out_f32 ? p_out_f32->p : p_out->p, (FLOAT32 *) p_inp_f32->p, (WORD8 *) p_kernel->p, (WORD32 *)p_bias->p, \
+          cfg.input_height, cfg.input_width, cfg.input_channels, cfg.kernel_height, cfg.kernel_width, cfg.out_channels, \
+          cfg.x_stride, cfg.y_stride, cfg.x_padding, cfg.y_padding, cfg.out_height, cfg.out_width, \
+          cfg.input_zero_bias, cfg.p_out_multiplier, cfg.p_out_shift, cfg.out_zero_bias, \
+          p_scratch, cfg.out_activation_min, cfg.out_activation_max, p_io_cfg);\
+      XTPWR_PROFILER_STOP(0);\
+    }\
+    else if(cfg.v2 && p_act_cfg != NULL){\
+      XTPWR_PROFILER_START(0);\
+      err = xa_nn_##KERNEL##_v2_act_per_chan_sym8sxasym8s ( \
+          (WORD8 *)p_out->p, (WORD8 *) p_inp->p, (WORD8 *) p_kernel->p, (WORD32 *)p_bias->p, \
+          cfg.input_height, cfg.input_width, cfg.input_channels, cfg.kernel_height, cfg.kernel_width, cfg.out_channels, \
+          cfg.x_stride, cfg.y_stride, cfg.x_padding, cfg.y_padding, cfg.out_height, cfg.out_width, \
+          cfg.input_zero_bias, cfg.p_out_multiplier, cfg.p_out_shift, cfg.out_zero_bias, \
+          cfg.out_data_format, p_scratch, cfg.out_activation_min, cfg.out_activation_max, p_act_cfg, p_dma_cfg);\
+      XTPWR_PROFILER_STOP(0);\
+    }\
+    else if(cfg.v2 && p_pad_cfg != NULL){\
+      XTPWR_PROFILER_START(0);\
+      err = xa_nn_##KERNEL##_v2_pad_per_chan_sym8sxasym8s ( \
+          (WORD8 *)p_out->p, (WORD8 *) p_inp->p, (WORD8 *) p_kernel->p, (WORD32 *)p_bias->p, \
+          cfg.input_height, cfg.input_width, cfg.input_channels, cfg.kernel_height, cfg.kernel_width, cfg.out_channels, \
+          cfg.x_stride, cfg.y_stride, cfg.x_padding, cfg.y_padding, cfg.out_height, cfg.out_width, \
+          cfg.input_zero_bias, cfg.p_out_multiplier, cfg.p_out_shift, cfg.out_zero_bias, \
+          cfg.out_data_format, p_scratch, cfg.out_activation_min, cfg.out_activation_max, p_pad_cfg, p_dma_cfg);\
+      XTPWR_PROFILER_STOP(0);\
+    }\
+    else if(cfg.v2 && p_res_cfg != NULL){\
+      XTPWR_PROFILER_START(0);\
+      err = xa_nn_##KERNEL##_v2_residual_per_chan_sym8sxasym8s ( \
+          (WORD8 *)p_out->p, (WORD8 *) p_inp->p, (WORD8 *) p_kernel->p, (WORD32 *)p_bias->p, \
+          cfg.input_height, cfg.input_width, cfg.input_channels, cfg.kernel_height, cfg.kernel_width, cfg.out_channels, \
+          cfg.x_stride, cfg.y_stride, cfg.x_padding, cfg.y_padding, cfg.out_height, cfg.out_width, \
+          cfg.input_zero_bias, cfg.p_out_multiplier, cfg.p_out_shift, cfg.out_zero_bias, \
+          cfg.out_data_format, p_scratch, cfg.out_activation_min, cfg.out_activation_max, p_res_cfg, p_dma_cfg);\
+      XTPWR_PROFILER_STOP(0);\
+    }\
+    else if(cfg.v2 && cfg.mem_budget > 0){\
+      xa_nn_conv2d_std_tile_plan_t tile_plan;\
+      err = xa_nn_##KERNEL##_v2_get_tile_plan (&tile_plan, \
+          cfg.input_height, cfg.input_width, cfg.input_channels, cfg.kernel_height, cfg.kernel_width, cfg.out_channels, \
+          cfg.x_stride, cfg.y_stride, cfg.x_padding, cfg.y_padding, cfg.out_height, cfg.out_width, \
+          IPREC, cfg.out_data_format, cfg.mem_budget);\
+      XTPWR_PROFILER_START(0);\
+      if(!err) err = xa_nn_##KERNEL##_v2_tiled_per_chan_sym8sxasym8s ( \
+          (WORD8 *)p_out->p, (WORD8 *) p_inp->p, (WORD8 *) p_kernel->p, (WORD32 *)p_bias->p, \
+          cfg.input_height, cfg.input_width, cfg.input_channels, cfg.kernel_height, cfg.kernel_width, cfg.out_channels, \
+          cfg.x_stride, cfg.y_stride, cfg.x_padding, cfg.y_padding, cfg.out_height, cfg.out_width, \
+          cfg.input_zero_bias, cfg.p_out_multiplier, cfg.p_out_shift, cfg.out_zero_bias, \
+          cfg.out_data_format, p_scratch, cfg.out_activation_min, cfg.out_activation_max, &tile_plan, p_dma_cfg);\
+      XTPWR_PROFILER_STOP(0);\
+    }\
+    else if(cfg.v2){\
       XTPWR_PROFILER_START(0);\
       err = xa_nn_##KERNEL##_v2_per_chan_sym8sxasym8s ( \
           (WORD8 *)p_out->p, (WORD8 *) p_inp->p, (WORD8 *) p_kernel->p, (WORD32 *)p_bias->p, \
           cfg.input_height, cfg.input_width, cfg.input_channels, cfg.kernel_height, cfg.kernel_width, cfg.out_channels, \
           cfg.x_stride, cfg.y_stride, cfg.x_padding, cfg.y_padding, cfg.out_height, cfg.out_width, \
           cfg.input_zero_bias, cfg.p_out_multiplier, cfg.p_out_shift, cfg.out_zero_bias, \
-          cfg.out_data_format, p_scratch, cfg.out_activation_min, cfg.out_activation_max, NULL);\
+          cfg.out_data_format, p_scratch, cfg.out_activation_min, cfg.out_activation_max, p_dma_cfg);\
       XTPWR_PROFILER_STOP(0);\
     }\
     else{\
@@ -327,14 +479,30 @@ void parse_arguments(int argc, char** argv, test_config_t *p_cfg)
 #if hifi5
 #define CONV_KERNEL_SYM4S_PC_FN(KERNEL, KPREC, IPREC, OPREC, BPREC) \
   (!strcmp(cfg.kernel_name,#KERNEL) && (KPREC == p_kernel->precision) && (IPREC == p_inp->precision) && (OPREC == p_out->precision) && (BPREC == p_bias->precision)) {\
-    XTPWR_PROFILER_START(0);\
-    err = xa_nn_##KERNEL##_per_chan_sym4sxasym8s ( \
-        (WORD8 *)p_out->p, (WORD8 *) p_inp->p, (WORD8 *) p_kernel->p, (WORD32 *)p_bias->p, \
-        cfg.input_height, cfg.input_width, cfg.input_channels, cfg.kernel_height, cfg.kernel_width, cfg.out_channels, \
-        cfg.x_stride, cfg.y_stride, cfg.x_padding, cfg.y_padding, cfg.out_height, cfg.out_width, \
-        cfg.input_zero_bias, cfg.p_out_multiplier, cfg.p_out_shift, cfg.out_zero_bias, \
-        cfg.out_data_format, p_scratch);\
-    XTPWR_PROFILER_STOP(0);\
+    if(cfg.prepack){\
+      /* Packing is a model load step, kept out of the profiled region */\
+      err = xa_nn_##KERNEL##_prepack_sym4s ( \
+          (WORD8 *)p_kernel_packed, (WORD8 *) p_kernel->p, \
+          cfg.input_channels, cfg.kernel_height, cfg.kernel_width, cfg.out_channels);\
+      XTPWR_PROFILER_START(0);\
+      if(!err) err = xa_nn_##KERNEL##_prepacked_per_chan_sym4sxasym8s ( \
+          (WORD8 *)p_out->p, (WORD8 *) p_inp->p, (WORD8 *) p_kernel_packed, (WORD32 *)p_bias->p, \
+          cfg.input_height, cfg.input_width, cfg.input_channels, cfg.kernel_height, cfg.kernel_width, cfg.out_channels, \
+          cfg.x_stride, cfg.y_stride, cfg.x_padding, cfg.y_padding, cfg.out_height, cfg.out_width, \
+          cfg.input_zero_bias, cfg.p_out_multiplier, cfg.p_out_shift, cfg.out_zero_bias, \
+          cfg.out_data_format, p_scratch);\
+      XTPWR_PROFILER_STOP(0);\
+    }\
+    else{\
+      XTPWR_PROFILER_START(0);\
+      err = xa_nn_##KERNEL##_per_chan_sym4sxasym8s ( \
+          (WORD8 *)p_out->p, (WORD8 *) p_inp->p, (WORD8 *) p_kernel->p, (WORD32 *)p_bias->p, \
+          cfg.input_height, cfg.input_width, cfg.input_channels, cfg.kernel_height, cfg.kernel_width, cfg.out_channels, \
+          cfg.x_stride, cfg.y_stride, cfg.x_padding, cfg.y_padding, cfg.out_height, cfg.out_width, \
+          cfg.input_zero_bias, cfg.p_out_multiplier, cfg.p_out_shift, cfg.out_zero_bias, \
+          cfg.out_data_format, p_scratch);\
+      XTPWR_PROFILER_STOP(0);\
+    }\
   }
 #else
 #define CONV_KERNEL_SYM4S_PC_FN(KERNEL, KPREC, IPREC, OPREC, BPREC) \
@@ -345,14 +513,24 @@ void parse_arguments(int argc, char** argv, test_config_t *p_cfg)
 
 #define CONV_UN_KERNEL_SYM8S_PC_FN(KERNEL, KPREC, IPREC, OPREC, BPREC) \
   (!strcmp(cfg.kernel_name,#KERNEL) && (KPREC == p_kernel->precision) && (IPREC == p_inp->precision) && (OPREC == p_out->precision) && (BPREC == p_bias->precision)) {\
-    if(cfg.v2){\
+    if(cfg.v2 && p_pad_cfg != NULL){\
+      XTPWR_PROFILER_START(0);\
+      err = xa_nn_##KERNEL##_v2_pad_per_chan_sym8sxasym8s ( \
+          (WORD8 *)p_out->p, (WORD8 *) p_inp->p, (WORD8 *) p_kernel->p, (WORD32 *)p_bias->p, \
+          cfg.input_height, cfg.input_width, cfg.input_channels, cfg.kernel_height, cfg.kernel_width,cfg.kernel_channels,cfg.dilation_height,cfg.dilation_width,cfg.out_channels, \
+          cfg.x_stride, cfg.y_stride, cfg.x_padding, cfg.y_padding, cfg.out_height, cfg.out_width, \
+          cfg.input_zero_bias,cfg.p_out_multiplier, cfg.p_out_shift, cfg.out_zero_bias, \
+          cfg.out_data_format, p_scratch, cfg.out_activation_min, cfg.out_activation_max, p_pad_cfg, p_dma_cfg);\
+      XTPWR_PROFILER_STOP(0);\
+    }\
+    else if(cfg.v2){\
       XTPWR_PROFILER_START(0);\
       err = xa_nn_##KERNEL##_v2_per_chan_sym8sxasym8s ( \
           (WORD8 *)p_out->p, (WORD8 *) p_inp->p, (WORD8 *) p_kernel->p, (WORD32 *)p_bias->p, \
           cfg.input_height, cfg.input_width, cfg.input_channels, cfg.kernel_height, cfg.kernel_width,cfg.kernel_channels,cfg.dilation_height,cfg.dilation_width,cfg.out_channels, \
           cfg.x_stride, cfg.y_stride, cfg.x_padding, cfg.y_padding, cfg.out_height, cfg.out_width, \
           cfg.input_zero_bias,cfg.p_out_multiplier, cfg.p_out_shift, cfg.out_zero_bias, \
-          cfg.out_data_format, p_scratch, cfg.out_activation_min, cfg.out_activation_max, NULL);\
+          cfg.out_data_format, p_scratch, cfg.out_activation_min, cfg.out_activation_max, p_dma_cfg);\
       XTPWR_PROFILER_STOP(0);\
     }\
     else{\
@@ -376,7 +554,7 @@ void parse_arguments(int argc, char** argv, test_config_t *p_cfg)
           cfg.input_height, cfg.input_width, cfg.input_channels, cfg.kernel_height, cfg.kernel_width,cfg.kernel_channels,cfg.dilation_height,cfg.dilation_width,cfg.out_channels, \
           cfg.x_stride, cfg.y_stride, cfg.x_padding, cfg.y_padding, cfg.out_height, cfg.out_width, \
           0, cfg.p_out_multiplier, cfg.p_out_shift, 0, \
-          cfg.out_data_format,p_scratch, cfg.out_activation_min, cfg.out_activation_max, NULL);\
+          cfg.out_data_format,p_scratch, cfg.out_activation_min, cfg.out_activation_max, p_dma_cfg);\
       XTPWR_PROFILER_STOP(0);\
     }\
     else{\
@@ -393,14 +571,27 @@ void parse_arguments(int argc, char** argv, test_config_t *p_cfg)
 
 #define CONV_KERNEL_SYM8SXSYM16S_PC_FN(KERNEL, KPREC, IPREC, OPREC, BPREC) \
   (!strcmp(cfg.kernel_name,#KERNEL) && (KPREC == p_kernel->precision) && (IPREC == p_inp->precision) && (OPREC == p_out->precision) && (BPREC == p_bias->precision)) {\
-    if(cfg.v2){\
+    if(cfg.v2 && cfg.prepack){\
+      err = xa_nn_##KERNEL##_prepack_sym8sxsym16s ( \
+          (WORD8 *)p_kernel_packed, (WORD8 *) p_kernel->p, \
+          cfg.input_channels, cfg.kernel_height, cfg.kernel_width, cfg.out_channels);\
+      XTPWR_PROFILER_START(0);\
+      if(!err) err = xa_nn_##KERNEL##_v2_prepacked_per_chan_sym8sxsym16s ( \
+          (WORD16 *)p_out->p, (WORD16 *) p_inp->p, (WORD8 *) p_kernel_packed, (WORD64 *)p_bias->p, \
+          cfg.input_height, cfg.input_width, cfg.input_channels, cfg.kernel_height, cfg.kernel_width, cfg.out_channels, \
+          cfg.x_stride, cfg.y_stride, cfg.x_padding, cfg.y_padding, cfg.out_height, cfg.out_width, \
+          0, cfg.p_out_multiplier, cfg.p_out_shift, 0, \
+          cfg.out_data_format, p_scratch, cfg.out_activation_min, cfg.out_activation_max, p_dma_cfg);\
+      XTPWR_PROFILER_STOP(0);\
+    }\
+    else if(cfg.v2){\
       XTPWR_PROFILER_START(0);\
       err = xa_nn_##KERNEL##_v2_per_chan_sym8sxsym16s ( \
           (WORD16 *)p_out->p, (WORD16 *) p_inp->p, (WORD8 *) p_kernel->p, (WORD64 *)p_bias->p, \
           cfg.input_height, cfg.input_width, cfg.input_channels, cfg.kernel_height, cfg.kernel_width, cfg.out_channels, \
           cfg.x_stride, cfg.y_stride, cfg.x_padding, cfg.y_padding, cfg.out_height, cfg.out_width, \
           0, cfg.p_out_multiplier, cfg.p_out_shift, 0, \
-          cfg.out_data_format, p_scratch, cfg.out_activation_min, cfg.out_activation_max, NULL);\
+          cfg.out_data_format, p_scratch, cfg.out_activation_min, cfg.out_activation_max, p_dma_cfg);\
       XTPWR_PROFILER_STOP(0);\
     }\
     else{\
@@ -662,7 +853,34 @@ void parse_arguments(int argc, char** argv, test_config_t *p_cfg)
 
 #define CONV_DS_KERNEL_SYM8_PC_FN(KERNEL, KPREC, IPREC, OPREC, BPREC) \
   (!strcmp(cfg.kernel_name,#KERNEL) && (KPREC == p_kernel->precision) && (IPREC == p_inp->precision) && (OPREC == p_out->precision) && (BPREC == p_bias->precision)) {\
-    if(cfg.v2){\
+    if(cfg.v2 && cfg.ds_rows > 0){\
+      XTPWR_PROFILER_START(0);\
+      err = xa_nn_conv2d_depthwise_pointwise_v2_per_chan_sym8sxasym8s ( \
+          (WORD8 *) p_out->p, (const WORD8 *) p_kernel->p, (const WORD8 *) p_kernel_point->p, (const WORD8 *) p_inp->p, \
+          (const WORD32 *)p_bias->p, (const WORD32 *)p_bias_point->p, \
+          cfg.input_height, cfg.input_width, cfg.input_channels, cfg.kernel_height, cfg.kernel_width, cfg.channels_multiplier, \
+          cfg.x_stride, cfg.y_stride, cfg.x_padding, cfg.y_padding, cfg.out_height, cfg.out_width, cfg.out_channels, \
+          cfg.input_zero_bias, cfg.p_out_multiplier, cfg.p_out_shift, cfg.out_zero_bias, \
+          cfg.out_activation_min, cfg.out_activation_max, \
+          cfg.input_zero_bias, cfg.p_out_multiplier, cfg.p_out_shift, cfg.out_zero_bias, \
+          cfg.out_data_format, cfg.out_activation_min, cfg.out_activation_max, cfg.ds_rows, p_scratch);\
+      XTPWR_PROFILER_STOP(0);\
+      XTPWR_PROFILER_UPDATE(0); \
+      XTPWR_PROFILER_PRINT(0); \
+    }\
+    else {\
+    if(cfg.v2 && p_pad_cfg != NULL){\
+      XTPWR_PROFILER_START(0);\
+      err = xa_nn_conv2d_depthwise_v2_pad_per_chan_sym8sxasym8s ( \
+          (WORD8 *) p_dw_out->p, (const WORD8 *) p_kernel->p, (const WORD8 *) p_inp->p, (const WORD32 *)p_bias->p, \
+          cfg.input_height, cfg.input_width, cfg.input_channels, cfg.kernel_height, cfg.kernel_width, cfg.channels_multiplier, \
+          cfg.x_stride, cfg.y_stride, cfg.x_padding, cfg.y_padding, cfg.out_height, cfg.out_width, \
+          cfg.input_zero_bias, cfg.p_out_multiplier, cfg.p_out_shift, cfg.out_zero_bias, \
+          0/* inp_data_format always DWH for v2 kernels*/, 0 /* out_data_format always DWH*/, p_scratch, \
+          cfg.out_activation_min, cfg.out_activation_max, p_pad_cfg, NULL);\
+      XTPWR_PROFILER_STOP(0);\
+    } \
+    else if(cfg.v2){\
       XTPWR_PROFILER_START(0);\
       err = xa_nn_conv2d_depthwise_v2_per_chan_sym8sxasym8s ( \
           (WORD8 *) p_dw_out->p, (const WORD8 *) p_kernel->p, (const WORD8 *) p_inp->p, (const WORD32 *)p_bias->p, \
@@ -688,13 +906,31 @@ void parse_arguments(int argc, char** argv, test_config_t *p_cfg)
         XTPWR_PROFILER_PRINT(0); \
     } \
     if(!err) { \
-      if(cfg.v2){\
+      if(cfg.v2 && p_act_cfg != NULL){\
+        XTPWR_PROFILER_START(1);\
+        err = xa_nn_conv2d_pointwise_v2_act_per_chan_sym8sxasym8s ( \
+            (WORD8 *) p_out->p, (WORD8 *) p_kernel_point->p, (WORD8 *) p_dw_out->p, (WORD32 *)p_bias_point->p, \
+            cfg.out_height, cfg.out_width, cfg.input_channels*cfg.channels_multiplier, cfg.out_channels, \
+            cfg.input_zero_bias, cfg.p_out_multiplier, cfg.p_out_shift, cfg.out_zero_bias, \
+            cfg.out_data_format, cfg.out_activation_min, cfg.out_activation_max, p_act_cfg, p_dma_cfg); \
+        XTPWR_PROFILER_STOP(1);\
+      }\
+      else if(cfg.v2 && p_res_cfg != NULL){\
+        XTPWR_PROFILER_START(1);\
+        err = xa_nn_conv2d_pointwise_v2_residual_per_chan_sym8sxasym8s ( \
+            (WORD8 *) p_out->p, (WORD8 *) p_kernel_point->p, (WORD8 *) p_dw_out->p, (WORD32 *)p_bias_point->p, \
+            cfg.out_height, cfg.out_width, cfg.input_channels*cfg.channels_multiplier, cfg.out_channels, \
+            cfg.input_zero_bias, cfg.p_out_multiplier, cfg.p_out_shift, cfg.out_zero_bias, \
+            cfg.out_data_format, cfg.out_activation_min, cfg.out_activation_max, p_res_cfg, p_dma_cfg); \
+        XTPWR_PROFILER_STOP(1);\
+      }\
+      else if(cfg.v2){\
         XTPWR_PROFILER_START(1);\
         err = xa_nn_conv2d_pointwise_v2_per_chan_sym8sxasym8s ( \
             (WORD8 *) p_out->p, (WORD8 *) p_kernel_point->p, (WORD8 *) p_dw_out->p, (WORD32 *)p_bias_point->p, \
             cfg.out_height, cfg.out_width, cfg.input_channels*cfg.channels_multiplier, cfg.out_channels, \
             cfg.input_zero_bias, cfg.p_out_multiplier, cfg.p_out_shift, cfg.out_zero_bias, \
-            cfg.out_data_format, cfg.out_activation_min, cfg.out_activation_max, NULL); \
+            cfg.out_data_format, cfg.out_activation_min, cfg.out_activation_max, p_dma_cfg); \
         XTPWR_PROFILER_STOP(1);\
       }\
       else{\
@@ -709,6 +945,7 @@ void parse_arguments(int argc, char** argv, test_config_t *p_cfg)
         XTPWR_PROFILER_UPDATE(1); \
         XTPWR_PROFILER_PRINT(1); \
     } \
+    }\
   }
 
 #define CONV_DS_KERNEL_SYM8SXSYM16S_PC_FN(KERNEL, KPREC, IPREC, OPREC, BPREC) \
@@ -745,7 +982,7 @@ void parse_arguments(int argc, char** argv, test_config_t *p_cfg)
             (WORD16 *) p_out->p, (WORD8 *) p_kernel_point->p, (WORD16 *) p_dw_out->p, (WORD64 *)p_bias_point->p, \
             cfg.out_height, cfg.out_width, cfg.input_channels*cfg.channels_multiplier, cfg.out_channels, 0, \
             cfg.p_out_multiplier, cfg.p_out_shift, 0, \
-            cfg.out_data_format, cfg.out_activation_min, cfg.out_activation_max, NULL); \
+            cfg.out_data_format, cfg.out_activation_min, cfg.out_activation_max, p_dma_cfg); \
         XTPWR_PROFILER_STOP(1);\
       }\
       else{\
@@ -773,6 +1010,39 @@ void parse_arguments(int argc, char** argv, test_config_t *p_cfg)
     XTPWR_PROFILER_STOP(0);\
   }
 
+#define CONV_PT_KERNEL_SYM8_PC_FN(KERNEL, KPREC, IPREC, OPREC, BPREC) \
+    (!strcmp(cfg.kernel_name,#KERNEL) && (KPREC == p_kernel_point->precision) && (IPREC == p_inp->precision) && (OPREC == p_out->precision) && (BPREC == p_bias_point->precision)) {\
+    if(cfg.v2 && cfg.pool_type >= 0){\
+      XTPWR_PROFILER_START(0);\
+      err = xa_nn_conv2d_pointwise_v2_pool_per_chan_sym8sxasym8s ( \
+          (WORD8 *) p_out->p, (WORD8 *) p_kernel_point->p, (WORD8 *) p_inp->p, (WORD32 *)p_bias_point->p, \
+          cfg.input_height, cfg.input_width, cfg.input_channels, cfg.out_channels, \
+          cfg.input_zero_bias, cfg.p_out_multiplier, cfg.p_out_shift, cfg.out_zero_bias, \
+          cfg.out_activation_min, cfg.out_activation_max, \
+          cfg.pool_type, cfg.pool_height, cfg.pool_width, cfg.pool_x_stride, cfg.pool_y_stride, \
+          cfg.pool_x_padding, cfg.pool_y_padding, cfg.pool_out_height, cfg.pool_out_width, p_scratch); \
+      XTPWR_PROFILER_STOP(0);\
+    }\
+    else if(cfg.v2){\
+      XTPWR_PROFILER_START(0);\
+      err = xa_nn_conv2d_pointwise_v2_per_chan_sym8sxasym8s ( \
+          (WORD8 *) p_out->p, (WORD8 *) p_kernel_point->p, (WORD8 *) p_inp->p, (WORD32 *)p_bias_point->p, \
+          cfg.input_height, cfg.input_width, cfg.input_channels, cfg.out_channels, \
+          cfg.input_zero_bias, cfg.p_out_multiplier, cfg.p_out_shift, cfg.out_zero_bias, \
+          cfg.out_data_format, cfg.out_activation_min, cfg.out_activation_max, p_dma_cfg); \
+      XTPWR_PROFILER_STOP(0);\
+    }\
+    else{\
+      XTPWR_PROFILER_START(0);\
+      err = xa_nn_conv2d_pointwise_per_chan_sym8sxasym8s ( \
+          (WORD8 *) p_out->p, (WORD8 *) p_kernel_point->p, (WORD8 *) p_inp->p, (WORD32 *)p_bias_point->p, \
+          cfg.input_height, cfg.input_width, cfg.input_channels, cfg.out_channels, \
+          cfg.input_zero_bias, cfg.p_out_multiplier, cfg.p_out_shift, cfg.out_zero_bias, \
+          cfg.out_data_format); \
+      XTPWR_PROFILER_STOP(0);\
+    }\
+  }
+
 #define CONV_PT_KERNEL_SYM8SXSYM16S_PC_FN(KERNEL, KPREC, IPREC, OPREC, BPREC) \
     (!strcmp(cfg.kernel_name,#KERNEL) && (KPREC == p_kernel_point->precision) && (IPREC == p_inp->precision) && (OPREC == p_out->precision) && (BPREC == p_bias_point->precision)) {\
     if(cfg.v2){\
@@ -781,7 +1051,7 @@ void parse_arguments(int argc, char** argv, test_config_t *p_cfg)
           (WORD16 *) p_out->p, (WORD8 *) p_kernel_point->p, (WORD16 *) p_inp->p, (WORD64 *)p_bias_point->p, \
           cfg.input_height, cfg.input_width, cfg.input_channels, cfg.out_channels, \
           0, cfg.p_out_multiplier, cfg.p_out_shift, 0, \
-          cfg.out_data_format, cfg.out_activation_min, cfg.out_activation_max, NULL); \
+          cfg.out_data_format, cfg.out_activation_min, cfg.out_activation_max, p_dma_cfg); \
       XTPWR_PROFILER_STOP(0);\
     }\
     else{\
@@ -860,6 +1130,7 @@ void parse_arguments(int argc, char** argv, test_config_t *p_cfg)
     else if DILATED_CONV_DS_KERNEL_SYM8_PC_FN(dilated_conv2d_depth, -5, -4, -4, 32) \
     else if DILATED_CONV_DS_KERNEL_SYM8XSYM16S_PC_FN(dilated_conv2d_depth, -5, -8, -8, 64) \
     else if DILATED_CONV_DEPTH_KERNEL_F_FN(dilated_conv2d_depth, -1, -1, -1, -1) \
+    else if CONV_PT_KERNEL_SYM8_PC_FN(conv2d_point,-5,-4,-4,32) \
     else if CONV_PT_KERNEL_SYM8SXSYM16S_PC_FN(conv2d_point,-5,-8,-8,64) \
     else if CONV_DS_KERNEL_SYM8SXSYM16S_PC_FN(conv2d_depth,-5,-8,-8,64) \
     else if CONV1D_KERNEL_FN(conv1d_std, 8, 16, 16, 16) \
@@ -893,6 +1164,7 @@ void parse_arguments(int argc, char** argv, test_config_t *p_cfg)
     else if DILATED_CONV_DS_KERNEL_SYM8_PC_FN(dilated_conv2d_depth, -5, -4, -4, 32) \
     else if DILATED_CONV_DS_KERNEL_SYM8XSYM16S_PC_FN(dilated_conv2d_depth, -5, -8, -8, 64) \
     else if DILATED_CONV_DEPTH_KERNEL_F_FN(dilated_conv2d_depth, -1, -1, -1, -1) \
+    else if CONV_PT_KERNEL_SYM8_PC_FN(conv2d_point,-5,-4,-4,32) \
     else if CONV_PT_KERNEL_SYM8SXSYM16S_PC_FN(conv2d_point,-5,-8,-8,64) \
     else if CONV_DS_KERNEL_SYM8SXSYM16S_PC_FN(conv2d_depth,-5,-8,-8,64) \
     else if CONV1D_KERNEL_FN(conv1d_std, 8, 16, 16, 16) \
@@ -926,6 +1198,7 @@ void parse_arguments(int argc, char** argv, test_config_t *p_cfg)
     else if CONV_DS_KERNEL_F16_FN(conv2d_depth, -2, -2, -2, -2) \
     else if DILATED_CONV_DS_KERNEL_SYM8_PC_FN(dilated_conv2d_depth, -5, -4, -4, 32) \
     else if DILATED_CONV_DS_KERNEL_SYM8XSYM16S_PC_FN(dilated_conv2d_depth, -5, -8, -8, 64) \
+    else if CONV_PT_KERNEL_SYM8_PC_FN(conv2d_point,-5,-4,-4,32) \
     else if CONV_PT_KERNEL_SYM8SXSYM16S_PC_FN(conv2d_point,-5,-8,-8,64) \
     else if CONV_DS_KERNEL_SYM8SXSYM16S_PC_FN(conv2d_depth,-5,-8,-8,64) \
     else if CONV1D_KERNEL_FN(conv1d_std, 8, 16, 16, 16) \
@@ -954,6 +1227,7 @@ void parse_arguments(int argc, char** argv, test_config_t *p_cfg)
     else if CONV_DS_KERNEL_SYM8_PC_FN(conv2d_depth,-5,-4,-4,32) \
     else if DILATED_CONV_DS_KERNEL_SYM8_PC_FN(dilated_conv2d_depth, -5, -4, -4, 32) \
     else if DILATED_CONV_DS_KERNEL_SYM8XSYM16S_PC_FN(dilated_conv2d_depth, -5, -8, -8, 64) \
+    else if CONV_PT_KERNEL_SYM8_PC_FN(conv2d_point,-5,-4,-4,32) \
     else if CONV_PT_KERNEL_SYM8SXSYM16S_PC_FN(conv2d_point,-5,-8,-8,64) \
     else if CONV_DS_KERNEL_SYM8SXSYM16S_PC_FN(conv2d_depth,-5,-8,-8,64) \
     else if CONV1D_KERNEL_FN(conv1d_std, 8, 16, 16, 16) \
@@ -964,6 +1238,199 @@ void parse_arguments(int argc, char** argv, test_config_t *p_cfg)
 #endif /* HIFI_HP_VFPU && hifi5 */    
 #endif /* HIFI_VFPU */
 
+/* The _v2_residual_ kernels saturate the conv result to int8 and then add
+ * the rescaled residual, so they must match the plain v2 kernel followed by
+ * xa_nn_elm_add_asym8sxasym8s_asym8s to within one step. The elm_add
+ * reference needs res_shift <= 0. */
+static int check_residual_sym8sxasym8s(const test_config_t *p_cfg, const WORD8 *p_out,
+    const WORD8 *p_inp, const WORD8 *p_kernel, const WORD32 *p_bias, void *p_scratch,
+    const xa_nn_residual_cfg_t *p_res_cfg, int pointwise, int out_size)
+{
+  WORD8 *p_plain, *p_ref;
+  int itr, diff, err, pass = 1;
+
+  if(p_res_cfg->res_shift > 0)
+  {
+    printf("Residual check skipped, res_shift > 0\n");
+    return 1;
+  }
+  p_plain = (WORD8 *)malloc(out_size);
+  p_ref = (WORD8 *)malloc(out_size);
+  if(p_plain == NULL || p_ref == NULL)
+  {
+    free(p_plain);
+    free(p_ref);
+    return 0;
+  }
+
+  if(pointwise)
+    err = xa_nn_conv2d_pointwise_v2_per_chan_sym8sxasym8s(p_plain, (WORD8 *)p_kernel, (WORD8 *)p_inp, (WORD32 *)p_bias,
+        p_cfg->out_height, p_cfg->out_width, p_cfg->input_channels * p_cfg->channels_multiplier, p_cfg->out_channels,
+        p_cfg->input_zero_bias, p_cfg->p_out_multiplier, p_cfg->p_out_shift, p_cfg->out_zero_bias,
+        p_cfg->out_data_format, -128, 127, NULL);
+  else
+    err = xa_nn_conv2d_std_v2_per_chan_sym8sxasym8s(p_plain, p_inp, p_kernel, p_bias,
+        p_cfg->input_height, p_cfg->input_width, p_cfg->input_channels, p_cfg->kernel_height, p_cfg->kernel_width,
+        p_cfg->out_channels, p_cfg->x_stride, p_cfg->y_stride, p_cfg->x_padding, p_cfg->y_padding,
+        p_cfg->out_height, p_cfg->out_width, p_cfg->input_zero_bias, p_cfg->p_out_multiplier, p_cfg->p_out_shift,
+        p_cfg->out_zero_bias, p_cfg->out_data_format, p_scratch, -128, 127, NULL);
+
+  /* Unit scale for the conv output, 2^-20 on the output to undo the left shift */
+  if(!err)
+    err = xa_nn_elm_add_asym8sxasym8s_asym8s(p_ref, p_cfg->out_zero_bias, -19, 1 << 30,
+        p_cfg->out_activation_min, p_cfg->out_activation_max,
+        p_plain, -p_cfg->out_zero_bias, 0, 0x7fffffff,
+        p_res_cfg->p_res, p_res_cfg->res_zero_bias, p_res_cfg->res_shift, p_res_cfg->res_multiplier,
+        20, out_size);
+
+  for(itr = 0; itr < out_size && !err; itr++)
+  {
+    diff = p_out[itr] - p_ref[itr];
+    if(diff > 1 || diff < -1)
+    {
+      printf("Residual mismatch at %d: %d, elm_add %d\n", itr, p_out[itr], p_ref[itr]);
+      pass = 0;
+      break;
+    }
+  }
+
+  free(p_plain);
+  free(p_ref);
+  return pass && !err;
+}
+
+/* Pads the input with xa_nn_pad_8_8 and runs the plain v2 kernel without
+ * padding on it, the output has to match the explicit pad kernel exactly */
+static int check_explicit_pad_sym8sxasym8s(const test_config_t *p_cfg, const WORD8 *p_out,
+    const WORD8 *p_inp, const WORD8 *p_kernel, const WORD32 *p_bias,
+    const xa_nn_pad_cfg_t *p_pad_cfg, int out_size)
+{
+  WORD8 *p_inp_pad, *p_ref;
+  void *p_ref_scratch;
+  int itr, err, scratch_size, pass = 1;
+  int pad_height = p_cfg->y_padding + p_cfg->input_height + p_pad_cfg->y_b_padding;
+  int pad_width = p_cfg->x_padding + p_cfg->input_width + p_pad_cfg->x_r_padding;
+  int depthwise = !strcmp(p_cfg->kernel_name, "conv2d_depth");
+  WORD32 inp_shape[4] = {1, p_cfg->input_height, p_cfg->input_width, p_cfg->input_channels};
+  WORD32 out_shape[4] = {1, pad_height, pad_width, p_cfg->input_channels};
+  WORD32 pad_values[8] = {0, 0, p_cfg->y_padding, p_pad_cfg->y_b_padding, p_cfg->x_padding, p_pad_cfg->x_r_padding, 0, 0};
+  WORD32 pad_shape[2] = {4, 2};
+
+  if(depthwise)
+    scratch_size = xa_nn_conv2d_depthwise_getsize(pad_height, pad_width, p_cfg->input_channels,
+        p_cfg->kernel_height, p_cfg->kernel_width, p_cfg->channels_multiplier, p_cfg->x_stride, p_cfg->y_stride,
+        0, 0, p_cfg->out_height, p_cfg->out_width, p_cfg->inp_precision, 0);
+  else if(!strcmp(p_cfg->kernel_name, "conv2d"))
+    scratch_size = xa_nn_conv2d_getsize(pad_height, pad_width, p_cfg->input_channels, p_cfg->kernel_height,
+        p_cfg->kernel_width, p_cfg->kernel_channels, 1, 1, p_cfg->y_stride, 0, p_cfg->x_stride, 0,
+        p_cfg->out_height, p_cfg->out_width, p_cfg->out_channels, p_cfg->inp_precision, p_cfg->kernel_precision,
+        p_cfg->out_data_format);
+  else
+    scratch_size = xa_nn_conv2d_std_getsize(pad_height, pad_width, p_cfg->input_channels, p_cfg->kernel_height,
+        p_cfg->kernel_width, p_cfg->input_channels, p_cfg->y_stride, 0, p_cfg->x_stride, 0,
+        p_cfg->out_height, p_cfg->out_width, p_cfg->out_channels, p_cfg->inp_precision, p_cfg->kernel_precision,
+        1, 1, p_cfg->out_data_format);
+  if(scratch_size < 0)
+    return 0;
+
+  p_inp_pad = (WORD8 *)malloc(pad_height * pad_width * p_cfg->input_channels);
+  p_ref = (WORD8 *)malloc(out_size);
+  p_ref_scratch = malloc(scratch_size);
+  if(p_inp_pad == NULL || p_ref == NULL || p_ref_scratch == NULL)
+  {
+    free(p_inp_pad);
+    free(p_ref);
+    free(p_ref_scratch);
+    return 0;
+  }
+
+  err = xa_nn_pad_8_8(p_inp_pad, out_shape, p_inp, inp_shape, pad_values, pad_shape, 4, 4, 2, p_pad_cfg->pad_val);
+
+  if(!err && depthwise)
+    err = xa_nn_conv2d_depthwise_v2_per_chan_sym8sxasym8s(p_ref, p_kernel, p_inp_pad, p_bias,
+        pad_height, pad_width, p_cfg->input_channels, p_cfg->kernel_height, p_cfg->kernel_width,
+        p_cfg->channels_multiplier, p_cfg->x_stride, p_cfg->y_stride, 0, 0, p_cfg->out_height, p_cfg->out_width,
+        p_cfg->input_zero_bias, p_cfg->p_out_multiplier, p_cfg->p_out_shift, p_cfg->out_zero_bias,
+        0, 0, p_ref_scratch, p_cfg->out_activation_min, p_cfg->out_activation_max, NULL);
+  else if(!err && !strcmp(p_cfg->kernel_name, "conv2d"))
+    err = xa_nn_conv2d_v2_per_chan_sym8sxasym8s(p_ref, p_inp_pad, p_kernel, p_bias,
+        pad_height, pad_width, p_cfg->input_channels, p_cfg->kernel_height, p_cfg->kernel_width,
+        p_cfg->kernel_channels, 1, 1, p_cfg->out_channels, p_cfg->x_stride, p_cfg->y_stride, 0, 0,
+        p_cfg->out_height, p_cfg->out_width, p_cfg->input_zero_bias, p_cfg->p_out_multiplier, p_cfg->p_out_shift,
+        p_cfg->out_zero_bias, p_cfg->out_data_format, p_ref_scratch, p_cfg->out_activation_min,
+        p_cfg->out_activation_max, NULL);
+  else if(!err)
+    err = xa_nn_conv2d_std_v2_per_chan_sym8sxasym8s(p_ref, p_inp_pad, p_kernel, p_bias,
+        pad_height, pad_width, p_cfg->input_channels, p_cfg->kernel_height, p_cfg->kernel_width,
+        p_cfg->out_channels, p_cfg->x_stride, p_cfg->y_stride, 0, 0, p_cfg->out_height, p_cfg->out_width,
+        p_cfg->input_zero_bias, p_cfg->p_out_multiplier, p_cfg->p_out_shift, p_cfg->out_zero_bias,
+        p_cfg->out_data_format, p_ref_scratch, p_cfg->out_activation_min, p_cfg->out_activation_max, NULL);
+
+  for(itr = 0; itr < out_size && !err; itr++)
+  {
+    if(p_out[itr] != p_ref[itr])
+    {
+      printf("Explicit pad mismatch at %d: %d, padded input %d\n", itr, p_out[itr], p_ref[itr]);
+      pass = 0;
+      break;
+    }
+  }
+
+  free(p_inp_pad);
+  free(p_ref);
+  free(p_ref_scratch);
+  return pass && !err;
+}
+
+/* Reruns the f32io kernel with asym8s output into p_out, the f32 output has
+ * to match xa_nn_elm_dequantize_asym8s_f32 of it */
+static int check_f32io_out_sym8sxasym8s(const test_config_t *p_cfg, WORD8 *p_out,
+    const FLOAT32 *p_out_f32, const FLOAT32 *p_inp, const WORD8 *p_kernel, const WORD32 *p_bias,
+    void *p_scratch, const xa_nn_f32io_cfg_t *p_io_cfg, int out_size)
+{
+  xa_nn_f32io_cfg_t io_cfg_q = *p_io_cfg;
+  FLOAT32 *p_ref;
+  int itr, err, pass = 1;
+
+  p_ref = (FLOAT32 *)malloc(out_size * sizeof(FLOAT32));
+  if(p_ref == NULL)
+    return 0;
+
+  io_cfg_q.out_f32 = 0;
+  err = xa_nn_conv2d_std_v2_f32io_per_chan_sym8sxasym8s(p_out, p_inp, p_kernel, p_bias,
+      p_cfg->input_height, p_cfg->input_width, p_cfg->input_channels, p_cfg->kernel_height, p_cfg->kernel_width,
+      p_cfg->out_channels, p_cfg->x_stride, p_cfg->y_stride, p_cfg->x_padding, p_cfg->y_padding,
+      p_cfg->out_height, p_cfg->out_width, p_cfg->input_zero_bias, p_cfg->p_out_multiplier, p_cfg->p_out_shift,
+      p_cfg->out_zero_bias, p_scratch, p_cfg->out_activation_min, p_cfg->out_activation_max, &io_cfg_q);
+  if(!err)
+    err = xa_nn_elm_dequantize_asym8s_f32(p_ref, p_out, p_cfg->out_zero_bias, p_io_cfg->out_scale, out_size);
+
+  for(itr = 0; itr < out_size && !err; itr++)
+  {
+    if(p_out_f32[itr] != p_ref[itr])
+    {
+      printf("f32 output mismatch at %d: %f, dequantized %f\n", itr, p_out_f32[itr], p_ref[itr]);
+      pass = 0;
+      break;
+    }
+  }
+
+  free(p_ref);
+  return pass && !err;
+}
+
+/* memcpy stand-in for a DMA engine, transfers complete synchronously */
+static WORD32 testbench_dma_transfer(VOID *p_dst, const VOID *p_src, WORD32 n_bytes, VOID *p_ctx)
+{
+  memcpy(p_dst, p_src, n_bytes);
+  return 0;
+}
+
+static WORD32 testbench_dma_wait(WORD32 transfer_id, VOID *p_ctx)
+{
+  return 0;
+}
+
 int xa_nn_main_process(int argc, char *argv[])
 {
 
@@ -973,7 +1440,24 @@ int xa_nn_main_process(int argc, char *argv[])
   char profiler_name_0[MAX_PROFILER_NAME_LENGTH]; 
   char profiler_name_1[MAX_PROFILER_NAME_LENGTH]; 
   char profiler_params[MAX_PROFILER_PARAMS_LENGTH]; 
-  void *p_scratch;
+  void *p_scratch = NULL;
+  void *p_kernel_packed_mem = NULL;
+  void *p_kernel_packed = NULL;
+  xa_dma_cfg_t dma_cfg;
+  xa_dma_cfg_t *p_dma_cfg = NULL;
+  xa_nn_residual_cfg_t res_cfg;
+  xa_nn_residual_cfg_t *p_res_cfg = NULL;
+  xa_nn_pad_cfg_t pad_cfg;
+  xa_nn_pad_cfg_t *p_pad_cfg = NULL;
+  buf1D_t *p_inp_f32 = NULL;
+  buf1D_t *p_out_f32 = NULL;
+  int io_pass = 1;
+  xa_nn_f32io_cfg_t io_cfg;
+  xa_nn_f32io_cfg_t *p_io_cfg = NULL;
+  WORD8 *p_res = NULL;
+  xa_nn_act_cfg_t act_cfg;
+  xa_nn_act_cfg_t *p_act_cfg = NULL;
+  WORD8 *p_act_lut = NULL;
   int inp_size=0, kernel_size, out_size;
   int kernel_size_pad, input_channels_pad,kernel_channels_pad;
   int kernel_channels;
@@ -1055,6 +1539,10 @@ int xa_nn_main_process(int argc, char *argv[])
     kernel_size_pad = cfg.kernel_height * cfg.kernel_width * input_channels_pad;
     bias_size = cfg.out_channels;
     out_size = cfg.out_height * cfg.out_width * cfg.out_channels;
+    if(cfg.v2 && cfg.pool_type >= 0)
+    {
+      out_size = cfg.pool_out_height * cfg.pool_out_width * cfg.out_channels;
+    }
     if(cfg.inp_precision == -4 || cfg.inp_precision == -8 || cfg.inp_precision == -7)
     {
       cfg.p_out_multiplier = (int *)malloc(cfg.out_channels*(sizeof(WORD32)));
@@ -1148,8 +1636,12 @@ int xa_nn_main_process(int argc, char *argv[])
     inp_size          = cfg.input_channels      * cfg.input_height        * cfg.input_width;
     kernel_point_size = cfg.out_channels        * cfg.input_channels * 1 * 1;
     out_size          = cfg.out_channels        * cfg.input_height          * cfg.input_width;
+    if(cfg.v2 && cfg.pool_type >= 0)
+    {
+      out_size = cfg.pool_out_height * cfg.pool_out_width * cfg.out_channels;
+    }
     bias_point_size = cfg.out_channels;
-    if(cfg.inp_precision == -8 || cfg.inp_precision == -7)
+    if(cfg.inp_precision == -4 || cfg.inp_precision == -8 || cfg.inp_precision == -7)
     {
       cfg.p_out_multiplier = (int *)malloc(cfg.out_channels*(sizeof(WORD32)));
       cfg.p_out_shift = (int *)malloc(cfg.out_channels*(sizeof(WORD32)));
@@ -1490,11 +1982,26 @@ int xa_nn_main_process(int argc, char *argv[])
   // Get persistent size and allocate 
   if((!strcmp(cfg.kernel_name,"conv2d_std")))
   {
-    if(cfg.kernel_precision == -12)
+    if(cfg.kernel_precision == -12 && !cfg.prepack)
     {
     scratch_size = xa_nn_conv2d_std_getsize_sym4s(cfg.input_height,cfg.input_channels,cfg.kernel_height,cfg.kernel_width,cfg.y_stride,cfg.y_padding,
         cfg.out_height, cfg.out_channels, cfg.inp_precision); PRINT_VAR(scratch_size)
     }
+    else if(cfg.v2 && cfg.pool_type >= 0)
+    {
+    scratch_size = xa_nn_conv2d_std_v2_pool_getsize(cfg.input_width,cfg.input_channels,cfg.kernel_height,cfg.kernel_width,cfg.out_channels,
+        cfg.x_stride,cfg.y_stride,cfg.x_padding,cfg.y_padding,cfg.out_width,cfg.pool_height,cfg.inp_precision); PRINT_VAR(scratch_size)
+    }
+    else if(cfg.v2 && cfg.prepack && cfg.kernel_precision == PREC_SYM8S && cfg.inp_precision == PREC_SYM16S)
+    {
+    scratch_size = xa_nn_conv2d_std_v2_prepacked_getsize_sym8sxsym16s(cfg.input_height,cfg.input_width,cfg.input_channels,cfg.kernel_height,cfg.kernel_width,
+        cfg.y_stride,cfg.y_padding,cfg.x_stride,cfg.x_padding,cfg.out_height,cfg.out_width,cfg.out_channels,cfg.out_data_format); PRINT_VAR(scratch_size)
+    }
+    else if(cfg.v2 && cfg.f32io && cfg.out_data_format == 0 && cfg.kernel_precision == -5)
+    {
+    scratch_size = xa_nn_conv2d_std_v2_f32io_getsize(cfg.input_width,cfg.input_channels,cfg.kernel_height,cfg.kernel_width,cfg.out_channels,
+        cfg.x_stride,cfg.y_stride,cfg.x_padding,cfg.y_padding,cfg.out_width,cfg.band_rows); PRINT_VAR(scratch_size)
+    }
     else
     {
     scratch_size=xa_nn_conv2d_std_getsize(cfg.input_height
@@ -1546,6 +2053,25 @@ int xa_nn_main_process(int argc, char *argv[])
     scratch_size = xa_nn_dilated_conv2d_std_getsize(cfg.input_height,cfg.input_channels,cfg.kernel_height,cfg.kernel_width,cfg.y_stride,cfg.y_padding,cfg.out_height,cfg.out_channels,cfg.inp_precision,cfg.dilation_height);
     PRINT_VAR(scratch_size)
   }
+  else if(!strcmp(cfg.kernel_name,"conv2d_depth") && cfg.v2 && cfg.ds_rows > 0)
+  {
+    scratch_size =
+      xa_nn_conv2d_depthwise_pointwise_getsize
+      (cfg.input_width
+       ,cfg.input_channels
+       ,cfg.kernel_height
+       ,cfg.kernel_width
+       ,cfg.channels_multiplier
+       ,cfg.x_stride
+       ,cfg.y_stride
+       ,cfg.x_padding
+       ,cfg.y_padding
+       ,cfg.out_width
+       ,cfg.ds_rows
+       ,cfg.inp_precision
+      );
+    PRINT_VAR(scratch_size)
+  }
   else if(!strcmp(cfg.kernel_name,"conv2d_depth"))
   {
     scratch_size =
@@ -1599,7 +2125,12 @@ int xa_nn_main_process(int argc, char *argv[])
     scratch_size = xa_nn_transpose_conv_getsize(cfg.input_height,cfg.input_width,cfg.input_channels,cfg.kernel_height,cfg.kernel_width,cfg.x_stride,cfg.y_stride,cfg.out_height,cfg.out_width,cfg.out_channels,num_groups,cfg.kernel_precision,cfg.out_precision); PRINT_VAR(scratch_size)
   }
 
-  if(strcmp(cfg.kernel_name,"conv2d_point"))
+  else if(!strcmp(cfg.kernel_name,"conv2d_point") && cfg.v2 && cfg.pool_type >= 0)
+  {
+    scratch_size = xa_nn_conv2d_pointwise_v2_pool_getsize(cfg.input_width,cfg.out_channels,cfg.pool_height); PRINT_VAR(scratch_size)
+  }
+
+  if(strcmp(cfg.kernel_name,"conv2d_point") || (cfg.v2 && cfg.pool_type >= 0))
   {
     scratch_size=scratch_size<0?0:scratch_size;
     p_scratch = (xa_nnlib_handle_t)malloc(scratch_size); PRINT_PTR(p_scratch)
@@ -1607,6 +2138,104 @@ int xa_nn_main_process(int argc, char *argv[])
     fprintf(stdout, "\nScratch size: %d bytes\n", scratch_size);
   }
 
+  if(cfg.prepack && !strcmp(cfg.kernel_name,"conv2d_std"))
+  {
+    int packed_size = -1;
+    if(cfg.kernel_precision == -12)
+      packed_size = xa_nn_conv2d_std_prepack_getsize_sym4s(cfg.input_channels, cfg.kernel_height, cfg.kernel_width, cfg.out_channels);
+    else if(cfg.kernel_precision == PREC_SYM8S && cfg.inp_precision == PREC_SYM16S)
+      packed_size = xa_nn_conv2d_std_prepack_getsize_sym8sxsym16s(cfg.input_channels, cfg.kernel_height, cfg.kernel_width, cfg.out_channels);
+    if(packed_size > 0)
+    {
+      p_kernel_packed_mem = malloc(packed_size + 16); VALIDATE_PTR(p_kernel_packed_mem);
+      p_kernel_packed = (void *)(((unsigned int)p_kernel_packed_mem + 15) & ~15);
+      fprintf(stdout, "\nPrepacked kernel size: %d bytes\n", packed_size);
+    }
+  }
+
+  if(cfg.v2 && cfg.dma > 0)
+  {
+    dma_cfg.transfer = testbench_dma_transfer;
+    dma_cfg.wait = testbench_dma_wait;
+    dma_cfg.p_ctx = NULL;
+    dma_cfg.p_local_buf[0] = malloc(cfg.dma); VALIDATE_PTR(dma_cfg.p_local_buf[0]);
+    dma_cfg.p_local_buf[1] = malloc(cfg.dma); VALIDATE_PTR(dma_cfg.p_local_buf[1]);
+    dma_cfg.local_buf_size = cfg.dma;
+    p_dma_cfg = &dma_cfg;
+  }
+
+  if(cfg.v2 && cfg.res_multiplier != 0)
+  {
+    int itr;
+    p_res = (WORD8 *)malloc(out_size); VALIDATE_PTR(p_res);
+    for(itr = 0; itr < out_size; itr++)
+      p_res[itr] = (WORD8)(itr * 7 - 128);
+    res_cfg.p_res = p_res;
+    res_cfg.res_zero_bias = cfg.res_zero_bias;
+    res_cfg.res_multiplier = cfg.res_multiplier;
+    res_cfg.res_shift = cfg.res_shift;
+    p_res_cfg = &res_cfg;
+  }
+
+  if(cfg.v2 && cfg.act_type >= 0)
+  {
+    /* Fixed quantization parameters, enough for profiling the epilogue */
+    xa_nn_act_params_t act_params;
+    WORD8 *p_alpha;
+    int lut_channels = cfg.act_type == ACT_PRELU ? cfg.out_channels : 1;
+    memset(&act_params, 0, sizeof(act_params));
+    p_alpha = (WORD8 *)malloc(cfg.out_channels); VALIDATE_PTR(p_alpha);
+    memset(p_alpha, 64, cfg.out_channels);
+    act_params.act_type = cfg.act_type;
+    act_params.inp_zero_bias = cfg.out_zero_bias;
+    act_params.out_multiplier = cfg.act_type == ACT_HARD_SWISH ? 0x4000 : 0x40000000;
+    act_params.out_shift = 1;
+    act_params.out_zero_bias = cfg.out_zero_bias;
+    act_params.alpha_multiplier = cfg.act_type == ACT_HARD_SWISH ? 0x4000 : 0x40000000;
+    act_params.alpha_shift = 0;
+    act_params.p_alpha = p_alpha;
+    act_params.input_range_radius = 127;
+    act_params.input_multiplier = 0x40000000;
+    act_params.input_left_shift = 0;
+    act_params.activation_min = -128;
+    act_params.activation_max = 127;
+    p_act_lut = (WORD8 *)malloc(lut_channels * 256); VALIDATE_PTR(p_act_lut);
+    err = xa_nn_vec_activation_lut_asym8s(p_act_lut, &act_params, lut_channels);
+    free(p_alpha);
+    if(err)
+    {
+      printf("Activation LUT parameters are invalid\n");
+      return -1;
+    }
+    act_cfg.p_lut = p_act_lut;
+    act_cfg.lut_channels = lut_channels;
+    p_act_cfg = &act_cfg;
+  }
+
+  if(cfg.v2 && cfg.f32io && cfg.out_data_format == 0 && cfg.kernel_precision == -5 && !strcmp(cfg.kernel_name,"conv2d_std"))
+  {
+    p_inp_f32 = create_buf1D(inp_size, -1); VALIDATE_PTR(p_inp_f32);
+    io_cfg.inp_scale = 1.0f;
+    io_cfg.out_scale = 1.0f;
+    io_cfg.out_f32 = 0;
+    io_cfg.band_rows = cfg.band_rows;
+    p_io_cfg = &io_cfg;
+    if(cfg.f32io == 2)
+    {
+      p_out_f32 = create_buf1D(out_size, -1); VALIDATE_PTR(p_out_f32);
+      io_cfg.out_scale = 0.5f;
+      io_cfg.out_f32 = 1;
+    }
+  }
+
+  if(cfg.v2 && cfg.explicit_pad)
+  {
+    pad_cfg.x_r_padding = cfg.x_r_padding;
+    pad_cfg.y_b_padding = cfg.y_b_padding;
+    pad_cfg.pad_val = cfg.pad_val;
+    p_pad_cfg = &pad_cfg;
+  }
+
   // Frame processing loop
   for(frame = 0; frame < cfg.frames; frame++)
   {
@@ -1624,6 +2253,15 @@ int xa_nn_main_process(int argc, char *argv[])
     else if(!strcmp(cfg.kernel_name,"conv2d_point"))
       load_conv2d_pt_input_data(cfg.write_file, fptr_inp, p_inp, p_kernel_point, p_bias_point);
 
+    /* With unit scale, quantizing q + input_zero_bias gives back q, so the
+     * output matches the asym8s input path */
+    if(p_io_cfg != NULL)
+    {
+      int itr;
+      for(itr = 0; itr < inp_size; itr++)
+        ((FLOAT32 *)p_inp_f32->p)[itr] = (FLOAT32)(((WORD8 *)p_inp->p)[itr] + cfg.input_zero_bias);
+    }
+
     // Call the cnn kernel_name specified on command line
     PROCESS_CONV;
     if(err)
@@ -1633,6 +2271,13 @@ int xa_nn_main_process(int argc, char *argv[])
       break;
     }
 
+    /* The f32 output run leaves p_out empty, fill it for the file and the
+     * reference compare while checking the f32 output */
+    io_pass = 1;
+    if(p_io_cfg != NULL && p_io_cfg->out_f32 && cfg.pool_type < 0)
+      io_pass = check_f32io_out_sym8sxasym8s(&cfg, (WORD8 *)p_out->p, (FLOAT32 *)p_out_f32->p,
+          (FLOAT32 *)p_inp_f32->p, (WORD8 *)p_kernel->p, (WORD32 *)p_bias->p, p_scratch, p_io_cfg, out_size);
+
     /* Since there are 2 profilers; one for conv2d_depth one for conv2d_point,
      * thus the update and print will be done in the PROCESS_CONV macro. */
     if(strcmp(cfg.kernel_name,"conv2d_depth"))
@@ -1645,14 +2290,35 @@ int xa_nn_main_process(int argc, char *argv[])
     write_buf1D_to_file(fptr_out, p_out);
 
     // If verify flag enabled, compare output against reference
-    if(cfg.verify)
     {
-      read_buf1D_from_file(fptr_ref, p_ref);
-      pass_count += compare_buf1D(p_ref, p_out, cfg.verify, cfg.out_precision, kernel_size_pad);
-    }
-    else
-    {
-      pass_count += !err;
+      int pass = !err;
+      if(cfg.verify)
+      {
+        read_buf1D_from_file(fptr_ref, p_ref);
+        pass = compare_buf1D(p_ref, p_out, cfg.verify, cfg.out_precision, kernel_size_pad);
+      }
+      /* Self-checks against composed kernels, these need no reference file */
+      pass &= io_pass;
+      if(p_res_cfg != NULL && p_act_cfg == NULL && p_out->precision == -4 && p_inp->precision == -4)
+      {
+        if(!strcmp(cfg.kernel_name,"conv2d_std") && p_pad_cfg == NULL && p_kernel->precision == -5)
+          pass &= check_residual_sym8sxasym8s(&cfg, (WORD8 *)p_out->p, (WORD8 *)p_inp->p, (WORD8 *)p_kernel->p,
+              (WORD32 *)p_bias->p, p_scratch, p_res_cfg, 0, out_size);
+        else if(!strcmp(cfg.kernel_name,"conv2d_depth") && p_kernel->precision == -5)
+          pass &= check_residual_sym8sxasym8s(&cfg, (WORD8 *)p_out->p, (WORD8 *)p_dw_out->p, (WORD8 *)p_kernel_point->p,
+              (WORD32 *)p_bias_point->p, p_scratch, p_res_cfg, 1, out_size);
+      }
+      if(p_pad_cfg != NULL && p_act_cfg == NULL && p_io_cfg == NULL && cfg.pool_type < 0 &&
+          p_kernel->precision == -5 && p_inp->precision == -4 && p_out->precision == -4)
+      {
+        if(!strcmp(cfg.kernel_name,"conv2d_std") || !strcmp(cfg.kernel_name,"conv2d"))
+          pass &= check_explicit_pad_sym8sxasym8s(&cfg, (WORD8 *)p_out->p, (WORD8 *)p_inp->p, (WORD8 *)p_kernel->p,
+              (WORD32 *)p_bias->p, p_pad_cfg, out_size);
+        else if(!strcmp(cfg.kernel_name,"conv2d_depth") && cfg.ds_rows <= 0)
+          pass &= check_explicit_pad_sym8sxasym8s(&cfg, (WORD8 *)p_dw_out->p, (WORD8 *)p_inp->p, (WORD8 *)p_kernel->p,
+              (WORD32 *)p_bias->p, p_pad_cfg, dw_out_size);
+      }
+      pass_count += pass;
     }
   }
 
@@ -1699,9 +2365,34 @@ int xa_nn_main_process(int argc, char *argv[])
     free_buf1D(p_ref);
   }
 
-  if(strcmp(cfg.kernel_name,"conv2d_point"))
+  free(p_scratch);
+
+  if(p_kernel_packed_mem)
+  {
+    free(p_kernel_packed_mem);
+  }
+
+  if(p_dma_cfg)
+  {
+    free(dma_cfg.p_local_buf[0]);
+    free(dma_cfg.p_local_buf[1]);
+  }
+
+  if(p_res)
+  {
+    free(p_res);
+  }
+  if(p_act_lut)
+  {
+    free(p_act_lut);
+  }
+  if(p_inp_f32)
+  {
+    free_buf1D(p_inp_f32);
+  }
+  if(p_out_f32)
   {
-    free(p_scratch);
+    free_buf1D(p_out_f32);
   }
 
   return 0;
@@ -0,0 +1,555 @@
+/*******************************************************************************
+* Copyright (c) 2018-2025 Cadence Design Systems, Inc.
+*
+* Permission is hereby granted, free of charge, to any person obtaining
+* a copy of this software and associated documentation files (the
+* "Software"), to use this Software with Cadence processor cores only and
+* not with any other processors and platforms, subject to
+* the following conditions:
+*
+* The above copyright notice and this permission notice shall be included
+* in all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+******************************************************************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include "xa_type_def.h"
+#include "nnlib/xa_nnlib_api.h"
+#include "nnlib/xa_nnlib_graph_api.h"
+#include "cmdline_parser.h"
+#include "xa_nnlib_standards.h"
+#define PROF_ALLOCATE
+#include "xt_profiler.h"
+
+/* Runs a DS-CNN keyword spotting graph (conv2d, two depthwise separable
+ * blocks with a residual add, avgpool, fully connected, softmax) through
+ * the graph executor. Weights are random; every frame is compared against
+ * the same ops called directly on separate buffers, with RELU / RELU6
+ * applied as a separate activation pass. */
+
+#define N_TENSORS 10
+#define N_OPS 9
+#define N_CLASSES 12
+
+/* Quantization constants of the executor, as in the TFLite reference */
+#define SOFTMAX_INPUT_INT_BITS 5
+#define ADD_LEFT_SHIFT 20
+
+#define ALIGN_UP(n, a) (((n) + (a) - 1) & ~((a) - 1))
+
+typedef struct _test_config_t
+{
+  int help;
+  int input_height;
+  int input_width;
+  int channels;
+  int frames;
+  int verify;
+}test_config_t;
+
+int default_config(test_config_t *p_cfg)
+{
+  if(p_cfg)
+  {
+    p_cfg->help = 0;
+    p_cfg->input_height = 49;
+    p_cfg->input_width = 10;
+    p_cfg->channels = 64;
+    p_cfg->frames = 4;
+    p_cfg->verify = 1;
+    return 0;
+  }
+  else
+  {
+    return -1;
+  }
+}
+
+void show_usage(void)
+{
+    printf ("Usage xt-run <binary> [Options]\n");
+    printf("\t-input_height: input height (frames); Default=49\n");
+    printf("\t-input_width: input width (features); Default=10\n");
+    printf("\t-channels: channels of the depthwise separable blocks; Default=64\n");
+    printf("\t-frames: number of inferences; Default=4\n");
+    printf("\t-verify: verify output; Default=1\n");
+    printf("\t-h / -help / --help: Display this help message\n");
+}
+
+void parse_arguments(int argc, char** argv, test_config_t *p_cfg)
+{
+  int argidx;
+  for (argidx=1;argidx<argc;argidx++)
+  {
+    if(strncmp((argv[argidx]), "-", 1) != 0)
+    {
+      printf("Invalid argument: %s\n",argv[argidx]);
+      show_usage();
+      exit(1);
+    }
+    ARGTYPE_INDICATE("--help", p_cfg->help);
+    ARGTYPE_INDICATE("-help", p_cfg->help);
+    ARGTYPE_INDICATE("-h", p_cfg->help);
+    ARGTYPE_ONETIME_CONFIG("-input_height",p_cfg->input_height);
+    ARGTYPE_ONETIME_CONFIG("-input_width",p_cfg->input_width);
+    ARGTYPE_ONETIME_CONFIG("-channels",p_cfg->channels);
+    ARGTYPE_ONETIME_CONFIG("-frames",p_cfg->frames);
+    ARGTYPE_ONETIME_CONFIG("-verify",p_cfg->verify);
+
+    // If arg doesnt match with any of the above supported options, report option as invalid
+    printf("Invalid argument: %s\n",argv[argidx]);
+    show_usage();
+    exit(1);
+  }
+}
+
+static void set_tensor(xa_nnlib_graph_tensor_desc_t *p_tensor, int height, int width, int channels, int zero_point, float scale)
+{
+  p_tensor->height = height;
+  p_tensor->width = width;
+  p_tensor->channels = channels;
+  p_tensor->zero_point = zero_point;
+  p_tensor->scale = scale;
+}
+
+static void set_op(xa_nnlib_graph_op_desc_t *p_op, int type, int input0, int input1, int output,
+    int kernel_height, int kernel_width, int stride, int x_padding, int y_padding, int activation)
+{
+  memset(p_op, 0, sizeof(*p_op));
+  p_op->type = type;
+  p_op->input[0] = input0;
+  p_op->input[1] = input1;
+  p_op->output = output;
+  p_op->kernel_height = kernel_height;
+  p_op->kernel_width = kernel_width;
+  p_op->x_stride = stride;
+  p_op->y_stride = stride;
+  p_op->x_padding = x_padding;
+  p_op->y_padding = y_padding;
+  p_op->activation = activation;
+  p_op->weight_offset = -1;
+  p_op->bias_offset = -1;
+  p_op->weight_scale_offset = -1;
+}
+
+/* Appends random weights, biases and weight scales of an op to the constant section */
+static int add_consts(xa_nnlib_graph_op_desc_t *p_op, WORD8 *p_const, int const_size,
+    int weight_size, int n_bias, int n_scales)
+{
+  int itr;
+  WORD32 *p_bias;
+  Flt32 *p_scales;
+
+  p_op->weight_offset = const_size;
+  for(itr = 0; itr < weight_size; itr++)
+  {
+    p_const[const_size + itr] = (WORD8)((rand() % 255) - 127);
+  }
+  const_size = ALIGN_UP(const_size + weight_size, 4);
+
+  p_op->bias_offset = const_size;
+  p_bias = (WORD32 *)(p_const + const_size);
+  for(itr = 0; itr < n_bias; itr++)
+  {
+    p_bias[itr] = (rand() % 2001) - 1000;
+  }
+  const_size += n_bias * sizeof(WORD32);
+
+  p_op->weight_scale_offset = const_size;
+  p_scales = (Flt32 *)(p_const + const_size);
+  for(itr = 0; itr < n_scales; itr++)
+  {
+    p_scales[itr] = 0.002f + 0.001f * (rand() % 4);
+  }
+  const_size += n_scales * sizeof(Flt32);
+
+  return const_size;
+}
+
+/* Serializes the test network, returns the blob size */
+static int build_graph(WORD8 *p_graph, const test_config_t *p_cfg)
+{
+  xa_nnlib_graph_header_t *p_header = (xa_nnlib_graph_header_t *)p_graph;
+  xa_nnlib_graph_tensor_desc_t *p_tensors = (xa_nnlib_graph_tensor_desc_t *)(p_header + 1);
+  xa_nnlib_graph_op_desc_t *p_ops = (xa_nnlib_graph_op_desc_t *)(p_tensors + N_TENSORS);
+  WORD8 *p_const = (WORD8 *)(p_ops + N_OPS);
+  int c = p_cfg->channels, ih = p_cfg->input_height, iw = p_cfg->input_width;
+  int oh = (ih + 1) / 2, ow = (iw + 1) / 2;
+  int const_size = 0;
+
+  /* SAME padding of the 10x4 stride 2 conv */
+  int y_padding = ((oh - 1) * 2 + 10 - ih) / 2;
+  int x_padding = ((ow - 1) * 2 + 4 - iw) / 2;
+  y_padding = y_padding < 0 ? 0 : y_padding;
+  x_padding = x_padding < 0 ? 0 : x_padding;
+
+  set_tensor(&p_tensors[0], ih, iw, 1, 0, 0.1f);
+  set_tensor(&p_tensors[1], oh, ow, c, -128, 0.05f);
+  set_tensor(&p_tensors[2], oh, ow, c, -128, 0.05f);
+  set_tensor(&p_tensors[3], oh, ow, c, -128, 0.05f);
+  set_tensor(&p_tensors[4], oh, ow, c, -128, 0.05f);
+  set_tensor(&p_tensors[5], oh, ow, c, -128, 0.05f);
+  set_tensor(&p_tensors[6], oh, ow, c, -128, 0.1f);
+  set_tensor(&p_tensors[7], 1, 1, c, -128, 0.1f);
+  set_tensor(&p_tensors[8], 1, 1, N_CLASSES, 0, 0.1f);
+  set_tensor(&p_tensors[9], 1, 1, N_CLASSES, -128, 1.0f / 256);
+
+  set_op(&p_ops[0], XA_NNLIB_GRAPH_OP_CONV2D, 0, -1, 1, 10, 4, 2, x_padding, y_padding, XA_NNLIB_GRAPH_ACT_RELU);
+  const_size = add_consts(&p_ops[0], p_const, const_size, c * 10 * 4, c, c);
+  set_op(&p_ops[1], XA_NNLIB_GRAPH_OP_DEPTHWISE_CONV2D, 1, -1, 2, 3, 3, 1, 1, 1, XA_NNLIB_GRAPH_ACT_RELU);
+  const_size = add_consts(&p_ops[1], p_const, const_size, 3 * 3 * c, c, c);
+  set_op(&p_ops[2], XA_NNLIB_GRAPH_OP_POINTWISE_CONV2D, 2, -1, 3, 1, 1, 1, 0, 0, XA_NNLIB_GRAPH_ACT_RELU);
+  const_size = add_consts(&p_ops[2], p_const, const_size, c * c, c, c);
+  set_op(&p_ops[3], XA_NNLIB_GRAPH_OP_DEPTHWISE_CONV2D, 3, -1, 4, 3, 3, 1, 1, 1, XA_NNLIB_GRAPH_ACT_RELU6);
+  const_size = add_consts(&p_ops[3], p_const, const_size, 3 * 3 * c, c, c);
+  set_op(&p_ops[4], XA_NNLIB_GRAPH_OP_POINTWISE_CONV2D, 4, -1, 5, 1, 1, 1, 0, 0, XA_NNLIB_GRAPH_ACT_RELU6);
+  const_size = add_consts(&p_ops[4], p_const, const_size, c * c, c, c);
+  set_op(&p_ops[5], XA_NNLIB_GRAPH_OP_ADD, 3, 5, 6, 0, 0, 0, 0, 0, XA_NNLIB_GRAPH_ACT_NONE);
+  set_op(&p_ops[6], XA_NNLIB_GRAPH_OP_AVGPOOL, 6, -1, 7, oh, ow, 1, 0, 0, XA_NNLIB_GRAPH_ACT_NONE);
+  p_tensors[7].scale = p_tensors[6].scale;
+  p_tensors[7].zero_point = p_tensors[6].zero_point;
+  set_op(&p_ops[7], XA_NNLIB_GRAPH_OP_FULLY_CONNECTED, 7, -1, 8, 0, 0, 0, 0, 0, XA_NNLIB_GRAPH_ACT_NONE);
+  const_size = add_consts(&p_ops[7], p_const, const_size, N_CLASSES * c, N_CLASSES, 1);
+  set_op(&p_ops[8], XA_NNLIB_GRAPH_OP_SOFTMAX, 8, -1, 9, 0, 0, 0, 0, 0, XA_NNLIB_GRAPH_ACT_NONE);
+  p_ops[8].beta = 1.0f;
+
+  p_header->magic = XA_NNLIB_GRAPH_MAGIC;
+  p_header->version = XA_NNLIB_GRAPH_VERSION;
+  p_header->n_tensors = N_TENSORS;
+  p_header->n_ops = N_OPS;
+  p_header->input_tensor = 0;
+  p_header->output_tensor = 9;
+  p_header->const_size = const_size;
+  p_header->reserved = 0;
+
+  return (int)(p_const - p_graph) + const_size;
+}
+
+/* TFLite QuantizeMultiplier, as used by the graph executor */
+static int quantize_multiplier(double real, WORD32 *p_multiplier, WORD32 *p_shift)
+{
+  double q;
+  long long q_fixed;
+  int shift;
+
+  if(real <= 0.0)
+    return -1;
+
+  q = frexp(real, &shift);
+  q_fixed = (long long)floor(q * (double)(1LL << 31) + 0.5);
+  if(q_fixed == (1LL << 31))
+  {
+    q_fixed /= 2;
+    shift++;
+  }
+  if(shift < -31)
+  {
+    shift = 0;
+    q_fixed = 0;
+  }
+  if(shift > 30)
+    return -1;
+
+  *p_multiplier = (WORD32)q_fixed;
+  *p_shift = shift;
+  return 0;
+}
+
+/* Runs the serialized network op by op with direct kernel calls */
+static int run_reference(const WORD8 *p_graph, const WORD8 *p_inp, WORD8 *p_out)
+{
+  const xa_nnlib_graph_header_t *p_header = (const xa_nnlib_graph_header_t *)p_graph;
+  const xa_nnlib_graph_tensor_desc_t *p_tensors = (const xa_nnlib_graph_tensor_desc_t *)(p_header + 1);
+  const xa_nnlib_graph_op_desc_t *p_ops = (const xa_nnlib_graph_op_desc_t *)(p_tensors + N_TENSORS);
+  const WORD8 *p_const = (const WORD8 *)(p_ops + N_OPS);
+  WORD8 *p_data[N_TENSORS], *p_tmp;
+  WORD32 *p_mult, *p_shift;
+  void *p_scratch;
+  int itr, ch, row, size, max_size = 0, max_channels = 3, scratch_size = 0, err = 0;
+
+  for(itr = 0; itr < N_TENSORS; itr++)
+  {
+    size = p_tensors[itr].height * p_tensors[itr].width * p_tensors[itr].channels;
+    max_size = size > max_size ? size : max_size;
+    max_channels = p_tensors[itr].channels > max_channels ? p_tensors[itr].channels : max_channels;
+    p_data[itr] = (WORD8 *)malloc(size);
+  }
+  p_tmp = (WORD8 *)malloc(max_size);
+  p_mult = (WORD32 *)malloc(2 * max_channels * sizeof(WORD32));
+  p_shift = p_mult + max_channels;
+  memcpy(p_data[p_header->input_tensor], p_inp,
+         p_tensors[p_header->input_tensor].height * p_tensors[p_header->input_tensor].width);
+
+  for(itr = 0; itr < N_OPS; itr++)
+  {
+    const xa_nnlib_graph_op_desc_t *p_op = &p_ops[itr];
+    const xa_nnlib_graph_tensor_desc_t *p_ti = &p_tensors[p_op->input[0]], *p_to = &p_tensors[p_op->output];
+    if(p_op->type == XA_NNLIB_GRAPH_OP_CONV2D)
+      size = xa_nn_conv2d_std_getsize(p_ti->height, p_ti->width, p_ti->channels, p_op->kernel_height, p_op->kernel_width,
+          p_ti->channels, p_op->y_stride, p_op->y_padding, p_op->x_stride, p_op->x_padding,
+          p_to->height, p_to->width, p_to->channels, PREC_ASYM8S, PREC_SYM8S, 1, 1, 0);
+    else if(p_op->type == XA_NNLIB_GRAPH_OP_DEPTHWISE_CONV2D)
+      size = xa_nn_conv2d_depthwise_getsize(p_ti->height, p_ti->width, p_ti->channels, p_op->kernel_height, p_op->kernel_width,
+          1, p_op->x_stride, p_op->y_stride, p_op->x_padding, p_op->y_padding, p_to->height, p_to->width, PREC_ASYM8S, 0);
+    else if(p_op->type == XA_NNLIB_GRAPH_OP_AVGPOOL)
+      size = xa_nn_avgpool_getsize(p_ti->channels, 8, 8, p_ti->height, p_ti->width, p_op->kernel_height, p_op->kernel_width,
+          p_op->x_stride, p_op->y_stride, p_op->x_padding, p_op->y_padding, p_to->height, p_to->width, 0, 0);
+    else if(p_op->type == XA_NNLIB_GRAPH_OP_SOFTMAX)
+      size = get_softmax_scratch_size(PREC_ASYM8S, PREC_ASYM8S, p_ti->channels);
+    else
+      size = 0;
+    scratch_size = size > scratch_size ? size : scratch_size;
+  }
+  p_scratch = malloc(scratch_size + 16);
+
+  for(itr = 0; itr < N_OPS && err == 0; itr++)
+  {
+    const xa_nnlib_graph_op_desc_t *p_op = &p_ops[itr];
+    const xa_nnlib_graph_tensor_desc_t *p_ti = &p_tensors[p_op->input[0]], *p_to = &p_tensors[p_op->output];
+    const WORD8 *p_weight = p_const + p_op->weight_offset;
+    const WORD32 *p_bias = (const WORD32 *)(p_const + p_op->bias_offset);
+    const Flt32 *p_scales = (const Flt32 *)(p_const + p_op->weight_scale_offset);
+    void *p_scr = (void *)ALIGN_UP((unsigned long)p_scratch, 16);
+    int out_size = p_to->height * p_to->width * p_to->channels;
+    int in_size = p_ti->height * p_ti->width * p_ti->channels;
+    int act_min = -128, act_max = 127;
+
+    if(p_op->type == XA_NNLIB_GRAPH_OP_CONV2D || p_op->type == XA_NNLIB_GRAPH_OP_DEPTHWISE_CONV2D ||
+       p_op->type == XA_NNLIB_GRAPH_OP_POINTWISE_CONV2D)
+    {
+      for(ch = 0; ch < p_to->channels; ch++)
+        quantize_multiplier((double)p_ti->scale * p_scales[ch] / p_to->scale, &p_mult[ch], &p_shift[ch]);
+    }
+
+    switch(p_op->type)
+    {
+      case XA_NNLIB_GRAPH_OP_CONV2D:
+        err = xa_nn_conv2d_std_per_chan_sym8sxasym8s(p_tmp, p_data[p_op->input[0]], p_weight, p_bias,
+            p_ti->height, p_ti->width, p_ti->channels, p_op->kernel_height, p_op->kernel_width, p_to->channels,
+            p_op->x_stride, p_op->y_stride, p_op->x_padding, p_op->y_padding, p_to->height, p_to->width,
+            -p_ti->zero_point, p_mult, p_shift, p_to->zero_point, 0, p_scr);
+        break;
+      case XA_NNLIB_GRAPH_OP_DEPTHWISE_CONV2D:
+        err = xa_nn_conv2d_depthwise_per_chan_sym8sxasym8s(p_tmp, p_weight, p_data[p_op->input[0]], p_bias,
+            p_ti->height, p_ti->width, p_ti->channels, p_op->kernel_height, p_op->kernel_width, 1,
+            p_op->x_stride, p_op->y_stride, p_op->x_padding, p_op->y_padding, p_to->height, p_to->width,
+            -p_ti->zero_point, p_mult, p_shift, p_to->zero_point, 0, 0, p_scr);
+        break;
+      case XA_NNLIB_GRAPH_OP_POINTWISE_CONV2D:
+        err = xa_nn_conv2d_pointwise_per_chan_sym8sxasym8s(p_tmp, (WORD8 *)p_weight, p_data[p_op->input[0]], (WORD32 *)p_bias,
+            p_ti->height, p_ti->width, p_ti->channels, p_to->channels,
+            -p_ti->zero_point, p_mult, p_shift, p_to->zero_point, 0);
+        break;
+      case XA_NNLIB_GRAPH_OP_FULLY_CONNECTED:
+        quantize_multiplier((double)p_ti->scale * p_scales[0] / p_to->scale, &p_mult[0], &p_shift[0]);
+        err = xa_nn_fully_connected_sym8sxasym8s_asym8s(p_tmp, p_weight, p_data[p_op->input[0]], p_bias,
+            in_size, out_size, -p_ti->zero_point, p_mult[0], p_shift[0], p_to->zero_point);
+        break;
+      case XA_NNLIB_GRAPH_OP_AVGPOOL:
+        err = xa_nn_avgpool_8(p_tmp, p_data[p_op->input[0]], p_ti->height, p_ti->width, p_ti->channels,
+            p_op->kernel_height, p_op->kernel_width, p_op->x_stride, p_op->y_stride,
+            p_op->x_padding, p_op->y_padding, p_to->height, p_to->width, 0, 0, p_scr);
+        break;
+      case XA_NNLIB_GRAPH_OP_ADD:
+      {
+        const xa_nnlib_graph_tensor_desc_t *p_ti2 = &p_tensors[p_op->input[1]];
+        double twice_max_scale = 2.0 * (p_ti->scale > p_ti2->scale ? p_ti->scale : p_ti2->scale);
+
+        quantize_multiplier(p_ti->scale / twice_max_scale, &p_mult[0], &p_shift[0]);
+        quantize_multiplier(p_ti2->scale / twice_max_scale, &p_mult[1], &p_shift[1]);
+        quantize_multiplier(twice_max_scale / ((1 << ADD_LEFT_SHIFT) * (double)p_to->scale), &p_mult[2], &p_shift[2]);
+        err = xa_nn_elm_add_asym8sxasym8s_asym8s(p_tmp, p_to->zero_point, p_shift[2], p_mult[2], -128, 127,
+            p_data[p_op->input[0]], -p_ti->zero_point, p_shift[0], p_mult[0],
+            p_data[p_op->input[1]], -p_ti2->zero_point, p_shift[1], p_mult[1], ADD_LEFT_SHIFT, out_size);
+        break;
+      }
+      case XA_NNLIB_GRAPH_OP_SOFTMAX:
+      {
+        double beta_real = (double)p_op->beta * p_ti->scale * (double)(1 << (31 - SOFTMAX_INPUT_INT_BITS));
+        double max_input_rescaled;
+
+        beta_real = beta_real < 2147483647.0 ? beta_real : 2147483647.0;
+        quantize_multiplier(beta_real, &p_mult[0], &p_shift[0]);
+        max_input_rescaled = (double)((1 << SOFTMAX_INPUT_INT_BITS) - 1) *
+                             (double)(1LL << (31 - SOFTMAX_INPUT_INT_BITS)) / (double)(1LL << p_shift[0]);
+        for(row = 0; row < p_to->height * p_to->width && err == 0; row++)
+        {
+          err = xa_nn_vec_softmax_asym8s_asym8s(p_tmp + row * p_to->channels, p_data[p_op->input[0]] + row * p_to->channels,
+              -(int)floor(max_input_rescaled), p_shift[0], p_mult[0], p_to->channels, p_scr);
+        }
+        break;
+      }
+      default:
+        break;
+    }
+
+    if(p_op->activation == XA_NNLIB_GRAPH_ACT_RELU || p_op->activation == XA_NNLIB_GRAPH_ACT_RELU6)
+    {
+      act_min = p_to->zero_point > act_min ? p_to->zero_point : act_min;
+    }
+    if(p_op->activation == XA_NNLIB_GRAPH_ACT_RELU6)
+    {
+      int six = p_to->zero_point + (int)floor(6.0 / p_to->scale + 0.5);
+      act_max = six < act_max ? six : act_max;
+    }
+    if(err == 0)
+      err = xa_nn_vec_activation_min_max_8_8(p_data[p_op->output], p_tmp, act_min, act_max, out_size);
+  }
+
+  memcpy(p_out, p_data[p_header->output_tensor], N_CLASSES);
+
+  free(p_scratch);
+  free(p_mult);
+  free(p_tmp);
+  for(itr = 0; itr < N_TENSORS; itr++)
+  {
+    free(p_data[itr]);
+  }
+  return err;
+}
+
+int xa_nn_main_process(int argc, char *argv[])
+{
+  test_config_t cfg;
+  char profiler_name[MAX_PROFILER_NAME_LENGTH];
+  char profiler_params[MAX_PROFILER_PARAMS_LENGTH];
+  WORD8 *p_graph, *p_inp, *p_out, *p_out_ref;
+  xa_nnlib_handle_t graph_handle;
+  void *p_scratch;
+  int graph_size, persistent_size, scratch_size, max_graph_size;
+  int err, frame, itr, pass_count = 0;
+
+  if(default_config(&cfg))
+  {
+    return -1;
+  }
+
+  parse_arguments(argc, argv, &cfg);
+  if(cfg.help)
+  {
+    show_usage();
+    return 0;
+  }
+
+  max_graph_size = sizeof(xa_nnlib_graph_header_t) + N_TENSORS * sizeof(xa_nnlib_graph_tensor_desc_t) +
+                   N_OPS * sizeof(xa_nnlib_graph_op_desc_t) +
+                   cfg.channels * (40 + 2 * 9 + 2 * cfg.channels + N_CLASSES) + N_OPS * 4 +
+                   (5 * cfg.channels + N_CLASSES) * 8 + 4;
+  p_graph = (WORD8 *)malloc(max_graph_size);
+  p_inp = (WORD8 *)malloc(cfg.input_height * cfg.input_width);
+  p_out = (WORD8 *)malloc(N_CLASSES);
+  p_out_ref = (WORD8 *)malloc(N_CLASSES);
+  if(p_graph == NULL || p_inp == NULL || p_out == NULL || p_out_ref == NULL)
+  {
+    printf("[Error] Memory allocation failed\n");
+    return -1;
+  }
+
+  srand(1);
+  graph_size = build_graph(p_graph, &cfg);
+
+  /* Prepare: validation, quantization parameters and arena plan */
+  persistent_size = xa_nnlib_graph_get_persistent_fast(p_graph, graph_size);
+  if(persistent_size < 0)
+  {
+    printf("[Error] xa_nnlib_graph_get_persistent_fast returned 0x%x\n", persistent_size);
+    return -1;
+  }
+  graph_handle = (xa_nnlib_handle_t)malloc(persistent_size);
+  if(graph_handle == NULL)
+  {
+    printf("[Error] Memory allocation failed\n");
+    return -1;
+  }
+  err = xa_nnlib_graph_init(graph_handle, p_graph, graph_size);
+  if(err != XA_NNLIB_NO_ERROR)
+  {
+    printf("[Error] xa_nnlib_graph_init returned 0x%x\n", err);
+    return -1;
+  }
+  scratch_size = xa_nnlib_graph_get_scratch(graph_handle);
+  p_scratch = malloc(scratch_size + 16);
+  if(p_scratch == NULL)
+  {
+    printf("[Error] Memory allocation failed\n");
+    return -1;
+  }
+
+  printf("graph: %d bytes, persistent: %d bytes, scratch: %d bytes\n", graph_size, persistent_size, scratch_size);
+
+  strcpy(profiler_name, "graph_dscnn_8x8");
+  sprintf(profiler_params, "input_height=%d, input_width=%d, channels=%d, classes=%d",
+      cfg.input_height, cfg.input_width, cfg.channels, N_CLASSES);
+  XTPWR_PROFILER_OPEN(0, profiler_name, profiler_params, 1, NULL, 0);
+
+  for(itr = 0; itr < cfg.input_height * cfg.input_width; itr++)
+  {
+    p_inp[itr] = (WORD8)((rand() % 255) - 127);
+  }
+
+  if(cfg.verify && run_reference(p_graph, p_inp, p_out_ref) != 0)
+  {
+    printf("[Error] reference run failed\n");
+    return -1;
+  }
+
+  for(frame = 0; frame < cfg.frames; frame++)
+  {
+    int pass = 1;
+
+    XTPWR_PROFILER_START(0);
+    err = xa_nnlib_graph_process(graph_handle, (void *)ALIGN_UP((unsigned long)p_scratch, 16), p_inp, p_out);
+    XTPWR_PROFILER_STOP(0);
+
+    if(err != XA_NNLIB_NO_ERROR)
+    {
+      printf("[Error] xa_nnlib_graph_process returned 0x%x\n", err);
+      pass = 0;
+    }
+
+    XTPWR_PROFILER_UPDATE(0);
+    XTPWR_PROFILER_PRINT(0);
+
+    if(cfg.verify && pass)
+    {
+      pass = (memcmp(p_out_ref, p_out, N_CLASSES) == 0);
+    }
+    pass_count += pass;
+  }
+
+  XTPWR_PROFILER_CLOSE(0, (pass_count == cfg.frames), cfg.verify);
+
+  fprintf(stdout, "\ngraph: %s\n", (pass_count == cfg.frames) ? "PASS" : "FAIL");
+
+  free(p_scratch);
+  free(graph_handle);
+  free(p_out_ref);
+  free(p_out);
+  free(p_inp);
+  free(p_graph);
+
+  return 0;
+}
+
+int main (int argc, char *argv[])
+{
+  int i;
+
+  for(i = 1; i < argc; i++)
+  {
+    fprintf(stdout, "%s ", argv[i]);
+  }
+  fprintf(stdout, "\n");
+
+  return xa_nn_main_process(argc, argv);
+}
@@ -22,6 +22,7 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <math.h>
 #include <time.h>
 #include <xtensa/config/core-isa.h>
 #include "xa_type_def.h"
@@ -41,7 +42,7 @@
 #define NUM_DIMS  5
 #define SHAPE_ARGS_LENGTH 80
 #define XA_MAX_CMD_LINE_LENGTH 1000
-#define XA_MAX_ARGS 40
+#define XA_MAX_ARGS 100
 #define PARAMFILE "paramfilesimple_matXvec.txt"
 
 #define VALIDATE_PTR(ptr) if(NULL == ptr) { printf("%s: allocation failed\n", #ptr); return -1;}
@@ -92,9 +93,27 @@ typedef struct _test_config_t
   int verify;
   int batch;
   int v2;        
+  int dma;
   int fc;
   int matmul;
   int batch_matmul;
+  int res_zero_bias;
+  int res_multiplier;
+  int res_shift;
+  int f32io;
+  int softmax;
+  int diffmin;
+  int input_left_shift;
+  int input_multiplier;
+  int attention;
+  int num_heads;
+  int num_kv_heads;
+  int block_size;
+  int causal;
+  int score_multiplier;
+  int score_shift;
+  int rope_interleaved;
+  int rope_pos_offset;
 }test_config_t;
 
 int default_config(test_config_t *p_cfg)
@@ -139,9 +158,27 @@ int default_config(test_config_t *p_cfg)
     p_cfg->verify = 1;
     p_cfg->batch = 0;
     p_cfg->v2 = 0;                
+    p_cfg->dma = 0;
     p_cfg->fc = 0;
     p_cfg->matmul = 0;
     p_cfg->batch_matmul = 0;
+    p_cfg->res_zero_bias = 0;
+    p_cfg->res_multiplier = 0;
+    p_cfg->res_shift = 0;
+    p_cfg->f32io = 0;
+    p_cfg->softmax = 0;
+    p_cfg->diffmin = -15;
+    p_cfg->input_left_shift = 27;
+    p_cfg->input_multiplier = 2060158080;
+    p_cfg->attention = 0;
+    p_cfg->num_heads = 1;
+    p_cfg->num_kv_heads = 1;
+    p_cfg->block_size = 16;
+    p_cfg->causal = 0;
+    p_cfg->score_multiplier = 0x40000000;
+    p_cfg->score_shift = -6;
+    p_cfg->rope_interleaved = 0;
+    p_cfg->rope_pos_offset = 0;
 
     int itr;
     for(itr = 0; itr < NUM_DIMS; itr++)
@@ -192,10 +229,22 @@ void show_usage(void)
     printf("\t-write_out_file_name: Full filename for writing output \n");
     printf("\t-verify: Verify output against provided reference; 0: Disable, 1: Bitexact match; Default=1\n");
     printf("\t-batch: Flag to check time batching; 0: Disable, 1: Enable; Default=0\n");
-    printf("\t-v2: Flag for v2 kernels; 0: Disable, 1: Enable; Default=0\n");                                                                                                                   
+    printf("\t-v2: Flag for v2 kernels; 0: Disable, 1: Enable; Default=0\n");
+    printf("\t-dma: Size in bytes of each local ping-pong buffer used by v2 kernels to stream weights through a memcpy based DMA config; 0: Disable; Default=0\n");                                                                                                                   
     printf("\t-matmul: Flag for matmul, only xa_nn_matmul_asym8sxasym8s_asym8s; 0: Disable, 1: Enable; Default=0\n");
     printf("\t-fc: Flag for fully connected; 0: Disable, 1: Enable; Default=0\n");
-    printf("\t-batch_matmul: Flag for batch_matmul, xa_nn_batch_matmul_[asym8sxasym8s_asym8s|sym16sxsym16s_sym16s]; 0: Disable, 1: Enable; Default=0\n");
+    printf("\t-res_multiplier: Residual add after fully connected v2 asym8s; 0: No residual; Default=0\n");
+    printf("\t-res_zero_bias, -res_shift: Residual zero bias and shift; Default=0\n");
+    printf("\t-f32io: f32 input quantized inside fully connected v2 asym8s; 0: Disable, 1: Enable with asym8s output, 2: Enable with f32 output, checked against the dequantized asym8s output; Default=0\n");
+    printf("\t-softmax: Fused softmax head with top-1 after fully connected v2 asym8s, output is the asym8s softmax; 0: Disable, 1: Enable; Default=0\n");
+    printf("\t-diffmin, -input_left_shift, -input_multiplier: Softmax parameters with -softmax or -attention; Default=-15, 27, 2060158080\n");
+    printf("\t-attention: Flag for xa_nn_attention_[asym8s|sym16s], q_len=rows, kv_len=vec_count, head_dim=cols1; zero biases are mat1 (Q), mat2 (K), inp1 (V), V is read transposed (head_dim x kv_len per kv head) with -attention 1; 0: Disable, 1: Enable, 2: KV-cache decode of rows steps into a cache of vec_count steps; Default=0\n");
+    printf("\t-num_heads, -num_kv_heads: Query and key/value heads with -attention; Default=1, 1\n");
+    printf("\t-block_size: Query and key rows per block with -attention; Default=16\n");
+    printf("\t-causal: Causal mask with -attention; 0: Disable, 1: Enable; Default=0\n");
+    printf("\t-score_multiplier, -score_shift: Requantization of Q.K^T scores with -attention; Default=0x40000000, -6\n");
+    printf("\t-batch_matmul: Flag for batch_matmul, xa_nn_batch_matmul_[asym8sxasym8s_asym8s|sym16sxsym16s_sym16s]; 0: Disable, 1: Enable, 2: xa_nn_batch_matmul_rope_sym16sxsym16s_sym16s, checked against batch_matmul followed by xa_nn_rope_sym16s_sym16s; Default=0\n");
+    printf("\t-rope_interleaved, -rope_pos_offset: RoPE pairs (1: (2k, 2k+1), 0: (k, k+head_dim/2)) and position of the first output row with -batch_matmul 2; Default=0, 0\n");
     printf("\t-mat1_shape: Takes the matrix 1 shape dimensions (%d values space ' ' separated) for batch_matmul \n", NUM_DIMS);
     printf("\t-inp1_shape: Takes the input 1 or matrix 2 shape dimensions (%d values space ' ' separated) for batch_matmul \n", NUM_DIMS);
     printf("\t-out_shape: Takes the output shape dimensions (%d values space ' ' separated) for batch_matmul \n", NUM_DIMS);
@@ -249,9 +298,27 @@ void parse_arguments(int argc, char** argv, test_config_t *p_cfg)
     ARGTYPE_ONETIME_CONFIG("-verify",p_cfg->verify);
     ARGTYPE_ONETIME_CONFIG("-batch",p_cfg->batch);
     ARGTYPE_ONETIME_CONFIG("-v2",p_cfg->v2)                                          
+    ARGTYPE_ONETIME_CONFIG("-dma",p_cfg->dma);
     ARGTYPE_ONETIME_CONFIG("-fc",p_cfg->fc);
     ARGTYPE_ONETIME_CONFIG("-matmul",p_cfg->matmul);
     ARGTYPE_ONETIME_CONFIG("-batch_matmul",p_cfg->batch_matmul);
+    ARGTYPE_ONETIME_CONFIG("-res_zero_bias",p_cfg->res_zero_bias);
+    ARGTYPE_ONETIME_CONFIG("-res_multiplier",p_cfg->res_multiplier);
+    ARGTYPE_ONETIME_CONFIG("-res_shift",p_cfg->res_shift);
+    ARGTYPE_ONETIME_CONFIG("-f32io",p_cfg->f32io);
+    ARGTYPE_ONETIME_CONFIG("-softmax",p_cfg->softmax);
+    ARGTYPE_ONETIME_CONFIG("-diffmin",p_cfg->diffmin);
+    ARGTYPE_ONETIME_CONFIG("-input_left_shift",p_cfg->input_left_shift);
+    ARGTYPE_ONETIME_CONFIG("-input_multiplier",p_cfg->input_multiplier);
+    ARGTYPE_ONETIME_CONFIG("-attention",p_cfg->attention);
+    ARGTYPE_ONETIME_CONFIG("-num_heads",p_cfg->num_heads);
+    ARGTYPE_ONETIME_CONFIG("-num_kv_heads",p_cfg->num_kv_heads);
+    ARGTYPE_ONETIME_CONFIG("-block_size",p_cfg->block_size);
+    ARGTYPE_ONETIME_CONFIG("-causal",p_cfg->causal);
+    ARGTYPE_ONETIME_CONFIG("-score_multiplier",p_cfg->score_multiplier);
+    ARGTYPE_ONETIME_CONFIG("-score_shift",p_cfg->score_shift);
+    ARGTYPE_ONETIME_CONFIG("-rope_interleaved",p_cfg->rope_interleaved);
+    ARGTYPE_ONETIME_CONFIG("-rope_pos_offset",p_cfg->rope_pos_offset);
     ARGTYPE_ONETIME_CONFIG("-mat1_transpose",p_cfg->mat1_transpose);
     ARGTYPE_ONETIME_CONFIG("-inp1_transpose",p_cfg->inp1_transpose);
 
@@ -271,18 +338,38 @@ void parse_arguments(int argc, char** argv, test_config_t *p_cfg)
       err = xa_nn_fully_connected_v2_sym8sxsym16s_sym16s ( \
           (WORD16 *)p_out->p, (WORD8 *) p_mat1->p, (WORD16 *)p_vec1->p, (WORD64 *)p_bias->p, \
           cfg.cols1, cfg.rows, \
-          cfg.out_multiplier, cfg.out_shift, -32768, 32767, NULL);\
+          cfg.out_multiplier, cfg.out_shift, -32768, 32767, p_dma_cfg);\
       XTPWR_PROFILER_STOP(0);\
     }
 
 #define MAT_VEC_MUL_FC_FAST_FN_ASYM8S(MPREC, VPREC, OPREC) \
     if((MPREC == p_mat1->precision) && (VPREC == p_vec1->precision) && (OPREC == p_out->precision)) {\
       XTPWR_PROFILER_START(0);\
-      err = xa_nn_fully_connected_v2_asym8sxasym8s_asym8s ( \
-          (WORD8 *)p_out->p, (WORD8 *) p_mat1->p, (WORD8 *)p_vec1->p, (WORD32 *)p_bias->p, \
-          cfg.cols1, cfg.rows, \
-          cfg.mat1_zero_bias, cfg.inp1_zero_bias, \
-          cfg.out_multiplier, cfg.out_shift, cfg.out_zero_bias, -128, 127, NULL);\
+      if(p_softmax_scratch != NULL)\
+        err = xa_nn_fully_connected_v2_softmax_asym8sxasym8s ( \
+            p_out->p, &top1, (WORD8 *) p_mat1->p, (WORD8 *)p_vec1->p, (WORD32 *)p_bias->p, \
+            cfg.cols1, cfg.rows, \
+            cfg.mat1_zero_bias, cfg.inp1_zero_bias, \
+            cfg.out_multiplier, cfg.out_shift, cfg.out_zero_bias, \
+            cfg.diffmin, cfg.input_left_shift, cfg.input_multiplier, PREC_ASYM8S, p_softmax_scratch->p, p_dma_cfg);\
+      else if(p_io_cfg != NULL)\
+        err = xa_nn_fully_connected_v2_f32io_asym8sxasym8s_asym8s ( \
+            p_io_cfg->out_f32 ? p_out_f32->p : p_out->p, (WORD8 *) p_mat1->p, (FLOAT32 *)p_vec1_f32->p, (WORD32 *)p_bias->p, \
+            cfg.cols1, cfg.rows, \
+            cfg.mat1_zero_bias, cfg.inp1_zero_bias, \
+            cfg.out_multiplier, cfg.out_shift, cfg.out_zero_bias, -128, 127, p_io_cfg, p_io_scratch->p, p_dma_cfg);\
+      else if(p_res_cfg != NULL)\
+        err = xa_nn_fully_connected_v2_residual_asym8sxasym8s_asym8s ( \
+            (WORD8 *)p_out->p, (WORD8 *) p_mat1->p, (WORD8 *)p_vec1->p, (WORD32 *)p_bias->p, \
+            cfg.cols1, cfg.rows, \
+            cfg.mat1_zero_bias, cfg.inp1_zero_bias, \
+            cfg.out_multiplier, cfg.out_shift, cfg.out_zero_bias, -128, 127, p_res_cfg, p_dma_cfg);\
+      else\
+        err = xa_nn_fully_connected_v2_asym8sxasym8s_asym8s ( \
+            (WORD8 *)p_out->p, (WORD8 *) p_mat1->p, (WORD8 *)p_vec1->p, (WORD32 *)p_bias->p, \
+            cfg.cols1, cfg.rows, \
+            cfg.mat1_zero_bias, cfg.inp1_zero_bias, \
+            cfg.out_multiplier, cfg.out_shift, cfg.out_zero_bias, -128, 127, p_dma_cfg);\
       XTPWR_PROFILER_STOP(0);\
     }
 
@@ -292,7 +379,7 @@ void parse_arguments(int argc, char** argv, test_config_t *p_cfg)
       err = xa_nn_matXvec_v2_asym8sxasym8s_asym8s ( \
           (WORD8 *)p_out->p, (WORD8 *) p_mat1->p, (WORD8 *)p_vec1->p, (WORD32 *)p_bias->p, \
           cfg.rows, cfg.cols1, p_mat1->row_offset, \
-          cfg.mat1_zero_bias, cfg.inp1_zero_bias, cfg.out_multiplier, cfg.out_shift, cfg.out_zero_bias, -128, 127, NULL);\
+          cfg.mat1_zero_bias, cfg.inp1_zero_bias, cfg.out_multiplier, cfg.out_shift, cfg.out_zero_bias, -128, 127, p_dma_cfg);\
       XTPWR_PROFILER_STOP(0);\
     }
 
@@ -302,7 +389,7 @@ void parse_arguments(int argc, char** argv, test_config_t *p_cfg)
       err = xa_nn_matXvec_v2_sym8sxsym16s_sym16s ( \
           (WORD16 *)p_out->p, (WORD8 *) p_mat1->p, (WORD16 *)p_vec1->p, (WORD64 *)p_bias->p, \
           cfg.rows, cfg.cols1, p_mat1->row_offset, \
-          cfg.out_multiplier, cfg.out_shift, -32768, 32767, NULL);\
+          cfg.out_multiplier, cfg.out_shift, -32768, 32767, p_dma_cfg);\
       XTPWR_PROFILER_STOP(0);\
     }
     
@@ -661,6 +748,30 @@ void parse_arguments(int argc, char** argv, test_config_t *p_cfg)
       XTPWR_PROFILER_STOP(0); \
     }
 
+#define BATCH_MATMUL_ROPE_FN_SYM16S(MPREC, VPREC, OPREC) \
+    if((MPREC == p_mat1->precision) && (VPREC == p_vec1->precision) && (OPREC == p_out->precision)) { \
+      XTPWR_PROFILER_START(0); \
+      err = xa_nn_batch_matmul_rope_sym16sxsym16s_sym16s( \
+                (WORD16 *)p_out->p, (WORD32 *)cfg.out_shape, \
+                (WORD16 *)p_mat1->p, (WORD32 *)cfg.mat1_shape, \
+                (WORD16 *)p_vec1->p, (WORD32 *)cfg.inp1_shape, \
+                cfg.mat1_transpose, cfg.inp1_transpose, \
+                cfg.mat1_zero_bias, cfg.inp1_zero_bias, \
+                cfg.out_multiplier, cfg.out_shift, \
+                cfg.out_zero_bias, &rope_cfg, p_scratch->p); \
+      XTPWR_PROFILER_STOP(0); \
+    }
+
+#define ATTENTION_FN(PREC, TYPE) \
+    if((PREC == p_mat1->precision) && (PREC == p_vec1->precision) && (PREC == p_out->precision)) { \
+      XTPWR_PROFILER_START(0); \
+      err = xa_nn_attention_##TYPE( \
+                (void *)p_out->p, (void *)p_mat1->p, (void *)p_vec1->p, (void *)p_vec2->p, \
+                cfg.num_heads, cfg.num_kv_heads, cfg.rows, cfg.vec_count, cfg.cols1, \
+                &attn_params, p_scratch->p); \
+      XTPWR_PROFILER_STOP(0); \
+    }
+
 #if HIFI_VFPU 
 #define PROCESS_MATXVEC \
     MAT_VEC_MUL_ACTIVATION_FN(16, 16, 16, sigmoid) \
@@ -832,6 +943,40 @@ void parse_arguments(int argc, char** argv, test_config_t *p_cfg)
     else BATCH_MATMUL_FN_SYM16S(-8, -8, -8) \
     else { printf("unsupported multiplication\n"); return -1;}
 
+#define PROCESS_BATCH_MATMUL_ROPE \
+    BATCH_MATMUL_ROPE_FN_SYM16S(-8, -8, -8) \
+    else { printf("unsupported multiplication\n"); return -1;}
+
+/* One step is appended and attended per query row */
+#define KV_CACHE_FN(PREC, TYPE, CTYPE) \
+    if((PREC == p_mat1->precision) && (PREC == p_vec1->precision) && (PREC == p_out->precision)) { \
+      int step; \
+      kv_cache.start = 0; \
+      kv_cache.len = 0; \
+      XTPWR_PROFILER_START(0); \
+      for(step = 0; step < cfg.rows && !err; step++) { \
+        err = xa_nn_kv_cache_append_##TYPE(&kv_cache, \
+                  &((CTYPE *)p_vec1->p)[step * cfg.num_kv_heads * cfg.cols1], \
+                  &((CTYPE *)p_vec2->p)[step * cfg.num_kv_heads * cfg.cols1], 1); \
+        if(!err) \
+          err = xa_nn_kv_cache_attend_##TYPE( \
+                  &((CTYPE *)p_out->p)[step * cfg.num_heads * cfg.cols1], \
+                  &((CTYPE *)p_mat1->p)[step * cfg.num_heads * cfg.cols1], \
+                  &kv_cache, cfg.num_heads, &attn_params, p_scratch->p); \
+      } \
+      XTPWR_PROFILER_STOP(0); \
+    }
+
+#define PROCESS_KV_CACHE \
+    KV_CACHE_FN(-4, asym8s, WORD8) \
+    else KV_CACHE_FN(-8, sym16s, WORD16) \
+    else { printf("unsupported kv cache\n"); return -1;}
+
+#define PROCESS_ATTENTION \
+    ATTENTION_FN(-4, asym8s) \
+    else ATTENTION_FN(-8, sym16s) \
+    else { printf("unsupported attention\n"); return -1;}
+
 #define PROCESS_MATXVEC_V2 \
     MAT_VEC_FAST_MUL_FN_SYM8S_SYM16S(-5, -8, -8) \
     else MAT_VEC_FAST_MUL_FN_ASYM8S(-4, -4, -4) \
@@ -842,6 +987,335 @@ void parse_arguments(int argc, char** argv, test_config_t *p_cfg)
     else MAT_VEC_MUL_FC_FAST_FN_SYM8SXSYM16S(-5, -8, -8) \
     else { printf("unsupported multiplication\n"); return -1;}
 
+/* Replays the -attention 2 decode with xa_nn_attention_* on a linear copy of
+ * the steps cached after each append, the outputs must be bit-exact */
+static int check_kv_cache_attend(const test_config_t *p_cfg, const void *p_out,
+    const void *p_q, const void *p_k, const void *p_v,
+    const xa_nn_attention_params_t *p_params)
+{
+  int elm_size = (p_cfg->out_precision == -8) ? 2 : 1;
+  int row = p_cfg->cols1 * elm_size;
+  int q_step = p_cfg->num_heads * row;
+  int kv_step = p_cfg->num_kv_heads * row;
+  int cap = p_cfg->vec_count;
+  buf1D_t *p_lin_k, *p_lin_v, *p_ref, *p_scr;
+  int step, h, t, d, err = 0, pass = 1;
+
+  p_lin_k = create_buf1D(p_cfg->num_kv_heads * cap * p_cfg->cols1, p_cfg->inp_precision);
+  p_lin_v = create_buf1D(p_cfg->num_kv_heads * cap * p_cfg->cols1, p_cfg->inp_precision);
+  p_ref = create_buf1D(p_cfg->num_heads * p_cfg->cols1, p_cfg->out_precision);
+  p_scr = create_buf1D(xa_nn_attention_getsize(p_cfg->cols1, p_cfg->block_size, p_cfg->mat_precision), 8);
+  if(p_lin_k == NULL || p_lin_v == NULL || p_ref == NULL || p_scr == NULL)
+  {
+    if(p_lin_k) free_buf1D(p_lin_k);
+    if(p_lin_v) free_buf1D(p_lin_v);
+    if(p_ref) free_buf1D(p_ref);
+    if(p_scr) free_buf1D(p_scr);
+    return 0;
+  }
+
+  for(step = 0; step < p_cfg->rows && pass; step++)
+  {
+    /* The cache holds the last min(step + 1, capacity) steps */
+    int first = (step + 1 > cap) ? step + 1 - cap : 0;
+    int len = step + 1 - first;
+
+    for(h = 0; h < p_cfg->num_kv_heads; h++)
+    {
+      for(t = 0; t < len; t++)
+      {
+        memcpy(&((char *)p_lin_k->p)[(h * len + t) * row], &((const char *)p_k)[(first + t) * kv_step + h * row], row);
+        /* xa_nn_attention_* takes V transposed, head_dim x len per kv head */
+        for(d = 0; d < p_cfg->cols1; d++)
+          memcpy(&((char *)p_lin_v->p)[((h * p_cfg->cols1 + d) * len + t) * elm_size],
+              &((const char *)p_v)[(first + t) * kv_step + h * row + d * elm_size], elm_size);
+      }
+    }
+
+    if(p_cfg->out_precision == -8)
+      err = xa_nn_attention_sym16s((WORD16 *)p_ref->p, (const WORD16 *)&((const char *)p_q)[step * q_step],
+          (WORD16 *)p_lin_k->p, (WORD16 *)p_lin_v->p, p_cfg->num_heads, p_cfg->num_kv_heads, 1, len,
+          p_cfg->cols1, p_params, p_scr->p);
+    else
+      err = xa_nn_attention_asym8s((WORD8 *)p_ref->p, (const WORD8 *)&((const char *)p_q)[step * q_step],
+          (WORD8 *)p_lin_k->p, (WORD8 *)p_lin_v->p, p_cfg->num_heads, p_cfg->num_kv_heads, 1, len,
+          p_cfg->cols1, p_params, p_scr->p);
+
+    if(err || memcmp(p_ref->p, &((const char *)p_out)[step * q_step], q_step))
+    {
+      printf("KV cache mismatch at step %d against xa_nn_attention\n", step);
+      pass = 0;
+    }
+  }
+
+  free_buf1D(p_lin_k);
+  free_buf1D(p_lin_v);
+  free_buf1D(p_ref);
+  free_buf1D(p_scr);
+  return pass;
+}
+
+/* Recomputes -attention 1 asym8s unfused: Q.K^T scores with batch_matmul,
+ * xa_nn_vec_softmax_asym8s_16 over the unmasked keys of each query row and a
+ * matXvec of the weights with V^T. The fused kernel keeps Q15 weights
+ * rescaled per key block, so the outputs must match within 2 LSB. sym16s is
+ * not checked as xa_nn_vec_softmax_sym16s_16 has no diffmin and a different
+ * exp than the sym16s attention weights. */
+static int check_attention_asym8s(const test_config_t *p_cfg, const WORD8 *p_out,
+    const WORD8 *p_q, const WORD8 *p_k, const WORD8 *p_vt,
+    const xa_nn_attention_params_t *p_params)
+{
+  int heads_per_kv = p_cfg->num_heads / p_cfg->num_kv_heads;
+  int q_len = p_cfg->rows;
+  int kv_len = p_cfg->vec_count;
+  int head_dim = p_cfg->cols1;
+  int causal_off = kv_len - q_len;
+  WORD32 k_shape[5] = {1, p_cfg->num_kv_heads, 1, kv_len, head_dim};
+  WORD32 q_shape[5] = {1, p_cfg->num_kv_heads, heads_per_kv, q_len, head_dim};
+  WORD32 s_shape[5] = {1, p_cfg->num_kv_heads, heads_per_kv, q_len, kv_len};
+  int mm_size = xa_nn_batch_matmul_getsize(k_shape, q_shape, 0, 0, PREC_ASYM8S, PREC_ASYM8S);
+  buf1D_t *p_scores, *p_prob, *p_pv, *p_zero, *p_mm_scr, *p_sm_scr;
+  int h, i, t, dd, n_valid, out, diff, err, pass = 1;
+
+  p_scores = create_buf1D(p_cfg->num_heads * q_len * kv_len, -4);
+  p_prob = create_buf1D(kv_len, 16);
+  p_pv = create_buf1D(head_dim, 32);
+  p_zero = create_buf1D(head_dim, 16);
+  p_mm_scr = create_buf1D(mm_size > 0 ? mm_size : 1, 8);
+  p_sm_scr = create_buf1D(get_softmax_scratch_size(PREC_ASYM8S, PREC_16, kv_len), 8);
+  if(p_scores == NULL || p_prob == NULL || p_pv == NULL || p_zero == NULL || p_mm_scr == NULL || p_sm_scr == NULL)
+  {
+    if(p_scores) free_buf1D(p_scores);
+    if(p_prob) free_buf1D(p_prob);
+    if(p_pv) free_buf1D(p_pv);
+    if(p_zero) free_buf1D(p_zero);
+    if(p_mm_scr) free_buf1D(p_mm_scr);
+    if(p_sm_scr) free_buf1D(p_sm_scr);
+    return 0;
+  }
+  memset(p_zero->p, 0, head_dim * sizeof(WORD16));
+
+  /* K broadcasts over the heads sharing it, scores are num_heads x q_len x kv_len */
+  err = xa_nn_batch_matmul_asym8sxasym8s_asym8s((WORD8 *)p_scores->p, s_shape, p_k, k_shape, p_q, q_shape,
+      0, 0, p_params->k_zero_bias, p_params->q_zero_bias,
+      p_params->score_multiplier, p_params->score_shift, p_params->score_zero_bias, p_mm_scr->p);
+
+  for(h = 0; h < p_cfg->num_heads && !err && pass; h++)
+  {
+    const WORD8 *p_vt_h = &p_vt[(h / heads_per_kv) * head_dim * kv_len];
+    for(i = 0; i < q_len && !err && pass; i++)
+    {
+      const WORD8 *p_out_r = &p_out[(h * q_len + i) * head_dim];
+      WORD16 *p_w = (WORD16 *)p_prob->p;
+      WORD32 *p_acc = (WORD32 *)p_pv->p;
+      WORD32 sum_w = 0;
+
+      n_valid = p_params->causal ? (i + causal_off + 1 < kv_len ? i + causal_off + 1 : kv_len) : kv_len;
+      if(n_valid > 0)
+      {
+        err = xa_nn_vec_softmax_asym8s_16(p_w, &((WORD8 *)p_scores->p)[(h * q_len + i) * kv_len],
+            p_params->diffmin, p_params->input_beta_left_shift, p_params->input_beta_multiplier,
+            n_valid, p_sm_scr->p);
+        /* The softmax output is offset by -32768, halved to Q15 matXvec weights */
+        for(t = 0; t < n_valid; t++)
+        {
+          p_w[t] = (WORD16)((p_w[t] + 32768) >> 1);
+          sum_w += p_w[t];
+        }
+        if(!err)
+          err = xa_nn_matXvec_8x16_32(p_acc, (WORD8 *)p_vt_h, NULL, p_w, NULL, (WORD16 *)p_zero->p,
+              head_dim, n_valid, 0, kv_len, 0, 0, 0);
+      }
+
+      for(dd = 0; dd < head_dim && !err; dd++)
+      {
+        if(sum_w > 0)
+        {
+          /* Mean of V + v_zero_bias, requantized with out_multiplier and out_shift */
+          double mean = ((double)p_acc[dd] + (double)p_params->v_zero_bias * sum_w) / sum_w;
+          double ref = mean * p_params->out_multiplier / 2147483648.0 * pow(2.0, p_params->out_shift);
+          out = (int)floor(ref + 0.5) + p_params->out_zero_bias;
+        }
+        else
+        {
+          out = p_params->out_zero_bias;
+        }
+        out = out < -128 ? -128 : (out > 127 ? 127 : out);
+        diff = p_out_r[dd] - out;
+        if(diff < -2 || diff > 2)
+        {
+          printf("Attention mismatch at head %d row %d col %d against softmax and matXvec\n", h, i, dd);
+          pass = 0;
+          break;
+        }
+      }
+    }
+  }
+
+  free_buf1D(p_scores);
+  free_buf1D(p_prob);
+  free_buf1D(p_pv);
+  free_buf1D(p_zero);
+  free_buf1D(p_mm_scr);
+  free_buf1D(p_sm_scr);
+  return pass && !err;
+}
+
+/* The FC _v2_residual_ kernel saturates the FC result to int8 and then adds
+ * the rescaled residual, so it must match the plain v2 kernel followed by
+ * xa_nn_elm_add_asym8sxasym8s_asym8s to within one step. The elm_add
+ * reference needs res_shift <= 0. */
+static int check_residual_fc_asym8s(const test_config_t *p_cfg, const WORD8 *p_out,
+    const WORD8 *p_mat, const WORD8 *p_vec, const WORD32 *p_bias,
+    const xa_nn_residual_cfg_t *p_res_cfg)
+{
+  buf1D_t *p_plain, *p_ref;
+  int itr, diff, err, pass = 1;
+
+  if(p_res_cfg->res_shift > 0)
+  {
+    printf("Residual check skipped, res_shift > 0\n");
+    return 1;
+  }
+  p_plain = create_buf1D(p_cfg->rows, -4);
+  p_ref = create_buf1D(p_cfg->rows, -4);
+  if(p_plain == NULL || p_ref == NULL)
+  {
+    if(p_plain) free_buf1D(p_plain);
+    if(p_ref) free_buf1D(p_ref);
+    return 0;
+  }
+
+  err = xa_nn_fully_connected_v2_asym8sxasym8s_asym8s((WORD8 *)p_plain->p, p_mat, p_vec, p_bias,
+      p_cfg->cols1, p_cfg->rows, p_cfg->mat1_zero_bias, p_cfg->inp1_zero_bias,
+      p_cfg->out_multiplier, p_cfg->out_shift, p_cfg->out_zero_bias, -128, 127, NULL);
+
+  /* Unit scale for the FC output, 2^-20 on the output to undo the left shift */
+  if(!err)
+    err = xa_nn_elm_add_asym8sxasym8s_asym8s((WORD8 *)p_ref->p, p_cfg->out_zero_bias, -19, 1 << 30, -128, 127,
+        (WORD8 *)p_plain->p, -p_cfg->out_zero_bias, 0, 0x7fffffff,
+        p_res_cfg->p_res, p_res_cfg->res_zero_bias, p_res_cfg->res_shift, p_res_cfg->res_multiplier,
+        20, p_cfg->rows);
+
+  for(itr = 0; itr < p_cfg->rows && !err; itr++)
+  {
+    diff = p_out[itr] - ((WORD8 *)p_ref->p)[itr];
+    if(diff > 1 || diff < -1)
+    {
+      printf("Residual mismatch at %d: %d, elm_add %d\n", itr, p_out[itr], ((WORD8 *)p_ref->p)[itr]);
+      pass = 0;
+      break;
+    }
+  }
+
+  free_buf1D(p_plain);
+  free_buf1D(p_ref);
+  return pass && !err;
+}
+
+/* Reruns the FC f32io kernel with asym8s output into p_out, the f32 output
+ * has to match xa_nn_elm_dequantize_asym8s_f32 of it */
+static int check_f32io_out_fc_asym8s(const test_config_t *p_cfg, WORD8 *p_out,
+    const FLOAT32 *p_out_f32, const WORD8 *p_mat, const FLOAT32 *p_vec, const WORD32 *p_bias,
+    void *p_scratch, const xa_nn_f32io_cfg_t *p_io_cfg)
+{
+  xa_nn_f32io_cfg_t io_cfg_q = *p_io_cfg;
+  buf1D_t *p_ref;
+  int itr, err, pass = 1;
+
+  p_ref = create_buf1D(p_cfg->rows, -1);
+  if(p_ref == NULL)
+    return 0;
+
+  io_cfg_q.out_f32 = 0;
+  err = xa_nn_fully_connected_v2_f32io_asym8sxasym8s_asym8s(p_out, p_mat, p_vec, p_bias,
+      p_cfg->cols1, p_cfg->rows, p_cfg->mat1_zero_bias, p_cfg->inp1_zero_bias,
+      p_cfg->out_multiplier, p_cfg->out_shift, p_cfg->out_zero_bias, -128, 127, &io_cfg_q, p_scratch, NULL);
+  if(!err)
+    err = xa_nn_elm_dequantize_asym8s_f32((FLOAT32 *)p_ref->p, p_out, p_cfg->out_zero_bias,
+        p_io_cfg->out_scale, p_cfg->rows);
+
+  for(itr = 0; itr < p_cfg->rows && !err; itr++)
+  {
+    if(p_out_f32[itr] != ((FLOAT32 *)p_ref->p)[itr])
+    {
+      printf("f32 output mismatch at %d: %f, dequantized %f\n", itr, p_out_f32[itr], ((FLOAT32 *)p_ref->p)[itr]);
+      pass = 0;
+      break;
+    }
+  }
+
+  free_buf1D(p_ref);
+  return pass && !err;
+}
+
+/* Q15 RoPE tables of head_dim / 2 entries for positions 0 .. n_pos - 1,
+ * frequencies follow base 10000 */
+static void init_rope_tables_q15(WORD16 *p_cos, WORD16 *p_sin, int n_pos, int head_dim)
+{
+  int half = head_dim / 2, pos, k;
+
+  for(pos = 0; pos < n_pos; pos++)
+  {
+    for(k = 0; k < half; k++)
+    {
+      double theta = pos * pow(10000.0, -2.0 * k / head_dim);
+      double c = floor(cos(theta) * 32768.0 + 0.5), s = floor(sin(theta) * 32768.0 + 0.5);
+      p_cos[pos * half + k] = (WORD16)(c > 32767 ? 32767 : c);
+      p_sin[pos * half + k] = (WORD16)(s > 32767 ? 32767 : s);
+    }
+  }
+}
+
+/* The fused RoPE batch matmul has to match the plain batch matmul followed by
+ * xa_nn_rope_sym16s_sym16s over every out_shape[3] x out_shape[4] block */
+static int check_batch_matmul_rope_sym16s(const test_config_t *p_cfg, const WORD16 *p_out,
+    const WORD16 *p_mat1, const WORD16 *p_vec1, const xa_nn_rope_cfg_t *p_rope, void *p_scratch)
+{
+  const int *p_shape = p_cfg->out_shape;
+  int n_blocks = p_shape[0] * p_shape[1] * p_shape[2];
+  int out_size = n_blocks * p_shape[3] * p_shape[4];
+  buf1D_t *p_ref;
+  int itr, err, pass = 1;
+
+  p_ref = create_buf1D(out_size, -8);
+  if(p_ref == NULL)
+    return 0;
+
+  err = xa_nn_batch_matmul_sym16sxsym16s_sym16s((WORD16 *)p_ref->p, (WORD32 *)p_cfg->out_shape,
+      p_mat1, (WORD32 *)p_cfg->mat1_shape, p_vec1, (WORD32 *)p_cfg->inp1_shape,
+      p_cfg->mat1_transpose, p_cfg->inp1_transpose, p_cfg->mat1_zero_bias, p_cfg->inp1_zero_bias,
+      p_cfg->out_multiplier, p_cfg->out_shift, p_cfg->out_zero_bias, p_scratch);
+  if(!err)
+    err = xa_nn_rope_sym16s_sym16s((WORD16 *)p_ref->p, (WORD16 *)p_ref->p, p_rope->p_cos, p_rope->p_sin,
+        n_blocks, p_shape[3], p_shape[4], p_rope->pos_offset, p_rope->interleaved);
+
+  for(itr = 0; itr < out_size && !err; itr++)
+  {
+    if(p_out[itr] != ((WORD16 *)p_ref->p)[itr])
+    {
+      printf("RoPE batch matmul mismatch at %d: %d, batch_matmul + rope %d\n", itr, p_out[itr], ((WORD16 *)p_ref->p)[itr]);
+      pass = 0;
+      break;
+    }
+  }
+
+  free_buf1D(p_ref);
+  return pass && !err;
+}
+
+/* memcpy stand-in for a DMA engine, transfers complete synchronously */
+static WORD32 testbench_dma_transfer(VOID *p_dst, const VOID *p_src, WORD32 n_bytes, VOID *p_ctx)
+{
+  memcpy(p_dst, p_src, n_bytes);
+  return 0;
+}
+
+static WORD32 testbench_dma_wait(WORD32 transfer_id, VOID *p_ctx)
+{
+  return 0;
+}
+
 int xa_nn_main_process(int argc, char *argv[])
 {
 
@@ -862,6 +1336,27 @@ int xa_nn_main_process(int argc, char *argv[])
   buf1D_t *p_out;
   buf1D_t *p_scratch;
   buf1D_t *ptr_ref;
+  buf1D_t *p_dma_buf[2] = {NULL, NULL};
+  xa_dma_cfg_t dma_cfg;
+  xa_dma_cfg_t *p_dma_cfg = NULL;
+  buf1D_t *p_res = NULL;
+  xa_nn_residual_cfg_t res_cfg;
+  xa_nn_residual_cfg_t *p_res_cfg = NULL;
+  buf1D_t *p_vec1_f32 = NULL;
+  buf1D_t *p_io_scratch = NULL;
+  buf1D_t *p_out_f32 = NULL;
+  int io_pass = 1;
+  xa_nn_f32io_cfg_t io_cfg;
+  xa_nn_f32io_cfg_t *p_io_cfg = NULL;
+  buf1D_t *p_softmax_scratch = NULL;
+  WORD32 top1 = 0;
+  xa_nn_attention_params_t attn_params;
+  xa_nn_kv_cache_t kv_cache;
+  buf1D_t *p_cache_k = NULL;
+  buf1D_t *p_cache_v = NULL;
+  xa_nn_rope_cfg_t rope_cfg;
+  buf1D_t *p_rope_cos = NULL;
+  buf1D_t *p_rope_sin = NULL;
   int scratch_size = 0;
 
   /* Some kernels like the *_acc_batch_* require (a one time) initialization
@@ -968,6 +1463,12 @@ int xa_nn_main_process(int argc, char *argv[])
     else if(cfg.batch_matmul == 1) {
       sprintf(profiler_name,"batch_matmul_asym8sxasym8s_asym8s");
     }
+    else if(cfg.attention == 1) {
+      sprintf(profiler_name,"attention%s_asym8s",(cfg.causal)? "_causal": "");
+    }
+    else if(cfg.attention == 2) {
+      sprintf(profiler_name,"kv_cache_attend_asym8s");
+    }
     else {
       sprintf(profiler_name,"matXvec%s%s_asym8sxasym8s_asym8s",(cfg.batch)? "_batch": "",(cfg.v2)? "_v2": "");
     }
@@ -1029,6 +1530,15 @@ int xa_nn_main_process(int argc, char *argv[])
     if(cfg.batch_matmul == 1){
       sprintf(profiler_name,"batch_matmul_sym16sxsym16s_sym16s");
     }
+    else if(cfg.batch_matmul == 2){
+      sprintf(profiler_name,"batch_matmul_rope_sym16sxsym16s_sym16s");
+    }
+    else if(cfg.attention == 1){
+      sprintf(profiler_name,"attention%s_sym16s",(cfg.causal)? "_causal": "");
+    }
+    else if(cfg.attention == 2){
+      sprintf(profiler_name,"kv_cache_attend_sym16s");
+    }
   }
   else
   {
@@ -1053,9 +1563,17 @@ int xa_nn_main_process(int argc, char *argv[])
     sprintf(profiler_params, "rows=%d, cols1=%d, bias_prec=%d, vec_count=%d", 
       cfg.rows, cfg.cols1, cfg.bias_precision,cfg.vec_count);
   }
-  else if(cfg.batch_matmul == 1){
+  else if(cfg.batch_matmul){
     sprintf(profiler_params, "mat1_shape= %s inp1_shape= %s out_shape= %s\n", cfg.read_mat1_shape_str, cfg.read_inp1_shape_str, cfg.read_out_shape_str);
   }
+  else if(cfg.attention == 1){
+    sprintf(profiler_params, "heads=%d, kv_heads=%d, q_len=%d, kv_len=%d, head_dim=%d, block=%d",
+      cfg.num_heads, cfg.num_kv_heads, cfg.rows, cfg.vec_count, cfg.cols1, cfg.block_size);
+  }
+  else if(cfg.attention == 2){
+    sprintf(profiler_params, "heads=%d, kv_heads=%d, steps=%d, capacity=%d, head_dim=%d, block=%d",
+      cfg.num_heads, cfg.num_kv_heads, cfg.rows, cfg.vec_count, cfg.cols1, cfg.block_size);
+  }
   else{
     sprintf(profiler_params, "rows=%d, cols1=%d, cols2=%d, bias_prec=%d", 
       cfg.rows, cfg.cols1, cfg.cols2, cfg.bias_precision);
@@ -1081,10 +1599,14 @@ int xa_nn_main_process(int argc, char *argv[])
   fptr_out = file_open(pb_output_file_path, cfg.write_out_file_name, "wb", XA_MAX_CMD_LINE_LENGTH);
   
   // The total size of the output buffer (which will be greater than just rows*columns in case of out_stride kernels)
-  if(cfg.batch_matmul == 1)
+  if(cfg.batch_matmul)
   {
     out_buffer_size = cfg.out_shape[0] * cfg.out_shape[1] * cfg.out_shape[2] * cfg.out_shape[3] * cfg.out_shape[4];
   }
+  else if(cfg.attention)
+  {
+    out_buffer_size = cfg.num_heads * cfg.rows * cfg.cols1;
+  }
   else
   {
     out_buffer_size = cfg.rows*cfg.vec_count*cfg.out_stride;
@@ -1113,6 +1635,15 @@ int xa_nn_main_process(int argc, char *argv[])
                       cfg.mat1_transpose, cfg.inp1_transpose,
                       cfg.mat_precision, cfg.inp_precision);
   }
+  else if(cfg.attention)
+  {
+    scratch_size = xa_nn_attention_getsize(cfg.cols1, cfg.block_size, cfg.mat_precision);
+    if(scratch_size <= 0)
+    {
+      printf("Invalid attention parameters\n");
+      return -1;
+    }
+  }
   else
   {
     // scratch size required for matXvec activation kernels
@@ -1120,13 +1651,45 @@ int xa_nn_main_process(int argc, char *argv[])
   }
 
   // Allocate Memory
-  if(cfg.batch_matmul == 1){
+  if(cfg.batch_matmul){
     WORD32 mat1_size, inp1_size;
     mat1_size = cfg.mat1_shape[0] * cfg.mat1_shape[1] * cfg.mat1_shape[2] * cfg.mat1_shape[3] * cfg.mat1_shape[4];
     inp1_size = cfg.inp1_shape[0] * cfg.inp1_shape[1] * cfg.inp1_shape[2] * cfg.inp1_shape[3] * cfg.inp1_shape[4];
     p_mat1 = create_buf2D(1, mat1_size, mat1_size, cfg.mat_precision, 0);                                   VALIDATE_PTR(p_mat1);
     p_vec1 = create_buf1D(inp1_size, cfg.inp_precision);                                                    VALIDATE_PTR(p_vec1);
     p_out = create_buf1D(out_buffer_size, cfg.out_precision);                                                      VALIDATE_PTR(p_out);
+    if(cfg.batch_matmul == 2){
+      /* Output row r of each block is at position rope_pos_offset + r */
+      WORD32 rope_size = (cfg.rope_pos_offset + cfg.out_shape[3]) * (cfg.out_shape[4] > 1 ? cfg.out_shape[4] / 2 : 1);
+      p_rope_cos = create_buf1D(rope_size, -8);                                                             VALIDATE_PTR(p_rope_cos);
+      p_rope_sin = create_buf1D(rope_size, -8);                                                             VALIDATE_PTR(p_rope_sin);
+      init_rope_tables_q15((WORD16 *)p_rope_cos->p, (WORD16 *)p_rope_sin->p,
+          cfg.rope_pos_offset + cfg.out_shape[3], cfg.out_shape[4]);
+      rope_cfg.p_cos = (WORD16 *)p_rope_cos->p;
+      rope_cfg.p_sin = (WORD16 *)p_rope_sin->p;
+      rope_cfg.pos_offset = cfg.rope_pos_offset;
+      rope_cfg.interleaved = cfg.rope_interleaved;
+    }
+  }
+  else if(cfg.attention){
+    WORD32 q_size, kv_size;
+    q_size = cfg.num_heads * cfg.rows * cfg.cols1;
+    /* KV-cache decode appends one K/V step per query row */
+    kv_size = cfg.num_kv_heads * (cfg.attention == 2 ? cfg.rows : cfg.vec_count) * cfg.cols1;
+    p_mat1 = create_buf2D(1, q_size, q_size, cfg.mat_precision, 0);                                         VALIDATE_PTR(p_mat1);
+    p_vec1 = create_buf1D(kv_size, cfg.inp_precision);                                                      VALIDATE_PTR(p_vec1);
+    p_vec2 = create_buf1D(kv_size, cfg.inp_precision);                                                      VALIDATE_PTR(p_vec2);
+    p_out = create_buf1D(out_buffer_size, cfg.out_precision);                                               VALIDATE_PTR(p_out);
+    if(cfg.attention == 2){
+      kv_size = cfg.num_kv_heads * cfg.vec_count * cfg.cols1;
+      p_cache_k = create_buf1D(kv_size, cfg.inp_precision);                                                 VALIDATE_PTR(p_cache_k);
+      p_cache_v = create_buf1D(kv_size, cfg.inp_precision);                                                 VALIDATE_PTR(p_cache_v);
+      kv_cache.p_k = p_cache_k->p;
+      kv_cache.p_v = p_cache_v->p;
+      kv_cache.num_kv_heads = cfg.num_kv_heads;
+      kv_cache.capacity = cfg.vec_count;
+      kv_cache.head_dim = cfg.cols1;
+    }
   }
   else{
     p_mat1 = create_buf2D(cfg.rows, cfg.cols1, cfg.row_stride1, cfg.mat_precision, cfg.membank_padding);    VALIDATE_PTR(p_mat1);
@@ -1151,28 +1714,124 @@ int xa_nn_main_process(int argc, char *argv[])
   else if(cfg.fc == 1){
     XTPWR_PROFILER_OPEN(0, profiler_name, profiler_params, (cfg.rows * cfg.cols1), "MACs/cyc", 1);
   }
-  else if(cfg.batch_matmul == 1){
+  else if(cfg.batch_matmul){
     WORD32 accum_dim, out_size;
     accum_dim = cfg.mat1_transpose == 0 ? cfg.mat1_shape[4] : cfg.mat1_shape[3];
     out_size = cfg.out_shape[0] * cfg.out_shape[1] * cfg.out_shape[2] * cfg.out_shape[3] * cfg.out_shape[4];
     XTPWR_PROFILER_OPEN(0, profiler_name, profiler_params, (out_size * accum_dim), "MACs/cyc", 1);
   }
+  else if(cfg.attention == 1){
+    /* Q.K^T and P.V, masked keys included */
+    XTPWR_PROFILER_OPEN(0, profiler_name, profiler_params, (2 * cfg.num_heads * cfg.rows * cfg.vec_count * cfg.cols1), "MACs/cyc", 1);
+  }
+  else if(cfg.attention == 2){
+    /* Step t attends min(t + 1, capacity) cached steps */
+    WORD32 step, attended = 0;
+    for(step = 0; step < cfg.rows; step++)
+      attended += (step < cfg.vec_count) ? step + 1 : cfg.vec_count;
+    XTPWR_PROFILER_OPEN(0, profiler_name, profiler_params, (2 * cfg.num_heads * attended * cfg.cols1), "MACs/cyc", 1);
+  }
   else {
     XTPWR_PROFILER_OPEN(0, profiler_name, profiler_params, (cfg.rows * (cfg.cols1 + cfg.cols2)), "MACs/cyc", 1);
   }
 
+  if(cfg.v2 && cfg.dma > 0)
+  {
+    p_dma_buf[0] = create_buf1D(cfg.dma, 8);                                                  VALIDATE_PTR(p_dma_buf[0]);
+    p_dma_buf[1] = create_buf1D(cfg.dma, 8);                                                  VALIDATE_PTR(p_dma_buf[1]);
+    dma_cfg.transfer = testbench_dma_transfer;
+    dma_cfg.wait = testbench_dma_wait;
+    dma_cfg.p_ctx = NULL;
+    dma_cfg.p_local_buf[0] = p_dma_buf[0]->p;
+    dma_cfg.p_local_buf[1] = p_dma_buf[1]->p;
+    dma_cfg.local_buf_size = cfg.dma;
+    p_dma_cfg = &dma_cfg;
+  }
+
+  if(cfg.v2 && cfg.fc && cfg.res_multiplier != 0)
+  {
+    int itr;
+    p_res = create_buf1D(cfg.rows, 8);                                                        VALIDATE_PTR(p_res);
+    for(itr = 0; itr < cfg.rows; itr++)
+      ((WORD8 *)p_res->p)[itr] = (WORD8)(itr * 7 - 128);
+    res_cfg.p_res = (WORD8 *)p_res->p;
+    res_cfg.res_zero_bias = cfg.res_zero_bias;
+    res_cfg.res_multiplier = cfg.res_multiplier;
+    res_cfg.res_shift = cfg.res_shift;
+    p_res_cfg = &res_cfg;
+  }
+
+  if(cfg.v2 && cfg.fc && cfg.f32io && cfg.mat_precision == ASYM8S_TYPE && cfg.inp_precision == ASYM8S_TYPE)
+  {
+    p_vec1_f32 = create_buf1D(cfg.cols1, -1);                                                 VALIDATE_PTR(p_vec1_f32);
+    p_io_scratch = create_buf1D(cfg.cols1, 8);                                                VALIDATE_PTR(p_io_scratch);
+    io_cfg.inp_scale = 1.0f;
+    io_cfg.out_scale = 1.0f;
+    io_cfg.out_f32 = 0;
+    io_cfg.band_rows = 0;
+    p_io_cfg = &io_cfg;
+    if(cfg.f32io == 2)
+    {
+      p_out_f32 = create_buf1D(cfg.rows, -1);                                                 VALIDATE_PTR(p_out_f32);
+      io_cfg.out_scale = 0.5f;
+      io_cfg.out_f32 = 1;
+    }
+  }
+
+  if(cfg.v2 && cfg.fc && cfg.softmax && cfg.mat_precision == ASYM8S_TYPE && cfg.inp_precision == ASYM8S_TYPE)
+  {
+    int softmax_scratch_size = xa_nn_fully_connected_v2_softmax_getsize(cfg.rows, PREC_ASYM8S);
+    if(softmax_scratch_size <= 0)
+    {
+      printf("Invalid softmax head parameters\n");
+      return -1;
+    }
+    p_softmax_scratch = create_buf1D(softmax_scratch_size, 8);                                VALIDATE_PTR(p_softmax_scratch);
+  }
+
+  if(cfg.attention)
+  {
+    /* Zero biases are not used by sym16s */
+    int asym = (cfg.mat_precision == ASYM8S_TYPE);
+    attn_params.q_zero_bias = asym ? cfg.mat1_zero_bias : 0;
+    attn_params.k_zero_bias = asym ? cfg.mat2_zero_bias : 0;
+    attn_params.v_zero_bias = asym ? cfg.inp1_zero_bias : 0;
+    attn_params.score_multiplier = cfg.score_multiplier;
+    attn_params.score_shift = cfg.score_shift;
+    attn_params.score_zero_bias = 0;
+    attn_params.diffmin = cfg.diffmin;
+    attn_params.input_beta_left_shift = cfg.input_left_shift;
+    attn_params.input_beta_multiplier = cfg.input_multiplier;
+    attn_params.out_multiplier = cfg.out_multiplier;
+    attn_params.out_shift = cfg.out_shift;
+    attn_params.out_zero_bias = asym ? cfg.out_zero_bias : 0;
+    attn_params.causal = cfg.causal;
+    attn_params.block_size = cfg.block_size;
+  }
 
   // Frame processing loop
   for(frame = 0; frame < cfg.frames; frame++)
   {
     // If write_file enabled, generate random data for input, else read from file
-    if(cfg.batch_matmul == 1){
+    if(cfg.batch_matmul){
         load_batch_matmul_input_data(cfg.write_file, fptr_inp, p_mat1, p_vec1);
     }
+    else if(cfg.attention){
+        load_attention_input_data(cfg.write_file, fptr_inp, p_mat1, p_vec1, p_vec2);
+    }
     else{
         load_matXvec_input_data(cfg.write_file, fptr_inp, p_mat1, p_vec1, p_mat2, p_vec2, p_bias);
     }
 
+    /* With unit scale, quantizing q + input_zero_bias gives back q, so the
+     * output matches the asym8s input path */
+    if(p_io_cfg != NULL)
+    {
+      int itr;
+      for(itr = 0; itr < cfg.cols1; itr++)
+        ((FLOAT32 *)p_vec1_f32->p)[itr] = (FLOAT32)(((WORD8 *)p_vec1->p)[itr] + cfg.mat1_zero_bias);
+    }
+
     // Call the matXvec kernel specified on command line
     if(cfg.batch == 1){
         PROCESS_MATXVEC_BATCH;
@@ -1193,6 +1852,15 @@ int xa_nn_main_process(int argc, char *argv[])
     else if(cfg.batch_matmul == 1){
         PROCESS_BATCH_MATMUL;
     }
+    else if(cfg.batch_matmul == 2){
+        PROCESS_BATCH_MATMUL_ROPE;
+    }
+    else if(cfg.attention == 1){
+        PROCESS_ATTENTION;
+    }
+    else if(cfg.attention == 2){
+        PROCESS_KV_CACHE;
+    }
     else if(cfg.v2 == 1){
         PROCESS_MATXVEC_V2;
     }
@@ -1210,6 +1878,18 @@ int xa_nn_main_process(int argc, char *argv[])
     XTPWR_PROFILER_UPDATE(0);
     XTPWR_PROFILER_PRINT(0);
 
+    /* The f32 output run leaves p_out empty, fill it for the file and the
+     * reference compare while checking the f32 output */
+    io_pass = 1;
+    if(p_io_cfg != NULL && p_io_cfg->out_f32 && p_softmax_scratch == NULL)
+      io_pass = check_f32io_out_fc_asym8s(&cfg, (WORD8 *)p_out->p, (FLOAT32 *)p_out_f32->p, (WORD8 *)p_mat1->p,
+          (FLOAT32 *)p_vec1_f32->p, (WORD32 *)p_bias->p, p_io_scratch->p, p_io_cfg);
+
+    if(p_softmax_scratch != NULL)
+    {
+      printf("Top-1 index: %d\n", top1);
+    }
+
     // Write output into file
     
     write_buf1D_to_file(fptr_out, p_out);
@@ -1217,12 +1897,41 @@ int xa_nn_main_process(int argc, char *argv[])
     // If verify flag enabled, compare output against reference
     if(cfg.verify)
     {
+      int pass;
       read_buf1D_from_file(fptr_ref, ptr_ref);
-      pass_count += compare_buf1D(ptr_ref, p_out, cfg.verify, cfg.out_precision, 1);
+      pass = compare_buf1D(ptr_ref, p_out, cfg.verify, cfg.out_precision, 1);
+      pass &= io_pass;
+      if(cfg.attention == 1 && p_out->precision == -4)
+        pass &= check_attention_asym8s(&cfg, (WORD8 *)p_out->p, (WORD8 *)p_mat1->p, (WORD8 *)p_vec1->p,
+            (WORD8 *)p_vec2->p, &attn_params);
+      if(cfg.attention == 2)
+        pass &= check_kv_cache_attend(&cfg, p_out->p, p_mat1->p, p_vec1->p, p_vec2->p, &attn_params);
+      if(cfg.batch_matmul == 2)
+        pass &= check_batch_matmul_rope_sym16s(&cfg, (WORD16 *)p_out->p, (WORD16 *)p_mat1->p, (WORD16 *)p_vec1->p,
+            &rope_cfg, p_scratch->p);
+      if(p_res_cfg != NULL && p_softmax_scratch == NULL && p_io_cfg == NULL &&
+         p_mat1->precision == -4 && p_vec1->precision == -4 && p_out->precision == -4)
+        pass &= check_residual_fc_asym8s(&cfg, (WORD8 *)p_out->p, (WORD8 *)p_mat1->p, (WORD8 *)p_vec1->p,
+            (WORD32 *)p_bias->p, p_res_cfg);
+      pass_count += pass;
+    }
+    else if(cfg.attention == 1 && p_out->precision == -4)
+    {
+      pass_count += check_attention_asym8s(&cfg, (WORD8 *)p_out->p, (WORD8 *)p_mat1->p, (WORD8 *)p_vec1->p,
+          (WORD8 *)p_vec2->p, &attn_params);
+    }
+    else if(cfg.attention == 2)
+    {
+      pass_count += check_kv_cache_attend(&cfg, p_out->p, p_mat1->p, p_vec1->p, p_vec2->p, &attn_params);
+    }
+    else if(cfg.batch_matmul == 2)
+    {
+      pass_count += check_batch_matmul_rope_sym16s(&cfg, (WORD16 *)p_out->p, (WORD16 *)p_mat1->p, (WORD16 *)p_vec1->p,
+          &rope_cfg, p_scratch->p);
     }
     else
     {
-      pass_count += !err;
+      pass_count += !err && io_pass;
     }
   }
 
@@ -1236,13 +1945,49 @@ int xa_nn_main_process(int argc, char *argv[])
   free_buf2D(p_mat1);
   free_buf1D(p_vec1);
   free_buf1D(p_out);
-  if(cfg.batch_matmul == 0)
+  if(cfg.attention)
+  {
+    free_buf1D(p_vec2);
+  }
+  if(p_cache_k)
+  {
+    free_buf1D(p_cache_k);
+    free_buf1D(p_cache_v);
+  }
+  else if(cfg.batch_matmul == 0 && cfg.attention == 0)
   {
     free_buf2D(p_mat2);
     free_buf1D(p_vec2);
     free_buf1D(p_bias);
   }
   free_buf1D(p_scratch);
+  if(p_dma_cfg)
+  {
+    free_buf1D(p_dma_buf[0]);
+    free_buf1D(p_dma_buf[1]);
+  }
+  if(p_res)
+  {
+    free_buf1D(p_res);
+  }
+  if(p_io_cfg)
+  {
+    free_buf1D(p_vec1_f32);
+    free_buf1D(p_io_scratch);
+  }
+  if(p_out_f32)
+  {
+    free_buf1D(p_out_f32);
+  }
+  if(p_softmax_scratch)
+  {
+    free_buf1D(p_softmax_scratch);
+  }
+  if(p_rope_cos)
+  {
+    free_buf1D(p_rope_cos);
+    free_buf1D(p_rope_sin);
+  }
 
   if(cfg.verify)
   {
@@ -82,6 +82,8 @@ typedef struct _test_config_t
   int recip_shift;
   int per_chan_flag;
   int zero_point;
+  int out_multiplier;
+  int variance_epsilon;
 }test_config_t;
 
 int default_config(test_config_t *p_cfg)
@@ -119,6 +121,8 @@ int default_config(test_config_t *p_cfg)
     p_cfg->recip_shift=12;
     p_cfg->per_chan_flag=1;
     p_cfg->zero_point = 0;
+    p_cfg->out_multiplier = 0x40000000;
+    p_cfg->variance_epsilon = 0;
     return 0;
   }
   else
@@ -144,14 +148,14 @@ void show_usage(void)
     printf("\t-out_activation_min: Output maximum limit; Default=127 for 8-bit output\n");
     printf("\t-inp_data_format: Input data format, 0 : NHWC; Default=0\n");
     printf("\t-out_data_format: Output data format, 0 : NHWC; Default=0\n");
-    printf("\t-inp_precision: 8, 16, -1(single prec float), -4(asym8s); Default=16\n");
-    printf("\t-out_precision: 8, 16, -1(single prec float), -4(asym8s); Default=16\n");
+    printf("\t-inp_precision: 8, 16, -1(single prec float), -4(asym8s), -8(sym16s); Default=16\n");
+    printf("\t-out_precision: 8, 16, -1(single prec float), -4(asym8s), -8(sym16s); Default=16\n");
     printf("\t-renorm_scale: Scale for renormalization; Default=1\n");
     printf("\t-renorm_shift: Right shift for renormalization; Default=0\n");
     printf("\t-input_zero_bias: zero bias of input ; Default=0\n");
     printf("\t-output_zero_bias: zero bias of output ; Default=0\n");
     printf("\t-frames: Positive number; Default=2\n");
-    printf("\t-kernel_name: l2_norm; Default=""l2_norm""\n");
+    printf("\t-kernel_name: l2_norm, batch_norm_3D, norm_calc_3D, norm_apply_3D, renorm, layer_norm; Default=""l2_norm""\n");
     printf("\t-write_file: set to 1 to write input and output vectors to file; Default=0\n");
     printf("\t-read_inp_file_name: Full filename for reading inputs (order - inp) \n");
     printf("\t-read_ref_file_name: Full filename for reading reference output \n");
@@ -159,6 +163,9 @@ void show_usage(void)
     printf("\t-write_out_file_name: Full filename for writing output \n");
     printf("\t-verify: Verify output against provided reference; 0: Disable, 1: Bitexact match; Default=1\n");
     printf("\t-zero_point: l2_norm_asym8s input parameter; Default=0\n");
+    printf("\t-out_multiplier: layer_norm output multiplier, used with out_shift and output_zero_bias; Default=0x40000000\n");
+    printf("\t-variance_epsilon: layer_norm epsilon in squared input units; Default=0\n");
+    printf("\t  layer_norm normalizes rows of io_channels elements, io_height*io_width rows\n");
 }
 
 void parse_arguments(int argc, char** argv, test_config_t *p_cfg)
@@ -205,6 +212,8 @@ void parse_arguments(int argc, char** argv, test_config_t *p_cfg)
     ARGTYPE_STRING("-write_out_file_name",p_cfg->write_out_file_name, XA_MAX_CMD_LINE_LENGTH);
     ARGTYPE_ONETIME_CONFIG("-verify",p_cfg->verify);
     ARGTYPE_ONETIME_CONFIG("-zero_point",p_cfg->zero_point);
+    ARGTYPE_ONETIME_CONFIG("-out_multiplier",p_cfg->out_multiplier);
+    ARGTYPE_ONETIME_CONFIG("-variance_epsilon",p_cfg->variance_epsilon);
 
     // If arg doesnt match with any of the above supported options, report option as invalid
     printf("Invalid argument: %s\n",argv[argidx]);
@@ -310,6 +319,30 @@ void parse_arguments(int argc, char** argv, test_config_t *p_cfg)
     XTPWR_PROFILER_STOP(0); \
   }
 
+#define LAYER_NORM_ASYM8S_ASYM8S(KERNEL, IPREC, OPREC) \
+  if(!strcmp(cfg.kernel_name,#KERNEL) && (IPREC == p_inp->precision)) { \
+    XTPWR_PROFILER_START(0);\
+    err = xa_nn_##KERNEL##_asym8s_asym8s ( \
+        (WORD8 *)p_out->p, (WORD8 *) p_inp->p, \
+        (WORD16 *)p_alpha->p, (WORD32 *)p_beta->p, \
+        cfg.io_height * cfg.io_width, cfg.io_channels, cfg.variance_epsilon, \
+        cfg.out_multiplier, cfg.out_shift, cfg.output_zero_bias, \
+        cfg.out_activation_min, cfg.out_activation_max); \
+    XTPWR_PROFILER_STOP(0); \
+  }
+
+#define LAYER_NORM_SYM16S_SYM16S(KERNEL, IPREC, OPREC) \
+  if(!strcmp(cfg.kernel_name,#KERNEL) && (IPREC == p_inp->precision)) { \
+    XTPWR_PROFILER_START(0);\
+    err = xa_nn_##KERNEL##_sym16s_sym16s ( \
+        (WORD16 *)p_out->p, (WORD16 *) p_inp->p, \
+        (WORD16 *)p_alpha->p, (WORD32 *)p_beta->p, \
+        cfg.io_height * cfg.io_width, cfg.io_channels, cfg.variance_epsilon, \
+        cfg.out_multiplier, cfg.out_shift, \
+        cfg.out_activation_min, cfg.out_activation_max); \
+    XTPWR_PROFILER_STOP(0); \
+  }
+
 #define PROCESS_NORM \
     L2_NORM_KERNEL_F_FN(l2_norm, -1, -1) \
     else L2_NORM_KERNEL_ASYM8S_FN(l2_norm, -4, -4) \
@@ -319,6 +352,8 @@ void parse_arguments(int argc, char** argv, test_config_t *p_cfg)
     else NORM_APPLY_3D_16_NHWC(norm_apply_3D, 16, 16) \
     else BATCH_NORM_3D_KERNEL_8_FN(batch_norm_3D, 8, 8) \
     else RENORM_ASYM8S_ASYM8S(renorm, -4, -4) \
+    else LAYER_NORM_ASYM8S_ASYM8S(layer_norm, -4, -4) \
+    else LAYER_NORM_SYM16S_SYM16S(layer_norm, -8, -8) \
     else {  printf("unsupported normalization operation\n"); return -1;}
 
 int xa_nn_main_process(int argc, char *argv[])
@@ -371,7 +406,7 @@ int xa_nn_main_process(int argc, char *argv[])
     }
   }
 
-  if(!strcmp(cfg.kernel_name, "batch_norm_3D"))
+  if(!strcmp(cfg.kernel_name, "batch_norm_3D") || !strcmp(cfg.kernel_name, "layer_norm"))
   {
     if(cfg.io_height >= 0 && cfg.io_width >= 0 && cfg.io_channels >= 0)
       inp_size = cfg.io_height * cfg.io_width * cfg.io_channels;
@@ -427,6 +462,11 @@ int xa_nn_main_process(int argc, char *argv[])
     sprintf(profiler_params, "_asym8s");
     strcat(profiler_name, profiler_params);
   }
+  else if(cfg.inp_precision == -8)
+  {
+    sprintf(profiler_params, "_sym16s");
+    strcat(profiler_name, profiler_params);
+  }
   else
   {
     sprintf(profiler_params, "_%d",
@@ -440,6 +480,11 @@ int xa_nn_main_process(int argc, char *argv[])
     sprintf(profiler_params, "io_height=%d, io_width = %d, io_channels = %d, inp_data_format = %d, out_data_format %d",
             cfg.io_height, cfg.io_width, cfg.io_channels, cfg.inp_data_format, cfg.out_data_format);
   }
+  else if(!strcmp(cfg.kernel_name,"layer_norm"))
+  {
+    sprintf(profiler_params, "rows=%d, row_len=%d, variance_epsilon=%d",
+            cfg.io_height * cfg.io_width, cfg.io_channels, cfg.variance_epsilon);
+  }
   else if(!strcmp(cfg.kernel_name,"norm_apply_3D"))
   {
     sprintf(profiler_params, "io_height=%d, io_width = %d, io_channels = %d, across_depth_flag = %d, out_shift %d, rsqrt_shift %d, per_chan_flag %d",
@@ -500,6 +545,19 @@ int xa_nn_main_process(int argc, char *argv[])
     memset(p_beta->p,  -20, cfg.io_channels* 4);
   }
 
+  if(!strcmp(cfg.kernel_name,"layer_norm"))
+  {
+    int itr;
+    p_alpha = create_buf1D(cfg.io_channels, 16);                                  VALIDATE_PTR(p_alpha);
+    p_beta = create_buf1D(cfg.io_channels, 32);                                   VALIDATE_PTR(p_beta);
+    /* gamma and beta are not read through bin files, hence initialized here */
+    for(itr = 0; itr < cfg.io_channels; itr++)
+    {
+      ((WORD16 *)p_alpha->p)[itr] = (WORD16)(8192 + (itr & 15) * 512);
+      ((WORD32 *)p_beta->p)[itr] = (itr & 7) * 1024 - 4096;
+    }
+  }
+
   if(!strcmp(cfg.kernel_name,"norm_calc_3D") && (cfg.inp_precision == 8) && (cfg.out_precision == 16))
   {
     p_rsqrt = create_buf1D(cfg.rsqrt_table_len, 16);                              VALIDATE_PTR(p_rsqrt);
@@ -542,6 +600,8 @@ int xa_nn_main_process(int argc, char *argv[])
     num_ops = 2*cfg.num_elms;   // First calculated square root of energy and then divide input by it
   else if(!strcmp(cfg.kernel_name,"batch_norm_3D") || !strcmp(cfg.kernel_name,"renorm") || !strcmp(cfg.kernel_name,"norm_calc_3D") || !strcmp(cfg.kernel_name,"norm_apply_3D"))
     num_ops = inp_size;
+  else if(!strcmp(cfg.kernel_name,"layer_norm"))
+    num_ops = 2*inp_size;   // Stats pass and apply pass
 
   XTPWR_PROFILER_OPEN(0, profiler_name, profiler_params, num_ops, "OPs/cyc", 1);
 
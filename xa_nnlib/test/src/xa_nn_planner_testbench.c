@@ -0,0 +1,258 @@
+/*******************************************************************************
+* Copyright (c) 2018-2025 Cadence Design Systems, Inc.
+*
+* Permission is hereby granted, free of charge, to any person obtaining
+* a copy of this software and associated documentation files (the
+* "Software"), to use this Software with Cadence processor cores only and
+* not with any other processors and platforms, subject to
+* the following conditions:
+*
+* The above copyright notice and this permission notice shall be included
+* in all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+******************************************************************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "xa_type_def.h"
+#include "nnlib/xa_nnlib_api.h"
+#include "nnlib/xa_nnlib_planner_api.h"
+#include "cmdline_parser.h"
+#include "xa_nnlib_standards.h"
+
+/* Plans the arena of a DS-CNN style keyword spotting network (conv2d_std,
+ * depthwise separable blocks, avgpool, fully connected, softmax) and checks
+ * that no two buffers live at the same time share bytes. */
+
+#define MAX_BLOCKS 8
+#define MAX_OPS (3 + 2 * MAX_BLOCKS + 2)
+#define MAX_TENSORS (MAX_OPS + 1)
+
+typedef struct _test_config_t
+{
+  int help;
+  int input_height;
+  int input_width;
+  int channels;
+  int blocks;
+  int classes;
+  int alignment;
+  int verbose;
+}test_config_t;
+
+int default_config(test_config_t *p_cfg)
+{
+  if(p_cfg)
+  {
+    p_cfg->help = 0;
+    p_cfg->input_height = 49;
+    p_cfg->input_width = 10;
+    p_cfg->channels = 64;
+    p_cfg->blocks = 4;
+    p_cfg->classes = 12;
+    p_cfg->alignment = 16;
+    p_cfg->verbose = 0;
+    return 0;
+  }
+  else
+  {
+    return -1;
+  }
+}
+
+void show_usage(void)
+{
+    printf ("Usage xt-run <binary> [Options]\n");
+    printf("\t-input_height: input height (frames); Default=49\n");
+    printf("\t-input_width: input width (features); Default=10\n");
+    printf("\t-channels: channels of the depthwise separable blocks; Default=64\n");
+    printf("\t-blocks: depthwise separable blocks, 1 to %d; Default=4\n", MAX_BLOCKS);
+    printf("\t-classes: output classes; Default=12\n");
+    printf("\t-alignment: arena offset alignment in bytes, power of 2; Default=16\n");
+    printf("\t-verbose: print the offset of every buffer; Default=0\n");
+    printf("\t-h / -help / --help: Display this help message\n");
+}
+
+void parse_arguments(int argc, char** argv, test_config_t *p_cfg)
+{
+  int argidx;
+  for (argidx=1;argidx<argc;argidx++)
+  {
+    if(strncmp((argv[argidx]), "-", 1) != 0)
+    {
+      printf("Invalid argument: %s\n",argv[argidx]);
+      show_usage();
+      exit(1);
+    }
+    ARGTYPE_INDICATE("--help", p_cfg->help);
+    ARGTYPE_INDICATE("-help", p_cfg->help);
+    ARGTYPE_INDICATE("-h", p_cfg->help);
+    ARGTYPE_ONETIME_CONFIG("-input_height",p_cfg->input_height);
+    ARGTYPE_ONETIME_CONFIG("-input_width",p_cfg->input_width);
+    ARGTYPE_ONETIME_CONFIG("-channels",p_cfg->channels);
+    ARGTYPE_ONETIME_CONFIG("-blocks",p_cfg->blocks);
+    ARGTYPE_ONETIME_CONFIG("-classes",p_cfg->classes);
+    ARGTYPE_ONETIME_CONFIG("-alignment",p_cfg->alignment);
+    ARGTYPE_ONETIME_CONFIG("-verbose",p_cfg->verbose);
+
+    // If arg doesnt match with any of the above supported options, report option as invalid
+    printf("Invalid argument: %s\n",argv[argidx]);
+    show_usage();
+    exit(1);
+  }
+}
+
+static void set_conv(xa_nnlib_planner_op_t *p_op, xa_nnlib_planner_op_type_t type,
+    int ih, int iw, int ic, int kh, int kw, int stride, int pad, int oh, int ow, int oc)
+{
+  xa_nnlib_planner_conv_params_t *p = &p_op->params.conv;
+  memset(p_op, 0, sizeof(*p_op));
+  p_op->type = type;
+  p->input_height = ih;
+  p->input_width = iw;
+  p->input_channels = ic;
+  p->kernel_height = kh;
+  p->kernel_width = kw;
+  p->kernel_channels = ic;
+  p->channels_multiplier = 1;
+  p->num_groups = 1;
+  p->x_stride = stride;
+  p->y_stride = stride;
+  p->x_padding = pad;
+  p->y_padding = pad;
+  p->out_height = oh;
+  p->out_width = ow;
+  p->out_channels = oc;
+  p->dilation_height = 1;
+  p->dilation_width = 1;
+  p->input_precision = PREC_ASYM8S;
+  p->kernel_precision = PREC_SYM8S;
+  p->out_precision = PREC_ASYM8S;
+  p->inp_data_format = 0;
+  p->out_data_format = 0;
+}
+
+int xa_nn_main_process(int argc, char *argv[])
+{
+  test_config_t cfg;
+  xa_nnlib_planner_op_t ops[MAX_OPS];
+  xa_nnlib_planner_tensor_t tensors[MAX_TENSORS];
+  int n_ops = 0, n_tensors, itr, jtr, err, arena_size, total_size = 0, fail = 0;
+  int oh, ow, c;
+
+  if(default_config(&cfg))
+  {
+    return -1;
+  }
+
+  parse_arguments(argc, argv, &cfg);
+  if(cfg.help)
+  {
+    show_usage();
+    return 0;
+  }
+  if(cfg.blocks < 1 || cfg.blocks > MAX_BLOCKS)
+  {
+    printf("[Error] blocks must be between 1 and %d\n", MAX_BLOCKS);
+    return -1;
+  }
+
+  /* conv2d_std 10x4, stride 2 */
+  c = cfg.channels;
+  oh = (cfg.input_height + 1) / 2;
+  ow = (cfg.input_width + 1) / 2;
+  set_conv(&ops[n_ops++], XA_NNLIB_PLANNER_OP_CONV2D_STD, cfg.input_height, cfg.input_width, 1, 10, 4, 2, 1, oh, ow, c);
+
+  /* Depthwise 3x3 + pointwise (no scratch) per block */
+  for(itr = 0; itr < cfg.blocks; itr++)
+  {
+    set_conv(&ops[n_ops++], XA_NNLIB_PLANNER_OP_CONV2D_DEPTHWISE, oh, ow, c, 3, 3, 1, 1, oh, ow, c);
+    memset(&ops[n_ops], 0, sizeof(ops[n_ops]));
+    ops[n_ops++].type = XA_NNLIB_PLANNER_OP_CUSTOM;
+  }
+
+  /* Global average pool, fully connected, softmax */
+  set_conv(&ops[n_ops++], XA_NNLIB_PLANNER_OP_AVGPOOL, oh, ow, c, oh, ow, 1, 0, 1, 1, c);
+  memset(&ops[n_ops], 0, sizeof(ops[n_ops]));
+  ops[n_ops++].type = XA_NNLIB_PLANNER_OP_CUSTOM;
+  memset(&ops[n_ops], 0, sizeof(ops[n_ops]));
+  ops[n_ops].type = XA_NNLIB_PLANNER_OP_SOFTMAX;
+  ops[n_ops].params.softmax.inp_precision = PREC_ASYM8S;
+  ops[n_ops].params.softmax.out_precision = PREC_ASYM8S;
+  ops[n_ops++].params.softmax.length = cfg.classes;
+
+  /* Chain of activations: tensor i is the input of op i and the output of op i - 1 */
+  n_tensors = n_ops + 1;
+  tensors[0].size = cfg.input_height * cfg.input_width;
+  for(itr = 1; itr < n_tensors; itr++)
+  {
+    tensors[itr].size = (itr < n_ops - 2) ? oh * ow * c : (itr == n_ops - 2 ? c : cfg.classes);
+  }
+  for(itr = 0; itr < n_tensors; itr++)
+  {
+    tensors[itr].first_op = itr == 0 ? 0 : itr - 1;
+    tensors[itr].last_op = itr == n_ops ? n_ops - 1 : itr;
+  }
+
+  err = xa_nnlib_planner_plan(ops, n_ops, tensors, n_tensors, cfg.alignment, &arena_size);
+  if(err)
+  {
+    fprintf(stdout, "\nPlanner returned error 0x%x\n\n", err);
+    fprintf(stdout, "planner: FAIL\n");
+    return 0;
+  }
+
+  /* Buffers live together must not overlap and offsets must be aligned */
+  for(itr = 0; itr < n_tensors + n_ops; itr++)
+  {
+    int off_i = itr < n_tensors ? tensors[itr].offset : ops[itr - n_tensors].scratch_offset;
+    int size_i = itr < n_tensors ? tensors[itr].size : ops[itr - n_tensors].scratch_size;
+    int first_i = itr < n_tensors ? tensors[itr].first_op : itr - n_tensors;
+    int last_i = itr < n_tensors ? tensors[itr].last_op : itr - n_tensors;
+
+    total_size += size_i;
+    fail |= (off_i & (cfg.alignment - 1)) != 0 || off_i + size_i > arena_size;
+    if(cfg.verbose)
+    {
+      printf("%s %2d: ops [%2d, %2d] offset %6d size %6d\n", itr < n_tensors ? "tensor " : "scratch",
+          itr < n_tensors ? itr : itr - n_tensors, first_i, last_i, off_i, size_i);
+    }
+    for(jtr = 0; jtr < itr; jtr++)
+    {
+      int off_j = jtr < n_tensors ? tensors[jtr].offset : ops[jtr - n_tensors].scratch_offset;
+      int size_j = jtr < n_tensors ? tensors[jtr].size : ops[jtr - n_tensors].scratch_size;
+      int first_j = jtr < n_tensors ? tensors[jtr].first_op : jtr - n_tensors;
+      int last_j = jtr < n_tensors ? tensors[jtr].last_op : jtr - n_tensors;
+      if(first_i <= last_j && first_j <= last_i && off_i < off_j + size_j && off_j < off_i + size_i)
+      {
+        fail = 1;
+      }
+    }
+  }
+
+  fprintf(stdout, "\nArena size: %d bytes, sum of buffers: %d bytes\n", arena_size, total_size);
+  fprintf(stdout, "planner: %s\n", fail ? "FAIL" : "PASS");
+
+  return 0;
+}
+
+int main (int argc, char *argv[])
+{
+  int i;
+
+  for(i = 1; i < argc; i++)
+  {
+    fprintf(stdout, "%s ", argv[i]);
+  }
+  fprintf(stdout, "\n");
+
+  return xa_nn_main_process(argc, argv);
+}
@@ -177,7 +177,7 @@ void parse_arguments(int argc, char** argv, test_config_t *p_cfg)
     ARGTYPE_INDICATE("-help", p_cfg->help);
     ARGTYPE_INDICATE("-h", p_cfg->help);
     ARGTYPE_STRING("-kernel_name",p_cfg->kernel_name, MAX_RNN_NAME_LENGTH);
-    if(strcmp(p_cfg->kernel_name,"lstm") == 0)
+    if(strcmp(p_cfg->kernel_name,"lstm") == 0 || strcmp(p_cfg->kernel_name,"lstm_fused") == 0)
     {
       ARGTYPE_ONETIME_CONFIG("-input_zero_bias",p_cfg->quant_params.input_zero_bias);
       ARGTYPE_ONETIME_CONFIG("-hidden_zero_bias",p_cfg->quant_params.hidden_zero_bias);
@@ -236,7 +236,7 @@ void show_usage(void)
     printf("\t-hidden_size: Number of elements in hidden state; Default=96\n");
     printf("\t-time_major: Order of input and output 1: time is outer most dimension, 0: batch is outer most dimension Default=0\n");
     printf("\t-frames: Positive number; Default=2\n");
-    printf("\t-kernel_name: lstm; Default=lstm\n");
+    printf("\t-kernel_name: lstm, lstm_fused, gru, gru_fused; Default=lstm\n");
     printf("\t-write_file: set to 1 to write input and output vectors to file; Default=0\n");
     printf("\t-read_inp_file_name: Full filename for reading input \n");
     printf("\t-read_ref_file_name: Full filename for reading reference output \n");
@@ -269,6 +269,40 @@ void show_usage(void)
     XTPWR_PROFILER_STOP(0); \
   }
   
+#define LSTM_FUSED_8X8_16(KPREC, IOPREC, CPREC, KERNEL) \
+  if(!strcmp(cfg.kernel_name,#KERNEL) && (KPREC == cfg.ker_precision) && (IOPREC == cfg.io_precision) && (CPREC == cfg.cell_precision)) { \
+    err = xa_nn_lstm_fused_pack_weights_sym8s \
+              (\
+                &lstm_fused, \
+                p_fused_buf->p, \
+                &lstm_weights, \
+                &lstm_biases, \
+                &cfg.quant_params, \
+                cfg.inp_size, \
+                cfg.n_cell \
+              ); \
+    XTPWR_PROFILER_START(0); \
+    if(!err) \
+        err = xa_nn_lstm_fused_sym8sxasym8s_16 \
+              (\
+                (WORD8 *)p_out->p, \
+                (WORD8 *)p_hidden->p, \
+                (WORD16 *)p_cell->p, \
+                &lstm_fused, \
+                (WORD8 *)p_inp->p,\
+                cfg.inp_size, \
+                cfg.n_cell, \
+                cfg.n_cell, \
+                cfg.n_batch, \
+                cfg.n_itr, \
+                cfg.n_cell, \
+                &cfg.quant_params, \
+                &cfg.flags, \
+                p_scratch->p \
+              ); \
+    XTPWR_PROFILER_STOP(0); \
+  }
+
 #define GRU_8X8(KPREC, IOPREC, KERNEL) \
   if(!strcmp(cfg.kernel_name,#KERNEL) && (KPREC == cfg.ker_precision) && (IOPREC == cfg.io_precision)) { \
     XTPWR_PROFILER_START(0); \
@@ -291,9 +325,43 @@ void show_usage(void)
     XTPWR_PROFILER_STOP(0); \
   }
 
+#define GRU_FUSED_8X8(KPREC, IOPREC, KERNEL) \
+  if(!strcmp(cfg.kernel_name,#KERNEL) && (KPREC == cfg.ker_precision) && (IOPREC == cfg.io_precision)) { \
+    err = xa_nn_gru_fused_pack_weights_sym8s \
+              (\
+                &gru_fused, \
+                p_fused_buf->p, \
+                &gru_weights, \
+                &gru_biases, \
+                &cfg.gru_q_params, \
+                cfg.inp_size, \
+                cfg.hidden_size \
+              ); \
+    XTPWR_PROFILER_START(0); \
+    if(!err) \
+        err = xa_nn_gru_fused_sym8sxasym8s \
+              (\
+                (WORD8 *)p_out->p, \
+                (WORD8 *)p_hidden->p, \
+                &gru_fused, \
+                (WORD8 *)p_inp->p,\
+                cfg.inp_size, \
+                cfg.hidden_size, \
+                cfg.hidden_size, \
+                cfg.n_batch, \
+                cfg.n_itr, \
+                &cfg.gru_q_params, \
+                cfg.time_major, \
+                p_scratch->p \
+              ); \
+    XTPWR_PROFILER_STOP(0); \
+  }
+
 #define PROCESS_RNN \
     LSTM_8X8_16(-5, -4, 16, lstm) \
+    else LSTM_FUSED_8X8_16(-5, -4, 16, lstm_fused) \
     else GRU_8X8(-5, -4, gru) \
+    else GRU_FUSED_8X8(-5, -4, gru_fused) \
     else {  printf("unsupported RNN kernel\n"); return -1;}
 
 int xa_nn_main_process(int argc, char *argv[])
@@ -318,12 +386,15 @@ int xa_nn_main_process(int argc, char *argv[])
 
   buf1D_t *p_scratch;
   int scratch_size;
+  int is_gru;
 
 
 
   /*Declare variables for FC, peephole and layer norm buffers*/
   lstm_weights_ptrs lstm_weights;
   lstm_bias_ptrs lstm_biases;
+  lstm_fused_weights lstm_fused;
+  buf1D_t *p_fused_buf = NULL;
   buf1D_t *p_ig_W;
   buf1D_t *p_fg_W;
   buf1D_t *p_cg_W;
@@ -341,6 +412,7 @@ int xa_nn_main_process(int argc, char *argv[])
   /* declare gru weigth buffers */
   gru_weights_ptrs gru_weights;
   gru_bias_ptrs gru_biases;
+  gru_fused_weights gru_fused;
   buf1D_t *p_ug_W;
   buf1D_t *p_rg_W;
   buf1D_t *p_ms_W;
@@ -371,6 +443,7 @@ int xa_nn_main_process(int argc, char *argv[])
       return 0;
     }
   }
+  is_gru = (strcmp(cfg.kernel_name,"gru") == 0 || strcmp(cfg.kernel_name,"gru_fused") == 0);
 #if defined(USE_HIFI_ACT_TIE) && (defined(AE_SIGMOID16X4X2) || defined(AE_SIGMOID16X4) || defined(AE_TANH16X4X2) || defined(AE_TANH16X4))
   char *ext=".bin";
   char *dot_add = strstr(cfg.read_ref_file_name, ext);
@@ -378,13 +451,13 @@ int xa_nn_main_process(int argc, char *argv[])
   strcpy(dot_add, new_ext);
 #endif
   // Set profiler name
-  if(strcmp(cfg.kernel_name,"lstm") == 0 && cfg.ker_precision == -5 && cfg.io_precision == -4 && cfg.cell_precision == 16)
+  if((strcmp(cfg.kernel_name,"lstm") == 0 || strcmp(cfg.kernel_name,"lstm_fused") == 0) && cfg.ker_precision == -5 && cfg.io_precision == -4 && cfg.cell_precision == 16)
     sprintf(profiler_name, "%s_sym8sxasym8s_%d", cfg.kernel_name, cfg.cell_precision);
-  else if(strcmp(cfg.kernel_name,"gru") == 0 && cfg.ker_precision == -5 && cfg.io_precision == -4)
+  else if(is_gru && cfg.ker_precision == -5 && cfg.io_precision == -4)
     sprintf(profiler_name, "%s_sym8sxasym8s", cfg.kernel_name);
 
   // Set profiler parameters
-  if(strcmp(cfg.kernel_name,"gru") == 0)
+  if(is_gru)
   {
     sprintf(profiler_params, "inp_size=%d, n_itr=%d, n_batch=%d, hidden_size=%d",
           cfg.inp_size, cfg.n_itr, cfg.n_batch, cfg.hidden_size);
@@ -416,7 +489,7 @@ int xa_nn_main_process(int argc, char *argv[])
   // Open reference file if verify flag is enabled
   if(cfg.verify)
   {
-    if(strcmp(cfg.kernel_name,"gru") == 0)
+    if(is_gru)
       ptr_ref =  create_buf1D((cfg.n_batch * cfg.n_itr * cfg.hidden_size), cfg.io_precision);
     else
       ptr_ref =  create_buf1D((cfg.n_batch * cfg.n_itr * cfg.n_cell), cfg.io_precision);
@@ -426,7 +499,7 @@ int xa_nn_main_process(int argc, char *argv[])
 
   // Allocate Memory
   p_inp = create_buf1D((cfg.n_itr * cfg.n_batch * cfg.inp_size), cfg.io_precision); VALIDATE_PTR(p_inp);
-  if(strcmp(cfg.kernel_name,"gru") == 0)
+  if(is_gru)
   {
     p_out = create_buf1D((cfg.n_itr * cfg.n_batch * cfg.hidden_size), cfg.io_precision); VALIDATE_PTR(p_out);
     p_hidden = create_buf1D((cfg.n_batch * cfg.hidden_size), cfg.io_precision); VALIDATE_PTR(p_hidden);
@@ -461,6 +534,12 @@ int xa_nn_main_process(int argc, char *argv[])
 
     scratch_size = xa_nn_gru_getsize(cfg.n_batch, cfg.n_itr, cfg.hidden_size, cfg.io_precision);
     p_scratch = create_buf1D(scratch_size, 8); VALIDATE_PTR(p_scratch);
+
+    if(strcmp(cfg.kernel_name,"gru_fused") == 0)
+    {
+      int fused_size = xa_nn_gru_fused_weights_getsize(cfg.inp_size, cfg.hidden_size);
+      p_fused_buf = create_buf1D(fused_size, 8); VALIDATE_PTR(p_fused_buf);
+    }
   }
   else
   {
@@ -503,20 +582,26 @@ int xa_nn_main_process(int argc, char *argv[])
 
     scratch_size = xa_nn_lstm_getsize(cfg.n_batch, cfg.n_itr, cfg.n_cell, cfg.cell_precision);
     p_scratch = create_buf1D(scratch_size, 8); VALIDATE_PTR(p_scratch);
+
+    if(strcmp(cfg.kernel_name,"lstm_fused") == 0)
+    {
+      int fused_size = xa_nn_lstm_fused_weights_getsize(cfg.inp_size, cfg.n_cell);
+      p_fused_buf = create_buf1D(fused_size, 8); VALIDATE_PTR(p_fused_buf);
+    }
   }
 
-  if(strcmp(cfg.kernel_name,"lstm") == 0)
+  if(strcmp(cfg.kernel_name,"lstm") == 0 || strcmp(cfg.kernel_name,"lstm_fused") == 0)
   {
     XTPWR_PROFILER_OPEN(0, profiler_name, profiler_params, 4 * (cfg.n_itr * cfg.n_batch * cfg.n_cell) * (cfg.n_cell + cfg.inp_size), "MAC/cyc", 1);
   }
-  else if(strcmp(cfg.kernel_name,"gru") == 0)
+  else if(is_gru)
   {  
     XTPWR_PROFILER_OPEN(0, profiler_name, profiler_params, 3 * (cfg.n_itr * cfg.n_batch * cfg.hidden_size) * (cfg.hidden_size + cfg.inp_size), "MAC/cyc", 1);
   }
   // Frame processing loop
   for(frame = 0; frame < cfg.frames; frame++)
   {
-    if(strcmp(cfg.kernel_name,"gru") == 0)
+    if(is_gru)
     {
       load_gru_input_data(cfg.write_file, fptr_inp, p_inp, p_hidden, 
           p_ug_W, p_rg_W, p_ms_W, p_ug_U, p_rg_U, p_ms_U, 
@@ -567,7 +652,7 @@ int xa_nn_main_process(int argc, char *argv[])
   free_buf1D(p_hidden);
   free_buf1D(p_cell);
   free_buf1D(p_inp);
-  if(strcmp(cfg.kernel_name,"gru") == 0)
+  if(is_gru)
   {
     free_buf1D(p_ug_W);
     free_buf1D(p_rg_W);
@@ -582,6 +667,8 @@ int xa_nn_main_process(int argc, char *argv[])
     free_buf1D(p_ug_U_bias);
     free_buf1D(p_rg_U_bias);
     free_buf1D(p_ms_U_bias);
+    if(p_fused_buf)
+      free_buf1D(p_fused_buf);
   }
   else
   {
@@ -597,6 +684,8 @@ int xa_nn_main_process(int argc, char *argv[])
     free_buf1D(p_fg_W_bias);
     free_buf1D(p_cg_W_bias);
     free_buf1D(p_og_W_bias);
+    if(p_fused_buf)
+      free_buf1D(p_fused_buf);
   }
   if(cfg.verify)
   {
@@ -0,0 +1,461 @@
+/*******************************************************************************
+* Copyright (c) 2018-2025 Cadence Design Systems, Inc.
+*
+* Permission is hereby granted, free of charge, to any person obtaining
+* a copy of this software and associated documentation files (the
+* "Software"), to use this Software with Cadence processor cores only and
+* not with any other processors and platforms, subject to
+* the following conditions:
+*
+* The above copyright notice and this permission notice shall be included
+* in all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+******************************************************************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <pthread.h>
+#include "xa_type_def.h"
+#include "nnlib/xa_nnlib_api.h"
+#include "nnlib/xa_nnlib_standards.h"
+#include "cmdline_parser.h"
+
+/* Multi-core partitioning harness: runs a layer once through the monolithic
+ * v2 kernel, then split into disjoint output slices on N threads with one
+ * scratch buffer per thread, checks both outputs are bitexact and reports
+ * the wall clock speedup. */
+
+#define MAX_KERNEL_NAME_LENGTH 40
+#define MAX_THREADS 16
+#define XA_MAX_CMD_LINE_LENGTH 200
+
+#define VALIDATE_PTR(ptr) if(NULL == ptr) { printf("%s: allocation failed\n", #ptr); return -1;}
+
+typedef struct _test_config_t
+{
+  int help;
+  int input_height;
+  int input_width;
+  int input_channels;
+  int kernel_height;
+  int kernel_width;
+  int out_channels;
+  int x_stride;
+  int y_stride;
+  int x_padding;
+  int y_padding;
+  int out_height;
+  int out_width;
+  int out_data_format;
+  int threads;
+  int split_channels;
+  int frames;
+  char kernel_name[MAX_KERNEL_NAME_LENGTH];
+}test_config_t;
+
+typedef struct _slice_job_t
+{
+  test_config_t *p_cfg;
+  WORD8 *p_out;
+  WORD8 *p_inp;
+  WORD8 *p_kernel;
+  WORD32 *p_bias;
+  WORD32 *p_out_multiplier;
+  WORD32 *p_out_shift;
+  VOID *p_scratch;
+  int start;
+  int end;
+  int err;
+}slice_job_t;
+
+int default_config(test_config_t *p_cfg)
+{
+  if(p_cfg)
+  {
+    p_cfg->help = 0;
+    p_cfg->input_height = 32;
+    p_cfg->input_width = 32;
+    p_cfg->input_channels = 32;
+    p_cfg->kernel_height = 3;
+    p_cfg->kernel_width = 3;
+    p_cfg->out_channels = 32;
+    p_cfg->x_stride = 1;
+    p_cfg->y_stride = 1;
+    p_cfg->x_padding = 1;
+    p_cfg->y_padding = 1;
+    p_cfg->out_height = 32;
+    p_cfg->out_width = 32;
+    p_cfg->out_data_format = 0;
+    p_cfg->threads = 2;
+    p_cfg->split_channels = 0;
+    p_cfg->frames = 2;
+    strcpy(p_cfg->kernel_name, "conv2d_std");
+    return 0;
+  }
+  else
+  {
+    return -1;
+  }
+}
+
+void show_usage(void)
+{
+    printf ("Usage xt-run <binary> [Options]\n");
+    printf("\t-input_height: input height; Default=32\n");
+    printf("\t-input_width: input width; Default=32\n");
+    printf("\t-input_channels: input channels (cols for matmul, weight depth for fully_connected); Default=32\n");
+    printf("\t-kernel_height: kernel height; Default=3\n");
+    printf("\t-kernel_width: kernel width; Default=3\n");
+    printf("\t-out_channels: output channels (rows for matmul, out depth for fully_connected); Default=32\n");
+    printf("\t-x_stride: stride in width dimension; Default=1\n");
+    printf("\t-y_stride: stride in height dimension; Default=1\n");
+    printf("\t-x_padding: left padding in width dimension; Default=1\n");
+    printf("\t-y_padding: top padding in height dimension; Default=1\n");
+    printf("\t-out_height: output height (vectors for matmul); Default=32\n");
+    printf("\t-out_width: output width; Default=32\n");
+    printf("\t-out_data_format: 0 (NHWC), 1 (NCHW); Default=0\n");
+    printf("\t-threads: number of workers, 1 to %d; Default=2\n", MAX_THREADS);
+    printf("\t-split_channels: 0: split output rows, 1: split output channels; Default=0\n");
+    printf("\t-frames: Positive number; Default=2\n");
+    printf("\t-kernel_name: conv2d_std, conv2d_point, matmul, fully_connected; Default=conv2d_std\n");
+    printf("\t-h / -help / --help: Display this help message\n");
+}
+
+void parse_arguments(int argc, char** argv, test_config_t *p_cfg)
+{
+  int argidx;
+  for (argidx=1;argidx<argc;argidx++)
+  {
+    if(strncmp((argv[argidx]), "-", 1) != 0)
+    {
+      printf("Invalid argument: %s\n",argv[argidx]);
+      show_usage();
+      exit(1);
+    }
+    ARGTYPE_INDICATE("--help", p_cfg->help);
+    ARGTYPE_INDICATE("-help", p_cfg->help);
+    ARGTYPE_INDICATE("-h", p_cfg->help);
+    ARGTYPE_ONETIME_CONFIG("-input_height",p_cfg->input_height);
+    ARGTYPE_ONETIME_CONFIG("-input_width",p_cfg->input_width);
+    ARGTYPE_ONETIME_CONFIG("-input_channels",p_cfg->input_channels);
+    ARGTYPE_ONETIME_CONFIG("-kernel_height",p_cfg->kernel_height);
+    ARGTYPE_ONETIME_CONFIG("-kernel_width",p_cfg->kernel_width);
+    ARGTYPE_ONETIME_CONFIG("-out_channels",p_cfg->out_channels);
+    ARGTYPE_ONETIME_CONFIG("-x_stride",p_cfg->x_stride);
+    ARGTYPE_ONETIME_CONFIG("-y_stride",p_cfg->y_stride);
+    ARGTYPE_ONETIME_CONFIG("-x_padding",p_cfg->x_padding);
+    ARGTYPE_ONETIME_CONFIG("-y_padding",p_cfg->y_padding);
+    ARGTYPE_ONETIME_CONFIG("-out_height",p_cfg->out_height);
+    ARGTYPE_ONETIME_CONFIG("-out_width",p_cfg->out_width);
+    ARGTYPE_ONETIME_CONFIG("-out_data_format",p_cfg->out_data_format);
+    ARGTYPE_ONETIME_CONFIG("-threads",p_cfg->threads);
+    ARGTYPE_ONETIME_CONFIG("-split_channels",p_cfg->split_channels);
+    ARGTYPE_ONETIME_CONFIG("-frames",p_cfg->frames);
+    ARGTYPE_STRING("-kernel_name",p_cfg->kernel_name, MAX_KERNEL_NAME_LENGTH);
+
+    // If arg doesnt match with any of the above supported options, report option as invalid
+    printf("Invalid argument: %s\n",argv[argidx]);
+    show_usage();
+    exit(1);
+  }
+}
+
+static double time_usec(void)
+{
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec * 1e6 + ts.tv_nsec * 1e-3;
+}
+
+/* Number of output rows (or channels) a slice can be split over, and the
+ * granularity of the split */
+static int slice_extent(test_config_t *p_cfg, int *p_align)
+{
+  *p_align = 1;
+  if(!strcmp(p_cfg->kernel_name, "fully_connected"))
+  {
+    *p_align = 16;
+    return p_cfg->out_channels;
+  }
+  if(p_cfg->split_channels || !strcmp(p_cfg->kernel_name, "matmul"))
+  {
+    return p_cfg->out_channels;
+  }
+  if(!strcmp(p_cfg->kernel_name, "conv2d_point"))
+  {
+    return p_cfg->input_height;
+  }
+  return p_cfg->out_height;
+}
+
+/* Runs slice [start, end) of the layer; start = 0, end = extent is the
+ * whole layer through the same entry point as the monolithic reference */
+static int run_slice(test_config_t *p_cfg, slice_job_t *p_job, int full)
+{
+  test_config_t cfg = *p_cfg;
+  int row_start = 0, row_end, ch_start = 0, ch_end = cfg.out_channels;
+  int err = 0;
+
+  if(!strcmp(cfg.kernel_name, "conv2d_std"))
+  {
+    row_end = cfg.out_height;
+    if(cfg.split_channels) { ch_start = p_job->start; ch_end = p_job->end; }
+    else { row_start = p_job->start; row_end = p_job->end; }
+    if(full)
+      err = xa_nn_conv2d_std_v2_per_chan_sym8sxasym8s(p_job->p_out, p_job->p_inp, p_job->p_kernel, p_job->p_bias,
+          cfg.input_height, cfg.input_width, cfg.input_channels, cfg.kernel_height, cfg.kernel_width, cfg.out_channels,
+          cfg.x_stride, cfg.y_stride, cfg.x_padding, cfg.y_padding, cfg.out_height, cfg.out_width,
+          -3, p_job->p_out_multiplier, p_job->p_out_shift, 5, cfg.out_data_format, p_job->p_scratch, -128, 127, NULL);
+    else
+      err = xa_nn_conv2d_std_v2_slice_per_chan_sym8sxasym8s(p_job->p_out, p_job->p_inp, p_job->p_kernel, p_job->p_bias,
+          cfg.input_height, cfg.input_width, cfg.input_channels, cfg.kernel_height, cfg.kernel_width, cfg.out_channels,
+          cfg.x_stride, cfg.y_stride, cfg.x_padding, cfg.y_padding, cfg.out_height, cfg.out_width,
+          -3, p_job->p_out_multiplier, p_job->p_out_shift, 5, cfg.out_data_format, p_job->p_scratch, -128, 127,
+          row_start, row_end, ch_start, ch_end, NULL);
+  }
+  else if(!strcmp(cfg.kernel_name, "conv2d_point"))
+  {
+    row_end = cfg.input_height;
+    if(cfg.split_channels) { ch_start = p_job->start; ch_end = p_job->end; }
+    else { row_start = p_job->start; row_end = p_job->end; }
+    if(full)
+      err = xa_nn_conv2d_pointwise_v2_per_chan_sym8sxasym8s(p_job->p_out, p_job->p_kernel, p_job->p_inp, p_job->p_bias,
+          cfg.input_height, cfg.input_width, cfg.input_channels, cfg.out_channels,
+          -3, p_job->p_out_multiplier, p_job->p_out_shift, 5, cfg.out_data_format, -128, 127, NULL);
+    else
+      err = xa_nn_conv2d_pointwise_v2_slice_per_chan_sym8sxasym8s(p_job->p_out, p_job->p_kernel, p_job->p_inp, p_job->p_bias,
+          cfg.input_height, cfg.input_width, cfg.input_channels, cfg.out_channels,
+          -3, p_job->p_out_multiplier, p_job->p_out_shift, 5, cfg.out_data_format, -128, 127,
+          row_start, row_end, ch_start, ch_end, NULL);
+  }
+  else if(!strcmp(cfg.kernel_name, "matmul"))
+  {
+    /* rows = out_channels, vectors = out_height, NHWC like output */
+    if(full)
+      err = xa_nn_matmul_v2_per_chan_sym8sxasym8s_asym8s(p_job->p_out, p_job->p_kernel, p_job->p_inp, p_job->p_bias,
+          cfg.out_channels, cfg.input_channels, cfg.input_channels, cfg.out_height, cfg.input_channels, cfg.out_channels, 1,
+          -3, p_job->p_out_multiplier, p_job->p_out_shift, 5, -128, 127, NULL);
+    else
+      err = xa_nn_matmul_v2_slice_per_chan_sym8sxasym8s_asym8s(p_job->p_out, p_job->p_kernel, p_job->p_inp, p_job->p_bias,
+          cfg.out_channels, cfg.input_channels, cfg.input_channels, cfg.out_height, cfg.input_channels, cfg.out_channels, 1,
+          -3, p_job->p_out_multiplier, p_job->p_out_shift, 5, -128, 127,
+          p_job->start, p_job->end, 0, cfg.out_height, NULL);
+  }
+  else if(!strcmp(cfg.kernel_name, "fully_connected"))
+  {
+    if(full)
+      err = xa_nn_fully_connected_v2_asym8sxasym8s_asym8s(p_job->p_out, p_job->p_kernel, p_job->p_inp, p_job->p_bias,
+          cfg.input_channels, cfg.out_channels, -3, 0, p_job->p_out_multiplier[0], p_job->p_out_shift[0], 5, -128, 127, NULL);
+    else
+      err = xa_nn_fully_connected_v2_slice_asym8sxasym8s_asym8s(p_job->p_out, p_job->p_kernel, p_job->p_inp, p_job->p_bias,
+          cfg.input_channels, cfg.out_channels, -3, 0, p_job->p_out_multiplier[0], p_job->p_out_shift[0], 5, -128, 127,
+          p_job->start, p_job->end, NULL);
+  }
+  else
+  {
+    printf("[Error] [%s] kernel is not supported\n", cfg.kernel_name);
+    err = -1;
+  }
+  return err;
+}
+
+static void *slice_worker(void *p_arg)
+{
+  slice_job_t *p_job = (slice_job_t *)p_arg;
+  p_job->err = run_slice(p_job->p_cfg, p_job, 0);
+  return NULL;
+}
+
+static int scratch_bytes(test_config_t *p_cfg)
+{
+  if(!strcmp(p_cfg->kernel_name, "conv2d_std"))
+  {
+    return xa_nn_conv2d_std_getsize(p_cfg->input_height, p_cfg->input_width, p_cfg->input_channels,
+        p_cfg->kernel_height, p_cfg->kernel_width, p_cfg->input_channels, p_cfg->y_stride, p_cfg->y_padding,
+        p_cfg->x_stride, p_cfg->x_padding, p_cfg->out_height, p_cfg->out_width, p_cfg->out_channels,
+        PREC_ASYM8S, PREC_SYM8S, 1, 1, p_cfg->out_data_format);
+  }
+  return 0;
+}
+
+static void fill_random(WORD8 *p, int n)
+{
+  int i;
+  for(i = 0; i < n; i++)
+    p[i] = (WORD8)((rand() & 0xff) - 128);
+}
+
+int xa_nn_main_process(int argc, char *argv[])
+{
+  test_config_t cfg;
+  slice_job_t ref_job, jobs[MAX_THREADS];
+  pthread_t threads[MAX_THREADS];
+  int inp_size, kernel_size, out_size, scratch_size;
+  int extent, align, chunk, itr, frame, err = 0, pass_count = 0;
+  double t_ref = 0, t_slice = 0, t0;
+  WORD8 *p_inp, *p_kernel, *p_out_ref, *p_out;
+  WORD32 *p_bias, *p_out_multiplier, *p_out_shift;
+
+  if(default_config(&cfg))
+  {
+    return -1;
+  }
+
+  parse_arguments(argc, argv, &cfg);
+  if(cfg.help)
+  {
+    show_usage();
+    return 0;
+  }
+  if(cfg.threads < 1 || cfg.threads > MAX_THREADS)
+  {
+    printf("[Error] threads must be between 1 and %d\n", MAX_THREADS);
+    return -1;
+  }
+
+  inp_size = cfg.input_height * cfg.input_width * cfg.input_channels;
+  kernel_size = cfg.out_channels * cfg.kernel_height * cfg.kernel_width * cfg.input_channels;
+  out_size = cfg.out_height * cfg.out_width * cfg.out_channels;
+  if(strcmp(cfg.kernel_name, "conv2d_std"))
+  {
+    kernel_size = cfg.out_channels * cfg.input_channels;
+  }
+  if(!strcmp(cfg.kernel_name, "conv2d_point"))
+  {
+    out_size = cfg.input_height * cfg.input_width * cfg.out_channels;
+  }
+  else if(!strcmp(cfg.kernel_name, "matmul"))
+  {
+    inp_size = cfg.out_height * cfg.input_channels;
+    out_size = cfg.out_height * cfg.out_channels;
+  }
+  else if(!strcmp(cfg.kernel_name, "fully_connected"))
+  {
+    inp_size = cfg.input_channels;
+    out_size = cfg.out_channels;
+  }
+  scratch_size = scratch_bytes(&cfg);
+  if(scratch_size < 0)
+  {
+    printf("[Error] invalid parameters for getsize\n");
+    return -1;
+  }
+
+  /* 16 byte aligned buffers, as required by the v2 fully connected kernels */
+  p_inp = (WORD8 *)aligned_alloc(16, (inp_size + 15) & ~15);                           VALIDATE_PTR(p_inp);
+  p_kernel = (WORD8 *)aligned_alloc(16, (kernel_size + 15) & ~15);                     VALIDATE_PTR(p_kernel);
+  p_out_ref = (WORD8 *)aligned_alloc(16, (out_size + 15) & ~15);                       VALIDATE_PTR(p_out_ref);
+  p_out = (WORD8 *)aligned_alloc(16, (out_size + 15) & ~15);                           VALIDATE_PTR(p_out);
+  p_bias = (WORD32 *)aligned_alloc(16, ((cfg.out_channels + 3) & ~3) * sizeof(WORD32));        VALIDATE_PTR(p_bias);
+  p_out_multiplier = (WORD32 *)malloc(cfg.out_channels * sizeof(WORD32));             VALIDATE_PTR(p_out_multiplier);
+  p_out_shift = (WORD32 *)malloc(cfg.out_channels * sizeof(WORD32));                  VALIDATE_PTR(p_out_shift);
+
+  srand(1);
+  for(itr = 0; itr < cfg.out_channels; itr++)
+  {
+    p_bias[itr] = (rand() & 0xffff) - 0x8000;
+    p_out_multiplier[itr] = 0x40000000 + (rand() & 0x3fffffff);
+    p_out_shift[itr] = -(rand() & 7) - 4;
+  }
+
+  memset(&ref_job, 0, sizeof(ref_job));
+  ref_job.p_cfg = &cfg;
+  ref_job.p_out = p_out_ref;
+  ref_job.p_inp = p_inp;
+  ref_job.p_kernel = p_kernel;
+  ref_job.p_bias = p_bias;
+  ref_job.p_out_multiplier = p_out_multiplier;
+  ref_job.p_out_shift = p_out_shift;
+  ref_job.p_scratch = scratch_size > 0 ? malloc(scratch_size) : NULL;
+
+  /* Split the extent in near equal slices on the required granularity */
+  extent = slice_extent(&cfg, &align);
+  chunk = (extent + cfg.threads - 1) / cfg.threads;
+  chunk = (chunk + align - 1) / align * align;
+  for(itr = 0; itr < cfg.threads; itr++)
+  {
+    jobs[itr] = ref_job;
+    jobs[itr].p_out = p_out;
+    jobs[itr].p_scratch = scratch_size > 0 ? malloc(scratch_size) : NULL;
+    jobs[itr].start = itr * chunk < extent ? itr * chunk : extent;
+    jobs[itr].end = (itr + 1) * chunk < extent ? (itr + 1) * chunk : extent;
+  }
+  ref_job.start = 0;
+  ref_job.end = extent;
+
+  for(frame = 0; frame < cfg.frames; frame++)
+  {
+    fill_random(p_inp, inp_size);
+    fill_random(p_kernel, kernel_size);
+    memset(p_out, 0, out_size);
+
+    t0 = time_usec();
+    err = run_slice(&cfg, &ref_job, 1);
+    t_ref += time_usec() - t0;
+
+    t0 = time_usec();
+    for(itr = 0; itr < cfg.threads; itr++)
+    {
+      if(jobs[itr].start < jobs[itr].end)
+        pthread_create(&threads[itr], NULL, slice_worker, &jobs[itr]);
+    }
+    for(itr = 0; itr < cfg.threads; itr++)
+    {
+      if(jobs[itr].start < jobs[itr].end)
+      {
+        pthread_join(threads[itr], NULL);
+        err |= jobs[itr].err;
+      }
+    }
+    t_slice += time_usec() - t0;
+
+    if(err)
+    {
+      fprintf(stdout, "\nKernel returned error (invalid parameters)\n\n");
+      break;
+    }
+    pass_count += !memcmp(p_out_ref, p_out, out_size);
+  }
+
+  fprintf(stdout, "%s threads %d split %s: %s, monolithic %.1f us, sliced %.1f us, speedup %.2f\n",
+      cfg.kernel_name, cfg.threads, cfg.split_channels ? "channels" : "rows",
+      (pass_count == cfg.frames) ? "PASS" : "FAIL",
+      t_ref / cfg.frames, t_slice / cfg.frames, t_slice > 0 ? t_ref / t_slice : 0);
+
+  for(itr = 0; itr < cfg.threads; itr++)
+  {
+    free(jobs[itr].p_scratch);
+  }
+  free(ref_job.p_scratch);
+  free(p_inp);
+  free(p_kernel);
+  free(p_out_ref);
+  free(p_out);
+  free(p_bias);
+  free(p_out_multiplier);
+  free(p_out_shift);
+
+  return 0;
+}
+
+int main (int argc, char *argv[])
+{
+  int i;
+
+  for(i = 1; i < argc; i++)
+  {
+    fprintf(stdout, "%s ", argv[i]);
+  }
+  fprintf(stdout, "\n");
+
+  return xa_nn_main_process(argc, argv);
+}